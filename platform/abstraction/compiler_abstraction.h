@@ -114,6 +114,12 @@
     #define COMPILER_TYPE_GCC
     #define COMPILER_NAME "GCC ARM"
     
+/* GCC host build (software-in-the-loop, POSIX OS port) */
+#elif defined(__GNUC__) && defined(OS_PORT_POSIX)
+    #define COMPILER_TYPE_GCC
+    #define COMPILER_HOST_BUILD
+    #define COMPILER_NAME "GCC Host (SIL)"
+    
 /* Green Hills Software Compiler */
 #elif defined(__ghs__)
     #define COMPILER_TYPE_GHS
@@ -145,24 +151,24 @@
      * @brief   Place function in specified section
      * @details Usage: FUNC_SECTION(section_name) void MyFunction(void)
      */
-    #define FUNC_SECTION(section) __attribute__((section(section)))
+    #define FUNC_SECTION(name) __attribute__((section(name)))
     
     /**
      * @brief   Place variable in specified section
      * @details Usage: VAR_SECTION(section_name) uint32_t myVariable;
      */
-    #define VAR_SECTION(section) __attribute__((section(section)))
+    #define VAR_SECTION(name) __attribute__((section(name)))
     
     /**
      * @brief   Place constant in specified section
      * @details Usage: CONST_SECTION(section_name) const uint32_t myConst = 10U;
      */
-    #define CONST_SECTION(section) __attribute__((section(section)))
+    #define CONST_SECTION(name) __attribute__((section(name)))
 
 #elif defined(COMPILER_TYPE_GHS)
-    #define FUNC_SECTION(section) __attribute__((section(section)))
-    #define VAR_SECTION(section) __attribute__((section(section)))
-    #define CONST_SECTION(section) __attribute__((section(section)))
+    #define FUNC_SECTION(name) __attribute__((section(name)))
+    #define VAR_SECTION(name) __attribute__((section(name)))
+    #define CONST_SECTION(name) __attribute__((section(name)))
 
 #elif defined(COMPILER_TYPE_IAR)
     #define FUNC_SECTION(section) _Pragma("location=\"" #section "\"")
@@ -170,9 +176,9 @@
     #define CONST_SECTION(section) _Pragma("location=\"" #section "\"")
 
 #elif defined(COMPILER_TYPE_ARMCC)
-    #define FUNC_SECTION(section) __attribute__((section(section)))
-    #define VAR_SECTION(section) __attribute__((section(section)))
-    #define CONST_SECTION(section) __attribute__((section(section)))
+    #define FUNC_SECTION(name) __attribute__((section(name)))
+    #define VAR_SECTION(name) __attribute__((section(name)))
+    #define CONST_SECTION(name) __attribute__((section(name)))
 #endif
 
 /** @} */
@@ -185,15 +191,20 @@
 #if defined(COMPILER_TYPE_GCC)
     /**
      * @brief   Inline function optimization hint
-     * @details Suggests compiler to inline the function
+     * @details Suggests compiler to inline the function; kept if platform_types.h
+     *          defined it first (host build)
      */
+    #ifndef INLINE
     #define INLINE inline __attribute__((always_inline))
+    #endif
     
     /**
      * @brief   Static inline function
      * @details For internal helper functions
      */
+    #ifndef STATIC_INLINE
     #define STATIC_INLINE static inline __attribute__((always_inline))
+    #endif
     
     /**
      * @brief   No inline function directive
@@ -223,7 +234,9 @@
      * @brief   Unused attribute
      * @details Suppresses unused parameter/variable warnings
      */
+    #ifndef UNUSED
     #define UNUSED __attribute__((unused))
+    #endif
     
     /**
      * @brief   Packed structure attribute
@@ -384,7 +397,16 @@
  * @{
  */
 
-#if defined(COMPILER_TYPE_GCC)
+#if defined(COMPILER_TYPE_GCC) && defined(COMPILER_HOST_BUILD)
+    /* Host build: map ARM barriers to C11-style fences */
+    #define MEMORY_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #define MEMORY_BARRIER_FULL() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #define MEMORY_BARRIER_INNER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #define DATA_SYNC_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #define INSTRUCTION_SYNC_BARRIER() __asm__ volatile ("" ::: "memory")
+    #define COMPILER_BARRIER() __asm__ volatile ("" ::: "memory")
+
+#elif defined(COMPILER_TYPE_GCC)
     /**
      * @brief   Full memory barrier (system-wide)
      * @details Prevents compiler and hardware reordering across this point
@@ -708,6 +730,11 @@
      */
     #define POPCOUNT(x) ((uint32_t)__builtin_popcount(x))
 
+    /**
+     * @brief   Reverse the byte order of a 32-bit value (REV)
+     */
+    #define BYTE_SWAP32(x) ((uint32_t)__builtin_bswap32(x))
+
 #elif defined(COMPILER_TYPE_IAR)
     #define COUNT_LEADING_ZEROS(x) ((uint32_t)__CLZ(x))
     
@@ -738,6 +765,7 @@
         return x & 0x3FU;
     }
     #define POPCOUNT(x) POPCOUNT_SW(x)
+    #define BYTE_SWAP32(x) ((uint32_t)__REV(x))
 
 #elif defined(COMPILER_TYPE_ARMCC)
     #define COUNT_LEADING_ZEROS(x) ((uint32_t)__clz(x))
@@ -769,6 +797,7 @@
         return x & 0x3FU;
     }
     #define POPCOUNT(x) POPCOUNT_SW(x)
+    #define BYTE_SWAP32(x) ((uint32_t)__rev(x))
 #endif
 
 /** @} */
@@ -0,0 +1,367 @@
+/**
+ * @file    stack_monitor.c
+ * @brief   Stack Usage Monitor - Painting and High-Water-Mark Measurement Implementation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the stack measurement declared in stack_monitor.h.
+ *
+ * Implementation Notes:
+ * - Stacks grow toward their base, so the untouched part is a contiguous
+ *   run of pattern words starting at the base (above an optional guard).
+ *   The scan walks upward and stops at the first overwritten word; a word
+ *   inside used stack that happens to equal the pattern cannot shorten the
+ *   result because the scan never looks beyond the first overwritten word
+ * - Every scan restarts at the base because usage can only grow downward;
+ *   one MainFunction call reads at most STACKMON_SCAN_WORDS_PER_CALL words
+ *   and may cover several small regions
+ * - Reading another core's stack is harmless; the scan never writes
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see stack_monitor.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "stack_monitor.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define STACKMON_C_VENDOR_ID                    43U
+#define STACKMON_C_SW_MAJOR_VERSION             1U
+#define STACKMON_C_SW_MINOR_VERSION             0U
+#define STACKMON_C_SW_PATCH_VERSION             0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (STACKMON_C_VENDOR_ID != STACKMON_VENDOR_ID)
+    #error "stack_monitor.c and stack_monitor.h have different vendor IDs"
+#endif
+
+#if ((STACKMON_C_SW_MAJOR_VERSION != STACKMON_SW_MAJOR_VERSION) || \
+     (STACKMON_C_SW_MINOR_VERSION != STACKMON_SW_MINOR_VERSION) || \
+     (STACKMON_C_SW_PATCH_VERSION != STACKMON_SW_PATCH_VERSION))
+    #error "Software version mismatch between stack_monitor.c and stack_monitor.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (STACKMON_DEV_ERROR_DETECT == STD_ON)
+    #define STACKMON_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(STACKMON_MODULE_ID, STACKMON_INSTANCE_ID, (api), (err)))
+#else
+    #define STACKMON_REPORT_ERROR(api, err)     ((void)0)
+#endif
+
+#define STACKMON_WORD_SIZE                      4U
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Measurement state of one region
+ */
+typedef struct
+{
+    P2VAR(uint32, TYPEDEF, STACKMON_VAR) start;     /**< Lowest painted word (above the guard) */
+    P2VAR(uint32, TYPEDEF, STACKMON_VAR) end;       /**< One past the highest word (initial SP) */
+    uint32 max_used;                                /**< High-water mark in bytes */
+    uint32 scans;                                   /**< Completed scans */
+} StackMon_RegionStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC StackMon_RegionStateType StackMon_Regions[STACKMON_MAX_REGIONS];
+STATIC uint8 StackMon_RegionCount = 0U;
+
+/** @brief Region and word the next MainFunction call continues with */
+STATIC uint8 StackMon_ScanRegion = 0U;
+STATIC P2CONST(uint32, AUTOMATIC, STACKMON_VAR) StackMon_ScanCursor = NULL_PTR;
+
+/** @brief Lowest stack pointer at entry of each task, NULL_PTR if never started */
+STATIC P2CONST(uint32, AUTOMATIC, STACKMON_VAR) StackMon_TaskEntrySp[STACKMON_MAX_TASKS];
+
+STATIC boolean StackMon_Initialized = FALSE;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void StackMon_Paint(P2CONST(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) Region);
+STATIC void StackMon_CompleteScan(P2VAR(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) Region,
+                                  uint8 RegionId);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Fill the unused part of a region with the paint pattern
+ * @details On the active stack only the words below the current stack
+ *          pointer (minus STACKMON_PAINT_MARGIN) are painted.
+ */
+STATIC void StackMon_Paint(P2CONST(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) Region)
+{
+    P2CONST(uint32, AUTOMATIC, STACKMON_VAR) sp = StackMon_GetStackPointer();
+    P2VAR(uint32, AUTOMATIC, STACKMON_VAR) limit = Region->end;
+    P2VAR(uint32, AUTOMATIC, STACKMON_VAR) word;
+
+    if ((sp >= Region->start) && (sp < Region->end))
+    {
+        uint32 free_words = (uint32)(sp - Region->start);
+        uint32 margin_words = STACKMON_PAINT_MARGIN / STACKMON_WORD_SIZE;
+
+        limit = Region->start + ((free_words > margin_words) ? (free_words - margin_words) : 0U);
+    }
+
+    for (word = Region->start; word < limit; word++)
+    {
+        *word = STACKMON_PAINT_PATTERN;
+    }
+}
+
+/**
+ * @brief Record the result of a finished scan of one region
+ */
+STATIC void StackMon_CompleteScan(P2VAR(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) Region,
+                                  uint8 RegionId)
+{
+    uint32 used = (uint32)(Region->end - StackMon_ScanCursor) * STACKMON_WORD_SIZE;
+
+    if (used > Region->max_used)
+    {
+        Region->max_used = used;
+#if defined(STACKMON_HWM_CALLOUT)
+        STACKMON_HWM_CALLOUT(RegionId, used);
+#else
+        (void)RegionId;
+#endif
+    }
+    Region->scans++;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Current stack pointer of the executing context
+ */
+P2CONST(uint32, AUTOMATIC, STACKMON_VAR) StackMon_GetStackPointer(void)
+{
+#if defined(COMPILER_HOST_BUILD)
+    return (P2CONST(uint32, AUTOMATIC, STACKMON_VAR))__builtin_frame_address(0);
+#else
+    P2CONST(uint32, AUTOMATIC, STACKMON_VAR) sp;
+
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+
+    return sp;
+#endif
+}
+
+/**
+ * @brief Paint all stack regions and reset the measurements
+ */
+void StackMon_Init(P2CONST(StackMon_RegionConfigType, AUTOMATIC, STACKMON_APPL_CONST) Config,
+                   uint8 Count)
+{
+    uint8 id;
+
+    if (Config == NULL_PTR)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_INIT_API_ID, STACKMON_E_PARAM_POINTER);
+        return;
+    }
+
+    if ((Count == 0U) || (Count > STACKMON_MAX_REGIONS))
+    {
+        STACKMON_REPORT_ERROR(STACKMON_INIT_API_ID, STACKMON_E_PARAM_CONFIG);
+        return;
+    }
+
+    for (id = 0U; id < Count; id++)
+    {
+        if ((Config[id].base == NULL_PTR) ||
+            ((Config[id].size % STACKMON_WORD_SIZE) != 0U) ||
+            ((Config[id].guard_size % STACKMON_WORD_SIZE) != 0U) ||
+            (Config[id].guard_size >= Config[id].size))
+        {
+            STACKMON_REPORT_ERROR(STACKMON_INIT_API_ID, STACKMON_E_PARAM_CONFIG);
+            return;
+        }
+    }
+
+    for (id = 0U; id < Count; id++)
+    {
+        P2VAR(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) region = &StackMon_Regions[id];
+
+        region->start = Config[id].base + (Config[id].guard_size / STACKMON_WORD_SIZE);
+        region->end = Config[id].base + (Config[id].size / STACKMON_WORD_SIZE);
+        region->max_used = 0UL;
+        region->scans = 0UL;
+
+        StackMon_Paint(region);
+    }
+
+    for (id = 0U; id < STACKMON_MAX_TASKS; id++)
+    {
+        StackMon_TaskEntrySp[id] = NULL_PTR;
+    }
+
+    StackMon_RegionCount = Count;
+    StackMon_ScanRegion = 0U;
+    StackMon_ScanCursor = StackMon_Regions[0].start;
+    StackMon_Initialized = TRUE;
+}
+
+/**
+ * @brief Background scan step
+ */
+void StackMon_MainFunction(void)
+{
+    uint32 budget = STACKMON_SCAN_WORDS_PER_CALL;
+
+    if (StackMon_Initialized == FALSE)
+    {
+        return;
+    }
+
+    while (budget > 0U)
+    {
+        P2VAR(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) region = &StackMon_Regions[StackMon_ScanRegion];
+
+        if ((StackMon_ScanCursor < region->end) && (*StackMon_ScanCursor == STACKMON_PAINT_PATTERN))
+        {
+            StackMon_ScanCursor++;
+        }
+        else
+        {
+            /* First overwritten word (or top of stack) reached */
+            StackMon_CompleteScan(region, StackMon_ScanRegion);
+
+            StackMon_ScanRegion++;
+            if (StackMon_ScanRegion >= StackMon_RegionCount)
+            {
+                StackMon_ScanRegion = 0U;
+            }
+            StackMon_ScanCursor = StackMon_Regions[StackMon_ScanRegion].start;
+        }
+        budget--;
+    }
+}
+
+/**
+ * @brief Copy the measured usage of a region
+ */
+Std_ReturnType StackMon_GetUsage(uint8 RegionId,
+    P2VAR(StackMon_UsageType, AUTOMATIC, STACKMON_APPL_DATA) Usage)
+{
+    P2CONST(StackMon_RegionStateType, AUTOMATIC, STACKMON_VAR) region;
+
+    if (Usage == NULL_PTR)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_GET_USAGE_API_ID, STACKMON_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (StackMon_Initialized == FALSE)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_GET_USAGE_API_ID, STACKMON_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (RegionId >= StackMon_RegionCount)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_GET_USAGE_API_ID, STACKMON_E_PARAM_ID);
+        return E_NOT_OK;
+    }
+
+    region = &StackMon_Regions[RegionId];
+    Usage->size = (uint32)(region->end - region->start) * STACKMON_WORD_SIZE;
+    Usage->max_used = region->max_used;
+    Usage->scans = region->scans;
+
+    return E_OK;
+}
+
+/**
+ * @brief Record the stack pointer at task entry
+ */
+void StackMon_NotifyTaskEntry(uint8 TaskId)
+{
+    P2CONST(uint32, AUTOMATIC, STACKMON_VAR) sp = StackMon_GetStackPointer();
+
+    if (TaskId >= STACKMON_MAX_TASKS)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_TASK_ENTRY_API_ID, STACKMON_E_PARAM_ID);
+        return;
+    }
+
+    if ((StackMon_TaskEntrySp[TaskId] == NULL_PTR) || (sp < StackMon_TaskEntrySp[TaskId]))
+    {
+        StackMon_TaskEntrySp[TaskId] = sp;
+    }
+}
+
+/**
+ * @brief Deepest observed start depth of a task
+ */
+Std_ReturnType StackMon_GetTaskEntryDepth(uint8 TaskId,
+    P2VAR(uint32, AUTOMATIC, STACKMON_APPL_DATA) Depth)
+{
+    P2CONST(uint32, AUTOMATIC, STACKMON_VAR) sp;
+    uint8 id;
+
+    if (Depth == NULL_PTR)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_GET_TASK_DEPTH_API_ID, STACKMON_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (TaskId >= STACKMON_MAX_TASKS)
+    {
+        STACKMON_REPORT_ERROR(STACKMON_GET_TASK_DEPTH_API_ID, STACKMON_E_PARAM_ID);
+        return E_NOT_OK;
+    }
+
+    sp = StackMon_TaskEntrySp[TaskId];
+    if (sp == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    for (id = 0U; id < StackMon_RegionCount; id++)
+    {
+        if ((sp >= StackMon_Regions[id].start) && (sp <= StackMon_Regions[id].end))
+        {
+            *Depth = (uint32)(StackMon_Regions[id].end - sp) * STACKMON_WORD_SIZE;
+            return E_OK;
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
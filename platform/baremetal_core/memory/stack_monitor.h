@@ -0,0 +1,255 @@
+/**
+ * @file    stack_monitor.h
+ * @brief   Stack Usage Monitor - Painting and High-Water-Mark Measurement
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Measures the worst-case usage of every configured stack so the stack
+ * reservations of the linker scripts can be sized from data:
+ *
+ * - StackMon_Init() paints each stack region with STACKMON_PAINT_PATTERN
+ *   (the active stack only below the current stack pointer)
+ * - StackMon_MainFunction() scans the regions from their lowest address
+ *   upward; the first overwritten word is the high-water mark. The scan is
+ *   incremental: each call checks at most STACKMON_SCAN_WORDS_PER_CALL
+ *   words and resumes where the previous call stopped, so its run time is
+ *   bounded independent of the stack sizes
+ * - StackMon_NotifyTaskEntry() (called by the OS dispatcher) records the
+ *   deepest stack pointer at which each task has been started. The BCC
+ *   tasks of a core share one stack, so this gives the preemption depth a
+ *   task body can find when it starts
+ *
+ * A region is typically the main stack (MSP) of a core; any additional
+ * stacks (process stacks, exception stacks of the second core) are added
+ * as further regions. An optional MPU guard at the bottom of a region is
+ * excluded from painting and scanning (see stack_overflow_check.h).
+ *
+ * Example (linker symbols of the main stack):
+ * @code
+ * extern uint32 __StackLimit[];
+ * static const StackMon_RegionConfigType Stacks[1] = {
+ *     { __StackLimit, 0x2000UL, 32UL, 7U }
+ * };
+ * StackMon_Init(Stacks, 1U);
+ * @endcode
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_STK_001: Worst-case stack usage measured for every stack
+ * - SR_STK_002: Background measurement with bounded execution time
+ *
+ * @see stack_monitor.c
+ * @see stack_overflow_check.h
+ */
+
+#ifndef STACK_MONITOR_H
+#define STACK_MONITOR_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define STACKMON_VENDOR_ID                      43U
+#define STACKMON_MODULE_ID                      258U    /**< Vendor-specific CDD range */
+#define STACKMON_INSTANCE_ID                    0U
+
+#define STACKMON_SW_MAJOR_VERSION               1U
+#define STACKMON_SW_MINOR_VERSION               0U
+#define STACKMON_SW_PATCH_VERSION               0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define STACKMON_INIT_API_ID                    0x00U
+#define STACKMON_MAIN_FUNCTION_API_ID           0x01U
+#define STACKMON_GET_USAGE_API_ID               0x02U
+#define STACKMON_TASK_ENTRY_API_ID              0x03U
+#define STACKMON_GET_TASK_DEPTH_API_ID          0x04U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define STACKMON_E_PARAM_POINTER                0x01U   /**< NULL pointer parameter */
+#define STACKMON_E_UNINIT                       0x02U   /**< Module not initialized */
+#define STACKMON_E_PARAM_ID                     0x03U   /**< Region or task ID out of range */
+#define STACKMON_E_PARAM_CONFIG                 0x04U   /**< Invalid region configuration */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def STACKMON_MAX_REGIONS
+ * @brief Maximum number of monitored stack regions
+ */
+#ifndef STACKMON_MAX_REGIONS
+    #define STACKMON_MAX_REGIONS                8U
+#endif
+
+/**
+ * @def STACKMON_MAX_TASKS
+ * @brief Tasks whose entry stack depth is recorded
+ */
+#ifndef STACKMON_MAX_TASKS
+    #define STACKMON_MAX_TASKS                  32U
+#endif
+
+/**
+ * @def STACKMON_SCAN_WORDS_PER_CALL
+ * @brief Words checked per StackMon_MainFunction() call (bounds its run time)
+ */
+#ifndef STACKMON_SCAN_WORDS_PER_CALL
+    #define STACKMON_SCAN_WORDS_PER_CALL        64U
+#endif
+
+/**
+ * @def STACKMON_PAINT_PATTERN
+ * @brief Fill pattern of unused stack
+ */
+#ifndef STACKMON_PAINT_PATTERN
+    #define STACKMON_PAINT_PATTERN              0xA5A5A5A5UL
+#endif
+
+/**
+ * @def STACKMON_PAINT_MARGIN
+ * @brief Bytes below the current stack pointer left unpainted at init
+ *        (frame of StackMon_Init() itself)
+ */
+#ifndef STACKMON_PAINT_MARGIN
+    #define STACKMON_PAINT_MARGIN               64U
+#endif
+
+/**
+ * @def STACKMON_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef STACKMON_DEV_ERROR_DETECT
+    #define STACKMON_DEV_ERROR_DETECT           STD_ON
+#endif
+
+/**
+ * @def STACKMON_HWM_CALLOUT
+ * @brief Optional integrator callout when the high-water mark of a region grows
+ * @details Signature: void Callout(uint8 RegionId, uint32 UsedBytes).
+ *          Typically mapped to a trace or NvM logging hook.
+ */
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @struct StackMon_RegionConfigType
+ * @brief One stack (full descending, grows toward base)
+ */
+typedef struct
+{
+    P2VAR(uint32, TYPEDEF, STACKMON_VAR) base;  /**< Lowest address of the stack (32-byte aligned for a guard) */
+    uint32 size;                                /**< Stack size in bytes (multiple of 4) */
+    uint32 guard_size;                          /**< MPU guard at base in bytes, 0 = none (power of two >= 32) */
+    uint8  mpu_region;                          /**< MPU region number of the guard */
+} StackMon_RegionConfigType;
+
+/**
+ * @struct StackMon_UsageType
+ * @brief Measured usage of one region
+ */
+typedef struct
+{
+    uint32 size;                        /**< Usable size in bytes (without guard) */
+    uint32 max_used;                    /**< High-water mark in bytes */
+    uint32 scans;                       /**< Completed scans of the region */
+} StackMon_UsageType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Paint all stack regions and reset the measurements
+ * @param[in] Config Region table (kept by reference)
+ * @param[in] Count  Number of regions (<= STACKMON_MAX_REGIONS)
+ *
+ * @serviceID STACKMON_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ * @note Call early, with interrupts that use other stacks not yet enabled
+ */
+extern void StackMon_Init(P2CONST(StackMon_RegionConfigType, AUTOMATIC, STACKMON_APPL_CONST) Config,
+                          uint8 Count);
+
+/**
+ * @brief Background scan step (at most STACKMON_SCAN_WORDS_PER_CALL words)
+ *
+ * @serviceID STACKMON_MAIN_FUNCTION_API_ID (0x01)
+ */
+extern void StackMon_MainFunction(void);
+
+/**
+ * @brief Copy the measured usage of a region
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID STACKMON_GET_USAGE_API_ID (0x02)
+ */
+extern Std_ReturnType StackMon_GetUsage(uint8 RegionId,
+    P2VAR(StackMon_UsageType, AUTOMATIC, STACKMON_APPL_DATA) Usage);
+
+/**
+ * @brief Record the stack pointer at task entry - O(1)
+ *
+ * @serviceID STACKMON_TASK_ENTRY_API_ID (0x03)
+ * @note Called by the OS dispatcher immediately before the task body
+ */
+extern void StackMon_NotifyTaskEntry(uint8 TaskId);
+
+/**
+ * @brief Deepest observed start depth of a task
+ * @param[out] Depth Bytes between the top of the task's stack region and the
+ *                   lowest stack pointer at entry
+ * @return E_OK, or E_NOT_OK if the task never ran or on invalid parameters
+ *
+ * @serviceID STACKMON_GET_TASK_DEPTH_API_ID (0x04)
+ */
+extern Std_ReturnType StackMon_GetTaskEntryDepth(uint8 TaskId,
+    P2VAR(uint32, AUTOMATIC, STACKMON_APPL_DATA) Depth);
+
+/**
+ * @brief Current stack pointer of the executing context
+ */
+extern P2CONST(uint32, AUTOMATIC, STACKMON_VAR) StackMon_GetStackPointer(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_MONITOR_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,342 @@
+/**
+ * @file    deadlock_detection.c
+ * @brief   Deadlock and Lock-Hold Monitor Implementation
+ * @version 1.1.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the resource supervision declared in deadlock_detection.h.
+ *
+ * Lock-order graph:
+ * - order[a] bit b set <=> resource b was acquired while a was held
+ * - Reachability is the transitive closure of order (Warshall, 32 row ORs
+ *   per pivot); a resource reaching itself lies on a cycle
+ * - order[a] is only written by the holder of a, so the notifications need
+ *   no additional locking; the main function reads a consistent-enough copy
+ *   (bits are only ever set) and recomputes whenever new edges appear
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Stuck holds of the given resources |
+ *
+ * @see deadlock_detection.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "deadlock_detection.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define DEADLOCKDET_C_VENDOR_ID                 43U
+#define DEADLOCKDET_C_SW_MAJOR_VERSION          1U
+#define DEADLOCKDET_C_SW_MINOR_VERSION          1U
+#define DEADLOCKDET_C_SW_PATCH_VERSION          0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (DEADLOCKDET_C_VENDOR_ID != DEADLOCKDET_VENDOR_ID)
+    #error "deadlock_detection.c and deadlock_detection.h have different vendor IDs"
+#endif
+
+#if ((DEADLOCKDET_C_SW_MAJOR_VERSION != DEADLOCKDET_SW_MAJOR_VERSION) || \
+     (DEADLOCKDET_C_SW_MINOR_VERSION != DEADLOCKDET_SW_MINOR_VERSION) || \
+     (DEADLOCKDET_C_SW_PATCH_VERSION != DEADLOCKDET_SW_PATCH_VERSION))
+    #error "Software version mismatch between deadlock_detection.c and deadlock_detection.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (DEADLOCKDET_DEV_ERROR_DETECT == STD_ON)
+    #define DEADLOCKDET_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(DEADLOCKDET_MODULE_ID, DEADLOCKDET_INSTANCE_ID, (api), (err)))
+#else
+    #define DEADLOCKDET_REPORT_ERROR(api, err)  ((void)0)
+#endif
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC DeadlockDet_ResourceStatusType DeadlockDet_Resources[DEADLOCKDET_MAX_RESOURCES];
+
+/** @brief Set by NotifyAcquire when a new order edge was recorded */
+STATIC volatile boolean DeadlockDet_OrderChanged = FALSE;
+
+/** @brief Resources on an acquisition-order cycle (last evaluation) */
+STATIC uint32 DeadlockDet_CyclicMask = 0UL;
+
+STATIC boolean DeadlockDet_Initialized = FALSE;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void DeadlockDet_ReportViolation(uint8 ApiId, uint8 ErrorId, uint8 ResourceId);
+STATIC uint32 DeadlockDet_FindCycles(void);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Report a supervision violation as runtime error and via the callout
+ */
+STATIC void DeadlockDet_ReportViolation(uint8 ApiId, uint8 ErrorId, uint8 ResourceId)
+{
+#if defined(DET_ENABLED)
+    (void)Det_ReportRuntimeError(DEADLOCKDET_MODULE_ID, DEADLOCKDET_INSTANCE_ID, ApiId, ErrorId);
+#else
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+    (void)ErrorId;
+#endif
+
+#if defined(DEADLOCKDET_VIOLATION_CALLOUT)
+    DEADLOCKDET_VIOLATION_CALLOUT(ErrorId, ResourceId);
+#else
+    (void)ResourceId;
+#endif
+}
+
+/**
+ * @brief Transitive closure of the order graph
+ * @return Mask of resources that can reach themselves
+ */
+STATIC uint32 DeadlockDet_FindCycles(void)
+{
+    uint32 reach[DEADLOCKDET_MAX_RESOURCES];
+    uint32 cyclic = 0UL;
+    uint32 pivot;
+    uint32 row;
+
+    for (row = 0U; row < DEADLOCKDET_MAX_RESOURCES; row++)
+    {
+        reach[row] = DeadlockDet_Resources[row].order_successors;
+    }
+
+    for (pivot = 0U; pivot < DEADLOCKDET_MAX_RESOURCES; pivot++)
+    {
+        uint32 pivot_bit = 1UL << pivot;
+
+        for (row = 0U; row < DEADLOCKDET_MAX_RESOURCES; row++)
+        {
+            if ((reach[row] & pivot_bit) != 0UL)
+            {
+                reach[row] |= reach[pivot];
+            }
+        }
+    }
+
+    for (row = 0U; row < DEADLOCKDET_MAX_RESOURCES; row++)
+    {
+        if ((reach[row] & (1UL << row)) != 0UL)
+        {
+            cyclic |= (1UL << row);
+        }
+    }
+
+    return cyclic;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize the monitor
+ */
+void DeadlockDet_Init(void)
+{
+    uint32 id;
+
+    for (id = 0U; id < DEADLOCKDET_MAX_RESOURCES; id++)
+    {
+        DeadlockDet_Resources[id].hold_budget = 0UL;
+        DeadlockDet_Resources[id].max_hold_time = 0UL;
+        DeadlockDet_Resources[id].acquire_timestamp = 0UL;
+        DeadlockDet_Resources[id].budget_violations = 0UL;
+        DeadlockDet_Resources[id].order_successors = 0UL;
+        DeadlockDet_Resources[id].held = FALSE;
+        DeadlockDet_Resources[id].stuck_reported = FALSE;
+    }
+
+    DeadlockDet_OrderChanged = FALSE;
+    DeadlockDet_CyclicMask = 0UL;
+    DeadlockDet_Initialized = TRUE;
+}
+
+/**
+ * @brief Register the hold-time budget of a resource
+ */
+void DeadlockDet_RegisterResource(uint8 ResourceId, uint32 HoldBudget)
+{
+    if (ResourceId >= DEADLOCKDET_MAX_RESOURCES)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_REGISTER_API_ID, DEADLOCKDET_E_PARAM_ID);
+        return;
+    }
+
+    DeadlockDet_Resources[ResourceId].hold_budget = HoldBudget;
+}
+
+/**
+ * @brief Resource acquired
+ */
+void DeadlockDet_NotifyAcquire(uint8 ResourceId, uint8 HeldResource, uint32 Timestamp)
+{
+    P2VAR(DeadlockDet_ResourceStatusType, AUTOMATIC, DEADLOCKDET_VAR) res;
+
+    if (ResourceId >= DEADLOCKDET_MAX_RESOURCES)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_ACQUIRE_API_ID, DEADLOCKDET_E_PARAM_ID);
+        return;
+    }
+
+    res = &DeadlockDet_Resources[ResourceId];
+    res->acquire_timestamp = Timestamp;
+    res->stuck_reported = FALSE;
+    res->held = TRUE;
+
+    if (HeldResource < DEADLOCKDET_MAX_RESOURCES)
+    {
+        uint32 edge = 1UL << ResourceId;
+
+        /* Only record new edges; the common (already known) case is a single test */
+        if ((DeadlockDet_Resources[HeldResource].order_successors & edge) == 0UL)
+        {
+            DeadlockDet_Resources[HeldResource].order_successors |= edge;
+            DeadlockDet_OrderChanged = TRUE;
+        }
+    }
+}
+
+/**
+ * @brief Resource released
+ */
+void DeadlockDet_NotifyRelease(uint8 ResourceId, uint32 HoldTime)
+{
+    P2VAR(DeadlockDet_ResourceStatusType, AUTOMATIC, DEADLOCKDET_VAR) res;
+
+    if (ResourceId >= DEADLOCKDET_MAX_RESOURCES)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_RELEASE_API_ID, DEADLOCKDET_E_PARAM_ID);
+        return;
+    }
+
+    res = &DeadlockDet_Resources[ResourceId];
+    res->held = FALSE;
+
+    if (HoldTime > res->max_hold_time)
+    {
+        res->max_hold_time = HoldTime;
+    }
+
+    /* A stuck hold was already counted by the main function */
+    if ((res->hold_budget != 0UL) && (HoldTime > res->hold_budget) && (res->stuck_reported == FALSE))
+    {
+        res->budget_violations++;
+        DeadlockDet_ReportViolation(DEADLOCKDET_RELEASE_API_ID, DEADLOCKDET_E_HOLD_BUDGET, ResourceId);
+    }
+}
+
+/**
+ * @brief Periodic supervision
+ */
+void DeadlockDet_MainFunction(uint32 Timestamp, uint32 HoldMask)
+{
+    uint32 pending = HoldMask;
+    uint32 id;
+
+    if (DeadlockDet_Initialized == FALSE)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_MAIN_FUNCTION_API_ID, DEADLOCKDET_E_UNINIT);
+        return;
+    }
+
+#if (DEADLOCKDET_MAX_RESOURCES < 32U)
+    pending &= (1UL << DEADLOCKDET_MAX_RESOURCES) - 1UL;
+#endif
+
+    while (pending != 0UL)
+    {
+        P2VAR(DeadlockDet_ResourceStatusType, AUTOMATIC, DEADLOCKDET_VAR) res;
+
+        id = COUNT_TRAILING_ZEROS(pending);
+        pending &= pending - 1UL;
+        res = &DeadlockDet_Resources[id];
+
+        if ((res->held == TRUE) && (res->hold_budget != 0UL) && (res->stuck_reported == FALSE) &&
+            ((Timestamp - res->acquire_timestamp) > res->hold_budget))
+        {
+            res->stuck_reported = TRUE;
+            res->budget_violations++;
+            DeadlockDet_ReportViolation(DEADLOCKDET_MAIN_FUNCTION_API_ID, DEADLOCKDET_E_STUCK_HOLD, (uint8)id);
+        }
+    }
+
+    if (DeadlockDet_OrderChanged == TRUE)
+    {
+        uint32 cyclic;
+        uint32 new_cycles;
+
+        /* Clear first: an edge recorded during evaluation triggers another pass */
+        DeadlockDet_OrderChanged = FALSE;
+        cyclic = DeadlockDet_FindCycles();
+        new_cycles = cyclic & ~DeadlockDet_CyclicMask;
+        DeadlockDet_CyclicMask = cyclic;
+
+        if (new_cycles != 0UL)
+        {
+            DeadlockDet_ReportViolation(DEADLOCKDET_MAIN_FUNCTION_API_ID, DEADLOCKDET_E_LOCK_ORDER,
+                                        (uint8)COUNT_TRAILING_ZEROS(new_cycles));
+        }
+    }
+}
+
+/**
+ * @brief Copy the supervision state of a resource
+ */
+Std_ReturnType DeadlockDet_GetResourceStatus(uint8 ResourceId,
+    P2VAR(DeadlockDet_ResourceStatusType, AUTOMATIC, DEADLOCKDET_APPL_DATA) Status)
+{
+    if (Status == NULL_PTR)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_GET_STATUS_API_ID, DEADLOCKDET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (ResourceId >= DEADLOCKDET_MAX_RESOURCES)
+    {
+        DEADLOCKDET_REPORT_ERROR(DEADLOCKDET_GET_STATUS_API_ID, DEADLOCKDET_E_PARAM_ID);
+        return E_NOT_OK;
+    }
+
+    *Status = DeadlockDet_Resources[ResourceId];
+
+    return E_OK;
+}
+
+/**
+ * @brief Bit mask of resources on an acquisition-order cycle
+ */
+uint32 DeadlockDet_GetCyclicResources(void)
+{
+    return DeadlockDet_CyclicMask;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,228 @@
+/**
+ * @file    deadlock_detection.h
+ * @brief   Deadlock and Lock-Hold Monitor Interface
+ * @version 1.1.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Supervises OS resource usage from the lock-hold telemetry delivered by the
+ * resource manager:
+ *
+ * - Hold-time budget: every release reports the measured hold time; a hold
+ *   longer than the configured budget is a timing violation.
+ * - Stuck holds: DeadlockDet_MainFunction() flags resources that are still
+ *   held longer than their budget (owner blocked or lost). Only resources
+ *   whose acquisition time stamps share the caller's time base are checked;
+ *   the resource manager passes the resources of the calling core.
+ * - Lock ordering: each nested acquisition records an edge "held -> taken"
+ *   in a bit matrix. A cycle in that graph is a potential deadlock even if
+ *   the interleaving that would block has not happened yet.
+ *
+ * Notification functions are called from GetResource/ReleaseResource while
+ * the corresponding ceiling is held, so they only touch data owned by that
+ * resource and run in constant time. Cycle detection (transitive closure on
+ * a 32x32 bit matrix) runs in the main function and only after new edges
+ * were recorded.
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Stuck holds per time base          |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_DLD_001: Detect resource hold times exceeding their budget
+ * - SR_DLD_002: Detect cyclic resource acquisition order
+ *
+ * @see deadlock_detection.c
+ * @see resource_manager.h
+ */
+
+#ifndef DEADLOCK_DETECTION_H
+#define DEADLOCK_DETECTION_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define DEADLOCKDET_VENDOR_ID                   43U
+#define DEADLOCKDET_MODULE_ID                   257U    /**< Vendor-specific CDD range */
+#define DEADLOCKDET_INSTANCE_ID                 0U
+
+#define DEADLOCKDET_SW_MAJOR_VERSION            1U
+#define DEADLOCKDET_SW_MINOR_VERSION            1U
+#define DEADLOCKDET_SW_PATCH_VERSION            0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define DEADLOCKDET_INIT_API_ID                 0x00U
+#define DEADLOCKDET_REGISTER_API_ID             0x01U
+#define DEADLOCKDET_ACQUIRE_API_ID              0x02U
+#define DEADLOCKDET_RELEASE_API_ID              0x03U
+#define DEADLOCKDET_MAIN_FUNCTION_API_ID        0x04U
+#define DEADLOCKDET_GET_STATUS_API_ID           0x05U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define DEADLOCKDET_E_PARAM_POINTER             0x01U   /**< NULL pointer parameter */
+#define DEADLOCKDET_E_UNINIT                    0x02U   /**< Module not initialized */
+#define DEADLOCKDET_E_PARAM_ID                  0x03U   /**< Resource ID out of range */
+
+/** @brief Runtime errors (Det_ReportRuntimeError) */
+#define DEADLOCKDET_E_HOLD_BUDGET               0x10U   /**< Hold time above budget at release */
+#define DEADLOCKDET_E_STUCK_HOLD                0x11U   /**< Resource held above budget, not released */
+#define DEADLOCKDET_E_LOCK_ORDER                0x12U   /**< Cyclic acquisition order detected */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def DEADLOCKDET_MAX_RESOURCES
+ * @brief Supervised resources (one bit per resource in the order matrix)
+ */
+#ifndef DEADLOCKDET_MAX_RESOURCES
+    #define DEADLOCKDET_MAX_RESOURCES           32U
+#endif
+
+/**
+ * @def DEADLOCKDET_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef DEADLOCKDET_DEV_ERROR_DETECT
+    #define DEADLOCKDET_DEV_ERROR_DETECT        STD_ON
+#endif
+
+/**
+ * @def DEADLOCKDET_VIOLATION_CALLOUT
+ * @brief Optional integrator callout on every detected violation
+ * @details Signature: void Callout(uint8 ErrorId, uint8 ResourceId).
+ *          Typically mapped to the safety monitor to enter the safe state.
+ */
+
+#if (DEADLOCKDET_MAX_RESOURCES > 32U)
+    #error "DEADLOCKDET_MAX_RESOURCES is limited to 32 (32-bit order matrix rows)"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @struct DeadlockDet_ResourceStatusType
+ * @brief Supervision state of one resource
+ */
+typedef struct
+{
+    uint32  hold_budget;                /**< Allowed hold time in time-stamp ticks, 0 = unmonitored */
+    uint32  max_hold_time;              /**< Longest completed hold */
+    uint32  acquire_timestamp;          /**< Time stamp of the current hold */
+    uint32  budget_violations;          /**< Holds above budget (released late or stuck) */
+    uint32  order_successors;           /**< Resources acquired while this one was held */
+    boolean held;                       /**< Currently held */
+    boolean stuck_reported;             /**< Stuck hold already reported for the current hold */
+} DeadlockDet_ResourceStatusType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize the monitor (all resources unmonitored, order graph empty)
+ *
+ * @serviceID DEADLOCKDET_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ */
+extern void DeadlockDet_Init(void);
+
+/**
+ * @brief Register the hold-time budget of a resource
+ * @param[in] ResourceId Resource index (< DEADLOCKDET_MAX_RESOURCES)
+ * @param[in] HoldBudget Allowed hold time in time-stamp ticks, 0 = unmonitored
+ *
+ * @serviceID DEADLOCKDET_REGISTER_API_ID (0x01)
+ */
+extern void DeadlockDet_RegisterResource(uint8 ResourceId, uint32 HoldBudget);
+
+/**
+ * @brief Resource acquired - O(1)
+ * @param[in] ResourceId   Acquired resource
+ * @param[in] HeldResource Innermost resource already held by the caller,
+ *                         DEADLOCKDET_NO_RESOURCE if none
+ * @param[in] Timestamp    Acquisition time stamp
+ *
+ * @serviceID DEADLOCKDET_ACQUIRE_API_ID (0x02)
+ * @note Called with the ceiling of ResourceId held
+ */
+extern void DeadlockDet_NotifyAcquire(uint8 ResourceId, uint8 HeldResource, uint32 Timestamp);
+
+/**
+ * @brief Resource released - O(1)
+ * @param[in] ResourceId Released resource
+ * @param[in] HoldTime   Measured hold time in time-stamp ticks
+ *
+ * @serviceID DEADLOCKDET_RELEASE_API_ID (0x03)
+ * @note Called with the ceiling of ResourceId still held
+ */
+extern void DeadlockDet_NotifyRelease(uint8 ResourceId, uint32 HoldTime);
+
+/**
+ * @brief Periodic supervision: stuck holds and lock-order cycles
+ * @param[in] Timestamp Current time stamp
+ * @param[in] HoldMask  Resources checked for stuck holds, one bit per resource ID;
+ *                      their acquisition time stamps must share the time base of Timestamp
+ *
+ * @serviceID DEADLOCKDET_MAIN_FUNCTION_API_ID (0x04)
+ */
+extern void DeadlockDet_MainFunction(uint32 Timestamp, uint32 HoldMask);
+
+/**
+ * @brief Copy the supervision state of a resource
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID DEADLOCKDET_GET_STATUS_API_ID (0x05)
+ */
+extern Std_ReturnType DeadlockDet_GetResourceStatus(uint8 ResourceId,
+    P2VAR(DeadlockDet_ResourceStatusType, AUTOMATIC, DEADLOCKDET_APPL_DATA) Status);
+
+/**
+ * @brief Bit mask of resources that are part of an acquisition-order cycle
+ */
+extern uint32 DeadlockDet_GetCyclicResources(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @brief HeldResource value for a non-nested acquisition */
+#define DEADLOCKDET_NO_RESOURCE                 0xFFU
+
+#endif /* DEADLOCK_DETECTION_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
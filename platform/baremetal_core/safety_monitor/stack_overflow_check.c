@@ -0,0 +1,281 @@
+/**
+ * @file    stack_overflow_check.c
+ * @brief   Stack Overflow Detection - Canary Check and MPU Guard Regions Implementation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the overflow detection declared in stack_overflow_check.h.
+ *
+ * Implementation Notes:
+ * - Each overflow is reported once per region (latched in the overflow
+ *   mask); the safe-state reaction belongs to the callout
+ * - MPU guards use AP = no access and XN, so any load, store or instruction
+ *   fetch in the guard raises MemManage. A guard hit during exception entry
+ *   is a stacking fault (MSTKERR) without a valid MMFAR; the handler then
+ *   has to rely on the canary check
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see stack_overflow_check.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "stack_overflow_check.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define STACKCHK_C_VENDOR_ID                    43U
+#define STACKCHK_C_SW_MAJOR_VERSION             1U
+#define STACKCHK_C_SW_MINOR_VERSION             0U
+#define STACKCHK_C_SW_PATCH_VERSION             0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (STACKCHK_C_VENDOR_ID != STACKCHK_VENDOR_ID)
+    #error "stack_overflow_check.c and stack_overflow_check.h have different vendor IDs"
+#endif
+
+#if ((STACKCHK_C_SW_MAJOR_VERSION != STACKCHK_SW_MAJOR_VERSION) || \
+     (STACKCHK_C_SW_MINOR_VERSION != STACKCHK_SW_MINOR_VERSION) || \
+     (STACKCHK_C_SW_PATCH_VERSION != STACKCHK_SW_PATCH_VERSION))
+    #error "Software version mismatch between stack_overflow_check.c and stack_overflow_check.h"
+#endif
+
+#if (STACKCHK_VENDOR_ID != STACKMON_VENDOR_ID)
+    #error "stack_overflow_check.h and stack_monitor.h have different vendor IDs"
+#endif
+
+#if (STACKMON_MAX_REGIONS > 32U)
+    #error "STACKMON_MAX_REGIONS is limited to 32 (32-bit overflow mask)"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (STACKCHK_DEV_ERROR_DETECT == STD_ON)
+    #define STACKCHK_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(STACKCHK_MODULE_ID, STACKCHK_INSTANCE_ID, (api), (err)))
+#else
+    #define STACKCHK_REPORT_ERROR(api, err)     ((void)0)
+#endif
+
+#define STACKCHK_WORD_SIZE                      4U
+#define STACKCHK_MIN_GUARD_SIZE                 32U
+
+#if (STACKCHK_MPU_GUARD == STD_ON)
+/** @brief ARMv7-M MPU registers */
+#define STACKCHK_MPU_CTRL                       (*(volatile uint32 *)0xE000ED94UL)
+#define STACKCHK_MPU_RNR                        (*(volatile uint32 *)0xE000ED98UL)
+#define STACKCHK_MPU_RBAR                       (*(volatile uint32 *)0xE000ED9CUL)
+#define STACKCHK_MPU_RASR                       (*(volatile uint32 *)0xE000EDA0UL)
+
+#define STACKCHK_MPU_CTRL_ENABLE                (1UL << 0U)
+#define STACKCHK_MPU_CTRL_PRIVDEFENA            (1UL << 2U)
+#define STACKCHK_MPU_RASR_ENABLE                (1UL << 0U)
+#define STACKCHK_MPU_RASR_SIZE(bytes)           ((30UL - COUNT_LEADING_ZEROS(bytes)) << 1U)
+#define STACKCHK_MPU_RASR_AP_NONE               (0UL << 24U)
+#define STACKCHK_MPU_RASR_XN                    (1UL << 28U)
+#endif
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC P2CONST(StackMon_RegionConfigType, AUTOMATIC, STACKCHK_APPL_CONST) StackChk_Config = NULL_PTR;
+STATIC uint8 StackChk_RegionCount = 0U;
+
+/** @brief Bit r set: overflow of region r detected and reported */
+STATIC volatile uint32 StackChk_OverflowMask = 0UL;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void StackChk_ReportOverflow(uint8 ApiId, uint8 ErrorId, uint8 RegionId);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Latch and report the first overflow of a region
+ */
+STATIC void StackChk_ReportOverflow(uint8 ApiId, uint8 ErrorId, uint8 RegionId)
+{
+    uint32 bit = 1UL << RegionId;
+
+    if ((StackChk_OverflowMask & bit) != 0UL)
+    {
+        return;
+    }
+    StackChk_OverflowMask |= bit;
+
+    (void)Det_ReportRuntimeError(STACKCHK_MODULE_ID, STACKCHK_INSTANCE_ID, ApiId, ErrorId);
+
+#if defined(STACKCHK_OVERFLOW_CALLOUT)
+    STACKCHK_OVERFLOW_CALLOUT(ErrorId, RegionId);
+#endif
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Take over the stack regions and program the MPU guards
+ */
+void StackChk_Init(P2CONST(StackMon_RegionConfigType, AUTOMATIC, STACKCHK_APPL_CONST) Config,
+                   uint8 Count)
+{
+    uint8 id;
+
+    if (Config == NULL_PTR)
+    {
+        STACKCHK_REPORT_ERROR(STACKCHK_INIT_API_ID, STACKCHK_E_PARAM_POINTER);
+        return;
+    }
+
+    if ((Count == 0U) || (Count > STACKMON_MAX_REGIONS))
+    {
+        STACKCHK_REPORT_ERROR(STACKCHK_INIT_API_ID, STACKCHK_E_PARAM_CONFIG);
+        return;
+    }
+
+    for (id = 0U; id < Count; id++)
+    {
+        uint32 guard = Config[id].guard_size;
+
+        if ((Config[id].base == NULL_PTR) ||
+            ((guard + (STACKCHK_CANARY_WORDS * STACKCHK_WORD_SIZE)) > Config[id].size))
+        {
+            STACKCHK_REPORT_ERROR(STACKCHK_INIT_API_ID, STACKCHK_E_PARAM_CONFIG);
+            return;
+        }
+
+#if (STACKCHK_MPU_GUARD == STD_ON)
+        if ((guard != 0UL) &&
+            ((guard < STACKCHK_MIN_GUARD_SIZE) || ((guard & (guard - 1UL)) != 0UL) ||
+             (((uint32)Config[id].base & (guard - 1UL)) != 0UL)))
+        {
+            STACKCHK_REPORT_ERROR(STACKCHK_INIT_API_ID, STACKCHK_E_PARAM_CONFIG);
+            return;
+        }
+#endif
+    }
+
+#if (STACKCHK_MPU_GUARD == STD_ON)
+    for (id = 0U; id < Count; id++)
+    {
+        if (Config[id].guard_size != 0UL)
+        {
+            STACKCHK_MPU_RNR = Config[id].mpu_region;
+            STACKCHK_MPU_RBAR = (uint32)Config[id].base;
+            STACKCHK_MPU_RASR = STACKCHK_MPU_RASR_XN | STACKCHK_MPU_RASR_AP_NONE |
+                                STACKCHK_MPU_RASR_SIZE(Config[id].guard_size) | STACKCHK_MPU_RASR_ENABLE;
+        }
+    }
+
+    /* Background map stays in effect for privileged code outside the regions */
+    STACKCHK_MPU_CTRL |= (STACKCHK_MPU_CTRL_ENABLE | STACKCHK_MPU_CTRL_PRIVDEFENA);
+    DATA_SYNC_BARRIER();
+    INSTRUCTION_SYNC_BARRIER();
+#endif
+
+    StackChk_OverflowMask = 0UL;
+    StackChk_RegionCount = Count;
+    StackChk_Config = Config;
+}
+
+/**
+ * @brief Check canaries and the current stack pointer
+ */
+void StackChk_MainFunction(void)
+{
+    P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) sp;
+    uint8 id;
+
+    if (StackChk_Config == NULL_PTR)
+    {
+        return;
+    }
+
+    sp = StackMon_GetStackPointer();
+
+    for (id = 0U; id < StackChk_RegionCount; id++)
+    {
+        P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) limit =
+            StackChk_Config[id].base + (StackChk_Config[id].guard_size / STACKCHK_WORD_SIZE);
+        P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) top =
+            StackChk_Config[id].base + (StackChk_Config[id].size / STACKCHK_WORD_SIZE);
+        uint32 i;
+
+        for (i = 0U; i < STACKCHK_CANARY_WORDS; i++)
+        {
+            if (limit[i] != STACKMON_PAINT_PATTERN)
+            {
+                StackChk_ReportOverflow(STACKCHK_MAIN_FUNCTION_API_ID, STACKCHK_E_CANARY, id);
+                break;
+            }
+        }
+
+        /* Executing on this stack with the canaries already in reach */
+        if ((sp >= StackChk_Config[id].base) && (sp < top) && (sp < (limit + STACKCHK_CANARY_WORDS)))
+        {
+            StackChk_ReportOverflow(STACKCHK_MAIN_FUNCTION_API_ID, STACKCHK_E_STACK_POINTER, id);
+        }
+    }
+}
+
+/**
+ * @brief Map a MemManage fault address to the guarded stack it hit
+ */
+uint8 StackChk_CheckFaultAddress(P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) Address)
+{
+    uint8 id;
+
+    if (StackChk_Config == NULL_PTR)
+    {
+        return STACKCHK_NO_REGION;
+    }
+
+    for (id = 0U; id < StackChk_RegionCount; id++)
+    {
+        P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) base = StackChk_Config[id].base;
+
+        if ((StackChk_Config[id].guard_size != 0UL) && (Address >= base) &&
+            (Address < (base + (StackChk_Config[id].guard_size / STACKCHK_WORD_SIZE))))
+        {
+            StackChk_ReportOverflow(STACKCHK_CHECK_FAULT_API_ID, STACKCHK_E_GUARD_FAULT, id);
+            return id;
+        }
+    }
+
+    return STACKCHK_NO_REGION;
+}
+
+/**
+ * @brief Bit mask of regions with a detected overflow
+ */
+uint32 StackChk_GetOverflowMask(void)
+{
+    return StackChk_OverflowMask;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,178 @@
+/**
+ * @file    stack_overflow_check.h
+ * @brief   Stack Overflow Detection - Canary Check and MPU Guard Regions
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Detects stack overflows of the regions measured by the stack monitor
+ * (stack_monitor.h):
+ *
+ * - Canary check: the lowest STACKCHK_CANARY_WORDS words of every region
+ *   (above its guard) keep the paint pattern written by StackMon_Init().
+ *   StackChk_MainFunction() verifies them in O(regions) and also checks
+ *   the current stack pointer against the limit of its region
+ * - MPU guard (STACKCHK_MPU_GUARD): a no-access MPU region at the bottom of
+ *   every region with guard_size != 0. An overflow then faults on the first
+ *   access instead of corrupting the adjacent memory; the MemManage handler
+ *   identifies the stack with StackChk_CheckFaultAddress()
+ *
+ * ARMv7-M guard constraints: guard_size is a power of two >= 32 bytes and
+ * the region base is aligned to guard_size. The guard uses the configured
+ * MPU region number, which should be above the regions mapping the SRAM so
+ * it takes precedence. Stack reserved for the guard is not usable.
+ *
+ * Detected overflows are reported as DET runtime errors and through the
+ * optional STACKCHK_OVERFLOW_CALLOUT (safe state).
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_STK_003: Stack overflow detected before adjacent data is used
+ * - SR_STK_004: Hardware stack guard on ASIL-D stacks
+ *
+ * @see stack_overflow_check.c
+ * @see stack_monitor.h
+ */
+
+#ifndef STACK_OVERFLOW_CHECK_H
+#define STACK_OVERFLOW_CHECK_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define STACKCHK_VENDOR_ID                      43U
+#define STACKCHK_MODULE_ID                      259U    /**< Vendor-specific CDD range */
+#define STACKCHK_INSTANCE_ID                    0U
+
+#define STACKCHK_SW_MAJOR_VERSION               1U
+#define STACKCHK_SW_MINOR_VERSION               0U
+#define STACKCHK_SW_PATCH_VERSION               0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "stack_monitor.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define STACKCHK_INIT_API_ID                    0x00U
+#define STACKCHK_MAIN_FUNCTION_API_ID           0x01U
+#define STACKCHK_CHECK_FAULT_API_ID             0x02U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define STACKCHK_E_PARAM_POINTER                0x01U   /**< NULL pointer parameter */
+#define STACKCHK_E_PARAM_CONFIG                 0x04U   /**< Guard size or alignment invalid */
+
+/** @brief Runtime errors (Det_ReportRuntimeError) */
+#define STACKCHK_E_CANARY                       0x10U   /**< Canary words overwritten */
+#define STACKCHK_E_STACK_POINTER                0x11U   /**< Stack pointer below the region limit */
+#define STACKCHK_E_GUARD_FAULT                  0x12U   /**< Access to an MPU guard region */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def STACKCHK_CANARY_WORDS
+ * @brief Words at the bottom of each region checked by the main function
+ */
+#ifndef STACKCHK_CANARY_WORDS
+    #define STACKCHK_CANARY_WORDS               4U
+#endif
+
+/**
+ * @def STACKCHK_MPU_GUARD
+ * @brief Program MPU no-access guards below the stacks (Cortex-M7 only)
+ */
+#ifndef STACKCHK_MPU_GUARD
+    #define STACKCHK_MPU_GUARD                  STD_OFF
+#endif
+
+/**
+ * @def STACKCHK_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef STACKCHK_DEV_ERROR_DETECT
+    #define STACKCHK_DEV_ERROR_DETECT           STD_ON
+#endif
+
+/**
+ * @def STACKCHK_OVERFLOW_CALLOUT
+ * @brief Optional integrator callout on a detected overflow
+ * @details Signature: void Callout(uint8 ErrorId, uint8 RegionId).
+ *          Typically mapped to the safety monitor to enter the safe state.
+ */
+
+/** @brief StackChk_CheckFaultAddress() result for addresses outside all guards */
+#define STACKCHK_NO_REGION                      0xFFU
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Take over the stack regions and program the MPU guards
+ * @param[in] Config Region table passed to StackMon_Init() (kept by reference)
+ * @param[in] Count  Number of regions
+ *
+ * @serviceID STACKCHK_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ * @note Call after StackMon_Init(), which writes the canaries
+ */
+extern void StackChk_Init(P2CONST(StackMon_RegionConfigType, AUTOMATIC, STACKCHK_APPL_CONST) Config,
+                          uint8 Count);
+
+/**
+ * @brief Check canaries and the current stack pointer - O(regions)
+ *
+ * @serviceID STACKCHK_MAIN_FUNCTION_API_ID (0x01)
+ */
+extern void StackChk_MainFunction(void);
+
+/**
+ * @brief Map a MemManage fault address to the guarded stack it hit
+ * @param[in] Address Faulting data address (MMFAR)
+ * @return Region index, or STACKCHK_NO_REGION if no guard contains Address
+ *
+ * @serviceID STACKCHK_CHECK_FAULT_API_ID (0x02)
+ * @note Called from the MemManage handler; reports the overflow
+ */
+extern uint8 StackChk_CheckFaultAddress(P2CONST(uint32, AUTOMATIC, STACKCHK_APPL_DATA) Address);
+
+/**
+ * @brief Bit mask of regions with a detected overflow
+ */
+extern uint32 StackChk_GetOverflowMask(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_OVERFLOW_CHECK_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,850 @@
+/**
+ * @file    timer_manager.c
+ * @brief   Hierarchical Timing Wheel - Software Timer Manager Implementation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the hierarchical timing wheel declared in timer_manager.h.
+ *
+ * Wheel invariants (LEVEL_BITS = B, "now" = last processed tick):
+ * - A timer with delta = expiry - now is linked on level L = floor(log2(delta)) / B
+ *   (level 0 for delta < 2^B) in slot (expiry >> (L * B)) & SLOT_MASK.
+ * - When now crosses a multiple of 2^B, level 1 slot (now >> B) is cascaded;
+ *   if that index is 0 as well, level 2 is cascaded, and so on.
+ * - Cascading happens before the level-0 slot of the same tick is collected,
+ *   so a timer cascaded with delta 0 still expires on time.
+ *
+ * Implementation Notes:
+ * - All list operations are O(1) on intrusive circular lists with sentinels
+ * - Level selection uses COUNT_LEADING_ZEROS (no per-level search loop)
+ * - Expired slots are spliced to the expired batch as a whole list
+ * - Callbacks never run inside the critical section
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see timer_manager.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "timer_manager.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define TIMERMGR_C_VENDOR_ID                    43U
+#define TIMERMGR_C_SW_MAJOR_VERSION             1U
+#define TIMERMGR_C_SW_MINOR_VERSION             0U
+#define TIMERMGR_C_SW_PATCH_VERSION             0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (TIMERMGR_C_VENDOR_ID != TIMERMGR_VENDOR_ID)
+    #error "timer_manager.c and timer_manager.h have different vendor IDs"
+#endif
+
+#if ((TIMERMGR_C_SW_MAJOR_VERSION != TIMERMGR_SW_MAJOR_VERSION) || \
+     (TIMERMGR_C_SW_MINOR_VERSION != TIMERMGR_SW_MINOR_VERSION) || \
+     (TIMERMGR_C_SW_PATCH_VERSION != TIMERMGR_SW_PATCH_VERSION))
+    #error "Software version mismatch between timer_manager.c and timer_manager.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+/**
+ * @brief Encode level and index into TimerMgr_TimerType::slot
+ */
+#define TIMERMGR_SLOT_ID(level, index)          ((uint16)(((level) << TIMERMGR_LEVEL_BITS) | (index)))
+#define TIMERMGR_SLOT_LEVEL(id)                 ((uint32)(id) >> TIMERMGR_LEVEL_BITS)
+#define TIMERMGR_SLOT_INDEX(id)                 ((uint32)(id) & TIMERMGR_SLOT_MASK)
+
+/**
+ * @brief Slot index of a tick value on a given level
+ */
+#define TIMERMGR_LEVEL_INDEX(tick, level)       (((tick) >> ((level) * TIMERMGR_LEVEL_BITS)) & TIMERMGR_SLOT_MASK)
+
+#if (TIMERMGR_DEV_ERROR_DETECT == STD_ON)
+    #define TIMERMGR_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(TIMERMGR_MODULE_ID, TIMERMGR_INSTANCE_ID, (api), (err)))
+#else
+    #define TIMERMGR_REPORT_ERROR(api, err)     ((void)0)
+#endif
+
+/**
+ * @name Critical Section Hooks
+ * @brief Protect wheel lists against concurrent tick ISR / task access
+ * @details May be overridden by the integrator (e.g. mapped to an OS
+ *          resource or exclusive area) by defining both macros.
+ * @{
+ */
+#if (TIMERMGR_CRITICAL_SECTION_ENABLED == STD_ON)
+    #ifndef TIMERMGR_ENTER_CRITICAL
+        #define TIMERMGR_ENTER_CRITICAL(key)    ((key) = TimerMgr_IrqSave())
+        #define TIMERMGR_EXIT_CRITICAL(key)     TimerMgr_IrqRestore(key)
+        #define TIMERMGR_USE_PRIMASK            STD_ON
+    #endif
+#else
+    #define TIMERMGR_ENTER_CRITICAL(key)        ((key) = 0U)
+    #define TIMERMGR_EXIT_CRITICAL(key)         ((void)(key))
+#endif
+/** @} */
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+#if defined(TIMERMGR_USE_PRIMASK)
+STATIC_INLINE uint32 TimerMgr_IrqSave(void);
+STATIC_INLINE void TimerMgr_IrqRestore(uint32 Key);
+#endif
+
+STATIC_INLINE void TimerMgr_ListInit(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head);
+STATIC_INLINE boolean TimerMgr_ListIsEmpty(P2CONST(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head);
+STATIC_INLINE void TimerMgr_ListAppend(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head,
+                                       P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Node);
+STATIC_INLINE void TimerMgr_ListUnlink(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Node);
+STATIC_INLINE void TimerMgr_ListSplice(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Dst,
+                                       P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Src);
+
+STATIC_INLINE void TimerMgr_SetOccupied(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                        uint32 Level, uint32 Index);
+STATIC_INLINE void TimerMgr_ClearOccupied(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                          uint32 Level, uint32 Index);
+STATIC_INLINE boolean TimerMgr_IsOccupied(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                          uint32 Level, uint32 Index);
+STATIC uint32 TimerMgr_FindNextOccupied(P2CONST(uint32, AUTOMATIC, TIMERMGR_VAR) Bitmap, uint32 Start);
+
+STATIC void TimerMgr_Link(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                          P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) Timer);
+STATIC void TimerMgr_Unlink(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                            P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) Timer);
+STATIC void TimerMgr_Cascade(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel, uint32 Level);
+STATIC uint32 TimerMgr_TickLocked(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel);
+STATIC TimerMgr_TickType TimerMgr_NextEventLocked(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel);
+STATIC P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) TimerMgr_PopExpired(
+    P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+#if defined(TIMERMGR_USE_PRIMASK)
+/**
+ * @brief Save PRIMASK and disable interrupts
+ * @return Previous PRIMASK value
+ */
+STATIC_INLINE uint32 TimerMgr_IrqSave(void)
+{
+    uint32 primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by TimerMgr_IrqSave()
+ */
+STATIC_INLINE void TimerMgr_IrqRestore(uint32 Key)
+{
+    __asm volatile ("msr primask, %0" :: "r" (Key) : "memory");
+}
+#endif
+
+STATIC_INLINE void TimerMgr_ListInit(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head)
+{
+    Head->next = Head;
+    Head->prev = Head;
+}
+
+STATIC_INLINE boolean TimerMgr_ListIsEmpty(P2CONST(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head)
+{
+    return (Head->next == Head) ? TRUE : FALSE;
+}
+
+STATIC_INLINE void TimerMgr_ListAppend(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Head,
+                                       P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Node)
+{
+    Node->next = Head;
+    Node->prev = Head->prev;
+    Head->prev->next = Node;
+    Head->prev = Node;
+}
+
+STATIC_INLINE void TimerMgr_ListUnlink(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Node)
+{
+    Node->prev->next = Node->next;
+    Node->next->prev = Node->prev;
+    Node->next = Node;
+    Node->prev = Node;
+}
+
+/**
+ * @brief Move all nodes of Src to the tail of Dst, leaving Src empty - O(1)
+ */
+STATIC_INLINE void TimerMgr_ListSplice(P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Dst,
+                                       P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) Src)
+{
+    if (TimerMgr_ListIsEmpty(Src) == FALSE)
+    {
+        Src->next->prev = Dst->prev;
+        Dst->prev->next = Src->next;
+        Src->prev->next = Dst;
+        Dst->prev = Src->prev;
+        TimerMgr_ListInit(Src);
+    }
+}
+
+STATIC_INLINE void TimerMgr_SetOccupied(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                        uint32 Level, uint32 Index)
+{
+    Wheel->occupancy[Level][Index >> 5U] |= (1UL << (Index & 31U));
+}
+
+STATIC_INLINE void TimerMgr_ClearOccupied(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                          uint32 Level, uint32 Index)
+{
+    Wheel->occupancy[Level][Index >> 5U] &= ~(1UL << (Index & 31U));
+}
+
+STATIC_INLINE boolean TimerMgr_IsOccupied(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                                          uint32 Level, uint32 Index)
+{
+    return ((Wheel->occupancy[Level][Index >> 5U] & (1UL << (Index & 31U))) != 0UL) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Distance from Start to the next occupied slot (circular, Start inclusive)
+ * @return 0..SLOTS_PER_LEVEL-1, or SLOTS_PER_LEVEL when the level is empty
+ */
+STATIC uint32 TimerMgr_FindNextOccupied(P2CONST(uint32, AUTOMATIC, TIMERMGR_VAR) Bitmap, uint32 Start)
+{
+    uint32 result = TIMERMGR_SLOTS_PER_LEVEL;
+    uint32 word = Start >> 5U;
+    uint32 bits = Bitmap[word] & (0xFFFFFFFFUL << (Start & 31U));
+    uint32 scanned;
+
+    /* Visit every bitmap word once, plus the low part of the start word */
+    for (scanned = 0U; scanned <= TIMERMGR_BITMAP_WORDS; scanned++)
+    {
+        if (bits != 0UL)
+        {
+            uint32 index = (word << 5U) + COUNT_TRAILING_ZEROS(bits);
+            result = (index - Start) & TIMERMGR_SLOT_MASK;
+            break;
+        }
+
+        word = (word + 1U) % TIMERMGR_BITMAP_WORDS;
+        bits = Bitmap[word];
+    }
+
+    return result;
+}
+
+/**
+ * @brief Link an idle timer into the slot matching its expiry - O(1)
+ * @note Caller holds the critical section and guarantees expiry - now <= MAX_DELAY
+ */
+STATIC void TimerMgr_Link(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                          P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) Timer)
+{
+    TimerMgr_TickType delta = Timer->expiry - Wheel->now;
+    TimerMgr_TickType slot_tick = Timer->expiry;
+    uint32 level = 0U;
+    uint32 index;
+
+    /* Park timers beyond the wheel range on the farthest top-level slot */
+    if (delta >= TIMERMGR_WHEEL_RANGE)
+    {
+        delta = TIMERMGR_WHEEL_RANGE - 1UL;
+        slot_tick = Wheel->now + delta;
+    }
+
+    if (delta >= TIMERMGR_SLOTS_PER_LEVEL)
+    {
+        level = (31U - COUNT_LEADING_ZEROS(delta)) / TIMERMGR_LEVEL_BITS;
+    }
+
+    index = TIMERMGR_LEVEL_INDEX(slot_tick, level);
+
+    TimerMgr_ListAppend(&Wheel->slots[level][index], &Timer->node);
+    TimerMgr_SetOccupied(Wheel, level, index);
+    Timer->slot = TIMERMGR_SLOT_ID(level, index);
+    Timer->state = (uint8)TIMERMGR_TIMER_ARMED;
+    Wheel->armed++;
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+    Wheel->stats.active_timers = Wheel->armed;
+    if (Wheel->armed > Wheel->stats.max_active_timers)
+    {
+        Wheel->stats.max_active_timers = Wheel->armed;
+    }
+#endif
+}
+
+/**
+ * @brief Unlink a timer from its slot or from the expired batch - O(1)
+ * @note Caller holds the critical section
+ */
+STATIC void TimerMgr_Unlink(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel,
+                            P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) Timer)
+{
+    if (Timer->state == (uint8)TIMERMGR_TIMER_ARMED)
+    {
+        uint32 level = TIMERMGR_SLOT_LEVEL(Timer->slot);
+        uint32 index = TIMERMGR_SLOT_INDEX(Timer->slot);
+
+        TimerMgr_ListUnlink(&Timer->node);
+        if (TimerMgr_ListIsEmpty(&Wheel->slots[level][index]) == TRUE)
+        {
+            TimerMgr_ClearOccupied(Wheel, level, index);
+        }
+        Wheel->armed--;
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+        Wheel->stats.active_timers = Wheel->armed;
+#endif
+    }
+    else if (Timer->state == (uint8)TIMERMGR_TIMER_EXPIRED)
+    {
+        TimerMgr_ListUnlink(&Timer->node);
+    }
+    else
+    {
+        /* Idle - nothing to unlink */
+    }
+
+    Timer->state = (uint8)TIMERMGR_TIMER_IDLE;
+}
+
+/**
+ * @brief Re-distribute the current slot of a higher level onto lower levels
+ * @note Caller holds the critical section
+ */
+STATIC void TimerMgr_Cascade(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel, uint32 Level)
+{
+    uint32 index = TIMERMGR_LEVEL_INDEX(Wheel->now, Level);
+    TimerMgr_ListNodeType pending;
+
+    if (TimerMgr_IsOccupied(Wheel, Level, index) == TRUE)
+    {
+        TimerMgr_ListInit(&pending);
+        TimerMgr_ListSplice(&pending, &Wheel->slots[Level][index]);
+        TimerMgr_ClearOccupied(Wheel, Level, index);
+
+        while (TimerMgr_ListIsEmpty(&pending) == FALSE)
+        {
+            /* node is the first member of the timer object */
+            P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) timer =
+                (TimerMgr_TimerType *)pending.next;
+
+            TimerMgr_ListUnlink(&timer->node);
+            Wheel->armed--;
+            TimerMgr_Link(Wheel, timer);
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+            Wheel->stats.cascaded_timers++;
+#endif
+        }
+    }
+}
+
+/**
+ * @brief Advance one tick: cascade, then collect the level-0 slot
+ * @return Number of timers moved to the expired batch
+ * @note Caller holds the critical section
+ */
+STATIC uint32 TimerMgr_TickLocked(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel)
+{
+    uint32 count = 0U;
+    uint32 index;
+    uint32 level;
+
+    Wheel->now++;
+    index = TIMERMGR_LEVEL_INDEX(Wheel->now, 0U);
+
+    if (index == 0U)
+    {
+        for (level = 1U; level < TIMERMGR_LEVEL_COUNT; level++)
+        {
+            TimerMgr_Cascade(Wheel, level);
+            if (TIMERMGR_LEVEL_INDEX(Wheel->now, level) != 0UL)
+            {
+                break;
+            }
+        }
+    }
+
+    if (TimerMgr_IsOccupied(Wheel, 0U, index) == TRUE)
+    {
+        P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) head = &Wheel->slots[0][index];
+        P2VAR(TimerMgr_ListNodeType, AUTOMATIC, TIMERMGR_VAR) node;
+
+        for (node = head->next; node != head; node = node->next)
+        {
+            ((TimerMgr_TimerType *)node)->state = (uint8)TIMERMGR_TIMER_EXPIRED;
+            count++;
+        }
+
+        TimerMgr_ListSplice(&Wheel->expired, head);
+        TimerMgr_ClearOccupied(Wheel, 0U, index);
+        Wheel->armed -= count;
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+        Wheel->stats.active_timers = Wheel->armed;
+        Wheel->stats.expirations += count;
+#endif
+    }
+
+    return count;
+}
+
+/**
+ * @brief Lower bound of ticks until the next expiry or cascade
+ * @note Caller holds the critical section
+ */
+STATIC TimerMgr_TickType TimerMgr_NextEventLocked(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel)
+{
+    TimerMgr_TickType result = TIMERMGR_MAX_DELAY;
+    uint32 current = TIMERMGR_LEVEL_INDEX(Wheel->now, 0U);
+    uint32 higher = 0UL;
+    uint32 distance;
+    uint32 level;
+    uint32 word;
+
+    if (Wheel->armed != 0UL)
+    {
+        /* Next occupied level-0 slot after the current one */
+        distance = TimerMgr_FindNextOccupied(Wheel->occupancy[0],
+                                             (current + 1U) & TIMERMGR_SLOT_MASK);
+        if (distance < TIMERMGR_SLOTS_PER_LEVEL)
+        {
+            result = distance + 1U;
+        }
+
+        for (level = 1U; level < TIMERMGR_LEVEL_COUNT; level++)
+        {
+            for (word = 0U; word < TIMERMGR_BITMAP_WORDS; word++)
+            {
+                higher |= Wheel->occupancy[level][word];
+            }
+        }
+
+        /* Any higher level populated: stop at the next level-0 wrap (cascade point) */
+        if (higher != 0UL)
+        {
+            result = MIN_U32(result, TIMERMGR_SLOTS_PER_LEVEL - current);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Remove the first timer from the expired batch and re-arm periodic timers
+ * @return Timer, or NULL_PTR if the batch is empty
+ * @note Caller holds the critical section
+ */
+STATIC P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) TimerMgr_PopExpired(
+    P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_VAR) Wheel)
+{
+    P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) timer = NULL_PTR;
+
+    if (TimerMgr_ListIsEmpty(&Wheel->expired) == FALSE)
+    {
+        timer = (TimerMgr_TimerType *)Wheel->expired.next;
+        TimerMgr_ListUnlink(&timer->node);
+        timer->state = (uint8)TIMERMGR_TIMER_IDLE;
+
+        if (timer->period != 0UL)
+        {
+            /* Drift-free reload; resynchronize if dispatch fell a full period behind */
+            timer->expiry += timer->period;
+            if ((timer->expiry - Wheel->now - 1UL) >= TIMERMGR_MAX_DELAY)
+            {
+                timer->expiry = Wheel->now + timer->period;
+            }
+            TimerMgr_Link(Wheel, timer);
+        }
+    }
+
+    return timer;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize a timing wheel
+ */
+void TimerMgr_Init(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                   TimerMgr_TickType StartTick)
+{
+    uint32 level;
+    uint32 index;
+
+    if (Wheel == NULL_PTR)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_INIT_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return;
+    }
+
+    for (level = 0U; level < TIMERMGR_LEVEL_COUNT; level++)
+    {
+        for (index = 0U; index < TIMERMGR_SLOTS_PER_LEVEL; index++)
+        {
+            TimerMgr_ListInit(&Wheel->slots[level][index]);
+        }
+        for (index = 0U; index < TIMERMGR_BITMAP_WORDS; index++)
+        {
+            Wheel->occupancy[level][index] = 0UL;
+        }
+    }
+
+    TimerMgr_ListInit(&Wheel->expired);
+    Wheel->now = StartTick;
+    Wheel->armed = 0U;
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+    Wheel->stats.active_timers = 0U;
+    Wheel->stats.max_active_timers = 0U;
+    Wheel->stats.expirations = 0U;
+    Wheel->stats.cascaded_timers = 0U;
+    Wheel->stats.max_batch_size = 0U;
+    Wheel->stats.skipped_ticks = 0U;
+#endif
+
+    Wheel->initialized = TRUE;
+}
+
+/**
+ * @brief Prepare a timer object
+ */
+void TimerMgr_InitTimer(P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer,
+                        TimerMgr_CallbackType Callback,
+                        P2VAR(void, AUTOMATIC, TIMERMGR_APPL_DATA) Context)
+{
+    if (Timer == NULL_PTR)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_INIT_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return;
+    }
+
+    TimerMgr_ListInit(&Timer->node);
+    Timer->expiry = 0U;
+    Timer->period = 0U;
+    Timer->callback = Callback;
+    Timer->context = Context;
+    Timer->slot = 0U;
+    Timer->state = (uint8)TIMERMGR_TIMER_IDLE;
+    Timer->reserved = 0U;
+}
+
+/**
+ * @brief Arm (or re-arm) a timer
+ */
+Std_ReturnType TimerMgr_Start(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                              P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer,
+                              TimerMgr_TickType Delay,
+                              TimerMgr_TickType Period)
+{
+    uint32 key;
+
+    if ((Wheel == NULL_PTR) || (Timer == NULL_PTR))
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_START_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (Wheel->initialized != TRUE)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_START_API_ID, TIMERMGR_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((Delay == 0UL) || (Delay > TIMERMGR_MAX_DELAY) || (Period > TIMERMGR_MAX_DELAY))
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_START_API_ID, TIMERMGR_E_PARAM_DELAY);
+        return E_NOT_OK;
+    }
+
+    TIMERMGR_ENTER_CRITICAL(key);
+
+    TimerMgr_Unlink(Wheel, Timer);
+    Timer->expiry = Wheel->now + Delay;
+    Timer->period = Period;
+    TimerMgr_Link(Wheel, Timer);
+
+    TIMERMGR_EXIT_CRITICAL(key);
+
+    return E_OK;
+}
+
+/**
+ * @brief Disarm a timer
+ */
+void TimerMgr_Stop(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                   P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer)
+{
+    uint32 key;
+
+    if ((Wheel == NULL_PTR) || (Timer == NULL_PTR))
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_STOP_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return;
+    }
+
+    TIMERMGR_ENTER_CRITICAL(key);
+    TimerMgr_Unlink(Wheel, Timer);
+    TIMERMGR_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Check whether a timer is armed or pending dispatch
+ */
+boolean TimerMgr_IsActive(P2CONST(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer)
+{
+    boolean result = FALSE;
+
+    if ((Timer != NULL_PTR) && (Timer->state != (uint8)TIMERMGR_TIMER_IDLE))
+    {
+        result = TRUE;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Ticks remaining until a timer expires
+ */
+TimerMgr_TickType TimerMgr_GetRemaining(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                        P2CONST(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer)
+{
+    TimerMgr_TickType result = 0U;
+
+    if ((Wheel != NULL_PTR) && (Timer != NULL_PTR) &&
+        (Timer->state == (uint8)TIMERMGR_TIMER_ARMED))
+    {
+        result = Timer->expiry - Wheel->now;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Advance the wheel by one tick
+ */
+uint32 TimerMgr_Tick(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel)
+{
+    uint32 count;
+    uint32 key;
+
+    if (Wheel == NULL_PTR)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_TICK_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return 0U;
+    }
+
+    TIMERMGR_ENTER_CRITICAL(key);
+    count = TimerMgr_TickLocked(Wheel);
+    TIMERMGR_EXIT_CRITICAL(key);
+
+    return count;
+}
+
+/**
+ * @brief Advance the wheel by several ticks
+ */
+uint32 TimerMgr_Advance(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                        TimerMgr_TickType Ticks)
+{
+    TimerMgr_TickType remaining = Ticks;
+    TimerMgr_TickType next;
+    uint32 count = 0U;
+    uint32 key;
+
+    if (Wheel == NULL_PTR)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_ADVANCE_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return 0U;
+    }
+
+    while (remaining > 0UL)
+    {
+        /* One critical section per event keeps the interrupt lock bounded */
+        TIMERMGR_ENTER_CRITICAL(key);
+
+        next = TimerMgr_NextEventLocked(Wheel);
+        if (next > remaining)
+        {
+            Wheel->now += remaining;
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+            Wheel->stats.skipped_ticks += remaining;
+#endif
+            remaining = 0U;
+        }
+        else
+        {
+            Wheel->now += next - 1UL;
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+            Wheel->stats.skipped_ticks += next - 1UL;
+#endif
+            remaining -= next;
+            count += TimerMgr_TickLocked(Wheel);
+        }
+
+        TIMERMGR_EXIT_CRITICAL(key);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Ticks until the next wheel event
+ */
+TimerMgr_TickType TimerMgr_GetTicksToNextEvent(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel)
+{
+    TimerMgr_TickType result;
+    uint32 key;
+
+    if (Wheel == NULL_PTR)
+    {
+        return TIMERMGR_MAX_DELAY;
+    }
+
+    TIMERMGR_ENTER_CRITICAL(key);
+    result = TimerMgr_NextEventLocked(Wheel);
+    TIMERMGR_EXIT_CRITICAL(key);
+
+    return result;
+}
+
+/**
+ * @brief Dispatch the expired batch via timer callbacks
+ */
+uint32 TimerMgr_DispatchExpired(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel)
+{
+    P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) timer;
+    TimerMgr_CallbackType callback;
+    void *context;
+    uint32 count = 0U;
+    uint32 key;
+
+    if (Wheel == NULL_PTR)
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_DISPATCH_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return 0U;
+    }
+
+    do
+    {
+        TIMERMGR_ENTER_CRITICAL(key);
+        timer = TimerMgr_PopExpired(Wheel);
+        callback = (timer != NULL_PTR) ? timer->callback : NULL_PTR;
+        context = (timer != NULL_PTR) ? timer->context : NULL_PTR;
+        TIMERMGR_EXIT_CRITICAL(key);
+
+        if (timer != NULL_PTR)
+        {
+            if (callback != NULL_PTR)
+            {
+                callback(timer, context);
+            }
+            count++;
+        }
+    } while (timer != NULL_PTR);
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+    if (count > Wheel->stats.max_batch_size)
+    {
+        Wheel->stats.max_batch_size = count;
+    }
+#endif
+
+    return count;
+}
+
+/**
+ * @brief Drain expired timers into a caller array
+ */
+uint32 TimerMgr_DrainExpired(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                             P2VAR(TimerMgr_TimerType *, AUTOMATIC, TIMERMGR_APPL_DATA) Expired,
+                             uint32 MaxCount)
+{
+    P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_VAR) timer;
+    uint32 count = 0U;
+    uint32 key;
+
+    if ((Wheel == NULL_PTR) || (Expired == NULL_PTR))
+    {
+        TIMERMGR_REPORT_ERROR(TIMERMGR_DRAIN_API_ID, TIMERMGR_E_PARAM_POINTER);
+        return 0U;
+    }
+
+    TIMERMGR_ENTER_CRITICAL(key);
+    while (count < MaxCount)
+    {
+        timer = TimerMgr_PopExpired(Wheel);
+        if (timer == NULL_PTR)
+        {
+            break;
+        }
+        Expired[count] = timer;
+        count++;
+    }
+    TIMERMGR_EXIT_CRITICAL(key);
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+    if (count > Wheel->stats.max_batch_size)
+    {
+        Wheel->stats.max_batch_size = count;
+    }
+#endif
+
+    return count;
+}
+
+/**
+ * @brief Current wheel time
+ */
+TimerMgr_TickType TimerMgr_GetTime(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel)
+{
+    return (Wheel != NULL_PTR) ? Wheel->now : 0U;
+}
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+/**
+ * @brief Copy wheel statistics
+ */
+Std_ReturnType TimerMgr_GetStatistics(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                      P2VAR(TimerMgr_StatisticsType, AUTOMATIC, TIMERMGR_APPL_DATA) Statistics)
+{
+    if ((Wheel == NULL_PTR) || (Statistics == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    *Statistics = Wheel->stats;
+
+    return E_OK;
+}
+#endif /* TIMERMGR_ENABLE_STATISTICS */
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,434 @@
+/**
+ * @file    timer_manager.h
+ * @brief   Hierarchical Timing Wheel - Software Timer Manager Interface
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Software timer service for BSW modules that need large numbers of
+ * concurrent timeouts (COM deadline monitoring, DEM debouncing, NvM job
+ * timeouts, OS alarms). Timers are kept in a hierarchical timing wheel:
+ *
+ * - TIMERMGR_LEVEL_COUNT levels of TIMERMGR_SLOTS_PER_LEVEL slots each
+ * - Level 0 resolves single ticks, level n resolves 2^(n * LEVEL_BITS) ticks
+ * - Timers on level n > 0 are cascaded to a lower level when level 0 wraps
+ *
+ * Key Features:
+ * - O(1) start, stop and restart (intrusive doubly linked slot lists)
+ * - O(1) expiry processing per tick (only the current slot is visited)
+ * - Slot occupancy bitmaps for skipping idle tick spans (TimerMgr_Advance)
+ * - Expired timers are collected under the critical section and dispatched
+ *   afterwards as one batch, either via callbacks or drained by the caller
+ * - Periodic timers re-armed drift-free (expiry += period)
+ * - Multiple independent wheel instances (one per tick source / module)
+ * - No dynamic memory: timer objects are owned by the client module
+ *
+ * Tick range with default configuration (4 levels x 64 slots):
+ * 2^24 ticks = 16777216 ticks (~4.6 h at 1 ms). Longer delays are parked in
+ * the top level and re-evaluated on every top-level cascade.
+ *
+ * Safety Classification: ASIL-D (used by safety-relevant timeout monitoring)
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial hierarchical wheel release |
+ *
+ * @par Ownership
+ * - Module Owner: BSW Infrastructure Team
+ * - Change Control: All modifications subject to formal review
+ *
+ * @par Safety Requirements Traceability
+ * - SR_TMR_001: Bounded execution time for start/stop/expiry processing
+ * - SR_TMR_002: No dynamic memory allocation
+ * - SR_TMR_003: Timer state observable for diagnostics (statistics)
+ *
+ * @see timer_manager.c
+ * @see systick_driver.h
+ */
+
+#ifndef TIMER_MANAGER_H
+#define TIMER_MANAGER_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define TIMERMGR_VENDOR_ID                      43U
+#define TIMERMGR_MODULE_ID                      256U    /**< Vendor-specific CDD range */
+#define TIMERMGR_INSTANCE_ID                    0U
+
+#define TIMERMGR_SW_MAJOR_VERSION               1U
+#define TIMERMGR_SW_MINOR_VERSION               0U
+#define TIMERMGR_SW_PATCH_VERSION               0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (TIMERMGR_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "timer_manager.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define TIMERMGR_INIT_API_ID                    0x00U
+#define TIMERMGR_START_API_ID                   0x01U
+#define TIMERMGR_STOP_API_ID                    0x02U
+#define TIMERMGR_TICK_API_ID                    0x03U
+#define TIMERMGR_DISPATCH_API_ID                0x04U
+#define TIMERMGR_DRAIN_API_ID                   0x05U
+#define TIMERMGR_ADVANCE_API_ID                 0x06U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define TIMERMGR_E_PARAM_POINTER                0x01U   /**< NULL pointer parameter */
+#define TIMERMGR_E_UNINIT                       0x02U   /**< Wheel not initialized */
+#define TIMERMGR_E_PARAM_DELAY                  0x03U   /**< Delay zero or above TIMERMGR_MAX_DELAY */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def TIMERMGR_LEVEL_BITS
+ * @brief Number of tick bits resolved per wheel level (slots per level = 2^bits)
+ * @details 6 bits (64 slots) keeps the occupancy bitmap in two 32-bit words
+ */
+#ifndef TIMERMGR_LEVEL_BITS
+    #define TIMERMGR_LEVEL_BITS                 6U
+#endif
+
+/**
+ * @def TIMERMGR_LEVEL_COUNT
+ * @brief Number of wheel levels
+ */
+#ifndef TIMERMGR_LEVEL_COUNT
+    #define TIMERMGR_LEVEL_COUNT                4U
+#endif
+
+/**
+ * @def TIMERMGR_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef TIMERMGR_DEV_ERROR_DETECT
+    #define TIMERMGR_DEV_ERROR_DETECT           STD_ON
+#endif
+
+/**
+ * @def TIMERMGR_CRITICAL_SECTION_ENABLED
+ * @brief Protect wheel manipulation against concurrent ISR/task access
+ * @details STD_OFF is only valid when a wheel is used from a single context
+ *          (e.g. host benchmarks, module-private wheels in one MainFunction)
+ */
+#ifndef TIMERMGR_CRITICAL_SECTION_ENABLED
+    #define TIMERMGR_CRITICAL_SECTION_ENABLED   STD_ON
+#endif
+
+/**
+ * @def TIMERMGR_ENABLE_STATISTICS
+ * @brief Enable per-wheel runtime statistics
+ */
+#ifndef TIMERMGR_ENABLE_STATISTICS
+    #define TIMERMGR_ENABLE_STATISTICS          STD_ON
+#endif
+
+/** @brief Slots per wheel level */
+#define TIMERMGR_SLOTS_PER_LEVEL                (1UL << TIMERMGR_LEVEL_BITS)
+
+/** @brief Slot index mask within one level */
+#define TIMERMGR_SLOT_MASK                      (TIMERMGR_SLOTS_PER_LEVEL - 1UL)
+
+/** @brief 32-bit words per level occupancy bitmap */
+#define TIMERMGR_BITMAP_WORDS                   ((TIMERMGR_SLOTS_PER_LEVEL + 31UL) / 32UL)
+
+/** @brief Largest delay resolved exactly by the wheel (longer delays are re-parked) */
+#define TIMERMGR_WHEEL_RANGE                    (1UL << (TIMERMGR_LEVEL_BITS * TIMERMGR_LEVEL_COUNT))
+
+/** @brief Largest accepted delay/period (keeps unsigned tick arithmetic unambiguous) */
+#define TIMERMGR_MAX_DELAY                      0x7FFFFFFFUL
+
+/* Configuration validation */
+#if (TIMERMGR_LEVEL_BITS < 3U) || (TIMERMGR_LEVEL_BITS > 8U)
+    #error "TIMERMGR_LEVEL_BITS must be in range 3..8"
+#endif
+
+#if (TIMERMGR_LEVEL_COUNT < 1U) || ((TIMERMGR_LEVEL_BITS * TIMERMGR_LEVEL_COUNT) > 30U)
+    #error "TIMERMGR_LEVEL_COUNT invalid - wheel range must fit in 30 tick bits"
+#endif
+
+#if (TIMERMGR_DEV_ERROR_DETECT != STD_ON) && (TIMERMGR_DEV_ERROR_DETECT != STD_OFF)
+    #error "TIMERMGR_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (TIMERMGR_CRITICAL_SECTION_ENABLED != STD_ON) && (TIMERMGR_CRITICAL_SECTION_ENABLED != STD_OFF)
+    #error "TIMERMGR_CRITICAL_SECTION_ENABLED must be STD_ON or STD_OFF"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @typedef TimerMgr_TickType
+ * @brief Wheel time base in ticks (wraps modulo 2^32)
+ */
+typedef uint32 TimerMgr_TickType;
+
+/**
+ * @enum TimerMgr_TimerStateType
+ * @brief Software timer life cycle
+ */
+typedef enum
+{
+    TIMERMGR_TIMER_IDLE = 0x00U,        /**< Not armed */
+    TIMERMGR_TIMER_ARMED = 0x01U,       /**< Linked into a wheel slot */
+    TIMERMGR_TIMER_EXPIRED = 0x02U      /**< Linked into the expired batch, not yet dispatched */
+} TimerMgr_TimerStateType;
+
+/**
+ * @struct TimerMgr_ListNodeType
+ * @brief Intrusive circular list node (slot heads are sentinels)
+ */
+typedef struct TimerMgr_ListNodeTag
+{
+    struct TimerMgr_ListNodeTag *next;  /**< Next node */
+    struct TimerMgr_ListNodeTag *prev;  /**< Previous node */
+} TimerMgr_ListNodeType;
+
+struct TimerMgr_TimerTag;
+
+/**
+ * @typedef TimerMgr_CallbackType
+ * @brief Expiry notification
+ * @param Timer   Expired timer (may be restarted or stopped from the callback)
+ * @param Context Client context registered with the timer
+ * @note Invoked from TimerMgr_DispatchExpired() outside the critical section
+ */
+typedef void (*TimerMgr_CallbackType)(
+    P2VAR(struct TimerMgr_TimerTag, AUTOMATIC, TIMERMGR_APPL_DATA) Timer,
+    P2VAR(void, AUTOMATIC, TIMERMGR_APPL_DATA) Context
+);
+
+/**
+ * @struct TimerMgr_TimerType
+ * @brief Software timer object (allocated statically by the client module)
+ * @note The list node must stay the first member (node <-> timer conversion)
+ */
+typedef struct TimerMgr_TimerTag
+{
+    TimerMgr_ListNodeType   node;       /**< Slot / expired list linkage */
+    TimerMgr_TickType       expiry;     /**< Absolute expiry tick */
+    TimerMgr_TickType       period;     /**< Reload period, 0 = one-shot */
+    TimerMgr_CallbackType   callback;   /**< Expiry callback (NULL_PTR for drained timers) */
+    void                   *context;    /**< Client context passed to callback */
+    uint16                  slot;       /**< Linked slot: level * SLOTS_PER_LEVEL + index */
+    uint8                   state;      /**< TimerMgr_TimerStateType */
+    uint8                   reserved;   /**< Padding */
+} TimerMgr_TimerType;
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+/**
+ * @struct TimerMgr_StatisticsType
+ * @brief Wheel runtime statistics
+ */
+typedef struct
+{
+    uint32 active_timers;               /**< Timers currently armed */
+    uint32 max_active_timers;           /**< High-water mark of armed timers */
+    uint32 expirations;                 /**< Total expirations collected */
+    uint32 cascaded_timers;             /**< Timers moved to a lower level */
+    uint32 max_batch_size;              /**< Largest expiry batch dispatched at once */
+    uint32 skipped_ticks;               /**< Idle ticks skipped by TimerMgr_Advance */
+} TimerMgr_StatisticsType;
+#endif
+
+/**
+ * @struct TimerMgr_WheelType
+ * @brief Timing wheel instance
+ */
+typedef struct
+{
+    TimerMgr_ListNodeType   slots[TIMERMGR_LEVEL_COUNT][TIMERMGR_SLOTS_PER_LEVEL]; /**< Slot heads */
+    uint32                  occupancy[TIMERMGR_LEVEL_COUNT][TIMERMGR_BITMAP_WORDS]; /**< Non-empty slots */
+    TimerMgr_ListNodeType   expired;    /**< Expired batch awaiting dispatch */
+    TimerMgr_TickType       now;        /**< Last processed tick */
+    uint32                  armed;      /**< Number of armed timers */
+    boolean                 initialized;/**< Wheel ready for use */
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+    TimerMgr_StatisticsType stats;      /**< Runtime statistics */
+#endif
+} TimerMgr_WheelType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize a timing wheel
+ * @param[in] Wheel    Wheel instance
+ * @param[in] StartTick Initial value of the wheel time base
+ *
+ * @serviceID TIMERMGR_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ */
+extern void TimerMgr_Init(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                          TimerMgr_TickType StartTick);
+
+/**
+ * @brief Prepare a timer object (call once before first start)
+ * @param[out] Timer    Timer object
+ * @param[in]  Callback Expiry callback, NULL_PTR if expirations are drained
+ * @param[in]  Context  Context passed to the callback
+ */
+extern void TimerMgr_InitTimer(P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer,
+                               TimerMgr_CallbackType Callback,
+                               P2VAR(void, AUTOMATIC, TIMERMGR_APPL_DATA) Context);
+
+/**
+ * @brief Arm (or re-arm) a timer - O(1)
+ * @details A timer that is already armed or waiting in the expired batch is
+ *          unlinked first, so restarting doubles as "retrigger".
+ *
+ * @param[in] Wheel  Wheel instance
+ * @param[in] Timer  Timer object
+ * @param[in] Delay  Ticks until first expiry (1..TIMERMGR_MAX_DELAY)
+ * @param[in] Period Reload period in ticks, 0 for one-shot
+ *
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID TIMERMGR_START_API_ID (0x01)
+ * @reentrancy Reentrant for different timers
+ */
+extern Std_ReturnType TimerMgr_Start(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                     P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer,
+                                     TimerMgr_TickType Delay,
+                                     TimerMgr_TickType Period);
+
+/**
+ * @brief Disarm a timer - O(1)
+ * @details Also cancels a pending (collected but not yet dispatched) expiry.
+ *
+ * @serviceID TIMERMGR_STOP_API_ID (0x02)
+ * @reentrancy Reentrant for different timers
+ */
+extern void TimerMgr_Stop(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                          P2VAR(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer);
+
+/**
+ * @brief Check whether a timer is armed or pending dispatch
+ */
+extern boolean TimerMgr_IsActive(P2CONST(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer);
+
+/**
+ * @brief Ticks remaining until a timer expires (0 if idle or already expired)
+ */
+extern TimerMgr_TickType TimerMgr_GetRemaining(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                               P2CONST(TimerMgr_TimerType, AUTOMATIC, TIMERMGR_APPL_DATA) Timer);
+
+/**
+ * @brief Advance the wheel by one tick - O(1)
+ * @details Cascades higher levels when level 0 wraps and moves the current
+ *          level-0 slot to the expired batch. No callback is invoked here,
+ *          so the function is suitable for the tick ISR.
+ *
+ * @return Number of timers that expired on this tick
+ *
+ * @serviceID TIMERMGR_TICK_API_ID (0x03)
+ */
+extern uint32 TimerMgr_Tick(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel);
+
+/**
+ * @brief Advance the wheel by several ticks
+ * @details Idle spans without expiries or cascades are skipped in one step
+ *          using the slot occupancy bitmaps.
+ *
+ * @return Number of timers that expired in the elapsed interval
+ *
+ * @serviceID TIMERMGR_ADVANCE_API_ID (0x06)
+ */
+extern uint32 TimerMgr_Advance(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                               TimerMgr_TickType Ticks);
+
+/**
+ * @brief Ticks until the next wheel event (expiry or cascade)
+ * @details Lower bound: no timer expires earlier than now + result. Used by
+ *          tickless idle and virtual-clock simulation to jump ahead.
+ *
+ * @return Ticks to next event, TIMERMGR_MAX_DELAY when the wheel is empty
+ */
+extern TimerMgr_TickType TimerMgr_GetTicksToNextEvent(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel);
+
+/**
+ * @brief Dispatch the expired batch via timer callbacks
+ * @details Each timer is unlinked under the critical section, periodic timers
+ *          are re-armed, then the callback runs with interrupts enabled.
+ *
+ * @return Number of callbacks invoked
+ *
+ * @serviceID TIMERMGR_DISPATCH_API_ID (0x04)
+ */
+extern uint32 TimerMgr_DispatchExpired(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel);
+
+/**
+ * @brief Drain up to MaxCount expired timers into a caller array
+ * @details Alternative to callbacks for modules that handle expirations in
+ *          their MainFunction loop. Periodic timers are re-armed.
+ *
+ * @param[in]  Wheel    Wheel instance
+ * @param[out] Expired  Array receiving expired timer pointers
+ * @param[in]  MaxCount Capacity of Expired
+ *
+ * @return Number of timers written to Expired
+ *
+ * @serviceID TIMERMGR_DRAIN_API_ID (0x05)
+ */
+extern uint32 TimerMgr_DrainExpired(P2VAR(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                    P2VAR(TimerMgr_TimerType *, AUTOMATIC, TIMERMGR_APPL_DATA) Expired,
+                                    uint32 MaxCount);
+
+/**
+ * @brief Current wheel time
+ */
+extern TimerMgr_TickType TimerMgr_GetTime(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel);
+
+#if (TIMERMGR_ENABLE_STATISTICS == STD_ON)
+/**
+ * @brief Copy wheel statistics
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ */
+extern Std_ReturnType TimerMgr_GetStatistics(P2CONST(TimerMgr_WheelType, AUTOMATIC, TIMERMGR_APPL_DATA) Wheel,
+                                             P2VAR(TimerMgr_StatisticsType, AUTOMATIC, TIMERMGR_APPL_DATA) Statistics);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_MANAGER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
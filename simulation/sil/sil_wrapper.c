@@ -0,0 +1,698 @@
+/**
+ * @file    sil_wrapper.c
+ * @brief   Software-in-the-Loop Wrapper - Virtual Clock for the POSIX OS Port
+ * @version 1.2.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the SIL runtime declared in sil_wrapper.h, including the
+ * state of the POSIX OS port (emulated BASEPRI, deferred dispatch) and a
+ * standalone main() (disable with SIL_NO_MAIN when the wrapper is linked
+ * into a co-simulation master).
+ *
+ * Virtual clock loop (one iteration per event):
+ * 1. step = min(remaining, ticks to next alarm event, ticks to next model step)
+ * 2. Advance the OS counter by step at "interrupt level" on every core;
+ *    expired alarms activate tasks, which are dispatched when the simulated
+ *    ISR returns; then service inter-core interrupts raised meanwhile
+ * 3. In lockstep mode, step the plant model after the OS events of that tick
+ * 4. Optionally sleep to honour realtime_factor
+ *
+ * At the end of a run main() prints the RTE timing chains (rte_trace.h):
+ * end-to-end age and budget violations per chain, latency and age per hop.
+ *
+ * Build (host toolchain profile):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF -DRTE_RECORDER_REPLAY=STD_ON \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os \
+ *     -Iplatform/baremetal_core/timing -Iplatform/baremetal_core/safety_monitor -Isimulation/sil -Isrc/rte \
+ *     -Isrc/swc/DiagnosticManager \
+ *     simulation/sil/sil_wrapper.c src/bsw/os/scheduler.c src/bsw/os/resource_manager.c \
+ *     src/bsw/os/lockstep_scheduler.c \
+ *     src/bsw/os/task_config.c src/app/task_definitions.c \
+ *     src/rte/rte.c src/rte/rte_com.c src/rte/rte_recorder.c src/rte/rte_scheduler.c \
+ *     src/rte/rte_lockstep.c src/rte/rte_error.c src/rte/rte_trace.c src/rte/rte_cfg.c \
+ *     src/swc/DiagnosticManager/DiagnosticManager.c \
+ *     platform/baremetal_core/timing/timer_manager.c \
+ *     platform/baremetal_core/safety_monitor/deadlock_detection.c src/mcal/common/det.c \
+ *     -o vcu_sil
+ * ./vcu_sil simulation/sil/sil_config.yaml
+ * @endcode
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Multi-core simulation              |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Recorder replay and record files   |
+ * | 1.2.1   | 2026-10-16 | BSW Team        | Core clock from the port layer     |
+ *
+ * @see sil_wrapper.h
+ * @see os_port_posix.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime(), nanosleep() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sil_wrapper.h"
+#include "lockstep_scheduler.h"
+#include "os_port.h"
+#include "rte.h"
+
+#if !defined(OS_PORT_POSIX)
+    #error "sil_wrapper.c requires the POSIX OS port (define OS_PORT_POSIX)"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define SIL_DEFAULT_CONFIG_PATH                 "simulation/sil/sil_config.yaml"
+#define SIL_LINE_LENGTH                         256U
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/** @brief Emulated BASEPRI register (os_port_posix.h) */
+uint32 Os_Port_PosixBasePri = 0UL;
+
+/** @brief Dispatch requested from simulated interrupt level (os_port_posix.h) */
+boolean Os_Port_PosixDispatchPending = FALSE;
+
+/** @brief Core whose OS instance is currently simulated (os_port_posix.h) */
+CoreIdType Os_Port_PosixCoreId = OS_CORE_ID_MASTER;
+
+/** @brief Pending inter-core interrupts, one bit per core (os_port_posix.h) */
+uint32 Os_Port_PosixCoreSignals = 0UL;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static Sil_ConfigType Sil_Cfg;
+static const Sil_ModelType *Sil_Model = NULL_PTR;
+static Sil_StatisticsType Sil_Stats;
+
+static uint64 Sil_Now = 0U;                 /**< Virtual time in OS ticks */
+static uint64 Sil_NextModelStep = 0U;       /**< Tick of the next plant model step */
+static uint64 Sil_NextReport = 0U;          /**< Tick of the next progress report */
+static uint64 Sil_PaceBaseTicks = 0U;       /**< Virtual time at pacing reference */
+static double Sil_PaceBaseHost = 0.0;       /**< Host time at pacing reference */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static double Sil_HostSeconds(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1.0e-9);
+}
+
+/**
+ * @brief Copy a configuration string; E_NOT_OK if it does not fit
+ */
+static Std_ReturnType Sil_CopyPath(char *Dst, const char *Value)
+{
+    if (strlen(Value) >= SIL_PATH_LENGTH)
+    {
+        return E_NOT_OK;
+    }
+    (void)strcpy(Dst, Value);
+
+    return E_OK;
+}
+
+static char *Sil_Trim(char *Text)
+{
+    char *end;
+
+    while ((*Text == ' ') || (*Text == '\t'))
+    {
+        Text++;
+    }
+
+    end = Text + strlen(Text);
+    while ((end > Text) && ((end[-1] == ' ') || (end[-1] == '\t') || (end[-1] == '\r') || (end[-1] == '\n')))
+    {
+        end--;
+    }
+    *end = '\0';
+
+    return Text;
+}
+
+/**
+ * @brief Perform a dispatch that was requested at simulated interrupt level
+ */
+static void Sil_DispatchPending(void)
+{
+    if (Os_Port_PosixDispatchPending == TRUE)
+    {
+        Os_Port_PosixDispatchPending = FALSE;
+        Os_Schedule();
+    }
+}
+
+/**
+ * @brief Run the inter-core ISR on every signalled core until none is pending
+ */
+static void Sil_ServiceIntercore(void)
+{
+    CoreIdType core;
+
+    while (Os_Port_PosixCoreSignals != 0UL)
+    {
+        for (core = 0U; core < OS_NUM_CORES; core++)
+        {
+            if ((Os_Port_PosixCoreSignals & (1UL << core)) != 0UL)
+            {
+                Os_Port_PosixCoreId = core;
+                Os_Core_IntercoreIsr();
+                Sil_DispatchPending();
+                Sil_Stats.intercore_interrupts++;
+            }
+        }
+    }
+
+    Os_Port_PosixCoreId = OS_CORE_ID_MASTER;
+}
+
+/**
+ * @brief Advance the OS counter (simulated SysTick ISR covering Ticks ticks)
+ */
+static void Sil_AdvanceCounter(TickType Ticks)
+{
+    CoreIdType core;
+
+    Sil_Now += Ticks;
+    Sil_Stats.virtual_ticks += Ticks;
+    Sil_Stats.clock_jumps++;
+
+    for (core = 0U; core < OS_NUM_CORES; core++)
+    {
+        Os_Port_PosixCoreId = core;
+        Os_EnterIsr();
+        Os_AdvanceTicks(Ticks);
+        Os_LeaveIsr();
+        Sil_DispatchPending();
+    }
+
+    Sil_ServiceIntercore();
+}
+
+/**
+ * @brief Ticks until the next alarm event on any core
+ */
+static uint64 Sil_TicksToNextAlarm(void)
+{
+    uint64 next = (uint64)TIMERMGR_MAX_DELAY;
+    CoreIdType core;
+
+    for (core = 0U; core < OS_NUM_CORES; core++)
+    {
+        uint64 ticks;
+
+        Os_Port_PosixCoreId = core;
+        ticks = (uint64)Os_GetTicksToNextAlarm();
+        if (ticks < next)
+        {
+            next = ticks;
+        }
+    }
+    Os_Port_PosixCoreId = OS_CORE_ID_MASTER;
+
+    return next;
+}
+
+/**
+ * @brief Sleep until host time catches up with realtime_factor
+ */
+static void Sil_Pace(void)
+{
+    double virtual_s = (double)(Sil_Now - Sil_PaceBaseTicks) * (double)Sil_Cfg.tick_period_us * 1.0e-6;
+    double ahead_s = (Sil_PaceBaseHost + (virtual_s / Sil_Cfg.realtime_factor)) - Sil_HostSeconds();
+
+    if (ahead_s > 0.0)
+    {
+        struct timespec ts;
+
+        ts.tv_sec = (time_t)ahead_s;
+        ts.tv_nsec = (long)((ahead_s - (double)ts.tv_sec) * 1.0e9);
+        (void)nanosleep(&ts, NULL);
+    }
+}
+
+static void Sil_Report(void)
+{
+    (void)printf("[sil] t=%10.3f s  events=%llu  model_steps=%llu  intercore=%llu\n",
+                 (double)Sil_GetTimeUs() * 1.0e-6,
+                 (unsigned long long)Sil_Stats.clock_jumps,
+                 (unsigned long long)Sil_Stats.model_steps,
+                 (unsigned long long)Sil_Stats.intercore_interrupts);
+}
+
+#if (RTE_TRACE == STD_ON)
+/**
+ * @brief Print the measured ages of the timing chains and the latencies of their hops
+ */
+static void Sil_ReportTrace(void)
+{
+    Rte_TraceChainIdType chain;
+    Rte_TraceHopIdType hop;
+
+    for (chain = 0U; chain < RTE_TRACE_CHAIN_COUNT; chain++)
+    {
+        Rte_TraceChainStatusType status;
+
+        (void)Rte_Trace_GetChainStatus(chain, &status);
+        (void)printf("[sil] chain %u: end-to-end age %lu..%lu us over %lu samples, budget %lu us, %lu violations\n",
+                     (unsigned)chain, (unsigned long)status.end_to_end.min_us,
+                     (unsigned long)status.end_to_end.max_us, (unsigned long)status.end_to_end.samples,
+                     (unsigned long)status.budget_us, (unsigned long)status.violations);
+
+        for (hop = Rte_TraceChain[chain].first; hop <= Rte_TraceChain[chain].last; hop++)
+        {
+            Rte_TraceHopStatusType hop_status;
+
+            (void)Rte_Trace_GetHopStatus(hop, &hop_status);
+            (void)printf("[sil]   hop %u (task %u): latency %lu..%lu us, age %lu..%lu us\n",
+                         (unsigned)hop, (unsigned)Rte_TraceHop[hop].task,
+                         (unsigned long)hop_status.latency.min_us, (unsigned long)hop_status.latency.max_us,
+                         (unsigned long)hop_status.age.min_us, (unsigned long)hop_status.age.max_us);
+        }
+    }
+}
+#endif
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void Sil_GetDefaultConfig(Sil_ConfigType *Config)
+{
+    Config->mode = SIL_MODE_FREE_RUNNING;
+    Config->tick_period_us = 1000U;
+    Config->core_clock_hz = OS_PORT_CORE_CLOCK_HZ;
+    Config->duration_ticks = 60000U;
+    Config->realtime_factor = 0.0;
+    Config->model_step_ticks = 1U;
+    Config->report_interval_ticks = 0U;
+    Config->replay_file[0] = '\0';
+    Config->record_file[0] = '\0';
+}
+
+Std_ReturnType Sil_LoadConfig(const char *Path, Sil_ConfigType *Config)
+{
+    char line[SIL_LINE_LENGTH];
+    double duration_s = -1.0;
+    double model_step_ms = -1.0;
+    double report_s = -1.0;
+    Std_ReturnType result = E_OK;
+    FILE *file = fopen(Path, "r");
+
+    if (file == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    while (fgets(line, (int)sizeof(line), file) != NULL)
+    {
+        char *comment = strchr(line, '#');
+        char *colon;
+        char *key;
+        char *value;
+
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+
+        colon = strchr(line, ':');
+        if (colon == NULL)
+        {
+            continue;
+        }
+        *colon = '\0';
+        key = Sil_Trim(line);
+        value = Sil_Trim(colon + 1);
+
+        if (*value == '\0')
+        {
+            continue;                       /* section header */
+        }
+
+        if (strcmp(key, "mode") == 0)
+        {
+            if (strcmp(value, "free_running") == 0)
+            {
+                Config->mode = SIL_MODE_FREE_RUNNING;
+            }
+            else if (strcmp(value, "lockstep") == 0)
+            {
+                Config->mode = SIL_MODE_LOCKSTEP;
+            }
+            else
+            {
+                result = E_NOT_OK;
+            }
+        }
+        else if (strcmp(key, "tick_period_us") == 0)
+        {
+            Config->tick_period_us = (uint32)strtoul(value, NULL, 10);
+        }
+        else if (strcmp(key, "core_clock_hz") == 0)
+        {
+            Config->core_clock_hz = (uint32)strtoul(value, NULL, 10);
+        }
+        else if (strcmp(key, "duration_s") == 0)
+        {
+            duration_s = strtod(value, NULL);
+        }
+        else if (strcmp(key, "realtime_factor") == 0)
+        {
+            Config->realtime_factor = strtod(value, NULL);
+        }
+        else if (strcmp(key, "model_step_ms") == 0)
+        {
+            model_step_ms = strtod(value, NULL);
+        }
+        else if (strcmp(key, "report_interval_s") == 0)
+        {
+            report_s = strtod(value, NULL);
+        }
+        else if (strcmp(key, "replay_file") == 0)
+        {
+            if (Sil_CopyPath(Config->replay_file, value) != E_OK)
+            {
+                result = E_NOT_OK;
+            }
+        }
+        else if (strcmp(key, "record_file") == 0)
+        {
+            if (Sil_CopyPath(Config->record_file, value) != E_OK)
+            {
+                result = E_NOT_OK;
+            }
+        }
+        else
+        {
+            /* Unknown keys are ignored (forward compatibility) */
+        }
+    }
+    (void)fclose(file);
+
+    /* The modules convert times with OS_PORT_TICKS_PER_US: the virtual clock must match */
+    if ((Config->tick_period_us == 0U) || (Config->realtime_factor < 0.0) ||
+        (Config->core_clock_hz != OS_PORT_CORE_CLOCK_HZ))
+    {
+        return E_NOT_OK;
+    }
+
+    /* Time based values are converted once the tick period is known */
+    if (duration_s >= 0.0)
+    {
+        Config->duration_ticks = (uint64)((duration_s * 1.0e6) / (double)Config->tick_period_us);
+    }
+    if (model_step_ms > 0.0)
+    {
+        Config->model_step_ticks = (uint32)((model_step_ms * 1.0e3) / (double)Config->tick_period_us);
+    }
+    if (report_s >= 0.0)
+    {
+        Config->report_interval_ticks = (uint64)((report_s * 1.0e6) / (double)Config->tick_period_us);
+    }
+    if (Config->model_step_ticks == 0U)
+    {
+        result = E_NOT_OK;
+    }
+
+    return result;
+}
+
+void Sil_Init(const Sil_ConfigType *Config, const Os_ConfigType *OsConfig, const Sil_ModelType *Model)
+{
+    CoreIdType core;
+
+    Sil_Cfg = *Config;
+    Sil_Model = Model;
+    (void)memset(&Sil_Stats, 0, sizeof(Sil_Stats));
+
+    Sil_Now = 0U;
+    Sil_NextModelStep = Sil_Cfg.model_step_ticks;
+    Sil_NextReport = Sil_Cfg.report_interval_ticks;
+
+    if ((Sil_Model != NULL_PTR) && (Sil_Model->init != NULL_PTR))
+    {
+        Sil_Model->init();
+    }
+
+    Os_Port_PosixCoreId = OS_CORE_ID_MASTER;
+    Os_Port_PosixCoreSignals = 0UL;
+    Os_Init(OsConfig);
+
+    for (core = 0U; core < OS_NUM_CORES; core++)
+    {
+        Os_Port_PosixCoreId = core;
+        Os_Start();
+        Sil_DispatchPending();
+    }
+
+    Sil_ServiceIntercore();
+}
+
+void Sil_Step(uint64 Ticks)
+{
+    uint64 target = Sil_Now + Ticks;
+    boolean lockstep = ((Sil_Cfg.mode == SIL_MODE_LOCKSTEP) && (Sil_Model != NULL_PTR)) ? TRUE : FALSE;
+    double host_start = Sil_HostSeconds();
+
+    Sil_PaceBaseTicks = Sil_Now;
+    Sil_PaceBaseHost = host_start;
+
+    while (Sil_Now < target)
+    {
+        uint64 step = target - Sil_Now;
+        uint64 next_event = Sil_TicksToNextAlarm();
+
+        if (next_event < step)
+        {
+            step = next_event;
+        }
+        if ((lockstep == TRUE) && ((Sil_NextModelStep - Sil_Now) < step))
+        {
+            step = Sil_NextModelStep - Sil_Now;
+        }
+
+        Sil_AdvanceCounter((TickType)step);
+
+        if ((lockstep == TRUE) && (Sil_Now == Sil_NextModelStep))
+        {
+            Sil_Model->step(Sil_GetTimeUs());
+            Sil_NextModelStep += Sil_Cfg.model_step_ticks;
+            Sil_Stats.model_steps++;
+        }
+
+        if (Sil_Cfg.realtime_factor > 0.0)
+        {
+            Sil_Pace();
+        }
+
+        if ((Sil_Cfg.report_interval_ticks != 0U) && (Sil_Now >= Sil_NextReport))
+        {
+            Sil_Report();
+            Sil_NextReport += Sil_Cfg.report_interval_ticks;
+        }
+    }
+
+    Sil_Stats.host_seconds += Sil_HostSeconds() - host_start;
+}
+
+void Sil_Run(void)
+{
+    Sil_Step(Sil_Cfg.duration_ticks);
+}
+
+void Sil_RaiseInterrupt(void (*Handler)(void))
+{
+    Os_EnterIsr();
+    Handler();
+    Os_LeaveIsr();
+
+    Sil_DispatchPending();
+    Sil_ServiceIntercore();
+}
+
+uint64 Sil_GetTimeUs(void)
+{
+    return Sil_Now * (uint64)Sil_Cfg.tick_period_us;
+}
+
+uint32 Sil_GetCycleCount(void)
+{
+    return (uint32)(Sil_GetTimeUs() * (uint64)(Sil_Cfg.core_clock_hz / 1000000UL));
+}
+
+void Sil_GetStatistics(Sil_StatisticsType *Statistics)
+{
+    *Statistics = Sil_Stats;
+}
+
+#if !defined(SIL_NO_MAIN)
+
+/**
+ * @brief Plant model used by the standalone runner (override to link a model)
+ */
+WEAK const Sil_ModelType *Sil_GetPlantModel(void)
+{
+    return NULL_PTR;
+}
+
+/**
+ * @brief Load a recording and start its replay (the buffer lives until exit)
+ */
+static Std_ReturnType Sil_StartReplay(const char *Path)
+{
+    Std_ReturnType result = E_NOT_OK;
+    FILE *file = fopen(Path, "rb");
+    uint8 *data = NULL;
+    long size;
+
+    if (file == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    if ((fseek(file, 0L, SEEK_END) == 0) && ((size = ftell(file)) > 0L) && (fseek(file, 0L, SEEK_SET) == 0))
+    {
+        data = (uint8 *)malloc((size_t)size);
+        if ((data != NULL) && (fread(data, 1U, (size_t)size, file) == (size_t)size) &&
+            (Rte_Recorder_StartReplay(data, (uint32)size) == RTE_E_OK))
+        {
+            result = E_OK;
+        }
+    }
+    (void)fclose(file);
+
+    if (result != E_OK)
+    {
+        free(data);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Freeze the recording of the run (unless a fault did) and write its export image
+ */
+static Std_ReturnType Sil_WriteRecording(const char *Path)
+{
+    Rte_RecorderStatusType status;
+    Std_ReturnType result = E_NOT_OK;
+    uint32 size;
+    uint8 *data;
+    FILE *file;
+
+    Rte_Recorder_Freeze(0U);
+    (void)Rte_Recorder_GetStatus(&status);
+    while (status.state == RTE_RECORDER_TRIGGERED)
+    {
+        Sil_Step(1U);
+        (void)Rte_Recorder_GetStatus(&status);
+    }
+
+    if (Rte_Recorder_GetExportSize(&size) != RTE_E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    data = (uint8 *)malloc(size);
+    file = fopen(Path, "wb");
+    if ((data != NULL) && (file != NULL) && (Rte_Recorder_Export(0UL, data, size) == RTE_E_OK) &&
+        (fwrite(data, 1U, size, file) == size))
+    {
+        result = E_OK;
+    }
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+    free(data);
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = (argc > 1) ? argv[1] : SIL_DEFAULT_CONFIG_PATH;
+    Sil_ConfigType config;
+    Sil_StatisticsType stats;
+    double virtual_s;
+
+    Sil_GetDefaultConfig(&config);
+    if (Sil_LoadConfig(path, &config) != E_OK)
+    {
+        (void)fprintf(stderr, "[sil] invalid or missing configuration: %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    Sil_Init(&config, &Os_Config, Sil_GetPlantModel());
+
+    if ((config.replay_file[0] != '\0') && (Sil_StartReplay(config.replay_file) != E_OK))
+    {
+        (void)fprintf(stderr, "[sil] cannot replay %s (missing file or other channel layout)\n",
+                      config.replay_file);
+        return EXIT_FAILURE;
+    }
+
+    Sil_Run();
+
+    Sil_GetStatistics(&stats);
+    virtual_s = (double)stats.virtual_ticks * (double)config.tick_period_us * 1.0e-6;
+    (void)printf("[sil] simulated %.1f s in %.3f s host time (x%.0f), %llu events, %llu model steps\n",
+                 virtual_s, stats.host_seconds,
+                 (stats.host_seconds > 0.0) ? (virtual_s / stats.host_seconds) : 0.0,
+                 (unsigned long long)stats.clock_jumps, (unsigned long long)stats.model_steps);
+#if (RTE_TRACE == STD_ON)
+    Sil_ReportTrace();
+#endif
+
+    if (config.replay_file[0] != '\0')
+    {
+        Rte_RecorderStatusType status;
+
+        (void)Rte_Recorder_GetStatus(&status);
+        (void)printf("[sil] replay: up to frame %lu, %lu frames with differing outputs (first: frame %lu)%s\n",
+                     (unsigned long)status.frames, (unsigned long)status.mismatches,
+                     (unsigned long)status.first_mismatch_frame,
+                     (status.state == RTE_RECORDER_REPLAY_DONE) ? "" : ", recording not exhausted");
+    }
+
+    if ((config.record_file[0] != '\0') && (Sil_WriteRecording(config.record_file) != E_OK))
+    {
+        (void)fprintf(stderr, "[sil] cannot write recording %s\n", config.record_file);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+#endif /* !SIL_NO_MAIN */
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,167 @@
+/**
+ * @file    sil_wrapper.h
+ * @brief   Software-in-the-Loop Wrapper - Virtual Clock for the POSIX OS Port
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs the real OS configuration and application task set on a host PC,
+ * driven by a virtual clock instead of SysTick:
+ *
+ * - Free running: the clock jumps from one alarm event to the next
+ *   (Os_GetTicksToNextAlarm), so idle time costs nothing and hours of
+ *   drive cycle execute in minutes
+ * - Lockstep: a plant model is stepped at a fixed virtual period between
+ *   OS events, either in-process (Sil_ModelType) or by an external
+ *   co-simulation master calling Sil_Step()
+ * - Optional pacing against host time (realtime_factor)
+ * - Field replay: a recording exported by the RTE recorder (replay_file)
+ *   drives the recorded inputs; the standalone runner reports the frames
+ *   whose outputs differ from the recording. record_file writes the
+ *   recording of the simulated run in the same format
+ *
+ * With OS_NUM_CORES > 1 every core's OS instance is simulated on the host
+ * thread: each core receives the counter advance in turn, then pending
+ * inter-core interrupts are serviced until none is left.
+ *
+ * Build with OS_PORT_POSIX and TIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF;
+ * interrupts are injected synchronously with Sil_RaiseInterrupt().
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Multi-core simulation              |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Recorder replay and record files   |
+ *
+ * @see sil_wrapper.c
+ * @see sil_config.yaml
+ */
+
+#ifndef SIL_WRAPPER_H
+#define SIL_WRAPPER_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "scheduler.h"
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Capacity of a file path in Sil_ConfigType, including the terminator */
+#define SIL_PATH_LENGTH                         256U
+
+/**
+ * @enum Sil_ModeType
+ * @brief Virtual clock mode
+ */
+typedef enum
+{
+    SIL_MODE_FREE_RUNNING = 0,          /**< Event to event, as fast as possible */
+    SIL_MODE_LOCKSTEP = 1               /**< Plant model stepped at model_step_ticks */
+} Sil_ModeType;
+
+/**
+ * @struct Sil_ConfigType
+ * @brief Simulation parameters (sil_config.yaml)
+ */
+typedef struct
+{
+    Sil_ModeType mode;
+    uint32       tick_period_us;        /**< Virtual duration of one OS tick */
+    uint32       core_clock_hz;         /**< Emulated core clock for time stamps */
+    uint64       duration_ticks;        /**< Run length for Sil_Run() */
+    double       realtime_factor;       /**< 0 = unpaced, otherwise virtual/host speed ratio */
+    uint32       model_step_ticks;      /**< Plant model step (lockstep mode) */
+    uint64       report_interval_ticks; /**< Progress report period, 0 = none */
+    char         replay_file[SIL_PATH_LENGTH];  /**< Recording to replay, empty = none */
+    char         record_file[SIL_PATH_LENGTH];  /**< Recording written after the run, empty = none */
+} Sil_ConfigType;
+
+/**
+ * @struct Sil_ModelType
+ * @brief In-process plant model (e.g. generated model code)
+ */
+typedef struct
+{
+    void (*init)(void);                 /**< Called once by Sil_Init() */
+    void (*step)(uint64 TimeUs);        /**< Called every model step with the virtual time */
+} Sil_ModelType;
+
+/**
+ * @struct Sil_StatisticsType
+ * @brief Run statistics
+ */
+typedef struct
+{
+    uint64 virtual_ticks;               /**< Simulated OS ticks */
+    uint64 clock_jumps;                 /**< Virtual clock advances (events processed) */
+    uint64 model_steps;                 /**< Plant model steps */
+    uint64 intercore_interrupts;        /**< Inter-core interrupts serviced */
+    double host_seconds;                /**< Host time spent in Sil_Run()/Sil_Step() */
+} Sil_StatisticsType;
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Load sil_config.yaml (unknown keys are ignored, missing keys keep defaults)
+ * @return E_OK, or E_NOT_OK if the file cannot be read or a value is invalid
+ *         (core_clock_hz must equal OS_PORT_CORE_CLOCK_HZ)
+ */
+extern Std_ReturnType Sil_LoadConfig(const char *Path, Sil_ConfigType *Config);
+
+/**
+ * @brief Default configuration (free running, 1 ms tick, OS_PORT_CORE_CLOCK_HZ, 60 s)
+ */
+extern void Sil_GetDefaultConfig(Sil_ConfigType *Config);
+
+/**
+ * @brief Initialize virtual clock, OS and (optional) plant model, then start the OS
+ */
+extern void Sil_Init(const Sil_ConfigType *Config, const Os_ConfigType *OsConfig,
+                     const Sil_ModelType *Model);
+
+/**
+ * @brief Advance the virtual clock by Ticks (co-simulation step)
+ */
+extern void Sil_Step(uint64 Ticks);
+
+/**
+ * @brief Run for the configured duration
+ */
+extern void Sil_Run(void);
+
+/**
+ * @brief Execute an interrupt handler at the current virtual time
+ * @details Runs on the master core. Wraps the handler in Os_EnterIsr()/Os_LeaveIsr() and performs
+ *          the dispatch requested from interrupt level afterwards.
+ */
+extern void Sil_RaiseInterrupt(void (*Handler)(void));
+
+/**
+ * @brief Current virtual time in microseconds
+ */
+extern uint64 Sil_GetTimeUs(void);
+
+/**
+ * @brief Virtual core cycle counter (DWT CYCCNT emulation)
+ */
+extern uint32 Sil_GetCycleCount(void);
+
+/**
+ * @brief Copy run statistics
+ */
+extern void Sil_GetStatistics(Sil_StatisticsType *Statistics);
+
+#endif /* SIL_WRAPPER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
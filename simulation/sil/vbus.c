@@ -0,0 +1,883 @@
+/**
+ * @file    vbus.c
+ * @brief   Virtual Bus - In-Process CAN / CAN-FD / Ethernet Buses for Host Benchmarks
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the virtual bus declared in vbus.h. Every bus has a
+ * queue of frames waiting for it, at most one frame in transmission and a
+ * FIFO of transmitted frames waiting for their delivery time. Vbus_Run()
+ * repeatedly takes the earliest pending event of all buses:
+ *
+ * | Event      | Time                              | Action                                      |
+ * |------------|-----------------------------------|---------------------------------------------|
+ * | End        | End of the frame on the bus       | TX confirmation to the VCU, frame to the    |
+ * |            |                                   | delivery FIFO                               |
+ * | Delivery   | Delivery time of the FIFO head    | Indication to the VCU or the callouts       |
+ * | Background | Next background frame             | Background frame queued                     |
+ * | Start      | Bus idle and a frame queued       | Arbitration (CAN) or FIFO head (Ethernet)   |
+ *
+ * Events of the same time are taken in this order, so all frames queued
+ * at the end of a frame, by its confirmation included, compete in the
+ * following arbitration. Frames are held in one pool (VBUS_FRAME_COUNT)
+ * and referenced by index from the queues.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see vbus.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+
+#include "vbus.h"
+#include "pdu_router.h"
+#include "can_tp.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define VBUS_NO_FRAME                           0xFFFFU
+#define VBUS_NO_BUS                             0xFFU
+
+/* Events in the order they are taken at the same time */
+#define VBUS_EVENT_END                          0U
+#define VBUS_EVENT_DELIVERY                     1U
+#define VBUS_EVENT_BACKGROUND                   2U
+#define VBUS_EVENT_START                        3U
+
+#define VBUS_MAX_LOAD_PERCENT                   95U
+
+/* Ethernet frame: header, FCS, minimum length, preamble + SFD and inter-frame gap [bytes] */
+#define VBUS_ETH_HEADER                         14U
+#define VBUS_ETH_FCS                            4U
+#define VBUS_ETH_MIN_FRAME                      64U
+#define VBUS_ETH_GAP                            20U
+#define VBUS_ETH_MAX_FRAME                      1518U
+
+/* Protocol headers in front of the payload: IPv4 + UDP, SoAd PDU header, VLAN + AVTP NTSCF + ACF-CAN */
+#define VBUS_UDP_HEADERS                        28U
+#define VBUS_SOAD_HEADER                        8U
+#define VBUS_ACF_HEADERS                        32U
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @brief State of one bus
+ */
+typedef struct
+{
+    Vbus_ModelType      model;
+    Vbus_StatisticsType stats;
+    uint64 busy_until_ns;               /**< End of the frame on the bus or of the last one */
+    uint64 next_background_ns;          /**< Arrival of the next background frame */
+    uint64 last_delivery_ns;            /**< Delivery time of the last frame (in-order delivery) */
+    uint32 random;                      /**< xorshift32 state */
+    uint16 on_bus;                      /**< Frame in transmission, VBUS_NO_FRAME if idle */
+    uint16 queued;                      /**< Frames in queue[] */
+    uint16 delivery_head;
+    uint16 delivery_count;
+    uint16 vcu_pending;                 /**< Frames of the VCU queued or in transmission */
+    uint16 queue[VBUS_QUEUE_LENGTH];    /**< Frames waiting for the bus, in arrival order */
+    uint16 delivery[VBUS_FRAME_COUNT];  /**< Transmitted frames, in delivery order */
+} Vbus_BusStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static Vbus_BusStateType Vbus_State[VBUS_BUS_COUNT];
+static Vbus_FrameType Vbus_Frames[VBUS_FRAME_COUNT];
+static uint16 Vbus_FreeFrames[VBUS_FRAME_COUNT];
+static uint16 Vbus_FreeCount = 0U;
+static uint64 Vbus_Now = 0U;
+static uint8 Vbus_EthernetBus = VBUS_NO_BUS;
+
+/** @brief Payload lengths of the CAN-FD data length codes 9..15 */
+static const uint8 Vbus_FdLengths[] = { 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Vbus_Random(Vbus_BusStateType *state)
+{
+    uint32 x = state->random;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    state->random = x;
+
+    return x;
+}
+
+/**
+ * @brief Payload length of the smallest CAN-FD frame holding Length bytes (DLC padding)
+ */
+static uint32 Vbus_FdPadded(uint32 Length)
+{
+    uint32 i;
+
+    if (Length <= 8U)
+    {
+        return Length;
+    }
+    for (i = 0U; i < (sizeof(Vbus_FdLengths) - 1U); i++)
+    {
+        if (Length <= Vbus_FdLengths[i])
+        {
+            break;
+        }
+    }
+    return Vbus_FdLengths[i];
+}
+
+/**
+ * @brief Nanoseconds of Bits at Bitrate, rounded up
+ */
+static uint64 Vbus_BitsNs(uint32 Bits, uint32 Bitrate)
+{
+    return (((uint64)Bits * 1000000000ULL) + Bitrate - 1U) / Bitrate;
+}
+
+/**
+ * @brief Transmission time of a CAN / CAN-FD frame with an 11-bit identifier, worst-case stuffing
+ */
+static uint64 Vbus_CanFrameNs(const Vbus_ModelType *Model, uint32 Length, boolean Fd)
+{
+    uint32 data_bits, nominal_bits, crc_bits;
+
+    if (Fd == FALSE)
+    {
+        /* SOF .. CRC delimiter, ACK, EOF, IFS: 47 + 8n bits, one stuff bit per 4 of the 34 + 8n stuffed */
+        data_bits = 8U * Length;
+        return Vbus_BitsNs(47U + data_bits + ((33U + data_bits) / 4U), Model->nominal_bitrate);
+    }
+
+    /* Arbitration phase: SOF, ID, RRS, IDE, FDF, res, BRS (17 bits, 4 stuff bits); after the data phase
+       CRC delimiter, ACK, ACK delimiter, EOF, IFS (13 bits) */
+    nominal_bits = 17U + 4U + 13U;
+
+    /* Data phase: ESI, DLC, data, stuff bit count (4), CRC with its fixed stuff bits (one per 4) */
+    data_bits = 8U * Vbus_FdPadded(Length);
+    crc_bits = (data_bits <= 128U) ? 17U : 21U;
+    data_bits = 5U + data_bits + ((4U + data_bits) / 4U) + 4U + crc_bits + ((crc_bits + 3U) / 4U);
+
+    return Vbus_BitsNs(nominal_bits, Model->nominal_bitrate) + Vbus_BitsNs(data_bits, Model->data_bitrate);
+}
+
+/**
+ * @brief Transmission time of an Ethernet frame carrying Length payload bytes of a frame kind
+ */
+static uint64 Vbus_EthernetFrameNs(const Vbus_ModelType *Model, uint8 Kind, uint32 Length)
+{
+    uint32 bytes;
+
+    switch (Kind)
+    {
+        case VBUS_FRAME_SOAD:
+            bytes = VBUS_UDP_HEADERS + VBUS_SOAD_HEADER + Length;
+            break;
+        case VBUS_FRAME_ETHCOMM:
+            bytes = VBUS_ACF_HEADERS + ((Length + 3U) & ~3UL);     /* ACF messages in quadlets */
+            break;
+        case VBUS_FRAME_RAW:
+            bytes = VBUS_UDP_HEADERS + Length;
+            break;
+        default:                                                    /* Background: frame length */
+            bytes = Length - VBUS_ETH_HEADER - VBUS_ETH_FCS;
+            break;
+    }
+    bytes += VBUS_ETH_HEADER + VBUS_ETH_FCS;
+    if (bytes < VBUS_ETH_MIN_FRAME)
+    {
+        bytes = VBUS_ETH_MIN_FRAME;
+    }
+
+    return Vbus_BitsNs(8U * (bytes + VBUS_ETH_GAP), Model->nominal_bitrate);
+}
+
+static uint64 Vbus_FrameNs(uint8 Bus, const Vbus_FrameType *Frame)
+{
+    const Vbus_ModelType *model = &Vbus_State[Bus].model;
+
+    if (Vbus_Bus[Bus].format == VBUS_ETHERNET)
+    {
+        return Vbus_EthernetFrameNs(model, Frame->kind, Frame->length);
+    }
+    return Vbus_CanFrameNs(model, Frame->length, ((Frame->flags & VBUS_PDU_FD) != 0U) ? TRUE : FALSE);
+}
+
+/**
+ * @brief Default model of a bus format
+ */
+static void Vbus_DefaultModel(uint8 Bus, Vbus_ModelType *Model)
+{
+    (void)memset(Model, 0, sizeof(*Model));
+    if (Vbus_Bus[Bus].format == VBUS_ETHERNET)
+    {
+        Model->nominal_bitrate = 100000000UL;
+        Model->data_bitrate = 100000000UL;
+        Model->latency_ns = 10000UL;
+    }
+    else
+    {
+        Model->nominal_bitrate = 500000UL;
+        Model->data_bitrate = (Vbus_Bus[Bus].format == VBUS_CANFD) ? 2000000UL : 500000UL;
+        Model->latency_ns = 1000UL;
+    }
+    Model->seed = 0x9E3779B9UL + Bus;
+}
+
+static Vbus_FrameType *Vbus_AllocFrame(void)
+{
+    if (Vbus_FreeCount == 0U)
+    {
+        return NULL_PTR;
+    }
+    Vbus_FreeCount--;
+    return &Vbus_Frames[Vbus_FreeFrames[Vbus_FreeCount]];
+}
+
+static void Vbus_FreeFrame(const Vbus_FrameType *Frame)
+{
+    Vbus_FreeFrames[Vbus_FreeCount] = (uint16)(Frame - Vbus_Frames);
+    Vbus_FreeCount++;
+}
+
+/**
+ * @brief Queue an allocated frame on its bus at the current time; frees it if the queue is full
+ */
+static Std_ReturnType Vbus_Queue(Vbus_FrameType *Frame)
+{
+    Vbus_BusStateType *state = &Vbus_State[Frame->bus];
+
+    if (state->queued >= VBUS_QUEUE_LENGTH)
+    {
+        if (Frame->kind != VBUS_FRAME_BACKGROUND)
+        {
+            state->stats.dropped++;
+        }
+        Vbus_FreeFrame(Frame);
+        return E_NOT_OK;
+    }
+    Frame->queued_ns = Vbus_Now;
+    state->queue[state->queued] = (uint16)(Frame - Vbus_Frames);
+    state->queued++;
+    if (state->queued > state->stats.max_queued)
+    {
+        state->stats.max_queued = state->queued;
+    }
+    if (Frame->source == VBUS_NODE_VCU)
+    {
+        state->vcu_pending++;
+    }
+    return E_OK;
+}
+
+/**
+ * @brief Allocate a frame of a configured PDU; NULL_PTR if the pool is empty
+ */
+static Vbus_FrameType *Vbus_PduFrame(uint8 Kind, uint16 Pdu, const Vbus_PduConfigType *Config, uint8 Source)
+{
+    Vbus_FrameType *frame = Vbus_AllocFrame();
+
+    if (frame == NULL_PTR)
+    {
+        Vbus_State[Config->bus].stats.dropped++;
+        return NULL_PTR;
+    }
+    frame->id = Config->id;
+    frame->pdu = Pdu;
+    frame->kind = Kind;
+    frame->bus = Config->bus;
+    frame->source = Source;
+    frame->destination = (Source == VBUS_NODE_VCU) ? Config->ecu : VBUS_NODE_VCU;
+    frame->flags = ((Vbus_Bus[Config->bus].format == VBUS_CANFD) || (Kind == VBUS_FRAME_ETHCOMM)) ?
+                   Config->flags : (uint8)(Config->flags & (uint8)~VBUS_PDU_FD);
+    return frame;
+}
+
+/**
+ * @brief Send a TX PDU of the VCU; a NULL SduDataPtr announces a PDU to fetch by TriggerTransmit
+ */
+static Std_ReturnType Vbus_VcuTransmit(uint8 Kind, PduIdType TxPduId, const Vbus_PduConfigType *Config,
+                                       const PduInfoType *PduInfoPtr)
+{
+    Vbus_BusStateType *state;
+    Vbus_FrameType *frame;
+    PduInfoType fetch;
+    uint32 limit;
+
+    if (PduInfoPtr == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    state = &Vbus_State[Config->bus];
+    limit = (Vbus_Bus[Config->bus].tx_buffers != 0U) ? Vbus_Bus[Config->bus].tx_buffers : VBUS_ETH_TX_BUFFERS;
+    if (state->vcu_pending >= limit)
+    {
+        state->stats.rejected++;
+        return E_NOT_OK;
+    }
+    frame = Vbus_PduFrame(Kind, (uint16)TxPduId, Config, VBUS_NODE_VCU);
+    if (frame == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    if (PduInfoPtr->SduDataPtr == NULL_PTR)
+    {
+        fetch.SduDataPtr = frame->data;
+        fetch.MetaDataPtr = NULL_PTR;
+        fetch.SduLength = (Vbus_Bus[Config->bus].format == VBUS_ETHERNET) ? VBUS_MAX_PAYLOAD : 64U;
+        if (((Kind == VBUS_FRAME_CANIF) ? PduR_CanIfTriggerTransmit(Config->upper, &fetch) :
+                                          PduR_SoAdIfTriggerTransmit(Config->upper, &fetch)) != E_OK)
+        {
+            Vbus_FreeFrame(frame);
+            return E_NOT_OK;
+        }
+        frame->length = (uint16)fetch.SduLength;
+    }
+    else
+    {
+        if ((PduInfoPtr->SduLength > VBUS_MAX_PAYLOAD) ||
+            ((Vbus_Bus[Config->bus].format != VBUS_ETHERNET) && (PduInfoPtr->SduLength > 64U)))
+        {
+            Vbus_FreeFrame(frame);
+            return E_NOT_OK;
+        }
+        frame->length = (uint16)PduInfoPtr->SduLength;
+        (void)memcpy(frame->data, PduInfoPtr->SduDataPtr, frame->length);
+    }
+
+    return Vbus_Queue(frame);
+}
+
+/**
+ * @brief Bus won by the lowest CAN ID (CAN), or the first frame queued (Ethernet); removes it from the queue
+ */
+static uint16 Vbus_Arbitrate(uint8 Bus)
+{
+    Vbus_BusStateType *state = &Vbus_State[Bus];
+    uint16 winner = 0U;
+    uint16 frame, i;
+
+    if (Vbus_Bus[Bus].format != VBUS_ETHERNET)
+    {
+        for (i = 1U; i < state->queued; i++)
+        {
+            if (Vbus_Frames[state->queue[i]].id < Vbus_Frames[state->queue[winner]].id)
+            {
+                winner = i;
+            }
+        }
+    }
+    frame = state->queue[winner];
+    state->queued--;
+    (void)memmove(&state->queue[winner], &state->queue[winner + 1U],
+                  (size_t)(state->queued - winner) * sizeof(state->queue[0]));
+
+    return frame;
+}
+
+static void Vbus_Start(uint8 Bus)
+{
+    Vbus_BusStateType *state = &Vbus_State[Bus];
+    Vbus_FrameType *frame = &Vbus_Frames[Vbus_Arbitrate(Bus)];
+    uint64 duration = Vbus_FrameNs(Bus, frame);
+
+    frame->start_ns = Vbus_Now;
+    frame->end_ns = Vbus_Now + duration;
+    state->on_bus = (uint16)(frame - Vbus_Frames);
+    state->busy_until_ns = frame->end_ns;
+    state->stats.busy_ns += duration;
+}
+
+static void Vbus_End(uint8 Bus)
+{
+    Vbus_BusStateType *state = &Vbus_State[Bus];
+    Vbus_FrameType *frame = &Vbus_Frames[state->on_bus];
+    uint64 delivery;
+    uint16 slot;
+
+    state->on_bus = VBUS_NO_FRAME;
+    if (frame->kind == VBUS_FRAME_BACKGROUND)
+    {
+        state->stats.background_frames++;
+        Vbus_FreeFrame(frame);
+        return;
+    }
+
+    state->stats.frames++;
+    delivery = Vbus_Now + state->model.latency_ns;
+    if (state->model.jitter_ns != 0U)
+    {
+        delivery += Vbus_Random(state) % (state->model.jitter_ns + 1U);
+    }
+    if (delivery < state->last_delivery_ns)
+    {
+        delivery = state->last_delivery_ns;
+    }
+    state->last_delivery_ns = delivery;
+    frame->delivered_ns = delivery;
+    slot = (uint16)((state->delivery_head + state->delivery_count) % VBUS_FRAME_COUNT);
+    state->delivery[slot] = (uint16)(frame - Vbus_Frames);
+    state->delivery_count++;
+
+    if (frame->source == VBUS_NODE_VCU)
+    {
+        state->vcu_pending--;
+        state->stats.vcu_frames++;
+        if (frame->kind == VBUS_FRAME_CANIF)
+        {
+            const Vbus_PduConfigType *config = &Vbus_CanIfTxPdu[frame->pdu];
+
+            if ((config->flags & VBUS_PDU_CANTP) != 0U)
+            {
+                CanTp_TxConfirmation(config->upper, E_OK);
+            }
+            else
+            {
+                PduR_CanIfTxConfirmation(config->upper, E_OK);
+            }
+        }
+        else if (frame->kind == VBUS_FRAME_SOAD)
+        {
+            PduR_SoAdIfTxConfirmation(Vbus_SoAdTxPdu[frame->pdu].upper, E_OK);
+        }
+        else
+        {
+            /* EthComm and raw datagrams are not confirmed */
+        }
+    }
+}
+
+static void Vbus_Deliver(uint8 Bus)
+{
+    Vbus_BusStateType *state = &Vbus_State[Bus];
+    Vbus_FrameType *frame = &Vbus_Frames[state->delivery[state->delivery_head]];
+    PduInfoType info;
+
+    state->delivery_head = (uint16)((state->delivery_head + 1U) % VBUS_FRAME_COUNT);
+    state->delivery_count--;
+
+    info.SduDataPtr = frame->data;
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = frame->length;
+    if (frame->kind == VBUS_FRAME_RAW)
+    {
+        if (frame->destination == VBUS_NODE_VCU)
+        {
+            Vbus_RawRxIndication(frame);
+        }
+        else
+        {
+            Vbus_EcuRxIndication(frame);
+        }
+    }
+    else if (frame->source == VBUS_NODE_VCU)
+    {
+        Vbus_EcuRxIndication(frame);
+    }
+    else if (frame->kind == VBUS_FRAME_CANIF)
+    {
+        const Vbus_PduConfigType *config = &Vbus_CanIfRxPdu[frame->pdu];
+
+        if ((config->flags & VBUS_PDU_CANTP) != 0U)
+        {
+            CanTp_RxIndication(config->upper, &info);
+        }
+        else
+        {
+            PduR_CanIfRxIndication(config->upper, &info);
+        }
+    }
+    else
+    {
+        PduR_SoAdIfRxIndication(Vbus_SoAdRxPdu[frame->pdu].upper, &info);
+    }
+    Vbus_FreeFrame(frame);
+}
+
+/**
+ * @brief Queue a background frame of random ID and length and draw the arrival of the next one
+ */
+static void Vbus_Background(uint8 Bus)
+{
+    Vbus_BusStateType *state = &Vbus_State[Bus];
+    Vbus_FrameType *frame = Vbus_AllocFrame();
+    uint32 r = Vbus_Random(state);
+    uint32 length;
+    uint64 mean;
+
+    if (Vbus_Bus[Bus].format == VBUS_ETHERNET)
+    {
+        length = VBUS_ETH_MIN_FRAME + (r % (VBUS_ETH_MAX_FRAME - VBUS_ETH_MIN_FRAME + 1U));
+    }
+    else if (Vbus_Bus[Bus].format == VBUS_CANFD)
+    {
+        length = 8U << ((r >> 16) % 4U);                           /* 8, 16, 32 or 64 bytes */
+    }
+    else
+    {
+        length = 8U;
+    }
+    if (frame != NULL_PTR)
+    {
+        frame->id = (r >> 20) & 0x7FFUL;
+        frame->pdu = 0U;
+        frame->length = (uint16)length;
+        frame->kind = VBUS_FRAME_BACKGROUND;
+        frame->bus = Bus;
+        frame->source = VBUS_NODE_BACKGROUND;
+        frame->destination = VBUS_NODE_BACKGROUND;
+        frame->flags = (Vbus_Bus[Bus].format == VBUS_CANFD) ? VBUS_PDU_FD : 0U;
+        (void)Vbus_Queue(frame);
+    }
+
+    /* Mean gap of one frame time per load share, drawn uniformly from 0 to twice the mean */
+    if (Vbus_Bus[Bus].format == VBUS_ETHERNET)
+    {
+        mean = Vbus_EthernetFrameNs(&state->model, VBUS_FRAME_BACKGROUND, 790U);
+    }
+    else
+    {
+        mean = Vbus_CanFrameNs(&state->model, (Vbus_Bus[Bus].format == VBUS_CANFD) ? 30U : 8U,
+                               (Vbus_Bus[Bus].format == VBUS_CANFD) ? TRUE : FALSE);
+    }
+    mean = (mean * 100U) / state->model.load_percent;
+    state->next_background_ns += 1U + (((Vbus_Random(state) % 2001U) * mean) / 1000U);
+}
+
+/**
+ * @brief Earliest event of a bus; FALSE if the bus has none
+ */
+static boolean Vbus_NextEvent(uint8 Bus, uint64 *Time, uint8 *Event)
+{
+    const Vbus_BusStateType *state = &Vbus_State[Bus];
+    boolean found = FALSE;
+
+    if (state->on_bus != VBUS_NO_FRAME)
+    {
+        *Time = state->busy_until_ns;
+        *Event = VBUS_EVENT_END;
+        found = TRUE;
+    }
+    if ((state->delivery_count != 0U) &&
+        ((found == FALSE) || (Vbus_Frames[state->delivery[state->delivery_head]].delivered_ns < *Time)))
+    {
+        *Time = Vbus_Frames[state->delivery[state->delivery_head]].delivered_ns;
+        *Event = VBUS_EVENT_DELIVERY;
+        found = TRUE;
+    }
+    if ((state->model.load_percent != 0U) && ((found == FALSE) || (state->next_background_ns < *Time)))
+    {
+        *Time = state->next_background_ns;
+        *Event = VBUS_EVENT_BACKGROUND;
+        found = TRUE;
+    }
+    if ((state->on_bus == VBUS_NO_FRAME) && (state->queued != 0U))
+    {
+        uint64 start = (state->busy_until_ns > Vbus_Now) ? state->busy_until_ns : Vbus_Now;
+
+        if ((found == FALSE) || (start < *Time))
+        {
+            *Time = start;
+            *Event = VBUS_EVENT_START;
+            found = TRUE;
+        }
+    }
+    return found;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void Vbus_Init(void)
+{
+    uint8 bus;
+    uint16 i;
+
+    Vbus_Now = 0U;
+    Vbus_EthernetBus = VBUS_NO_BUS;
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        Vbus_BusStateType *state = &Vbus_State[bus];
+
+        (void)memset(&state->stats, 0, sizeof(state->stats));
+        Vbus_DefaultModel(bus, &state->model);
+        state->busy_until_ns = 0U;
+        state->next_background_ns = 0U;
+        state->last_delivery_ns = 0U;
+        state->random = state->model.seed;
+        state->on_bus = VBUS_NO_FRAME;
+        state->queued = 0U;
+        state->delivery_head = 0U;
+        state->delivery_count = 0U;
+        state->vcu_pending = 0U;
+        if ((Vbus_Bus[bus].format == VBUS_ETHERNET) && (Vbus_EthernetBus == VBUS_NO_BUS))
+        {
+            Vbus_EthernetBus = bus;
+        }
+    }
+    for (i = 0U; i < VBUS_FRAME_COUNT; i++)
+    {
+        Vbus_FreeFrames[i] = (uint16)(VBUS_FRAME_COUNT - 1U - i);
+    }
+    Vbus_FreeCount = VBUS_FRAME_COUNT;
+}
+
+Std_ReturnType Vbus_SetModel(uint8 Bus, const Vbus_ModelType *Model)
+{
+    Vbus_BusStateType *state;
+
+    if ((Bus >= VBUS_BUS_COUNT) || (Model == NULL_PTR) || (Model->nominal_bitrate == 0U) ||
+        (Model->data_bitrate == 0U) || (Model->load_percent > VBUS_MAX_LOAD_PERCENT))
+    {
+        return E_NOT_OK;
+    }
+    state = &Vbus_State[Bus];
+    state->model = *Model;
+    state->random = (Model->seed != 0U) ? Model->seed : 1U;           /* xorshift32 never leaves 0 */
+    state->next_background_ns = Vbus_Now;
+    return E_OK;
+}
+
+const Vbus_ModelType *Vbus_GetModel(uint8 Bus)
+{
+    return (Bus < VBUS_BUS_COUNT) ? &Vbus_State[Bus].model : NULL_PTR;
+}
+
+Std_ReturnType Vbus_EcuTransmit(uint8 Kind, uint16 Pdu, const uint8 *Data, uint16 Length)
+{
+    const Vbus_PduConfigType *config;
+    Vbus_FrameType *frame;
+
+    if ((Kind == VBUS_FRAME_CANIF) && (Pdu < VBUS_CANIF_RX_PDU_COUNT))
+    {
+        config = &Vbus_CanIfRxPdu[Pdu];
+    }
+    else if ((Kind == VBUS_FRAME_SOAD) && (Pdu < VBUS_SOAD_RX_PDU_COUNT))
+    {
+        config = &Vbus_SoAdRxPdu[Pdu];
+    }
+    else
+    {
+        return E_NOT_OK;
+    }
+    if ((Data == NULL_PTR) || (Length > config->length))
+    {
+        return E_NOT_OK;
+    }
+    frame = Vbus_PduFrame(Kind, Pdu, config, config->ecu);
+    if (frame == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    frame->length = Length;
+    (void)memcpy(frame->data, Data, Length);
+
+    return Vbus_Queue(frame);
+}
+
+Std_ReturnType Vbus_RawTransmit(uint8 Source, uint8 Destination, uint16 Tag, const uint8 *Data, uint16 Length)
+{
+    Vbus_FrameType *frame;
+
+    if ((Vbus_EthernetBus == VBUS_NO_BUS) || (Data == NULL_PTR) || (Length > VBUS_MAX_PAYLOAD))
+    {
+        return E_NOT_OK;
+    }
+    if ((Source == VBUS_NODE_VCU) &&
+        (Vbus_State[Vbus_EthernetBus].vcu_pending >= VBUS_ETH_TX_BUFFERS))
+    {
+        Vbus_State[Vbus_EthernetBus].stats.rejected++;
+        return E_NOT_OK;
+    }
+    frame = Vbus_AllocFrame();
+    if (frame == NULL_PTR)
+    {
+        Vbus_State[Vbus_EthernetBus].stats.dropped++;
+        return E_NOT_OK;
+    }
+    frame->id = 0U;
+    frame->pdu = Tag;
+    frame->length = Length;
+    frame->kind = VBUS_FRAME_RAW;
+    frame->bus = Vbus_EthernetBus;
+    frame->source = Source;
+    frame->destination = Destination;
+    frame->flags = 0U;
+    (void)memcpy(frame->data, Data, Length);
+
+    return Vbus_Queue(frame);
+}
+
+void Vbus_Run(uint64 UntilNs)
+{
+    for (;;)
+    {
+        uint64 best_time = 0U;
+        uint8 best_event = 0U;
+        uint8 best_bus = VBUS_NO_BUS;
+        uint8 bus;
+
+        for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+        {
+            uint64 time;
+            uint8 event;
+
+            if ((Vbus_NextEvent(bus, &time, &event) != FALSE) &&
+                ((best_bus == VBUS_NO_BUS) || (time < best_time) ||
+                 ((time == best_time) && (event < best_event))))
+            {
+                best_time = time;
+                best_event = event;
+                best_bus = bus;
+            }
+        }
+        if ((best_bus == VBUS_NO_BUS) || (best_time > UntilNs))
+        {
+            break;
+        }
+
+        Vbus_Now = best_time;
+        switch (best_event)
+        {
+            case VBUS_EVENT_END:
+                Vbus_End(best_bus);
+                break;
+            case VBUS_EVENT_DELIVERY:
+                Vbus_Deliver(best_bus);
+                break;
+            case VBUS_EVENT_BACKGROUND:
+                Vbus_Background(best_bus);
+                break;
+            default:
+                Vbus_Start(best_bus);
+                break;
+        }
+    }
+    if (UntilNs > Vbus_Now)
+    {
+        Vbus_Now = UntilNs;
+    }
+}
+
+uint64 Vbus_GetTimeNs(void)
+{
+    return Vbus_Now;
+}
+
+uint32 Vbus_GetFrameTimeNs(uint8 Bus, uint8 Kind, uint16 Length, boolean Fd)
+{
+    if (Bus >= VBUS_BUS_COUNT)
+    {
+        return 0U;
+    }
+    if (Vbus_Bus[Bus].format == VBUS_ETHERNET)
+    {
+        return (uint32)Vbus_EthernetFrameNs(&Vbus_State[Bus].model, Kind, Length);
+    }
+    return (uint32)Vbus_CanFrameNs(&Vbus_State[Bus].model, Length, Fd);
+}
+
+Std_ReturnType Vbus_GetStatistics(uint8 Bus, Vbus_StatisticsType *Statistics)
+{
+    if ((Bus >= VBUS_BUS_COUNT) || (Statistics == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    *Statistics = Vbus_State[Bus].stats;
+    return E_OK;
+}
+
+/* -- Bus interface of the VCU -------------------------------------------------------------------- */
+
+Std_ReturnType CanIf_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    if (TxPduId >= VBUS_CANIF_TX_PDU_COUNT)
+    {
+        return E_NOT_OK;
+    }
+    return Vbus_VcuTransmit(VBUS_FRAME_CANIF, TxPduId, &Vbus_CanIfTxPdu[TxPduId], PduInfoPtr);
+}
+
+Std_ReturnType CanIf_TransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                   const PduInfoType *PduInfos, uint16 Count)
+{
+    Std_ReturnType result = E_OK;
+    uint16 i;
+
+    if ((TxPduIds == NULL_PTR) || (PduInfos == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for (i = 0U; i < Count; i++)
+    {
+        if ((TxPduIds[i] >= VBUS_CANIF_TX_PDU_COUNT) || (Vbus_CanIfTxPdu[TxPduIds[i]].bus != Controller) ||
+            (CanIf_Transmit(TxPduIds[i], &PduInfos[i]) != E_OK))
+        {
+            result = E_NOT_OK;
+        }
+    }
+    return result;
+}
+
+Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    if (TxPduId >= VBUS_SOAD_TX_PDU_COUNT)
+    {
+        return E_NOT_OK;
+    }
+    return Vbus_VcuTransmit(VBUS_FRAME_SOAD, TxPduId, &Vbus_SoAdTxPdu[TxPduId], PduInfoPtr);
+}
+
+Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                    const PduInfoType *PduInfos, uint16 Count)
+{
+    Std_ReturnType result = E_OK;
+    uint16 i;
+
+    (void)Controller;
+    if ((TxPduIds == NULL_PTR) || (PduInfos == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for (i = 0U; i < Count; i++)
+    {
+        if (SoAd_IfTransmit(TxPduIds[i], &PduInfos[i]) != E_OK)
+        {
+            result = E_NOT_OK;
+        }
+    }
+    return result;
+}
+
+Std_ReturnType EthComm_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    if ((TxPduId >= VBUS_ETHCOMM_TX_PDU_COUNT) || ((PduInfoPtr != NULL_PTR) && (PduInfoPtr->SduDataPtr == NULL_PTR)))
+    {
+        return E_NOT_OK;                                /* EthComm has no TriggerTransmit */
+    }
+    return Vbus_VcuTransmit(VBUS_FRAME_ETHCOMM, TxPduId, &Vbus_EthCommTxPdu[TxPduId], PduInfoPtr);
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
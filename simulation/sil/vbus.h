@@ -0,0 +1,332 @@
+/**
+ * @file    vbus.h
+ * @brief   Virtual Bus - In-Process CAN / CAN-FD / Ethernet Buses for Host Benchmarks
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Connects the communication stack of the VCU (Com, PduR, CanTp, SOME/IP)
+ * built for the host with simulated ECUs over discrete-event models of its
+ * buses, so the gateway can be exercised and measured without hardware:
+ *
+ * - The virtual bus takes the place of the bus interface modules below the
+ *   PduR (CanIf, EthTp as SoAd, EthComm): it implements CanIf_Transmit() /
+ *   CanIf_TransmitBatch(), SoAd_IfTransmit() / SoAd_IfTransmitBatch() and
+ *   EthComm_Transmit(), and indicates received PDUs with
+ *   PduR_CanIfRxIndication(), PduR_SoAdIfRxIndication() and
+ *   CanTp_RxIndication() and confirms sent ones with
+ *   PduR_<Lo>TxConfirmation() and CanTp_TxConfirmation(). The handles are
+ *   taken from the bus interface configuration of the VCU (vbus_cfg.c,
+ *   generated by tools/vbus/vbus_generator.py)
+ * - The simulated ECUs (Vbus_Ecu) send the PDUs the VCU receives with
+ *   Vbus_EcuTransmit(); the frames the VCU sends are passed to the
+ *   Vbus_EcuRxIndication() callout of the benchmark. Datagrams not
+ *   described by a PDU table (SOME/IP) are sent with Vbus_RawTransmit()
+ * - Time is virtual, in nanoseconds: Vbus_Run() processes the bus events
+ *   up to a point in time, the caller runs the main functions of the stack
+ *   in between. Frames are queued, arbitrated, transmitted and delivered
+ *   by the model of their bus only, so a run is deterministic and its
+ *   latencies do not depend on the host
+ *
+ * Bus model (Vbus_ModelType, per bus):
+ *
+ * | Bus      | Transmission time                                 | Access                       |
+ * |----------|---------------------------------------------------|------------------------------|
+ * | CAN      | Worst-case stuffed frame at the nominal bit rate  | Arbitration: lowest CAN ID   |
+ * | CAN-FD   | Arbitration phase at the nominal bit rate, data   | Arbitration: lowest CAN ID   |
+ * |          | phase (DLC padded, stuff bits, CRC) at data rate  |                              |
+ * | Ethernet | Frame (min. 64 bytes) + preamble + IFG            | FIFO (one switch egress)     |
+ *
+ * A frame is delivered latency_ns plus up to jitter_ns (pseudo-random)
+ * after the end of its transmission, in transmission order. Background
+ * traffic of load_percent of the bus occupies it with frames of random
+ * CAN IDs at random intervals, so the frames of the VCU lose arbitration
+ * and queue as on a loaded vehicle bus. The VCU has Vbus_Bus[].tx_buffers
+ * frames pending per CAN bus at most (the CanIf transmit buffers);
+ * CanIf_Transmit() fails when they are full.
+ *
+ * Implementation Notes:
+ * - Single-threaded: the stack is called from Vbus_Run() and calls the
+ *   virtual bus back from there; frames it sends in a callback are queued
+ *   at the current virtual time
+ * - A PduR TriggerTransmit announcement (NULL SduDataPtr) fetches the data
+ *   when the frame is queued
+ * - SoAd_IfTransmit() and EthComm_Transmit() send one Ethernet frame per
+ *   PDU: the packing of several PDUs into one datagram by EthTp and into
+ *   one ACF frame by EthComm is not modelled (bench_eth_tp.c measures it)
+ * - Not part of the target build
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see vbus.c
+ * @see vbus_cfg.h
+ * @see test/benchmark/bench_vbus_gateway.c
+ */
+
+#ifndef VBUS_H
+#define VBUS_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+#include "vbus_cfg.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def VBUS_FRAME_COUNT
+ * @brief Frames queued, on the buses or in delivery at once (all buses)
+ */
+#ifndef VBUS_FRAME_COUNT
+    #define VBUS_FRAME_COUNT                    512U
+#endif
+
+/**
+ * @def VBUS_QUEUE_LENGTH
+ * @brief Frames waiting for a bus at once, per bus; further frames are dropped
+ */
+#ifndef VBUS_QUEUE_LENGTH
+    #define VBUS_QUEUE_LENGTH                   128U
+#endif
+
+/**
+ * @def VBUS_ETH_TX_BUFFERS
+ * @brief Frames the VCU may have pending on the Ethernet bus (transmit descriptors)
+ */
+#ifndef VBUS_ETH_TX_BUFFERS
+    #define VBUS_ETH_TX_BUFFERS                 32U
+#endif
+
+#if (VBUS_QUEUE_LENGTH > VBUS_FRAME_COUNT) || (VBUS_FRAME_COUNT > 0xFFFEU)
+    #error "VBUS_QUEUE_LENGTH must not exceed VBUS_FRAME_COUNT, VBUS_FRAME_COUNT must be below 0xFFFF"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Largest payload of a frame: UDP payload of one Ethernet frame */
+#define VBUS_MAX_PAYLOAD                        1472U
+
+/* Bus formats (Vbus_BusConfigType.format) */
+#define VBUS_CAN                                0U
+#define VBUS_CANFD                              1U
+#define VBUS_ETHERNET                           2U
+
+/* Frame kinds (Vbus_FrameType.kind) */
+#define VBUS_FRAME_CANIF                        0U  /**< CanIf PDU: Vbus_CanIfRxPdu / Vbus_CanIfTxPdu */
+#define VBUS_FRAME_SOAD                         1U  /**< SoAd PDU: Vbus_SoAdRxPdu / Vbus_SoAdTxPdu */
+#define VBUS_FRAME_ETHCOMM                      2U  /**< ACF-CAN PDU: Vbus_EthCommTxPdu */
+#define VBUS_FRAME_RAW                          3U  /**< UDP datagram of Vbus_RawTransmit() */
+#define VBUS_FRAME_BACKGROUND                   4U  /**< Background load, not delivered */
+
+/* PDU flags (Vbus_PduConfigType.flags) */
+#define VBUS_PDU_FD                             0x01U   /**< CAN-FD frame with bit rate switch */
+#define VBUS_PDU_CANTP                          0x02U   /**< Indicated / confirmed to CanTp, not PduR */
+
+/* Node IDs beside the simulated ECUs (Vbus_Ecu) */
+#define VBUS_NODE_VCU                           0xFEU
+#define VBUS_NODE_BACKGROUND                    0xFDU
+
+/**
+ * @struct Vbus_BusConfigType
+ * @brief Bus of the VCU (generated)
+ */
+typedef struct
+{
+    const char *name;                   /**< CanIfCtrlCfg SHORT-NAME, or "ETH" */
+    uint8       format;                 /**< VBUS_CAN / VBUS_CANFD / VBUS_ETHERNET */
+    uint8       tx_buffers;             /**< CanIf transmit buffers of the VCU, 0 = VBUS_ETH_TX_BUFFERS */
+} Vbus_BusConfigType;
+
+/**
+ * @struct Vbus_EcuConfigType
+ * @brief Simulated ECU sending PDUs to the VCU (generated)
+ */
+typedef struct
+{
+    const char *name;
+    uint8       bus;                    /**< VbusConf_VbusBus_* */
+    uint16      pdus;                   /**< RX PDUs of the VCU the ECU sends */
+} Vbus_EcuConfigType;
+
+/**
+ * @struct Vbus_PduConfigType
+ * @brief Bus interface PDU of the VCU (generated), indexed by its CanIf / SoAd / EthComm handle
+ */
+typedef struct
+{
+    uint32    id;                       /**< CAN ID, SoAd PDU header ID or ACF-CAN ID */
+    PduIdType upper;                    /**< PduR source / destination PDU or CanTp RX / TX N-PDU */
+    uint16    length;                   /**< PduLength */
+    uint8     bus;                      /**< VbusConf_VbusBus_* */
+    uint8     ecu;                      /**< Sending ECU (RX PDUs), VBUS_NODE_VCU (TX PDUs) */
+    uint8     flags;                    /**< VBUS_PDU_* */
+} Vbus_PduConfigType;
+
+/**
+ * @struct Vbus_ModelType
+ * @brief Timing model of a bus
+ */
+typedef struct
+{
+    uint32 nominal_bitrate;             /**< CAN: arbitration bit rate, Ethernet: line rate [bit/s] */
+    uint32 data_bitrate;                /**< CAN-FD: data phase bit rate of BRS frames [bit/s] */
+    uint32 latency_ns;                  /**< Delay from end of frame to delivery (transceiver, switch) */
+    uint32 jitter_ns;                   /**< Additional pseudo-random delay, 0..jitter_ns */
+    uint8  load_percent;                /**< Background traffic, share of the bus time (0..95) */
+    uint32 seed;                        /**< Seed of the jitter and background traffic */
+} Vbus_ModelType;
+
+/**
+ * @struct Vbus_FrameType
+ * @brief Frame on a virtual bus, as passed to the callouts
+ */
+typedef struct
+{
+    uint64 queued_ns;                   /**< Handed to the bus by its sender */
+    uint64 start_ns;                    /**< Transmission started (arbitration won) */
+    uint64 end_ns;                      /**< Transmission ended (TX confirmation) */
+    uint64 delivered_ns;                /**< Delivered to the receivers */
+    uint32 id;                          /**< Arbitration ID (CAN / ACF-CAN ID), SoAd header ID */
+    uint16 pdu;                         /**< Index in the PDU table of its kind, tag of a raw frame */
+    uint16 length;
+    uint8  kind;                        /**< VBUS_FRAME_* */
+    uint8  bus;
+    uint8  source;                      /**< Sending node: VbusConf_VbusEcu_*, VBUS_NODE_VCU, raw node */
+    uint8  destination;                 /**< Raw frames: receiving node */
+    uint8  flags;                       /**< VBUS_PDU_* of its PDU */
+    uint8  data[VBUS_MAX_PAYLOAD];
+} Vbus_FrameType;
+
+/**
+ * @struct Vbus_StatisticsType
+ * @brief Traffic of one bus since Vbus_Init()
+ */
+typedef struct
+{
+    uint64 busy_ns;                     /**< Time the bus transmitted frames, background included */
+    uint32 frames;                      /**< Frames of the VCU and the ECUs transmitted */
+    uint32 vcu_frames;                  /**< Of them sent by the VCU */
+    uint32 background_frames;           /**< Background frames transmitted */
+    uint32 rejected;                    /**< Transmit requests of the VCU refused: transmit buffers full */
+    uint32 dropped;                     /**< Frames dropped: bus queue or frame pool full */
+    uint16 max_queued;                  /**< Most frames waiting for the bus at once */
+} Vbus_StatisticsType;
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+extern const Vbus_BusConfigType Vbus_Bus[VBUS_BUS_COUNT];
+extern const Vbus_EcuConfigType Vbus_Ecu[VBUS_ECU_COUNT];
+extern const Vbus_PduConfigType Vbus_CanIfRxPdu[VBUS_CANIF_RX_PDU_COUNT];
+extern const Vbus_PduConfigType Vbus_CanIfTxPdu[VBUS_CANIF_TX_PDU_COUNT];
+extern const Vbus_PduConfigType Vbus_SoAdRxPdu[VBUS_SOAD_RX_PDU_COUNT];
+extern const Vbus_PduConfigType Vbus_SoAdTxPdu[VBUS_SOAD_TX_PDU_COUNT];
+extern const Vbus_PduConfigType Vbus_EthCommTxPdu[VBUS_ETHCOMM_TX_PDU_COUNT];
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Empty all buses, reset virtual time to 0 and the models to their defaults
+ * @details Defaults: CAN 500 kbit/s, CAN-FD 500 kbit/s / 2 Mbit/s, Ethernet 100 Mbit/s; 1 us
+ *          latency on CAN and 10 us on Ethernet, no jitter and no background load.
+ */
+extern void Vbus_Init(void);
+
+/**
+ * @brief Replace the model of a bus
+ * @return E_OK, or E_NOT_OK on an invalid bus or model (bit rate 0, load above 95 %)
+ */
+extern Std_ReturnType Vbus_SetModel(uint8 Bus, const Vbus_ModelType *Model);
+
+/**
+ * @brief Model of a bus
+ */
+extern const Vbus_ModelType *Vbus_GetModel(uint8 Bus);
+
+/**
+ * @brief Send an RX PDU of the VCU from its simulated ECU
+ * @param[in] Kind   VBUS_FRAME_CANIF (Vbus_CanIfRxPdu) or VBUS_FRAME_SOAD (Vbus_SoAdRxPdu)
+ * @param[in] Pdu    CanIfRxPduId / SoAdRxPduId
+ * @param[in] Data   Payload
+ * @param[in] Length Payload length, at most the PduLength
+ * @return E_OK, or E_NOT_OK if the PDU does not exist or the bus queue is full
+ */
+extern Std_ReturnType Vbus_EcuTransmit(uint8 Kind, uint16 Pdu, const uint8 *Data, uint16 Length);
+
+/**
+ * @brief Send a UDP datagram over the Ethernet bus
+ * @param[in] Source      Sending node (VBUS_NODE_VCU or a node ID of the caller)
+ * @param[in] Destination Receiving node
+ * @param[in] Tag         Passed to the receiver in Vbus_FrameType.pdu (e.g. the socket)
+ * @return E_OK, or E_NOT_OK if there is no Ethernet bus, Length exceeds VBUS_MAX_PAYLOAD or the
+ *         bus queue is full
+ * @note A datagram to VBUS_NODE_VCU is passed to Vbus_RawRxIndication(), any other to
+ *       Vbus_EcuRxIndication()
+ */
+extern Std_ReturnType Vbus_RawTransmit(uint8 Source, uint8 Destination, uint16 Tag,
+                                       const uint8 *Data, uint16 Length);
+
+/**
+ * @brief Process the bus events up to UntilNs and advance the virtual time to it
+ */
+extern void Vbus_Run(uint64 UntilNs);
+
+/**
+ * @brief Current virtual time in nanoseconds
+ */
+extern uint64 Vbus_GetTimeNs(void);
+
+/**
+ * @brief Transmission time of a frame of Length payload bytes on a bus with its current model
+ */
+extern uint32 Vbus_GetFrameTimeNs(uint8 Bus, uint8 Kind, uint16 Length, boolean Fd);
+
+/**
+ * @brief Copy the traffic statistics of a bus
+ * @return E_OK, or E_NOT_OK on an invalid bus or a NULL pointer
+ */
+extern Std_ReturnType Vbus_GetStatistics(uint8 Bus, Vbus_StatisticsType *Statistics);
+
+/* -- Callouts, implemented by the user of the virtual bus -------------------------------------- */
+
+/**
+ * @brief A frame of the VCU, or a raw datagram to a node other than the VCU, was delivered
+ * @note The frame is valid during the call only
+ */
+extern void Vbus_EcuRxIndication(const Vbus_FrameType *Frame);
+
+/**
+ * @brief A raw datagram to VBUS_NODE_VCU was delivered
+ * @note The frame is valid during the call only
+ */
+extern void Vbus_RawRxIndication(const Vbus_FrameType *Frame);
+
+/* -- Bus interface of the VCU (lower modules of the PduR and CanTp) ---------------------------- */
+
+extern Std_ReturnType CanIf_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr);
+extern Std_ReturnType CanIf_TransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                          const PduInfoType *PduInfos, uint16 Count);
+extern Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr);
+extern Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                           const PduInfoType *PduInfos, uint16 Count);
+extern Std_ReturnType EthComm_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr);
+
+#endif /* VBUS_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,514 @@
+/**
+ * @file    vbus_cfg.c
+ * @brief   Vbus Configuration - Bus, ECU and PDU Tables
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static configuration of the virtual bus: the buses, the simulated ECUs and
+ * the bus interface PDUs of the VCU with the PduR and CanTp handles the
+ * virtual bus indicates and confirms them with.
+ *
+ * @note Generated by tools/vbus/vbus_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "vbus.h"
+#include "pdu_router.h"
+#include "can_tp.h"
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const Vbus_BusConfigType Vbus_Bus[VBUS_BUS_COUNT] =
+{
+    { "CAN_PT", VBUS_CANFD,    8U },  /* 0 */
+    { "CAN_CH", VBUS_CANFD,    8U },  /* 1 */
+    { "CAN_BD", VBUS_CANFD,    8U },  /* 2 */
+    { "ETH",    VBUS_ETHERNET, 0U }   /* 3 */
+};
+
+const Vbus_EcuConfigType Vbus_Ecu[VBUS_ECU_COUNT] =
+{
+    { "BMS",      VbusConf_VbusBus_CAN_PT,   5U },  /* 0 */
+    { "MCU",      VbusConf_VbusBus_CAN_PT,   1U },  /* 1 */
+    { "OBC",      VbusConf_VbusBus_CAN_PT,   1U },  /* 2 */
+    { "DCDC",     VbusConf_VbusBus_CAN_PT,   1U },  /* 3 */
+    { "GwPt",     VbusConf_VbusBus_CAN_PT,  64U },  /* 4 */
+    { "UDS_PT",   VbusConf_VbusBus_CAN_PT,   2U },  /* 5 */
+    { "ESP",      VbusConf_VbusBus_CAN_CH,   2U },  /* 6 */
+    { "SAS",      VbusConf_VbusBus_CAN_CH,   1U },  /* 7 */
+    { "APS",      VbusConf_VbusBus_CAN_CH,   1U },  /* 8 */
+    { "GwCh",     VbusConf_VbusBus_CAN_CH,  48U },  /* 9 */
+    { "UDS_CH",   VbusConf_VbusBus_CAN_CH,   1U },  /* 10 */
+    { "GW",       VbusConf_VbusBus_CAN_BD,   1U },  /* 11 */
+    { "GwBd",     VbusConf_VbusBus_CAN_BD,  40U },  /* 12 */
+    { "UDS_BD",   VbusConf_VbusBus_CAN_BD,   1U },  /* 13 */
+    { "Hpc",      VbusConf_VbusBus_ETH,     28U },  /* 14 */
+    { "ZoneBody", VbusConf_VbusBus_ETH,     12U }   /* 15 */
+};
+
+const Vbus_PduConfigType Vbus_CanIfRxPdu[VBUS_CANIF_RX_PDU_COUNT] =
+{
+    { 0x00000110UL, PduRConf_PduRSrcPdu_BMS_PackStatus,     32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_BMS, VBUS_PDU_FD },  /* 0 BMS_PackStatus */
+    { 0x00000111UL, PduRConf_PduRSrcPdu_BMS_CellVoltages1,  64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_BMS, VBUS_PDU_FD },  /* 1 BMS_CellVoltages1 */
+    { 0x00000112UL, PduRConf_PduRSrcPdu_BMS_CellVoltages2,  64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_BMS, VBUS_PDU_FD },  /* 2 BMS_CellVoltages2 */
+    { 0x00000113UL, PduRConf_PduRSrcPdu_BMS_CellVoltages3,  64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_BMS, VBUS_PDU_FD },  /* 3 BMS_CellVoltages3 */
+    { 0x00000114UL, PduRConf_PduRSrcPdu_BMS_CellTemps,      64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_BMS, VBUS_PDU_FD },  /* 4 BMS_CellTemps */
+    { 0x00000120UL, PduRConf_PduRSrcPdu_MCU_Status,         24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_MCU, VBUS_PDU_FD },  /* 5 MCU_Status */
+    { 0x000000A0UL, PduRConf_PduRSrcPdu_ESP_WheelSpeeds,     8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_ESP, VBUS_PDU_FD },  /* 6 ESP_WheelSpeeds */
+    { 0x000000A1UL, PduRConf_PduRSrcPdu_ESP_Dynamics,        8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_ESP, VBUS_PDU_FD },  /* 7 ESP_Dynamics */
+    { 0x000000B0UL, PduRConf_PduRSrcPdu_SAS_Steering,        8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_SAS, VBUS_PDU_FD },  /* 8 SAS_Steering */
+    { 0x000000C0UL, PduRConf_PduRSrcPdu_APS_Pedals,          8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_APS, VBUS_PDU_FD },  /* 9 APS_Pedals */
+    { 0x000003A0UL, PduRConf_PduRSrcPdu_GW_VehicleInfo,     16U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GW, VBUS_PDU_FD },  /* 10 GW_VehicleInfo */
+    { 0x00000140UL, PduRConf_PduRSrcPdu_OBC_Status,         16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_OBC, VBUS_PDU_FD },  /* 11 OBC_Status */
+    { 0x00000150UL, PduRConf_PduRSrcPdu_DCDC_Status,         8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_DCDC, VBUS_PDU_FD },  /* 12 DCDC_Status */
+    { 0x00000200UL, PduRConf_PduRSrcPdu_GwPt_200,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 13 GwPt_200 */
+    { 0x00000201UL, PduRConf_PduRSrcPdu_GwPt_201,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 14 GwPt_201 */
+    { 0x00000202UL, PduRConf_PduRSrcPdu_GwPt_202,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 15 GwPt_202 */
+    { 0x00000203UL, PduRConf_PduRSrcPdu_GwPt_203,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 16 GwPt_203 */
+    { 0x00000204UL, PduRConf_PduRSrcPdu_GwPt_204,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 17 GwPt_204 */
+    { 0x00000205UL, PduRConf_PduRSrcPdu_GwPt_205,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 18 GwPt_205 */
+    { 0x00000206UL, PduRConf_PduRSrcPdu_GwPt_206,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 19 GwPt_206 */
+    { 0x00000207UL, PduRConf_PduRSrcPdu_GwPt_207,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 20 GwPt_207 */
+    { 0x00000208UL, PduRConf_PduRSrcPdu_GwPt_208,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 21 GwPt_208 */
+    { 0x00000209UL, PduRConf_PduRSrcPdu_GwPt_209,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 22 GwPt_209 */
+    { 0x0000020AUL, PduRConf_PduRSrcPdu_GwPt_20A,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 23 GwPt_20A */
+    { 0x0000020BUL, PduRConf_PduRSrcPdu_GwPt_20B,           48U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 24 GwPt_20B */
+    { 0x0000020CUL, PduRConf_PduRSrcPdu_GwPt_20C,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 25 GwPt_20C */
+    { 0x0000020DUL, PduRConf_PduRSrcPdu_GwPt_20D,           12U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 26 GwPt_20D */
+    { 0x0000020EUL, PduRConf_PduRSrcPdu_GwPt_20E,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 27 GwPt_20E */
+    { 0x0000020FUL, PduRConf_PduRSrcPdu_GwPt_20F,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 28 GwPt_20F */
+    { 0x00000210UL, PduRConf_PduRSrcPdu_GwPt_210,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 29 GwPt_210 */
+    { 0x00000211UL, PduRConf_PduRSrcPdu_GwPt_211,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 30 GwPt_211 */
+    { 0x00000212UL, PduRConf_PduRSrcPdu_GwPt_212,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 31 GwPt_212 */
+    { 0x00000213UL, PduRConf_PduRSrcPdu_GwPt_213,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 32 GwPt_213 */
+    { 0x00000214UL, PduRConf_PduRSrcPdu_GwPt_214,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 33 GwPt_214 */
+    { 0x00000215UL, PduRConf_PduRSrcPdu_GwPt_215,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 34 GwPt_215 */
+    { 0x00000216UL, PduRConf_PduRSrcPdu_GwPt_216,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 35 GwPt_216 */
+    { 0x00000217UL, PduRConf_PduRSrcPdu_GwPt_217,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 36 GwPt_217 */
+    { 0x00000218UL, PduRConf_PduRSrcPdu_GwPt_218,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 37 GwPt_218 */
+    { 0x00000219UL, PduRConf_PduRSrcPdu_GwPt_219,           48U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 38 GwPt_219 */
+    { 0x0000021AUL, PduRConf_PduRSrcPdu_GwPt_21A,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 39 GwPt_21A */
+    { 0x0000021BUL, PduRConf_PduRSrcPdu_GwPt_21B,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 40 GwPt_21B */
+    { 0x0000021CUL, PduRConf_PduRSrcPdu_GwPt_21C,           48U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 41 GwPt_21C */
+    { 0x0000021DUL, PduRConf_PduRSrcPdu_GwPt_21D,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 42 GwPt_21D */
+    { 0x0000021EUL, PduRConf_PduRSrcPdu_GwPt_21E,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 43 GwPt_21E */
+    { 0x0000021FUL, PduRConf_PduRSrcPdu_GwPt_21F,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 44 GwPt_21F */
+    { 0x00000220UL, PduRConf_PduRSrcPdu_GwPt_220,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 45 GwPt_220 */
+    { 0x00000221UL, PduRConf_PduRSrcPdu_GwPt_221,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 46 GwPt_221 */
+    { 0x00000222UL, PduRConf_PduRSrcPdu_GwPt_222,           48U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 47 GwPt_222 */
+    { 0x00000223UL, PduRConf_PduRSrcPdu_GwPt_223,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 48 GwPt_223 */
+    { 0x00000224UL, PduRConf_PduRSrcPdu_GwPt_224,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 49 GwPt_224 */
+    { 0x00000225UL, PduRConf_PduRSrcPdu_GwPt_225,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 50 GwPt_225 */
+    { 0x00000226UL, PduRConf_PduRSrcPdu_GwPt_226,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 51 GwPt_226 */
+    { 0x00000227UL, PduRConf_PduRSrcPdu_GwPt_227,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 52 GwPt_227 */
+    { 0x00000228UL, PduRConf_PduRSrcPdu_GwPt_228,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 53 GwPt_228 */
+    { 0x00000229UL, PduRConf_PduRSrcPdu_GwPt_229,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 54 GwPt_229 */
+    { 0x0000022AUL, PduRConf_PduRSrcPdu_GwPt_22A,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 55 GwPt_22A */
+    { 0x0000022BUL, PduRConf_PduRSrcPdu_GwPt_22B,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 56 GwPt_22B */
+    { 0x0000022CUL, PduRConf_PduRSrcPdu_GwPt_22C,           48U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 57 GwPt_22C */
+    { 0x0000022DUL, PduRConf_PduRSrcPdu_GwPt_22D,           12U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 58 GwPt_22D */
+    { 0x0000022EUL, PduRConf_PduRSrcPdu_GwPt_22E,           64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 59 GwPt_22E */
+    { 0x0000022FUL, PduRConf_PduRSrcPdu_GwPt_22F,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 60 GwPt_22F */
+    { 0x00000230UL, PduRConf_PduRSrcPdu_GwPt_230,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 61 GwPt_230 */
+    { 0x00000231UL, PduRConf_PduRSrcPdu_GwPt_231,           12U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 62 GwPt_231 */
+    { 0x00000232UL, PduRConf_PduRSrcPdu_GwPt_232,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 63 GwPt_232 */
+    { 0x00000233UL, PduRConf_PduRSrcPdu_GwPt_233,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 64 GwPt_233 */
+    { 0x00000234UL, PduRConf_PduRSrcPdu_GwPt_234,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 65 GwPt_234 */
+    { 0x00000235UL, PduRConf_PduRSrcPdu_GwPt_235,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 66 GwPt_235 */
+    { 0x00000236UL, PduRConf_PduRSrcPdu_GwPt_236,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 67 GwPt_236 */
+    { 0x00000237UL, PduRConf_PduRSrcPdu_GwPt_237,           16U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 68 GwPt_237 */
+    { 0x00000238UL, PduRConf_PduRSrcPdu_GwPt_238,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 69 GwPt_238 */
+    { 0x00000239UL, PduRConf_PduRSrcPdu_GwPt_239,           32U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 70 GwPt_239 */
+    { 0x0000023AUL, PduRConf_PduRSrcPdu_GwPt_23A,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 71 GwPt_23A */
+    { 0x0000023BUL, PduRConf_PduRSrcPdu_GwPt_23B,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 72 GwPt_23B */
+    { 0x0000023CUL, PduRConf_PduRSrcPdu_GwPt_23C,           20U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 73 GwPt_23C */
+    { 0x0000023DUL, PduRConf_PduRSrcPdu_GwPt_23D,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 74 GwPt_23D */
+    { 0x0000023EUL, PduRConf_PduRSrcPdu_GwPt_23E,           24U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 75 GwPt_23E */
+    { 0x0000023FUL, PduRConf_PduRSrcPdu_GwPt_23F,            8U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_GwPt, VBUS_PDU_FD },  /* 76 GwPt_23F */
+    { 0x00000280UL, PduRConf_PduRSrcPdu_GwCh_280,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 77 GwCh_280 */
+    { 0x00000281UL, PduRConf_PduRSrcPdu_GwCh_281,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 78 GwCh_281 */
+    { 0x00000282UL, PduRConf_PduRSrcPdu_GwCh_282,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 79 GwCh_282 */
+    { 0x00000283UL, PduRConf_PduRSrcPdu_GwCh_283,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 80 GwCh_283 */
+    { 0x00000284UL, PduRConf_PduRSrcPdu_GwCh_284,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 81 GwCh_284 */
+    { 0x00000285UL, PduRConf_PduRSrcPdu_GwCh_285,           64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 82 GwCh_285 */
+    { 0x00000286UL, PduRConf_PduRSrcPdu_GwCh_286,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 83 GwCh_286 */
+    { 0x00000287UL, PduRConf_PduRSrcPdu_GwCh_287,           64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 84 GwCh_287 */
+    { 0x00000288UL, PduRConf_PduRSrcPdu_GwCh_288,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 85 GwCh_288 */
+    { 0x00000289UL, PduRConf_PduRSrcPdu_GwCh_289,           24U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 86 GwCh_289 */
+    { 0x0000028AUL, PduRConf_PduRSrcPdu_GwCh_28A,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 87 GwCh_28A */
+    { 0x0000028BUL, PduRConf_PduRSrcPdu_GwCh_28B,           48U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 88 GwCh_28B */
+    { 0x0000028CUL, PduRConf_PduRSrcPdu_GwCh_28C,           48U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 89 GwCh_28C */
+    { 0x0000028DUL, PduRConf_PduRSrcPdu_GwCh_28D,           64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 90 GwCh_28D */
+    { 0x0000028EUL, PduRConf_PduRSrcPdu_GwCh_28E,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 91 GwCh_28E */
+    { 0x0000028FUL, PduRConf_PduRSrcPdu_GwCh_28F,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 92 GwCh_28F */
+    { 0x00000290UL, PduRConf_PduRSrcPdu_GwCh_290,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 93 GwCh_290 */
+    { 0x00000291UL, PduRConf_PduRSrcPdu_GwCh_291,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 94 GwCh_291 */
+    { 0x00000292UL, PduRConf_PduRSrcPdu_GwCh_292,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 95 GwCh_292 */
+    { 0x00000293UL, PduRConf_PduRSrcPdu_GwCh_293,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 96 GwCh_293 */
+    { 0x00000294UL, PduRConf_PduRSrcPdu_GwCh_294,           32U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 97 GwCh_294 */
+    { 0x00000295UL, PduRConf_PduRSrcPdu_GwCh_295,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 98 GwCh_295 */
+    { 0x00000296UL, PduRConf_PduRSrcPdu_GwCh_296,           20U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 99 GwCh_296 */
+    { 0x00000297UL, PduRConf_PduRSrcPdu_GwCh_297,           64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 100 GwCh_297 */
+    { 0x00000298UL, PduRConf_PduRSrcPdu_GwCh_298,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 101 GwCh_298 */
+    { 0x00000299UL, PduRConf_PduRSrcPdu_GwCh_299,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 102 GwCh_299 */
+    { 0x0000029AUL, PduRConf_PduRSrcPdu_GwCh_29A,           20U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 103 GwCh_29A */
+    { 0x0000029BUL, PduRConf_PduRSrcPdu_GwCh_29B,           32U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 104 GwCh_29B */
+    { 0x0000029CUL, PduRConf_PduRSrcPdu_GwCh_29C,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 105 GwCh_29C */
+    { 0x0000029DUL, PduRConf_PduRSrcPdu_GwCh_29D,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 106 GwCh_29D */
+    { 0x0000029EUL, PduRConf_PduRSrcPdu_GwCh_29E,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 107 GwCh_29E */
+    { 0x0000029FUL, PduRConf_PduRSrcPdu_GwCh_29F,           48U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 108 GwCh_29F */
+    { 0x000002A0UL, PduRConf_PduRSrcPdu_GwCh_2A0,           12U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 109 GwCh_2A0 */
+    { 0x000002A1UL, PduRConf_PduRSrcPdu_GwCh_2A1,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 110 GwCh_2A1 */
+    { 0x000002A2UL, PduRConf_PduRSrcPdu_GwCh_2A2,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 111 GwCh_2A2 */
+    { 0x000002A3UL, PduRConf_PduRSrcPdu_GwCh_2A3,           24U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 112 GwCh_2A3 */
+    { 0x000002A4UL, PduRConf_PduRSrcPdu_GwCh_2A4,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 113 GwCh_2A4 */
+    { 0x000002A5UL, PduRConf_PduRSrcPdu_GwCh_2A5,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 114 GwCh_2A5 */
+    { 0x000002A6UL, PduRConf_PduRSrcPdu_GwCh_2A6,           32U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 115 GwCh_2A6 */
+    { 0x000002A7UL, PduRConf_PduRSrcPdu_GwCh_2A7,           48U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 116 GwCh_2A7 */
+    { 0x000002A8UL, PduRConf_PduRSrcPdu_GwCh_2A8,           24U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 117 GwCh_2A8 */
+    { 0x000002A9UL, PduRConf_PduRSrcPdu_GwCh_2A9,           48U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 118 GwCh_2A9 */
+    { 0x000002AAUL, PduRConf_PduRSrcPdu_GwCh_2AA,           16U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 119 GwCh_2AA */
+    { 0x000002ABUL, PduRConf_PduRSrcPdu_GwCh_2AB,           12U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 120 GwCh_2AB */
+    { 0x000002ACUL, PduRConf_PduRSrcPdu_GwCh_2AC,           24U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 121 GwCh_2AC */
+    { 0x000002ADUL, PduRConf_PduRSrcPdu_GwCh_2AD,           64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 122 GwCh_2AD */
+    { 0x000002AEUL, PduRConf_PduRSrcPdu_GwCh_2AE,            8U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 123 GwCh_2AE */
+    { 0x000002AFUL, PduRConf_PduRSrcPdu_GwCh_2AF,           24U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_GwCh, VBUS_PDU_FD },  /* 124 GwCh_2AF */
+    { 0x00000400UL, PduRConf_PduRSrcPdu_GwBd_400,           24U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 125 GwBd_400 */
+    { 0x00000401UL, PduRConf_PduRSrcPdu_GwBd_401,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 126 GwBd_401 */
+    { 0x00000402UL, PduRConf_PduRSrcPdu_GwBd_402,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 127 GwBd_402 */
+    { 0x00000403UL, PduRConf_PduRSrcPdu_GwBd_403,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 128 GwBd_403 */
+    { 0x00000404UL, PduRConf_PduRSrcPdu_GwBd_404,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 129 GwBd_404 */
+    { 0x00000405UL, PduRConf_PduRSrcPdu_GwBd_405,           64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 130 GwBd_405 */
+    { 0x00000406UL, PduRConf_PduRSrcPdu_GwBd_406,           64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 131 GwBd_406 */
+    { 0x00000407UL, PduRConf_PduRSrcPdu_GwBd_407,           16U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 132 GwBd_407 */
+    { 0x00000408UL, PduRConf_PduRSrcPdu_GwBd_408,           64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 133 GwBd_408 */
+    { 0x00000409UL, PduRConf_PduRSrcPdu_GwBd_409,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 134 GwBd_409 */
+    { 0x0000040AUL, PduRConf_PduRSrcPdu_GwBd_40A,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 135 GwBd_40A */
+    { 0x0000040BUL, PduRConf_PduRSrcPdu_GwBd_40B,           24U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 136 GwBd_40B */
+    { 0x0000040CUL, PduRConf_PduRSrcPdu_GwBd_40C,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 137 GwBd_40C */
+    { 0x0000040DUL, PduRConf_PduRSrcPdu_GwBd_40D,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 138 GwBd_40D */
+    { 0x0000040EUL, PduRConf_PduRSrcPdu_GwBd_40E,           32U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 139 GwBd_40E */
+    { 0x0000040FUL, PduRConf_PduRSrcPdu_GwBd_40F,           64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 140 GwBd_40F */
+    { 0x00000410UL, PduRConf_PduRSrcPdu_GwBd_410,           32U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 141 GwBd_410 */
+    { 0x00000411UL, PduRConf_PduRSrcPdu_GwBd_411,           16U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 142 GwBd_411 */
+    { 0x00000412UL, PduRConf_PduRSrcPdu_GwBd_412,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 143 GwBd_412 */
+    { 0x00000413UL, PduRConf_PduRSrcPdu_GwBd_413,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 144 GwBd_413 */
+    { 0x00000414UL, PduRConf_PduRSrcPdu_GwBd_414,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 145 GwBd_414 */
+    { 0x00000415UL, PduRConf_PduRSrcPdu_GwBd_415,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 146 GwBd_415 */
+    { 0x00000416UL, PduRConf_PduRSrcPdu_GwBd_416,           16U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 147 GwBd_416 */
+    { 0x00000417UL, PduRConf_PduRSrcPdu_GwBd_417,           16U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 148 GwBd_417 */
+    { 0x00000418UL, PduRConf_PduRSrcPdu_GwBd_418,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 149 GwBd_418 */
+    { 0x00000419UL, PduRConf_PduRSrcPdu_GwBd_419,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 150 GwBd_419 */
+    { 0x0000041AUL, PduRConf_PduRSrcPdu_GwBd_41A,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 151 GwBd_41A */
+    { 0x0000041BUL, PduRConf_PduRSrcPdu_GwBd_41B,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 152 GwBd_41B */
+    { 0x0000041CUL, PduRConf_PduRSrcPdu_GwBd_41C,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 153 GwBd_41C */
+    { 0x0000041DUL, PduRConf_PduRSrcPdu_GwBd_41D,           32U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 154 GwBd_41D */
+    { 0x0000041EUL, PduRConf_PduRSrcPdu_GwBd_41E,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 155 GwBd_41E */
+    { 0x0000041FUL, PduRConf_PduRSrcPdu_GwBd_41F,           48U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 156 GwBd_41F */
+    { 0x00000420UL, PduRConf_PduRSrcPdu_GwBd_420,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 157 GwBd_420 */
+    { 0x00000421UL, PduRConf_PduRSrcPdu_GwBd_421,           48U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 158 GwBd_421 */
+    { 0x00000422UL, PduRConf_PduRSrcPdu_GwBd_422,           48U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 159 GwBd_422 */
+    { 0x00000423UL, PduRConf_PduRSrcPdu_GwBd_423,           12U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 160 GwBd_423 */
+    { 0x00000424UL, PduRConf_PduRSrcPdu_GwBd_424,           32U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 161 GwBd_424 */
+    { 0x00000425UL, PduRConf_PduRSrcPdu_GwBd_425,            8U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 162 GwBd_425 */
+    { 0x00000426UL, PduRConf_PduRSrcPdu_GwBd_426,           20U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 163 GwBd_426 */
+    { 0x00000427UL, PduRConf_PduRSrcPdu_GwBd_427,           64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_GwBd, VBUS_PDU_FD },  /* 164 GwBd_427 */
+    { 0x000007E0UL, CanTpConf_CanTpRxNPdu_UDS_PT_Req_N,     64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_UDS_PT, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 165 UDS_PT_Req_N */
+    { 0x000007E1UL, CanTpConf_CanTpRxNPdu_UDS_CH_Req_N,     64U, VbusConf_VbusBus_CAN_CH, VbusConf_VbusEcu_UDS_CH, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 166 UDS_CH_Req_N */
+    { 0x000007E2UL, CanTpConf_CanTpRxNPdu_UDS_BD_Req_N,     64U, VbusConf_VbusBus_CAN_BD, VbusConf_VbusEcu_UDS_BD, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 167 UDS_BD_Req_N */
+    { 0x000007DFUL, CanTpConf_CanTpRxNPdu_UDS_FuncReq_N,    64U, VbusConf_VbusBus_CAN_PT, VbusConf_VbusEcu_UDS_PT, VBUS_PDU_FD | VBUS_PDU_CANTP }   /* 168 UDS_FuncReq_N */
+};
+
+const Vbus_PduConfigType Vbus_CanIfTxPdu[VBUS_CANIF_TX_PDU_COUNT] =
+{
+    { 0x000000A0UL, PduRConf_PduRDestPdu_ESP_WheelSpeeds_BD,            8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 0 ESP_WheelSpeeds_BD */
+    { 0x00000101UL, PduRConf_PduRDestPdu_VCU_TorqueRequest_CanIf,      16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 1 VCU_TorqueRequest */
+    { 0x00000102UL, PduRConf_PduRDestPdu_VCU_Status_CanIf,             32U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 2 VCU_Status */
+    { 0x00000103UL, PduRConf_PduRDestPdu_VCU_PowertrainData_CanIf,     64U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 3 VCU_PowertrainData */
+    { 0x00000104UL, PduRConf_PduRDestPdu_VCU_PowertrainDataMot_CanIf,  64U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 4 VCU_PowertrainDataMot */
+    { 0x00000105UL, PduRConf_PduRDestPdu_VCU_ChargeControl_CanIf,      16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 5 VCU_ChargeControl */
+    { 0x00000106UL, PduRConf_PduRDestPdu_VCU_ThermalRequest_CanIf,      8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 6 VCU_ThermalRequest */
+    { 0x00000107UL, PduRConf_PduRDestPdu_VCU_DcdcControl_CanIf,         8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 7 VCU_DcdcControl */
+    { 0x00000200UL, PduRConf_PduRDestPdu_GwPt_200_CH,                   8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 8 GwPt_200_CH */
+    { 0x00000208UL, PduRConf_PduRDestPdu_GwPt_208_CH,                  24U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 9 GwPt_208_CH */
+    { 0x00000210UL, PduRConf_PduRDestPdu_GwPt_210_CH,                   8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 10 GwPt_210_CH */
+    { 0x00000218UL, PduRConf_PduRDestPdu_GwPt_218_CH,                   8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 11 GwPt_218_CH */
+    { 0x00000220UL, PduRConf_PduRDestPdu_GwPt_220_CH,                  64U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 12 GwPt_220_CH */
+    { 0x00000228UL, PduRConf_PduRDestPdu_GwPt_228_CH,                  20U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 13 GwPt_228_CH */
+    { 0x00000230UL, PduRConf_PduRDestPdu_GwPt_230_CH,                  24U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 14 GwPt_230_CH */
+    { 0x00000238UL, PduRConf_PduRDestPdu_GwPt_238_CH,                  32U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 15 GwPt_238_CH */
+    { 0x00000280UL, PduRConf_PduRDestPdu_GwCh_280_PT,                  16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 16 GwCh_280_PT */
+    { 0x00000288UL, PduRConf_PduRDestPdu_GwCh_288_PT,                   8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 17 GwCh_288_PT */
+    { 0x00000290UL, PduRConf_PduRDestPdu_GwCh_290_PT,                  16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 18 GwCh_290_PT */
+    { 0x00000298UL, PduRConf_PduRDestPdu_GwCh_298_PT,                   8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 19 GwCh_298_PT */
+    { 0x000002A0UL, PduRConf_PduRDestPdu_GwCh_2A0_PT,                  12U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 20 GwCh_2A0_PT */
+    { 0x000002A8UL, PduRConf_PduRDestPdu_GwCh_2A8_PT,                  24U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 21 GwCh_2A8_PT */
+    { 0x00000500UL, PduRConf_PduRDestPdu_GwEth_PT_500_Can,             16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 22 GwEth_PT_500_Can */
+    { 0x00000501UL, PduRConf_PduRDestPdu_GwEth_PT_501_Can,             12U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 23 GwEth_PT_501_Can */
+    { 0x00000502UL, PduRConf_PduRDestPdu_GwEth_PT_502_Can,             24U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 24 GwEth_PT_502_Can */
+    { 0x00000503UL, PduRConf_PduRDestPdu_GwEth_PT_503_Can,              8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 25 GwEth_PT_503_Can */
+    { 0x00000504UL, PduRConf_PduRDestPdu_GwEth_PT_504_Can,             64U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 26 GwEth_PT_504_Can */
+    { 0x00000505UL, PduRConf_PduRDestPdu_GwEth_PT_505_Can,             12U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 27 GwEth_PT_505_Can */
+    { 0x00000506UL, PduRConf_PduRDestPdu_GwEth_PT_506_Can,              8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 28 GwEth_PT_506_Can */
+    { 0x00000507UL, PduRConf_PduRDestPdu_GwEth_PT_507_Can,              8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 29 GwEth_PT_507_Can */
+    { 0x00000508UL, PduRConf_PduRDestPdu_GwEth_PT_508_Can,             16U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 30 GwEth_PT_508_Can */
+    { 0x00000509UL, PduRConf_PduRDestPdu_GwEth_PT_509_Can,              8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 31 GwEth_PT_509_Can */
+    { 0x0000050AUL, PduRConf_PduRDestPdu_GwEth_PT_50A_Can,             64U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 32 GwEth_PT_50A_Can */
+    { 0x0000050BUL, PduRConf_PduRDestPdu_GwEth_PT_50B_Can,             32U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 33 GwEth_PT_50B_Can */
+    { 0x0000050CUL, PduRConf_PduRDestPdu_GwEth_PT_50C_Can,             32U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 34 GwEth_PT_50C_Can */
+    { 0x0000050DUL, PduRConf_PduRDestPdu_GwEth_PT_50D_Can,             24U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 35 GwEth_PT_50D_Can */
+    { 0x0000050EUL, PduRConf_PduRDestPdu_GwEth_PT_50E_Can,              8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 36 GwEth_PT_50E_Can */
+    { 0x0000050FUL, PduRConf_PduRDestPdu_GwEth_PT_50F_Can,             48U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 37 GwEth_PT_50F_Can */
+    { 0x00000540UL, PduRConf_PduRDestPdu_GwEth_CH_540_Can,              8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 38 GwEth_CH_540_Can */
+    { 0x00000541UL, PduRConf_PduRDestPdu_GwEth_CH_541_Can,              8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 39 GwEth_CH_541_Can */
+    { 0x00000542UL, PduRConf_PduRDestPdu_GwEth_CH_542_Can,             16U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 40 GwEth_CH_542_Can */
+    { 0x00000543UL, PduRConf_PduRDestPdu_GwEth_CH_543_Can,             16U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 41 GwEth_CH_543_Can */
+    { 0x00000544UL, PduRConf_PduRDestPdu_GwEth_CH_544_Can,             12U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 42 GwEth_CH_544_Can */
+    { 0x00000545UL, PduRConf_PduRDestPdu_GwEth_CH_545_Can,             32U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 43 GwEth_CH_545_Can */
+    { 0x00000546UL, PduRConf_PduRDestPdu_GwEth_CH_546_Can,              8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 44 GwEth_CH_546_Can */
+    { 0x00000547UL, PduRConf_PduRDestPdu_GwEth_CH_547_Can,             20U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 45 GwEth_CH_547_Can */
+    { 0x00000548UL, PduRConf_PduRDestPdu_GwEth_CH_548_Can,             32U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 46 GwEth_CH_548_Can */
+    { 0x00000549UL, PduRConf_PduRDestPdu_GwEth_CH_549_Can,             12U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 47 GwEth_CH_549_Can */
+    { 0x0000054AUL, PduRConf_PduRDestPdu_GwEth_CH_54A_Can,             20U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 48 GwEth_CH_54A_Can */
+    { 0x0000054BUL, PduRConf_PduRDestPdu_GwEth_CH_54B_Can,              8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 49 GwEth_CH_54B_Can */
+    { 0x00000580UL, PduRConf_PduRDestPdu_GwEth_BD_580_Can,             64U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 50 GwEth_BD_580_Can */
+    { 0x00000581UL, PduRConf_PduRDestPdu_GwEth_BD_581_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 51 GwEth_BD_581_Can */
+    { 0x00000582UL, PduRConf_PduRDestPdu_GwEth_BD_582_Can,             64U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 52 GwEth_BD_582_Can */
+    { 0x00000583UL, PduRConf_PduRDestPdu_GwEth_BD_583_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 53 GwEth_BD_583_Can */
+    { 0x00000584UL, PduRConf_PduRDestPdu_GwEth_BD_584_Can,             64U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 54 GwEth_BD_584_Can */
+    { 0x00000585UL, PduRConf_PduRDestPdu_GwEth_BD_585_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 55 GwEth_BD_585_Can */
+    { 0x00000586UL, PduRConf_PduRDestPdu_GwEth_BD_586_Can,             64U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 56 GwEth_BD_586_Can */
+    { 0x00000587UL, PduRConf_PduRDestPdu_GwEth_BD_587_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 57 GwEth_BD_587_Can */
+    { 0x00000588UL, PduRConf_PduRDestPdu_GwEth_BD_588_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 58 GwEth_BD_588_Can */
+    { 0x00000589UL, PduRConf_PduRDestPdu_GwEth_BD_589_Can,              8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 59 GwEth_BD_589_Can */
+    { 0x0000058AUL, PduRConf_PduRDestPdu_GwEth_BD_58A_Can,             16U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 60 GwEth_BD_58A_Can */
+    { 0x0000058BUL, PduRConf_PduRDestPdu_GwEth_BD_58B_Can,             20U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 61 GwEth_BD_58B_Can */
+    { 0x000007E8UL, CanTpConf_CanTpTxNPdu_UDS_PT_Resp_N,               64U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 62 UDS_PT_Resp_N */
+    { 0x000007E8UL, CanTpConf_CanTpTxNPdu_UDS_PT_Fc_N,                  8U, VbusConf_VbusBus_CAN_PT, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 63 UDS_PT_Fc_N */
+    { 0x000007E9UL, CanTpConf_CanTpTxNPdu_UDS_CH_Resp_N,               64U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 64 UDS_CH_Resp_N */
+    { 0x000007E9UL, CanTpConf_CanTpTxNPdu_UDS_CH_Fc_N,                  8U, VbusConf_VbusBus_CAN_CH, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 65 UDS_CH_Fc_N */
+    { 0x000007EAUL, CanTpConf_CanTpTxNPdu_UDS_BD_Resp_N,               64U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP },  /* 66 UDS_BD_Resp_N */
+    { 0x000007EAUL, CanTpConf_CanTpTxNPdu_UDS_BD_Fc_N,                  8U, VbusConf_VbusBus_CAN_BD, VBUS_NODE_VCU, VBUS_PDU_FD | VBUS_PDU_CANTP }   /* 67 UDS_BD_Fc_N */
+};
+
+const Vbus_PduConfigType Vbus_SoAdRxPdu[VBUS_SOAD_RX_PDU_COUNT] =
+{
+    { 0x00080500UL, PduRConf_PduRSrcPdu_GwEth_PT_500,  16U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 0 GwEth_PT_500 */
+    { 0x00080501UL, PduRConf_PduRSrcPdu_GwEth_PT_501,  12U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 1 GwEth_PT_501 */
+    { 0x00080502UL, PduRConf_PduRSrcPdu_GwEth_PT_502,  24U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 2 GwEth_PT_502 */
+    { 0x00080503UL, PduRConf_PduRSrcPdu_GwEth_PT_503,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 3 GwEth_PT_503 */
+    { 0x00080504UL, PduRConf_PduRSrcPdu_GwEth_PT_504,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 4 GwEth_PT_504 */
+    { 0x00080505UL, PduRConf_PduRSrcPdu_GwEth_PT_505,  12U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 5 GwEth_PT_505 */
+    { 0x00080506UL, PduRConf_PduRSrcPdu_GwEth_PT_506,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 6 GwEth_PT_506 */
+    { 0x00080507UL, PduRConf_PduRSrcPdu_GwEth_PT_507,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 7 GwEth_PT_507 */
+    { 0x00080508UL, PduRConf_PduRSrcPdu_GwEth_PT_508,  16U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 8 GwEth_PT_508 */
+    { 0x00080509UL, PduRConf_PduRSrcPdu_GwEth_PT_509,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 9 GwEth_PT_509 */
+    { 0x0008050AUL, PduRConf_PduRSrcPdu_GwEth_PT_50A,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 10 GwEth_PT_50A */
+    { 0x0008050BUL, PduRConf_PduRSrcPdu_GwEth_PT_50B,  32U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 11 GwEth_PT_50B */
+    { 0x0008050CUL, PduRConf_PduRSrcPdu_GwEth_PT_50C,  32U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 12 GwEth_PT_50C */
+    { 0x0008050DUL, PduRConf_PduRSrcPdu_GwEth_PT_50D,  24U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 13 GwEth_PT_50D */
+    { 0x0008050EUL, PduRConf_PduRSrcPdu_GwEth_PT_50E,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 14 GwEth_PT_50E */
+    { 0x0008050FUL, PduRConf_PduRSrcPdu_GwEth_PT_50F,  48U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 15 GwEth_PT_50F */
+    { 0x00081540UL, PduRConf_PduRSrcPdu_GwEth_CH_540,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 16 GwEth_CH_540 */
+    { 0x00081541UL, PduRConf_PduRSrcPdu_GwEth_CH_541,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 17 GwEth_CH_541 */
+    { 0x00081542UL, PduRConf_PduRSrcPdu_GwEth_CH_542,  16U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 18 GwEth_CH_542 */
+    { 0x00081543UL, PduRConf_PduRSrcPdu_GwEth_CH_543,  16U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 19 GwEth_CH_543 */
+    { 0x00081544UL, PduRConf_PduRSrcPdu_GwEth_CH_544,  12U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 20 GwEth_CH_544 */
+    { 0x00081545UL, PduRConf_PduRSrcPdu_GwEth_CH_545,  32U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 21 GwEth_CH_545 */
+    { 0x00081546UL, PduRConf_PduRSrcPdu_GwEth_CH_546,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 22 GwEth_CH_546 */
+    { 0x00081547UL, PduRConf_PduRSrcPdu_GwEth_CH_547,  20U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 23 GwEth_CH_547 */
+    { 0x00081548UL, PduRConf_PduRSrcPdu_GwEth_CH_548,  32U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 24 GwEth_CH_548 */
+    { 0x00081549UL, PduRConf_PduRSrcPdu_GwEth_CH_549,  12U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 25 GwEth_CH_549 */
+    { 0x0008154AUL, PduRConf_PduRSrcPdu_GwEth_CH_54A,  20U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 26 GwEth_CH_54A */
+    { 0x0008154BUL, PduRConf_PduRSrcPdu_GwEth_CH_54B,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_Hpc, 0U },  /* 27 GwEth_CH_54B */
+    { 0x00082580UL, PduRConf_PduRSrcPdu_GwEth_BD_580,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 28 GwEth_BD_580 */
+    { 0x00082581UL, PduRConf_PduRSrcPdu_GwEth_BD_581,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 29 GwEth_BD_581 */
+    { 0x00082582UL, PduRConf_PduRSrcPdu_GwEth_BD_582,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 30 GwEth_BD_582 */
+    { 0x00082583UL, PduRConf_PduRSrcPdu_GwEth_BD_583,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 31 GwEth_BD_583 */
+    { 0x00082584UL, PduRConf_PduRSrcPdu_GwEth_BD_584,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 32 GwEth_BD_584 */
+    { 0x00082585UL, PduRConf_PduRSrcPdu_GwEth_BD_585,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 33 GwEth_BD_585 */
+    { 0x00082586UL, PduRConf_PduRSrcPdu_GwEth_BD_586,  64U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 34 GwEth_BD_586 */
+    { 0x00082587UL, PduRConf_PduRSrcPdu_GwEth_BD_587,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 35 GwEth_BD_587 */
+    { 0x00082588UL, PduRConf_PduRSrcPdu_GwEth_BD_588,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 36 GwEth_BD_588 */
+    { 0x00082589UL, PduRConf_PduRSrcPdu_GwEth_BD_589,   8U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 37 GwEth_BD_589 */
+    { 0x0008258AUL, PduRConf_PduRSrcPdu_GwEth_BD_58A,  16U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U },  /* 38 GwEth_BD_58A */
+    { 0x0008258BUL, PduRConf_PduRSrcPdu_GwEth_BD_58B,  20U, VbusConf_VbusBus_ETH, VbusConf_VbusEcu_ZoneBody, 0U }   /* 39 GwEth_BD_58B */
+};
+
+const Vbus_PduConfigType Vbus_SoAdTxPdu[VBUS_SOAD_TX_PDU_COUNT] =
+{
+    { 0x00010110UL, PduRConf_PduRDestPdu_BMS_PackStatus_Eth,     32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 0 BMS_PackStatus_Eth */
+    { 0x00010120UL, PduRConf_PduRDestPdu_MCU_Status_Eth,         24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 1 MCU_Status_Eth */
+    { 0x000200A0UL, PduRConf_PduRDestPdu_ESP_WheelSpeeds_Eth,     8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 2 ESP_WheelSpeeds_Eth */
+    { 0x000200A1UL, PduRConf_PduRDestPdu_ESP_Dynamics_Eth,        8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 3 ESP_Dynamics_Eth */
+    { 0x000200B0UL, PduRConf_PduRDestPdu_SAS_Steering_Eth,        8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 4 SAS_Steering_Eth */
+    { 0x00040101UL, PduRConf_PduRDestPdu_VCU_TorqueRequest_Eth,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U },  /* 5 VCU_TorqueRequest_Eth */
+    { 0x00040102UL, PduRConf_PduRDestPdu_VCU_Status_Eth,         32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, 0U }   /* 6 VCU_Status_Eth */
+};
+
+const Vbus_PduConfigType Vbus_EthCommTxPdu[VBUS_ETHCOMM_TX_PDU_COUNT] =
+{
+    { 0x00000200UL, PduRConf_PduRDestPdu_GwPt_200_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 0 GwPt_200_Acf */
+    { 0x00000201UL, PduRConf_PduRDestPdu_GwPt_201_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 1 GwPt_201_Acf */
+    { 0x00000202UL, PduRConf_PduRDestPdu_GwPt_202_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 2 GwPt_202_Acf */
+    { 0x00000203UL, PduRConf_PduRDestPdu_GwPt_203_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 3 GwPt_203_Acf */
+    { 0x00000204UL, PduRConf_PduRDestPdu_GwPt_204_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 4 GwPt_204_Acf */
+    { 0x00000205UL, PduRConf_PduRDestPdu_GwPt_205_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 5 GwPt_205_Acf */
+    { 0x00000206UL, PduRConf_PduRDestPdu_GwPt_206_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 6 GwPt_206_Acf */
+    { 0x00000207UL, PduRConf_PduRDestPdu_GwPt_207_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 7 GwPt_207_Acf */
+    { 0x00000208UL, PduRConf_PduRDestPdu_GwPt_208_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 8 GwPt_208_Acf */
+    { 0x00000209UL, PduRConf_PduRDestPdu_GwPt_209_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 9 GwPt_209_Acf */
+    { 0x0000020AUL, PduRConf_PduRDestPdu_GwPt_20A_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 10 GwPt_20A_Acf */
+    { 0x0000020BUL, PduRConf_PduRDestPdu_GwPt_20B_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 11 GwPt_20B_Acf */
+    { 0x0000020CUL, PduRConf_PduRDestPdu_GwPt_20C_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 12 GwPt_20C_Acf */
+    { 0x0000020DUL, PduRConf_PduRDestPdu_GwPt_20D_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 13 GwPt_20D_Acf */
+    { 0x0000020EUL, PduRConf_PduRDestPdu_GwPt_20E_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 14 GwPt_20E_Acf */
+    { 0x0000020FUL, PduRConf_PduRDestPdu_GwPt_20F_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 15 GwPt_20F_Acf */
+    { 0x00000210UL, PduRConf_PduRDestPdu_GwPt_210_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 16 GwPt_210_Acf */
+    { 0x00000211UL, PduRConf_PduRDestPdu_GwPt_211_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 17 GwPt_211_Acf */
+    { 0x00000212UL, PduRConf_PduRDestPdu_GwPt_212_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 18 GwPt_212_Acf */
+    { 0x00000213UL, PduRConf_PduRDestPdu_GwPt_213_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 19 GwPt_213_Acf */
+    { 0x00000214UL, PduRConf_PduRDestPdu_GwPt_214_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 20 GwPt_214_Acf */
+    { 0x00000215UL, PduRConf_PduRDestPdu_GwPt_215_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 21 GwPt_215_Acf */
+    { 0x00000216UL, PduRConf_PduRDestPdu_GwPt_216_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 22 GwPt_216_Acf */
+    { 0x00000217UL, PduRConf_PduRDestPdu_GwPt_217_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 23 GwPt_217_Acf */
+    { 0x00000218UL, PduRConf_PduRDestPdu_GwPt_218_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 24 GwPt_218_Acf */
+    { 0x00000219UL, PduRConf_PduRDestPdu_GwPt_219_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 25 GwPt_219_Acf */
+    { 0x0000021AUL, PduRConf_PduRDestPdu_GwPt_21A_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 26 GwPt_21A_Acf */
+    { 0x0000021BUL, PduRConf_PduRDestPdu_GwPt_21B_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 27 GwPt_21B_Acf */
+    { 0x0000021CUL, PduRConf_PduRDestPdu_GwPt_21C_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 28 GwPt_21C_Acf */
+    { 0x0000021DUL, PduRConf_PduRDestPdu_GwPt_21D_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 29 GwPt_21D_Acf */
+    { 0x0000021EUL, PduRConf_PduRDestPdu_GwPt_21E_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 30 GwPt_21E_Acf */
+    { 0x0000021FUL, PduRConf_PduRDestPdu_GwPt_21F_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 31 GwPt_21F_Acf */
+    { 0x00000220UL, PduRConf_PduRDestPdu_GwPt_220_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 32 GwPt_220_Acf */
+    { 0x00000221UL, PduRConf_PduRDestPdu_GwPt_221_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 33 GwPt_221_Acf */
+    { 0x00000222UL, PduRConf_PduRDestPdu_GwPt_222_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 34 GwPt_222_Acf */
+    { 0x00000223UL, PduRConf_PduRDestPdu_GwPt_223_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 35 GwPt_223_Acf */
+    { 0x00000224UL, PduRConf_PduRDestPdu_GwPt_224_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 36 GwPt_224_Acf */
+    { 0x00000225UL, PduRConf_PduRDestPdu_GwPt_225_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 37 GwPt_225_Acf */
+    { 0x00000226UL, PduRConf_PduRDestPdu_GwPt_226_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 38 GwPt_226_Acf */
+    { 0x00000227UL, PduRConf_PduRDestPdu_GwPt_227_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 39 GwPt_227_Acf */
+    { 0x00000228UL, PduRConf_PduRDestPdu_GwPt_228_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 40 GwPt_228_Acf */
+    { 0x00000229UL, PduRConf_PduRDestPdu_GwPt_229_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 41 GwPt_229_Acf */
+    { 0x0000022AUL, PduRConf_PduRDestPdu_GwPt_22A_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 42 GwPt_22A_Acf */
+    { 0x0000022BUL, PduRConf_PduRDestPdu_GwPt_22B_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 43 GwPt_22B_Acf */
+    { 0x0000022CUL, PduRConf_PduRDestPdu_GwPt_22C_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 44 GwPt_22C_Acf */
+    { 0x0000022DUL, PduRConf_PduRDestPdu_GwPt_22D_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 45 GwPt_22D_Acf */
+    { 0x0000022EUL, PduRConf_PduRDestPdu_GwPt_22E_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 46 GwPt_22E_Acf */
+    { 0x0000022FUL, PduRConf_PduRDestPdu_GwPt_22F_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 47 GwPt_22F_Acf */
+    { 0x00000230UL, PduRConf_PduRDestPdu_GwPt_230_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 48 GwPt_230_Acf */
+    { 0x00000231UL, PduRConf_PduRDestPdu_GwPt_231_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 49 GwPt_231_Acf */
+    { 0x00000232UL, PduRConf_PduRDestPdu_GwPt_232_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 50 GwPt_232_Acf */
+    { 0x00000233UL, PduRConf_PduRDestPdu_GwPt_233_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 51 GwPt_233_Acf */
+    { 0x00000234UL, PduRConf_PduRDestPdu_GwPt_234_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 52 GwPt_234_Acf */
+    { 0x00000235UL, PduRConf_PduRDestPdu_GwPt_235_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 53 GwPt_235_Acf */
+    { 0x00000236UL, PduRConf_PduRDestPdu_GwPt_236_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 54 GwPt_236_Acf */
+    { 0x00000237UL, PduRConf_PduRDestPdu_GwPt_237_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 55 GwPt_237_Acf */
+    { 0x00000238UL, PduRConf_PduRDestPdu_GwPt_238_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 56 GwPt_238_Acf */
+    { 0x00000239UL, PduRConf_PduRDestPdu_GwPt_239_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 57 GwPt_239_Acf */
+    { 0x0000023AUL, PduRConf_PduRDestPdu_GwPt_23A_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 58 GwPt_23A_Acf */
+    { 0x0000023BUL, PduRConf_PduRDestPdu_GwPt_23B_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 59 GwPt_23B_Acf */
+    { 0x0000023CUL, PduRConf_PduRDestPdu_GwPt_23C_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 60 GwPt_23C_Acf */
+    { 0x0000023DUL, PduRConf_PduRDestPdu_GwPt_23D_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 61 GwPt_23D_Acf */
+    { 0x0000023EUL, PduRConf_PduRDestPdu_GwPt_23E_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 62 GwPt_23E_Acf */
+    { 0x0000023FUL, PduRConf_PduRDestPdu_GwPt_23F_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 63 GwPt_23F_Acf */
+    { 0x00000280UL, PduRConf_PduRDestPdu_GwCh_280_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 64 GwCh_280_Acf */
+    { 0x00000281UL, PduRConf_PduRDestPdu_GwCh_281_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 65 GwCh_281_Acf */
+    { 0x00000282UL, PduRConf_PduRDestPdu_GwCh_282_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 66 GwCh_282_Acf */
+    { 0x00000283UL, PduRConf_PduRDestPdu_GwCh_283_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 67 GwCh_283_Acf */
+    { 0x00000284UL, PduRConf_PduRDestPdu_GwCh_284_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 68 GwCh_284_Acf */
+    { 0x00000285UL, PduRConf_PduRDestPdu_GwCh_285_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 69 GwCh_285_Acf */
+    { 0x00000286UL, PduRConf_PduRDestPdu_GwCh_286_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 70 GwCh_286_Acf */
+    { 0x00000287UL, PduRConf_PduRDestPdu_GwCh_287_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 71 GwCh_287_Acf */
+    { 0x00000288UL, PduRConf_PduRDestPdu_GwCh_288_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 72 GwCh_288_Acf */
+    { 0x00000289UL, PduRConf_PduRDestPdu_GwCh_289_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 73 GwCh_289_Acf */
+    { 0x0000028AUL, PduRConf_PduRDestPdu_GwCh_28A_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 74 GwCh_28A_Acf */
+    { 0x0000028BUL, PduRConf_PduRDestPdu_GwCh_28B_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 75 GwCh_28B_Acf */
+    { 0x0000028CUL, PduRConf_PduRDestPdu_GwCh_28C_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 76 GwCh_28C_Acf */
+    { 0x0000028DUL, PduRConf_PduRDestPdu_GwCh_28D_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 77 GwCh_28D_Acf */
+    { 0x0000028EUL, PduRConf_PduRDestPdu_GwCh_28E_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 78 GwCh_28E_Acf */
+    { 0x0000028FUL, PduRConf_PduRDestPdu_GwCh_28F_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 79 GwCh_28F_Acf */
+    { 0x00000290UL, PduRConf_PduRDestPdu_GwCh_290_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 80 GwCh_290_Acf */
+    { 0x00000291UL, PduRConf_PduRDestPdu_GwCh_291_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 81 GwCh_291_Acf */
+    { 0x00000292UL, PduRConf_PduRDestPdu_GwCh_292_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 82 GwCh_292_Acf */
+    { 0x00000293UL, PduRConf_PduRDestPdu_GwCh_293_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 83 GwCh_293_Acf */
+    { 0x00000294UL, PduRConf_PduRDestPdu_GwCh_294_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 84 GwCh_294_Acf */
+    { 0x00000295UL, PduRConf_PduRDestPdu_GwCh_295_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 85 GwCh_295_Acf */
+    { 0x00000296UL, PduRConf_PduRDestPdu_GwCh_296_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 86 GwCh_296_Acf */
+    { 0x00000297UL, PduRConf_PduRDestPdu_GwCh_297_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 87 GwCh_297_Acf */
+    { 0x00000298UL, PduRConf_PduRDestPdu_GwCh_298_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 88 GwCh_298_Acf */
+    { 0x00000299UL, PduRConf_PduRDestPdu_GwCh_299_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 89 GwCh_299_Acf */
+    { 0x0000029AUL, PduRConf_PduRDestPdu_GwCh_29A_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 90 GwCh_29A_Acf */
+    { 0x0000029BUL, PduRConf_PduRDestPdu_GwCh_29B_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 91 GwCh_29B_Acf */
+    { 0x0000029CUL, PduRConf_PduRDestPdu_GwCh_29C_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 92 GwCh_29C_Acf */
+    { 0x0000029DUL, PduRConf_PduRDestPdu_GwCh_29D_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 93 GwCh_29D_Acf */
+    { 0x0000029EUL, PduRConf_PduRDestPdu_GwCh_29E_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 94 GwCh_29E_Acf */
+    { 0x0000029FUL, PduRConf_PduRDestPdu_GwCh_29F_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 95 GwCh_29F_Acf */
+    { 0x000002A0UL, PduRConf_PduRDestPdu_GwCh_2A0_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 96 GwCh_2A0_Acf */
+    { 0x000002A1UL, PduRConf_PduRDestPdu_GwCh_2A1_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 97 GwCh_2A1_Acf */
+    { 0x000002A2UL, PduRConf_PduRDestPdu_GwCh_2A2_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 98 GwCh_2A2_Acf */
+    { 0x000002A3UL, PduRConf_PduRDestPdu_GwCh_2A3_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 99 GwCh_2A3_Acf */
+    { 0x000002A4UL, PduRConf_PduRDestPdu_GwCh_2A4_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 100 GwCh_2A4_Acf */
+    { 0x000002A5UL, PduRConf_PduRDestPdu_GwCh_2A5_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 101 GwCh_2A5_Acf */
+    { 0x000002A6UL, PduRConf_PduRDestPdu_GwCh_2A6_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 102 GwCh_2A6_Acf */
+    { 0x000002A7UL, PduRConf_PduRDestPdu_GwCh_2A7_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 103 GwCh_2A7_Acf */
+    { 0x000002A8UL, PduRConf_PduRDestPdu_GwCh_2A8_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 104 GwCh_2A8_Acf */
+    { 0x000002A9UL, PduRConf_PduRDestPdu_GwCh_2A9_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 105 GwCh_2A9_Acf */
+    { 0x000002AAUL, PduRConf_PduRDestPdu_GwCh_2AA_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 106 GwCh_2AA_Acf */
+    { 0x000002ABUL, PduRConf_PduRDestPdu_GwCh_2AB_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 107 GwCh_2AB_Acf */
+    { 0x000002ACUL, PduRConf_PduRDestPdu_GwCh_2AC_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 108 GwCh_2AC_Acf */
+    { 0x000002ADUL, PduRConf_PduRDestPdu_GwCh_2AD_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 109 GwCh_2AD_Acf */
+    { 0x000002AEUL, PduRConf_PduRDestPdu_GwCh_2AE_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 110 GwCh_2AE_Acf */
+    { 0x000002AFUL, PduRConf_PduRDestPdu_GwCh_2AF_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 111 GwCh_2AF_Acf */
+    { 0x00000400UL, PduRConf_PduRDestPdu_GwBd_400_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 112 GwBd_400_Acf */
+    { 0x00000401UL, PduRConf_PduRDestPdu_GwBd_401_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 113 GwBd_401_Acf */
+    { 0x00000402UL, PduRConf_PduRDestPdu_GwBd_402_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 114 GwBd_402_Acf */
+    { 0x00000403UL, PduRConf_PduRDestPdu_GwBd_403_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 115 GwBd_403_Acf */
+    { 0x00000404UL, PduRConf_PduRDestPdu_GwBd_404_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 116 GwBd_404_Acf */
+    { 0x00000405UL, PduRConf_PduRDestPdu_GwBd_405_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 117 GwBd_405_Acf */
+    { 0x00000406UL, PduRConf_PduRDestPdu_GwBd_406_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 118 GwBd_406_Acf */
+    { 0x00000407UL, PduRConf_PduRDestPdu_GwBd_407_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 119 GwBd_407_Acf */
+    { 0x00000408UL, PduRConf_PduRDestPdu_GwBd_408_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 120 GwBd_408_Acf */
+    { 0x00000409UL, PduRConf_PduRDestPdu_GwBd_409_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 121 GwBd_409_Acf */
+    { 0x0000040AUL, PduRConf_PduRDestPdu_GwBd_40A_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 122 GwBd_40A_Acf */
+    { 0x0000040BUL, PduRConf_PduRDestPdu_GwBd_40B_Acf,  24U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 123 GwBd_40B_Acf */
+    { 0x0000040CUL, PduRConf_PduRDestPdu_GwBd_40C_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 124 GwBd_40C_Acf */
+    { 0x0000040DUL, PduRConf_PduRDestPdu_GwBd_40D_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 125 GwBd_40D_Acf */
+    { 0x0000040EUL, PduRConf_PduRDestPdu_GwBd_40E_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 126 GwBd_40E_Acf */
+    { 0x0000040FUL, PduRConf_PduRDestPdu_GwBd_40F_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 127 GwBd_40F_Acf */
+    { 0x00000410UL, PduRConf_PduRDestPdu_GwBd_410_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 128 GwBd_410_Acf */
+    { 0x00000411UL, PduRConf_PduRDestPdu_GwBd_411_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 129 GwBd_411_Acf */
+    { 0x00000412UL, PduRConf_PduRDestPdu_GwBd_412_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 130 GwBd_412_Acf */
+    { 0x00000413UL, PduRConf_PduRDestPdu_GwBd_413_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 131 GwBd_413_Acf */
+    { 0x00000414UL, PduRConf_PduRDestPdu_GwBd_414_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 132 GwBd_414_Acf */
+    { 0x00000415UL, PduRConf_PduRDestPdu_GwBd_415_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 133 GwBd_415_Acf */
+    { 0x00000416UL, PduRConf_PduRDestPdu_GwBd_416_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 134 GwBd_416_Acf */
+    { 0x00000417UL, PduRConf_PduRDestPdu_GwBd_417_Acf,  16U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 135 GwBd_417_Acf */
+    { 0x00000418UL, PduRConf_PduRDestPdu_GwBd_418_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 136 GwBd_418_Acf */
+    { 0x00000419UL, PduRConf_PduRDestPdu_GwBd_419_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 137 GwBd_419_Acf */
+    { 0x0000041AUL, PduRConf_PduRDestPdu_GwBd_41A_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 138 GwBd_41A_Acf */
+    { 0x0000041BUL, PduRConf_PduRDestPdu_GwBd_41B_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 139 GwBd_41B_Acf */
+    { 0x0000041CUL, PduRConf_PduRDestPdu_GwBd_41C_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 140 GwBd_41C_Acf */
+    { 0x0000041DUL, PduRConf_PduRDestPdu_GwBd_41D_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 141 GwBd_41D_Acf */
+    { 0x0000041EUL, PduRConf_PduRDestPdu_GwBd_41E_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 142 GwBd_41E_Acf */
+    { 0x0000041FUL, PduRConf_PduRDestPdu_GwBd_41F_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 143 GwBd_41F_Acf */
+    { 0x00000420UL, PduRConf_PduRDestPdu_GwBd_420_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 144 GwBd_420_Acf */
+    { 0x00000421UL, PduRConf_PduRDestPdu_GwBd_421_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 145 GwBd_421_Acf */
+    { 0x00000422UL, PduRConf_PduRDestPdu_GwBd_422_Acf,  48U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 146 GwBd_422_Acf */
+    { 0x00000423UL, PduRConf_PduRDestPdu_GwBd_423_Acf,  12U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 147 GwBd_423_Acf */
+    { 0x00000424UL, PduRConf_PduRDestPdu_GwBd_424_Acf,  32U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 148 GwBd_424_Acf */
+    { 0x00000425UL, PduRConf_PduRDestPdu_GwBd_425_Acf,   8U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 149 GwBd_425_Acf */
+    { 0x00000426UL, PduRConf_PduRDestPdu_GwBd_426_Acf,  20U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD },  /* 150 GwBd_426_Acf */
+    { 0x00000427UL, PduRConf_PduRDestPdu_GwBd_427_Acf,  64U, VbusConf_VbusBus_ETH, VBUS_NODE_VCU, VBUS_PDU_FD }   /* 151 GwBd_427_Acf */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
@@ -0,0 +1,72 @@
+/**
+ * @file    vbus_cfg.h
+ * @brief   Vbus Configuration - Buses, ECUs and PDU Counts
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Buses, simulated ECUs and bus interface PDUs of the VCU for the virtual
+ * bus (4 buses, 16 ECUs):
+ *
+ * | Bus      | Format   | VCU TX buffers | RX PDUs | TX PDUs | ECUs                                  |
+ * |----------|----------|----------------|---------|---------|---------------------------------------|
+ * | CAN_PT   | CANFD    | 8              | 74      | 29      | BMS, MCU, OBC, DCDC, GwPt, UDS_PT     |
+ * | CAN_CH   | CANFD    | 8              | 53      | 23      | ESP, SAS, APS, GwCh, UDS_CH           |
+ * | CAN_BD   | CANFD    | 8              | 42      | 16      | GW, GwBd, UDS_BD                      |
+ * | ETH      | ETHERNET | -              | 40      | 159     | Hpc, ZoneBody                         |
+ *
+ * @note Generated by tools/vbus/vbus_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef VBUS_CFG_H
+#define VBUS_CFG_H
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define VBUS_BUS_COUNT                                  4U
+#define VBUS_CAN_BUS_COUNT                              3U
+#define VBUS_ECU_COUNT                                  16U
+#define VBUS_CANIF_RX_PDU_COUNT                         169U
+#define VBUS_CANIF_TX_PDU_COUNT                         68U
+#define VBUS_SOAD_RX_PDU_COUNT                          40U
+#define VBUS_SOAD_TX_PDU_COUNT                          7U
+#define VBUS_ETHCOMM_TX_PDU_COUNT                       152U
+
+/* ===============================================================================================
+ *                              BUSES (CanIfCtrlId of the CAN buses)
+ * =============================================================================================== */
+
+#define VbusConf_VbusBus_CAN_PT                         0U
+#define VbusConf_VbusBus_CAN_CH                         1U
+#define VbusConf_VbusBus_CAN_BD                         2U
+#define VbusConf_VbusBus_ETH                            3U
+
+/* ===============================================================================================
+ *                                         SIMULATED ECUS
+ * =============================================================================================== */
+
+#define VbusConf_VbusEcu_BMS                            0U
+#define VbusConf_VbusEcu_MCU                            1U
+#define VbusConf_VbusEcu_OBC                            2U
+#define VbusConf_VbusEcu_DCDC                           3U
+#define VbusConf_VbusEcu_GwPt                           4U
+#define VbusConf_VbusEcu_UDS_PT                         5U
+#define VbusConf_VbusEcu_ESP                            6U
+#define VbusConf_VbusEcu_SAS                            7U
+#define VbusConf_VbusEcu_APS                            8U
+#define VbusConf_VbusEcu_GwCh                           9U
+#define VbusConf_VbusEcu_UDS_CH                         10U
+#define VbusConf_VbusEcu_GW                             11U
+#define VbusConf_VbusEcu_GwBd                           12U
+#define VbusConf_VbusEcu_UDS_BD                         13U
+#define VbusConf_VbusEcu_Hpc                            14U
+#define VbusConf_VbusEcu_ZoneBody                       15U
+
+#endif /* VBUS_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,151 @@
+/**
+ * @file    task_definitions.c
+ * @brief   Application Task Bodies
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Bodies of the OS tasks configured in task_config.c. Tasks are basic tasks
+ * and run to completion; runnables of the software components are mapped
+ * into these bodies by the RTE configuration.
+ *
+ * The same bodies run on target and in software-in-the-loop simulation
+ * (simulation/sil), so they must not depend on the port layer.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial task set                   |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | QM background task                 |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | RTE implicit buffer fill/flush     |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | RTE recorder                       |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | RTE event task                     |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | RTE cross-core replication         |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | RTE error batch of the QM task     |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Resource supervision               |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | DiagnosticManager event runnables  |
+ *
+ * @see task_config.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "task_config.h"
+#include "rte.h"
+#include "DiagnosticManager.h"
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief One-shot initialization task (autostart, highest priority)
+ */
+void Task_Init(void)
+{
+    (void)Rte_Start();
+    Rte_Recorder_Init();
+    DiagnosticManager_Init();
+
+    /* Startup runnables are mapped here by the RTE configuration */
+}
+
+/**
+ * @brief 1 ms task: fast control loops
+ */
+void Task_1ms(void)
+{
+    Rte_Recorder_Cycle();               /* Snapshot before this activation reads its inputs */
+    Rte_Task_Fill(OS_TASK_1MS);
+
+    /* Runnables are mapped here by the RTE configuration */
+
+    Rte_Task_Flush(OS_TASK_1MS);
+}
+
+/**
+ * @brief 5 ms task: communication receive processing
+ */
+void Task_5ms(void)
+{
+    Rte_Task_Fill(OS_TASK_5MS);
+
+    /* Runnables are mapped here by the RTE configuration */
+
+    Rte_Task_Flush(OS_TASK_5MS);
+}
+
+/**
+ * @brief 10 ms task: vehicle state and torque arbitration
+ */
+void Task_10ms(void)
+{
+    Rte_Task_Fill(OS_TASK_10MS);
+
+    /* Runnables are mapped here by the RTE configuration */
+
+    Rte_Task_Flush(OS_TASK_10MS);
+    Os_Resource_MainFunction();         /* Stuck holds and lock-order cycles */
+}
+
+/**
+ * @brief 100 ms task: diagnostics and power management
+ */
+void Task_100ms(void)
+{
+    Rte_Task_Fill(OS_TASK_100MS);
+
+    /* Runnables are mapped here by the RTE configuration */
+
+    Rte_Task_Flush(OS_TASK_100MS);
+    Rte_Lockstep_Transmit();            /* One batch of this cycle's replicated signals */
+
+    /* Hand the QM share of the cycle to the QM partition (other core on split-lock parts) */
+    (void)ActivateTask(OS_TASK_QM_BACKGROUND);
+}
+
+/**
+ * @brief QM background task: logging, comfort functions (QM partition)
+ */
+void Task_QmBackground(void)
+{
+    Rte_Task_Fill(OS_TASK_QM_BACKGROUND);   /* Opens the error batch of the task */
+    Rte_Lockstep_Receive();             /* Replicas of the safety signals */
+
+    /* Runnables are mapped here by the RTE configuration */
+
+    Rte_Task_Flush(OS_TASK_QM_BACKGROUND);
+    Rte_Lockstep_Transmit();
+}
+
+/**
+ * @brief Event task: event-triggered runnables, activated by the RTE
+ */
+void Task_Event(void)
+{
+    uint32 events;
+
+    Rte_Task_Fill(OS_TASK_EVENT);       /* Re-arms the activation by events */
+
+    /* Each event-triggered runnable is called with its pending-event set if that is not empty */
+    events = Rte_Events_DiagnosticManager_OnFaultEvent();
+    if (events != 0UL)
+    {
+        DiagnosticManager_OnFaultEvent(events);
+    }
+    events = Rte_Events_DiagnosticManager_OnDiagRequest();
+    if (events != 0UL)
+    {
+        DiagnosticManager_OnDiagRequest(events);
+    }
+
+    Rte_Task_Flush(OS_TASK_EVENT);
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,1193 @@
+/**
+ * @file    can_tp.c
+ * @brief   CanTp - ISO 15765-2 Transport Protocol on CAN-FD
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Segmentation and reassembly of can_tp.h. Every N-SDU runs its own state
+ * machine:
+ *
+ * | N-SDU | Phase           | Left by                                                     |
+ * |-------|-----------------|-------------------------------------------------------------|
+ * | TX    | SEND            | Segment handed to CanIf (CanTp_TxProcess)                   |
+ * | TX    | WAIT_CONF       | CanTp_TxConfirmation: done, WAIT_FC after FF / block, SEND  |
+ * | TX    | WAIT_FC         | FC CTS: SEND; FC WAIT: N_Bs restarted; FC OVFLW: abort      |
+ * | RX    | WAIT_CF         | Last CF: done; last CF of the block: next FC                |
+ * | RX    | WAIT_BUFFER     | Buffer for one CF: FC CTS; N_Br expired: FC WAIT or abort   |
+ *
+ * Implementation Notes:
+ * - A segment is built in a CAN_DL_MAX byte frame on the stack: the PCI is
+ *   written first, PduR_CanTpCopyTxData() copies the payload behind it, the
+ *   rest up to the next CAN-FD length is padded, and CanIf_Transmit() takes
+ *   the frame
+ * - CanIf may confirm within CanIf_Transmit(); CanTp_TxProcess() then sends
+ *   the next CF in its loop instead of recursing
+ * - Frames of an N-SDU in the wrong phase (FC without a request, CF without
+ *   CTS) are ignored as ISO 15765-2 requires; a wrong sequence number or a
+ *   short CF aborts the reception
+ * - CANTP_ENTER_CRITICAL() only covers the phase transitions of a channel.
+ *   The PduR (copy, start of reception, indication, confirmation) and
+ *   CanIf_Transmit() are called outside it, from a snapshot taken inside;
+ *   the result is applied only if the phase (and, for a reception, its
+ *   session) is unchanged when the section is re-entered
+ * - A TX segment is built by the one CanTp_TxProcess() that owns the
+ *   channel (sending); other contexts only move the phase, and the
+ *   timeout supervision waits until the owner is done
+ * - The frames of one N-PDU come from one CAN receive interrupt and do not
+ *   preempt each other; a reception stopped while its CF was copied (N_Cr
+ *   in CanTp_MainFunction()) drops the CF
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see can_tp.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "can_tp.h"
+#include "pdu_router.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define CANTP_C_VENDOR_ID                       43U
+#define CANTP_C_SW_MAJOR_VERSION                1U
+#define CANTP_C_SW_MINOR_VERSION                0U
+#define CANTP_C_SW_PATCH_VERSION                0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (CANTP_C_VENDOR_ID != CANTP_VENDOR_ID)
+    #error "can_tp.c and can_tp.h have different vendor IDs"
+#endif
+
+#if ((CANTP_C_SW_MAJOR_VERSION != CANTP_SW_MAJOR_VERSION) || \
+     (CANTP_C_SW_MINOR_VERSION != CANTP_SW_MINOR_VERSION) || \
+     (CANTP_C_SW_PATCH_VERSION != CANTP_SW_PATCH_VERSION))
+    #error "Software version mismatch between can_tp.c and can_tp.h"
+#endif
+
+/*==================================================================================================
+*                                      MODULE INTERFACES
+==================================================================================================*/
+
+extern Std_ReturnType CanIf_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, CANTP_APPL_DATA) PduInfoPtr);
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (CANTP_DEV_ERROR_DETECT == STD_ON)
+    #define CANTP_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(CANTP_MODULE_ID, CANTP_INSTANCE_ID, (api), (err)))
+#else
+    #define CANTP_REPORT_ERROR(api, err)        ((void)0)
+#endif
+
+#ifndef CANTP_ENTER_CRITICAL
+    #define CANTP_ENTER_CRITICAL(key)           ((key) = Os_Port_DisableInterrupts())
+    #define CANTP_EXIT_CRITICAL(key)            Os_Port_RestoreInterrupts(key)
+#endif
+
+/* Protocol control information (ISO 15765-2) */
+#define CANTP_PCI_TYPE_MASK                     0xF0U
+#define CANTP_PCI_SF                            0x00U   /**< Single frame */
+#define CANTP_PCI_FF                            0x10U   /**< First frame */
+#define CANTP_PCI_CF                            0x20U   /**< Consecutive frame */
+#define CANTP_PCI_FC                            0x30U   /**< Flow control */
+#define CANTP_PCI_LOW_MASK                      0x0FU   /**< SF_DL, FF_DL bits 11..8, SN, FS */
+
+#define CANTP_FS_CTS                            0x00U   /**< Continue to send */
+#define CANTP_FS_WAIT                           0x01U
+#define CANTP_FS_OVFLW                          0x02U   /**< Overflow, abort */
+
+#define CANTP_CAN_DL_CLASSIC                    8U
+#define CANTP_CAN_DL_MAX                        64U
+#define CANTP_FC_LENGTH                         3U
+#define CANTP_FF_DL_12BIT_MAX                   4095UL
+#define CANTP_STMIN_MAX_US                      127000UL
+
+/* Phases of a TX N-SDU */
+#define CANTP_TX_IDLE                           0U
+#define CANTP_TX_SEND                           1U      /**< Next segment due at next_cf */
+#define CANTP_TX_WAIT_CONF                      2U      /**< Segment handed to CanIf */
+#define CANTP_TX_WAIT_FC                        3U      /**< FF or last CF of a block confirmed */
+
+/* Phases of an RX N-SDU */
+#define CANTP_RX_IDLE                           0U
+#define CANTP_RX_WAIT_CF                        1U      /**< FC CTS sent */
+#define CANTP_RX_WAIT_BUFFER                    2U      /**< FC WAIT sent, polling the upper buffer */
+
+/** @brief No confirmation or indication due (Std_ReturnType results are E_OK / E_NOT_OK) */
+#define CANTP_RESULT_NONE                       0xFFU
+
+/** @brief No FC to send */
+#define CANTP_FC_NONE                           0xFFU
+
+/** @brief TRUE once Now has reached Time (wrap-safe for half the timestamp range) */
+#define CANTP_TIME_REACHED(now, time)           (((uint32)((now) - (time))) < 0x80000000UL)
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct CanTp_TxChannelType
+ * @brief Transmission in progress of one TX N-SDU
+ */
+typedef struct
+{
+    uint32 deadline;                            /**< N_As / N_Bs / N_Cs */
+    uint32 next_cf;                             /**< Earliest time of the next CF (STmin) */
+    uint32 stmin;                               /**< STmin of the last FC in ticks */
+    PduLengthType length;                       /**< N-SDU length */
+    PduLengthType sent;                         /**< Bytes handed to CanIf */
+    uint8 phase;                                /**< CANTP_TX_* */
+    uint8 sn;                                   /**< Sequence number of the next CF */
+    uint8 bs;                                   /**< BS of the last FC, 0: no further FC */
+    uint8 block_left;                           /**< CFs left in the block */
+    boolean wait_fc;                            /**< An FC follows the segment awaiting confirmation */
+    boolean sending;                            /**< Owned by a CanTp_TxProcess() */
+} CanTp_TxChannelType;
+
+/**
+ * @struct CanTp_RxChannelType
+ * @brief Reception in progress of one RX N-SDU
+ */
+typedef struct
+{
+    uint32 deadline;                            /**< N_Ar / N_Br / N_Cr */
+    PduLengthType remaining;                    /**< Bytes still to receive */
+    PduLengthType buffer;                       /**< Buffer space last reported by the upper module */
+    uint8 phase;                                /**< CANTP_RX_* */
+    uint8 rx_dl;                                /**< CAN_DL of the FF, length of all CFs but the last */
+    uint8 sn;                                   /**< Expected sequence number */
+    uint8 bs;                                   /**< BS of the last FC CTS, 0: no further FC */
+    uint8 block_left;                           /**< CFs left in the block */
+    uint8 wft;                                  /**< FC WAIT sent in a row */
+    uint8 session;                              /**< Incremented when a reception stops */
+} CanTp_RxChannelType;
+
+/**
+ * @struct CanTp_RxFcType
+ * @brief FC decided inside the section, sent after it
+ */
+typedef struct
+{
+    uint8 session;                              /**< Session of the reception that decided it */
+    uint8 flow_status;                          /**< CANTP_FS_*, CANTP_FC_NONE: nothing to send */
+    uint8 bs;
+    uint8 stmin;
+} CanTp_RxFcType;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/** @brief CAN-FD frame lengths above 8 bytes (DLC 9..15) */
+STATIC const uint8 CanTp_CanDl[] = { 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after CanTp_Init() */
+STATIC boolean CanTp_Initialized = FALSE;
+
+STATIC CanTp_TxChannelType CanTp_TxChannel[CANTP_TX_NSDU_COUNT];
+STATIC CanTp_RxChannelType CanTp_RxChannel[CANTP_RX_NSDU_COUNT];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief CAN_DL of a frame carrying Length bytes: the next CAN-FD length
+ *        above 8 bytes, 8 with padding below
+ */
+STATIC uint8 CanTp_FrameLength(uint8 Length, boolean Padding)
+{
+    uint8 index;
+
+    if (Length <= CANTP_CAN_DL_CLASSIC)
+    {
+        return (Padding == TRUE) ? CANTP_CAN_DL_CLASSIC : Length;
+    }
+    for (index = 0U; index < (uint8)(sizeof(CanTp_CanDl) - 1U); index++)
+    {
+        if (Length <= CanTp_CanDl[index])
+        {
+            break;
+        }
+    }
+    return CanTp_CanDl[index];
+}
+
+/**
+ * @brief Pad a frame from Length up to its CAN_DL and hand it to CanIf
+ */
+STATIC Std_ReturnType CanTp_SendFrame(PduIdType CanIfPduId, P2VAR(uint8, AUTOMATIC, AUTOMATIC) Frame,
+    uint8 Length, boolean Padding)
+{
+    PduInfoType info;
+    uint8 can_dl = CanTp_FrameLength(Length, Padding);
+
+    (void)memset(&Frame[Length], (int)CANTP_PADDING_BYTE, (size_t)can_dl - Length);
+    info.SduDataPtr = Frame;
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = can_dl;
+    return CanIf_Transmit(CanIfPduId, &info);
+}
+
+/**
+ * @brief STmin of a received FC in timestamp ticks; reserved values mean 127 ms
+ */
+STATIC uint32 CanTp_StMinTicks(uint8 StMin)
+{
+    uint32 us;
+
+    if (StMin <= 0x7FU)
+    {
+        us = (uint32)StMin * 1000UL;
+    }
+    else if ((StMin >= 0xF1U) && (StMin <= 0xF9U))
+    {
+        us = (uint32)(StMin - 0xF0U) * 100UL;
+    }
+    else
+    {
+        us = CANTP_STMIN_MAX_US;
+    }
+    return CANTP_US_TO_TICKS(us);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Transmission                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Stop a transmission; inside the section
+ * @return Result to confirm after the section, CANTP_RESULT_NONE if it was idle
+ */
+STATIC uint8 CanTp_TxStop(P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) Tx, Std_ReturnType Result)
+{
+    if (Tx->phase == CANTP_TX_IDLE)
+    {
+        return CANTP_RESULT_NONE;
+    }
+    Tx->phase = CANTP_TX_IDLE;
+    return Result;
+}
+
+/**
+ * @brief Confirm a stopped transmission to the upper module; outside the section
+ */
+STATIC void CanTp_TxNotify(PduIdType TxNSduId, uint8 Result)
+{
+    if (Result != CANTP_RESULT_NONE)
+    {
+        PduR_CanTpTxConfirmation(CanTp_TxNSdu[TxNSduId].upper_pdu, (Std_ReturnType)Result);
+    }
+}
+
+/**
+ * @brief Build the next segment (SF, FF or CF) in place and hand it to CanIf;
+ *        called by the owner of the channel (sending), outside the section
+ * @return TRUE if a segment was handed to CanIf
+ */
+STATIC boolean CanTp_TxSegment(PduIdType TxNSduId, uint32 Now)
+{
+    P2CONST(CanTp_TxNSduConfigType, AUTOMATIC, CANTP_CONST) cfg = &CanTp_TxNSdu[TxNSduId];
+    P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx = &CanTp_TxChannel[TxNSduId];
+    uint8 frame[CANTP_CAN_DL_MAX];
+    PduInfoType info;
+    PduLengthType available = 0U;
+    PduLengthType length;
+    PduLengthType sent;
+    PduLengthType rest;
+    PduLengthType payload;
+    uint8 sn;
+    uint8 pci;
+    uint8 result = CANTP_RESULT_NONE;
+    boolean handed = FALSE;
+    BufReq_ReturnType req;
+    uint32 key;
+
+    CANTP_ENTER_CRITICAL(key);
+    length = tx->length;
+    sent = tx->sent;
+    sn = tx->sn;
+    CANTP_EXIT_CRITICAL(key);
+    rest = length - sent;
+
+    if (sent != 0U)
+    {
+        frame[0] = (uint8)(CANTP_PCI_CF | sn);
+        pci = 1U;
+        payload = (rest < (PduLengthType)(cfg->tx_dl - 1U)) ? rest : (PduLengthType)(cfg->tx_dl - 1U);
+    }
+    else if (length < CANTP_CAN_DL_CLASSIC)
+    {
+        frame[0] = (uint8)length;
+        pci = 1U;
+        payload = length;
+    }
+    else if ((cfg->tx_dl > CANTP_CAN_DL_CLASSIC) && (length <= (PduLengthType)(cfg->tx_dl - 2U)))
+    {
+        frame[0] = CANTP_PCI_SF;
+        frame[1] = (uint8)length;
+        pci = 2U;
+        payload = length;
+    }
+    else
+    {
+        if (length <= CANTP_FF_DL_12BIT_MAX)
+        {
+            frame[0] = (uint8)(CANTP_PCI_FF | (uint8)(length >> 8));
+            frame[1] = (uint8)length;
+            pci = 2U;
+        }
+        else
+        {
+            /* Escape sequence: FF_DL 0 in 12 bits, 32-bit FF_DL behind it */
+            frame[0] = CANTP_PCI_FF;
+            frame[1] = 0U;
+            frame[2] = 0U;
+            frame[3] = 0U;
+            frame[4] = (uint8)(length >> 8);
+            frame[5] = (uint8)length;
+            pci = 6U;
+        }
+        payload = (PduLengthType)(cfg->tx_dl - pci);
+    }
+
+    info.SduDataPtr = &frame[pci];
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = payload;
+    req = PduR_CanTpCopyTxData(cfg->upper_pdu, &info, NULL_PTR, &available);
+    if (req == BUFREQ_E_BUSY)
+    {
+        return FALSE;                                   /* Retried by CanTp_MainFunction() until N_Cs */
+    }
+
+    CANTP_ENTER_CRITICAL(key);
+    if (tx->phase != CANTP_TX_SEND)
+    {
+        /* Stopped meanwhile, confirmed by the one that stopped it */
+    }
+    else if (req != BUFREQ_OK)
+    {
+        result = CanTp_TxStop(tx, E_NOT_OK);
+    }
+    else
+    {
+        if (sent == 0U)
+        {
+            tx->wait_fc = (payload < length) ? TRUE : FALSE;
+            tx->sn = 1U;
+        }
+        else
+        {
+            tx->sn = (uint8)((sn + 1U) & CANTP_PCI_LOW_MASK);
+            tx->wait_fc = FALSE;
+            if (tx->bs != 0U)
+            {
+                tx->block_left--;
+                tx->wait_fc = ((tx->block_left == 0U) && (payload < rest)) ? TRUE : FALSE;
+            }
+        }
+        tx->sent = sent + payload;
+        tx->phase = CANTP_TX_WAIT_CONF;                 /* Before CanIf_Transmit(), which may confirm */
+        tx->deadline = Now + cfg->n_as;
+        handed = TRUE;
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    if ((handed == TRUE) && (CanTp_SendFrame(cfg->data_pdu, frame, (uint8)(pci + payload), cfg->padding) != E_OK))
+    {
+        CANTP_ENTER_CRITICAL(key);
+        result = CanTp_TxStop(tx, E_NOT_OK);
+        CANTP_EXIT_CRITICAL(key);
+        handed = FALSE;
+    }
+    CanTp_TxNotify(TxNSduId, result);
+    return handed;
+}
+
+/**
+ * @brief Send the segments of an N-SDU that are due; outside the section
+ */
+STATIC void CanTp_TxProcess(PduIdType TxNSduId, uint32 Now)
+{
+    P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx = &CanTp_TxChannel[TxNSduId];
+    boolean due;
+    uint32 key;
+
+    CANTP_ENTER_CRITICAL(key);
+    if (tx->sending == FALSE)                           /* Else confirmed within CanIf_Transmit() */
+    {
+        tx->sending = TRUE;
+        due = ((tx->phase == CANTP_TX_SEND) && CANTP_TIME_REACHED(Now, tx->next_cf)) ? TRUE : FALSE;
+        while (due == TRUE)
+        {
+            CANTP_EXIT_CRITICAL(key);
+            due = CanTp_TxSegment(TxNSduId, Now);
+            CANTP_ENTER_CRITICAL(key);
+            if (due == TRUE)
+            {
+                due = ((tx->phase == CANTP_TX_SEND) && CANTP_TIME_REACHED(Now, tx->next_cf)) ? TRUE : FALSE;
+            }
+        }
+        tx->sending = FALSE;
+    }
+    CANTP_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Confirmation of a segment: next phase of the transmission
+ */
+STATIC void CanTp_TxConfirmed(PduIdType TxNSduId, Std_ReturnType Result)
+{
+    P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx = &CanTp_TxChannel[TxNSduId];
+    uint8 result = CANTP_RESULT_NONE;
+    boolean process = FALSE;
+    uint32 now = Os_Port_GetTimestamp();
+    uint32 key;
+
+    CANTP_ENTER_CRITICAL(key);
+    if (tx->phase != CANTP_TX_WAIT_CONF)
+    {
+        /* Stopped, or no segment outstanding */
+    }
+    else if (Result != E_OK)
+    {
+        result = CanTp_TxStop(tx, E_NOT_OK);
+    }
+    else if (tx->sent == tx->length)
+    {
+        result = CanTp_TxStop(tx, E_OK);
+    }
+    else if (tx->wait_fc == TRUE)
+    {
+        tx->phase = CANTP_TX_WAIT_FC;
+        tx->deadline = now + CanTp_TxNSdu[TxNSduId].n_bs;
+    }
+    else
+    {
+        tx->phase = CANTP_TX_SEND;
+        tx->next_cf = now + tx->stmin;
+        tx->deadline = tx->next_cf + CanTp_TxNSdu[TxNSduId].n_cs;
+        process = TRUE;
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_TxNotify(TxNSduId, result);
+    if (process == TRUE)
+    {
+        CanTp_TxProcess(TxNSduId, now);
+    }
+}
+
+/**
+ * @brief FC received for a transmission
+ */
+STATIC void CanTp_TxFlowControl(PduIdType TxNSduId,
+    P2CONST(uint8, AUTOMATIC, CANTP_APPL_DATA) Data, PduLengthType Length)
+{
+    P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx = &CanTp_TxChannel[TxNSduId];
+    uint8 result = CANTP_RESULT_NONE;
+    boolean process = FALSE;
+    uint32 now;
+    uint32 key;
+
+    if (Length < CANTP_FC_LENGTH)
+    {
+        return;
+    }
+
+    now = Os_Port_GetTimestamp();
+    CANTP_ENTER_CRITICAL(key);
+    if (tx->phase == CANTP_TX_WAIT_FC)
+    {
+        switch (Data[0] & CANTP_PCI_LOW_MASK)
+        {
+            case CANTP_FS_CTS:
+                tx->bs = Data[1];
+                tx->block_left = Data[1];
+                tx->stmin = CanTp_StMinTicks(Data[2]);
+                tx->phase = CANTP_TX_SEND;
+                tx->next_cf = now;
+                tx->deadline = now + CanTp_TxNSdu[TxNSduId].n_cs;
+                process = TRUE;
+                break;
+
+            case CANTP_FS_WAIT:
+                tx->deadline = now + CanTp_TxNSdu[TxNSduId].n_bs;
+                break;
+
+            default:
+                result = CanTp_TxStop(tx, E_NOT_OK);    /* OVFLW or invalid flow status */
+                break;
+        }
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_TxNotify(TxNSduId, result);
+    if (process == TRUE)
+    {
+        CanTp_TxProcess(TxNSduId, now);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Reception                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Stop a reception; inside the section
+ * @return Result to indicate after the section, CANTP_RESULT_NONE if it was idle
+ */
+STATIC uint8 CanTp_RxStop(P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) Rx, Std_ReturnType Result)
+{
+    if (Rx->phase == CANTP_RX_IDLE)
+    {
+        return CANTP_RESULT_NONE;
+    }
+    Rx->phase = CANTP_RX_IDLE;
+    Rx->session++;
+    return Result;
+}
+
+/**
+ * @brief Indicate a stopped reception to the upper module; outside the section
+ */
+STATIC void CanTp_RxNotify(PduIdType RxNSduId, uint8 Result)
+{
+    if (Result != CANTP_RESULT_NONE)
+    {
+        PduR_CanTpRxIndication(CanTp_RxNSdu[RxNSduId].upper_pdu, (Std_ReturnType)Result);
+    }
+}
+
+/**
+ * @brief Send an FC frame of an RX N-SDU
+ * @return Result of CanIf_Transmit()
+ */
+STATIC Std_ReturnType CanTp_RxSendFc(PduIdType RxNSduId, uint8 FlowStatus, uint8 BlockSize, uint8 StMin)
+{
+    uint8 frame[CANTP_CAN_DL_CLASSIC];
+
+    frame[0] = (uint8)(CANTP_PCI_FC | FlowStatus);
+    frame[1] = BlockSize;
+    frame[2] = StMin;
+    return CanTp_SendFrame(CanTp_RxNSdu[RxNSduId].fc_pdu, frame, CANTP_FC_LENGTH, CanTp_RxNSdu[RxNSduId].padding);
+}
+
+/**
+ * @brief Request the next block with BS and STmin fitted to the upper buffer,
+ *        or FC WAIT while the buffer cannot take one CF; inside the section
+ * @param[out] Fc FC to send after the section
+ * @return Result to indicate after the section (N_WFTmax), else CANTP_RESULT_NONE
+ */
+STATIC uint8 CanTp_RxNextBlock(PduIdType RxNSduId, uint32 Now, P2VAR(CanTp_RxFcType, AUTOMATIC, AUTOMATIC) Fc)
+{
+    P2CONST(CanTp_RxNSduConfigType, AUTOMATIC, CANTP_CONST) cfg = &CanTp_RxNSdu[RxNSduId];
+    P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx = &CanTp_RxChannel[RxNSduId];
+    PduLengthType cf_payload = (PduLengthType)(rx->rx_dl - 1U);
+    uint8 flow_status = CANTP_FS_CTS;
+    uint8 stmin = 0U;
+    uint8 bs = cfg->bs;
+
+    if (rx->buffer >= rx->remaining)
+    {
+        /* The rest fits: the sender may go at full speed */
+    }
+    else if (rx->buffer >= cf_payload)
+    {
+        uint32 fit = (uint32)rx->buffer / cf_payload;
+
+        if ((bs == 0U) || (fit < bs))
+        {
+            bs = (fit < 0xFFUL) ? (uint8)fit : 0xFFU;
+        }
+        stmin = cfg->stmin;
+    }
+    else if (rx->wft < cfg->wft_max)
+    {
+        flow_status = CANTP_FS_WAIT;
+    }
+    else
+    {
+        return CanTp_RxStop(rx, E_NOT_OK);              /* N_WFTmax reached */
+    }
+
+    if (flow_status == CANTP_FS_CTS)
+    {
+        rx->wft = 0U;
+        rx->bs = bs;
+        rx->block_left = bs;
+        rx->phase = CANTP_RX_WAIT_CF;
+        rx->deadline = Now + cfg->n_ar;
+    }
+    else
+    {
+        rx->wft++;
+        bs = 0U;
+        rx->phase = CANTP_RX_WAIT_BUFFER;
+        rx->deadline = Now + cfg->n_br;
+    }
+
+    Fc->session = rx->session;
+    Fc->flow_status = flow_status;
+    Fc->bs = bs;
+    Fc->stmin = stmin;
+    return CANTP_RESULT_NONE;
+}
+
+/**
+ * @brief Send the FC of CanTp_RxNextBlock(); outside the section
+ */
+STATIC void CanTp_RxSendBlockFc(PduIdType RxNSduId, P2CONST(CanTp_RxFcType, AUTOMATIC, AUTOMATIC) Fc)
+{
+    P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx = &CanTp_RxChannel[RxNSduId];
+    uint8 result = CANTP_RESULT_NONE;
+    uint32 key;
+
+    if (Fc->flow_status == CANTP_FC_NONE)
+    {
+        return;
+    }
+    if (CanTp_RxSendFc(RxNSduId, Fc->flow_status, Fc->bs, Fc->stmin) != E_OK)
+    {
+        CANTP_ENTER_CRITICAL(key);
+        if (rx->session == Fc->session)
+        {
+            result = CanTp_RxStop(rx, E_NOT_OK);
+        }
+        CANTP_EXIT_CRITICAL(key);
+        CanTp_RxNotify(RxNSduId, result);
+    }
+}
+
+/**
+ * @brief Single frame received
+ */
+STATIC void CanTp_RxSingleFrame(PduIdType RxNSduId,
+    P2CONST(uint8, AUTOMATIC, CANTP_APPL_DATA) Data, PduLengthType Length)
+{
+    PduIdType upper = CanTp_RxNSdu[RxNSduId].upper_pdu;
+    PduLengthType buffer = 0U;
+    PduLengthType sf_dl;
+    PduInfoType info;
+    uint8 pci;
+    uint8 result;
+    uint32 key;
+
+    if (Length <= CANTP_CAN_DL_CLASSIC)
+    {
+        sf_dl = (PduLengthType)(Data[0] & CANTP_PCI_LOW_MASK);
+        pci = 1U;
+    }
+    else
+    {
+        sf_dl = ((Data[0] & CANTP_PCI_LOW_MASK) == 0U) ? (PduLengthType)Data[1] : 0U;
+        pci = 2U;
+    }
+    if ((sf_dl == 0U) || (sf_dl > (Length - pci)))
+    {
+        return;
+    }
+
+    CANTP_ENTER_CRITICAL(key);
+    result = CanTp_RxStop(&CanTp_RxChannel[RxNSduId], E_NOT_OK);  /* A new SF replaces the reception */
+    CANTP_EXIT_CRITICAL(key);
+    CanTp_RxNotify(RxNSduId, result);
+
+    info.SduDataPtr = (uint8 *)&Data[pci];
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = sf_dl;
+    if (PduR_CanTpStartOfReception(upper, &info, sf_dl, &buffer) != BUFREQ_OK)
+    {
+        return;
+    }
+    if ((buffer < sf_dl) || (PduR_CanTpCopyRxData(upper, &info, &buffer) != BUFREQ_OK))
+    {
+        PduR_CanTpRxIndication(upper, E_NOT_OK);
+        return;
+    }
+    PduR_CanTpRxIndication(upper, E_OK);
+}
+
+/**
+ * @brief First frame received
+ */
+STATIC void CanTp_RxFirstFrame(PduIdType RxNSduId,
+    P2CONST(uint8, AUTOMATIC, CANTP_APPL_DATA) Data, PduLengthType Length, uint32 Now)
+{
+    P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx = &CanTp_RxChannel[RxNSduId];
+    PduIdType upper = CanTp_RxNSdu[RxNSduId].upper_pdu;
+    PduLengthType buffer = 0U;
+    PduLengthType payload;
+    PduInfoType info;
+    CanTp_RxFcType fc;
+    uint32 ff_dl;
+    uint8 pci = 2U;
+    uint8 result;
+    BufReq_ReturnType req;
+    uint32 key;
+
+    if ((CanTp_RxNSdu[RxNSduId].functional == TRUE) || (Length < CANTP_CAN_DL_CLASSIC))
+    {
+        return;
+    }
+
+    ff_dl = ((uint32)(Data[0] & CANTP_PCI_LOW_MASK) << 8) | Data[1];
+    if (ff_dl == 0U)
+    {
+        ff_dl = ((uint32)Data[2] << 24) | ((uint32)Data[3] << 16) | ((uint32)Data[4] << 8) | Data[5];
+        pci = 6U;
+        if (ff_dl <= CANTP_FF_DL_12BIT_MAX)
+        {
+            return;
+        }
+    }
+    if (ff_dl <= (uint32)((Length == CANTP_CAN_DL_CLASSIC) ? (Length - 1U) : (Length - 2U)))
+    {
+        return;                                         /* Would have fitted into an SF */
+    }
+
+    CANTP_ENTER_CRITICAL(key);
+    result = CanTp_RxStop(rx, E_NOT_OK);                /* A new FF replaces the reception */
+    CANTP_EXIT_CRITICAL(key);
+    CanTp_RxNotify(RxNSduId, result);
+    if (ff_dl > 0xFFFFUL)
+    {
+        (void)CanTp_RxSendFc(RxNSduId, CANTP_FS_OVFLW, 0U, 0U);   /* Beyond PduLengthType */
+        return;
+    }
+
+    /* The channel is idle: nothing else touches it until the reception is set up below */
+    payload = (PduLengthType)(Length - pci);
+    info.SduDataPtr = (uint8 *)&Data[pci];
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = payload;
+    req = PduR_CanTpStartOfReception(upper, &info, (PduLengthType)ff_dl, &buffer);
+    if (req == BUFREQ_E_OVFL)
+    {
+        (void)CanTp_RxSendFc(RxNSduId, CANTP_FS_OVFLW, 0U, 0U);
+        return;
+    }
+    if (req != BUFREQ_OK)
+    {
+        return;
+    }
+    if (buffer < payload)
+    {
+        (void)CanTp_RxSendFc(RxNSduId, CANTP_FS_OVFLW, 0U, 0U);
+        PduR_CanTpRxIndication(upper, E_NOT_OK);
+        return;
+    }
+    if (PduR_CanTpCopyRxData(upper, &info, &buffer) != BUFREQ_OK)
+    {
+        PduR_CanTpRxIndication(upper, E_NOT_OK);
+        return;
+    }
+
+    fc.flow_status = CANTP_FC_NONE;
+    CANTP_ENTER_CRITICAL(key);
+    rx->remaining = (PduLengthType)(ff_dl - payload);
+    rx->buffer = buffer;
+    rx->rx_dl = (uint8)Length;
+    rx->sn = 1U;
+    rx->wft = 0U;
+    result = CanTp_RxNextBlock(RxNSduId, Now, &fc);
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_RxNotify(RxNSduId, result);
+    CanTp_RxSendBlockFc(RxNSduId, &fc);
+}
+
+/**
+ * @brief Consecutive frame received
+ */
+STATIC void CanTp_RxConsecutiveFrame(PduIdType RxNSduId,
+    P2CONST(uint8, AUTOMATIC, CANTP_APPL_DATA) Data, PduLengthType Length, uint32 Now)
+{
+    P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx = &CanTp_RxChannel[RxNSduId];
+    PduIdType upper = CanTp_RxNSdu[RxNSduId].upper_pdu;
+    PduLengthType cf_payload = 0U;
+    PduLengthType buffer = 0U;
+    PduInfoType info;
+    CanTp_RxFcType fc;
+    uint8 result = CANTP_RESULT_NONE;
+    uint8 session = 0U;
+    boolean copy = FALSE;
+    BufReq_ReturnType req;
+    uint32 key;
+
+    CANTP_ENTER_CRITICAL(key);
+    if (rx->phase == CANTP_RX_WAIT_CF)
+    {
+        cf_payload = (rx->remaining < (PduLengthType)(rx->rx_dl - 1U)) ? rx->remaining
+                                                                        : (PduLengthType)(rx->rx_dl - 1U);
+        if (((Data[0] & CANTP_PCI_LOW_MASK) != rx->sn) || ((Length - 1U) < cf_payload))
+        {
+            result = CanTp_RxStop(rx, E_NOT_OK);
+        }
+        else
+        {
+            session = rx->session;
+            buffer = rx->buffer;
+            copy = TRUE;
+        }
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_RxNotify(RxNSduId, result);
+    if (copy == FALSE)
+    {
+        return;
+    }
+
+    info.SduDataPtr = (uint8 *)&Data[1];
+    info.MetaDataPtr = NULL_PTR;
+    info.SduLength = cf_payload;
+    req = PduR_CanTpCopyRxData(upper, &info, &buffer);
+
+    fc.flow_status = CANTP_FC_NONE;
+    CANTP_ENTER_CRITICAL(key);
+    if ((rx->session != session) || (rx->phase != CANTP_RX_WAIT_CF))
+    {
+        /* Stopped meanwhile (N_Cr in CanTp_MainFunction()), indicated by the one that stopped it */
+    }
+    else if (req != BUFREQ_OK)
+    {
+        result = CanTp_RxStop(rx, E_NOT_OK);
+    }
+    else
+    {
+        rx->buffer = buffer;
+        rx->remaining -= cf_payload;
+        rx->sn = (uint8)((rx->sn + 1U) & CANTP_PCI_LOW_MASK);
+        if (rx->remaining == 0U)
+        {
+            result = CanTp_RxStop(rx, E_OK);
+        }
+        else if ((rx->bs != 0U) && (--rx->block_left == 0U))
+        {
+            result = CanTp_RxNextBlock(RxNSduId, Now, &fc);
+        }
+        else
+        {
+            rx->deadline = Now + CanTp_RxNSdu[RxNSduId].n_cr;
+        }
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_RxNotify(RxNSduId, result);
+    CanTp_RxSendBlockFc(RxNSduId, &fc);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize all N-SDUs to idle
+ */
+void CanTp_Init(void)
+{
+    (void)memset(CanTp_TxChannel, 0, sizeof(CanTp_TxChannel));
+    (void)memset(CanTp_RxChannel, 0, sizeof(CanTp_RxChannel));
+    CanTp_Initialized = TRUE;
+}
+
+/**
+ * @brief Start the transmission of an N-SDU
+ */
+Std_ReturnType CanTp_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, CANTP_APPL_DATA) PduInfoPtr)
+{
+    P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx;
+    Std_ReturnType result = E_NOT_OK;
+    uint32 key;
+    uint32 now;
+
+    if (CanTp_Initialized == FALSE)
+    {
+        CANTP_REPORT_ERROR(CANTP_TRANSMIT_API_ID, CANTP_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (TxPduId >= CANTP_TX_NSDU_COUNT)
+    {
+        CANTP_REPORT_ERROR(CANTP_TRANSMIT_API_ID, CANTP_E_PARAM_ID);
+        return E_NOT_OK;
+    }
+    if (PduInfoPtr == NULL_PTR)
+    {
+        CANTP_REPORT_ERROR(CANTP_TRANSMIT_API_ID, CANTP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (PduInfoPtr->SduLength == 0U)
+    {
+        CANTP_REPORT_ERROR(CANTP_TRANSMIT_API_ID, CANTP_E_INVALID_TX_LENGTH);
+        return E_NOT_OK;
+    }
+
+    tx = &CanTp_TxChannel[TxPduId];
+    now = Os_Port_GetTimestamp();
+    CANTP_ENTER_CRITICAL(key);
+    if (tx->phase == CANTP_TX_IDLE)
+    {
+        tx->length = PduInfoPtr->SduLength;
+        tx->sent = 0U;
+        tx->bs = 0U;
+        tx->block_left = 0U;
+        tx->stmin = 0U;
+        tx->phase = CANTP_TX_SEND;
+        tx->next_cf = now;
+        tx->deadline = now + CanTp_TxNSdu[TxPduId].n_cs;
+        result = E_OK;
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    if (result == E_OK)
+    {
+        CanTp_TxProcess(TxPduId, now);
+    }
+    return result;
+}
+
+/**
+ * @brief Process a received frame
+ */
+void CanTp_RxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, CANTP_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(CanTp_RxNPduConfigType, AUTOMATIC, CANTP_CONST) npdu;
+    P2CONST(uint8, AUTOMATIC, CANTP_APPL_DATA) data;
+
+    if (CanTp_Initialized == FALSE)
+    {
+        CANTP_REPORT_ERROR(CANTP_RX_INDICATION_API_ID, CANTP_E_UNINIT);
+        return;
+    }
+    if (RxPduId >= CANTP_RX_NPDU_COUNT)
+    {
+        CANTP_REPORT_ERROR(CANTP_RX_INDICATION_API_ID, CANTP_E_PARAM_ID);
+        return;
+    }
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR))
+    {
+        CANTP_REPORT_ERROR(CANTP_RX_INDICATION_API_ID, CANTP_E_PARAM_POINTER);
+        return;
+    }
+    if ((PduInfoPtr->SduLength == 0U) || (PduInfoPtr->SduLength > CANTP_CAN_DL_MAX))
+    {
+        return;
+    }
+
+    npdu = &CanTp_RxNPdu[RxPduId];
+    data = PduInfoPtr->SduDataPtr;
+    switch (data[0] & CANTP_PCI_TYPE_MASK)
+    {
+        case CANTP_PCI_FC:
+            if (npdu->tx_nsdu != CANTP_NO_NSDU)
+            {
+                CanTp_TxFlowControl(npdu->tx_nsdu, data, PduInfoPtr->SduLength);
+            }
+            break;
+
+        case CANTP_PCI_SF:
+            if (npdu->rx_nsdu != CANTP_NO_NSDU)
+            {
+                CanTp_RxSingleFrame(npdu->rx_nsdu, data, PduInfoPtr->SduLength);
+            }
+            break;
+
+        case CANTP_PCI_FF:
+            if (npdu->rx_nsdu != CANTP_NO_NSDU)
+            {
+                CanTp_RxFirstFrame(npdu->rx_nsdu, data, PduInfoPtr->SduLength, Os_Port_GetTimestamp());
+            }
+            break;
+
+        case CANTP_PCI_CF:
+            if (npdu->rx_nsdu != CANTP_NO_NSDU)
+            {
+                CanTp_RxConsecutiveFrame(npdu->rx_nsdu, data, PduInfoPtr->SduLength, Os_Port_GetTimestamp());
+            }
+            break;
+
+        default:
+            /* Reserved PCI type: ignored */
+            break;
+    }
+}
+
+/**
+ * @brief Confirmation of a frame sent by CanTp
+ */
+void CanTp_TxConfirmation(PduIdType TxPduId, Std_ReturnType result)
+{
+    P2CONST(CanTp_TxNPduConfigType, AUTOMATIC, CANTP_CONST) npdu;
+    P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx;
+    uint8 end = CANTP_RESULT_NONE;
+    uint32 key;
+
+    if (CanTp_Initialized == FALSE)
+    {
+        CANTP_REPORT_ERROR(CANTP_TX_CONFIRMATION_API_ID, CANTP_E_UNINIT);
+        return;
+    }
+    if (TxPduId >= CANTP_TX_NPDU_COUNT)
+    {
+        CANTP_REPORT_ERROR(CANTP_TX_CONFIRMATION_API_ID, CANTP_E_PARAM_ID);
+        return;
+    }
+
+    npdu = &CanTp_TxNPdu[TxPduId];
+    if (npdu->flow_control == FALSE)
+    {
+        CanTp_TxConfirmed(npdu->nsdu, result);
+        return;
+    }
+
+    rx = &CanTp_RxChannel[npdu->nsdu];
+    CANTP_ENTER_CRITICAL(key);
+    if (rx->phase == CANTP_RX_IDLE)
+    {
+        /* FC OVFLW of a refused reception */
+    }
+    else if (result != E_OK)
+    {
+        end = CanTp_RxStop(rx, E_NOT_OK);
+    }
+    else if (rx->phase == CANTP_RX_WAIT_CF)
+    {
+        /* FC CTS on the bus: N_Ar ends, N_Cr starts */
+        rx->deadline = Os_Port_GetTimestamp() + CanTp_RxNSdu[npdu->nsdu].n_cr;
+    }
+    else
+    {
+        /* FC WAIT on the bus: N_Br keeps running */
+    }
+    CANTP_EXIT_CRITICAL(key);
+
+    CanTp_RxNotify(npdu->nsdu, end);
+}
+
+/**
+ * @brief Send the CFs due after STmin, poll the buffers behind FC WAIT and
+ *        supervise the timeouts
+ */
+void CanTp_MainFunction(void)
+{
+    PduIdType id;
+    uint8 result;
+    uint32 key;
+    uint32 now;
+
+    if (CanTp_Initialized == FALSE)
+    {
+        return;
+    }
+
+    now = Os_Port_GetTimestamp();
+    for (id = 0U; id < CANTP_TX_NSDU_COUNT; id++)
+    {
+        P2VAR(CanTp_TxChannelType, AUTOMATIC, CANTP_VAR) tx = &CanTp_TxChannel[id];
+
+        CanTp_TxProcess(id, now);
+
+        /* A segment being built by a preempted owner is supervised on the next call */
+        result = CANTP_RESULT_NONE;
+        CANTP_ENTER_CRITICAL(key);
+        if ((tx->sending == FALSE) && (tx->phase != CANTP_TX_IDLE) && CANTP_TIME_REACHED(now, tx->deadline))
+        {
+            result = CanTp_TxStop(tx, E_NOT_OK);        /* N_As, N_Bs or N_Cs expired */
+        }
+        CANTP_EXIT_CRITICAL(key);
+        CanTp_TxNotify(id, result);
+    }
+
+    for (id = 0U; id < CANTP_RX_NSDU_COUNT; id++)
+    {
+        P2VAR(CanTp_RxChannelType, AUTOMATIC, CANTP_VAR) rx = &CanTp_RxChannel[id];
+        PduLengthType buffer = 0U;
+        CanTp_RxFcType fc;
+        uint8 session = 0U;
+        boolean poll = FALSE;
+
+        result = CANTP_RESULT_NONE;
+        CANTP_ENTER_CRITICAL(key);
+        if (rx->phase == CANTP_RX_WAIT_BUFFER)
+        {
+            session = rx->session;
+            poll = TRUE;
+        }
+        else if ((rx->phase == CANTP_RX_WAIT_CF) && CANTP_TIME_REACHED(now, rx->deadline))
+        {
+            result = CanTp_RxStop(rx, E_NOT_OK);        /* N_Ar or N_Cr expired */
+        }
+        else
+        {
+            /* Idle or within its timeouts */
+        }
+        CANTP_EXIT_CRITICAL(key);
+        CanTp_RxNotify(id, result);
+
+        if (poll == TRUE)
+        {
+            PduInfoType query;
+            BufReq_ReturnType req;
+
+            query.SduDataPtr = NULL_PTR;
+            query.MetaDataPtr = NULL_PTR;
+            query.SduLength = 0U;
+            req = PduR_CanTpCopyRxData(CanTp_RxNSdu[id].upper_pdu, &query, &buffer);
+
+            fc.flow_status = CANTP_FC_NONE;
+            CANTP_ENTER_CRITICAL(key);
+            if ((rx->session != session) || (rx->phase != CANTP_RX_WAIT_BUFFER))
+            {
+                /* Stopped or replaced by a new SF / FF meanwhile */
+            }
+            else if (req != BUFREQ_OK)
+            {
+                result = CanTp_RxStop(rx, E_NOT_OK);
+            }
+            else
+            {
+                rx->buffer = buffer;
+                if ((buffer >= (PduLengthType)(rx->rx_dl - 1U)) || (buffer >= rx->remaining) ||
+                    CANTP_TIME_REACHED(now, rx->deadline))
+                {
+                    result = CanTp_RxNextBlock(id, now, &fc);   /* FC CTS, or the next FC WAIT after N_Br */
+                }
+            }
+            CANTP_EXIT_CRITICAL(key);
+            CanTp_RxNotify(id, result);
+            CanTp_RxSendBlockFc(id, &fc);
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
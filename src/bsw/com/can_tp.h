@@ -0,0 +1,295 @@
+/**
+ * @file    can_tp.h
+ * @brief   CanTp - ISO 15765-2 Transport Protocol on CAN-FD
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * AUTOSAR CanTp for the UDS connections of the VCU (ISO 15765-2:2016 with
+ * CAN-FD frames), configured in config/autosar/communication/pdu_router.arxml.
+ * CanTp is the lower TP module of the PduR: Dcm transmits through
+ * PduR_DcmTransmit() -> CanTp_Transmit(), and CanTp exchanges the data
+ * with the Dcm buffers through PduR_CanTpCopyTxData() / CopyRxData().
+ *
+ * | Frame | PCI bytes                      | Payload per frame (TX_DL 64)          |
+ * |-------|--------------------------------|---------------------------------------|
+ * | SF    | 0x0L (CAN_DL 8)                | up to 7                               |
+ * |       | 0x00 LL (CAN_DL above 8)       | up to 62                              |
+ * | FF    | 0x1L LL (length up to 4095)    | 62                                    |
+ * |       | 0x10 0x00 LL LL LL LL (escape) | 58                                    |
+ * | CF    | 0x2N (sequence number N)       | 63, the last one rounded up to a DLC  |
+ * | FC    | 0x3S BS STmin                  | -                                     |
+ *
+ * The connections are independent: every N-SDU has its own state, so the
+ * three physical connections and the functional one run concurrently, and
+ * a physical N-SDU can receive a request while its response N-SDU sends.
+ *
+ * Throughput:
+ * - The segments are built on the stack of the caller and filled by
+ *   PduR_CanTpCopyTxData() directly after the PCI; received frames are
+ *   handed to PduR_CanTpCopyRxData() in place. No N-SDU is staged in CanTp
+ * - A sender with STmin 0 sends the next CF from CanTp_TxConfirmation() of
+ *   the previous one, so a block goes out back to back without waiting for
+ *   CanTp_MainFunction()
+ * - The receiver derives BS and STmin from the buffer Dcm reports: if the
+ *   rest of the N-SDU fits, the FC carries CanTpBs and STmin 0, otherwise BS
+ *   is what the buffer takes (at most CanTpBs) with CanTpSTmin. Without
+ *   space for one CF it sends FC WAIT, at most CanTpRxWftMax times
+ *
+ * Implementation Notes:
+ * - Standard addressing only; physical and functional RX, physical TX
+ * - An N-SDU is limited to 65535 bytes by PduLengthType; a first frame
+ *   announcing more is answered with FC OVFLW
+ * - CanIf is called through CanIf_Transmit() with the TX N-PDU handle of
+ *   the generated tables; the confirmation handle identifies the N-SDU
+ * - The state of an N-SDU is accessed under CANTP_ENTER_CRITICAL(), which
+ *   is never held across a call into the PduR or CanIf;
+ *   CanTp_RxIndication() and CanTp_TxConfirmation() run in the CAN
+ *   interrupts, CanTp_MainFunction() in a task
+ * - Timeouts (N_As / N_Bs / N_Cs, N_Ar / N_Br / N_Cr) are checked in
+ *   CanTp_MainFunction() against Os_Port_GetTimestamp()
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | CAN-FD transport protocol          |
+ *
+ * @see can_tp.c
+ * @see can_tp_cfg.h
+ * @see pdu_router.h
+ */
+
+#ifndef CAN_TP_H
+#define CAN_TP_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define CANTP_VENDOR_ID                         43U
+#define CANTP_MODULE_ID                         35U
+#define CANTP_INSTANCE_ID                       0U
+
+#define CANTP_SW_MAJOR_VERSION                  1U
+#define CANTP_SW_MINOR_VERSION                  0U
+#define CANTP_SW_PATCH_VERSION                  0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+#include "os_port.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (CANTP_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "can_tp.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define CANTP_INIT_API_ID                       0x01U
+#define CANTP_MAIN_FUNCTION_API_ID              0x06U
+#define CANTP_TX_CONFIRMATION_API_ID            0x40U
+#define CANTP_RX_INDICATION_API_ID              0x42U
+#define CANTP_TRANSMIT_API_ID                   0x49U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define CANTP_E_PARAM_ID                        0x02U   /**< Invalid N-SDU or N-PDU handle */
+#define CANTP_E_PARAM_POINTER                   0x03U   /**< NULL pointer parameter */
+#define CANTP_E_UNINIT                          0x20U   /**< CanTp_Init() not called */
+#define CANTP_E_INVALID_TX_LENGTH               0x90U   /**< N-SDU of length 0 */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def CANTP_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef CANTP_DEV_ERROR_DETECT
+    #define CANTP_DEV_ERROR_DETECT              STD_ON
+#endif
+
+/**
+ * @def CANTP_TICKS_PER_US
+ * @brief Os_Port_GetTimestamp() ticks per microsecond
+ */
+#define CANTP_TICKS_PER_US                      OS_PORT_TICKS_PER_US
+
+/**
+ * @def CANTP_US_TO_TICKS
+ * @brief Microseconds to Os_Port_GetTimestamp() ticks
+ */
+#define CANTP_US_TO_TICKS(us)                   ((uint32)(us) * CANTP_TICKS_PER_US)
+
+/* Configuration validation */
+#if (CANTP_DEV_ERROR_DETECT != STD_ON) && (CANTP_DEV_ERROR_DETECT != STD_OFF)
+    #error "CANTP_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief No CanIf PDU (flow control of a functional N-SDU) */
+#define CANTP_NO_PDU                            0xFFFFU
+
+/** @brief No N-SDU behind an N-PDU in this direction */
+#define CANTP_NO_NSDU                           0xFFFFU
+
+/**
+ * @struct CanTp_RxNSduConfigType
+ * @brief Static configuration of one receiving N-SDU (CanTpRxNSdu, generated)
+ */
+typedef struct
+{
+    uint32 n_ar;                        /**< CanTpNar in timestamp ticks: FC confirmation */
+    uint32 n_br;                        /**< CanTpNbr in timestamp ticks: next FC WAIT */
+    uint32 n_cr;                        /**< CanTpNcr in timestamp ticks: next CF */
+    PduIdType upper_pdu;                /**< PduR source handle (PduRConf_PduRSrcPdu_*) */
+    PduIdType fc_pdu;                   /**< CanIf TX PDU of the FC, CANTP_NO_PDU if functional */
+    uint8 bs;                           /**< CanTpBs, 0: no further FC */
+    uint8 stmin;                        /**< CanTpSTmin in FC encoding */
+    uint8 wft_max;                      /**< CanTpRxWftMax */
+    boolean padding;                    /**< CanTpRxPaddingActivation */
+    boolean functional;                 /**< CanTpRxTaType CANTP_FUNCTIONAL: SF only */
+} CanTp_RxNSduConfigType;
+
+/**
+ * @struct CanTp_TxNSduConfigType
+ * @brief Static configuration of one transmitting N-SDU (CanTpTxNSdu, generated)
+ */
+typedef struct
+{
+    uint32 n_as;                        /**< CanTpNas in timestamp ticks: frame confirmation */
+    uint32 n_bs;                        /**< CanTpNbs in timestamp ticks: next FC */
+    uint32 n_cs;                        /**< CanTpNcs in timestamp ticks: next CF ready */
+    PduIdType upper_pdu;                /**< PduR destination handle (PduRConf_PduRDestPdu_*) */
+    PduIdType data_pdu;                 /**< CanIf TX PDU of the SF / FF / CF */
+    uint8 tx_dl;                        /**< TX_DL: 8, 12, 16, 20, 24, 32, 48 or 64 */
+    boolean padding;                    /**< CanTpTxPaddingActivation */
+} CanTp_TxNSduConfigType;
+
+/**
+ * @struct CanTp_RxNPduConfigType
+ * @brief N-SDUs behind one received CAN identifier (generated)
+ */
+typedef struct
+{
+    PduIdType rx_nsdu;                  /**< N-SDU of the SF / FF / CF, or CANTP_NO_NSDU */
+    PduIdType tx_nsdu;                  /**< N-SDU of the FC, or CANTP_NO_NSDU */
+} CanTp_RxNPduConfigType;
+
+/**
+ * @struct CanTp_TxNPduConfigType
+ * @brief N-SDU behind one TX confirmation handle (generated)
+ */
+typedef struct
+{
+    PduIdType nsdu;                     /**< RX N-SDU if flow_control, else TX N-SDU */
+    boolean flow_control;               /**< FC of a receiving N-SDU */
+} CanTp_TxNPduConfigType;
+
+#include "can_tp_cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief RX N-SDU configuration, indexed by CanTpConf_CanTpRxNSdu_* */
+extern const CanTp_RxNSduConfigType CanTp_RxNSdu[CANTP_RX_NSDU_COUNT];
+
+/** @brief TX N-SDU configuration, indexed by CanTpConf_CanTpTxNSdu_* */
+extern const CanTp_TxNSduConfigType CanTp_TxNSdu[CANTP_TX_NSDU_COUNT];
+
+/** @brief RX N-PDUs, indexed by CanTpConf_CanTpRxNPdu_* */
+extern const CanTp_RxNPduConfigType CanTp_RxNPdu[CANTP_RX_NPDU_COUNT];
+
+/** @brief TX N-PDUs, indexed by CanTpConf_CanTpTxNPdu_* */
+extern const CanTp_TxNPduConfigType CanTp_TxNPdu[CANTP_TX_NPDU_COUNT];
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize all N-SDUs to idle
+ *
+ * @serviceID CANTP_INIT_API_ID (0x01)
+ * @reentrancy Non-Reentrant
+ */
+extern void CanTp_Init(void);
+
+/**
+ * @brief Start the transmission of an N-SDU
+ * @param[in] TxPduId    TX N-SDU (CanTpConf_CanTpTxNSdu_*)
+ * @param[in] PduInfoPtr SduLength: total length; the data is fetched with PduR_CanTpCopyTxData()
+ * @return E_OK, or E_NOT_OK if the N-SDU is busy or on invalid parameters
+ *
+ * @serviceID CANTP_TRANSMIT_API_ID (0x49)
+ * @reentrancy Reentrant for different N-SDUs
+ */
+extern Std_ReturnType CanTp_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, CANTP_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Process a received frame (SF, FF, CF or FC)
+ * @param[in] RxPduId    RX N-PDU (CanTpConf_CanTpRxNPdu_*)
+ * @param[in] PduInfoPtr Frame of CAN_DL bytes
+ *
+ * @serviceID CANTP_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Reentrant for different N-PDUs
+ */
+extern void CanTp_RxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, CANTP_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Confirmation of a frame sent by CanTp
+ * @param[in] TxPduId TX N-PDU (CanTpConf_CanTpTxNPdu_*)
+ * @param[in] result  E_OK if the frame was sent
+ *
+ * @serviceID CANTP_TX_CONFIRMATION_API_ID (0x40)
+ * @reentrancy Reentrant for different N-PDUs
+ */
+extern void CanTp_TxConfirmation(PduIdType TxPduId, Std_ReturnType result);
+
+/**
+ * @brief Send the CFs due after STmin, retry pending segments and FCs,
+ *        and supervise the timeouts
+ *
+ * @serviceID CANTP_MAIN_FUNCTION_API_ID (0x06)
+ * @reentrancy Non-Reentrant
+ */
+extern void CanTp_MainFunction(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_TP_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
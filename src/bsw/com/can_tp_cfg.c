@@ -0,0 +1,82 @@
+/**
+ * @file    can_tp_cfg.c
+ * @brief   CanTp Configuration - N-SDU and N-PDU Tables
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static CanTp configuration of the VCU: RX and TX N-SDUs and the N-PDUs
+ * CanIf indicates and confirms them with.
+ *
+ * @note Generated by tools/cantp/cantp_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "can_tp.h"
+#include "pdu_router.h"
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const CanTp_RxNSduConfigType CanTp_RxNSdu[CANTP_RX_NSDU_COUNT] =
+{
+    {   /* UDS_PT_PhysReq_Rx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(50000UL), CANTP_US_TO_TICKS(150000UL),
+        PduRConf_PduRSrcPdu_UDS_PT_PhysReq, 63U, 0U, 0x00U, 8U, TRUE, FALSE
+    },
+    {   /* UDS_CH_PhysReq_Rx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(50000UL), CANTP_US_TO_TICKS(150000UL),
+        PduRConf_PduRSrcPdu_UDS_CH_PhysReq, 65U, 0U, 0x00U, 8U, TRUE, FALSE
+    },
+    {   /* UDS_BD_PhysReq_Rx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(50000UL), CANTP_US_TO_TICKS(150000UL),
+        PduRConf_PduRSrcPdu_UDS_BD_PhysReq, 67U, 16U, 0xF5U, 8U, TRUE, FALSE
+    },
+    {   /* UDS_FuncReq_Rx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(50000UL), CANTP_US_TO_TICKS(150000UL),
+        PduRConf_PduRSrcPdu_UDS_FuncReq, CANTP_NO_PDU, 0U, 0x00U, 0U, TRUE, TRUE
+    }
+};
+
+const CanTp_TxNSduConfigType CanTp_TxNSdu[CANTP_TX_NSDU_COUNT] =
+{
+    {   /* UDS_PT_Resp_Tx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(150000UL), CANTP_US_TO_TICKS(50000UL),
+        PduRConf_PduRDestPdu_UDS_PT_Resp_CanTp, 62U, 64U, TRUE
+    },
+    {   /* UDS_CH_Resp_Tx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(150000UL), CANTP_US_TO_TICKS(50000UL),
+        PduRConf_PduRDestPdu_UDS_CH_Resp_CanTp, 64U, 64U, TRUE
+    },
+    {   /* UDS_BD_Resp_Tx */
+        CANTP_US_TO_TICKS(70000UL), CANTP_US_TO_TICKS(150000UL), CANTP_US_TO_TICKS(50000UL),
+        PduRConf_PduRDestPdu_UDS_BD_Resp_CanTp, 66U, 64U, TRUE
+    }
+};
+
+const CanTp_RxNPduConfigType CanTp_RxNPdu[CANTP_RX_NPDU_COUNT] =
+{
+    { CanTpConf_CanTpRxNSdu_UDS_PT_PhysReq_Rx, CanTpConf_CanTpTxNSdu_UDS_PT_Resp_Tx    },  /* UDS_PT_Req_N */
+    { CanTpConf_CanTpRxNSdu_UDS_CH_PhysReq_Rx, CanTpConf_CanTpTxNSdu_UDS_CH_Resp_Tx    },  /* UDS_CH_Req_N */
+    { CanTpConf_CanTpRxNSdu_UDS_BD_PhysReq_Rx, CanTpConf_CanTpTxNSdu_UDS_BD_Resp_Tx    },  /* UDS_BD_Req_N */
+    { CanTpConf_CanTpRxNSdu_UDS_FuncReq_Rx,    CANTP_NO_NSDU                           }   /* UDS_FuncReq_N */
+};
+
+const CanTp_TxNPduConfigType CanTp_TxNPdu[CANTP_TX_NPDU_COUNT] =
+{
+    { CanTpConf_CanTpTxNSdu_UDS_PT_Resp_Tx,    FALSE },  /* UDS_PT_Resp_N */
+    { CanTpConf_CanTpRxNSdu_UDS_PT_PhysReq_Rx, TRUE  },  /* UDS_PT_Fc_N */
+    { CanTpConf_CanTpTxNSdu_UDS_CH_Resp_Tx,    FALSE },  /* UDS_CH_Resp_N */
+    { CanTpConf_CanTpRxNSdu_UDS_CH_PhysReq_Rx, TRUE  },  /* UDS_CH_Fc_N */
+    { CanTpConf_CanTpTxNSdu_UDS_BD_Resp_Tx,    FALSE },  /* UDS_BD_Resp_N */
+    { CanTpConf_CanTpRxNSdu_UDS_BD_PhysReq_Rx, TRUE  }   /* UDS_BD_Fc_N */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
@@ -0,0 +1,79 @@
+/**
+ * @file    can_tp_cfg.h
+ * @brief   CanTp Configuration - N-SDU and N-PDU Handles
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Handles of the ISO 15765-2 connections of the VCU (padding byte 0xCC):
+ *
+ * | N-SDU                | TA         | N-PDU            | Flow control     | TX_DL | BS | STmin  |
+ * |----------------------|------------|------------------|------------------|-------|----|--------|
+ * | UDS_PT_PhysReq_Rx    | physical   | UDS_PT_Req_N     | UDS_PT_Fc_N      | -     | 0  | 0 ms   |
+ * | UDS_CH_PhysReq_Rx    | physical   | UDS_CH_Req_N     | UDS_CH_Fc_N      | -     | 0  | 0 ms   |
+ * | UDS_BD_PhysReq_Rx    | physical   | UDS_BD_Req_N     | UDS_BD_Fc_N      | -     | 16 | 500 us |
+ * | UDS_FuncReq_Rx       | functional | UDS_FuncReq_N    | -                | -     | -  | -      |
+ * | UDS_PT_Resp_Tx       | physical   | UDS_PT_Resp_N    | UDS_PT_Req_N     | 64    | -  | -      |
+ * | UDS_CH_Resp_Tx       | physical   | UDS_CH_Resp_N    | UDS_CH_Req_N     | 64    | -  | -      |
+ * | UDS_BD_Resp_Tx       | physical   | UDS_BD_Resp_N    | UDS_BD_Req_N     | 64    | -  | -      |
+ *
+ * @note Generated by tools/cantp/cantp_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef CAN_TP_CFG_H
+#define CAN_TP_CFG_H
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define CANTP_RX_NSDU_COUNT                             4U
+#define CANTP_TX_NSDU_COUNT                             3U
+#define CANTP_RX_NPDU_COUNT                             4U
+#define CANTP_TX_NPDU_COUNT                             6U
+
+#define CANTP_PADDING_BYTE                              0xCCU
+
+/* ===============================================================================================
+ *                                        RX N-SDU HANDLES
+ * =============================================================================================== */
+
+#define CanTpConf_CanTpRxNSdu_UDS_PT_PhysReq_Rx         0U
+#define CanTpConf_CanTpRxNSdu_UDS_CH_PhysReq_Rx         1U
+#define CanTpConf_CanTpRxNSdu_UDS_BD_PhysReq_Rx         2U
+#define CanTpConf_CanTpRxNSdu_UDS_FuncReq_Rx            3U
+
+/* ===============================================================================================
+ *                               TX N-SDU HANDLES (CanTp_Transmit)
+ * =============================================================================================== */
+
+#define CanTpConf_CanTpTxNSdu_UDS_PT_Resp_Tx            0U
+#define CanTpConf_CanTpTxNSdu_UDS_CH_Resp_Tx            1U
+#define CanTpConf_CanTpTxNSdu_UDS_BD_Resp_Tx            2U
+
+/* ===============================================================================================
+ *                             RX N-PDU HANDLES (CanTp_RxIndication)
+ * =============================================================================================== */
+
+#define CanTpConf_CanTpRxNPdu_UDS_PT_Req_N              0U
+#define CanTpConf_CanTpRxNPdu_UDS_CH_Req_N              1U
+#define CanTpConf_CanTpRxNPdu_UDS_BD_Req_N              2U
+#define CanTpConf_CanTpRxNPdu_UDS_FuncReq_N             3U
+
+/* ===============================================================================================
+ *                            TX N-PDU HANDLES (CanTp_TxConfirmation)
+ * =============================================================================================== */
+
+#define CanTpConf_CanTpTxNPdu_UDS_PT_Resp_N             0U
+#define CanTpConf_CanTpTxNPdu_UDS_PT_Fc_N               1U
+#define CanTpConf_CanTpTxNPdu_UDS_CH_Resp_N             2U
+#define CanTpConf_CanTpTxNPdu_UDS_CH_Fc_N               3U
+#define CanTpConf_CanTpTxNPdu_UDS_BD_Resp_N             4U
+#define CanTpConf_CanTpTxNPdu_UDS_BD_Fc_N               5U
+
+#endif /* CAN_TP_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
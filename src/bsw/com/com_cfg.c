@@ -0,0 +1,2443 @@
+/**
+ * @file    com_cfg.c
+ * @brief   COM Configuration - Shadows, Kernels and Tables
+ * @version 1.3.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static COM configuration of the VCU: shadows, PDU buffers, the pack and
+ * unpack kernels of the I-PDUs and the I-PDU and signal tables.
+ *
+ * @note Generated by tools/com/com_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "com_stack.h"
+#include "com_pack.h"
+
+/*==================================================================================================
+*                                           SHADOW TYPES
+==================================================================================================*/
+
+/** @brief Signals of BMS_PackStatus */
+typedef struct
+{
+    uint32  BMS_EnergyRemaining;                /**< BE 20@186 */
+    uint16  BMS_PackVoltage;                    /**< BE 16@8 */
+    sint16  BMS_PackCurrent;                    /**< BE 16@24 */
+    uint16  BMS_StateOfCharge;                  /**< BE 10@46 */
+    uint16  BMS_StateOfHealth;                  /**< BE 10@52 */
+    uint16  BMS_MaxChargePower;                 /**< BE 12@72 */
+    uint16  BMS_MaxDischargePower;              /**< BE 12@92 */
+    uint16  BMS_IsolationResistance;            /**< BE 14@110 */
+    uint16  BMS_MaxCellVoltage;                 /**< BE 13@121 */
+    uint16  BMS_MinCellVoltage;                 /**< BE 13@140 */
+    uint16  BMS_CycleCount;                     /**< BE 16@202 */
+    sint8   BMS_MaxCellTemp;                    /**< BE 8@60 */
+    sint8   BMS_MinCellTemp;                    /**< BE 8@68 */
+    uint8   BMS_ContactorState;                 /**< BE 3@107 */
+    boolean BMS_BalancingActive;                /**< BE 1@106 */
+    uint8   BMS_FaultLevel;                     /**< BE 3@119 */
+    boolean BMS_ChargeRequest;                  /**< BE 1@118 */
+    uint8   BMS_MaxCellIndex;                   /**< BE 7@149 */
+    uint8   BMS_MinCellIndex;                   /**< BE 7@158 */
+    sint8   BMS_CoolantInletTemp;               /**< BE 8@166 */
+    sint8   BMS_CoolantOutletTemp;              /**< BE 8@174 */
+    uint8   BMS_PackStatusAliveCounter;         /**< BE 4@214 */
+    uint8   BMS_PackStatusCrc;                  /**< BE 8@222 */
+} Com_Shadow_BMS_PackStatusType;
+
+/** @brief Signals of BMS_CellVoltages1 */
+typedef struct
+{
+    uint16  BMS_CellVoltage001;                 /**< LE 13@0 */
+    uint16  BMS_CellVoltage002;                 /**< LE 13@13 */
+    uint16  BMS_CellVoltage003;                 /**< LE 13@26 */
+    uint16  BMS_CellVoltage004;                 /**< LE 13@39 */
+    uint16  BMS_CellVoltage005;                 /**< LE 13@52 */
+    uint16  BMS_CellVoltage006;                 /**< LE 13@65 */
+    uint16  BMS_CellVoltage007;                 /**< LE 13@78 */
+    uint16  BMS_CellVoltage008;                 /**< LE 13@91 */
+    uint16  BMS_CellVoltage009;                 /**< LE 13@104 */
+    uint16  BMS_CellVoltage010;                 /**< LE 13@117 */
+    uint16  BMS_CellVoltage011;                 /**< LE 13@130 */
+    uint16  BMS_CellVoltage012;                 /**< LE 13@143 */
+    uint16  BMS_CellVoltage013;                 /**< LE 13@156 */
+    uint16  BMS_CellVoltage014;                 /**< LE 13@169 */
+    uint16  BMS_CellVoltage015;                 /**< LE 13@182 */
+    uint16  BMS_CellVoltage016;                 /**< LE 13@195 */
+    uint16  BMS_CellVoltage017;                 /**< LE 13@208 */
+    uint16  BMS_CellVoltage018;                 /**< LE 13@221 */
+    uint16  BMS_CellVoltage019;                 /**< LE 13@234 */
+    uint16  BMS_CellVoltage020;                 /**< LE 13@247 */
+    uint16  BMS_CellVoltage021;                 /**< LE 13@260 */
+    uint16  BMS_CellVoltage022;                 /**< LE 13@273 */
+    uint16  BMS_CellVoltage023;                 /**< LE 13@286 */
+    uint16  BMS_CellVoltage024;                 /**< LE 13@299 */
+    uint16  BMS_CellVoltage025;                 /**< LE 13@312 */
+    uint16  BMS_CellVoltage026;                 /**< LE 13@325 */
+    uint16  BMS_CellVoltage027;                 /**< LE 13@338 */
+    uint16  BMS_CellVoltage028;                 /**< LE 13@351 */
+    uint16  BMS_CellVoltage029;                 /**< LE 13@364 */
+    uint16  BMS_CellVoltage030;                 /**< LE 13@377 */
+    uint16  BMS_CellVoltage031;                 /**< LE 13@390 */
+    uint16  BMS_CellVoltage032;                 /**< LE 13@403 */
+    uint8   BMS_CellVoltages1AliveCounter;      /**< LE 4@416 */
+    uint8   BMS_CellVoltages1Crc;               /**< LE 8@420 */
+} Com_Shadow_BMS_CellVoltages1Type;
+
+/** @brief Signals of BMS_CellVoltages2 */
+typedef struct
+{
+    uint16  BMS_CellVoltage033;                 /**< LE 13@0 */
+    uint16  BMS_CellVoltage034;                 /**< LE 13@13 */
+    uint16  BMS_CellVoltage035;                 /**< LE 13@26 */
+    uint16  BMS_CellVoltage036;                 /**< LE 13@39 */
+    uint16  BMS_CellVoltage037;                 /**< LE 13@52 */
+    uint16  BMS_CellVoltage038;                 /**< LE 13@65 */
+    uint16  BMS_CellVoltage039;                 /**< LE 13@78 */
+    uint16  BMS_CellVoltage040;                 /**< LE 13@91 */
+    uint16  BMS_CellVoltage041;                 /**< LE 13@104 */
+    uint16  BMS_CellVoltage042;                 /**< LE 13@117 */
+    uint16  BMS_CellVoltage043;                 /**< LE 13@130 */
+    uint16  BMS_CellVoltage044;                 /**< LE 13@143 */
+    uint16  BMS_CellVoltage045;                 /**< LE 13@156 */
+    uint16  BMS_CellVoltage046;                 /**< LE 13@169 */
+    uint16  BMS_CellVoltage047;                 /**< LE 13@182 */
+    uint16  BMS_CellVoltage048;                 /**< LE 13@195 */
+    uint16  BMS_CellVoltage049;                 /**< LE 13@208 */
+    uint16  BMS_CellVoltage050;                 /**< LE 13@221 */
+    uint16  BMS_CellVoltage051;                 /**< LE 13@234 */
+    uint16  BMS_CellVoltage052;                 /**< LE 13@247 */
+    uint16  BMS_CellVoltage053;                 /**< LE 13@260 */
+    uint16  BMS_CellVoltage054;                 /**< LE 13@273 */
+    uint16  BMS_CellVoltage055;                 /**< LE 13@286 */
+    uint16  BMS_CellVoltage056;                 /**< LE 13@299 */
+    uint16  BMS_CellVoltage057;                 /**< LE 13@312 */
+    uint16  BMS_CellVoltage058;                 /**< LE 13@325 */
+    uint16  BMS_CellVoltage059;                 /**< LE 13@338 */
+    uint16  BMS_CellVoltage060;                 /**< LE 13@351 */
+    uint16  BMS_CellVoltage061;                 /**< LE 13@364 */
+    uint16  BMS_CellVoltage062;                 /**< LE 13@377 */
+    uint16  BMS_CellVoltage063;                 /**< LE 13@390 */
+    uint16  BMS_CellVoltage064;                 /**< LE 13@403 */
+    uint8   BMS_CellVoltages2AliveCounter;      /**< LE 4@416 */
+    uint8   BMS_CellVoltages2Crc;               /**< LE 8@420 */
+} Com_Shadow_BMS_CellVoltages2Type;
+
+/** @brief Signals of BMS_CellVoltages3 */
+typedef struct
+{
+    uint16  BMS_CellVoltage065;                 /**< LE 13@0 */
+    uint16  BMS_CellVoltage066;                 /**< LE 13@13 */
+    uint16  BMS_CellVoltage067;                 /**< LE 13@26 */
+    uint16  BMS_CellVoltage068;                 /**< LE 13@39 */
+    uint16  BMS_CellVoltage069;                 /**< LE 13@52 */
+    uint16  BMS_CellVoltage070;                 /**< LE 13@65 */
+    uint16  BMS_CellVoltage071;                 /**< LE 13@78 */
+    uint16  BMS_CellVoltage072;                 /**< LE 13@91 */
+    uint16  BMS_CellVoltage073;                 /**< LE 13@104 */
+    uint16  BMS_CellVoltage074;                 /**< LE 13@117 */
+    uint16  BMS_CellVoltage075;                 /**< LE 13@130 */
+    uint16  BMS_CellVoltage076;                 /**< LE 13@143 */
+    uint16  BMS_CellVoltage077;                 /**< LE 13@156 */
+    uint16  BMS_CellVoltage078;                 /**< LE 13@169 */
+    uint16  BMS_CellVoltage079;                 /**< LE 13@182 */
+    uint16  BMS_CellVoltage080;                 /**< LE 13@195 */
+    uint16  BMS_CellVoltage081;                 /**< LE 13@208 */
+    uint16  BMS_CellVoltage082;                 /**< LE 13@221 */
+    uint16  BMS_CellVoltage083;                 /**< LE 13@234 */
+    uint16  BMS_CellVoltage084;                 /**< LE 13@247 */
+    uint16  BMS_CellVoltage085;                 /**< LE 13@260 */
+    uint16  BMS_CellVoltage086;                 /**< LE 13@273 */
+    uint16  BMS_CellVoltage087;                 /**< LE 13@286 */
+    uint16  BMS_CellVoltage088;                 /**< LE 13@299 */
+    uint16  BMS_CellVoltage089;                 /**< LE 13@312 */
+    uint16  BMS_CellVoltage090;                 /**< LE 13@325 */
+    uint16  BMS_CellVoltage091;                 /**< LE 13@338 */
+    uint16  BMS_CellVoltage092;                 /**< LE 13@351 */
+    uint16  BMS_CellVoltage093;                 /**< LE 13@364 */
+    uint16  BMS_CellVoltage094;                 /**< LE 13@377 */
+    uint16  BMS_CellVoltage095;                 /**< LE 13@390 */
+    uint16  BMS_CellVoltage096;                 /**< LE 13@403 */
+    uint8   BMS_CellVoltages3AliveCounter;      /**< LE 4@416 */
+    uint8   BMS_CellVoltages3Crc;               /**< LE 8@420 */
+} Com_Shadow_BMS_CellVoltages3Type;
+
+/** @brief Signals of BMS_CellTemps */
+typedef struct
+{
+    sint8   BMS_CellTemp01;                     /**< LE 8@0 */
+    sint8   BMS_CellTemp02;                     /**< LE 8@8 */
+    sint8   BMS_CellTemp03;                     /**< LE 8@16 */
+    sint8   BMS_CellTemp04;                     /**< LE 8@24 */
+    sint8   BMS_CellTemp05;                     /**< LE 8@32 */
+    sint8   BMS_CellTemp06;                     /**< LE 8@40 */
+    sint8   BMS_CellTemp07;                     /**< LE 8@48 */
+    sint8   BMS_CellTemp08;                     /**< LE 8@56 */
+    sint8   BMS_CellTemp09;                     /**< LE 8@64 */
+    sint8   BMS_CellTemp10;                     /**< LE 8@72 */
+    sint8   BMS_CellTemp11;                     /**< LE 8@80 */
+    sint8   BMS_CellTemp12;                     /**< LE 8@88 */
+    sint8   BMS_CellTemp13;                     /**< LE 8@96 */
+    sint8   BMS_CellTemp14;                     /**< LE 8@104 */
+    sint8   BMS_CellTemp15;                     /**< LE 8@112 */
+    sint8   BMS_CellTemp16;                     /**< LE 8@120 */
+    sint8   BMS_CellTemp17;                     /**< LE 8@128 */
+    sint8   BMS_CellTemp18;                     /**< LE 8@136 */
+    sint8   BMS_CellTemp19;                     /**< LE 8@144 */
+    sint8   BMS_CellTemp20;                     /**< LE 8@152 */
+    sint8   BMS_CellTemp21;                     /**< LE 8@160 */
+    sint8   BMS_CellTemp22;                     /**< LE 8@168 */
+    sint8   BMS_CellTemp23;                     /**< LE 8@176 */
+    sint8   BMS_CellTemp24;                     /**< LE 8@184 */
+    sint8   BMS_CellTemp25;                     /**< LE 8@192 */
+    sint8   BMS_CellTemp26;                     /**< LE 8@200 */
+    sint8   BMS_CellTemp27;                     /**< LE 8@208 */
+    sint8   BMS_CellTemp28;                     /**< LE 8@216 */
+    sint8   BMS_CellTemp29;                     /**< LE 8@224 */
+    sint8   BMS_CellTemp30;                     /**< LE 8@232 */
+    sint8   BMS_CellTemp31;                     /**< LE 8@240 */
+    sint8   BMS_CellTemp32;                     /**< LE 8@248 */
+    sint8   BMS_CellTemp33;                     /**< LE 8@256 */
+    sint8   BMS_CellTemp34;                     /**< LE 8@264 */
+    sint8   BMS_CellTemp35;                     /**< LE 8@272 */
+    sint8   BMS_CellTemp36;                     /**< LE 8@280 */
+    sint8   BMS_CellTemp37;                     /**< LE 8@288 */
+    sint8   BMS_CellTemp38;                     /**< LE 8@296 */
+    sint8   BMS_CellTemp39;                     /**< LE 8@304 */
+    sint8   BMS_CellTemp40;                     /**< LE 8@312 */
+    sint8   BMS_CellTemp41;                     /**< LE 8@320 */
+    sint8   BMS_CellTemp42;                     /**< LE 8@328 */
+    sint8   BMS_CellTemp43;                     /**< LE 8@336 */
+    sint8   BMS_CellTemp44;                     /**< LE 8@344 */
+    sint8   BMS_CellTemp45;                     /**< LE 8@352 */
+    sint8   BMS_CellTemp46;                     /**< LE 8@360 */
+    sint8   BMS_CellTemp47;                     /**< LE 8@368 */
+    sint8   BMS_CellTemp48;                     /**< LE 8@376 */
+    uint8   BMS_CellTempsAliveCounter;          /**< LE 4@384 */
+    uint8   BMS_CellTempsCrc;                   /**< LE 8@388 */
+} Com_Shadow_BMS_CellTempsType;
+
+/** @brief Signals of MCU_Status */
+typedef struct
+{
+    sint16  MCU_MotorSpeed;                     /**< BE 16@8 */
+    sint16  MCU_MotorTorque;                    /**< BE 14@26 */
+    uint16  MCU_DcVoltage;                      /**< BE 12@46 */
+    sint16  MCU_DcCurrent;                      /**< BE 12@50 */
+    uint16  MCU_FaultCode;                      /**< BE 10@82 */
+    uint16  MCU_TorqueLimitMotor;               /**< BE 12@102 */
+    uint16  MCU_TorqueLimitGen;                 /**< BE 12@106 */
+    uint16  MCU_PhaseCurrentRms;                /**< BE 11@127 */
+    uint16  MCU_RotorPosition;                  /**< BE 12@131 */
+    sint8   MCU_InverterTemp;                   /**< BE 8@58 */
+    sint8   MCU_MotorTemp;                      /**< BE 8@66 */
+    uint8   MCU_State;                          /**< BE 4@78 */
+    boolean MCU_Derating;                       /**< BE 1@77 */
+    boolean MCU_ActiveDischarge;                /**< BE 1@76 */
+    sint8   MCU_GateDriverTemp;                 /**< BE 8@139 */
+    uint8   MCU_StatusAliveCounter;             /**< BE 4@151 */
+    uint8   MCU_StatusCrc;                      /**< BE 8@159 */
+} Com_Shadow_MCU_StatusType;
+
+/** @brief Signals of ESP_WheelSpeeds */
+typedef struct
+{
+    uint16  ESP_WheelSpeedFL;                   /**< BE 13@11 */
+    uint16  ESP_WheelSpeedFR;                   /**< BE 13@30 */
+    uint16  ESP_WheelSpeedRL;                   /**< BE 13@33 */
+    uint16  ESP_WheelSpeedRR;                   /**< BE 13@52 */
+    uint8   ESP_WheelSpeedsAliveCounter;        /**< BE 4@48 */
+    uint8   ESP_WheelSpeedsCrc;                 /**< BE 8@56 */
+} Com_Shadow_ESP_WheelSpeedsType;
+
+/** @brief Signals of ESP_Dynamics */
+typedef struct
+{
+    sint16  ESP_YawRate;                        /**< BE 12@12 */
+    sint16  ESP_LateralAccel;                   /**< BE 10@18 */
+    sint16  ESP_LongitudinalAccel;              /**< BE 10@24 */
+    uint16  ESP_BrakePressure;                  /**< BE 12@44 */
+    boolean ESP_AbsActive;                      /**< BE 1@43 */
+    boolean ESP_TcsActive;                      /**< BE 1@42 */
+    boolean ESP_EspActive;                      /**< BE 1@41 */
+    boolean ESP_RegenAllowed;                   /**< BE 1@40 */
+    uint8   ESP_RegenTorqueLimit;               /**< BE 4@52 */
+    uint8   ESP_DynamicsAliveCounter;           /**< BE 4@48 */
+    uint8   ESP_DynamicsCrc;                    /**< BE 8@56 */
+} Com_Shadow_ESP_DynamicsType;
+
+/** @brief Signals of SAS_Steering */
+typedef struct
+{
+    sint16  SAS_Angle;                          /**< LE 16@0 */
+    uint16  SAS_Speed;                          /**< LE 12@16 */
+    sint16  SAS_TorsionTorque;                  /**< LE 10@30 */
+    uint16  SAS_Reserved;                       /**< LE 10@40 */
+    boolean SAS_Calibrated;                     /**< LE 1@28 */
+    boolean SAS_Fault;                          /**< LE 1@29 */
+    uint8   SAS_SteeringAliveCounter;           /**< LE 4@50 */
+    uint8   SAS_SteeringCrc;                    /**< LE 8@54 */
+} Com_Shadow_SAS_SteeringType;
+
+/** @brief Signals of APS_Pedals */
+typedef struct
+{
+    uint16  APS_AccelPedal1;                    /**< LE 10@0 */
+    uint16  APS_AccelPedal2;                    /**< LE 10@10 */
+    uint16  APS_BrakePedal;                     /**< LE 10@20 */
+    boolean APS_BrakeSwitch;                    /**< LE 1@30 */
+    boolean APS_KickDown;                       /**< LE 1@31 */
+    uint8   APS_PlausibilityFault;              /**< LE 2@32 */
+    uint8   APS_CruiseButtons;                  /**< LE 6@34 */
+    uint8   APS_Reserved;                       /**< LE 8@40 */
+    uint8   APS_PedalsAliveCounter;             /**< LE 4@48 */
+    uint8   APS_PedalsCrc;                      /**< LE 8@52 */
+} Com_Shadow_APS_PedalsType;
+
+/** @brief Signals of GW_VehicleInfo */
+typedef struct
+{
+    uint32  GW_Odometer;                        /**< LE 28@0 */
+    uint32  GW_TimeOfDay;                       /**< LE 17@59 */
+    uint32  GW_Reserved;                        /**< LE 22@85 */
+    uint16  GW_HvacPowerRequest;                /**< LE 12@47 */
+    sint8   GW_AmbientTemp;                     /**< LE 8@28 */
+    uint8   GW_DoorState;                       /**< LE 5@36 */
+    boolean GW_SeatBeltDriver;                  /**< LE 1@41 */
+    uint8   GW_KeyPosition;                     /**< LE 2@42 */
+    uint8   GW_DriveModeRequest;                /**< LE 3@44 */
+    boolean GW_VehicleLocked;                   /**< LE 1@76 */
+    boolean GW_ChargePortOpen;                  /**< LE 1@77 */
+    uint8   GW_UserChargeLimit;                 /**< LE 7@78 */
+    uint8   GW_VehicleInfoAliveCounter;         /**< LE 4@107 */
+    uint8   GW_VehicleInfoCrc;                  /**< LE 8@111 */
+} Com_Shadow_GW_VehicleInfoType;
+
+/** @brief Signals of OBC_Status */
+typedef struct
+{
+    uint16  OBC_AcVoltage;                      /**< BE 10@14 */
+    uint16  OBC_AcCurrent;                      /**< BE 10@20 */
+    uint16  OBC_DcVoltage;                      /**< BE 12@24 */
+    uint16  OBC_DcCurrent;                      /**< BE 12@44 */
+    uint16  OBC_FaultCode;                      /**< BE 10@75 */
+    uint16  OBC_MaxPower;                       /**< BE 14@93 */
+    uint8   OBC_State;                          /**< BE 4@40 */
+    boolean OBC_PlugDetected;                   /**< BE 1@55 */
+    uint8   OBC_ProximityPilot;                 /**< BE 3@52 */
+    uint8   OBC_ControlPilotDuty;               /**< BE 7@61 */
+    sint8   OBC_Temperature;                    /**< BE 8@69 */
+    uint8   OBC_StatusAliveCounter;             /**< BE 4@89 */
+    uint8   OBC_StatusCrc;                      /**< BE 8@97 */
+} Com_Shadow_OBC_StatusType;
+
+/** @brief Signals of DCDC_Status */
+typedef struct
+{
+    uint16  DCDC_OutputVoltage;                 /**< LE 10@0 */
+    uint16  DCDC_OutputCurrent;                 /**< LE 10@10 */
+    uint16  DCDC_InputVoltage;                  /**< LE 12@20 */
+    sint8   DCDC_Temperature;                   /**< LE 8@32 */
+    uint8   DCDC_State;                         /**< LE 3@40 */
+    boolean DCDC_Fault;                         /**< LE 1@43 */
+    boolean DCDC_Derating;                      /**< LE 1@44 */
+    uint8   DCDC_Reserved;                      /**< LE 7@45 */
+    uint8   DCDC_StatusAliveCounter;            /**< LE 4@52 */
+    uint8   DCDC_StatusCrc;                     /**< LE 8@56 */
+} Com_Shadow_DCDC_StatusType;
+
+/** @brief Signals of VCU_TorqueRequest */
+typedef struct
+{
+    sint16  VCU_MotorTorqueRequest;             /**< BE 14@10 */
+    uint16  VCU_MotorSpeedLimitFwd;             /**< BE 16@26 */
+    uint16  VCU_MotorSpeedLimitRev;             /**< BE 16@42 */
+    uint16  VCU_TorqueLimitMotor;               /**< BE 12@62 */
+    uint16  VCU_TorqueLimitGen;                 /**< BE 12@66 */
+    sint16  VCU_RegenTorque;                    /**< BE 12@90 */
+    boolean VCU_InverterEnable;                 /**< BE 1@65 */
+    uint8   VCU_ControlMode;                    /**< BE 3@78 */
+    boolean VCU_ActiveDischargeReq;             /**< BE 1@77 */
+    uint8   VCU_DampingGain;                    /**< BE 7@86 */
+    uint8   VCU_TorqueRequestAliveCounter;      /**< BE 4@102 */
+    uint8   VCU_TorqueRequestCrc;               /**< BE 8@110 */
+} Com_Shadow_VCU_TorqueRequestType;
+
+/** @brief Signals of VCU_Status */
+typedef struct
+{
+    uint32  VCU_OperatingHours;                 /**< LE 24@93 */
+    uint16  VCU_VehicleSpeed;                   /**< LE 13@0 */
+    uint16  VCU_LvVoltage;                      /**< LE 10@24 */
+    uint16  VCU_ActiveFaults;                   /**< LE 16@38 */
+    uint16  VCU_RangeEstimate;                  /**< LE 10@54 */
+    uint16  VCU_EnergyConsumption;              /**< LE 12@64 */
+    uint16  VCU_SoftwareVersion;                /**< LE 16@117 */
+    uint8   VCU_DriveMode;                      /**< LE 3@13 */
+    uint8   VCU_GearActual;                     /**< LE 3@16 */
+    boolean VCU_ReadyToDrive;                   /**< LE 1@19 */
+    uint8   VCU_HvState;                        /**< LE 4@20 */
+    uint8   VCU_PowerMode;                      /**< LE 3@34 */
+    boolean VCU_DerateActive;                   /**< LE 1@37 */
+    boolean VCU_CreepEnabled;                   /**< LE 1@76 */
+    uint8   VCU_RegenLevel;                     /**< LE 2@77 */
+    uint8   VCU_ChargeState;                    /**< LE 4@79 */
+    uint8   VCU_ThermalState;                   /**< LE 4@83 */
+    uint8   VCU_WakeupReason;                   /**< LE 5@87 */
+    boolean VCU_KeepAwake;                      /**< LE 1@92 */
+    uint8   VCU_StatusAliveCounter;             /**< LE 4@133 */
+    uint8   VCU_StatusCrc;                      /**< LE 8@137 */
+} Com_Shadow_VCU_StatusType;
+
+/** @brief Signals of VCU_PowertrainData */
+typedef struct
+{
+    uint64  PT_Timestamp;                       /**< LE 40@309 */
+    sint32  PT_MotorPowerMech;                  /**< LE 18@86 */
+    sint32  PT_MotorPowerElec;                  /**< LE 18@104 */
+    uint32  PT_EnergyTotal;                     /**< LE 32@245 */
+    uint32  PT_EnergyRegen;                     /**< LE 32@277 */
+    uint32  PT_DistanceTrip;                    /**< LE 24@349 */
+    sint16  PT_WheelTorqueFL;                   /**< LE 14@0 */
+    sint16  PT_WheelTorqueFR;                   /**< LE 14@14 */
+    sint16  PT_WheelTorqueRL;                   /**< LE 14@28 */
+    sint16  PT_WheelTorqueRR;                   /**< LE 14@42 */
+    sint16  PT_AxleTorqueFront;                 /**< LE 15@56 */
+    sint16  PT_AxleTorqueRear;                  /**< LE 15@71 */
+    uint16  PT_BatteryPowerLimitChg;            /**< LE 16@122 */
+    uint16  PT_BatteryPowerLimitDis;            /**< LE 16@138 */
+    uint16  PT_EfficiencyEstimate;              /**< LE 10@154 */
+    sint16  PT_SlipFront;                       /**< LE 9@164 */
+    sint16  PT_SlipRear;                        /**< LE 9@173 */
+    sint16  PT_YawTorqueRequest;                /**< LE 13@182 */
+    sint16  PT_CoastTorque;                     /**< LE 10@206 */
+    uint16  PT_VehicleMass;                     /**< LE 14@216 */
+    sint16  PT_RoadGradient;                    /**< LE 9@230 */
+    sint16  PT_AccelEstimate;                   /**< LE 12@373 */
+    sint16  PT_ShaftOscillation;                /**< LE 11@393 */
+    uint8   PT_PedalMap;                        /**< LE 3@195 */
+    uint8   PT_CreepTorque;                     /**< LE 8@198 */
+    boolean PT_TractionLimited;                 /**< LE 1@239 */
+    boolean PT_ThermalLimited;                  /**< LE 1@240 */
+    boolean PT_BatteryLimited;                  /**< LE 1@241 */
+    uint8   PT_TorqueSource;                    /**< LE 3@242 */
+    uint8   PT_JerkLimit;                       /**< LE 8@385 */
+    uint8   VCU_PowertrainDataAliveCounter;     /**< LE 4@404 */
+    uint8   VCU_PowertrainDataCrc;              /**< LE 8@408 */
+} Com_Shadow_VCU_PowertrainDataType;
+
+/** @brief Signals of VCU_PowertrainDataMot */
+typedef struct
+{
+    uint64  PTM_Timestamp;                      /**< BE 40@347 */
+    sint32  PTM_MotorPowerMech;                 /**< BE 18@96 */
+    sint32  PTM_MotorPowerElec;                 /**< BE 18@126 */
+    uint32  PTM_EnergyTotal;                    /**< BE 32@275 */
+    uint32  PTM_EnergyRegen;                    /**< BE 32@307 */
+    uint32  PTM_DistanceTrip;                   /**< BE 24@371 */
+    sint16  PTM_WheelTorqueFL;                  /**< BE 14@10 */
+    sint16  PTM_WheelTorqueFR;                  /**< BE 14@28 */
+    sint16  PTM_WheelTorqueRL;                  /**< BE 14@46 */
+    sint16  PTM_WheelTorqueRR;                  /**< BE 14@48 */
+    sint16  PTM_AxleTorqueFront;                /**< BE 15@65 */
+    sint16  PTM_AxleTorqueRear;                 /**< BE 15@82 */
+    uint16  PTM_BatteryPowerLimitChg;           /**< BE 16@142 */
+    uint16  PTM_BatteryPowerLimitDis;           /**< BE 16@158 */
+    uint16  PTM_EfficiencyEstimate;             /**< BE 10@164 */
+    sint16  PTM_SlipFront;                      /**< BE 9@171 */
+    sint16  PTM_SlipRear;                       /**< BE 9@178 */
+    sint16  PTM_YawTorqueRequest;               /**< BE 13@197 */
+    sint16  PTM_CoastTorque;                    /**< BE 10@208 */
+    uint16  PTM_VehicleMass;                    /**< BE 14@226 */
+    sint16  PTM_RoadGradient;                   /**< BE 9@233 */
+    sint16  PTM_AccelEstimate;                  /**< BE 12@391 */
+    sint16  PTM_ShaftOscillation;               /**< BE 11@404 */
+    uint8   PTM_PedalMap;                       /**< BE 3@194 */
+    uint8   PTM_CreepTorque;                    /**< BE 8@202 */
+    boolean PTM_TractionLimited;                /**< BE 1@232 */
+    boolean PTM_ThermalLimited;                 /**< BE 1@247 */
+    boolean PTM_BatteryLimited;                 /**< BE 1@246 */
+    uint8   PTM_TorqueSource;                   /**< BE 3@243 */
+    uint8   PTM_JerkLimit;                      /**< BE 8@399 */
+    uint8   VCU_PowertrainDataMotAliveCounter;  /**< BE 4@400 */
+    uint8   VCU_PowertrainDataMotCrc;           /**< BE 8@408 */
+} Com_Shadow_VCU_PowertrainDataMotType;
+
+/** @brief Signals of VCU_ChargeControl */
+typedef struct
+{
+    uint16  VCU_ChargeVoltageTarget;            /**< BE 13@10 */
+    uint16  VCU_ChargeCurrentLimit;             /**< BE 12@30 */
+    uint16  VCU_ChargeTimeRemaining;            /**< BE 10@44 */
+    uint16  VCU_ChargePowerLimit;               /**< BE 14@62 */
+    boolean VCU_ChargeEnable;                   /**< BE 1@7 */
+    uint8   VCU_ChargeMode;                     /**< BE 3@27 */
+    boolean VCU_PlugLock;                       /**< BE 1@26 */
+    boolean VCU_PrechargeRequest;               /**< BE 1@25 */
+    uint8   VCU_ContactorRequest;               /**< BE 3@38 */
+    boolean VCU_V2lEnable;                      /**< BE 1@61 */
+    uint8   VCU_ChargeControlAliveCounter;      /**< BE 4@57 */
+    uint8   VCU_ChargeControlCrc;               /**< BE 8@65 */
+} Com_Shadow_VCU_ChargeControlType;
+
+/** @brief Signals of VCU_ThermalRequest */
+typedef struct
+{
+    uint16  VCU_HeaterPower;                    /**< LE 10@22 */
+    uint8   VCU_PumpSpeedBattery;               /**< LE 7@0 */
+    uint8   VCU_PumpSpeedMotor;                 /**< LE 7@7 */
+    uint8   VCU_FanSpeed;                       /**< LE 7@14 */
+    boolean VCU_ChillerRequest;                 /**< LE 1@21 */
+    uint8   VCU_ValvePosition;                  /**< LE 8@32 */
+    sint8   VCU_TargetBatteryTemp;              /**< LE 8@40 */
+    uint8   VCU_ThermalRequestAliveCounter;     /**< LE 4@48 */
+    uint8   VCU_ThermalRequestCrc;              /**< LE 8@52 */
+} Com_Shadow_VCU_ThermalRequestType;
+
+/** @brief Signals of VCU_DcdcControl */
+typedef struct
+{
+    uint16  VCU_DcdcVoltageTarget;              /**< LE 10@1 */
+    uint16  VCU_DcdcCurrentLimit;               /**< LE 10@11 */
+    boolean VCU_DcdcEnable;                     /**< LE 1@0 */
+    uint8   VCU_DcdcMode;                       /**< LE 2@21 */
+    uint8   VCU_DcdcControlAliveCounter;        /**< LE 4@23 */
+    uint8   VCU_DcdcControlCrc;                 /**< LE 8@27 */
+} Com_Shadow_VCU_DcdcControlType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC uint8 Com_Pdu_BMS_PackStatus[32U] ALIGNED(8);
+STATIC uint8 Com_Pdu_BMS_CellVoltages1[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_BMS_CellVoltages2[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_BMS_CellVoltages3[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_BMS_CellTemps[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_MCU_Status[24U] ALIGNED(8);
+STATIC uint8 Com_Pdu_ESP_WheelSpeeds[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_ESP_Dynamics[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_SAS_Steering[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_APS_Pedals[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_GW_VehicleInfo[16U] ALIGNED(8);
+STATIC uint8 Com_Pdu_OBC_Status[16U] ALIGNED(8);
+STATIC uint8 Com_Pdu_DCDC_Status[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_TorqueRequest[16U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_Status[32U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_PowertrainData[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_PowertrainDataMot[64U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_ChargeControl[16U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_ThermalRequest[8U] ALIGNED(8);
+STATIC uint8 Com_Pdu_VCU_DcdcControl[8U] ALIGNED(8);
+
+STATIC Com_Shadow_BMS_PackStatusType Com_Shadow_BMS_PackStatus;
+STATIC Com_Shadow_BMS_CellVoltages1Type Com_Shadow_BMS_CellVoltages1;
+STATIC Com_Shadow_BMS_CellVoltages2Type Com_Shadow_BMS_CellVoltages2;
+STATIC Com_Shadow_BMS_CellVoltages3Type Com_Shadow_BMS_CellVoltages3;
+STATIC Com_Shadow_BMS_CellTempsType Com_Shadow_BMS_CellTemps;
+STATIC Com_Shadow_MCU_StatusType Com_Shadow_MCU_Status;
+STATIC Com_Shadow_ESP_WheelSpeedsType Com_Shadow_ESP_WheelSpeeds;
+STATIC Com_Shadow_ESP_DynamicsType Com_Shadow_ESP_Dynamics;
+STATIC Com_Shadow_SAS_SteeringType Com_Shadow_SAS_Steering;
+STATIC Com_Shadow_APS_PedalsType Com_Shadow_APS_Pedals;
+STATIC Com_Shadow_GW_VehicleInfoType Com_Shadow_GW_VehicleInfo;
+STATIC Com_Shadow_OBC_StatusType Com_Shadow_OBC_Status;
+STATIC Com_Shadow_DCDC_StatusType Com_Shadow_DCDC_Status;
+STATIC Com_Shadow_VCU_TorqueRequestType Com_Shadow_VCU_TorqueRequest;
+STATIC Com_Shadow_VCU_StatusType Com_Shadow_VCU_Status;
+STATIC Com_Shadow_VCU_PowertrainDataType Com_Shadow_VCU_PowertrainData;
+STATIC Com_Shadow_VCU_PowertrainDataMotType Com_Shadow_VCU_PowertrainDataMot;
+STATIC Com_Shadow_VCU_ChargeControlType Com_Shadow_VCU_ChargeControl;
+STATIC Com_Shadow_VCU_ThermalRequestType Com_Shadow_VCU_ThermalRequest;
+STATIC Com_Shadow_VCU_DcdcControlType Com_Shadow_VCU_DcdcControl;
+
+/*==================================================================================================
+*                                         LOCAL CONSTANTS
+==================================================================================================*/
+
+static const Com_Shadow_BMS_PackStatusType Com_ShadowInit_BMS_PackStatus =
+{
+    0UL, 0U, 0, 0U, 1000U, 0U, 0U, 0U, 0U, 0U, 0U, -40, -40, 0U, FALSE, 0U, FALSE, 0U, 0U, -40,
+    -40, 0U, 0U
+};
+
+static const Com_Shadow_BMS_CellVoltages1Type Com_ShadowInit_BMS_CellVoltages1 =
+{
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_BMS_CellVoltages2Type Com_ShadowInit_BMS_CellVoltages2 =
+{
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_BMS_CellVoltages3Type Com_ShadowInit_BMS_CellVoltages3 =
+{
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_BMS_CellTempsType Com_ShadowInit_BMS_CellTemps =
+{
+    -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40,
+    -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40,
+    -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, -40, 0U, 0U
+};
+
+static const Com_Shadow_MCU_StatusType Com_ShadowInit_MCU_Status =
+{
+    0, 0, 0U, 0, 0U, 0U, 0U, 0U, 0U, -40, -40, 0U, FALSE, FALSE, -40, 0U, 0U
+};
+
+static const Com_Shadow_ESP_WheelSpeedsType Com_ShadowInit_ESP_WheelSpeeds =
+{
+    0U, 0U, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_ESP_DynamicsType Com_ShadowInit_ESP_Dynamics =
+{
+    0, 0, 0, 0U, FALSE, FALSE, FALSE, TRUE, 0U, 0U, 0U
+};
+
+static const Com_Shadow_SAS_SteeringType Com_ShadowInit_SAS_Steering =
+{
+    0, 0U, 0, 0U, FALSE, FALSE, 0U, 0U
+};
+
+static const Com_Shadow_APS_PedalsType Com_ShadowInit_APS_Pedals =
+{
+    0U, 0U, 0U, FALSE, FALSE, 0U, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_GW_VehicleInfoType Com_ShadowInit_GW_VehicleInfo =
+{
+    0UL, 0UL, 0UL, 0U, -40, 0U, FALSE, 0U, 0U, FALSE, FALSE, 80U, 0U, 0U
+};
+
+static const Com_Shadow_OBC_StatusType Com_ShadowInit_OBC_Status =
+{
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, FALSE, 0U, 0U, -40, 0U, 0U
+};
+
+static const Com_Shadow_DCDC_StatusType Com_ShadowInit_DCDC_Status =
+{
+    0U, 0U, 0U, -40, 0U, FALSE, FALSE, 0U, 0U, 0U
+};
+
+static const Com_Shadow_VCU_TorqueRequestType Com_ShadowInit_VCU_TorqueRequest =
+{
+    0, 0U, 0U, 0U, 0U, 0, FALSE, 0U, FALSE, 0U, 0U, 0U
+};
+
+static const Com_Shadow_VCU_StatusType Com_ShadowInit_VCU_Status =
+{
+    0UL, 0U, 0U, 0U, 0U, 0U, 256U, 0U, 0U, FALSE, 0U, 0U, FALSE, TRUE, 1U, 0U, 0U, 0U, FALSE,
+    0U, 0U
+};
+
+static const Com_Shadow_VCU_PowertrainDataType Com_ShadowInit_VCU_PowertrainData =
+{
+    0ULL, 0L, 0L, 0UL, 0UL, 0UL, 0, 0, 0, 0, 0, 0, 0U, 0U, 0U, 0, 0, 0, 0, 0U, 0, 0, 0, 0U, 0U,
+    FALSE, FALSE, FALSE, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_VCU_PowertrainDataMotType Com_ShadowInit_VCU_PowertrainDataMot =
+{
+    0ULL, 0L, 0L, 0UL, 0UL, 0UL, 0, 0, 0, 0, 0, 0, 0U, 0U, 0U, 0, 0, 0, 0, 0U, 0, 0, 0, 0U, 0U,
+    FALSE, FALSE, FALSE, 0U, 0U, 0U, 0U
+};
+
+static const Com_Shadow_VCU_ChargeControlType Com_ShadowInit_VCU_ChargeControl =
+{
+    0U, 0U, 0U, 0U, FALSE, 0U, FALSE, FALSE, 0U, FALSE, 0U, 0U
+};
+
+static const Com_Shadow_VCU_ThermalRequestType Com_ShadowInit_VCU_ThermalRequest =
+{
+    0U, 0U, 0U, 0U, FALSE, 0U, 25, 0U, 0U
+};
+
+static const Com_Shadow_VCU_DcdcControlType Com_ShadowInit_VCU_DcdcControl =
+{
+    140U, 0U, FALSE, 0U, 0U, 0U
+};
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Unpack the shadow from I-PDU BMS_PackStatus (32 bytes, 23 signals)
+ */
+STATIC void Com_Unpack_BMS_PackStatus(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_BMS_PackStatus;
+    P2VAR(Com_Shadow_BMS_PackStatusType, AUTOMATIC, COM_VAR) s = &Com_Shadow_BMS_PackStatus;
+    uint32 be0, be1, be2, be3, be4, be5, be6;
+
+    be0 = Com_LoadBe32(&pdu[0]);
+    s->BMS_PackVoltage = (uint16)(be0 >> 16);
+    s->BMS_PackCurrent = (sint16)(be0 & 0x0000FFFFUL);
+    be1 = Com_LoadBe32(&pdu[4]);
+    s->BMS_StateOfCharge = (uint16)(be1 >> 22);
+    s->BMS_StateOfHealth = (uint16)((be1 >> 12) & 0x000003FFUL);
+    s->BMS_MaxCellTemp = (sint8)((be1 >> 4) & 0x000000FFUL);
+    be2 = Com_LoadBe32(&pdu[8]);
+    s->BMS_MinCellTemp = (sint8)((be2 >> 28) | ((be1 & 0x0000000FUL) << 4));
+    s->BMS_MaxChargePower = (uint16)((be2 >> 16) & 0x00000FFFUL);
+    s->BMS_MaxDischargePower = (uint16)((be2 >> 4) & 0x00000FFFUL);
+    be3 = Com_LoadBe32(&pdu[12]);
+    s->BMS_IsolationResistance = (uint16)((be3 >> 22) | ((be2 & 0x0000000FUL) << 10));
+    s->BMS_ContactorState = (uint8)((be3 >> 19) & 0x00000007UL);
+    s->BMS_BalancingActive = (boolean)((be3 >> 18) & 0x00000001UL);
+    s->BMS_FaultLevel = (uint8)((be3 >> 15) & 0x00000007UL);
+    s->BMS_ChargeRequest = (boolean)((be3 >> 14) & 0x00000001UL);
+    s->BMS_MaxCellVoltage = (uint16)((be3 >> 1) & 0x00001FFFUL);
+    be4 = Com_LoadBe32(&pdu[16]);
+    s->BMS_MinCellVoltage = (uint16)((be4 >> 20) | ((be3 & 0x00000001UL) << 12));
+    s->BMS_MaxCellIndex = (uint8)((be4 >> 13) & 0x0000007FUL);
+    s->BMS_MinCellIndex = (uint8)((be4 >> 6) & 0x0000007FUL);
+    be5 = Com_LoadBe32(&pdu[20]);
+    s->BMS_CoolantInletTemp = (sint8)((be5 >> 30) | ((be4 & 0x0000003FUL) << 2));
+    s->BMS_CoolantOutletTemp = (sint8)((be5 >> 22) & 0x000000FFUL);
+    s->BMS_EnergyRemaining = (uint32)((be5 >> 2) & 0x000FFFFFUL);
+    be6 = Com_LoadBe32(&pdu[24]);
+    s->BMS_CycleCount = (uint16)((be6 >> 18) | ((be5 & 0x00000003UL) << 14));
+    s->BMS_PackStatusAliveCounter = (uint8)((be6 >> 14) & 0x0000000FUL);
+    s->BMS_PackStatusCrc = (uint8)((be6 >> 6) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU BMS_CellVoltages1 (64 bytes, 34 signals)
+ */
+STATIC void Com_Unpack_BMS_CellVoltages1(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_BMS_CellVoltages1;
+    P2VAR(Com_Shadow_BMS_CellVoltages1Type, AUTOMATIC, COM_VAR) s = &Com_Shadow_BMS_CellVoltages1;
+    uint32 le0, le1, le2, le3, le4, le5, le6, le7, le8, le9, le10, le11, le12, le13;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->BMS_CellVoltage001 = (uint16)(le0 & 0x00001FFFUL);
+    s->BMS_CellVoltage002 = (uint16)((le0 >> 13) & 0x00001FFFUL);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->BMS_CellVoltage003 = (uint16)((le0 >> 26) | ((le1 & 0x0000007FUL) << 6));
+    s->BMS_CellVoltage004 = (uint16)((le1 >> 7) & 0x00001FFFUL);
+    le2 = Com_LoadLe32(&pdu[8]);
+    s->BMS_CellVoltage005 = (uint16)((le1 >> 20) | ((le2 & 0x00000001UL) << 12));
+    s->BMS_CellVoltage006 = (uint16)((le2 >> 1) & 0x00001FFFUL);
+    s->BMS_CellVoltage007 = (uint16)((le2 >> 14) & 0x00001FFFUL);
+    le3 = Com_LoadLe32(&pdu[12]);
+    s->BMS_CellVoltage008 = (uint16)((le2 >> 27) | ((le3 & 0x000000FFUL) << 5));
+    s->BMS_CellVoltage009 = (uint16)((le3 >> 8) & 0x00001FFFUL);
+    le4 = Com_LoadLe32(&pdu[16]);
+    s->BMS_CellVoltage010 = (uint16)((le3 >> 21) | ((le4 & 0x00000003UL) << 11));
+    s->BMS_CellVoltage011 = (uint16)((le4 >> 2) & 0x00001FFFUL);
+    s->BMS_CellVoltage012 = (uint16)((le4 >> 15) & 0x00001FFFUL);
+    le5 = Com_LoadLe32(&pdu[20]);
+    s->BMS_CellVoltage013 = (uint16)((le4 >> 28) | ((le5 & 0x000001FFUL) << 4));
+    s->BMS_CellVoltage014 = (uint16)((le5 >> 9) & 0x00001FFFUL);
+    le6 = Com_LoadLe32(&pdu[24]);
+    s->BMS_CellVoltage015 = (uint16)((le5 >> 22) | ((le6 & 0x00000007UL) << 10));
+    s->BMS_CellVoltage016 = (uint16)((le6 >> 3) & 0x00001FFFUL);
+    s->BMS_CellVoltage017 = (uint16)((le6 >> 16) & 0x00001FFFUL);
+    le7 = Com_LoadLe32(&pdu[28]);
+    s->BMS_CellVoltage018 = (uint16)((le6 >> 29) | ((le7 & 0x000003FFUL) << 3));
+    s->BMS_CellVoltage019 = (uint16)((le7 >> 10) & 0x00001FFFUL);
+    le8 = Com_LoadLe32(&pdu[32]);
+    s->BMS_CellVoltage020 = (uint16)((le7 >> 23) | ((le8 & 0x0000000FUL) << 9));
+    s->BMS_CellVoltage021 = (uint16)((le8 >> 4) & 0x00001FFFUL);
+    s->BMS_CellVoltage022 = (uint16)((le8 >> 17) & 0x00001FFFUL);
+    le9 = Com_LoadLe32(&pdu[36]);
+    s->BMS_CellVoltage023 = (uint16)((le8 >> 30) | ((le9 & 0x000007FFUL) << 2));
+    s->BMS_CellVoltage024 = (uint16)((le9 >> 11) & 0x00001FFFUL);
+    le10 = Com_LoadLe32(&pdu[40]);
+    s->BMS_CellVoltage025 = (uint16)((le9 >> 24) | ((le10 & 0x0000001FUL) << 8));
+    s->BMS_CellVoltage026 = (uint16)((le10 >> 5) & 0x00001FFFUL);
+    s->BMS_CellVoltage027 = (uint16)((le10 >> 18) & 0x00001FFFUL);
+    le11 = Com_LoadLe32(&pdu[44]);
+    s->BMS_CellVoltage028 = (uint16)((le10 >> 31) | ((le11 & 0x00000FFFUL) << 1));
+    s->BMS_CellVoltage029 = (uint16)((le11 >> 12) & 0x00001FFFUL);
+    le12 = Com_LoadLe32(&pdu[48]);
+    s->BMS_CellVoltage030 = (uint16)((le11 >> 25) | ((le12 & 0x0000003FUL) << 7));
+    s->BMS_CellVoltage031 = (uint16)((le12 >> 6) & 0x00001FFFUL);
+    s->BMS_CellVoltage032 = (uint16)(le12 >> 19);
+    le13 = Com_LoadLe32(&pdu[52]);
+    s->BMS_CellVoltages1AliveCounter = (uint8)(le13 & 0x0000000FUL);
+    s->BMS_CellVoltages1Crc = (uint8)((le13 >> 4) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU BMS_CellVoltages2 (64 bytes, 34 signals)
+ */
+STATIC void Com_Unpack_BMS_CellVoltages2(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_BMS_CellVoltages2;
+    P2VAR(Com_Shadow_BMS_CellVoltages2Type, AUTOMATIC, COM_VAR) s = &Com_Shadow_BMS_CellVoltages2;
+    uint32 le0, le1, le2, le3, le4, le5, le6, le7, le8, le9, le10, le11, le12, le13;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->BMS_CellVoltage033 = (uint16)(le0 & 0x00001FFFUL);
+    s->BMS_CellVoltage034 = (uint16)((le0 >> 13) & 0x00001FFFUL);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->BMS_CellVoltage035 = (uint16)((le0 >> 26) | ((le1 & 0x0000007FUL) << 6));
+    s->BMS_CellVoltage036 = (uint16)((le1 >> 7) & 0x00001FFFUL);
+    le2 = Com_LoadLe32(&pdu[8]);
+    s->BMS_CellVoltage037 = (uint16)((le1 >> 20) | ((le2 & 0x00000001UL) << 12));
+    s->BMS_CellVoltage038 = (uint16)((le2 >> 1) & 0x00001FFFUL);
+    s->BMS_CellVoltage039 = (uint16)((le2 >> 14) & 0x00001FFFUL);
+    le3 = Com_LoadLe32(&pdu[12]);
+    s->BMS_CellVoltage040 = (uint16)((le2 >> 27) | ((le3 & 0x000000FFUL) << 5));
+    s->BMS_CellVoltage041 = (uint16)((le3 >> 8) & 0x00001FFFUL);
+    le4 = Com_LoadLe32(&pdu[16]);
+    s->BMS_CellVoltage042 = (uint16)((le3 >> 21) | ((le4 & 0x00000003UL) << 11));
+    s->BMS_CellVoltage043 = (uint16)((le4 >> 2) & 0x00001FFFUL);
+    s->BMS_CellVoltage044 = (uint16)((le4 >> 15) & 0x00001FFFUL);
+    le5 = Com_LoadLe32(&pdu[20]);
+    s->BMS_CellVoltage045 = (uint16)((le4 >> 28) | ((le5 & 0x000001FFUL) << 4));
+    s->BMS_CellVoltage046 = (uint16)((le5 >> 9) & 0x00001FFFUL);
+    le6 = Com_LoadLe32(&pdu[24]);
+    s->BMS_CellVoltage047 = (uint16)((le5 >> 22) | ((le6 & 0x00000007UL) << 10));
+    s->BMS_CellVoltage048 = (uint16)((le6 >> 3) & 0x00001FFFUL);
+    s->BMS_CellVoltage049 = (uint16)((le6 >> 16) & 0x00001FFFUL);
+    le7 = Com_LoadLe32(&pdu[28]);
+    s->BMS_CellVoltage050 = (uint16)((le6 >> 29) | ((le7 & 0x000003FFUL) << 3));
+    s->BMS_CellVoltage051 = (uint16)((le7 >> 10) & 0x00001FFFUL);
+    le8 = Com_LoadLe32(&pdu[32]);
+    s->BMS_CellVoltage052 = (uint16)((le7 >> 23) | ((le8 & 0x0000000FUL) << 9));
+    s->BMS_CellVoltage053 = (uint16)((le8 >> 4) & 0x00001FFFUL);
+    s->BMS_CellVoltage054 = (uint16)((le8 >> 17) & 0x00001FFFUL);
+    le9 = Com_LoadLe32(&pdu[36]);
+    s->BMS_CellVoltage055 = (uint16)((le8 >> 30) | ((le9 & 0x000007FFUL) << 2));
+    s->BMS_CellVoltage056 = (uint16)((le9 >> 11) & 0x00001FFFUL);
+    le10 = Com_LoadLe32(&pdu[40]);
+    s->BMS_CellVoltage057 = (uint16)((le9 >> 24) | ((le10 & 0x0000001FUL) << 8));
+    s->BMS_CellVoltage058 = (uint16)((le10 >> 5) & 0x00001FFFUL);
+    s->BMS_CellVoltage059 = (uint16)((le10 >> 18) & 0x00001FFFUL);
+    le11 = Com_LoadLe32(&pdu[44]);
+    s->BMS_CellVoltage060 = (uint16)((le10 >> 31) | ((le11 & 0x00000FFFUL) << 1));
+    s->BMS_CellVoltage061 = (uint16)((le11 >> 12) & 0x00001FFFUL);
+    le12 = Com_LoadLe32(&pdu[48]);
+    s->BMS_CellVoltage062 = (uint16)((le11 >> 25) | ((le12 & 0x0000003FUL) << 7));
+    s->BMS_CellVoltage063 = (uint16)((le12 >> 6) & 0x00001FFFUL);
+    s->BMS_CellVoltage064 = (uint16)(le12 >> 19);
+    le13 = Com_LoadLe32(&pdu[52]);
+    s->BMS_CellVoltages2AliveCounter = (uint8)(le13 & 0x0000000FUL);
+    s->BMS_CellVoltages2Crc = (uint8)((le13 >> 4) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU BMS_CellVoltages3 (64 bytes, 34 signals)
+ */
+STATIC void Com_Unpack_BMS_CellVoltages3(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_BMS_CellVoltages3;
+    P2VAR(Com_Shadow_BMS_CellVoltages3Type, AUTOMATIC, COM_VAR) s = &Com_Shadow_BMS_CellVoltages3;
+    uint32 le0, le1, le2, le3, le4, le5, le6, le7, le8, le9, le10, le11, le12, le13;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->BMS_CellVoltage065 = (uint16)(le0 & 0x00001FFFUL);
+    s->BMS_CellVoltage066 = (uint16)((le0 >> 13) & 0x00001FFFUL);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->BMS_CellVoltage067 = (uint16)((le0 >> 26) | ((le1 & 0x0000007FUL) << 6));
+    s->BMS_CellVoltage068 = (uint16)((le1 >> 7) & 0x00001FFFUL);
+    le2 = Com_LoadLe32(&pdu[8]);
+    s->BMS_CellVoltage069 = (uint16)((le1 >> 20) | ((le2 & 0x00000001UL) << 12));
+    s->BMS_CellVoltage070 = (uint16)((le2 >> 1) & 0x00001FFFUL);
+    s->BMS_CellVoltage071 = (uint16)((le2 >> 14) & 0x00001FFFUL);
+    le3 = Com_LoadLe32(&pdu[12]);
+    s->BMS_CellVoltage072 = (uint16)((le2 >> 27) | ((le3 & 0x000000FFUL) << 5));
+    s->BMS_CellVoltage073 = (uint16)((le3 >> 8) & 0x00001FFFUL);
+    le4 = Com_LoadLe32(&pdu[16]);
+    s->BMS_CellVoltage074 = (uint16)((le3 >> 21) | ((le4 & 0x00000003UL) << 11));
+    s->BMS_CellVoltage075 = (uint16)((le4 >> 2) & 0x00001FFFUL);
+    s->BMS_CellVoltage076 = (uint16)((le4 >> 15) & 0x00001FFFUL);
+    le5 = Com_LoadLe32(&pdu[20]);
+    s->BMS_CellVoltage077 = (uint16)((le4 >> 28) | ((le5 & 0x000001FFUL) << 4));
+    s->BMS_CellVoltage078 = (uint16)((le5 >> 9) & 0x00001FFFUL);
+    le6 = Com_LoadLe32(&pdu[24]);
+    s->BMS_CellVoltage079 = (uint16)((le5 >> 22) | ((le6 & 0x00000007UL) << 10));
+    s->BMS_CellVoltage080 = (uint16)((le6 >> 3) & 0x00001FFFUL);
+    s->BMS_CellVoltage081 = (uint16)((le6 >> 16) & 0x00001FFFUL);
+    le7 = Com_LoadLe32(&pdu[28]);
+    s->BMS_CellVoltage082 = (uint16)((le6 >> 29) | ((le7 & 0x000003FFUL) << 3));
+    s->BMS_CellVoltage083 = (uint16)((le7 >> 10) & 0x00001FFFUL);
+    le8 = Com_LoadLe32(&pdu[32]);
+    s->BMS_CellVoltage084 = (uint16)((le7 >> 23) | ((le8 & 0x0000000FUL) << 9));
+    s->BMS_CellVoltage085 = (uint16)((le8 >> 4) & 0x00001FFFUL);
+    s->BMS_CellVoltage086 = (uint16)((le8 >> 17) & 0x00001FFFUL);
+    le9 = Com_LoadLe32(&pdu[36]);
+    s->BMS_CellVoltage087 = (uint16)((le8 >> 30) | ((le9 & 0x000007FFUL) << 2));
+    s->BMS_CellVoltage088 = (uint16)((le9 >> 11) & 0x00001FFFUL);
+    le10 = Com_LoadLe32(&pdu[40]);
+    s->BMS_CellVoltage089 = (uint16)((le9 >> 24) | ((le10 & 0x0000001FUL) << 8));
+    s->BMS_CellVoltage090 = (uint16)((le10 >> 5) & 0x00001FFFUL);
+    s->BMS_CellVoltage091 = (uint16)((le10 >> 18) & 0x00001FFFUL);
+    le11 = Com_LoadLe32(&pdu[44]);
+    s->BMS_CellVoltage092 = (uint16)((le10 >> 31) | ((le11 & 0x00000FFFUL) << 1));
+    s->BMS_CellVoltage093 = (uint16)((le11 >> 12) & 0x00001FFFUL);
+    le12 = Com_LoadLe32(&pdu[48]);
+    s->BMS_CellVoltage094 = (uint16)((le11 >> 25) | ((le12 & 0x0000003FUL) << 7));
+    s->BMS_CellVoltage095 = (uint16)((le12 >> 6) & 0x00001FFFUL);
+    s->BMS_CellVoltage096 = (uint16)(le12 >> 19);
+    le13 = Com_LoadLe32(&pdu[52]);
+    s->BMS_CellVoltages3AliveCounter = (uint8)(le13 & 0x0000000FUL);
+    s->BMS_CellVoltages3Crc = (uint8)((le13 >> 4) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU BMS_CellTemps (64 bytes, 50 signals)
+ */
+STATIC void Com_Unpack_BMS_CellTemps(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_BMS_CellTemps;
+    P2VAR(Com_Shadow_BMS_CellTempsType, AUTOMATIC, COM_VAR) s = &Com_Shadow_BMS_CellTemps;
+    uint32 le0, le1, le2, le3, le4, le5, le6, le7, le8, le9, le10, le11, le12;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->BMS_CellTemp01 = (sint8)(le0 & 0x000000FFUL);
+    s->BMS_CellTemp02 = (sint8)((le0 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp03 = (sint8)((le0 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp04 = (sint8)(le0 >> 24);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->BMS_CellTemp05 = (sint8)(le1 & 0x000000FFUL);
+    s->BMS_CellTemp06 = (sint8)((le1 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp07 = (sint8)((le1 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp08 = (sint8)(le1 >> 24);
+    le2 = Com_LoadLe32(&pdu[8]);
+    s->BMS_CellTemp09 = (sint8)(le2 & 0x000000FFUL);
+    s->BMS_CellTemp10 = (sint8)((le2 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp11 = (sint8)((le2 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp12 = (sint8)(le2 >> 24);
+    le3 = Com_LoadLe32(&pdu[12]);
+    s->BMS_CellTemp13 = (sint8)(le3 & 0x000000FFUL);
+    s->BMS_CellTemp14 = (sint8)((le3 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp15 = (sint8)((le3 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp16 = (sint8)(le3 >> 24);
+    le4 = Com_LoadLe32(&pdu[16]);
+    s->BMS_CellTemp17 = (sint8)(le4 & 0x000000FFUL);
+    s->BMS_CellTemp18 = (sint8)((le4 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp19 = (sint8)((le4 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp20 = (sint8)(le4 >> 24);
+    le5 = Com_LoadLe32(&pdu[20]);
+    s->BMS_CellTemp21 = (sint8)(le5 & 0x000000FFUL);
+    s->BMS_CellTemp22 = (sint8)((le5 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp23 = (sint8)((le5 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp24 = (sint8)(le5 >> 24);
+    le6 = Com_LoadLe32(&pdu[24]);
+    s->BMS_CellTemp25 = (sint8)(le6 & 0x000000FFUL);
+    s->BMS_CellTemp26 = (sint8)((le6 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp27 = (sint8)((le6 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp28 = (sint8)(le6 >> 24);
+    le7 = Com_LoadLe32(&pdu[28]);
+    s->BMS_CellTemp29 = (sint8)(le7 & 0x000000FFUL);
+    s->BMS_CellTemp30 = (sint8)((le7 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp31 = (sint8)((le7 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp32 = (sint8)(le7 >> 24);
+    le8 = Com_LoadLe32(&pdu[32]);
+    s->BMS_CellTemp33 = (sint8)(le8 & 0x000000FFUL);
+    s->BMS_CellTemp34 = (sint8)((le8 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp35 = (sint8)((le8 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp36 = (sint8)(le8 >> 24);
+    le9 = Com_LoadLe32(&pdu[36]);
+    s->BMS_CellTemp37 = (sint8)(le9 & 0x000000FFUL);
+    s->BMS_CellTemp38 = (sint8)((le9 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp39 = (sint8)((le9 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp40 = (sint8)(le9 >> 24);
+    le10 = Com_LoadLe32(&pdu[40]);
+    s->BMS_CellTemp41 = (sint8)(le10 & 0x000000FFUL);
+    s->BMS_CellTemp42 = (sint8)((le10 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp43 = (sint8)((le10 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp44 = (sint8)(le10 >> 24);
+    le11 = Com_LoadLe32(&pdu[44]);
+    s->BMS_CellTemp45 = (sint8)(le11 & 0x000000FFUL);
+    s->BMS_CellTemp46 = (sint8)((le11 >> 8) & 0x000000FFUL);
+    s->BMS_CellTemp47 = (sint8)((le11 >> 16) & 0x000000FFUL);
+    s->BMS_CellTemp48 = (sint8)(le11 >> 24);
+    le12 = Com_LoadLe32(&pdu[48]);
+    s->BMS_CellTempsAliveCounter = (uint8)(le12 & 0x0000000FUL);
+    s->BMS_CellTempsCrc = (uint8)((le12 >> 4) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU MCU_Status (24 bytes, 17 signals)
+ */
+STATIC void Com_Unpack_MCU_Status(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_MCU_Status;
+    P2VAR(Com_Shadow_MCU_StatusType, AUTOMATIC, COM_VAR) s = &Com_Shadow_MCU_Status;
+    uint32 be0, be1, be2, be3, be4;
+
+    be0 = Com_LoadBe32(&pdu[0]);
+    s->MCU_MotorSpeed = (sint16)(be0 >> 16);
+    s->MCU_MotorTorque = (sint16)((sint32)(((be0 >> 2) & 0x00003FFFUL) ^ 0x00002000UL) - 0x00002000L);
+    be1 = Com_LoadBe32(&pdu[4]);
+    s->MCU_DcVoltage = (uint16)((be1 >> 22) | ((be0 & 0x00000003UL) << 10));
+    s->MCU_DcCurrent = (sint16)((sint32)(((be1 >> 10) & 0x00000FFFUL) ^ 0x00000800UL) - 0x00000800L);
+    s->MCU_InverterTemp = (sint8)((be1 >> 2) & 0x000000FFUL);
+    be2 = Com_LoadBe32(&pdu[8]);
+    s->MCU_MotorTemp = (sint8)((be2 >> 26) | ((be1 & 0x00000003UL) << 6));
+    s->MCU_State = (uint8)((be2 >> 22) & 0x0000000FUL);
+    s->MCU_Derating = (boolean)((be2 >> 21) & 0x00000001UL);
+    s->MCU_ActiveDischarge = (boolean)((be2 >> 20) & 0x00000001UL);
+    s->MCU_FaultCode = (uint16)((be2 >> 10) & 0x000003FFUL);
+    be3 = Com_LoadBe32(&pdu[12]);
+    s->MCU_TorqueLimitMotor = (uint16)((be3 >> 30) | ((be2 & 0x000003FFUL) << 2));
+    s->MCU_TorqueLimitGen = (uint16)((be3 >> 18) & 0x00000FFFUL);
+    s->MCU_PhaseCurrentRms = (uint16)((be3 >> 7) & 0x000007FFUL);
+    be4 = Com_LoadBe32(&pdu[16]);
+    s->MCU_RotorPosition = (uint16)((be4 >> 27) | ((be3 & 0x0000007FUL) << 5));
+    s->MCU_GateDriverTemp = (sint8)((be4 >> 19) & 0x000000FFUL);
+    s->MCU_StatusAliveCounter = (uint8)((be4 >> 15) & 0x0000000FUL);
+    s->MCU_StatusCrc = (uint8)((be4 >> 7) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU ESP_WheelSpeeds (8 bytes, 6 signals)
+ */
+STATIC void Com_Unpack_ESP_WheelSpeeds(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_ESP_WheelSpeeds;
+    P2VAR(Com_Shadow_ESP_WheelSpeedsType, AUTOMATIC, COM_VAR) s = &Com_Shadow_ESP_WheelSpeeds;
+    uint32 be0, be1;
+
+    be0 = Com_LoadBe32(&pdu[0]);
+    s->ESP_WheelSpeedFL = (uint16)(be0 >> 19);
+    s->ESP_WheelSpeedFR = (uint16)((be0 >> 6) & 0x00001FFFUL);
+    be1 = Com_LoadBe32(&pdu[4]);
+    s->ESP_WheelSpeedRL = (uint16)((be1 >> 25) | ((be0 & 0x0000003FUL) << 7));
+    s->ESP_WheelSpeedRR = (uint16)((be1 >> 12) & 0x00001FFFUL);
+    s->ESP_WheelSpeedsAliveCounter = (uint8)((be1 >> 8) & 0x0000000FUL);
+    s->ESP_WheelSpeedsCrc = (uint8)(be1 & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU ESP_Dynamics (8 bytes, 11 signals)
+ */
+STATIC void Com_Unpack_ESP_Dynamics(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_ESP_Dynamics;
+    P2VAR(Com_Shadow_ESP_DynamicsType, AUTOMATIC, COM_VAR) s = &Com_Shadow_ESP_Dynamics;
+    uint32 be0, be1;
+
+    be0 = Com_LoadBe32(&pdu[0]);
+    s->ESP_YawRate = (sint16)((sint32)((be0 >> 20) ^ 0x00000800UL) - 0x00000800L);
+    s->ESP_LateralAccel = (sint16)((sint32)(((be0 >> 10) & 0x000003FFUL) ^ 0x00000200UL) - 0x00000200L);
+    s->ESP_LongitudinalAccel = (sint16)((sint32)((be0 & 0x000003FFUL) ^ 0x00000200UL) - 0x00000200L);
+    be1 = Com_LoadBe32(&pdu[4]);
+    s->ESP_BrakePressure = (uint16)(be1 >> 20);
+    s->ESP_AbsActive = (boolean)((be1 >> 19) & 0x00000001UL);
+    s->ESP_TcsActive = (boolean)((be1 >> 18) & 0x00000001UL);
+    s->ESP_EspActive = (boolean)((be1 >> 17) & 0x00000001UL);
+    s->ESP_RegenAllowed = (boolean)((be1 >> 16) & 0x00000001UL);
+    s->ESP_RegenTorqueLimit = (uint8)((be1 >> 12) & 0x0000000FUL);
+    s->ESP_DynamicsAliveCounter = (uint8)((be1 >> 8) & 0x0000000FUL);
+    s->ESP_DynamicsCrc = (uint8)(be1 & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU SAS_Steering (8 bytes, 8 signals)
+ */
+STATIC void Com_Unpack_SAS_Steering(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_SAS_Steering;
+    P2VAR(Com_Shadow_SAS_SteeringType, AUTOMATIC, COM_VAR) s = &Com_Shadow_SAS_Steering;
+    uint32 le0, le1;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->SAS_Angle = (sint16)(le0 & 0x0000FFFFUL);
+    s->SAS_Speed = (uint16)((le0 >> 16) & 0x00000FFFUL);
+    s->SAS_Calibrated = (boolean)((le0 >> 28) & 0x00000001UL);
+    s->SAS_Fault = (boolean)((le0 >> 29) & 0x00000001UL);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->SAS_TorsionTorque = (sint16)((sint32)(((le0 >> 30) | ((le1 & 0x000000FFUL) << 2)) ^ 0x00000200UL) - 0x00000200L);
+    s->SAS_Reserved = (uint16)((le1 >> 8) & 0x000003FFUL);
+    s->SAS_SteeringAliveCounter = (uint8)((le1 >> 18) & 0x0000000FUL);
+    s->SAS_SteeringCrc = (uint8)((le1 >> 22) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU APS_Pedals (8 bytes, 10 signals)
+ */
+STATIC void Com_Unpack_APS_Pedals(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_APS_Pedals;
+    P2VAR(Com_Shadow_APS_PedalsType, AUTOMATIC, COM_VAR) s = &Com_Shadow_APS_Pedals;
+    uint32 le0, le1;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->APS_AccelPedal1 = (uint16)(le0 & 0x000003FFUL);
+    s->APS_AccelPedal2 = (uint16)((le0 >> 10) & 0x000003FFUL);
+    s->APS_BrakePedal = (uint16)((le0 >> 20) & 0x000003FFUL);
+    s->APS_BrakeSwitch = (boolean)((le0 >> 30) & 0x00000001UL);
+    s->APS_KickDown = (boolean)(le0 >> 31);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->APS_PlausibilityFault = (uint8)(le1 & 0x00000003UL);
+    s->APS_CruiseButtons = (uint8)((le1 >> 2) & 0x0000003FUL);
+    s->APS_Reserved = (uint8)((le1 >> 8) & 0x000000FFUL);
+    s->APS_PedalsAliveCounter = (uint8)((le1 >> 16) & 0x0000000FUL);
+    s->APS_PedalsCrc = (uint8)((le1 >> 20) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU GW_VehicleInfo (16 bytes, 14 signals)
+ */
+STATIC void Com_Unpack_GW_VehicleInfo(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_GW_VehicleInfo;
+    P2VAR(Com_Shadow_GW_VehicleInfoType, AUTOMATIC, COM_VAR) s = &Com_Shadow_GW_VehicleInfo;
+    uint32 le0, le1, le2, le3;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->GW_Odometer = (uint32)(le0 & 0x0FFFFFFFUL);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->GW_AmbientTemp = (sint8)((le0 >> 28) | ((le1 & 0x0000000FUL) << 4));
+    s->GW_DoorState = (uint8)((le1 >> 4) & 0x0000001FUL);
+    s->GW_SeatBeltDriver = (boolean)((le1 >> 9) & 0x00000001UL);
+    s->GW_KeyPosition = (uint8)((le1 >> 10) & 0x00000003UL);
+    s->GW_DriveModeRequest = (uint8)((le1 >> 12) & 0x00000007UL);
+    s->GW_HvacPowerRequest = (uint16)((le1 >> 15) & 0x00000FFFUL);
+    le2 = Com_LoadLe32(&pdu[8]);
+    s->GW_TimeOfDay = (uint32)((le1 >> 27) | ((le2 & 0x00000FFFUL) << 5));
+    s->GW_VehicleLocked = (boolean)((le2 >> 12) & 0x00000001UL);
+    s->GW_ChargePortOpen = (boolean)((le2 >> 13) & 0x00000001UL);
+    s->GW_UserChargeLimit = (uint8)((le2 >> 14) & 0x0000007FUL);
+    le3 = Com_LoadLe32(&pdu[12]);
+    s->GW_Reserved = (uint32)((le2 >> 21) | ((le3 & 0x000007FFUL) << 11));
+    s->GW_VehicleInfoAliveCounter = (uint8)((le3 >> 11) & 0x0000000FUL);
+    s->GW_VehicleInfoCrc = (uint8)((le3 >> 15) & 0x000000FFUL);
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU OBC_Status (16 bytes, 13 signals)
+ */
+STATIC void Com_Unpack_OBC_Status(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_OBC_Status;
+    P2VAR(Com_Shadow_OBC_StatusType, AUTOMATIC, COM_VAR) s = &Com_Shadow_OBC_Status;
+    uint32 be0, be1, be2, be3;
+
+    be0 = Com_LoadBe32(&pdu[0]);
+    s->OBC_AcVoltage = (uint16)(be0 >> 22);
+    s->OBC_AcCurrent = (uint16)((be0 >> 12) & 0x000003FFUL);
+    s->OBC_DcVoltage = (uint16)(be0 & 0x00000FFFUL);
+    be1 = Com_LoadBe32(&pdu[4]);
+    s->OBC_DcCurrent = (uint16)(be1 >> 20);
+    s->OBC_State = (uint8)((be1 >> 16) & 0x0000000FUL);
+    s->OBC_PlugDetected = (boolean)((be1 >> 15) & 0x00000001UL);
+    s->OBC_ProximityPilot = (uint8)((be1 >> 12) & 0x00000007UL);
+    s->OBC_ControlPilotDuty = (uint8)((be1 >> 5) & 0x0000007FUL);
+    be2 = Com_LoadBe32(&pdu[8]);
+    s->OBC_Temperature = (sint8)((be2 >> 29) | ((be1 & 0x0000001FUL) << 3));
+    s->OBC_FaultCode = (uint16)((be2 >> 19) & 0x000003FFUL);
+    s->OBC_MaxPower = (uint16)((be2 >> 5) & 0x00003FFFUL);
+    s->OBC_StatusAliveCounter = (uint8)((be2 >> 1) & 0x0000000FUL);
+    be3 = Com_LoadBe32(&pdu[12]);
+    s->OBC_StatusCrc = (uint8)((be3 >> 25) | ((be2 & 0x00000001UL) << 7));
+}
+
+/**
+ * @brief Unpack the shadow from I-PDU DCDC_Status (8 bytes, 10 signals)
+ */
+STATIC void Com_Unpack_DCDC_Status(void)
+{
+    P2CONST(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_DCDC_Status;
+    P2VAR(Com_Shadow_DCDC_StatusType, AUTOMATIC, COM_VAR) s = &Com_Shadow_DCDC_Status;
+    uint32 le0, le1;
+
+    le0 = Com_LoadLe32(&pdu[0]);
+    s->DCDC_OutputVoltage = (uint16)(le0 & 0x000003FFUL);
+    s->DCDC_OutputCurrent = (uint16)((le0 >> 10) & 0x000003FFUL);
+    s->DCDC_InputVoltage = (uint16)(le0 >> 20);
+    le1 = Com_LoadLe32(&pdu[4]);
+    s->DCDC_Temperature = (sint8)(le1 & 0x000000FFUL);
+    s->DCDC_State = (uint8)((le1 >> 8) & 0x00000007UL);
+    s->DCDC_Fault = (boolean)((le1 >> 11) & 0x00000001UL);
+    s->DCDC_Derating = (boolean)((le1 >> 12) & 0x00000001UL);
+    s->DCDC_Reserved = (uint8)((le1 >> 13) & 0x0000007FUL);
+    s->DCDC_StatusAliveCounter = (uint8)((le1 >> 20) & 0x0000000FUL);
+    s->DCDC_StatusCrc = (uint8)(le1 >> 24);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_TorqueRequest (16 bytes, 12 signals)
+ */
+STATIC void Com_Pack_VCU_TorqueRequest(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_TorqueRequest;
+    P2CONST(Com_Shadow_VCU_TorqueRequestType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_TorqueRequest;
+    uint32 w;
+
+    /* Be32 @ 0: VCU_MotorTorqueRequest, VCU_MotorSpeedLimitFwd, VCU_MotorSpeedLimitRev[14..15] */
+    w = (uint32)s->VCU_MotorTorqueRequest << 18;
+    w |= ((uint32)s->VCU_MotorSpeedLimitFwd & 0x0000FFFFUL) << 2;
+    w |= (((uint32)s->VCU_MotorSpeedLimitRev >> 14) & 0x00000003UL);
+    Com_StoreBe32(&pdu[0], w);
+
+    /* Be32 @ 4: VCU_MotorSpeedLimitRev[0..13], VCU_TorqueLimitMotor, VCU_TorqueLimitGen[6..11] */
+    w = (uint32)s->VCU_MotorSpeedLimitRev << 18;
+    w |= ((uint32)s->VCU_TorqueLimitMotor & 0x00000FFFUL) << 6;
+    w |= (((uint32)s->VCU_TorqueLimitGen >> 6) & 0x0000003FUL);
+    Com_StoreBe32(&pdu[4], w);
+
+    /* Be32 @ 8: VCU_TorqueLimitGen[0..5], VCU_InverterEnable, VCU_ControlMode,
+     * VCU_ActiveDischargeReq, VCU_DampingGain, VCU_RegenTorque,
+     * VCU_TorqueRequestAliveCounter[2..3] */
+    w = (uint32)s->VCU_TorqueLimitGen << 26;
+    w |= ((uint32)s->VCU_InverterEnable & 0x00000001UL) << 25;
+    w |= ((uint32)s->VCU_ControlMode & 0x00000007UL) << 22;
+    w |= ((uint32)s->VCU_ActiveDischargeReq & 0x00000001UL) << 21;
+    w |= ((uint32)s->VCU_DampingGain & 0x0000007FUL) << 14;
+    w |= ((uint32)s->VCU_RegenTorque & 0x00000FFFUL) << 2;
+    w |= (((uint32)s->VCU_TorqueRequestAliveCounter >> 2) & 0x00000003UL);
+    Com_StoreBe32(&pdu[8], w);
+
+    /* Be32 @ 12: VCU_TorqueRequestAliveCounter[0..1], VCU_TorqueRequestCrc */
+    w = Com_LoadBe32(&pdu[12]) & 0x003FFFFFUL;
+    w |= (uint32)s->VCU_TorqueRequestAliveCounter << 30;
+    w |= ((uint32)s->VCU_TorqueRequestCrc & 0x000000FFUL) << 22;
+    Com_StoreBe32(&pdu[12], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_Status (32 bytes, 21 signals)
+ */
+STATIC void Com_Pack_VCU_Status(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_Status;
+    P2CONST(Com_Shadow_VCU_StatusType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_Status;
+    uint32 w;
+
+    /* Le32 @ 0: VCU_VehicleSpeed, VCU_DriveMode, VCU_GearActual, VCU_ReadyToDrive, VCU_HvState,
+     * VCU_LvVoltage[0..7] */
+    w = ((uint32)s->VCU_VehicleSpeed & 0x00001FFFUL);
+    w |= ((uint32)s->VCU_DriveMode & 0x00000007UL) << 13;
+    w |= ((uint32)s->VCU_GearActual & 0x00000007UL) << 16;
+    w |= ((uint32)s->VCU_ReadyToDrive & 0x00000001UL) << 19;
+    w |= ((uint32)s->VCU_HvState & 0x0000000FUL) << 20;
+    w |= (uint32)s->VCU_LvVoltage << 24;
+    Com_StoreLe32(&pdu[0], w);
+
+    /* Le32 @ 4: VCU_LvVoltage[8..9], VCU_PowerMode, VCU_DerateActive, VCU_ActiveFaults,
+     * VCU_RangeEstimate */
+    w = (((uint32)s->VCU_LvVoltage >> 8) & 0x00000003UL);
+    w |= ((uint32)s->VCU_PowerMode & 0x00000007UL) << 2;
+    w |= ((uint32)s->VCU_DerateActive & 0x00000001UL) << 5;
+    w |= ((uint32)s->VCU_ActiveFaults & 0x0000FFFFUL) << 6;
+    w |= (uint32)s->VCU_RangeEstimate << 22;
+    Com_StoreLe32(&pdu[4], w);
+
+    /* Le32 @ 8: VCU_EnergyConsumption, VCU_CreepEnabled, VCU_RegenLevel, VCU_ChargeState,
+     * VCU_ThermalState, VCU_WakeupReason, VCU_KeepAwake, VCU_OperatingHours[0..2] */
+    w = ((uint32)s->VCU_EnergyConsumption & 0x00000FFFUL);
+    w |= ((uint32)s->VCU_CreepEnabled & 0x00000001UL) << 12;
+    w |= ((uint32)s->VCU_RegenLevel & 0x00000003UL) << 13;
+    w |= ((uint32)s->VCU_ChargeState & 0x0000000FUL) << 15;
+    w |= ((uint32)s->VCU_ThermalState & 0x0000000FUL) << 19;
+    w |= ((uint32)s->VCU_WakeupReason & 0x0000001FUL) << 23;
+    w |= ((uint32)s->VCU_KeepAwake & 0x00000001UL) << 28;
+    w |= (uint32)s->VCU_OperatingHours << 29;
+    Com_StoreLe32(&pdu[8], w);
+
+    /* Le32 @ 12: VCU_OperatingHours[3..23], VCU_SoftwareVersion[0..10] */
+    w = (((uint32)s->VCU_OperatingHours >> 3) & 0x001FFFFFUL);
+    w |= (uint32)s->VCU_SoftwareVersion << 21;
+    Com_StoreLe32(&pdu[12], w);
+
+    /* Le32 @ 16: VCU_SoftwareVersion[11..15], VCU_StatusAliveCounter, VCU_StatusCrc */
+    w = Com_LoadLe32(&pdu[16]) & 0xFFFE0000UL;
+    w |= (((uint32)s->VCU_SoftwareVersion >> 11) & 0x0000001FUL);
+    w |= ((uint32)s->VCU_StatusAliveCounter & 0x0000000FUL) << 5;
+    w |= ((uint32)s->VCU_StatusCrc & 0x000000FFUL) << 9;
+    Com_StoreLe32(&pdu[16], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_PowertrainData (64 bytes, 32 signals)
+ */
+STATIC void Com_Pack_VCU_PowertrainData(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_PowertrainData;
+    P2CONST(Com_Shadow_VCU_PowertrainDataType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_PowertrainData;
+    uint32 w;
+
+    /* Le32 @ 0: PT_WheelTorqueFL, PT_WheelTorqueFR, PT_WheelTorqueRL[0..3] */
+    w = ((uint32)s->PT_WheelTorqueFL & 0x00003FFFUL);
+    w |= ((uint32)s->PT_WheelTorqueFR & 0x00003FFFUL) << 14;
+    w |= (uint32)s->PT_WheelTorqueRL << 28;
+    Com_StoreLe32(&pdu[0], w);
+
+    /* Le32 @ 4: PT_WheelTorqueRL[4..13], PT_WheelTorqueRR, PT_AxleTorqueFront[0..7] */
+    w = (((uint32)s->PT_WheelTorqueRL >> 4) & 0x000003FFUL);
+    w |= ((uint32)s->PT_WheelTorqueRR & 0x00003FFFUL) << 10;
+    w |= (uint32)s->PT_AxleTorqueFront << 24;
+    Com_StoreLe32(&pdu[4], w);
+
+    /* Le32 @ 8: PT_AxleTorqueFront[8..14], PT_AxleTorqueRear, PT_MotorPowerMech[0..9] */
+    w = (((uint32)s->PT_AxleTorqueFront >> 8) & 0x0000007FUL);
+    w |= ((uint32)s->PT_AxleTorqueRear & 0x00007FFFUL) << 7;
+    w |= (uint32)s->PT_MotorPowerMech << 22;
+    Com_StoreLe32(&pdu[8], w);
+
+    /* Le32 @ 12: PT_MotorPowerMech[10..17], PT_MotorPowerElec, PT_BatteryPowerLimitChg[0..5] */
+    w = (((uint32)s->PT_MotorPowerMech >> 10) & 0x000000FFUL);
+    w |= ((uint32)s->PT_MotorPowerElec & 0x0003FFFFUL) << 8;
+    w |= (uint32)s->PT_BatteryPowerLimitChg << 26;
+    Com_StoreLe32(&pdu[12], w);
+
+    /* Le32 @ 16: PT_BatteryPowerLimitChg[6..15], PT_BatteryPowerLimitDis,
+     * PT_EfficiencyEstimate[0..5] */
+    w = (((uint32)s->PT_BatteryPowerLimitChg >> 6) & 0x000003FFUL);
+    w |= ((uint32)s->PT_BatteryPowerLimitDis & 0x0000FFFFUL) << 10;
+    w |= (uint32)s->PT_EfficiencyEstimate << 26;
+    Com_StoreLe32(&pdu[16], w);
+
+    /* Le32 @ 20: PT_EfficiencyEstimate[6..9], PT_SlipFront, PT_SlipRear,
+     * PT_YawTorqueRequest[0..9] */
+    w = (((uint32)s->PT_EfficiencyEstimate >> 6) & 0x0000000FUL);
+    w |= ((uint32)s->PT_SlipFront & 0x000001FFUL) << 4;
+    w |= ((uint32)s->PT_SlipRear & 0x000001FFUL) << 13;
+    w |= (uint32)s->PT_YawTorqueRequest << 22;
+    Com_StoreLe32(&pdu[20], w);
+
+    /* Le32 @ 24: PT_YawTorqueRequest[10..12], PT_PedalMap, PT_CreepTorque, PT_CoastTorque,
+     * PT_VehicleMass[0..7] */
+    w = (((uint32)s->PT_YawTorqueRequest >> 10) & 0x00000007UL);
+    w |= ((uint32)s->PT_PedalMap & 0x00000007UL) << 3;
+    w |= ((uint32)s->PT_CreepTorque & 0x000000FFUL) << 6;
+    w |= ((uint32)s->PT_CoastTorque & 0x000003FFUL) << 14;
+    w |= (uint32)s->PT_VehicleMass << 24;
+    Com_StoreLe32(&pdu[24], w);
+
+    /* Le32 @ 28: PT_VehicleMass[8..13], PT_RoadGradient, PT_TractionLimited, PT_ThermalLimited,
+     * PT_BatteryLimited, PT_TorqueSource, PT_EnergyTotal[0..10] */
+    w = (((uint32)s->PT_VehicleMass >> 8) & 0x0000003FUL);
+    w |= ((uint32)s->PT_RoadGradient & 0x000001FFUL) << 6;
+    w |= ((uint32)s->PT_TractionLimited & 0x00000001UL) << 15;
+    w |= ((uint32)s->PT_ThermalLimited & 0x00000001UL) << 16;
+    w |= ((uint32)s->PT_BatteryLimited & 0x00000001UL) << 17;
+    w |= ((uint32)s->PT_TorqueSource & 0x00000007UL) << 18;
+    w |= (uint32)s->PT_EnergyTotal << 21;
+    Com_StoreLe32(&pdu[28], w);
+
+    /* Le32 @ 32: PT_EnergyTotal[11..31], PT_EnergyRegen[0..10] */
+    w = (((uint32)s->PT_EnergyTotal >> 11) & 0x001FFFFFUL);
+    w |= (uint32)s->PT_EnergyRegen << 21;
+    Com_StoreLe32(&pdu[32], w);
+
+    /* Le32 @ 36: PT_EnergyRegen[11..31], PT_Timestamp[0..10] */
+    w = (((uint32)s->PT_EnergyRegen >> 11) & 0x001FFFFFUL);
+    w |= (uint32)s->PT_Timestamp << 21;
+    Com_StoreLe32(&pdu[36], w);
+
+    /* Le32 @ 40: PT_Timestamp[11..39], PT_DistanceTrip[0..2] */
+    w = ((uint32)(s->PT_Timestamp >> 11) & 0x1FFFFFFFUL);
+    w |= (uint32)s->PT_DistanceTrip << 29;
+    Com_StoreLe32(&pdu[40], w);
+
+    /* Le32 @ 44: PT_DistanceTrip[3..23], PT_AccelEstimate[0..10] */
+    w = (((uint32)s->PT_DistanceTrip >> 3) & 0x001FFFFFUL);
+    w |= (uint32)s->PT_AccelEstimate << 21;
+    Com_StoreLe32(&pdu[44], w);
+
+    /* Le32 @ 48: PT_AccelEstimate[11..11], PT_JerkLimit, PT_ShaftOscillation,
+     * VCU_PowertrainDataAliveCounter, VCU_PowertrainDataCrc */
+    w = (((uint32)s->PT_AccelEstimate >> 11) & 0x00000001UL);
+    w |= ((uint32)s->PT_JerkLimit & 0x000000FFUL) << 1;
+    w |= ((uint32)s->PT_ShaftOscillation & 0x000007FFUL) << 9;
+    w |= ((uint32)s->VCU_PowertrainDataAliveCounter & 0x0000000FUL) << 20;
+    w |= (uint32)s->VCU_PowertrainDataCrc << 24;
+    Com_StoreLe32(&pdu[48], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_PowertrainDataMot (64 bytes, 32 signals)
+ */
+STATIC void Com_Pack_VCU_PowertrainDataMot(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_PowertrainDataMot;
+    P2CONST(Com_Shadow_VCU_PowertrainDataMotType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_PowertrainDataMot;
+    uint32 w;
+
+    /* Be32 @ 0: PTM_WheelTorqueFL, PTM_WheelTorqueFR, PTM_WheelTorqueRL[10..13] */
+    w = (uint32)s->PTM_WheelTorqueFL << 18;
+    w |= ((uint32)s->PTM_WheelTorqueFR & 0x00003FFFUL) << 4;
+    w |= (((uint32)s->PTM_WheelTorqueRL >> 10) & 0x0000000FUL);
+    Com_StoreBe32(&pdu[0], w);
+
+    /* Be32 @ 4: PTM_WheelTorqueRL[0..9], PTM_WheelTorqueRR, PTM_AxleTorqueFront[7..14] */
+    w = (uint32)s->PTM_WheelTorqueRL << 22;
+    w |= ((uint32)s->PTM_WheelTorqueRR & 0x00003FFFUL) << 8;
+    w |= (((uint32)s->PTM_AxleTorqueFront >> 7) & 0x000000FFUL);
+    Com_StoreBe32(&pdu[4], w);
+
+    /* Be32 @ 8: PTM_AxleTorqueFront[0..6], PTM_AxleTorqueRear, PTM_MotorPowerMech[8..17] */
+    w = (uint32)s->PTM_AxleTorqueFront << 25;
+    w |= ((uint32)s->PTM_AxleTorqueRear & 0x00007FFFUL) << 10;
+    w |= (((uint32)s->PTM_MotorPowerMech >> 8) & 0x000003FFUL);
+    Com_StoreBe32(&pdu[8], w);
+
+    /* Be32 @ 12: PTM_MotorPowerMech[0..7], PTM_MotorPowerElec, PTM_BatteryPowerLimitChg[10..15] */
+    w = (uint32)s->PTM_MotorPowerMech << 24;
+    w |= ((uint32)s->PTM_MotorPowerElec & 0x0003FFFFUL) << 6;
+    w |= (((uint32)s->PTM_BatteryPowerLimitChg >> 10) & 0x0000003FUL);
+    Com_StoreBe32(&pdu[12], w);
+
+    /* Be32 @ 16: PTM_BatteryPowerLimitChg[0..9], PTM_BatteryPowerLimitDis,
+     * PTM_EfficiencyEstimate[4..9] */
+    w = (uint32)s->PTM_BatteryPowerLimitChg << 22;
+    w |= ((uint32)s->PTM_BatteryPowerLimitDis & 0x0000FFFFUL) << 6;
+    w |= (((uint32)s->PTM_EfficiencyEstimate >> 4) & 0x0000003FUL);
+    Com_StoreBe32(&pdu[16], w);
+
+    /* Be32 @ 20: PTM_EfficiencyEstimate[0..3], PTM_SlipFront, PTM_SlipRear,
+     * PTM_YawTorqueRequest[3..12] */
+    w = (uint32)s->PTM_EfficiencyEstimate << 28;
+    w |= ((uint32)s->PTM_SlipFront & 0x000001FFUL) << 19;
+    w |= ((uint32)s->PTM_SlipRear & 0x000001FFUL) << 10;
+    w |= (((uint32)s->PTM_YawTorqueRequest >> 3) & 0x000003FFUL);
+    Com_StoreBe32(&pdu[20], w);
+
+    /* Be32 @ 24: PTM_YawTorqueRequest[0..2], PTM_PedalMap, PTM_CreepTorque, PTM_CoastTorque,
+     * PTM_VehicleMass[6..13] */
+    w = (uint32)s->PTM_YawTorqueRequest << 29;
+    w |= ((uint32)s->PTM_PedalMap & 0x00000007UL) << 26;
+    w |= ((uint32)s->PTM_CreepTorque & 0x000000FFUL) << 18;
+    w |= ((uint32)s->PTM_CoastTorque & 0x000003FFUL) << 8;
+    w |= (((uint32)s->PTM_VehicleMass >> 6) & 0x000000FFUL);
+    Com_StoreBe32(&pdu[24], w);
+
+    /* Be32 @ 28: PTM_VehicleMass[0..5], PTM_RoadGradient, PTM_TractionLimited,
+     * PTM_ThermalLimited, PTM_BatteryLimited, PTM_TorqueSource, PTM_EnergyTotal[21..31] */
+    w = (uint32)s->PTM_VehicleMass << 26;
+    w |= ((uint32)s->PTM_RoadGradient & 0x000001FFUL) << 17;
+    w |= ((uint32)s->PTM_TractionLimited & 0x00000001UL) << 16;
+    w |= ((uint32)s->PTM_ThermalLimited & 0x00000001UL) << 15;
+    w |= ((uint32)s->PTM_BatteryLimited & 0x00000001UL) << 14;
+    w |= ((uint32)s->PTM_TorqueSource & 0x00000007UL) << 11;
+    w |= (((uint32)s->PTM_EnergyTotal >> 21) & 0x000007FFUL);
+    Com_StoreBe32(&pdu[28], w);
+
+    /* Be32 @ 32: PTM_EnergyTotal[0..20], PTM_EnergyRegen[21..31] */
+    w = (uint32)s->PTM_EnergyTotal << 11;
+    w |= (((uint32)s->PTM_EnergyRegen >> 21) & 0x000007FFUL);
+    Com_StoreBe32(&pdu[32], w);
+
+    /* Be32 @ 36: PTM_EnergyRegen[0..20], PTM_Timestamp[29..39] */
+    w = (uint32)s->PTM_EnergyRegen << 11;
+    w |= ((uint32)(s->PTM_Timestamp >> 29) & 0x000007FFUL);
+    Com_StoreBe32(&pdu[36], w);
+
+    /* Be32 @ 40: PTM_Timestamp[0..28], PTM_DistanceTrip[21..23] */
+    w = (uint32)s->PTM_Timestamp << 3;
+    w |= (((uint32)s->PTM_DistanceTrip >> 21) & 0x00000007UL);
+    Com_StoreBe32(&pdu[40], w);
+
+    /* Be32 @ 44: PTM_DistanceTrip[0..20], PTM_AccelEstimate[1..11] */
+    w = (uint32)s->PTM_DistanceTrip << 11;
+    w |= (((uint32)s->PTM_AccelEstimate >> 1) & 0x000007FFUL);
+    Com_StoreBe32(&pdu[44], w);
+
+    /* Be32 @ 48: PTM_AccelEstimate[0..0], PTM_JerkLimit, PTM_ShaftOscillation,
+     * VCU_PowertrainDataMotAliveCounter, VCU_PowertrainDataMotCrc */
+    w = (uint32)s->PTM_AccelEstimate << 31;
+    w |= ((uint32)s->PTM_JerkLimit & 0x000000FFUL) << 23;
+    w |= ((uint32)s->PTM_ShaftOscillation & 0x000007FFUL) << 12;
+    w |= ((uint32)s->VCU_PowertrainDataMotAliveCounter & 0x0000000FUL) << 8;
+    w |= ((uint32)s->VCU_PowertrainDataMotCrc & 0x000000FFUL);
+    Com_StoreBe32(&pdu[48], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_ChargeControl (16 bytes, 12 signals)
+ */
+STATIC void Com_Pack_VCU_ChargeControl(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_ChargeControl;
+    P2CONST(Com_Shadow_VCU_ChargeControlType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_ChargeControl;
+    uint32 w;
+
+    /* Be32 @ 0: VCU_ChargeEnable, VCU_ChargeVoltageTarget, VCU_ChargeCurrentLimit,
+     * VCU_ChargeMode, VCU_PlugLock, VCU_PrechargeRequest, VCU_ContactorRequest[2..2] */
+    w = (uint32)s->VCU_ChargeEnable << 31;
+    w |= ((uint32)s->VCU_ChargeVoltageTarget & 0x00001FFFUL) << 18;
+    w |= ((uint32)s->VCU_ChargeCurrentLimit & 0x00000FFFUL) << 6;
+    w |= ((uint32)s->VCU_ChargeMode & 0x00000007UL) << 3;
+    w |= ((uint32)s->VCU_PlugLock & 0x00000001UL) << 2;
+    w |= ((uint32)s->VCU_PrechargeRequest & 0x00000001UL) << 1;
+    w |= (((uint32)s->VCU_ContactorRequest >> 2) & 0x00000001UL);
+    Com_StoreBe32(&pdu[0], w);
+
+    /* Be32 @ 4: VCU_ContactorRequest[0..1], VCU_ChargeTimeRemaining, VCU_ChargePowerLimit,
+     * VCU_V2lEnable, VCU_ChargeControlAliveCounter, VCU_ChargeControlCrc[7..7] */
+    w = (uint32)s->VCU_ContactorRequest << 30;
+    w |= ((uint32)s->VCU_ChargeTimeRemaining & 0x000003FFUL) << 20;
+    w |= ((uint32)s->VCU_ChargePowerLimit & 0x00003FFFUL) << 6;
+    w |= ((uint32)s->VCU_V2lEnable & 0x00000001UL) << 5;
+    w |= ((uint32)s->VCU_ChargeControlAliveCounter & 0x0000000FUL) << 1;
+    w |= (((uint32)s->VCU_ChargeControlCrc >> 7) & 0x00000001UL);
+    Com_StoreBe32(&pdu[4], w);
+
+    /* Be32 @ 8: VCU_ChargeControlCrc[0..6] */
+    w = Com_LoadBe32(&pdu[8]) & 0x01FFFFFFUL;
+    w |= (uint32)s->VCU_ChargeControlCrc << 25;
+    Com_StoreBe32(&pdu[8], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_ThermalRequest (8 bytes, 9 signals)
+ */
+STATIC void Com_Pack_VCU_ThermalRequest(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_ThermalRequest;
+    P2CONST(Com_Shadow_VCU_ThermalRequestType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_ThermalRequest;
+    uint32 w;
+
+    /* Le32 @ 0: VCU_PumpSpeedBattery, VCU_PumpSpeedMotor, VCU_FanSpeed, VCU_ChillerRequest,
+     * VCU_HeaterPower */
+    w = ((uint32)s->VCU_PumpSpeedBattery & 0x0000007FUL);
+    w |= ((uint32)s->VCU_PumpSpeedMotor & 0x0000007FUL) << 7;
+    w |= ((uint32)s->VCU_FanSpeed & 0x0000007FUL) << 14;
+    w |= ((uint32)s->VCU_ChillerRequest & 0x00000001UL) << 21;
+    w |= (uint32)s->VCU_HeaterPower << 22;
+    Com_StoreLe32(&pdu[0], w);
+
+    /* Le32 @ 4: VCU_ValvePosition, VCU_TargetBatteryTemp, VCU_ThermalRequestAliveCounter,
+     * VCU_ThermalRequestCrc */
+    w = Com_LoadLe32(&pdu[4]) & 0xF0000000UL;
+    w |= ((uint32)s->VCU_ValvePosition & 0x000000FFUL);
+    w |= ((uint32)s->VCU_TargetBatteryTemp & 0x000000FFUL) << 8;
+    w |= ((uint32)s->VCU_ThermalRequestAliveCounter & 0x0000000FUL) << 16;
+    w |= ((uint32)s->VCU_ThermalRequestCrc & 0x000000FFUL) << 20;
+    Com_StoreLe32(&pdu[4], w);
+}
+
+/**
+ * @brief Pack the shadow into I-PDU VCU_DcdcControl (8 bytes, 6 signals)
+ */
+STATIC void Com_Pack_VCU_DcdcControl(void)
+{
+    P2VAR(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_VCU_DcdcControl;
+    P2CONST(Com_Shadow_VCU_DcdcControlType, AUTOMATIC, COM_VAR) s = &Com_Shadow_VCU_DcdcControl;
+    uint32 w;
+
+    /* Le32 @ 0: VCU_DcdcEnable, VCU_DcdcVoltageTarget, VCU_DcdcCurrentLimit, VCU_DcdcMode,
+     * VCU_DcdcControlAliveCounter, VCU_DcdcControlCrc[0..4] */
+    w = ((uint32)s->VCU_DcdcEnable & 0x00000001UL);
+    w |= ((uint32)s->VCU_DcdcVoltageTarget & 0x000003FFUL) << 1;
+    w |= ((uint32)s->VCU_DcdcCurrentLimit & 0x000003FFUL) << 11;
+    w |= ((uint32)s->VCU_DcdcMode & 0x00000003UL) << 21;
+    w |= ((uint32)s->VCU_DcdcControlAliveCounter & 0x0000000FUL) << 23;
+    w |= (uint32)s->VCU_DcdcControlCrc << 27;
+    Com_StoreLe32(&pdu[0], w);
+
+    /* Le32 @ 4: VCU_DcdcControlCrc[5..7] */
+    w = Com_LoadLe32(&pdu[4]) & 0xFFFFFFF8UL;
+    w |= (((uint32)s->VCU_DcdcControlCrc >> 5) & 0x00000007UL);
+    Com_StoreLe32(&pdu[4], w);
+}
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const Com_IPduConfigType Com_IPdu[COM_IPDU_COUNT] =
+{
+    { Com_Pdu_BMS_PackStatus, &Com_Shadow_BMS_PackStatus, &Com_ShadowInit_BMS_PackStatus,
+      NULL_PTR, Com_Unpack_BMS_PackStatus,
+      (uint16)sizeof(Com_Shadow_BMS_PackStatusType), 32U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_REPLACE, 20U, 200U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_BMS_CellVoltages1, &Com_Shadow_BMS_CellVoltages1, &Com_ShadowInit_BMS_CellVoltages1,
+      NULL_PTR, Com_Unpack_BMS_CellVoltages1,
+      (uint16)sizeof(Com_Shadow_BMS_CellVoltages1Type), 64U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 100U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_BMS_CellVoltages2, &Com_Shadow_BMS_CellVoltages2, &Com_ShadowInit_BMS_CellVoltages2,
+      NULL_PTR, Com_Unpack_BMS_CellVoltages2,
+      (uint16)sizeof(Com_Shadow_BMS_CellVoltages2Type), 64U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 100U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_BMS_CellVoltages3, &Com_Shadow_BMS_CellVoltages3, &Com_ShadowInit_BMS_CellVoltages3,
+      NULL_PTR, Com_Unpack_BMS_CellVoltages3,
+      (uint16)sizeof(Com_Shadow_BMS_CellVoltages3Type), 64U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 100U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_BMS_CellTemps, &Com_Shadow_BMS_CellTemps, &Com_ShadowInit_BMS_CellTemps,
+      NULL_PTR, Com_Unpack_BMS_CellTemps,
+      (uint16)sizeof(Com_Shadow_BMS_CellTempsType), 64U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 200U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_MCU_Status, &Com_Shadow_MCU_Status, &Com_ShadowInit_MCU_Status,
+      NULL_PTR, Com_Unpack_MCU_Status,
+      (uint16)sizeof(Com_Shadow_MCU_StatusType), 24U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_REPLACE, 10U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_ESP_WheelSpeeds, &Com_Shadow_ESP_WheelSpeeds, &Com_ShadowInit_ESP_WheelSpeeds,
+      NULL_PTR, Com_Unpack_ESP_WheelSpeeds,
+      (uint16)sizeof(Com_Shadow_ESP_WheelSpeedsType), 8U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 10U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_ESP_Dynamics, &Com_Shadow_ESP_Dynamics, &Com_ShadowInit_ESP_Dynamics,
+      NULL_PTR, Com_Unpack_ESP_Dynamics,
+      (uint16)sizeof(Com_Shadow_ESP_DynamicsType), 8U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 10U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_SAS_Steering, &Com_Shadow_SAS_Steering, &Com_ShadowInit_SAS_Steering,
+      NULL_PTR, Com_Unpack_SAS_Steering,
+      (uint16)sizeof(Com_Shadow_SAS_SteeringType), 8U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 10U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_APS_Pedals, &Com_Shadow_APS_Pedals, &Com_ShadowInit_APS_Pedals,
+      NULL_PTR, Com_Unpack_APS_Pedals,
+      (uint16)sizeof(Com_Shadow_APS_PedalsType), 8U, (uint8)COM_RECEIVE, (uint8)COM_IMMEDIATE, 0x00U,
+      (uint8)COM_TIMEOUT_REPLACE, 6U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_GW_VehicleInfo, &Com_Shadow_GW_VehicleInfo, &Com_ShadowInit_GW_VehicleInfo,
+      NULL_PTR, Com_Unpack_GW_VehicleInfo,
+      (uint16)sizeof(Com_Shadow_GW_VehicleInfoType), 16U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_NONE, 100U, 100U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_OBC_Status, &Com_Shadow_OBC_Status, &Com_ShadowInit_OBC_Status,
+      NULL_PTR, Com_Unpack_OBC_Status,
+      (uint16)sizeof(Com_Shadow_OBC_StatusType), 16U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_REPLACE, 100U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_DCDC_Status, &Com_Shadow_DCDC_Status, &Com_ShadowInit_DCDC_Status,
+      NULL_PTR, Com_Unpack_DCDC_Status,
+      (uint16)sizeof(Com_Shadow_DCDC_StatusType), 8U, (uint8)COM_RECEIVE, (uint8)COM_DEFERRED, 0x00U,
+      (uint8)COM_TIMEOUT_REPLACE, 100U, 400U,
+      (uint8)COM_TX_NONE, 0U, 0U, 0U, COM_NO_PDUR_PDU },
+    { Com_Pdu_VCU_TorqueRequest, &Com_Shadow_VCU_TorqueRequest, &Com_ShadowInit_VCU_TorqueRequest,
+      Com_Pack_VCU_TorqueRequest, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_TorqueRequestType), 16U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_PERIODIC, 2U, 0U, 0U, 13U },
+    { Com_Pdu_VCU_Status, &Com_Shadow_VCU_Status, &Com_ShadowInit_VCU_Status,
+      Com_Pack_VCU_Status, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_StatusType), 32U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_PERIODIC, 20U, 0U, 0U, 14U },
+    { Com_Pdu_VCU_PowertrainData, &Com_Shadow_VCU_PowertrainData, &Com_ShadowInit_VCU_PowertrainData,
+      Com_Pack_VCU_PowertrainData, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_PowertrainDataType), 64U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_PERIODIC, 4U, 1U, 0U, 15U },
+    { Com_Pdu_VCU_PowertrainDataMot, &Com_Shadow_VCU_PowertrainDataMot, &Com_ShadowInit_VCU_PowertrainDataMot,
+      Com_Pack_VCU_PowertrainDataMot, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_PowertrainDataMotType), 64U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_PERIODIC, 4U, 3U, 0U, 16U },
+    { Com_Pdu_VCU_ChargeControl, &Com_Shadow_VCU_ChargeControl, &Com_ShadowInit_VCU_ChargeControl,
+      Com_Pack_VCU_ChargeControl, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_ChargeControlType), 16U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_MIXED, 20U, 2U, 2U, 17U },
+    { Com_Pdu_VCU_ThermalRequest, &Com_Shadow_VCU_ThermalRequest, &Com_ShadowInit_VCU_ThermalRequest,
+      Com_Pack_VCU_ThermalRequest, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_ThermalRequestType), 8U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_DIRECT, 0U, 0U, 10U, 18U },
+    { Com_Pdu_VCU_DcdcControl, &Com_Shadow_VCU_DcdcControl, &Com_ShadowInit_VCU_DcdcControl,
+      Com_Pack_VCU_DcdcControl, NULL_PTR,
+      (uint16)sizeof(Com_Shadow_VCU_DcdcControlType), 8U, (uint8)COM_SEND, (uint8)COM_IMMEDIATE, 0xFFU,
+      (uint8)COM_TIMEOUT_NONE, 0U, 0U,
+      (uint8)COM_TX_MIXED, 20U, 4U, 2U, 19U }
+};
+
+const Com_SignalConfigType Com_Signal[COM_SIGNAL_COUNT] =
+{
+    { &Com_Shadow_BMS_PackStatus.BMS_PackVoltage, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_PackCurrent, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_StateOfCharge, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_StateOfHealth, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MaxCellTemp, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MinCellTemp, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MaxChargePower, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MaxDischargePower, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_IsolationResistance, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_ContactorState, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_BalancingActive, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_FaultLevel, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_ChargeRequest, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MaxCellVoltage, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MinCellVoltage, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MaxCellIndex, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_MinCellIndex, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_CoolantInletTemp, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_CoolantOutletTemp, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_EnergyRemaining, ComConf_ComIPdu_BMS_PackStatus, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_CycleCount, ComConf_ComIPdu_BMS_PackStatus, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_PackStatusAliveCounter, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_PackStatus.BMS_PackStatusCrc, ComConf_ComIPdu_BMS_PackStatus, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage001, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage002, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage003, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage004, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage005, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage006, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage007, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage008, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage009, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage010, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage011, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage012, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage013, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage014, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage015, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage016, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage017, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage018, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage019, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage020, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage021, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage022, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage023, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage024, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage025, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage026, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage027, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage028, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage029, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage030, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage031, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltage032, ComConf_ComIPdu_BMS_CellVoltages1, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltages1AliveCounter, ComConf_ComIPdu_BMS_CellVoltages1, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages1.BMS_CellVoltages1Crc, ComConf_ComIPdu_BMS_CellVoltages1, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage033, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage034, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage035, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage036, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage037, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage038, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage039, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage040, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage041, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage042, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage043, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage044, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage045, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage046, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage047, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage048, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage049, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage050, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage051, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage052, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage053, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage054, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage055, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage056, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage057, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage058, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage059, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage060, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage061, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage062, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage063, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltage064, ComConf_ComIPdu_BMS_CellVoltages2, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltages2AliveCounter, ComConf_ComIPdu_BMS_CellVoltages2, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages2.BMS_CellVoltages2Crc, ComConf_ComIPdu_BMS_CellVoltages2, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage065, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage066, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage067, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage068, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage069, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage070, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage071, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage072, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage073, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage074, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage075, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage076, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage077, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage078, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage079, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage080, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage081, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage082, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage083, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage084, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage085, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage086, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage087, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage088, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage089, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage090, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage091, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage092, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage093, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage094, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage095, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltage096, ComConf_ComIPdu_BMS_CellVoltages3, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltages3AliveCounter, ComConf_ComIPdu_BMS_CellVoltages3, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellVoltages3.BMS_CellVoltages3Crc, ComConf_ComIPdu_BMS_CellVoltages3, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp01, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp02, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp03, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp04, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp05, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp06, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp07, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp08, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp09, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp10, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp11, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp12, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp13, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp14, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp15, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp16, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp17, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp18, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp19, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp20, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp21, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp22, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp23, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp24, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp25, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp26, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp27, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp28, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp29, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp30, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp31, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp32, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp33, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp34, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp35, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp36, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp37, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp38, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp39, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp40, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp41, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp42, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp43, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp44, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp45, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp46, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp47, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTemp48, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTempsAliveCounter, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_BMS_CellTemps.BMS_CellTempsCrc, ComConf_ComIPdu_BMS_CellTemps, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_MotorSpeed, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_MotorTorque, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_DcVoltage, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_DcCurrent, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_InverterTemp, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_MotorTemp, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_State, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_Derating, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_ActiveDischarge, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_FaultCode, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_TorqueLimitMotor, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_TorqueLimitGen, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_PhaseCurrentRms, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_RotorPosition, ComConf_ComIPdu_MCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_GateDriverTemp, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_StatusAliveCounter, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_MCU_Status.MCU_StatusCrc, ComConf_ComIPdu_MCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedFL, ComConf_ComIPdu_ESP_WheelSpeeds, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedFR, ComConf_ComIPdu_ESP_WheelSpeeds, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedRL, ComConf_ComIPdu_ESP_WheelSpeeds, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedRR, ComConf_ComIPdu_ESP_WheelSpeeds, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedsAliveCounter, ComConf_ComIPdu_ESP_WheelSpeeds, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_WheelSpeeds.ESP_WheelSpeedsCrc, ComConf_ComIPdu_ESP_WheelSpeeds, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_YawRate, ComConf_ComIPdu_ESP_Dynamics, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_LateralAccel, ComConf_ComIPdu_ESP_Dynamics, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_LongitudinalAccel, ComConf_ComIPdu_ESP_Dynamics, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_BrakePressure, ComConf_ComIPdu_ESP_Dynamics, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_AbsActive, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_TcsActive, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_EspActive, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_RegenAllowed, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_RegenTorqueLimit, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_DynamicsAliveCounter, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_ESP_Dynamics.ESP_DynamicsCrc, ComConf_ComIPdu_ESP_Dynamics, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_Angle, ComConf_ComIPdu_SAS_Steering, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_Speed, ComConf_ComIPdu_SAS_Steering, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_Calibrated, ComConf_ComIPdu_SAS_Steering, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_Fault, ComConf_ComIPdu_SAS_Steering, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_TorsionTorque, ComConf_ComIPdu_SAS_Steering, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_Reserved, ComConf_ComIPdu_SAS_Steering, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_SteeringAliveCounter, ComConf_ComIPdu_SAS_Steering, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_SAS_Steering.SAS_SteeringCrc, ComConf_ComIPdu_SAS_Steering, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_AccelPedal1, ComConf_ComIPdu_APS_Pedals, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_AccelPedal2, ComConf_ComIPdu_APS_Pedals, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_BrakePedal, ComConf_ComIPdu_APS_Pedals, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_BrakeSwitch, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_KickDown, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_PlausibilityFault, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_CruiseButtons, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_Reserved, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_PedalsAliveCounter, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_APS_Pedals.APS_PedalsCrc, ComConf_ComIPdu_APS_Pedals, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_Odometer, ComConf_ComIPdu_GW_VehicleInfo, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_AmbientTemp, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_DoorState, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_SeatBeltDriver, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_KeyPosition, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_DriveModeRequest, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_HvacPowerRequest, ComConf_ComIPdu_GW_VehicleInfo, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_TimeOfDay, ComConf_ComIPdu_GW_VehicleInfo, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_VehicleLocked, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_ChargePortOpen, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_UserChargeLimit, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_Reserved, ComConf_ComIPdu_GW_VehicleInfo, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_VehicleInfoAliveCounter, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_GW_VehicleInfo.GW_VehicleInfoCrc, ComConf_ComIPdu_GW_VehicleInfo, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_AcVoltage, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_AcCurrent, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_DcVoltage, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_DcCurrent, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_State, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_PlugDetected, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_ProximityPilot, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_ControlPilotDuty, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_Temperature, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_FaultCode, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_MaxPower, ComConf_ComIPdu_OBC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_StatusAliveCounter, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_OBC_Status.OBC_StatusCrc, ComConf_ComIPdu_OBC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_OutputVoltage, ComConf_ComIPdu_DCDC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_OutputCurrent, ComConf_ComIPdu_DCDC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_InputVoltage, ComConf_ComIPdu_DCDC_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_Temperature, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_State, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_Fault, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_Derating, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_Reserved, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_StatusAliveCounter, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_DCDC_Status.DCDC_StatusCrc, ComConf_ComIPdu_DCDC_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_MotorTorqueRequest, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_MotorSpeedLimitFwd, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_MotorSpeedLimitRev, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_TorqueLimitMotor, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_TorqueLimitGen, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_InverterEnable, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_ControlMode, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_ActiveDischargeReq, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_DampingGain, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_RegenTorque, ComConf_ComIPdu_VCU_TorqueRequest, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_TorqueRequestAliveCounter, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_TorqueRequest.VCU_TorqueRequestCrc, ComConf_ComIPdu_VCU_TorqueRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_VehicleSpeed, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_DriveMode, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_GearActual, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_ReadyToDrive, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_HvState, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_LvVoltage, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_PowerMode, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_DerateActive, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_ActiveFaults, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_RangeEstimate, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_EnergyConsumption, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_CreepEnabled, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_RegenLevel, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_ChargeState, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_ThermalState, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_WakeupReason, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_KeepAwake, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_OperatingHours, ComConf_ComIPdu_VCU_Status, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_SoftwareVersion, ComConf_ComIPdu_VCU_Status, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_StatusAliveCounter, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_Status.VCU_StatusCrc, ComConf_ComIPdu_VCU_Status, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_WheelTorqueFL, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_WheelTorqueFR, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_WheelTorqueRL, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_WheelTorqueRR, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_AxleTorqueFront, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_AxleTorqueRear, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_MotorPowerMech, ComConf_ComIPdu_VCU_PowertrainData, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_MotorPowerElec, ComConf_ComIPdu_VCU_PowertrainData, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_BatteryPowerLimitChg, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_BatteryPowerLimitDis, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_EfficiencyEstimate, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_SlipFront, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_SlipRear, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_YawTorqueRequest, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_PedalMap, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_CreepTorque, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_CoastTorque, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_VehicleMass, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_RoadGradient, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_TractionLimited, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_ThermalLimited, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_BatteryLimited, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_TorqueSource, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_EnergyTotal, ComConf_ComIPdu_VCU_PowertrainData, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_EnergyRegen, ComConf_ComIPdu_VCU_PowertrainData, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_Timestamp, ComConf_ComIPdu_VCU_PowertrainData, 8U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_DistanceTrip, ComConf_ComIPdu_VCU_PowertrainData, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_AccelEstimate, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_JerkLimit, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.PT_ShaftOscillation, ComConf_ComIPdu_VCU_PowertrainData, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.VCU_PowertrainDataAliveCounter, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainData.VCU_PowertrainDataCrc, ComConf_ComIPdu_VCU_PowertrainData, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_WheelTorqueFL, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_WheelTorqueFR, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_WheelTorqueRL, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_WheelTorqueRR, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_AxleTorqueFront, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_AxleTorqueRear, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_MotorPowerMech, ComConf_ComIPdu_VCU_PowertrainDataMot, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_MotorPowerElec, ComConf_ComIPdu_VCU_PowertrainDataMot, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_BatteryPowerLimitChg, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_BatteryPowerLimitDis, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_EfficiencyEstimate, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_SlipFront, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_SlipRear, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_YawTorqueRequest, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_PedalMap, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_CreepTorque, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_CoastTorque, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_VehicleMass, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_RoadGradient, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_TractionLimited, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_ThermalLimited, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_BatteryLimited, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_TorqueSource, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_EnergyTotal, ComConf_ComIPdu_VCU_PowertrainDataMot, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_EnergyRegen, ComConf_ComIPdu_VCU_PowertrainDataMot, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_Timestamp, ComConf_ComIPdu_VCU_PowertrainDataMot, 8U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_DistanceTrip, ComConf_ComIPdu_VCU_PowertrainDataMot, 4U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_AccelEstimate, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_JerkLimit, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.PTM_ShaftOscillation, ComConf_ComIPdu_VCU_PowertrainDataMot, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.VCU_PowertrainDataMotAliveCounter, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_PowertrainDataMot.VCU_PowertrainDataMotCrc, ComConf_ComIPdu_VCU_PowertrainDataMot, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeEnable, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeVoltageTarget, ComConf_ComIPdu_VCU_ChargeControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeCurrentLimit, ComConf_ComIPdu_VCU_ChargeControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeMode, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_PlugLock, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_PrechargeRequest, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ContactorRequest, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeTimeRemaining, ComConf_ComIPdu_VCU_ChargeControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargePowerLimit, ComConf_ComIPdu_VCU_ChargeControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_V2lEnable, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeControlAliveCounter, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ChargeControl.VCU_ChargeControlCrc, ComConf_ComIPdu_VCU_ChargeControl, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_PumpSpeedBattery, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_PumpSpeedMotor, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_FanSpeed, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_ChillerRequest, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_HeaterPower, ComConf_ComIPdu_VCU_ThermalRequest, 2U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_ValvePosition, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_TargetBatteryTemp, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_ThermalRequestAliveCounter, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_ThermalRequest.VCU_ThermalRequestCrc, ComConf_ComIPdu_VCU_ThermalRequest, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcEnable, ComConf_ComIPdu_VCU_DcdcControl, 1U, (uint8)COM_TRIGGERED },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcVoltageTarget, ComConf_ComIPdu_VCU_DcdcControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcCurrentLimit, ComConf_ComIPdu_VCU_DcdcControl, 2U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcMode, ComConf_ComIPdu_VCU_DcdcControl, 1U, (uint8)COM_TRIGGERED_ON_CHANGE },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcControlAliveCounter, ComConf_ComIPdu_VCU_DcdcControl, 1U, (uint8)COM_PENDING },
+    { &Com_Shadow_VCU_DcdcControl.VCU_DcdcControlCrc, ComConf_ComIPdu_VCU_DcdcControl, 1U, (uint8)COM_PENDING }
+};
+
+#if (COM_SIGNAL_LAYOUT_TABLE == STD_ON)
+const Com_SignalLayoutType Com_SignalLayout[COM_SIGNAL_COUNT] =
+{
+    { 8U,   16U, TRUE,  FALSE },  /* BMS_PackVoltage */
+    { 24U,  16U, TRUE,  TRUE  },  /* BMS_PackCurrent */
+    { 46U,  10U, TRUE,  FALSE },  /* BMS_StateOfCharge */
+    { 52U,  10U, TRUE,  FALSE },  /* BMS_StateOfHealth */
+    { 60U,  8U,  TRUE,  TRUE  },  /* BMS_MaxCellTemp */
+    { 68U,  8U,  TRUE,  TRUE  },  /* BMS_MinCellTemp */
+    { 72U,  12U, TRUE,  FALSE },  /* BMS_MaxChargePower */
+    { 92U,  12U, TRUE,  FALSE },  /* BMS_MaxDischargePower */
+    { 110U, 14U, TRUE,  FALSE },  /* BMS_IsolationResistance */
+    { 107U, 3U,  TRUE,  FALSE },  /* BMS_ContactorState */
+    { 106U, 1U,  TRUE,  FALSE },  /* BMS_BalancingActive */
+    { 119U, 3U,  TRUE,  FALSE },  /* BMS_FaultLevel */
+    { 118U, 1U,  TRUE,  FALSE },  /* BMS_ChargeRequest */
+    { 121U, 13U, TRUE,  FALSE },  /* BMS_MaxCellVoltage */
+    { 140U, 13U, TRUE,  FALSE },  /* BMS_MinCellVoltage */
+    { 149U, 7U,  TRUE,  FALSE },  /* BMS_MaxCellIndex */
+    { 158U, 7U,  TRUE,  FALSE },  /* BMS_MinCellIndex */
+    { 166U, 8U,  TRUE,  TRUE  },  /* BMS_CoolantInletTemp */
+    { 174U, 8U,  TRUE,  TRUE  },  /* BMS_CoolantOutletTemp */
+    { 186U, 20U, TRUE,  FALSE },  /* BMS_EnergyRemaining */
+    { 202U, 16U, TRUE,  FALSE },  /* BMS_CycleCount */
+    { 214U, 4U,  TRUE,  FALSE },  /* BMS_PackStatusAliveCounter */
+    { 222U, 8U,  TRUE,  FALSE },  /* BMS_PackStatusCrc */
+    { 0U,   13U, FALSE, FALSE },  /* BMS_CellVoltage001 */
+    { 13U,  13U, FALSE, FALSE },  /* BMS_CellVoltage002 */
+    { 26U,  13U, FALSE, FALSE },  /* BMS_CellVoltage003 */
+    { 39U,  13U, FALSE, FALSE },  /* BMS_CellVoltage004 */
+    { 52U,  13U, FALSE, FALSE },  /* BMS_CellVoltage005 */
+    { 65U,  13U, FALSE, FALSE },  /* BMS_CellVoltage006 */
+    { 78U,  13U, FALSE, FALSE },  /* BMS_CellVoltage007 */
+    { 91U,  13U, FALSE, FALSE },  /* BMS_CellVoltage008 */
+    { 104U, 13U, FALSE, FALSE },  /* BMS_CellVoltage009 */
+    { 117U, 13U, FALSE, FALSE },  /* BMS_CellVoltage010 */
+    { 130U, 13U, FALSE, FALSE },  /* BMS_CellVoltage011 */
+    { 143U, 13U, FALSE, FALSE },  /* BMS_CellVoltage012 */
+    { 156U, 13U, FALSE, FALSE },  /* BMS_CellVoltage013 */
+    { 169U, 13U, FALSE, FALSE },  /* BMS_CellVoltage014 */
+    { 182U, 13U, FALSE, FALSE },  /* BMS_CellVoltage015 */
+    { 195U, 13U, FALSE, FALSE },  /* BMS_CellVoltage016 */
+    { 208U, 13U, FALSE, FALSE },  /* BMS_CellVoltage017 */
+    { 221U, 13U, FALSE, FALSE },  /* BMS_CellVoltage018 */
+    { 234U, 13U, FALSE, FALSE },  /* BMS_CellVoltage019 */
+    { 247U, 13U, FALSE, FALSE },  /* BMS_CellVoltage020 */
+    { 260U, 13U, FALSE, FALSE },  /* BMS_CellVoltage021 */
+    { 273U, 13U, FALSE, FALSE },  /* BMS_CellVoltage022 */
+    { 286U, 13U, FALSE, FALSE },  /* BMS_CellVoltage023 */
+    { 299U, 13U, FALSE, FALSE },  /* BMS_CellVoltage024 */
+    { 312U, 13U, FALSE, FALSE },  /* BMS_CellVoltage025 */
+    { 325U, 13U, FALSE, FALSE },  /* BMS_CellVoltage026 */
+    { 338U, 13U, FALSE, FALSE },  /* BMS_CellVoltage027 */
+    { 351U, 13U, FALSE, FALSE },  /* BMS_CellVoltage028 */
+    { 364U, 13U, FALSE, FALSE },  /* BMS_CellVoltage029 */
+    { 377U, 13U, FALSE, FALSE },  /* BMS_CellVoltage030 */
+    { 390U, 13U, FALSE, FALSE },  /* BMS_CellVoltage031 */
+    { 403U, 13U, FALSE, FALSE },  /* BMS_CellVoltage032 */
+    { 416U, 4U,  FALSE, FALSE },  /* BMS_CellVoltages1AliveCounter */
+    { 420U, 8U,  FALSE, FALSE },  /* BMS_CellVoltages1Crc */
+    { 0U,   13U, FALSE, FALSE },  /* BMS_CellVoltage033 */
+    { 13U,  13U, FALSE, FALSE },  /* BMS_CellVoltage034 */
+    { 26U,  13U, FALSE, FALSE },  /* BMS_CellVoltage035 */
+    { 39U,  13U, FALSE, FALSE },  /* BMS_CellVoltage036 */
+    { 52U,  13U, FALSE, FALSE },  /* BMS_CellVoltage037 */
+    { 65U,  13U, FALSE, FALSE },  /* BMS_CellVoltage038 */
+    { 78U,  13U, FALSE, FALSE },  /* BMS_CellVoltage039 */
+    { 91U,  13U, FALSE, FALSE },  /* BMS_CellVoltage040 */
+    { 104U, 13U, FALSE, FALSE },  /* BMS_CellVoltage041 */
+    { 117U, 13U, FALSE, FALSE },  /* BMS_CellVoltage042 */
+    { 130U, 13U, FALSE, FALSE },  /* BMS_CellVoltage043 */
+    { 143U, 13U, FALSE, FALSE },  /* BMS_CellVoltage044 */
+    { 156U, 13U, FALSE, FALSE },  /* BMS_CellVoltage045 */
+    { 169U, 13U, FALSE, FALSE },  /* BMS_CellVoltage046 */
+    { 182U, 13U, FALSE, FALSE },  /* BMS_CellVoltage047 */
+    { 195U, 13U, FALSE, FALSE },  /* BMS_CellVoltage048 */
+    { 208U, 13U, FALSE, FALSE },  /* BMS_CellVoltage049 */
+    { 221U, 13U, FALSE, FALSE },  /* BMS_CellVoltage050 */
+    { 234U, 13U, FALSE, FALSE },  /* BMS_CellVoltage051 */
+    { 247U, 13U, FALSE, FALSE },  /* BMS_CellVoltage052 */
+    { 260U, 13U, FALSE, FALSE },  /* BMS_CellVoltage053 */
+    { 273U, 13U, FALSE, FALSE },  /* BMS_CellVoltage054 */
+    { 286U, 13U, FALSE, FALSE },  /* BMS_CellVoltage055 */
+    { 299U, 13U, FALSE, FALSE },  /* BMS_CellVoltage056 */
+    { 312U, 13U, FALSE, FALSE },  /* BMS_CellVoltage057 */
+    { 325U, 13U, FALSE, FALSE },  /* BMS_CellVoltage058 */
+    { 338U, 13U, FALSE, FALSE },  /* BMS_CellVoltage059 */
+    { 351U, 13U, FALSE, FALSE },  /* BMS_CellVoltage060 */
+    { 364U, 13U, FALSE, FALSE },  /* BMS_CellVoltage061 */
+    { 377U, 13U, FALSE, FALSE },  /* BMS_CellVoltage062 */
+    { 390U, 13U, FALSE, FALSE },  /* BMS_CellVoltage063 */
+    { 403U, 13U, FALSE, FALSE },  /* BMS_CellVoltage064 */
+    { 416U, 4U,  FALSE, FALSE },  /* BMS_CellVoltages2AliveCounter */
+    { 420U, 8U,  FALSE, FALSE },  /* BMS_CellVoltages2Crc */
+    { 0U,   13U, FALSE, FALSE },  /* BMS_CellVoltage065 */
+    { 13U,  13U, FALSE, FALSE },  /* BMS_CellVoltage066 */
+    { 26U,  13U, FALSE, FALSE },  /* BMS_CellVoltage067 */
+    { 39U,  13U, FALSE, FALSE },  /* BMS_CellVoltage068 */
+    { 52U,  13U, FALSE, FALSE },  /* BMS_CellVoltage069 */
+    { 65U,  13U, FALSE, FALSE },  /* BMS_CellVoltage070 */
+    { 78U,  13U, FALSE, FALSE },  /* BMS_CellVoltage071 */
+    { 91U,  13U, FALSE, FALSE },  /* BMS_CellVoltage072 */
+    { 104U, 13U, FALSE, FALSE },  /* BMS_CellVoltage073 */
+    { 117U, 13U, FALSE, FALSE },  /* BMS_CellVoltage074 */
+    { 130U, 13U, FALSE, FALSE },  /* BMS_CellVoltage075 */
+    { 143U, 13U, FALSE, FALSE },  /* BMS_CellVoltage076 */
+    { 156U, 13U, FALSE, FALSE },  /* BMS_CellVoltage077 */
+    { 169U, 13U, FALSE, FALSE },  /* BMS_CellVoltage078 */
+    { 182U, 13U, FALSE, FALSE },  /* BMS_CellVoltage079 */
+    { 195U, 13U, FALSE, FALSE },  /* BMS_CellVoltage080 */
+    { 208U, 13U, FALSE, FALSE },  /* BMS_CellVoltage081 */
+    { 221U, 13U, FALSE, FALSE },  /* BMS_CellVoltage082 */
+    { 234U, 13U, FALSE, FALSE },  /* BMS_CellVoltage083 */
+    { 247U, 13U, FALSE, FALSE },  /* BMS_CellVoltage084 */
+    { 260U, 13U, FALSE, FALSE },  /* BMS_CellVoltage085 */
+    { 273U, 13U, FALSE, FALSE },  /* BMS_CellVoltage086 */
+    { 286U, 13U, FALSE, FALSE },  /* BMS_CellVoltage087 */
+    { 299U, 13U, FALSE, FALSE },  /* BMS_CellVoltage088 */
+    { 312U, 13U, FALSE, FALSE },  /* BMS_CellVoltage089 */
+    { 325U, 13U, FALSE, FALSE },  /* BMS_CellVoltage090 */
+    { 338U, 13U, FALSE, FALSE },  /* BMS_CellVoltage091 */
+    { 351U, 13U, FALSE, FALSE },  /* BMS_CellVoltage092 */
+    { 364U, 13U, FALSE, FALSE },  /* BMS_CellVoltage093 */
+    { 377U, 13U, FALSE, FALSE },  /* BMS_CellVoltage094 */
+    { 390U, 13U, FALSE, FALSE },  /* BMS_CellVoltage095 */
+    { 403U, 13U, FALSE, FALSE },  /* BMS_CellVoltage096 */
+    { 416U, 4U,  FALSE, FALSE },  /* BMS_CellVoltages3AliveCounter */
+    { 420U, 8U,  FALSE, FALSE },  /* BMS_CellVoltages3Crc */
+    { 0U,   8U,  FALSE, TRUE  },  /* BMS_CellTemp01 */
+    { 8U,   8U,  FALSE, TRUE  },  /* BMS_CellTemp02 */
+    { 16U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp03 */
+    { 24U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp04 */
+    { 32U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp05 */
+    { 40U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp06 */
+    { 48U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp07 */
+    { 56U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp08 */
+    { 64U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp09 */
+    { 72U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp10 */
+    { 80U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp11 */
+    { 88U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp12 */
+    { 96U,  8U,  FALSE, TRUE  },  /* BMS_CellTemp13 */
+    { 104U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp14 */
+    { 112U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp15 */
+    { 120U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp16 */
+    { 128U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp17 */
+    { 136U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp18 */
+    { 144U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp19 */
+    { 152U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp20 */
+    { 160U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp21 */
+    { 168U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp22 */
+    { 176U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp23 */
+    { 184U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp24 */
+    { 192U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp25 */
+    { 200U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp26 */
+    { 208U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp27 */
+    { 216U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp28 */
+    { 224U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp29 */
+    { 232U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp30 */
+    { 240U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp31 */
+    { 248U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp32 */
+    { 256U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp33 */
+    { 264U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp34 */
+    { 272U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp35 */
+    { 280U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp36 */
+    { 288U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp37 */
+    { 296U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp38 */
+    { 304U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp39 */
+    { 312U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp40 */
+    { 320U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp41 */
+    { 328U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp42 */
+    { 336U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp43 */
+    { 344U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp44 */
+    { 352U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp45 */
+    { 360U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp46 */
+    { 368U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp47 */
+    { 376U, 8U,  FALSE, TRUE  },  /* BMS_CellTemp48 */
+    { 384U, 4U,  FALSE, FALSE },  /* BMS_CellTempsAliveCounter */
+    { 388U, 8U,  FALSE, FALSE },  /* BMS_CellTempsCrc */
+    { 8U,   16U, TRUE,  TRUE  },  /* MCU_MotorSpeed */
+    { 26U,  14U, TRUE,  TRUE  },  /* MCU_MotorTorque */
+    { 46U,  12U, TRUE,  FALSE },  /* MCU_DcVoltage */
+    { 50U,  12U, TRUE,  TRUE  },  /* MCU_DcCurrent */
+    { 58U,  8U,  TRUE,  TRUE  },  /* MCU_InverterTemp */
+    { 66U,  8U,  TRUE,  TRUE  },  /* MCU_MotorTemp */
+    { 78U,  4U,  TRUE,  FALSE },  /* MCU_State */
+    { 77U,  1U,  TRUE,  FALSE },  /* MCU_Derating */
+    { 76U,  1U,  TRUE,  FALSE },  /* MCU_ActiveDischarge */
+    { 82U,  10U, TRUE,  FALSE },  /* MCU_FaultCode */
+    { 102U, 12U, TRUE,  FALSE },  /* MCU_TorqueLimitMotor */
+    { 106U, 12U, TRUE,  FALSE },  /* MCU_TorqueLimitGen */
+    { 127U, 11U, TRUE,  FALSE },  /* MCU_PhaseCurrentRms */
+    { 131U, 12U, TRUE,  FALSE },  /* MCU_RotorPosition */
+    { 139U, 8U,  TRUE,  TRUE  },  /* MCU_GateDriverTemp */
+    { 151U, 4U,  TRUE,  FALSE },  /* MCU_StatusAliveCounter */
+    { 159U, 8U,  TRUE,  FALSE },  /* MCU_StatusCrc */
+    { 11U,  13U, TRUE,  FALSE },  /* ESP_WheelSpeedFL */
+    { 30U,  13U, TRUE,  FALSE },  /* ESP_WheelSpeedFR */
+    { 33U,  13U, TRUE,  FALSE },  /* ESP_WheelSpeedRL */
+    { 52U,  13U, TRUE,  FALSE },  /* ESP_WheelSpeedRR */
+    { 48U,  4U,  TRUE,  FALSE },  /* ESP_WheelSpeedsAliveCounter */
+    { 56U,  8U,  TRUE,  FALSE },  /* ESP_WheelSpeedsCrc */
+    { 12U,  12U, TRUE,  TRUE  },  /* ESP_YawRate */
+    { 18U,  10U, TRUE,  TRUE  },  /* ESP_LateralAccel */
+    { 24U,  10U, TRUE,  TRUE  },  /* ESP_LongitudinalAccel */
+    { 44U,  12U, TRUE,  FALSE },  /* ESP_BrakePressure */
+    { 43U,  1U,  TRUE,  FALSE },  /* ESP_AbsActive */
+    { 42U,  1U,  TRUE,  FALSE },  /* ESP_TcsActive */
+    { 41U,  1U,  TRUE,  FALSE },  /* ESP_EspActive */
+    { 40U,  1U,  TRUE,  FALSE },  /* ESP_RegenAllowed */
+    { 52U,  4U,  TRUE,  FALSE },  /* ESP_RegenTorqueLimit */
+    { 48U,  4U,  TRUE,  FALSE },  /* ESP_DynamicsAliveCounter */
+    { 56U,  8U,  TRUE,  FALSE },  /* ESP_DynamicsCrc */
+    { 0U,   16U, FALSE, TRUE  },  /* SAS_Angle */
+    { 16U,  12U, FALSE, FALSE },  /* SAS_Speed */
+    { 28U,  1U,  FALSE, FALSE },  /* SAS_Calibrated */
+    { 29U,  1U,  FALSE, FALSE },  /* SAS_Fault */
+    { 30U,  10U, FALSE, TRUE  },  /* SAS_TorsionTorque */
+    { 40U,  10U, FALSE, FALSE },  /* SAS_Reserved */
+    { 50U,  4U,  FALSE, FALSE },  /* SAS_SteeringAliveCounter */
+    { 54U,  8U,  FALSE, FALSE },  /* SAS_SteeringCrc */
+    { 0U,   10U, FALSE, FALSE },  /* APS_AccelPedal1 */
+    { 10U,  10U, FALSE, FALSE },  /* APS_AccelPedal2 */
+    { 20U,  10U, FALSE, FALSE },  /* APS_BrakePedal */
+    { 30U,  1U,  FALSE, FALSE },  /* APS_BrakeSwitch */
+    { 31U,  1U,  FALSE, FALSE },  /* APS_KickDown */
+    { 32U,  2U,  FALSE, FALSE },  /* APS_PlausibilityFault */
+    { 34U,  6U,  FALSE, FALSE },  /* APS_CruiseButtons */
+    { 40U,  8U,  FALSE, FALSE },  /* APS_Reserved */
+    { 48U,  4U,  FALSE, FALSE },  /* APS_PedalsAliveCounter */
+    { 52U,  8U,  FALSE, FALSE },  /* APS_PedalsCrc */
+    { 0U,   28U, FALSE, FALSE },  /* GW_Odometer */
+    { 28U,  8U,  FALSE, TRUE  },  /* GW_AmbientTemp */
+    { 36U,  5U,  FALSE, FALSE },  /* GW_DoorState */
+    { 41U,  1U,  FALSE, FALSE },  /* GW_SeatBeltDriver */
+    { 42U,  2U,  FALSE, FALSE },  /* GW_KeyPosition */
+    { 44U,  3U,  FALSE, FALSE },  /* GW_DriveModeRequest */
+    { 47U,  12U, FALSE, FALSE },  /* GW_HvacPowerRequest */
+    { 59U,  17U, FALSE, FALSE },  /* GW_TimeOfDay */
+    { 76U,  1U,  FALSE, FALSE },  /* GW_VehicleLocked */
+    { 77U,  1U,  FALSE, FALSE },  /* GW_ChargePortOpen */
+    { 78U,  7U,  FALSE, FALSE },  /* GW_UserChargeLimit */
+    { 85U,  22U, FALSE, FALSE },  /* GW_Reserved */
+    { 107U, 4U,  FALSE, FALSE },  /* GW_VehicleInfoAliveCounter */
+    { 111U, 8U,  FALSE, FALSE },  /* GW_VehicleInfoCrc */
+    { 14U,  10U, TRUE,  FALSE },  /* OBC_AcVoltage */
+    { 20U,  10U, TRUE,  FALSE },  /* OBC_AcCurrent */
+    { 24U,  12U, TRUE,  FALSE },  /* OBC_DcVoltage */
+    { 44U,  12U, TRUE,  FALSE },  /* OBC_DcCurrent */
+    { 40U,  4U,  TRUE,  FALSE },  /* OBC_State */
+    { 55U,  1U,  TRUE,  FALSE },  /* OBC_PlugDetected */
+    { 52U,  3U,  TRUE,  FALSE },  /* OBC_ProximityPilot */
+    { 61U,  7U,  TRUE,  FALSE },  /* OBC_ControlPilotDuty */
+    { 69U,  8U,  TRUE,  TRUE  },  /* OBC_Temperature */
+    { 75U,  10U, TRUE,  FALSE },  /* OBC_FaultCode */
+    { 93U,  14U, TRUE,  FALSE },  /* OBC_MaxPower */
+    { 89U,  4U,  TRUE,  FALSE },  /* OBC_StatusAliveCounter */
+    { 97U,  8U,  TRUE,  FALSE },  /* OBC_StatusCrc */
+    { 0U,   10U, FALSE, FALSE },  /* DCDC_OutputVoltage */
+    { 10U,  10U, FALSE, FALSE },  /* DCDC_OutputCurrent */
+    { 20U,  12U, FALSE, FALSE },  /* DCDC_InputVoltage */
+    { 32U,  8U,  FALSE, TRUE  },  /* DCDC_Temperature */
+    { 40U,  3U,  FALSE, FALSE },  /* DCDC_State */
+    { 43U,  1U,  FALSE, FALSE },  /* DCDC_Fault */
+    { 44U,  1U,  FALSE, FALSE },  /* DCDC_Derating */
+    { 45U,  7U,  FALSE, FALSE },  /* DCDC_Reserved */
+    { 52U,  4U,  FALSE, FALSE },  /* DCDC_StatusAliveCounter */
+    { 56U,  8U,  FALSE, FALSE },  /* DCDC_StatusCrc */
+    { 10U,  14U, TRUE,  TRUE  },  /* VCU_MotorTorqueRequest */
+    { 26U,  16U, TRUE,  FALSE },  /* VCU_MotorSpeedLimitFwd */
+    { 42U,  16U, TRUE,  FALSE },  /* VCU_MotorSpeedLimitRev */
+    { 62U,  12U, TRUE,  FALSE },  /* VCU_TorqueLimitMotor */
+    { 66U,  12U, TRUE,  FALSE },  /* VCU_TorqueLimitGen */
+    { 65U,  1U,  TRUE,  FALSE },  /* VCU_InverterEnable */
+    { 78U,  3U,  TRUE,  FALSE },  /* VCU_ControlMode */
+    { 77U,  1U,  TRUE,  FALSE },  /* VCU_ActiveDischargeReq */
+    { 86U,  7U,  TRUE,  FALSE },  /* VCU_DampingGain */
+    { 90U,  12U, TRUE,  TRUE  },  /* VCU_RegenTorque */
+    { 102U, 4U,  TRUE,  FALSE },  /* VCU_TorqueRequestAliveCounter */
+    { 110U, 8U,  TRUE,  FALSE },  /* VCU_TorqueRequestCrc */
+    { 0U,   13U, FALSE, FALSE },  /* VCU_VehicleSpeed */
+    { 13U,  3U,  FALSE, FALSE },  /* VCU_DriveMode */
+    { 16U,  3U,  FALSE, FALSE },  /* VCU_GearActual */
+    { 19U,  1U,  FALSE, FALSE },  /* VCU_ReadyToDrive */
+    { 20U,  4U,  FALSE, FALSE },  /* VCU_HvState */
+    { 24U,  10U, FALSE, FALSE },  /* VCU_LvVoltage */
+    { 34U,  3U,  FALSE, FALSE },  /* VCU_PowerMode */
+    { 37U,  1U,  FALSE, FALSE },  /* VCU_DerateActive */
+    { 38U,  16U, FALSE, FALSE },  /* VCU_ActiveFaults */
+    { 54U,  10U, FALSE, FALSE },  /* VCU_RangeEstimate */
+    { 64U,  12U, FALSE, FALSE },  /* VCU_EnergyConsumption */
+    { 76U,  1U,  FALSE, FALSE },  /* VCU_CreepEnabled */
+    { 77U,  2U,  FALSE, FALSE },  /* VCU_RegenLevel */
+    { 79U,  4U,  FALSE, FALSE },  /* VCU_ChargeState */
+    { 83U,  4U,  FALSE, FALSE },  /* VCU_ThermalState */
+    { 87U,  5U,  FALSE, FALSE },  /* VCU_WakeupReason */
+    { 92U,  1U,  FALSE, FALSE },  /* VCU_KeepAwake */
+    { 93U,  24U, FALSE, FALSE },  /* VCU_OperatingHours */
+    { 117U, 16U, FALSE, FALSE },  /* VCU_SoftwareVersion */
+    { 133U, 4U,  FALSE, FALSE },  /* VCU_StatusAliveCounter */
+    { 137U, 8U,  FALSE, FALSE },  /* VCU_StatusCrc */
+    { 0U,   14U, FALSE, TRUE  },  /* PT_WheelTorqueFL */
+    { 14U,  14U, FALSE, TRUE  },  /* PT_WheelTorqueFR */
+    { 28U,  14U, FALSE, TRUE  },  /* PT_WheelTorqueRL */
+    { 42U,  14U, FALSE, TRUE  },  /* PT_WheelTorqueRR */
+    { 56U,  15U, FALSE, TRUE  },  /* PT_AxleTorqueFront */
+    { 71U,  15U, FALSE, TRUE  },  /* PT_AxleTorqueRear */
+    { 86U,  18U, FALSE, TRUE  },  /* PT_MotorPowerMech */
+    { 104U, 18U, FALSE, TRUE  },  /* PT_MotorPowerElec */
+    { 122U, 16U, FALSE, FALSE },  /* PT_BatteryPowerLimitChg */
+    { 138U, 16U, FALSE, FALSE },  /* PT_BatteryPowerLimitDis */
+    { 154U, 10U, FALSE, FALSE },  /* PT_EfficiencyEstimate */
+    { 164U, 9U,  FALSE, TRUE  },  /* PT_SlipFront */
+    { 173U, 9U,  FALSE, TRUE  },  /* PT_SlipRear */
+    { 182U, 13U, FALSE, TRUE  },  /* PT_YawTorqueRequest */
+    { 195U, 3U,  FALSE, FALSE },  /* PT_PedalMap */
+    { 198U, 8U,  FALSE, FALSE },  /* PT_CreepTorque */
+    { 206U, 10U, FALSE, TRUE  },  /* PT_CoastTorque */
+    { 216U, 14U, FALSE, FALSE },  /* PT_VehicleMass */
+    { 230U, 9U,  FALSE, TRUE  },  /* PT_RoadGradient */
+    { 239U, 1U,  FALSE, FALSE },  /* PT_TractionLimited */
+    { 240U, 1U,  FALSE, FALSE },  /* PT_ThermalLimited */
+    { 241U, 1U,  FALSE, FALSE },  /* PT_BatteryLimited */
+    { 242U, 3U,  FALSE, FALSE },  /* PT_TorqueSource */
+    { 245U, 32U, FALSE, FALSE },  /* PT_EnergyTotal */
+    { 277U, 32U, FALSE, FALSE },  /* PT_EnergyRegen */
+    { 309U, 40U, FALSE, FALSE },  /* PT_Timestamp */
+    { 349U, 24U, FALSE, FALSE },  /* PT_DistanceTrip */
+    { 373U, 12U, FALSE, TRUE  },  /* PT_AccelEstimate */
+    { 385U, 8U,  FALSE, FALSE },  /* PT_JerkLimit */
+    { 393U, 11U, FALSE, TRUE  },  /* PT_ShaftOscillation */
+    { 404U, 4U,  FALSE, FALSE },  /* VCU_PowertrainDataAliveCounter */
+    { 408U, 8U,  FALSE, FALSE },  /* VCU_PowertrainDataCrc */
+    { 10U,  14U, TRUE,  TRUE  },  /* PTM_WheelTorqueFL */
+    { 28U,  14U, TRUE,  TRUE  },  /* PTM_WheelTorqueFR */
+    { 46U,  14U, TRUE,  TRUE  },  /* PTM_WheelTorqueRL */
+    { 48U,  14U, TRUE,  TRUE  },  /* PTM_WheelTorqueRR */
+    { 65U,  15U, TRUE,  TRUE  },  /* PTM_AxleTorqueFront */
+    { 82U,  15U, TRUE,  TRUE  },  /* PTM_AxleTorqueRear */
+    { 96U,  18U, TRUE,  TRUE  },  /* PTM_MotorPowerMech */
+    { 126U, 18U, TRUE,  TRUE  },  /* PTM_MotorPowerElec */
+    { 142U, 16U, TRUE,  FALSE },  /* PTM_BatteryPowerLimitChg */
+    { 158U, 16U, TRUE,  FALSE },  /* PTM_BatteryPowerLimitDis */
+    { 164U, 10U, TRUE,  FALSE },  /* PTM_EfficiencyEstimate */
+    { 171U, 9U,  TRUE,  TRUE  },  /* PTM_SlipFront */
+    { 178U, 9U,  TRUE,  TRUE  },  /* PTM_SlipRear */
+    { 197U, 13U, TRUE,  TRUE  },  /* PTM_YawTorqueRequest */
+    { 194U, 3U,  TRUE,  FALSE },  /* PTM_PedalMap */
+    { 202U, 8U,  TRUE,  FALSE },  /* PTM_CreepTorque */
+    { 208U, 10U, TRUE,  TRUE  },  /* PTM_CoastTorque */
+    { 226U, 14U, TRUE,  FALSE },  /* PTM_VehicleMass */
+    { 233U, 9U,  TRUE,  TRUE  },  /* PTM_RoadGradient */
+    { 232U, 1U,  TRUE,  FALSE },  /* PTM_TractionLimited */
+    { 247U, 1U,  TRUE,  FALSE },  /* PTM_ThermalLimited */
+    { 246U, 1U,  TRUE,  FALSE },  /* PTM_BatteryLimited */
+    { 243U, 3U,  TRUE,  FALSE },  /* PTM_TorqueSource */
+    { 275U, 32U, TRUE,  FALSE },  /* PTM_EnergyTotal */
+    { 307U, 32U, TRUE,  FALSE },  /* PTM_EnergyRegen */
+    { 347U, 40U, TRUE,  FALSE },  /* PTM_Timestamp */
+    { 371U, 24U, TRUE,  FALSE },  /* PTM_DistanceTrip */
+    { 391U, 12U, TRUE,  TRUE  },  /* PTM_AccelEstimate */
+    { 399U, 8U,  TRUE,  FALSE },  /* PTM_JerkLimit */
+    { 404U, 11U, TRUE,  TRUE  },  /* PTM_ShaftOscillation */
+    { 400U, 4U,  TRUE,  FALSE },  /* VCU_PowertrainDataMotAliveCounter */
+    { 408U, 8U,  TRUE,  FALSE },  /* VCU_PowertrainDataMotCrc */
+    { 7U,   1U,  TRUE,  FALSE },  /* VCU_ChargeEnable */
+    { 10U,  13U, TRUE,  FALSE },  /* VCU_ChargeVoltageTarget */
+    { 30U,  12U, TRUE,  FALSE },  /* VCU_ChargeCurrentLimit */
+    { 27U,  3U,  TRUE,  FALSE },  /* VCU_ChargeMode */
+    { 26U,  1U,  TRUE,  FALSE },  /* VCU_PlugLock */
+    { 25U,  1U,  TRUE,  FALSE },  /* VCU_PrechargeRequest */
+    { 38U,  3U,  TRUE,  FALSE },  /* VCU_ContactorRequest */
+    { 44U,  10U, TRUE,  FALSE },  /* VCU_ChargeTimeRemaining */
+    { 62U,  14U, TRUE,  FALSE },  /* VCU_ChargePowerLimit */
+    { 61U,  1U,  TRUE,  FALSE },  /* VCU_V2lEnable */
+    { 57U,  4U,  TRUE,  FALSE },  /* VCU_ChargeControlAliveCounter */
+    { 65U,  8U,  TRUE,  FALSE },  /* VCU_ChargeControlCrc */
+    { 0U,   7U,  FALSE, FALSE },  /* VCU_PumpSpeedBattery */
+    { 7U,   7U,  FALSE, FALSE },  /* VCU_PumpSpeedMotor */
+    { 14U,  7U,  FALSE, FALSE },  /* VCU_FanSpeed */
+    { 21U,  1U,  FALSE, FALSE },  /* VCU_ChillerRequest */
+    { 22U,  10U, FALSE, FALSE },  /* VCU_HeaterPower */
+    { 32U,  8U,  FALSE, FALSE },  /* VCU_ValvePosition */
+    { 40U,  8U,  FALSE, TRUE  },  /* VCU_TargetBatteryTemp */
+    { 48U,  4U,  FALSE, FALSE },  /* VCU_ThermalRequestAliveCounter */
+    { 52U,  8U,  FALSE, FALSE },  /* VCU_ThermalRequestCrc */
+    { 0U,   1U,  FALSE, FALSE },  /* VCU_DcdcEnable */
+    { 1U,   10U, FALSE, FALSE },  /* VCU_DcdcVoltageTarget */
+    { 11U,  10U, FALSE, FALSE },  /* VCU_DcdcCurrentLimit */
+    { 21U,  2U,  FALSE, FALSE },  /* VCU_DcdcMode */
+    { 23U,  4U,  FALSE, FALSE },  /* VCU_DcdcControlAliveCounter */
+    { 27U,  8U,  FALSE, FALSE }   /* VCU_DcdcControlCrc */
+};
+#endif
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
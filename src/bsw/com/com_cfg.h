@@ -0,0 +1,502 @@
+/**
+ * @file    com_cfg.h
+ * @brief   COM Configuration - I-PDU and Signal Handles
+ * @version 1.3.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Handles of the I-PDUs and signals of the VCU COM configuration.
+ *
+ * Generated kernels (TX = pack in Com_TriggerTransmit(), RX = unpack in
+ * Com_RxIndication(), RX-D = unpack in Com_MainFunctionRx()) and reception
+ * deadlines (ComTimeout, ComRxDataTimeoutAction):
+ * | I-PDU                  | Dir  | Length | Signals | Kernel words (32 bit)   | Split signals | Deadline        |
+ * |------------------------|------|--------|---------|-------------------------|---------------|-----------------|
+ * | BMS_PackStatus         | RX   | 32     | 23      | 7 x Be32                | 5             | 100 ms REPLACE  |
+ * | BMS_CellVoltages1      | RX-D | 64     | 34      | 14 x Le32               | 12            | 500 ms NONE     |
+ * | BMS_CellVoltages2      | RX-D | 64     | 34      | 14 x Le32               | 12            | 500 ms NONE     |
+ * | BMS_CellVoltages3      | RX-D | 64     | 34      | 14 x Le32               | 12            | 500 ms NONE     |
+ * | BMS_CellTemps          | RX-D | 64     | 50      | 13 x Le32               | 0             | 1000 ms NONE    |
+ * | MCU_Status             | RX   | 24     | 17      | 5 x Be32                | 4             | 50 ms REPLACE   |
+ * | ESP_WheelSpeeds        | RX   | 8      | 6       | 2 x Be32                | 1             | 50 ms NONE      |
+ * | ESP_Dynamics           | RX   | 8      | 11      | 2 x Be32                | 0             | 50 ms NONE      |
+ * | SAS_Steering           | RX   | 8      | 8       | 2 x Le32                | 1             | 50 ms NONE      |
+ * | APS_Pedals             | RX   | 8      | 10      | 2 x Le32                | 0             | 30 ms REPLACE   |
+ * | GW_VehicleInfo         | RX-D | 16     | 14      | 4 x Le32                | 3             | 500 ms NONE     |
+ * | OBC_Status             | RX-D | 16     | 13      | 4 x Be32                | 2             | 500 ms REPLACE  |
+ * | DCDC_Status            | RX-D | 8      | 10      | 2 x Le32                | 0             | 500 ms REPLACE  |
+ * | VCU_TorqueRequest      | TX   | 16     | 12      | 4 x Be32                | 3             | -               |
+ * | VCU_Status             | TX   | 32     | 21      | 5 x Le32                | 3             | -               |
+ * | VCU_PowertrainData     | TX   | 64     | 32      | 13 x Le32               | 12            | -               |
+ * | VCU_PowertrainDataMot  | TX   | 64     | 32      | 13 x Be32               | 12            | -               |
+ * | VCU_ChargeControl      | TX   | 16     | 12      | 3 x Be32                | 2             | -               |
+ * | VCU_ThermalRequest     | TX   | 8      | 9       | 2 x Le32                | 0             | -               |
+ * | VCU_DcdcControl        | TX   | 8      | 6       | 2 x Le32                | 1             | -               |
+ *
+ * Transmission modes (Com_MainFunctionTx()); the periodic I-PDUs put at
+ * most 64 bytes in one cycle (200 with all offsets 0):
+ * | I-PDU                  | Mode     | Period   | Offset  | MDT     | Triggering signals |
+ * |------------------------|----------|----------|---------|---------|--------------------|
+ * | VCU_TorqueRequest      | PERIODIC | 10 ms    | 0 ms    | -       | 0                  |
+ * | VCU_Status             | PERIODIC | 100 ms   | 0 ms    | -       | 0                  |
+ * | VCU_PowertrainData     | PERIODIC | 20 ms    | 5 ms    | -       | 0                  |
+ * | VCU_PowertrainDataMot  | PERIODIC | 20 ms    | 15 ms   | -       | 0                  |
+ * | VCU_ChargeControl      | MIXED    | 100 ms   | 10 ms   | 10 ms   | 6                  |
+ * | VCU_ThermalRequest     | DIRECT   | -        | -       | 50 ms   | 7                  |
+ * | VCU_DcdcControl        | MIXED    | 100 ms   | 20 ms   | 10 ms   | 2                  |
+ *
+ * @note Generated by tools/com/com_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef COM_CFG_H
+#define COM_CFG_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define COM_IPDU_COUNT                          20U
+#define COM_SIGNAL_COUNT                        388U
+#define COM_RX_DEADLINE_COUNT                   13U
+/** @brief Bytes of all SEND I-PDUs, the payload snapshot of one Com_MainFunctionTx() */
+#define COM_TX_BATCH_DATA_SIZE                  208U
+
+/* ===============================================================================================
+ *                                     MAIN FUNCTION PERIODS
+ * =============================================================================================== */
+
+/** @brief ComMainFunctionRx/ComMainFunctionPeriod in microseconds, the deadline time base */
+#define COM_MAIN_FUNCTION_RX_PERIOD_US          5000UL
+/** @brief ComMainFunctionTx/ComMainFunctionPeriod in microseconds, the transmission time base */
+#define COM_MAIN_FUNCTION_TX_PERIOD_US          5000UL
+
+/* ===============================================================================================
+ *                                         I-PDU HANDLES
+ * =============================================================================================== */
+
+#define ComConf_ComIPdu_BMS_PackStatus                  0U
+#define ComConf_ComIPdu_BMS_CellVoltages1               1U
+#define ComConf_ComIPdu_BMS_CellVoltages2               2U
+#define ComConf_ComIPdu_BMS_CellVoltages3               3U
+#define ComConf_ComIPdu_BMS_CellTemps                   4U
+#define ComConf_ComIPdu_MCU_Status                      5U
+#define ComConf_ComIPdu_ESP_WheelSpeeds                 6U
+#define ComConf_ComIPdu_ESP_Dynamics                    7U
+#define ComConf_ComIPdu_SAS_Steering                    8U
+#define ComConf_ComIPdu_APS_Pedals                      9U
+#define ComConf_ComIPdu_GW_VehicleInfo                  10U
+#define ComConf_ComIPdu_OBC_Status                      11U
+#define ComConf_ComIPdu_DCDC_Status                     12U
+#define ComConf_ComIPdu_VCU_TorqueRequest               13U
+#define ComConf_ComIPdu_VCU_Status                      14U
+#define ComConf_ComIPdu_VCU_PowertrainData              15U
+#define ComConf_ComIPdu_VCU_PowertrainDataMot           16U
+#define ComConf_ComIPdu_VCU_ChargeControl               17U
+#define ComConf_ComIPdu_VCU_ThermalRequest              18U
+#define ComConf_ComIPdu_VCU_DcdcControl                 19U
+
+/* ===============================================================================================
+ *                                         SIGNAL HANDLES
+ * =============================================================================================== */
+
+#define ComConf_ComSignal_BMS_PackVoltage               0U
+#define ComConf_ComSignal_BMS_PackCurrent               1U
+#define ComConf_ComSignal_BMS_StateOfCharge             2U
+#define ComConf_ComSignal_BMS_StateOfHealth             3U
+#define ComConf_ComSignal_BMS_MaxCellTemp               4U
+#define ComConf_ComSignal_BMS_MinCellTemp               5U
+#define ComConf_ComSignal_BMS_MaxChargePower            6U
+#define ComConf_ComSignal_BMS_MaxDischargePower         7U
+#define ComConf_ComSignal_BMS_IsolationResistance       8U
+#define ComConf_ComSignal_BMS_ContactorState            9U
+#define ComConf_ComSignal_BMS_BalancingActive           10U
+#define ComConf_ComSignal_BMS_FaultLevel                11U
+#define ComConf_ComSignal_BMS_ChargeRequest             12U
+#define ComConf_ComSignal_BMS_MaxCellVoltage            13U
+#define ComConf_ComSignal_BMS_MinCellVoltage            14U
+#define ComConf_ComSignal_BMS_MaxCellIndex              15U
+#define ComConf_ComSignal_BMS_MinCellIndex              16U
+#define ComConf_ComSignal_BMS_CoolantInletTemp          17U
+#define ComConf_ComSignal_BMS_CoolantOutletTemp         18U
+#define ComConf_ComSignal_BMS_EnergyRemaining           19U
+#define ComConf_ComSignal_BMS_CycleCount                20U
+#define ComConf_ComSignal_BMS_PackStatusAliveCounter    21U
+#define ComConf_ComSignal_BMS_PackStatusCrc             22U
+#define ComConf_ComSignal_BMS_CellVoltage001            23U
+#define ComConf_ComSignal_BMS_CellVoltage002            24U
+#define ComConf_ComSignal_BMS_CellVoltage003            25U
+#define ComConf_ComSignal_BMS_CellVoltage004            26U
+#define ComConf_ComSignal_BMS_CellVoltage005            27U
+#define ComConf_ComSignal_BMS_CellVoltage006            28U
+#define ComConf_ComSignal_BMS_CellVoltage007            29U
+#define ComConf_ComSignal_BMS_CellVoltage008            30U
+#define ComConf_ComSignal_BMS_CellVoltage009            31U
+#define ComConf_ComSignal_BMS_CellVoltage010            32U
+#define ComConf_ComSignal_BMS_CellVoltage011            33U
+#define ComConf_ComSignal_BMS_CellVoltage012            34U
+#define ComConf_ComSignal_BMS_CellVoltage013            35U
+#define ComConf_ComSignal_BMS_CellVoltage014            36U
+#define ComConf_ComSignal_BMS_CellVoltage015            37U
+#define ComConf_ComSignal_BMS_CellVoltage016            38U
+#define ComConf_ComSignal_BMS_CellVoltage017            39U
+#define ComConf_ComSignal_BMS_CellVoltage018            40U
+#define ComConf_ComSignal_BMS_CellVoltage019            41U
+#define ComConf_ComSignal_BMS_CellVoltage020            42U
+#define ComConf_ComSignal_BMS_CellVoltage021            43U
+#define ComConf_ComSignal_BMS_CellVoltage022            44U
+#define ComConf_ComSignal_BMS_CellVoltage023            45U
+#define ComConf_ComSignal_BMS_CellVoltage024            46U
+#define ComConf_ComSignal_BMS_CellVoltage025            47U
+#define ComConf_ComSignal_BMS_CellVoltage026            48U
+#define ComConf_ComSignal_BMS_CellVoltage027            49U
+#define ComConf_ComSignal_BMS_CellVoltage028            50U
+#define ComConf_ComSignal_BMS_CellVoltage029            51U
+#define ComConf_ComSignal_BMS_CellVoltage030            52U
+#define ComConf_ComSignal_BMS_CellVoltage031            53U
+#define ComConf_ComSignal_BMS_CellVoltage032            54U
+#define ComConf_ComSignal_BMS_CellVoltages1AliveCounter 55U
+#define ComConf_ComSignal_BMS_CellVoltages1Crc          56U
+#define ComConf_ComSignal_BMS_CellVoltage033            57U
+#define ComConf_ComSignal_BMS_CellVoltage034            58U
+#define ComConf_ComSignal_BMS_CellVoltage035            59U
+#define ComConf_ComSignal_BMS_CellVoltage036            60U
+#define ComConf_ComSignal_BMS_CellVoltage037            61U
+#define ComConf_ComSignal_BMS_CellVoltage038            62U
+#define ComConf_ComSignal_BMS_CellVoltage039            63U
+#define ComConf_ComSignal_BMS_CellVoltage040            64U
+#define ComConf_ComSignal_BMS_CellVoltage041            65U
+#define ComConf_ComSignal_BMS_CellVoltage042            66U
+#define ComConf_ComSignal_BMS_CellVoltage043            67U
+#define ComConf_ComSignal_BMS_CellVoltage044            68U
+#define ComConf_ComSignal_BMS_CellVoltage045            69U
+#define ComConf_ComSignal_BMS_CellVoltage046            70U
+#define ComConf_ComSignal_BMS_CellVoltage047            71U
+#define ComConf_ComSignal_BMS_CellVoltage048            72U
+#define ComConf_ComSignal_BMS_CellVoltage049            73U
+#define ComConf_ComSignal_BMS_CellVoltage050            74U
+#define ComConf_ComSignal_BMS_CellVoltage051            75U
+#define ComConf_ComSignal_BMS_CellVoltage052            76U
+#define ComConf_ComSignal_BMS_CellVoltage053            77U
+#define ComConf_ComSignal_BMS_CellVoltage054            78U
+#define ComConf_ComSignal_BMS_CellVoltage055            79U
+#define ComConf_ComSignal_BMS_CellVoltage056            80U
+#define ComConf_ComSignal_BMS_CellVoltage057            81U
+#define ComConf_ComSignal_BMS_CellVoltage058            82U
+#define ComConf_ComSignal_BMS_CellVoltage059            83U
+#define ComConf_ComSignal_BMS_CellVoltage060            84U
+#define ComConf_ComSignal_BMS_CellVoltage061            85U
+#define ComConf_ComSignal_BMS_CellVoltage062            86U
+#define ComConf_ComSignal_BMS_CellVoltage063            87U
+#define ComConf_ComSignal_BMS_CellVoltage064            88U
+#define ComConf_ComSignal_BMS_CellVoltages2AliveCounter 89U
+#define ComConf_ComSignal_BMS_CellVoltages2Crc          90U
+#define ComConf_ComSignal_BMS_CellVoltage065            91U
+#define ComConf_ComSignal_BMS_CellVoltage066            92U
+#define ComConf_ComSignal_BMS_CellVoltage067            93U
+#define ComConf_ComSignal_BMS_CellVoltage068            94U
+#define ComConf_ComSignal_BMS_CellVoltage069            95U
+#define ComConf_ComSignal_BMS_CellVoltage070            96U
+#define ComConf_ComSignal_BMS_CellVoltage071            97U
+#define ComConf_ComSignal_BMS_CellVoltage072            98U
+#define ComConf_ComSignal_BMS_CellVoltage073            99U
+#define ComConf_ComSignal_BMS_CellVoltage074            100U
+#define ComConf_ComSignal_BMS_CellVoltage075            101U
+#define ComConf_ComSignal_BMS_CellVoltage076            102U
+#define ComConf_ComSignal_BMS_CellVoltage077            103U
+#define ComConf_ComSignal_BMS_CellVoltage078            104U
+#define ComConf_ComSignal_BMS_CellVoltage079            105U
+#define ComConf_ComSignal_BMS_CellVoltage080            106U
+#define ComConf_ComSignal_BMS_CellVoltage081            107U
+#define ComConf_ComSignal_BMS_CellVoltage082            108U
+#define ComConf_ComSignal_BMS_CellVoltage083            109U
+#define ComConf_ComSignal_BMS_CellVoltage084            110U
+#define ComConf_ComSignal_BMS_CellVoltage085            111U
+#define ComConf_ComSignal_BMS_CellVoltage086            112U
+#define ComConf_ComSignal_BMS_CellVoltage087            113U
+#define ComConf_ComSignal_BMS_CellVoltage088            114U
+#define ComConf_ComSignal_BMS_CellVoltage089            115U
+#define ComConf_ComSignal_BMS_CellVoltage090            116U
+#define ComConf_ComSignal_BMS_CellVoltage091            117U
+#define ComConf_ComSignal_BMS_CellVoltage092            118U
+#define ComConf_ComSignal_BMS_CellVoltage093            119U
+#define ComConf_ComSignal_BMS_CellVoltage094            120U
+#define ComConf_ComSignal_BMS_CellVoltage095            121U
+#define ComConf_ComSignal_BMS_CellVoltage096            122U
+#define ComConf_ComSignal_BMS_CellVoltages3AliveCounter 123U
+#define ComConf_ComSignal_BMS_CellVoltages3Crc          124U
+#define ComConf_ComSignal_BMS_CellTemp01                125U
+#define ComConf_ComSignal_BMS_CellTemp02                126U
+#define ComConf_ComSignal_BMS_CellTemp03                127U
+#define ComConf_ComSignal_BMS_CellTemp04                128U
+#define ComConf_ComSignal_BMS_CellTemp05                129U
+#define ComConf_ComSignal_BMS_CellTemp06                130U
+#define ComConf_ComSignal_BMS_CellTemp07                131U
+#define ComConf_ComSignal_BMS_CellTemp08                132U
+#define ComConf_ComSignal_BMS_CellTemp09                133U
+#define ComConf_ComSignal_BMS_CellTemp10                134U
+#define ComConf_ComSignal_BMS_CellTemp11                135U
+#define ComConf_ComSignal_BMS_CellTemp12                136U
+#define ComConf_ComSignal_BMS_CellTemp13                137U
+#define ComConf_ComSignal_BMS_CellTemp14                138U
+#define ComConf_ComSignal_BMS_CellTemp15                139U
+#define ComConf_ComSignal_BMS_CellTemp16                140U
+#define ComConf_ComSignal_BMS_CellTemp17                141U
+#define ComConf_ComSignal_BMS_CellTemp18                142U
+#define ComConf_ComSignal_BMS_CellTemp19                143U
+#define ComConf_ComSignal_BMS_CellTemp20                144U
+#define ComConf_ComSignal_BMS_CellTemp21                145U
+#define ComConf_ComSignal_BMS_CellTemp22                146U
+#define ComConf_ComSignal_BMS_CellTemp23                147U
+#define ComConf_ComSignal_BMS_CellTemp24                148U
+#define ComConf_ComSignal_BMS_CellTemp25                149U
+#define ComConf_ComSignal_BMS_CellTemp26                150U
+#define ComConf_ComSignal_BMS_CellTemp27                151U
+#define ComConf_ComSignal_BMS_CellTemp28                152U
+#define ComConf_ComSignal_BMS_CellTemp29                153U
+#define ComConf_ComSignal_BMS_CellTemp30                154U
+#define ComConf_ComSignal_BMS_CellTemp31                155U
+#define ComConf_ComSignal_BMS_CellTemp32                156U
+#define ComConf_ComSignal_BMS_CellTemp33                157U
+#define ComConf_ComSignal_BMS_CellTemp34                158U
+#define ComConf_ComSignal_BMS_CellTemp35                159U
+#define ComConf_ComSignal_BMS_CellTemp36                160U
+#define ComConf_ComSignal_BMS_CellTemp37                161U
+#define ComConf_ComSignal_BMS_CellTemp38                162U
+#define ComConf_ComSignal_BMS_CellTemp39                163U
+#define ComConf_ComSignal_BMS_CellTemp40                164U
+#define ComConf_ComSignal_BMS_CellTemp41                165U
+#define ComConf_ComSignal_BMS_CellTemp42                166U
+#define ComConf_ComSignal_BMS_CellTemp43                167U
+#define ComConf_ComSignal_BMS_CellTemp44                168U
+#define ComConf_ComSignal_BMS_CellTemp45                169U
+#define ComConf_ComSignal_BMS_CellTemp46                170U
+#define ComConf_ComSignal_BMS_CellTemp47                171U
+#define ComConf_ComSignal_BMS_CellTemp48                172U
+#define ComConf_ComSignal_BMS_CellTempsAliveCounter     173U
+#define ComConf_ComSignal_BMS_CellTempsCrc              174U
+#define ComConf_ComSignal_MCU_MotorSpeed                175U
+#define ComConf_ComSignal_MCU_MotorTorque               176U
+#define ComConf_ComSignal_MCU_DcVoltage                 177U
+#define ComConf_ComSignal_MCU_DcCurrent                 178U
+#define ComConf_ComSignal_MCU_InverterTemp              179U
+#define ComConf_ComSignal_MCU_MotorTemp                 180U
+#define ComConf_ComSignal_MCU_State                     181U
+#define ComConf_ComSignal_MCU_Derating                  182U
+#define ComConf_ComSignal_MCU_ActiveDischarge           183U
+#define ComConf_ComSignal_MCU_FaultCode                 184U
+#define ComConf_ComSignal_MCU_TorqueLimitMotor          185U
+#define ComConf_ComSignal_MCU_TorqueLimitGen            186U
+#define ComConf_ComSignal_MCU_PhaseCurrentRms           187U
+#define ComConf_ComSignal_MCU_RotorPosition             188U
+#define ComConf_ComSignal_MCU_GateDriverTemp            189U
+#define ComConf_ComSignal_MCU_StatusAliveCounter        190U
+#define ComConf_ComSignal_MCU_StatusCrc                 191U
+#define ComConf_ComSignal_ESP_WheelSpeedFL              192U
+#define ComConf_ComSignal_ESP_WheelSpeedFR              193U
+#define ComConf_ComSignal_ESP_WheelSpeedRL              194U
+#define ComConf_ComSignal_ESP_WheelSpeedRR              195U
+#define ComConf_ComSignal_ESP_WheelSpeedsAliveCounter   196U
+#define ComConf_ComSignal_ESP_WheelSpeedsCrc            197U
+#define ComConf_ComSignal_ESP_YawRate                   198U
+#define ComConf_ComSignal_ESP_LateralAccel              199U
+#define ComConf_ComSignal_ESP_LongitudinalAccel         200U
+#define ComConf_ComSignal_ESP_BrakePressure             201U
+#define ComConf_ComSignal_ESP_AbsActive                 202U
+#define ComConf_ComSignal_ESP_TcsActive                 203U
+#define ComConf_ComSignal_ESP_EspActive                 204U
+#define ComConf_ComSignal_ESP_RegenAllowed              205U
+#define ComConf_ComSignal_ESP_RegenTorqueLimit          206U
+#define ComConf_ComSignal_ESP_DynamicsAliveCounter      207U
+#define ComConf_ComSignal_ESP_DynamicsCrc               208U
+#define ComConf_ComSignal_SAS_Angle                     209U
+#define ComConf_ComSignal_SAS_Speed                     210U
+#define ComConf_ComSignal_SAS_Calibrated                211U
+#define ComConf_ComSignal_SAS_Fault                     212U
+#define ComConf_ComSignal_SAS_TorsionTorque             213U
+#define ComConf_ComSignal_SAS_Reserved                  214U
+#define ComConf_ComSignal_SAS_SteeringAliveCounter      215U
+#define ComConf_ComSignal_SAS_SteeringCrc               216U
+#define ComConf_ComSignal_APS_AccelPedal1               217U
+#define ComConf_ComSignal_APS_AccelPedal2               218U
+#define ComConf_ComSignal_APS_BrakePedal                219U
+#define ComConf_ComSignal_APS_BrakeSwitch               220U
+#define ComConf_ComSignal_APS_KickDown                  221U
+#define ComConf_ComSignal_APS_PlausibilityFault         222U
+#define ComConf_ComSignal_APS_CruiseButtons             223U
+#define ComConf_ComSignal_APS_Reserved                  224U
+#define ComConf_ComSignal_APS_PedalsAliveCounter        225U
+#define ComConf_ComSignal_APS_PedalsCrc                 226U
+#define ComConf_ComSignal_GW_Odometer                   227U
+#define ComConf_ComSignal_GW_AmbientTemp                228U
+#define ComConf_ComSignal_GW_DoorState                  229U
+#define ComConf_ComSignal_GW_SeatBeltDriver             230U
+#define ComConf_ComSignal_GW_KeyPosition                231U
+#define ComConf_ComSignal_GW_DriveModeRequest           232U
+#define ComConf_ComSignal_GW_HvacPowerRequest           233U
+#define ComConf_ComSignal_GW_TimeOfDay                  234U
+#define ComConf_ComSignal_GW_VehicleLocked              235U
+#define ComConf_ComSignal_GW_ChargePortOpen             236U
+#define ComConf_ComSignal_GW_UserChargeLimit            237U
+#define ComConf_ComSignal_GW_Reserved                   238U
+#define ComConf_ComSignal_GW_VehicleInfoAliveCounter    239U
+#define ComConf_ComSignal_GW_VehicleInfoCrc             240U
+#define ComConf_ComSignal_OBC_AcVoltage                 241U
+#define ComConf_ComSignal_OBC_AcCurrent                 242U
+#define ComConf_ComSignal_OBC_DcVoltage                 243U
+#define ComConf_ComSignal_OBC_DcCurrent                 244U
+#define ComConf_ComSignal_OBC_State                     245U
+#define ComConf_ComSignal_OBC_PlugDetected              246U
+#define ComConf_ComSignal_OBC_ProximityPilot            247U
+#define ComConf_ComSignal_OBC_ControlPilotDuty          248U
+#define ComConf_ComSignal_OBC_Temperature               249U
+#define ComConf_ComSignal_OBC_FaultCode                 250U
+#define ComConf_ComSignal_OBC_MaxPower                  251U
+#define ComConf_ComSignal_OBC_StatusAliveCounter        252U
+#define ComConf_ComSignal_OBC_StatusCrc                 253U
+#define ComConf_ComSignal_DCDC_OutputVoltage            254U
+#define ComConf_ComSignal_DCDC_OutputCurrent            255U
+#define ComConf_ComSignal_DCDC_InputVoltage             256U
+#define ComConf_ComSignal_DCDC_Temperature              257U
+#define ComConf_ComSignal_DCDC_State                    258U
+#define ComConf_ComSignal_DCDC_Fault                    259U
+#define ComConf_ComSignal_DCDC_Derating                 260U
+#define ComConf_ComSignal_DCDC_Reserved                 261U
+#define ComConf_ComSignal_DCDC_StatusAliveCounter       262U
+#define ComConf_ComSignal_DCDC_StatusCrc                263U
+#define ComConf_ComSignal_VCU_MotorTorqueRequest        264U
+#define ComConf_ComSignal_VCU_MotorSpeedLimitFwd        265U
+#define ComConf_ComSignal_VCU_MotorSpeedLimitRev        266U
+#define ComConf_ComSignal_VCU_TorqueLimitMotor          267U
+#define ComConf_ComSignal_VCU_TorqueLimitGen            268U
+#define ComConf_ComSignal_VCU_InverterEnable            269U
+#define ComConf_ComSignal_VCU_ControlMode               270U
+#define ComConf_ComSignal_VCU_ActiveDischargeReq        271U
+#define ComConf_ComSignal_VCU_DampingGain               272U
+#define ComConf_ComSignal_VCU_RegenTorque               273U
+#define ComConf_ComSignal_VCU_TorqueRequestAliveCounter 274U
+#define ComConf_ComSignal_VCU_TorqueRequestCrc          275U
+#define ComConf_ComSignal_VCU_VehicleSpeed              276U
+#define ComConf_ComSignal_VCU_DriveMode                 277U
+#define ComConf_ComSignal_VCU_GearActual                278U
+#define ComConf_ComSignal_VCU_ReadyToDrive              279U
+#define ComConf_ComSignal_VCU_HvState                   280U
+#define ComConf_ComSignal_VCU_LvVoltage                 281U
+#define ComConf_ComSignal_VCU_PowerMode                 282U
+#define ComConf_ComSignal_VCU_DerateActive              283U
+#define ComConf_ComSignal_VCU_ActiveFaults              284U
+#define ComConf_ComSignal_VCU_RangeEstimate             285U
+#define ComConf_ComSignal_VCU_EnergyConsumption         286U
+#define ComConf_ComSignal_VCU_CreepEnabled              287U
+#define ComConf_ComSignal_VCU_RegenLevel                288U
+#define ComConf_ComSignal_VCU_ChargeState               289U
+#define ComConf_ComSignal_VCU_ThermalState              290U
+#define ComConf_ComSignal_VCU_WakeupReason              291U
+#define ComConf_ComSignal_VCU_KeepAwake                 292U
+#define ComConf_ComSignal_VCU_OperatingHours            293U
+#define ComConf_ComSignal_VCU_SoftwareVersion           294U
+#define ComConf_ComSignal_VCU_StatusAliveCounter        295U
+#define ComConf_ComSignal_VCU_StatusCrc                 296U
+#define ComConf_ComSignal_PT_WheelTorqueFL              297U
+#define ComConf_ComSignal_PT_WheelTorqueFR              298U
+#define ComConf_ComSignal_PT_WheelTorqueRL              299U
+#define ComConf_ComSignal_PT_WheelTorqueRR              300U
+#define ComConf_ComSignal_PT_AxleTorqueFront            301U
+#define ComConf_ComSignal_PT_AxleTorqueRear             302U
+#define ComConf_ComSignal_PT_MotorPowerMech             303U
+#define ComConf_ComSignal_PT_MotorPowerElec             304U
+#define ComConf_ComSignal_PT_BatteryPowerLimitChg       305U
+#define ComConf_ComSignal_PT_BatteryPowerLimitDis       306U
+#define ComConf_ComSignal_PT_EfficiencyEstimate         307U
+#define ComConf_ComSignal_PT_SlipFront                  308U
+#define ComConf_ComSignal_PT_SlipRear                   309U
+#define ComConf_ComSignal_PT_YawTorqueRequest           310U
+#define ComConf_ComSignal_PT_PedalMap                   311U
+#define ComConf_ComSignal_PT_CreepTorque                312U
+#define ComConf_ComSignal_PT_CoastTorque                313U
+#define ComConf_ComSignal_PT_VehicleMass                314U
+#define ComConf_ComSignal_PT_RoadGradient               315U
+#define ComConf_ComSignal_PT_TractionLimited            316U
+#define ComConf_ComSignal_PT_ThermalLimited             317U
+#define ComConf_ComSignal_PT_BatteryLimited             318U
+#define ComConf_ComSignal_PT_TorqueSource               319U
+#define ComConf_ComSignal_PT_EnergyTotal                320U
+#define ComConf_ComSignal_PT_EnergyRegen                321U
+#define ComConf_ComSignal_PT_Timestamp                  322U
+#define ComConf_ComSignal_PT_DistanceTrip               323U
+#define ComConf_ComSignal_PT_AccelEstimate              324U
+#define ComConf_ComSignal_PT_JerkLimit                  325U
+#define ComConf_ComSignal_PT_ShaftOscillation           326U
+#define ComConf_ComSignal_VCU_PowertrainDataAliveCounter 327U
+#define ComConf_ComSignal_VCU_PowertrainDataCrc         328U
+#define ComConf_ComSignal_PTM_WheelTorqueFL             329U
+#define ComConf_ComSignal_PTM_WheelTorqueFR             330U
+#define ComConf_ComSignal_PTM_WheelTorqueRL             331U
+#define ComConf_ComSignal_PTM_WheelTorqueRR             332U
+#define ComConf_ComSignal_PTM_AxleTorqueFront           333U
+#define ComConf_ComSignal_PTM_AxleTorqueRear            334U
+#define ComConf_ComSignal_PTM_MotorPowerMech            335U
+#define ComConf_ComSignal_PTM_MotorPowerElec            336U
+#define ComConf_ComSignal_PTM_BatteryPowerLimitChg      337U
+#define ComConf_ComSignal_PTM_BatteryPowerLimitDis      338U
+#define ComConf_ComSignal_PTM_EfficiencyEstimate        339U
+#define ComConf_ComSignal_PTM_SlipFront                 340U
+#define ComConf_ComSignal_PTM_SlipRear                  341U
+#define ComConf_ComSignal_PTM_YawTorqueRequest          342U
+#define ComConf_ComSignal_PTM_PedalMap                  343U
+#define ComConf_ComSignal_PTM_CreepTorque               344U
+#define ComConf_ComSignal_PTM_CoastTorque               345U
+#define ComConf_ComSignal_PTM_VehicleMass               346U
+#define ComConf_ComSignal_PTM_RoadGradient              347U
+#define ComConf_ComSignal_PTM_TractionLimited           348U
+#define ComConf_ComSignal_PTM_ThermalLimited            349U
+#define ComConf_ComSignal_PTM_BatteryLimited            350U
+#define ComConf_ComSignal_PTM_TorqueSource              351U
+#define ComConf_ComSignal_PTM_EnergyTotal               352U
+#define ComConf_ComSignal_PTM_EnergyRegen               353U
+#define ComConf_ComSignal_PTM_Timestamp                 354U
+#define ComConf_ComSignal_PTM_DistanceTrip              355U
+#define ComConf_ComSignal_PTM_AccelEstimate             356U
+#define ComConf_ComSignal_PTM_JerkLimit                 357U
+#define ComConf_ComSignal_PTM_ShaftOscillation          358U
+#define ComConf_ComSignal_VCU_PowertrainDataMotAliveCounter 359U
+#define ComConf_ComSignal_VCU_PowertrainDataMotCrc      360U
+#define ComConf_ComSignal_VCU_ChargeEnable              361U
+#define ComConf_ComSignal_VCU_ChargeVoltageTarget       362U
+#define ComConf_ComSignal_VCU_ChargeCurrentLimit        363U
+#define ComConf_ComSignal_VCU_ChargeMode                364U
+#define ComConf_ComSignal_VCU_PlugLock                  365U
+#define ComConf_ComSignal_VCU_PrechargeRequest          366U
+#define ComConf_ComSignal_VCU_ContactorRequest          367U
+#define ComConf_ComSignal_VCU_ChargeTimeRemaining       368U
+#define ComConf_ComSignal_VCU_ChargePowerLimit          369U
+#define ComConf_ComSignal_VCU_V2lEnable                 370U
+#define ComConf_ComSignal_VCU_ChargeControlAliveCounter 371U
+#define ComConf_ComSignal_VCU_ChargeControlCrc          372U
+#define ComConf_ComSignal_VCU_PumpSpeedBattery          373U
+#define ComConf_ComSignal_VCU_PumpSpeedMotor            374U
+#define ComConf_ComSignal_VCU_FanSpeed                  375U
+#define ComConf_ComSignal_VCU_ChillerRequest            376U
+#define ComConf_ComSignal_VCU_HeaterPower               377U
+#define ComConf_ComSignal_VCU_ValvePosition             378U
+#define ComConf_ComSignal_VCU_TargetBatteryTemp         379U
+#define ComConf_ComSignal_VCU_ThermalRequestAliveCounter 380U
+#define ComConf_ComSignal_VCU_ThermalRequestCrc         381U
+#define ComConf_ComSignal_VCU_DcdcEnable                382U
+#define ComConf_ComSignal_VCU_DcdcVoltageTarget         383U
+#define ComConf_ComSignal_VCU_DcdcCurrentLimit          384U
+#define ComConf_ComSignal_VCU_DcdcMode                  385U
+#define ComConf_ComSignal_VCU_DcdcControlAliveCounter   386U
+#define ComConf_ComSignal_VCU_DcdcControlCrc            387U
+
+#endif /* COM_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
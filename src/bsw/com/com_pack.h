@@ -0,0 +1,103 @@
+/**
+ * @file    com_pack.h
+ * @brief   COM - Word Access Primitives of the Generated Pack/Unpack Kernels
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Loads and stores of 32-bit words of a PDU buffer in Intel (LITTLE_ENDIAN)
+ * or Motorola (BIG_ENDIAN) byte order. The generated kernels (com_cfg.c)
+ * move all signal parts of a word with one load, shifts and masks and one
+ * store instead of touching the PDU byte by byte:
+ *
+ * | Access | Byte order of the word in the PDU | Cortex-M7 (little endian) |
+ * |--------|-----------------------------------|---------------------------|
+ * | Le32   | Byte 0 least significant          | LDR / STR                 |
+ * | Be32   | Byte 0 most significant           | LDR + REV / REV + STR     |
+ *
+ * Implementation Notes:
+ * - The word is copied with memcpy(), which the compiler turns into a single
+ *   LDR/STR. The kernels only access word-aligned offsets of 8-byte aligned
+ *   buffers, so the accesses are aligned and a store is always forwarded to
+ *   a later load of the same word
+ * - The byte swap is BYTE_SWAP32() (REV), selected by CPU_BYTE_ORDER
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @see com_stack.h
+ */
+
+#ifndef COM_PACK_H
+#define COM_PACK_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include <string.h>
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    INLINE FUNCTIONS
+ * =============================================================================================== */
+
+/**
+ * @brief Load 4 PDU bytes, byte 0 least significant
+ */
+STATIC_INLINE uint32 Com_LoadLe32(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    uint32 word;
+
+    (void)memcpy(&word, Src, sizeof(word));
+#if (CPU_BYTE_ORDER == HIGH_BYTE_FIRST)
+    word = BYTE_SWAP32(word);
+#endif
+    return word;
+}
+
+/**
+ * @brief Load 4 PDU bytes, byte 0 most significant
+ */
+STATIC_INLINE uint32 Com_LoadBe32(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    uint32 word;
+
+    (void)memcpy(&word, Src, sizeof(word));
+#if (CPU_BYTE_ORDER == LOW_BYTE_FIRST)
+    word = BYTE_SWAP32(word);
+#endif
+    return word;
+}
+
+/**
+ * @brief Store 4 PDU bytes, byte 0 least significant
+ */
+STATIC_INLINE void Com_StoreLe32(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, uint32 Word)
+{
+#if (CPU_BYTE_ORDER == HIGH_BYTE_FIRST)
+    Word = BYTE_SWAP32(Word);
+#endif
+    (void)memcpy(Dst, &Word, sizeof(Word));
+}
+
+/**
+ * @brief Store 4 PDU bytes, byte 0 most significant
+ */
+STATIC_INLINE void Com_StoreBe32(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, uint32 Word)
+{
+#if (CPU_BYTE_ORDER == LOW_BYTE_FIRST)
+    Word = BYTE_SWAP32(Word);
+#endif
+    (void)memcpy(Dst, &Word, sizeof(Word));
+}
+
+#endif /* COM_PACK_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
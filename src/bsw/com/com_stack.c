@@ -0,0 +1,640 @@
+/**
+ * @file    com_stack.c
+ * @brief   COM - Signal Gateway between the Application and the I-PDUs
+ * @version 1.2.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Signal and I-PDU services of com_stack.h. The services move values
+ * between the caller and the shadow of an I-PDU; all bit work is done by
+ * the generated kernels of the I-PDU (Com_IPdu[].pack / .unpack).
+ *
+ * I-PDU state (one byte per I-PDU):
+ *
+ * | Flag                | Set by                        | Cleared by                       |
+ * |---------------------|-------------------------------|----------------------------------|
+ * | COM_IPDU_TX_DIRTY   | Com_SendSignal()              | Com_TriggerTransmit() (packed)   |
+ * | COM_IPDU_RX_PENDING | Com_RxIndication() (DEFERRED) | Com_MainFunctionRx() (unpacked)  |
+ * | COM_IPDU_RX_QUEUED  | Com_RxIndication() (DEFERRED) | Com_MainFunctionRx() (dequeued)  |
+ * | COM_IPDU_RX_TIMEOUT | Com_MainFunctionRx() (missed) | Com_RxIndication()               |
+ * | COM_IPDU_TX_REQUEST | Com_SendSignal() (triggering),| Com_MainFunctionTx() (handed to  |
+ * |                     | period timer                  | the PduR)                        |
+ *
+ * Reception deadlines are counted in Com_MainFunctionRx() cycles.
+ * Com_RxIndication() stores the cycle in which the deadline of its I-PDU
+ * expires, one word written; Com_MainFunctionRx() advances the cycle count
+ * and compares it with the deadline of every monitored I-PDU. The scan
+ * costs per monitored I-PDU and cycle, about 1 ns each on the host.
+ * A timing wheel would bound the main function by the missed deadlines
+ * instead, but with I-PDUs received every few cycles its re-arms cost two
+ * to four times the scan in total, whether each reception relinks the
+ * timer or the timer is re-inserted from a reception stamp when it expires
+ * (bench_com_deadline.c). The scan is kept for the lower total.
+ *
+ * DEFERRED I-PDUs are queued once in Com_RxQueue by Com_RxIndication(), and
+ * Com_MainFunctionRx() unpacks only the queued ones.
+ *
+ * Transmission periods are periodic timers of a module-private timing
+ * wheel (timer_manager.h) ticked by Com_MainFunctionTx(), started at
+ * Com_Init() with the offset of the I-PDU. An expired period and a
+ * triggering Com_SendSignal() both set COM_IPDU_TX_REQUEST and queue the
+ * I-PDU once.
+ * Com_MainFunctionTx() takes every queued I-PDU whose minimum delay time
+ * elapsed since its last transmission, keeps the others queued, and
+ * hands the ones taken to PduR_ComTransmitBatch() in one call. The PduR
+ * sorts the destinations by controller and makes one batched call per
+ * CAN or Ethernet controller instead of one call per I-PDU and
+ * destination.
+ *
+ * Implementation Notes:
+ * - A burst of Com_SendSignal() calls to one I-PDU costs one pack, done
+ *   when the PDU is fetched for transmission
+ * - A DEFERRED I-PDU received several times between two main functions is
+ *   unpacked once, from the last reception
+ * - Shadow and PDU buffer of an I-PDU are only accessed under
+ *   COM_ENTER_CRITICAL(); the sections are bounded by one kernel
+ * - A missed deadline is handled once, in the cycle it expires; the next
+ *   one is set by the next reception
+ * - A deadline found expired while Com_RxIndication() stores a new one from
+ *   an ISR is discarded: it is compared again under the section
+ * - The minimum delay time also gates the periodic transmissions, so
+ *   a period and a trigger close together send the I-PDU once
+ * - A dirty I-PDU is packed and copied to Com_TxBatchData in one section
+ *   before it is handed to the PduR, so the PduR and its lower layers see
+ *   the current values of one pack, whatever an ISR packs meanwhile
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Timer-wheel deadline monitoring    |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Com_MainFunctionTx(), TX modes     |
+ * | 1.2.1   | 2026-10-16 | BSW Team        | RX deadlines by counter scan       |
+ *
+ * @see com_stack.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "com_stack.h"
+#include "pdu_router.h"
+#include "timer_manager.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define COM_STACK_C_VENDOR_ID                   43U
+#define COM_STACK_C_SW_MAJOR_VERSION            1U
+#define COM_STACK_C_SW_MINOR_VERSION            2U
+#define COM_STACK_C_SW_PATCH_VERSION            1U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (COM_STACK_C_VENDOR_ID != COM_VENDOR_ID)
+    #error "com_stack.c and com_stack.h have different vendor IDs"
+#endif
+
+#if ((COM_STACK_C_SW_MAJOR_VERSION != COM_SW_MAJOR_VERSION) || \
+     (COM_STACK_C_SW_MINOR_VERSION != COM_SW_MINOR_VERSION) || \
+     (COM_STACK_C_SW_PATCH_VERSION != COM_SW_PATCH_VERSION))
+    #error "Software version mismatch between com_stack.c and com_stack.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (COM_DEV_ERROR_DETECT == STD_ON)
+    #define COM_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(COM_MODULE_ID, COM_INSTANCE_ID, (api), (err)))
+#else
+    #define COM_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+#ifndef COM_ENTER_CRITICAL
+    #define COM_ENTER_CRITICAL(key)             ((key) = Os_Port_DisableInterrupts())
+    #define COM_EXIT_CRITICAL(key)              Os_Port_RestoreInterrupts(key)
+#endif
+
+/** @brief Signals of a transmitted I-PDU changed since it was last packed */
+#define COM_IPDU_TX_DIRTY                       0x01U
+
+/** @brief A DEFERRED I-PDU was received and is not unpacked yet */
+#define COM_IPDU_RX_PENDING                     0x02U
+
+/** @brief The reception deadline of an I-PDU was missed */
+#define COM_IPDU_RX_TIMEOUT                     0x04U
+
+/** @brief A transmission of an I-PDU is requested and queued in Com_TxQueue */
+#define COM_IPDU_TX_REQUEST                     0x08U
+
+/** @brief A DEFERRED I-PDU is queued in Com_RxQueue */
+#define COM_IPDU_RX_QUEUED                      0x10U
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE between Com_Init() and Com_DeInit() */
+STATIC boolean Com_Initialized = FALSE;
+
+/** @brief COM_IPDU_* flags of every I-PDU */
+STATIC volatile uint8 Com_IPduState[COM_IPDU_COUNT];
+
+/** @brief Com_MainFunctionRx() calls since Com_Init() */
+STATIC volatile uint32 Com_RxCycle;
+
+/** @brief Com_RxCycle in which the reception deadline of every I-PDU expires; monitored RECEIVE I-PDUs only */
+STATIC volatile uint32 Com_RxDeadline[COM_IPDU_COUNT];
+
+/** @brief Monitored RECEIVE I-PDUs, scanned by Com_MainFunctionRx() */
+STATIC PduIdType Com_RxMonitored[COM_IPDU_COUNT];
+
+/** @brief Entries of Com_RxMonitored */
+STATIC uint16 Com_RxMonitoredCount;
+
+/** @brief DEFERRED I-PDUs with COM_IPDU_RX_QUEUED, each at most once */
+STATIC PduIdType Com_RxQueue[COM_IPDU_COUNT];
+
+/** @brief Entries of Com_RxQueue */
+STATIC volatile uint16 Com_RxQueueCount;
+
+/** @brief Transmission periods; one tick per Com_MainFunctionTx() */
+STATIC TimerMgr_WheelType Com_TxWheel;
+
+/** @brief Period timer of every I-PDU, drained; armed for periodic and mixed I-PDUs only */
+STATIC TimerMgr_TimerType Com_TxPeriodTimer[COM_IPDU_COUNT];
+
+/** @brief Com_TxWheel time of the last transmission of every I-PDU */
+STATIC TimerMgr_TickType Com_TxLast[COM_IPDU_COUNT];
+
+/** @brief I-PDUs with COM_IPDU_TX_REQUEST, each at most once */
+STATIC PduIdType Com_TxQueue[COM_IPDU_COUNT];
+
+/** @brief Entries of Com_TxQueue */
+STATIC volatile uint16 Com_TxQueueCount;
+
+/** @brief PduR source handles of the I-PDUs transmitted in a Com_MainFunctionTx() */
+STATIC PduIdType Com_TxBatchId[COM_IPDU_COUNT];
+
+/** @brief Payloads of the I-PDUs transmitted in a Com_MainFunctionTx(), pointing into Com_TxBatchData */
+STATIC PduInfoType Com_TxBatchInfo[COM_IPDU_COUNT];
+
+/** @brief Snapshot of the packed I-PDU buffers handed to the PduR, each SEND I-PDU at most once */
+STATIC uint8 Com_TxBatchData[COM_TX_BATCH_DATA_SIZE];
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Com_RxDeadlineMissed(PduIdType RxPduId);
+STATIC void Com_TxRequest(PduIdType TxPduId);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Handle an expired deadline: ComRxDataTimeoutAction, COM_IPDU_RX_TIMEOUT
+ */
+STATIC void Com_RxDeadlineMissed(PduIdType RxPduId)
+{
+    P2CONST(Com_IPduConfigType, AUTOMATIC, COM_CONST) ipdu = &Com_IPdu[RxPduId];
+    uint32 key;
+
+    COM_ENTER_CRITICAL(key);
+    if (Com_RxDeadline[RxPduId] == Com_RxCycle)
+    {
+        if (ipdu->timeout_action == (uint8)COM_TIMEOUT_REPLACE)
+        {
+            (void)memcpy(ipdu->shadow, ipdu->shadow_init, ipdu->shadow_size);
+            Com_IPduState[RxPduId] &= (uint8)~COM_IPDU_RX_PENDING;
+        }
+        Com_IPduState[RxPduId] |= COM_IPDU_RX_TIMEOUT;
+    }
+    COM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Request a transmission of an I-PDU (caller holds the COM section)
+ */
+STATIC void Com_TxRequest(PduIdType TxPduId)
+{
+    if ((Com_IPduState[TxPduId] & COM_IPDU_TX_REQUEST) == 0U)
+    {
+        Com_IPduState[TxPduId] |= COM_IPDU_TX_REQUEST;
+        Com_TxQueue[Com_TxQueueCount] = TxPduId;
+        Com_TxQueueCount++;
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize COM: all signals to their init values, all PDUs packed
+ */
+void Com_Init(void)
+{
+    PduIdType id;
+
+    TimerMgr_Init(&Com_TxWheel, 0U);
+    Com_RxCycle = 0UL;
+    Com_RxMonitoredCount = 0U;
+    Com_RxQueueCount = 0U;
+    Com_TxQueueCount = 0U;
+
+    for (id = 0U; id < COM_IPDU_COUNT; id++)
+    {
+        P2CONST(Com_IPduConfigType, AUTOMATIC, COM_CONST) ipdu = &Com_IPdu[id];
+
+        (void)memcpy(ipdu->shadow, ipdu->shadow_init, ipdu->shadow_size);
+        if (ipdu->direction == (uint8)COM_SEND)
+        {
+            (void)memset(ipdu->data, (sint32)ipdu->unused_default, ipdu->length);
+            ipdu->pack();
+        }
+        else
+        {
+            (void)memset(ipdu->data, 0, ipdu->length);
+        }
+        Com_IPduState[id] = 0U;
+
+        /* Deadline in the Com_MainFunctionRx() call first_timeout - 1 */
+        Com_RxDeadline[id] = 0UL;
+        if (ipdu->timeout != 0U)
+        {
+            Com_RxDeadline[id] = (uint32)ipdu->first_timeout;
+            Com_RxMonitored[Com_RxMonitoredCount] = id;
+            Com_RxMonitoredCount++;
+        }
+
+        /* Period timer due in the Com_MainFunctionTx() call tx_offset (0: the first) */
+        TimerMgr_InitTimer(&Com_TxPeriodTimer[id], NULL_PTR, NULL_PTR);
+        if (ipdu->tx_period != 0U)
+        {
+            (void)TimerMgr_Start(&Com_TxWheel, &Com_TxPeriodTimer[id],
+                                 (TimerMgr_TickType)ipdu->tx_offset + 1UL, (TimerMgr_TickType)ipdu->tx_period);
+        }
+        Com_TxLast[id] = (TimerMgr_TickType)0UL - (TimerMgr_TickType)ipdu->tx_mdt;
+    }
+
+    Com_Initialized = TRUE;
+}
+
+/**
+ * @brief Stop COM
+ */
+void Com_DeInit(void)
+{
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_DEINIT_API_ID, COM_E_UNINIT);
+        return;
+    }
+
+    Com_Initialized = FALSE;
+}
+
+/**
+ * @brief Update a signal of a transmitted I-PDU
+ */
+Std_ReturnType Com_SendSignal(Com_SignalIdType SignalId,
+    P2CONST(void, AUTOMATIC, COM_APPL_DATA) SignalDataPtr)
+{
+    P2CONST(Com_SignalConfigType, AUTOMATIC, COM_CONST) signal;
+    uint8 mode;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_SEND_SIGNAL_API_ID, COM_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if ((SignalId >= COM_SIGNAL_COUNT) ||
+        (Com_IPdu[Com_Signal[SignalId].ipdu].direction != (uint8)COM_SEND))
+    {
+        COM_REPORT_ERROR(COM_SEND_SIGNAL_API_ID, COM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if (SignalDataPtr == NULL_PTR)
+    {
+        COM_REPORT_ERROR(COM_SEND_SIGNAL_API_ID, COM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    signal = &Com_Signal[SignalId];
+    mode = Com_IPdu[signal->ipdu].tx_mode;
+    COM_ENTER_CRITICAL(key);
+    if (((mode == (uint8)COM_TX_DIRECT) || (mode == (uint8)COM_TX_MIXED)) &&
+        ((signal->transfer == (uint8)COM_TRIGGERED) ||
+         ((signal->transfer == (uint8)COM_TRIGGERED_ON_CHANGE) &&
+          (memcmp(signal->value, SignalDataPtr, signal->size) != 0))))
+    {
+        Com_TxRequest(signal->ipdu);
+    }
+    (void)memcpy(signal->value, SignalDataPtr, signal->size);
+    Com_IPduState[signal->ipdu] |= COM_IPDU_TX_DIRTY;
+    COM_EXIT_CRITICAL(key);
+
+    return E_OK;
+}
+
+/**
+ * @brief Read the last value of a signal
+ */
+Std_ReturnType Com_ReceiveSignal(Com_SignalIdType SignalId,
+    P2VAR(void, AUTOMATIC, COM_APPL_DATA) SignalDataPtr)
+{
+    P2CONST(Com_SignalConfigType, AUTOMATIC, COM_CONST) signal;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_RECEIVE_SIGNAL_API_ID, COM_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (SignalId >= COM_SIGNAL_COUNT)
+    {
+        COM_REPORT_ERROR(COM_RECEIVE_SIGNAL_API_ID, COM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if (SignalDataPtr == NULL_PTR)
+    {
+        COM_REPORT_ERROR(COM_RECEIVE_SIGNAL_API_ID, COM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    signal = &Com_Signal[SignalId];
+    COM_ENTER_CRITICAL(key);
+    (void)memcpy(SignalDataPtr, signal->value, signal->size);
+    COM_EXIT_CRITICAL(key);
+
+    return E_OK;
+}
+
+/**
+ * @brief Indication of a received I-PDU by the lower layer
+ */
+void Com_RxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, COM_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(Com_IPduConfigType, AUTOMATIC, COM_CONST) ipdu;
+    PduLengthType length;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_RX_INDICATION_API_ID, COM_E_UNINIT);
+        return;
+    }
+    if ((RxPduId >= COM_IPDU_COUNT) || (Com_IPdu[RxPduId].direction != (uint8)COM_RECEIVE))
+    {
+        COM_REPORT_ERROR(COM_RX_INDICATION_API_ID, COM_E_PARAM);
+        return;
+    }
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR))
+    {
+        COM_REPORT_ERROR(COM_RX_INDICATION_API_ID, COM_E_PARAM_POINTER);
+        return;
+    }
+
+    ipdu = &Com_IPdu[RxPduId];
+    length = (PduInfoPtr->SduLength < ipdu->length) ? PduInfoPtr->SduLength : ipdu->length;
+
+    COM_ENTER_CRITICAL(key);
+    (void)memcpy(ipdu->data, PduInfoPtr->SduDataPtr, length);
+    if (ipdu->processing == (uint8)COM_IMMEDIATE)
+    {
+        ipdu->unpack();
+    }
+    else
+    {
+        Com_IPduState[RxPduId] |= COM_IPDU_RX_PENDING;
+        if ((Com_IPduState[RxPduId] & COM_IPDU_RX_QUEUED) == 0U)
+        {
+            Com_IPduState[RxPduId] |= COM_IPDU_RX_QUEUED;
+            Com_RxQueue[Com_RxQueueCount] = RxPduId;
+            Com_RxQueueCount++;
+        }
+    }
+    if (ipdu->timeout != 0U)
+    {
+        Com_IPduState[RxPduId] &= (uint8)~COM_IPDU_RX_TIMEOUT;
+        Com_RxDeadline[RxPduId] = Com_RxCycle + (uint32)ipdu->timeout;
+    }
+    COM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Copy the current content of a transmitted I-PDU
+ */
+Std_ReturnType Com_TriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, COM_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(Com_IPduConfigType, AUTOMATIC, COM_CONST) ipdu;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_TRIGGER_TRANSMIT_API_ID, COM_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if ((TxPduId >= COM_IPDU_COUNT) || (Com_IPdu[TxPduId].direction != (uint8)COM_SEND))
+    {
+        COM_REPORT_ERROR(COM_TRIGGER_TRANSMIT_API_ID, COM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR))
+    {
+        COM_REPORT_ERROR(COM_TRIGGER_TRANSMIT_API_ID, COM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ipdu = &Com_IPdu[TxPduId];
+    if (PduInfoPtr->SduLength < ipdu->length)
+    {
+        return E_NOT_OK;
+    }
+
+    COM_ENTER_CRITICAL(key);
+    if ((Com_IPduState[TxPduId] & COM_IPDU_TX_DIRTY) != 0U)
+    {
+        Com_IPduState[TxPduId] &= (uint8)~COM_IPDU_TX_DIRTY;
+        ipdu->pack();
+    }
+    (void)memcpy(PduInfoPtr->SduDataPtr, ipdu->data, ipdu->length);
+    COM_EXIT_CRITICAL(key);
+
+    PduInfoPtr->SduLength = ipdu->length;
+    return E_OK;
+}
+
+/**
+ * @brief Reception deadline state of an I-PDU
+ */
+Std_ReturnType Com_GetRxDeadlineStatus(PduIdType RxPduId,
+    P2VAR(boolean, AUTOMATIC, COM_APPL_DATA) TimedOutPtr)
+{
+    if (Com_Initialized == FALSE)
+    {
+        COM_REPORT_ERROR(COM_GET_RX_DEADLINE_STATUS_API_ID, COM_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if ((RxPduId >= COM_IPDU_COUNT) || (Com_IPdu[RxPduId].direction != (uint8)COM_RECEIVE))
+    {
+        COM_REPORT_ERROR(COM_GET_RX_DEADLINE_STATUS_API_ID, COM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if (TimedOutPtr == NULL_PTR)
+    {
+        COM_REPORT_ERROR(COM_GET_RX_DEADLINE_STATUS_API_ID, COM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    *TimedOutPtr = ((Com_IPduState[RxPduId] & COM_IPDU_RX_TIMEOUT) != 0U) ? TRUE : FALSE;
+    return E_OK;
+}
+
+/**
+ * @brief Handle the missed reception deadlines, then unpack the DEFERRED
+ *        I-PDUs received since the last call
+ */
+void Com_MainFunctionRx(void)
+{
+    uint32 cycle;
+    uint32 i;
+    PduIdType id;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        return;
+    }
+
+    /* A reception in cycle c sets the deadline c + timeout: missed in the call timeout - 1 later */
+    cycle = Com_RxCycle + 1UL;
+    Com_RxCycle = cycle;
+    for (i = 0U; i < Com_RxMonitoredCount; i++)
+    {
+        id = Com_RxMonitored[i];
+        if (Com_RxDeadline[id] == cycle)
+        {
+            Com_RxDeadlineMissed(id);
+        }
+    }
+
+    /* I-PDUs queued by a reception during the drain are appended and drained too */
+    COM_ENTER_CRITICAL(key);
+    for (i = 0U; i < Com_RxQueueCount; i++)
+    {
+        id = Com_RxQueue[i];
+        Com_IPduState[id] &= (uint8)~COM_IPDU_RX_QUEUED;
+        if ((Com_IPduState[id] & COM_IPDU_RX_PENDING) != 0U)
+        {
+            Com_IPduState[id] &= (uint8)~COM_IPDU_RX_PENDING;
+            Com_IPdu[id].unpack();
+        }
+        COM_EXIT_CRITICAL(key);         /* Interrupt latency of one unpack at most */
+        COM_ENTER_CRITICAL(key);
+    }
+    Com_RxQueueCount = 0U;
+    COM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Transmit the I-PDUs due in this cycle in one PduR_ComTransmitBatch() call
+ */
+void Com_MainFunctionTx(void)
+{
+    P2VAR(TimerMgr_TimerType, AUTOMATIC, COM_VAR) expired[COM_TX_PERIOD_BATCH];
+    TimerMgr_TickType now;
+    uint32 count;
+    uint32 i;
+    uint16 kept = 0U;
+    uint16 due = 0U;
+    uint16 offset = 0U;
+    PduIdType id;
+    uint32 key;
+
+    if (Com_Initialized == FALSE)
+    {
+        return;
+    }
+
+    if (TimerMgr_Tick(&Com_TxWheel) != 0U)
+    {
+        do
+        {
+            count = TimerMgr_DrainExpired(&Com_TxWheel, expired, COM_TX_PERIOD_BATCH);
+            COM_ENTER_CRITICAL(key);
+            for (i = 0U; i < count; i++)
+            {
+                Com_TxRequest((PduIdType)(expired[i] - Com_TxPeriodTimer));
+            }
+            COM_EXIT_CRITICAL(key);
+        } while (count == COM_TX_PERIOD_BATCH);
+    }
+
+    now = TimerMgr_GetTime(&Com_TxWheel);
+    COM_ENTER_CRITICAL(key);
+    for (i = 0U; i < Com_TxQueueCount; i++)
+    {
+        id = Com_TxQueue[i];
+        if ((TimerMgr_TickType)(now - Com_TxLast[id]) >= (TimerMgr_TickType)Com_IPdu[id].tx_mdt)
+        {
+            Com_IPduState[id] &= (uint8)~COM_IPDU_TX_REQUEST;
+            Com_TxLast[id] = now;
+            Com_TxBatchId[due] = id;
+            due++;
+        }
+        else
+        {
+            Com_TxQueue[kept] = id;
+            kept++;
+        }
+    }
+    Com_TxQueueCount = kept;
+    COM_EXIT_CRITICAL(key);
+
+    for (i = 0U; i < due; i++)
+    {
+        P2CONST(Com_IPduConfigType, AUTOMATIC, COM_CONST) ipdu = &Com_IPdu[Com_TxBatchId[i]];
+
+        COM_ENTER_CRITICAL(key);
+        if ((Com_IPduState[Com_TxBatchId[i]] & COM_IPDU_TX_DIRTY) != 0U)
+        {
+            Com_IPduState[Com_TxBatchId[i]] &= (uint8)~COM_IPDU_TX_DIRTY;
+            ipdu->pack();
+        }
+        /* A Com_TriggerTransmit() from an ISR may repack ipdu->data once the section is left */
+        (void)memcpy(&Com_TxBatchData[offset], ipdu->data, ipdu->length);
+        COM_EXIT_CRITICAL(key);
+
+        Com_TxBatchId[i] = ipdu->pdur_pdu;
+        Com_TxBatchInfo[i].SduDataPtr = &Com_TxBatchData[offset];
+        Com_TxBatchInfo[i].MetaDataPtr = NULL_PTR;
+        Com_TxBatchInfo[i].SduLength = ipdu->length;
+        offset += ipdu->length;
+    }
+
+    if (due != 0U)
+    {
+        (void)PduR_ComTransmitBatch(Com_TxBatchId, Com_TxBatchInfo, due);
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
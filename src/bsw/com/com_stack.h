@@ -0,0 +1,445 @@
+/**
+ * @file    com_stack.h
+ * @brief   COM - Signal Gateway between the Application and the I-PDUs
+ * @version 1.2.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * AUTOSAR COM for the VCU: signals of the application are sent into and
+ * received from the I-PDUs of config/autosar/communication/com.arxml.
+ *
+ * Every I-PDU has a shadow structure holding its signals as C values and a
+ * PDU buffer holding them as bits. Com_SendSignal() and Com_ReceiveSignal()
+ * only access the shadow; the conversion between the two is done by the
+ * pack and unpack kernels generated per I-PDU by tools/com/com_generator.py:
+ *
+ * | Direction | Shadow -> PDU (pack)             | PDU -> shadow (unpack)              |
+ * |-----------|----------------------------------|-------------------------------------|
+ * | SEND      | Com_TriggerTransmit(), if dirty  | -                                   |
+ * | RECEIVE   | -                                | Com_RxIndication() (IMMEDIATE)      |
+ * |           |                                  | Com_MainFunctionRx() (DEFERRED)     |
+ *
+ * A RECEIVE I-PDU with a ComTimeout (ComRxIPdu) is deadline monitored: if
+ * it is not received for ComTimeout, or ComFirstTimeout after Com_Init(),
+ * Com_MainFunctionRx() applies its ComRxDataTimeoutAction once and
+ * Com_GetRxDeadlineStatus() reports it timed out until the next reception.
+ * Every Com_MainFunctionRx() compares the deadline cycle of each monitored
+ * I-PDU with its cycle count; a reception only stores a new deadline cycle.
+ *
+ * A SEND I-PDU with a ComTxModeTrue/ComTxMode is transmitted by
+ * Com_MainFunctionTx():
+ *
+ * | Mode     | Transmitted                                                       |
+ * |----------|-------------------------------------------------------------------|
+ * | PERIODIC | Every ComTxModeTimePeriod, first ComTxModeTimeOffset after init   |
+ * | DIRECT   | In the next cycle after a triggering Com_SendSignal()             |
+ * | MIXED    | Both                                                              |
+ *
+ * Com_SendSignal() triggers a transmission if the ComTransferProperty of
+ * the signal is TRIGGERED, or TRIGGERED_ON_CHANGE and the value changed.
+ * No transmission starts less than ComMinimumDelayTime after the previous
+ * one; a transmission blocked by it is postponed, not dropped. The I-PDUs
+ * due in a cycle are handed to the PduR in one PduR_ComTransmitBatch()
+ * call, which groups them into one call per CAN or Ethernet controller.
+ * The generator spreads the offsets of the periodic I-PDUs over the
+ * cycles of their period, so the periodic load does not come in bursts.
+ *
+ * A kernel handles a PDU in aligned 32-bit words: one load, the shifts and
+ * masks of all signal parts in the word, one store. A signal crossing a
+ * word boundary is split into one part per word. Motorola (BIG_ENDIAN)
+ * words are byte-swapped with REV (com_pack.h), so both byte orders cost
+ * the same. Bit positions, sizes and byte orders are constants of the
+ * kernels; there is no signal table at runtime.
+ *
+ * Implementation Notes:
+ * - The configuration is pre-compile (com_cfg.h / com_cfg.c); Com_Init()
+ *   takes no configuration pointer
+ * - PDU buffers are 8-byte aligned and padded to a multiple of 8 bytes, so
+ *   a word access may run past the PDU length without leaving the buffer.
+ *   Bytes beyond the length are never transmitted
+ * - Signal values are the C types of ComSignalType; a value wider than its
+ *   ComBitSize is truncated to the low bits when packed, signed signals
+ *   are sign-extended when unpacked
+ * - Shadows and PDU buffers are accessed under COM_ENTER_CRITICAL(), so
+ *   a signal group of one PDU is always packed and unpacked consistently
+ *
+ * Safety Classification: QM (E2E protection of the safety signals is added
+ * on top of COM)
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Generated pack/unpack kernels      |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | RX deadline monitoring             |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | TX modes, batched transmission     |
+ * | 1.2.1   | 2026-10-16 | BSW Team        | RX deadlines by counter scan       |
+ *
+ * @see com_stack.c
+ * @see com_pack.h
+ * @see com_cfg.h
+ */
+
+#ifndef COM_STACK_H
+#define COM_STACK_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define COM_VENDOR_ID                           43U
+#define COM_MODULE_ID                           50U     /**< AUTOSAR COM */
+#define COM_INSTANCE_ID                         0U
+
+#define COM_SW_MAJOR_VERSION                    1U
+#define COM_SW_MINOR_VERSION                    2U
+#define COM_SW_PATCH_VERSION                    1U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (COM_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "com_stack.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define COM_INIT_API_ID                         0x01U
+#define COM_DEINIT_API_ID                       0x02U
+#define COM_SEND_SIGNAL_API_ID                  0x0AU
+#define COM_RECEIVE_SIGNAL_API_ID               0x0BU
+#define COM_MAIN_FUNCTION_RX_API_ID             0x18U
+#define COM_MAIN_FUNCTION_TX_API_ID             0x19U
+#define COM_TRIGGER_TRANSMIT_API_ID             0x41U
+#define COM_RX_INDICATION_API_ID                0x42U
+#define COM_GET_RX_DEADLINE_STATUS_API_ID       0x80U   /**< Vendor-specific */
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define COM_E_PARAM                             0x01U   /**< Invalid handle or direction */
+#define COM_E_UNINIT                            0x02U   /**< Com_Init() not called */
+#define COM_E_PARAM_POINTER                     0x03U   /**< NULL pointer parameter */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def COM_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef COM_DEV_ERROR_DETECT
+    #define COM_DEV_ERROR_DETECT                STD_ON
+#endif
+
+/**
+ * @def COM_SIGNAL_LAYOUT_TABLE
+ * @brief STD_ON: com_cfg.c also provides the bit layout of every signal
+ *        (Com_SignalLayout), for tools and benchmarks; not used by COM itself
+ */
+#ifndef COM_SIGNAL_LAYOUT_TABLE
+    #define COM_SIGNAL_LAYOUT_TABLE             STD_OFF
+#endif
+
+/* Configuration validation */
+#if (COM_DEV_ERROR_DETECT != STD_ON) && (COM_DEV_ERROR_DETECT != STD_OFF)
+    #error "COM_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (COM_SIGNAL_LAYOUT_TABLE != STD_ON) && (COM_SIGNAL_LAYOUT_TABLE != STD_OFF)
+    #error "COM_SIGNAL_LAYOUT_TABLE must be STD_ON or STD_OFF"
+#endif
+
+/**
+ * @def COM_TX_PERIOD_BATCH
+ * @brief Expired period timers drained from the wheel at once in
+ *        Com_MainFunctionTx() (stack array); larger batches are drained
+ *        in several steps
+ */
+#ifndef COM_TX_PERIOD_BATCH
+    #define COM_TX_PERIOD_BATCH                 8U
+#endif
+
+#if (COM_TX_PERIOD_BATCH < 1U)
+    #error "COM_TX_PERIOD_BATCH must be at least 1"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @typedef Com_SignalIdType
+ * @brief Handle of a signal (ComConf_ComSignal_*)
+ */
+typedef uint16 Com_SignalIdType;
+
+/**
+ * @enum Com_IPduDirectionType
+ * @brief Direction of an I-PDU (ComIPduDirection)
+ */
+typedef enum
+{
+    COM_RECEIVE = 0x00U,                /**< Received; signals unpacked */
+    COM_SEND = 0x01U                    /**< Transmitted; signals packed */
+} Com_IPduDirectionType;
+
+/**
+ * @enum Com_SignalProcessingType
+ * @brief When a received I-PDU is unpacked (ComIPduSignalProcessing)
+ */
+typedef enum
+{
+    COM_IMMEDIATE = 0x00U,              /**< In Com_RxIndication() */
+    COM_DEFERRED = 0x01U                /**< In the next Com_MainFunctionRx() */
+} Com_SignalProcessingType;
+
+/**
+ * @enum Com_RxDataTimeoutActionType
+ * @brief Signal values after a reception deadline is missed (ComRxDataTimeoutAction)
+ */
+typedef enum
+{
+    COM_TIMEOUT_NONE = 0x00U,           /**< Keep the last received values */
+    COM_TIMEOUT_REPLACE = 0x01U         /**< Replace them with the init values */
+} Com_RxDataTimeoutActionType;
+
+/**
+ * @enum Com_TxModeType
+ * @brief Transmission mode of a SEND I-PDU (ComTxModeMode)
+ */
+typedef enum
+{
+    COM_TX_NONE = 0x00U,                /**< Not sent by COM; the lower layer fetches it */
+    COM_TX_PERIODIC = 0x01U,            /**< Every ComTxModeTimePeriod */
+    COM_TX_DIRECT = 0x02U,              /**< On a triggering Com_SendSignal() */
+    COM_TX_MIXED = 0x03U                /**< Periodic and direct */
+} Com_TxModeType;
+
+/**
+ * @enum Com_TransferPropertyType
+ * @brief Effect of Com_SendSignal() on a DIRECT or MIXED I-PDU (ComTransferProperty)
+ */
+typedef enum
+{
+    COM_PENDING = 0x00U,                /**< None; sent with the next transmission */
+    COM_TRIGGERED = 0x01U,              /**< Triggers a transmission */
+    COM_TRIGGERED_ON_CHANGE = 0x02U     /**< Triggers a transmission if the value changed */
+} Com_TransferPropertyType;
+
+/** @brief Com_IPduConfigType::pdur_pdu of an I-PDU without transmission mode */
+#define COM_NO_PDUR_PDU                         ((PduIdType)0xFFFFU)
+
+/**
+ * @typedef Com_KernelType
+ * @brief Generated pack or unpack kernel of one I-PDU (shadow <-> PDU buffer)
+ */
+typedef void (*Com_KernelType)(void);
+
+/**
+ * @struct Com_IPduConfigType
+ * @brief Static configuration of one I-PDU (generated)
+ */
+typedef struct
+{
+    P2VAR(uint8, TYPEDEF, COM_VAR) data;                /**< PDU buffer, padded to 8 bytes */
+    P2VAR(void, TYPEDEF, COM_VAR) shadow;               /**< Signal values */
+    P2CONST(void, TYPEDEF, COM_CONST) shadow_init;      /**< ComSignalInitValue of the signals */
+    Com_KernelType pack;                                /**< Shadow -> PDU buffer, NULL_PTR if RECEIVE */
+    Com_KernelType unpack;                              /**< PDU buffer -> shadow, NULL_PTR if SEND */
+    uint16 shadow_size;                                 /**< sizeof the shadow in bytes */
+    PduLengthType length;                               /**< PduLength */
+    uint8 direction;                                    /**< Com_IPduDirectionType */
+    uint8 processing;                                   /**< Com_SignalProcessingType */
+    uint8 unused_default;                               /**< Byte value of bits without a signal */
+    uint8 timeout_action;                               /**< Com_RxDataTimeoutActionType */
+    uint16 timeout;                                     /**< ComTimeout in Com_MainFunctionRx() cycles, 0: not monitored */
+    uint16 first_timeout;                               /**< ComFirstTimeout: deadline after Com_Init() */
+    uint8 tx_mode;                                      /**< Com_TxModeType */
+    uint16 tx_period;                                   /**< ComTxModeTimePeriod in Com_MainFunctionTx() cycles, 0: not periodic */
+    uint16 tx_offset;                                   /**< ComTxModeTimeOffset: first periodic cycle after Com_Init() */
+    uint16 tx_mdt;                                      /**< ComMinimumDelayTime in Com_MainFunctionTx() cycles */
+    PduIdType pdur_pdu;                                 /**< PduR source handle, COM_NO_PDUR_PDU if COM_TX_NONE */
+} Com_IPduConfigType;
+
+/**
+ * @struct Com_SignalConfigType
+ * @brief Static configuration of one signal (generated)
+ */
+typedef struct
+{
+    P2VAR(void, TYPEDEF, COM_VAR) value;                /**< Value in the shadow of its I-PDU */
+    PduIdType ipdu;                                     /**< I-PDU of the signal */
+    uint8 size;                                         /**< sizeof the value in bytes */
+    uint8 transfer;                                     /**< Com_TransferPropertyType */
+} Com_SignalConfigType;
+
+#if (COM_SIGNAL_LAYOUT_TABLE == STD_ON)
+/**
+ * @struct Com_SignalLayoutType
+ * @brief Bit layout of one signal in its PDU (generated, COM_SIGNAL_LAYOUT_TABLE)
+ */
+typedef struct
+{
+    uint16 bit_position;                /**< ComBitPosition: LSB, bit i of byte b = 8 * b + i */
+    uint8 bit_size;                     /**< ComBitSize */
+    uint8 big_endian;                   /**< TRUE: Motorola, FALSE: Intel */
+    uint8 is_signed;                    /**< TRUE: SINT* signal */
+} Com_SignalLayoutType;
+#endif
+
+#include "com_cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief I-PDU configuration, indexed by ComConf_ComIPdu_* */
+extern const Com_IPduConfigType Com_IPdu[COM_IPDU_COUNT];
+
+/** @brief Signal configuration, indexed by ComConf_ComSignal_* */
+extern const Com_SignalConfigType Com_Signal[COM_SIGNAL_COUNT];
+
+#if (COM_SIGNAL_LAYOUT_TABLE == STD_ON)
+/** @brief Bit layout of the signals, indexed by ComConf_ComSignal_* */
+extern const Com_SignalLayoutType Com_SignalLayout[COM_SIGNAL_COUNT];
+#endif
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize COM: all signals to their init values, all PDUs packed
+ *
+ * Bits of transmitted PDUs without a signal are set to
+ * ComTxIPduUnusedAreasDefault.
+ *
+ * @serviceID COM_INIT_API_ID (0x01)
+ * @reentrancy Non-Reentrant
+ */
+extern void Com_Init(void);
+
+/**
+ * @brief Stop COM; all services except Com_Init() are rejected afterwards
+ *
+ * @serviceID COM_DEINIT_API_ID (0x02)
+ * @reentrancy Non-Reentrant
+ */
+extern void Com_DeInit(void);
+
+/**
+ * @brief Update a signal of a transmitted I-PDU
+ * @details Requests a transmission of a DIRECT or MIXED I-PDU if the signal
+ *          is TRIGGERED, or TRIGGERED_ON_CHANGE and the value differs.
+ * @param[in] SignalId      Signal to update (ComConf_ComSignal_*)
+ * @param[in] SignalDataPtr New value, of the C type of the signal
+ * @return E_OK, or E_NOT_OK if COM is not initialized or on invalid parameters
+ *
+ * @serviceID COM_SEND_SIGNAL_API_ID (0x0A)
+ * @reentrancy Reentrant for different signals
+ */
+extern Std_ReturnType Com_SendSignal(Com_SignalIdType SignalId,
+    P2CONST(void, AUTOMATIC, COM_APPL_DATA) SignalDataPtr);
+
+/**
+ * @brief Read the last value of a signal
+ * @param[in]  SignalId      Signal to read (ComConf_ComSignal_*)
+ * @param[out] SignalDataPtr Receives the value, of the C type of the signal
+ * @return E_OK, or E_NOT_OK if COM is not initialized or on invalid parameters
+ *
+ * @serviceID COM_RECEIVE_SIGNAL_API_ID (0x0B)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Com_ReceiveSignal(Com_SignalIdType SignalId,
+    P2VAR(void, AUTOMATIC, COM_APPL_DATA) SignalDataPtr);
+
+/**
+ * @brief Indication of a received I-PDU by the lower layer
+ * @param[in] RxPduId    Received I-PDU (ComConf_ComIPdu_*)
+ * @param[in] PduInfoPtr Payload; a shorter payload updates only the bytes received
+ *
+ * @serviceID COM_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Reentrant for different I-PDUs
+ */
+extern void Com_RxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, COM_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Copy the current content of a transmitted I-PDU
+ * @param[in]    TxPduId    I-PDU to copy (ComConf_ComIPdu_*)
+ * @param[inout] PduInfoPtr SduDataPtr: destination; SduLength: in the
+ *                          capacity, out the PDU length
+ * @return E_OK, or E_NOT_OK if the destination is too small or on invalid parameters
+ *
+ * @serviceID COM_TRIGGER_TRANSMIT_API_ID (0x41)
+ * @reentrancy Reentrant for different I-PDUs
+ */
+extern Std_ReturnType Com_TriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, COM_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Reception deadline state of an I-PDU
+ * @param[in]  RxPduId     Received I-PDU (ComConf_ComIPdu_*)
+ * @param[out] TimedOutPtr TRUE if its deadline was missed and it has not been
+ *                         received since; always FALSE if it is not monitored
+ * @return E_OK, or E_NOT_OK if COM is not initialized or on invalid parameters
+ *
+ * @serviceID COM_GET_RX_DEADLINE_STATUS_API_ID (0x80)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Com_GetRxDeadlineStatus(PduIdType RxPduId,
+    P2VAR(boolean, AUTOMATIC, COM_APPL_DATA) TimedOutPtr);
+
+/**
+ * @brief Handle the missed reception deadlines, then unpack the DEFERRED
+ *        I-PDUs received since the last call
+ * @note Clock of the deadlines: call every ComMainFunctionPeriod
+ *       (COM_MAIN_FUNCTION_RX_PERIOD_US)
+ *
+ * @serviceID COM_MAIN_FUNCTION_RX_API_ID (0x18)
+ * @reentrancy Non-Reentrant
+ */
+extern void Com_MainFunctionRx(void);
+
+/**
+ * @brief Transmit the I-PDUs due in this cycle: periodic ones whose period
+ *        elapsed and triggered ones whose minimum delay time elapsed, in
+ *        one PduR_ComTransmitBatch() call
+ * @note Clock of the periods and delays: call every ComMainFunctionPeriod
+ *       (COM_MAIN_FUNCTION_TX_PERIOD_US)
+ *
+ * @serviceID COM_MAIN_FUNCTION_TX_API_ID (0x19)
+ * @reentrancy Non-Reentrant
+ */
+extern void Com_MainFunctionTx(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COM_STACK_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
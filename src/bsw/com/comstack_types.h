@@ -0,0 +1,99 @@
+/**
+ * @file    comstack_types.h
+ * @brief   Communication Stack - Common PDU Types
+ * @version 1.1.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Types shared by the modules of the communication stack (COM, PduR and the
+ * transport layers), following AUTOSAR ComStack_Types: PDU handles, PDU
+ * lengths, the PDU descriptor passed between the layers and the buffer
+ * handshake of the transport protocols.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Transport protocol types           |
+ *
+ * @see com_stack.h
+ */
+
+#ifndef COMSTACK_TYPES_H
+#define COMSTACK_TYPES_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                       TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @typedef PduIdType
+ * @brief Handle of a PDU, unique per module and direction
+ */
+typedef uint16 PduIdType;
+
+/**
+ * @typedef PduLengthType
+ * @brief Length of a PDU in bytes
+ */
+typedef uint16 PduLengthType;
+
+/**
+ * @struct PduInfoType
+ * @brief Payload of a PDU passed between the layers
+ */
+typedef struct
+{
+    P2VAR(uint8, TYPEDEF, AUTOMATIC) SduDataPtr;        /**< Payload */
+    P2VAR(uint8, TYPEDEF, AUTOMATIC) MetaDataPtr;       /**< Meta data (e.g. CAN ID), NULL_PTR if none */
+    PduLengthType SduLength;                            /**< Payload length in bytes */
+} PduInfoType;
+
+/**
+ * @enum BufReq_ReturnType
+ * @brief Result of a buffer request of a transport protocol
+ */
+typedef enum
+{
+    BUFREQ_OK = 0x00U,                  /**< Data copied, buffer available */
+    BUFREQ_E_NOT_OK = 0x01U,            /**< Request failed, connection aborted */
+    BUFREQ_E_BUSY = 0x02U,              /**< Temporarily no data or space, retry later */
+    BUFREQ_E_OVFL = 0x03U               /**< Requested length exceeds the buffer */
+} BufReq_ReturnType;
+
+/**
+ * @enum TpDataStateType
+ * @brief Handling of the data copied by the previous CopyTxData call
+ */
+typedef enum
+{
+    TP_DATACONF = 0x00U,                /**< Confirmed, may be released */
+    TP_DATARETRY = 0x01U,               /**< Copy again from TxTpDataCnt bytes back */
+    TP_CONFPENDING = 0x02U              /**< Not yet confirmed, keep */
+} TpDataStateType;
+
+/**
+ * @struct RetryInfoType
+ * @brief Retry request of a transport protocol in CopyTxData
+ */
+typedef struct
+{
+    TpDataStateType TpDataState;                        /**< Handling of the previous data */
+    PduLengthType TxTpDataCnt;                          /**< Bytes to copy again (TP_DATARETRY) */
+} RetryInfoType;
+
+#endif /* COMSTACK_TYPES_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,812 @@
+/**
+ * @file    eth_tp.c
+ * @brief   EthTp - UDP/IPv4 Socket Adapter with Batched Datagrams
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Services of eth_tp.h. Every socket connection owns at most one open
+ * transmit buffer, a 1536-byte PduPool block in which its datagram is
+ * built; the other blocks EthTp holds are attached to a descriptor of the
+ * DMA transmit ring:
+ *
+ * | Buffer state | Enters                              | Leaves                            |
+ * |--------------|-------------------------------------|-----------------------------------|
+ * | Pool         | PduPool_Init(), reclaim             | First PDU of a socket connection  |
+ * | Open         | First PDU of a socket connection    | Flush                             |
+ * | DMA          | Flush: descriptor OWN, tail pointer | Reclaim: DMA has cleared OWN,     |
+ * |              |                                     | PduPool_Release()                 |
+ *
+ * Descriptors are used and reclaimed in ring order, so the ring is a FIFO
+ * of the flushed buffers and never fills up: EthTp holds at most as many
+ * blocks (open and in the DMA) as the ring has descriptors.
+ *
+ * Checksums (RFC 1071 one's-complement sums):
+ * - IPv4 header: the sum of the constant fields is computed in EthTp_Init();
+ *   a flush adds the total length and writes the complement
+ * - UDP: the sum of the pseudo header addresses, protocol and ports is
+ *   computed in EthTp_Init(); every appended PDU adds the sum of its PDU
+ *   header and payload, byte-swapped when it starts at an odd offset, and a
+ *   flush adds the UDP length twice (pseudo header and UDP header)
+ *
+ * Implementation Notes:
+ * - Frames shorter than the Ethernet minimum are padded with zeros to 60
+ *   bytes; the IPv4 total length excludes the padding
+ * - PduR_SoAdIfTriggerTransmit() is called under ETHTP_ENTER_CRITICAL(),
+ *   since it writes into the open datagram; it only copies the PDU
+ * - EthTp_IfTransmitBatch() holds the section for the whole batch: the
+ *   batch of one Com_MainFunctionTx() is bounded by PDUR_TX_BATCH_SIZE
+ * - Sent buffers are only reclaimed when no block can be taken and in
+ *   EthTp_MainFunctionTx(), not per PDU
+ * - The GMAC registers are written through ETHTP_GMAC_WRITE(), and buffer
+ *   and descriptor addresses converted by ETHTP_DMA_ADDRESS(), so a host
+ *   build can replace the DMA by a simulation
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | EthTp_IfTransmitBatch()            |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Transmit buffers from the PduPool  |
+ *
+ * @see eth_tp.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "eth_tp.h"
+#include "pdu_router.h"
+#include "pdu_pool.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define ETHTP_C_VENDOR_ID                       43U
+#define ETHTP_C_SW_MAJOR_VERSION                1U
+#define ETHTP_C_SW_MINOR_VERSION                2U
+#define ETHTP_C_SW_PATCH_VERSION                0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (ETHTP_C_VENDOR_ID != ETHTP_VENDOR_ID)
+    #error "eth_tp.c and eth_tp.h have different vendor IDs"
+#endif
+
+#if ((ETHTP_C_SW_MAJOR_VERSION != ETHTP_SW_MAJOR_VERSION) || \
+     (ETHTP_C_SW_MINOR_VERSION != ETHTP_SW_MINOR_VERSION) || \
+     (ETHTP_C_SW_PATCH_VERSION != ETHTP_SW_PATCH_VERSION))
+    #error "Software version mismatch between eth_tp.c and eth_tp.h"
+#endif
+
+#if (ETHTP_TX_BUFFER_SIZE > PDUPOOL_MAX_LENGTH)
+    #error "ETHTP_TX_BUFFER_SIZE exceeds the largest PduPool block"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (ETHTP_DEV_ERROR_DETECT == STD_ON)
+    #define ETHTP_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(ETHTP_MODULE_ID, ETHTP_INSTANCE_ID, (api), (err)))
+#else
+    #define ETHTP_REPORT_ERROR(api, err)        ((void)0)
+#endif
+
+#ifndef ETHTP_ENTER_CRITICAL
+    #define ETHTP_ENTER_CRITICAL(key)           ((key) = Os_Port_DisableInterrupts())
+    #define ETHTP_EXIT_CRITICAL(key)            Os_Port_RestoreInterrupts(key)
+#endif
+
+/** @brief Write a GMAC register */
+#ifndef ETHTP_GMAC_WRITE
+    #define ETHTP_GMAC_WRITE(offset, value) \
+        (*(volatile uint32 *)(ETHTP_GMAC_BASE_ADDR + (offset)) = (value))
+#endif
+
+/** @brief Bus address of a buffer or descriptor as seen by the DMA */
+#ifndef ETHTP_DMA_ADDRESS
+    #define ETHTP_DMA_ADDRESS(ptr)              ((uint32)(ptr))
+#endif
+
+/* GMAC DMA channel registers (Synopsys DWC Ethernet QoS) */
+#define ETHTP_DMA_CH_OFFSET                     (0x1100UL + (0x80UL * (uint32)ETHTP_DMA_CHANNEL))
+#define ETHTP_DMA_TXDESC_LIST_ADDR              (ETHTP_DMA_CH_OFFSET + 0x14UL)
+#define ETHTP_DMA_TXDESC_TAIL_PTR               (ETHTP_DMA_CH_OFFSET + 0x20UL)
+#define ETHTP_DMA_TXDESC_RING_LENGTH            (ETHTP_DMA_CH_OFFSET + 0x2CUL)
+
+/* Transmit descriptor, read format */
+#define ETHTP_TDES2_B1L_MASK                    0x00003FFFUL    /**< Buffer 1 length */
+#define ETHTP_TDES3_OWN                         0x80000000UL    /**< Owned by the DMA */
+#define ETHTP_TDES3_FD                          0x20000000UL    /**< First descriptor of the frame */
+#define ETHTP_TDES3_LD                          0x10000000UL    /**< Last descriptor of the frame */
+#define ETHTP_TDES3_FL_MASK                     0x00007FFFUL    /**< Frame length */
+
+#define ETHTP_RING_MASK                         (ETHTP_TX_RING_SIZE - 1U)
+
+/* Frame layout */
+#define ETHTP_ETH_HEADER_LENGTH                 14U     /**< MAC addresses, EtherType */
+#define ETHTP_VLAN_TAG_LENGTH                   4U
+#define ETHTP_IP_OFFSET                         18U     /**< IPv4 header behind the VLAN tag */
+#define ETHTP_IP_HEADER_LENGTH                  20U     /**< Without options */
+#define ETHTP_UDP_OFFSET                        38U
+#define ETHTP_UDP_HEADER_LENGTH                 8U
+#define ETHTP_MIN_FRAME_LENGTH                  60U     /**< Ethernet minimum without FCS */
+
+#define ETHTP_ETHERTYPE_VLAN                    0x8100U
+#define ETHTP_ETHERTYPE_IPV4                    0x0800U
+#define ETHTP_IP_VERSION_IHL                    0x45U   /**< IPv4, 5 words */
+#define ETHTP_IP_FLAGS_DF                       0x4000U /**< Don't fragment */
+#define ETHTP_IP_FRAGMENT_MASK                  0x3FFFU /**< More fragments, fragment offset */
+#define ETHTP_IP_PROTOCOL_UDP                   17U
+
+/** @brief Big-endian fields */
+#define ETHTP_GET16(p)                          ((uint16)(((uint16)(p)[0] << 8) | (uint16)(p)[1]))
+#define ETHTP_GET32(p)                          (((uint32)(p)[0] << 24) | ((uint32)(p)[1] << 16) | \
+                                                 ((uint32)(p)[2] << 8) | (uint32)(p)[3])
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct EthTp_TxDescType
+ * @brief GMAC normal transmit descriptor (read format)
+ */
+typedef struct
+{
+    volatile uint32 des0;                       /**< Buffer 1 address */
+    volatile uint32 des1;                       /**< Buffer 2 address (unused) */
+    volatile uint32 des2;                       /**< Buffer 1 length */
+    volatile uint32 des3;                       /**< OWN, FD, LD, frame length */
+} EthTp_TxDescType;
+
+/**
+ * @struct EthTp_SoConStateType
+ * @brief Datagram under construction of a socket connection
+ */
+typedef struct
+{
+    P2VAR(uint8, TYPEDEF, ETHTP_VAR) frame;     /**< Open PduPool block, or NULL_PTR */
+    uint32 sum;                                 /**< Folded UDP checksum sum of the PDUs */
+    uint16 length;                              /**< UDP payload bytes written */
+} EthTp_SoConStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after EthTp_Init() */
+STATIC boolean EthTp_Initialized = FALSE;
+
+STATIC VAR_SECTION(ETHTP_DMA_SECTION) EthTp_TxDescType EthTp_TxRing[ETHTP_TX_RING_SIZE] ALIGNED(32);
+
+/** @brief PduPool block attached to each descriptor */
+STATIC P2VAR(uint8, AUTOMATIC, ETHTP_VAR) EthTp_RingFrame[ETHTP_TX_RING_SIZE];
+
+/** @brief Oldest descriptor owned by the DMA and next descriptor to use (free running) */
+STATIC uint32 EthTp_RingHead;
+STATIC uint32 EthTp_RingTail;
+
+/** @brief PduPool blocks held (open and in the DMA), at most ETHTP_TX_RING_SIZE */
+STATIC uint8 EthTp_FrameCount;
+
+/** @brief Ethernet, IPv4 and UDP header template of each socket connection */
+STATIC uint8 EthTp_Header[ETHTP_SOCON_COUNT][ETHTP_FRAME_HEADER_LENGTH];
+
+/** @brief Folded sums of the constant IPv4 header fields and UDP pseudo header / header fields */
+STATIC uint32 EthTp_IpSum[ETHTP_SOCON_COUNT];
+STATIC uint32 EthTp_UdpSum[ETHTP_SOCON_COUNT];
+
+STATIC EthTp_SoConStateType EthTp_SoConState[ETHTP_SOCON_COUNT];
+
+STATIC EthTp_StatisticsType EthTp_Statistics;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Fold a one's-complement sum to 16 bits
+ */
+STATIC uint32 EthTp_Fold(uint32 Sum)
+{
+    uint32 sum = Sum;
+
+    sum = (sum & 0xFFFFUL) + (sum >> 16);
+    sum = (sum & 0xFFFFUL) + (sum >> 16);
+    return sum;
+}
+
+/**
+ * @brief Add Length bytes as big-endian 16-bit words to a one's-complement sum
+ * @return Folded sum
+ */
+STATIC uint32 EthTp_Sum(uint32 Sum, P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) Data, uint32 Length)
+{
+    uint32 sum = Sum;
+    uint32 i;
+
+    /* 736 words of at most 0xFFFF cannot overflow 32 bits: fold once at the end */
+    for (i = 0UL; (i + 1UL) < Length; i += 2UL)
+    {
+        sum += ((uint32)Data[i] << 8) | (uint32)Data[i + 1UL];
+    }
+    if ((Length & 1UL) != 0UL)
+    {
+        sum += (uint32)Data[Length - 1UL] << 8;
+    }
+    return EthTp_Fold(sum);
+}
+
+/**
+ * @brief Build the header template of a socket connection and the sums of its constant fields
+ */
+STATIC void EthTp_BuildHeader(uint8 SoCon)
+{
+    P2CONST(EthTp_SoConConfigType, AUTOMATIC, ETHTP_CONST) config = &EthTp_SoCon[SoCon];
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) header = EthTp_Header[SoCon];
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) ip = &header[ETHTP_IP_OFFSET];
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) udp = &header[ETHTP_UDP_OFFSET];
+
+    (void)memset(header, 0, ETHTP_FRAME_HEADER_LENGTH);
+    (void)memcpy(&header[0], config->remote_mac, 6U);
+    (void)memcpy(&header[6], EthTp_SourceMac, 6U);
+    header[12] = (uint8)(ETHTP_ETHERTYPE_VLAN >> 8);
+    header[13] = (uint8)ETHTP_ETHERTYPE_VLAN;
+    header[14] = (uint8)(ETHTP_VLAN_TCI >> 8);
+    header[15] = (uint8)ETHTP_VLAN_TCI;
+    header[16] = (uint8)(ETHTP_ETHERTYPE_IPV4 >> 8);
+    header[17] = (uint8)ETHTP_ETHERTYPE_IPV4;
+
+    /* IPv4: total length and checksum 0, identification 0 (DF, RFC 6864) */
+    ip[0] = ETHTP_IP_VERSION_IHL;
+    ip[6] = (uint8)(ETHTP_IP_FLAGS_DF >> 8);
+    ip[8] = (uint8)ETHTP_TIME_TO_LIVE;
+    ip[9] = ETHTP_IP_PROTOCOL_UDP;
+    ip[12] = (uint8)(ETHTP_LOCAL_IP_ADDRESS >> 24);
+    ip[13] = (uint8)(ETHTP_LOCAL_IP_ADDRESS >> 16);
+    ip[14] = (uint8)(ETHTP_LOCAL_IP_ADDRESS >> 8);
+    ip[15] = (uint8)ETHTP_LOCAL_IP_ADDRESS;
+    ip[16] = (uint8)(config->remote_ip >> 24);
+    ip[17] = (uint8)(config->remote_ip >> 16);
+    ip[18] = (uint8)(config->remote_ip >> 8);
+    ip[19] = (uint8)config->remote_ip;
+    EthTp_IpSum[SoCon] = EthTp_Sum(0UL, ip, ETHTP_IP_HEADER_LENGTH);
+
+    /* UDP: length and checksum 0 */
+    udp[0] = (uint8)(config->local_port >> 8);
+    udp[1] = (uint8)config->local_port;
+    udp[2] = (uint8)(config->remote_port >> 8);
+    udp[3] = (uint8)config->remote_port;
+    EthTp_UdpSum[SoCon] = EthTp_Sum(EthTp_Sum((uint32)ETHTP_IP_PROTOCOL_UDP, &ip[12], 8UL),
+                                    udp, ETHTP_UDP_HEADER_LENGTH);
+}
+
+/**
+ * @brief Return the buffers of the descriptors completed by the DMA to the PduPool
+ * @note Called under ETHTP_ENTER_CRITICAL()
+ */
+STATIC void EthTp_Reclaim(void)
+{
+    uint32 slot;
+
+    while (EthTp_RingHead != EthTp_RingTail)
+    {
+        slot = EthTp_RingHead & ETHTP_RING_MASK;
+        if ((EthTp_TxRing[slot].des3 & ETHTP_TDES3_OWN) != 0UL)
+        {
+            break;
+        }
+        (void)PduPool_Release(EthTp_RingFrame[slot]);
+        EthTp_RingFrame[slot] = NULL_PTR;
+        EthTp_FrameCount--;
+        EthTp_RingHead++;
+    }
+}
+
+/**
+ * @brief Complete the headers of the datagram of a socket connection and hand it to the DMA
+ * @note Called under ETHTP_ENTER_CRITICAL() with a buffer open
+ */
+STATIC void EthTp_Flush(uint8 SoCon)
+{
+    P2VAR(EthTp_SoConStateType, AUTOMATIC, ETHTP_VAR) state = &EthTp_SoConState[SoCon];
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) frame = state->frame;
+    uint32 udp_length = (uint32)ETHTP_UDP_HEADER_LENGTH + state->length;
+    uint32 ip_length = (uint32)ETHTP_IP_HEADER_LENGTH + udp_length;
+    uint32 length = (uint32)ETHTP_FRAME_HEADER_LENGTH + state->length;
+    uint32 slot = EthTp_RingTail & ETHTP_RING_MASK;
+    P2VAR(EthTp_TxDescType, AUTOMATIC, ETHTP_VAR) desc = &EthTp_TxRing[slot];
+    uint32 checksum;
+
+    checksum = ~EthTp_Fold(EthTp_IpSum[SoCon] + ip_length) & 0xFFFFUL;
+    frame[ETHTP_IP_OFFSET + 2U] = (uint8)(ip_length >> 8);
+    frame[ETHTP_IP_OFFSET + 3U] = (uint8)ip_length;
+    frame[ETHTP_IP_OFFSET + 10U] = (uint8)(checksum >> 8);
+    frame[ETHTP_IP_OFFSET + 11U] = (uint8)checksum;
+
+    if (EthTp_SoCon[SoCon].udp_checksum == TRUE)
+    {
+        checksum = ~EthTp_Fold(EthTp_UdpSum[SoCon] + state->sum + (2UL * udp_length)) & 0xFFFFUL;
+        if (checksum == 0UL)
+        {
+            checksum = 0xFFFFUL;    /* 0 means no checksum */
+        }
+    }
+    else
+    {
+        checksum = 0UL;
+    }
+    frame[ETHTP_UDP_OFFSET + 4U] = (uint8)(udp_length >> 8);
+    frame[ETHTP_UDP_OFFSET + 5U] = (uint8)udp_length;
+    frame[ETHTP_UDP_OFFSET + 6U] = (uint8)(checksum >> 8);
+    frame[ETHTP_UDP_OFFSET + 7U] = (uint8)checksum;
+
+    if (length < ETHTP_MIN_FRAME_LENGTH)
+    {
+        (void)memset(&frame[length], 0, ETHTP_MIN_FRAME_LENGTH - length);
+        length = ETHTP_MIN_FRAME_LENGTH;
+    }
+
+    /* The slot is free: EthTp holds at most one block per descriptor and this one is not in the ring */
+    EthTp_RingFrame[slot] = frame;
+    desc->des0 = ETHTP_DMA_ADDRESS(frame);
+    desc->des1 = 0UL;
+    desc->des2 = length & ETHTP_TDES2_B1L_MASK;
+    DATA_SYNC_BARRIER();
+    desc->des3 = ETHTP_TDES3_OWN | ETHTP_TDES3_FD | ETHTP_TDES3_LD | (length & ETHTP_TDES3_FL_MASK);
+    DATA_SYNC_BARRIER();
+    EthTp_RingTail++;
+    ETHTP_GMAC_WRITE(ETHTP_DMA_TXDESC_TAIL_PTR,
+        ETHTP_DMA_ADDRESS(&EthTp_TxRing[EthTp_RingTail & ETHTP_RING_MASK]));
+
+    state->frame = NULL_PTR;
+    state->length = 0U;
+    state->sum = 0UL;
+    EthTp_Statistics.tx_datagrams++;
+}
+
+/**
+ * @brief Take a PduPool block for a socket connection and copy the header template into it
+ * @return FALSE if all descriptors are in use or the pool has no block
+ * @note Called under ETHTP_ENTER_CRITICAL()
+ */
+STATIC boolean EthTp_Open(uint8 SoCon)
+{
+    P2VAR(EthTp_SoConStateType, AUTOMATIC, ETHTP_VAR) state = &EthTp_SoConState[SoCon];
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) frame = NULL_PTR;
+
+    if (EthTp_FrameCount >= ETHTP_TX_RING_SIZE)
+    {
+        EthTp_Reclaim();
+    }
+    if (EthTp_FrameCount < ETHTP_TX_RING_SIZE)
+    {
+        frame = PduPool_Alloc(ETHTP_TX_BUFFER_SIZE);
+        if (frame == NULL_PTR)
+        {
+            EthTp_Reclaim();                            /* Sent blocks may still be in the ring */
+            frame = PduPool_Alloc(ETHTP_TX_BUFFER_SIZE);
+        }
+    }
+    if (frame == NULL_PTR)
+    {
+        return FALSE;
+    }
+    EthTp_FrameCount++;
+    state->frame = frame;
+    state->length = 0U;
+    state->sum = 0UL;
+    (void)memcpy(frame, EthTp_Header[SoCon], ETHTP_FRAME_HEADER_LENGTH);
+    return TRUE;
+}
+
+/**
+ * @brief Socket connection of a received datagram
+ * @return Socket connection, or ETHTP_SOCON_COUNT if none matches
+ */
+STATIC uint8 EthTp_FindSoCon(uint32 RemoteIp, uint16 RemotePort, uint16 LocalPort)
+{
+    uint8 i;
+
+    for (i = 0U; i < ETHTP_SOCON_COUNT; i++)
+    {
+        if ((EthTp_SoCon[i].local_port == LocalPort) && (EthTp_SoCon[i].remote_ip == RemoteIp) &&
+            (EthTp_SoCon[i].remote_port == RemotePort))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief Receive route of a header ID within the routes of a socket connection (binary search)
+ * @return Route, or NULL_PTR if the header ID is not configured
+ */
+STATIC P2CONST(EthTp_RxRouteConfigType, AUTOMATIC, ETHTP_CONST) EthTp_FindRoute(uint8 SoCon, uint32 HeaderId)
+{
+    uint32 low = EthTp_SoCon[SoCon].rx_route_first;
+    uint32 high = low + EthTp_SoCon[SoCon].rx_route_count;
+    uint32 mid;
+
+    while (low < high)
+    {
+        mid = (low + high) >> 1;
+        if (EthTp_RxRoute[mid].header_id == HeaderId)
+        {
+            return &EthTp_RxRoute[mid];
+        }
+        if (EthTp_RxRoute[mid].header_id < HeaderId)
+        {
+            low = mid + 1UL;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return NULL_PTR;
+}
+
+/**
+ * @brief Check the handle and payload of a transmitted PDU
+ */
+STATIC boolean EthTp_CheckTxPdu(uint8 ApiId, PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr)
+{
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (TxPduId >= ETHTP_TX_PDU_COUNT)
+    {
+        ETHTP_REPORT_ERROR(ApiId, ETHTP_E_INV_PDUID);
+        return FALSE;
+    }
+    if (PduInfoPtr == NULL_PTR)
+    {
+        ETHTP_REPORT_ERROR(ApiId, ETHTP_E_PARAM_POINTER);
+        return FALSE;
+    }
+    if (PduInfoPtr->SduLength > EthTp_TxPdu[TxPduId].length)
+    {
+        ETHTP_REPORT_ERROR(ApiId, ETHTP_E_INV_ARG);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Append a checked PDU to the datagram of its socket connection
+ * @note Called under ETHTP_ENTER_CRITICAL()
+ */
+STATIC Std_ReturnType EthTp_Append(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(EthTp_TxPduConfigType, AUTOMATIC, ETHTP_CONST) pdu = &EthTp_TxPdu[TxPduId];
+    P2VAR(EthTp_SoConStateType, AUTOMATIC, ETHTP_VAR) state;
+    P2VAR(uint8, AUTOMATIC, ETHTP_VAR) msg = NULL_PTR;
+    P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) source = NULL_PTR;
+    PduInfoType info;
+    Std_ReturnType result = E_OK;
+    uint32 length, size, sum;
+
+    state = &EthTp_SoConState[pdu->socon];
+    /* Room for the configured length if PduR provides the PDU later */
+    length = (PduInfoPtr->SduDataPtr != NULL_PTR) ? PduInfoPtr->SduLength : pdu->length;
+    size = ETHTP_PDU_HEADER_LENGTH + length;
+
+    if ((state->frame != NULL_PTR) && (((uint32)state->length + size) > ETHTP_MAX_DATAGRAM_LENGTH))
+    {
+        EthTp_Flush(pdu->socon);
+    }
+    if ((state->frame == NULL_PTR) && (EthTp_Open(pdu->socon) == FALSE))
+    {
+        result = E_NOT_OK;
+    }
+    else
+    {
+        msg = &state->frame[ETHTP_FRAME_HEADER_LENGTH + (uint32)state->length];
+        if (PduInfoPtr->SduDataPtr != NULL_PTR)
+        {
+            (void)memcpy(&msg[ETHTP_PDU_HEADER_LENGTH], PduInfoPtr->SduDataPtr, length);
+            source = PduInfoPtr->SduDataPtr;
+        }
+        else
+        {
+            info.SduDataPtr = &msg[ETHTP_PDU_HEADER_LENGTH];
+            info.SduLength = (PduLengthType)length;
+            result = PduR_SoAdIfTriggerTransmit(pdu->pdur_pdu, &info);
+            length = info.SduLength;
+            source = &msg[ETHTP_PDU_HEADER_LENGTH];
+        }
+    }
+
+    if (result == E_OK)
+    {
+        msg[0] = (uint8)(pdu->header_id >> 24);
+        msg[1] = (uint8)(pdu->header_id >> 16);
+        msg[2] = (uint8)(pdu->header_id >> 8);
+        msg[3] = (uint8)pdu->header_id;
+        msg[4] = 0U;
+        msg[5] = 0U;
+        msg[6] = (uint8)(length >> 8);
+        msg[7] = (uint8)length;
+
+        if (EthTp_SoCon[pdu->socon].udp_checksum == TRUE)
+        {
+            /* The PDU header is even-sized: the payload starts at the parity of the PDU */
+            sum = EthTp_Sum((pdu->header_id >> 16) + (pdu->header_id & 0xFFFFUL) + length, source, length);
+            if ((state->length & 1U) != 0U)
+            {
+                sum = ((sum & 0xFFUL) << 8) | (sum >> 8);
+            }
+            state->sum = EthTp_Fold(state->sum + sum);
+        }
+        state->length = (uint16)(state->length + ETHTP_PDU_HEADER_LENGTH + length);
+        EthTp_Statistics.tx_pdus++;
+    }
+    else
+    {
+        EthTp_Statistics.tx_dropped++;
+    }
+
+    return result;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void EthTp_Init(void)
+{
+    uint8 i;
+
+    EthTp_Initialized = FALSE;
+    (void)memset((void *)EthTp_TxRing, 0, sizeof(EthTp_TxRing));
+    for (i = 0U; i < ETHTP_TX_RING_SIZE; i++)
+    {
+        if (EthTp_RingFrame[i] != NULL_PTR)
+        {
+            (void)PduPool_Release(EthTp_RingFrame[i]);
+            EthTp_RingFrame[i] = NULL_PTR;
+        }
+    }
+    EthTp_FrameCount = 0U;
+    EthTp_RingHead = 0UL;
+    EthTp_RingTail = 0UL;
+    for (i = 0U; i < ETHTP_SOCON_COUNT; i++)
+    {
+        EthTp_BuildHeader(i);
+        if (EthTp_SoConState[i].frame != NULL_PTR)
+        {
+            (void)PduPool_Release(EthTp_SoConState[i].frame);
+        }
+        EthTp_SoConState[i].frame = NULL_PTR;
+        EthTp_SoConState[i].length = 0U;
+        EthTp_SoConState[i].sum = 0UL;
+    }
+    (void)memset(&EthTp_Statistics, 0, sizeof(EthTp_Statistics));
+
+    ETHTP_GMAC_WRITE(ETHTP_DMA_TXDESC_RING_LENGTH, (uint32)ETHTP_TX_RING_SIZE - 1UL);
+    ETHTP_GMAC_WRITE(ETHTP_DMA_TXDESC_LIST_ADDR, ETHTP_DMA_ADDRESS(&EthTp_TxRing[0]));
+    ETHTP_GMAC_WRITE(ETHTP_DMA_TXDESC_TAIL_PTR, ETHTP_DMA_ADDRESS(&EthTp_TxRing[0]));
+    EthTp_Initialized = TRUE;
+}
+
+Std_ReturnType EthTp_IfTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr)
+{
+    Std_ReturnType result;
+    uint32 key;
+
+    if (EthTp_Initialized == FALSE)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_IF_TRANSMIT_API_ID, ETHTP_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (EthTp_CheckTxPdu(ETHTP_IF_TRANSMIT_API_ID, TxPduId, PduInfoPtr) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+
+    ETHTP_ENTER_CRITICAL(key);
+    result = EthTp_Append(TxPduId, PduInfoPtr);
+    ETHTP_EXIT_CRITICAL(key);
+
+    return result;
+}
+
+Std_ReturnType EthTp_IfTransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, ETHTP_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfos, uint16 Count)
+{
+    Std_ReturnType result = E_OK;
+    uint16 i;
+    uint32 key;
+
+    (void)Controller;                                   /* One GMAC */
+
+    if (EthTp_Initialized == FALSE)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_IF_TRANSMIT_BATCH_API_ID, ETHTP_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if ((TxPduIds == NULL_PTR) || (PduInfos == NULL_PTR))
+    {
+        ETHTP_REPORT_ERROR(ETHTP_IF_TRANSMIT_BATCH_API_ID, ETHTP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ETHTP_ENTER_CRITICAL(key);
+    for (i = 0U; i < Count; i++)
+    {
+        if ((EthTp_CheckTxPdu(ETHTP_IF_TRANSMIT_BATCH_API_ID, TxPduIds[i], &PduInfos[i]) == FALSE) ||
+            (EthTp_Append(TxPduIds[i], &PduInfos[i]) != E_OK))
+        {
+            result = E_NOT_OK;
+        }
+    }
+    ETHTP_EXIT_CRITICAL(key);
+
+    return result;
+}
+
+Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr)
+{
+    return EthTp_IfTransmit(TxPduId, PduInfoPtr);
+}
+
+Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, ETHTP_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfos, uint16 Count)
+{
+    return EthTp_IfTransmitBatch(Controller, TxPduIds, PduInfos, Count);
+}
+
+void EthTp_RxIndication(P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) Frame, uint16 Length)
+{
+    P2CONST(EthTp_RxRouteConfigType, AUTOMATIC, ETHTP_CONST) route;
+    P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) ip;
+    P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) udp;
+    PduInfoType info;
+    uint32 offset, ihl, ip_length, udp_length, pos, pdu_length;
+    uint8 socon;
+
+    if (EthTp_Initialized == FALSE)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_RX_INDICATION_API_ID, ETHTP_E_UNINIT);
+        return;
+    }
+    if (Frame == NULL_PTR)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_RX_INDICATION_API_ID, ETHTP_E_PARAM_POINTER);
+        return;
+    }
+
+    /* Ethernet with optional VLAN tag; frames other than IPv4 / UDP to the local address are not ours */
+    offset = ETHTP_ETH_HEADER_LENGTH;
+    if ((Length >= ETHTP_ETH_HEADER_LENGTH) && (ETHTP_GET16(&Frame[12]) == ETHTP_ETHERTYPE_VLAN))
+    {
+        offset += ETHTP_VLAN_TAG_LENGTH;
+    }
+    if (((uint32)Length < (offset + ETHTP_IP_HEADER_LENGTH + ETHTP_UDP_HEADER_LENGTH)) ||
+        (ETHTP_GET16(&Frame[offset - 2UL]) != ETHTP_ETHERTYPE_IPV4))
+    {
+        return;
+    }
+    ip = &Frame[offset];
+    if ((ip[9] != ETHTP_IP_PROTOCOL_UDP) || (ETHTP_GET32(&ip[16]) != ETHTP_LOCAL_IP_ADDRESS))
+    {
+        return;
+    }
+
+    ihl = ((uint32)ip[0] & 0x0FUL) * 4UL;
+    ip_length = ETHTP_GET16(&ip[2]);
+    if (((ip[0] & 0xF0U) != 0x40U) || (ihl < ETHTP_IP_HEADER_LENGTH) ||
+        (ip_length < (ihl + ETHTP_UDP_HEADER_LENGTH)) || ((offset + ip_length) > Length) ||
+        ((ETHTP_GET16(&ip[6]) & ETHTP_IP_FRAGMENT_MASK) != 0U) ||
+        (EthTp_Sum(0UL, ip, ihl) != 0xFFFFUL))
+    {
+        EthTp_Statistics.rx_dropped++;
+        return;
+    }
+
+    udp = &ip[ihl];
+    udp_length = ETHTP_GET16(&udp[4]);
+    socon = EthTp_FindSoCon(ETHTP_GET32(&ip[12]), ETHTP_GET16(&udp[0]), ETHTP_GET16(&udp[2]));
+    if ((udp_length < ETHTP_UDP_HEADER_LENGTH) || (udp_length > (ip_length - ihl)) ||
+        (socon >= ETHTP_SOCON_COUNT))
+    {
+        EthTp_Statistics.rx_dropped++;
+        return;
+    }
+    EthTp_Statistics.rx_datagrams++;
+
+    pos = ETHTP_UDP_HEADER_LENGTH;
+    while ((pos + ETHTP_PDU_HEADER_LENGTH) <= udp_length)
+    {
+        pdu_length = ETHTP_GET32(&udp[pos + 4UL]);
+        if (pdu_length > (udp_length - pos - ETHTP_PDU_HEADER_LENGTH))
+        {
+            break;
+        }
+        route = EthTp_FindRoute(socon, ETHTP_GET32(&udp[pos]));
+        if (route != NULL_PTR)
+        {
+            info.SduDataPtr = (uint8 *)&udp[pos + ETHTP_PDU_HEADER_LENGTH];
+            info.SduLength = (PduLengthType)pdu_length;
+            PduR_SoAdIfRxIndication(route->pdur_pdu, &info);
+            EthTp_Statistics.rx_pdus++;
+        }
+        else
+        {
+            EthTp_Statistics.rx_dropped++;
+        }
+        pos += ETHTP_PDU_HEADER_LENGTH + pdu_length;
+    }
+    if (pos != udp_length)
+    {
+        /* Truncated PDU header or PDU: the rest of the datagram is discarded */
+        EthTp_Statistics.rx_dropped++;
+    }
+}
+
+void EthTp_MainFunctionTx(void)
+{
+    uint32 key;
+    uint8 i;
+
+    if (EthTp_Initialized == FALSE)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_MAIN_FUNCTION_TX_API_ID, ETHTP_E_UNINIT);
+        return;
+    }
+
+    for (i = 0U; i < ETHTP_SOCON_COUNT; i++)
+    {
+        ETHTP_ENTER_CRITICAL(key);
+        if (EthTp_SoConState[i].frame != NULL_PTR)
+        {
+            EthTp_Flush(i);
+        }
+        ETHTP_EXIT_CRITICAL(key);
+    }
+
+    ETHTP_ENTER_CRITICAL(key);
+    EthTp_Reclaim();
+    ETHTP_EXIT_CRITICAL(key);
+}
+
+Std_ReturnType EthTp_GetStatistics(
+    P2VAR(EthTp_StatisticsType, AUTOMATIC, ETHTP_APPL_DATA) StatisticsPtr)
+{
+    uint32 key;
+
+    if (StatisticsPtr == NULL_PTR)
+    {
+        ETHTP_REPORT_ERROR(ETHTP_GET_STATISTICS_API_ID, ETHTP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ETHTP_ENTER_CRITICAL(key);
+    *StatisticsPtr = EthTp_Statistics;
+    ETHTP_EXIT_CRITICAL(key);
+
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                          END OF FILE
+==================================================================================================*/
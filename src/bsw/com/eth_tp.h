@@ -0,0 +1,399 @@
+/**
+ * @file    eth_tp.h
+ * @brief   EthTp - UDP/IPv4 Socket Adapter with Batched Datagrams
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Lightweight socket adapter of the VCU for the SoAd PDUs of the PduR
+ * (SoAdPduRoute / SoAdSocketRoute in config/autosar/communication/pdu_router.arxml),
+ * in place of a TCP/IP stack: the UDP socket connections are static
+ * (EthTpSocketConnection), every datagram is sent to the one remote of its
+ * socket connection, and the PDUs of a socket connection are packed into
+ * one datagram with a SoAd PDU header each:
+ *
+ * | Bytes | Content                                                                   |
+ * |-------|---------------------------------------------------------------------------|
+ * | 18    | Ethernet header with VLAN tag (EthTpVlanId / EthTpVlanPriority)           |
+ * | 20    | IPv4 header: DF, no options; total length and checksum patched per frame  |
+ * | 8     | UDP header: length and checksum patched per frame                         |
+ * | 8 + n | Per PDU: header ID and length (big endian, SoAd PDU header), payload      |
+ *
+ * EthTp_IfTransmit() (and SoAd_IfTransmit(), through which the PduR calls
+ * it) appends the PDU to the open datagram of its socket connection, built
+ * in place in a GMAC transmit buffer. A datagram is sent (flush) when
+ *
+ * | Condition                                         | Checked in                   |
+ * |---------------------------------------------------|------------------------------|
+ * | The next PDU does not fit into the datagram       | EthTp_IfTransmit()           |
+ * | The cycle ends                                    | EthTp_MainFunctionTx()       |
+ *
+ * EthTp_MainFunctionTx() runs after the COM and PduR main functions of the
+ * cycle, so all PDUs a socket connection sends in one cycle leave in one
+ * datagram: the 66 bytes of Ethernet, IPv4 and UDP overhead (with preamble,
+ * FCS and inter-frame gap) are paid once per cycle and socket connection
+ * instead of once per PDU, and the GMAC sees one descriptor per datagram.
+ *
+ * Throughput:
+ * - The Ethernet, IPv4 and UDP headers of a socket connection are built
+ *   once in EthTp_Init() together with the one's-complement sums of their
+ *   constant fields; a flush only writes the two lengths and two checksums
+ * - The UDP checksum is accumulated per PDU while it is appended, from the
+ *   (cacheable) source data of the caller, not from the non-cacheable frame
+ * - PDUs of PDUR_TRIGGERTRANSMIT destinations (SduDataPtr NULL_PTR) are
+ *   copied by PduR_SoAdIfTriggerTransmit() directly into the frame
+ * - SoAd_IfTransmitBatch() appends all PDUs the PduR collected from one
+ *   Com_MainFunctionTx() under one critical section
+ * - Received PDUs are handed to PduR_SoAdIfRxIndication() in place; the
+ *   route of a header ID is found by binary search in the sorted routes of
+ *   the socket connection
+ *
+ * Implementation Notes:
+ * - The Eth driver initializes the MAC and starts the DMA channels and
+ *   passes received frames to EthTp_RxIndication(); EthTp_Init() only sets
+ *   up the transmit descriptor ring of ETHTP_DMA_CHANNEL
+ * - The transmit descriptors are placed in ETHTP_DMA_SECTION, which the
+ *   linker script must map to non-cacheable RAM; the transmit buffers are
+ *   1536-byte blocks of the PDU buffer pool (PDUPOOL_SECTION), taken when
+ *   a socket connection opens a datagram and returned when the DMA has
+ *   sent it, so EthTp reserves no buffer RAM of its own. PduPool_Init()
+ *   precedes EthTp_Init()
+ * - The state of a socket connection is accessed under ETHTP_ENTER_CRITICAL();
+ *   PDUs may be transmitted from tasks and from gateway interrupts
+ * - The UDP checksum of received datagrams is verified by the GMAC receive
+ *   checksum offload; EthTp checks the IPv4 header checksum
+ * - Fragmented datagrams, IPv4 options on transmit and ARP are not
+ *   supported: remote MAC addresses are configured, multicast ones derived
+ * - There is no transmit confirmation: the PDUs sent through EthTp are
+ *   routed from COM, which does not use one
+ * - If no descriptor or pool block is free, the PDU is dropped and counted
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | UDP socket adapter, batched send   |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Batched transmit of the COM cycle  |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Transmit buffers from the PduPool  |
+ *
+ * @see eth_tp.c
+ * @see eth_tp_cfg.h
+ * @see pdu_router.h
+ * @see pdu_pool.h
+ */
+
+#ifndef ETH_TP_H
+#define ETH_TP_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define ETHTP_VENDOR_ID                         43U
+#define ETHTP_MODULE_ID                         56U     /**< SoAd */
+#define ETHTP_INSTANCE_ID                       0U
+
+#define ETHTP_SW_MAJOR_VERSION                  1U
+#define ETHTP_SW_MINOR_VERSION                  2U
+#define ETHTP_SW_PATCH_VERSION                  0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (ETHTP_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "eth_tp.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define ETHTP_INIT_API_ID                       0x01U
+#define ETHTP_GET_STATISTICS_API_ID             0x0AU
+#define ETHTP_MAIN_FUNCTION_TX_API_ID           0x13U
+#define ETHTP_RX_INDICATION_API_ID              0x42U
+#define ETHTP_IF_TRANSMIT_API_ID                0x49U
+#define ETHTP_IF_TRANSMIT_BATCH_API_ID          0x80U   /**< Vendor-specific */
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define ETHTP_E_UNINIT                          0x01U   /**< EthTp_Init() not called */
+#define ETHTP_E_PARAM_POINTER                   0x02U   /**< NULL pointer parameter */
+#define ETHTP_E_INV_ARG                         0x03U   /**< PDU longer than configured */
+#define ETHTP_E_INV_PDUID                       0x06U   /**< Invalid transmit PDU handle */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def ETHTP_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef ETHTP_DEV_ERROR_DETECT
+    #define ETHTP_DEV_ERROR_DETECT              STD_ON
+#endif
+
+/**
+ * @def ETHTP_TX_RING_SIZE
+ * @brief DMA descriptors (power of two) and most transmit buffers EthTp
+ *        holds at once; more than the socket connections, so a flushed
+ *        datagram never blocks a socket
+ */
+#ifndef ETHTP_TX_RING_SIZE
+    #define ETHTP_TX_RING_SIZE                  8U
+#endif
+
+/**
+ * @def ETHTP_TX_BUFFER_SIZE
+ * @brief Bytes per transmit buffer (PduPool_Alloc() length); a datagram of
+ *        ETHTP_MAX_DATAGRAM_LENGTH with its 46 bytes of headers must fit
+ */
+#ifndef ETHTP_TX_BUFFER_SIZE
+    #define ETHTP_TX_BUFFER_SIZE                1536U
+#endif
+
+/**
+ * @def ETHTP_DMA_CHANNEL
+ * @brief GMAC DMA channel (transmit queue) of the UDP datagrams
+ */
+#ifndef ETHTP_DMA_CHANNEL
+    #define ETHTP_DMA_CHANNEL                   0U
+#endif
+
+/**
+ * @def ETHTP_GMAC_BASE_ADDR
+ * @brief Register base of the GMAC (MCU_GMAC0_BASE_ADDR of mcu_select.h)
+ */
+#ifndef ETHTP_GMAC_BASE_ADDR
+    #define ETHTP_GMAC_BASE_ADDR                0x40480000UL
+#endif
+
+/**
+ * @def ETHTP_DMA_SECTION
+ * @brief Linker section of the transmit descriptors (non-cacheable)
+ */
+#ifndef ETHTP_DMA_SECTION
+    #define ETHTP_DMA_SECTION                   ".os_shared_noncacheable"
+#endif
+
+/* Configuration validation */
+#if (ETHTP_DEV_ERROR_DETECT != STD_ON) && (ETHTP_DEV_ERROR_DETECT != STD_OFF)
+    #error "ETHTP_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (ETHTP_TX_RING_SIZE < 2U) || (ETHTP_TX_RING_SIZE > 128U) || \
+    ((ETHTP_TX_RING_SIZE & (ETHTP_TX_RING_SIZE - 1U)) != 0U)
+    #error "ETHTP_TX_RING_SIZE must be a power of two from 2 to 128"
+#endif
+
+#if ((ETHTP_TX_BUFFER_SIZE % 32U) != 0U) || (ETHTP_TX_BUFFER_SIZE > 16352U)
+    #error "ETHTP_TX_BUFFER_SIZE must be a multiple of 32 of at most 16352"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Ethernet (with VLAN tag), IPv4 and UDP header in front of the PDUs */
+#define ETHTP_FRAME_HEADER_LENGTH               46U
+
+/** @brief SoAd PDU header: header ID and length */
+#define ETHTP_PDU_HEADER_LENGTH                 8U
+
+/**
+ * @struct EthTp_SoConConfigType
+ * @brief Static configuration of one UDP socket connection (EthTpSocketConnection, generated)
+ */
+typedef struct
+{
+    uint32 remote_ip;                   /**< EthTpRemoteIpAddress */
+    uint16 local_port;                  /**< EthTpLocalPort */
+    uint16 remote_port;                 /**< EthTpRemotePort */
+    uint16 rx_route_first;              /**< First receive route of the socket connection */
+    uint16 rx_route_count;              /**< Receive routes, sorted by header ID */
+    uint8 remote_mac[6];                /**< EthTpRemoteMacAddress, derived for multicast */
+    boolean udp_checksum;               /**< EthTpUdpChecksum, else checksum 0 is sent */
+} EthTp_SoConConfigType;
+
+/**
+ * @struct EthTp_TxPduConfigType
+ * @brief Static configuration of one transmit PDU (SoAdPduRoute, generated)
+ */
+typedef struct
+{
+    uint32 header_id;                   /**< SoAdTxPduHeaderId */
+    PduIdType pdur_pdu;                 /**< PduR destination handle (PduRConf_PduRDestPdu_*) */
+    PduLengthType length;               /**< Maximum PDU length (PduLength) */
+    uint8 socon;                        /**< EthTpConf_EthTpSocketConnection_* */
+} EthTp_TxPduConfigType;
+
+/**
+ * @struct EthTp_RxRouteConfigType
+ * @brief Static configuration of one received PDU (SoAdSocketRoute, generated)
+ */
+typedef struct
+{
+    uint32 header_id;                   /**< SoAdRxPduHeaderId */
+    PduIdType pdur_pdu;                 /**< PduR source handle (PduRConf_PduRSrcPdu_*) */
+} EthTp_RxRouteConfigType;
+
+/**
+ * @struct EthTp_StatisticsType
+ * @brief Counters since EthTp_Init()
+ */
+typedef struct
+{
+    uint32 tx_pdus;                     /**< PDUs appended to a datagram */
+    uint32 tx_datagrams;                /**< Datagrams handed to the DMA */
+    uint32 tx_dropped;                  /**< PDUs dropped: no buffer or no PDU from PduR */
+    uint32 rx_datagrams;                /**< Datagrams of a socket connection received */
+    uint32 rx_pdus;                     /**< PDUs passed to the PduR */
+    uint32 rx_dropped;                  /**< Frames and PDUs discarded: malformed or unknown */
+} EthTp_StatisticsType;
+
+#include "eth_tp_cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief EthTpSourceMacAddress */
+extern const uint8 EthTp_SourceMac[6];
+
+/** @brief Socket connections, indexed by EthTpConf_EthTpSocketConnection_* */
+extern const EthTp_SoConConfigType EthTp_SoCon[ETHTP_SOCON_COUNT];
+
+/** @brief Transmit PDUs, indexed by EthTpConf_SoAdTxPdu_* */
+extern const EthTp_TxPduConfigType EthTp_TxPdu[ETHTP_TX_PDU_COUNT];
+
+/** @brief Receive routes, grouped by socket connection */
+extern const EthTp_RxRouteConfigType EthTp_RxRoute[ETHTP_RX_ROUTE_COUNT];
+
+#if (ETHTP_SOCON_COUNT >= ETHTP_TX_RING_SIZE)
+    #error "ETHTP_TX_RING_SIZE must exceed the number of socket connections"
+#endif
+
+#if ((ETHTP_FRAME_HEADER_LENGTH + ETHTP_MAX_DATAGRAM_LENGTH) > ETHTP_TX_BUFFER_SIZE)
+    #error "ETHTP_TX_BUFFER_SIZE is too small for ETHTP_MAX_DATAGRAM_LENGTH"
+#endif
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Build the frame headers of the socket connections and set up the
+ *        transmit descriptor ring
+ *
+ * @serviceID ETHTP_INIT_API_ID (0x01)
+ * @reentrancy Non-Reentrant
+ */
+extern void EthTp_Init(void);
+
+/**
+ * @brief Append a PDU to the datagram of its socket connection
+ * @param[in] TxPduId    Transmit PDU (EthTpConf_SoAdTxPdu_*)
+ * @param[in] PduInfoPtr Payload, or SduDataPtr NULL_PTR to fetch it with
+ *                       PduR_SoAdIfTriggerTransmit() (SduLength: announced length)
+ * @return E_OK, or E_NOT_OK if no buffer is free, PduR has no PDU or on invalid parameters
+ *
+ * @serviceID ETHTP_IF_TRANSMIT_API_ID (0x49)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType EthTp_IfTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief SoAd transmit interface of the PduR, same as EthTp_IfTransmit()
+ *
+ * @serviceID ETHTP_IF_TRANSMIT_API_ID (0x49)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Append several PDUs to the datagrams of their socket connections
+ * @param[in] Controller Ethernet controller; EthTp drives one GMAC
+ * @param[in] TxPduIds   Transmit PDUs (EthTpConf_SoAdTxPdu_*), in transmission order
+ * @param[in] PduInfos   Payload of each PDU, as for EthTp_IfTransmit()
+ * @param[in] Count      Number of PDUs
+ * @return E_OK if all PDUs were appended, else E_NOT_OK; the other PDUs are still appended
+ *
+ * @serviceID ETHTP_IF_TRANSMIT_BATCH_API_ID (0x80)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType EthTp_IfTransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, ETHTP_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfos, uint16 Count);
+
+/**
+ * @brief SoAd batched transmit interface of the PduR, same as EthTp_IfTransmitBatch()
+ *
+ * @serviceID ETHTP_IF_TRANSMIT_BATCH_API_ID (0x80)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, ETHTP_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, ETHTP_APPL_DATA) PduInfos, uint16 Count);
+
+/**
+ * @brief Process a received Ethernet frame and pass its PDUs to the PduR
+ * @param[in] Frame  Frame from the destination MAC address on, without FCS
+ * @param[in] Length Frame length in bytes
+ *
+ * @serviceID ETHTP_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Non-Reentrant
+ */
+extern void EthTp_RxIndication(P2CONST(uint8, AUTOMATIC, ETHTP_APPL_DATA) Frame, uint16 Length);
+
+/**
+ * @brief Send the open datagrams (end of cycle) and reclaim the buffers
+ *        the DMA has sent
+ *
+ * @serviceID ETHTP_MAIN_FUNCTION_TX_API_ID (0x13)
+ * @reentrancy Non-Reentrant
+ */
+extern void EthTp_MainFunctionTx(void);
+
+/**
+ * @brief Copy the counters
+ * @param[out] StatisticsPtr Destination
+ * @return E_OK, or E_NOT_OK on a NULL pointer
+ *
+ * @serviceID ETHTP_GET_STATISTICS_API_ID (0x0A)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType EthTp_GetStatistics(
+    P2VAR(EthTp_StatisticsType, AUTOMATIC, ETHTP_APPL_DATA) StatisticsPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ETH_TP_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
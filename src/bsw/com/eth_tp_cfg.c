@@ -0,0 +1,93 @@
+/**
+ * @file    eth_tp_cfg.c
+ * @brief   EthTp Configuration - Socket Connection and Route Tables
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static EthTp configuration of the VCU: source MAC address, UDP socket
+ * connections, SoAd transmit PDUs and receive routes. The receive routes
+ * of a socket connection are sorted by PDU header ID.
+ *
+ * @note Generated by tools/ethtp/ethtp_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "eth_tp.h"
+#include "pdu_router.h"
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const uint8 EthTp_SourceMac[6] = { 0x02U, 0x56U, 0x43U, 0x55U, 0x00U, 0x01U };
+
+const EthTp_SoConConfigType EthTp_SoCon[ETHTP_SOCON_COUNT] =
+{
+    { 0xC0A80A14UL, 42100U, 42100U,   0U,  28U, { 0x02U, 0x56U, 0x43U, 0x55U, 0x00U, 0x20U }, TRUE  },  /* SoCon_Hpc */
+    { 0xC0A80A1FUL, 42100U, 42100U,  28U,  12U, { 0x02U, 0x56U, 0x43U, 0x55U, 0x00U, 0x31U }, TRUE  },  /* SoCon_ZoneBody */
+    { 0xEFC00A01UL, 42200U, 42200U,  40U,   0U, { 0x01U, 0x00U, 0x5EU, 0x40U, 0x0AU, 0x01U }, FALSE }   /* SoCon_Telemetry */
+};
+
+const EthTp_TxPduConfigType EthTp_TxPdu[ETHTP_TX_PDU_COUNT] =
+{
+    { 0x00010110UL, PduRConf_PduRDestPdu_BMS_PackStatus_Eth,    32U,  EthTpConf_EthTpSocketConnection_SoCon_Hpc       },  /* BMS_PackStatus_Eth */
+    { 0x00010120UL, PduRConf_PduRDestPdu_MCU_Status_Eth,        24U,  EthTpConf_EthTpSocketConnection_SoCon_Hpc       },  /* MCU_Status_Eth */
+    { 0x000200A0UL, PduRConf_PduRDestPdu_ESP_WheelSpeeds_Eth,   8U,   EthTpConf_EthTpSocketConnection_SoCon_Hpc       },  /* ESP_WheelSpeeds_Eth */
+    { 0x000200A1UL, PduRConf_PduRDestPdu_ESP_Dynamics_Eth,      8U,   EthTpConf_EthTpSocketConnection_SoCon_Hpc       },  /* ESP_Dynamics_Eth */
+    { 0x000200B0UL, PduRConf_PduRDestPdu_SAS_Steering_Eth,      8U,   EthTpConf_EthTpSocketConnection_SoCon_Hpc       },  /* SAS_Steering_Eth */
+    { 0x00040101UL, PduRConf_PduRDestPdu_VCU_TorqueRequest_Eth, 16U,  EthTpConf_EthTpSocketConnection_SoCon_Telemetry },  /* VCU_TorqueRequest_Eth */
+    { 0x00040102UL, PduRConf_PduRDestPdu_VCU_Status_Eth,        32U,  EthTpConf_EthTpSocketConnection_SoCon_Telemetry }   /* VCU_Status_Eth */
+};
+
+const EthTp_RxRouteConfigType EthTp_RxRoute[ETHTP_RX_ROUTE_COUNT] =
+{
+    { 0x00080500UL, PduRConf_PduRSrcPdu_GwEth_PT_500 },  /* SoCon_Hpc */
+    { 0x00080501UL, PduRConf_PduRSrcPdu_GwEth_PT_501 },  /* SoCon_Hpc */
+    { 0x00080502UL, PduRConf_PduRSrcPdu_GwEth_PT_502 },  /* SoCon_Hpc */
+    { 0x00080503UL, PduRConf_PduRSrcPdu_GwEth_PT_503 },  /* SoCon_Hpc */
+    { 0x00080504UL, PduRConf_PduRSrcPdu_GwEth_PT_504 },  /* SoCon_Hpc */
+    { 0x00080505UL, PduRConf_PduRSrcPdu_GwEth_PT_505 },  /* SoCon_Hpc */
+    { 0x00080506UL, PduRConf_PduRSrcPdu_GwEth_PT_506 },  /* SoCon_Hpc */
+    { 0x00080507UL, PduRConf_PduRSrcPdu_GwEth_PT_507 },  /* SoCon_Hpc */
+    { 0x00080508UL, PduRConf_PduRSrcPdu_GwEth_PT_508 },  /* SoCon_Hpc */
+    { 0x00080509UL, PduRConf_PduRSrcPdu_GwEth_PT_509 },  /* SoCon_Hpc */
+    { 0x0008050AUL, PduRConf_PduRSrcPdu_GwEth_PT_50A },  /* SoCon_Hpc */
+    { 0x0008050BUL, PduRConf_PduRSrcPdu_GwEth_PT_50B },  /* SoCon_Hpc */
+    { 0x0008050CUL, PduRConf_PduRSrcPdu_GwEth_PT_50C },  /* SoCon_Hpc */
+    { 0x0008050DUL, PduRConf_PduRSrcPdu_GwEth_PT_50D },  /* SoCon_Hpc */
+    { 0x0008050EUL, PduRConf_PduRSrcPdu_GwEth_PT_50E },  /* SoCon_Hpc */
+    { 0x0008050FUL, PduRConf_PduRSrcPdu_GwEth_PT_50F },  /* SoCon_Hpc */
+    { 0x00081540UL, PduRConf_PduRSrcPdu_GwEth_CH_540 },  /* SoCon_Hpc */
+    { 0x00081541UL, PduRConf_PduRSrcPdu_GwEth_CH_541 },  /* SoCon_Hpc */
+    { 0x00081542UL, PduRConf_PduRSrcPdu_GwEth_CH_542 },  /* SoCon_Hpc */
+    { 0x00081543UL, PduRConf_PduRSrcPdu_GwEth_CH_543 },  /* SoCon_Hpc */
+    { 0x00081544UL, PduRConf_PduRSrcPdu_GwEth_CH_544 },  /* SoCon_Hpc */
+    { 0x00081545UL, PduRConf_PduRSrcPdu_GwEth_CH_545 },  /* SoCon_Hpc */
+    { 0x00081546UL, PduRConf_PduRSrcPdu_GwEth_CH_546 },  /* SoCon_Hpc */
+    { 0x00081547UL, PduRConf_PduRSrcPdu_GwEth_CH_547 },  /* SoCon_Hpc */
+    { 0x00081548UL, PduRConf_PduRSrcPdu_GwEth_CH_548 },  /* SoCon_Hpc */
+    { 0x00081549UL, PduRConf_PduRSrcPdu_GwEth_CH_549 },  /* SoCon_Hpc */
+    { 0x0008154AUL, PduRConf_PduRSrcPdu_GwEth_CH_54A },  /* SoCon_Hpc */
+    { 0x0008154BUL, PduRConf_PduRSrcPdu_GwEth_CH_54B },  /* SoCon_Hpc */
+    { 0x00082580UL, PduRConf_PduRSrcPdu_GwEth_BD_580 },  /* SoCon_ZoneBody */
+    { 0x00082581UL, PduRConf_PduRSrcPdu_GwEth_BD_581 },  /* SoCon_ZoneBody */
+    { 0x00082582UL, PduRConf_PduRSrcPdu_GwEth_BD_582 },  /* SoCon_ZoneBody */
+    { 0x00082583UL, PduRConf_PduRSrcPdu_GwEth_BD_583 },  /* SoCon_ZoneBody */
+    { 0x00082584UL, PduRConf_PduRSrcPdu_GwEth_BD_584 },  /* SoCon_ZoneBody */
+    { 0x00082585UL, PduRConf_PduRSrcPdu_GwEth_BD_585 },  /* SoCon_ZoneBody */
+    { 0x00082586UL, PduRConf_PduRSrcPdu_GwEth_BD_586 },  /* SoCon_ZoneBody */
+    { 0x00082587UL, PduRConf_PduRSrcPdu_GwEth_BD_587 },  /* SoCon_ZoneBody */
+    { 0x00082588UL, PduRConf_PduRSrcPdu_GwEth_BD_588 },  /* SoCon_ZoneBody */
+    { 0x00082589UL, PduRConf_PduRSrcPdu_GwEth_BD_589 },  /* SoCon_ZoneBody */
+    { 0x0008258AUL, PduRConf_PduRSrcPdu_GwEth_BD_58A },  /* SoCon_ZoneBody */
+    { 0x0008258BUL, PduRConf_PduRSrcPdu_GwEth_BD_58B }   /* SoCon_ZoneBody */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
@@ -0,0 +1,65 @@
+/**
+ * @file    eth_tp_cfg.h
+ * @brief   EthTp Configuration - Socket Connection and PDU Handles
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Socket connections and SoAd PDU handles of the VCU UDP/IPv4 socket adapter
+ * (local address 192.168.10.1, source MAC 02:56:43:55:00:01, VLAN 10, PCP 4):
+ *
+ * | Socket connection | Local port | Remote                | Remote MAC        | Checksum | TX PDUs | RX PDUs |
+ * |-------------------|------------|-----------------------|-------------------|----------|---------|---------|
+ * | SoCon_Hpc         | 42100      | 192.168.10.20:42100   | 02:56:43:55:00:20 | UDP      | 5       | 28      |
+ * | SoCon_ZoneBody    | 42100      | 192.168.10.31:42100   | 02:56:43:55:00:31 | UDP      | 0       | 12      |
+ * | SoCon_Telemetry   | 42200      | 239.192.10.1:42200    | 01:00:5E:40:0A:01 | none     | 2       | 0       |
+ *
+ * @note Generated by tools/ethtp/ethtp_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef ETH_TP_CFG_H
+#define ETH_TP_CFG_H
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define ETHTP_SOCON_COUNT                               3U
+#define ETHTP_TX_PDU_COUNT                              7U
+#define ETHTP_RX_ROUTE_COUNT                            40U
+
+/* ===============================================================================================
+ *                                       GENERAL PARAMETERS
+ * =============================================================================================== */
+
+#define ETHTP_LOCAL_IP_ADDRESS                          0xC0A80A01UL    /* 192.168.10.1 */
+#define ETHTP_VLAN_TCI                                  0x800AU         /* PCP 4, VID 10 */
+#define ETHTP_TIME_TO_LIVE                              64U
+#define ETHTP_MAX_DATAGRAM_LENGTH                       1472U
+
+/* ===============================================================================================
+ *                                   SOCKET CONNECTION HANDLES
+ * =============================================================================================== */
+
+#define EthTpConf_EthTpSocketConnection_SoCon_Hpc       0U
+#define EthTpConf_EthTpSocketConnection_SoCon_ZoneBody  1U
+#define EthTpConf_EthTpSocketConnection_SoCon_Telemetry 2U
+
+/* ===============================================================================================
+ *                   TRANSMIT PDU HANDLES (EthTp_IfTransmit / SoAd_IfTransmit)
+ * =============================================================================================== */
+
+#define EthTpConf_SoAdTxPdu_BMS_PackStatus_Eth          0U
+#define EthTpConf_SoAdTxPdu_MCU_Status_Eth              1U
+#define EthTpConf_SoAdTxPdu_ESP_WheelSpeeds_Eth         2U
+#define EthTpConf_SoAdTxPdu_ESP_Dynamics_Eth            3U
+#define EthTpConf_SoAdTxPdu_SAS_Steering_Eth            4U
+#define EthTpConf_SoAdTxPdu_VCU_TorqueRequest_Eth       5U
+#define EthTpConf_SoAdTxPdu_VCU_Status_Eth              6U
+
+#endif /* ETH_TP_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
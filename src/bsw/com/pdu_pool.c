@@ -0,0 +1,451 @@
+/**
+ * @file    pdu_pool.c
+ * @brief   PduPool - Fixed-Block PDU Buffer Pool with Reference Counting
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Services of pdu_pool.h. The blocks of all classes lie in one storage
+ * array, the classes one after the other in ascending block size
+ * (PduPool_Class: offset, end, block size, index of the first block), so
+ * PduPool_Retain() and PduPool_Release() find the class of a block by
+ * comparing its offset with at most four class ends, and its index by one
+ * division.
+ *
+ * Every class has a free list (LIFO) linked through PduPool_Next[]. Its
+ * head holds the first free block in the low 16 bits and a tag in the high
+ * 16 bits that every push and pop increments: a pop that was preempted
+ * between reading the head and its compare-and-swap, while an interrupt
+ * popped the same block and pushed it back with another successor, fails
+ * on the changed tag and retries instead of installing the stale successor.
+ *
+ * Implementation Notes:
+ * - No critical section: every shared word is updated by a
+ *   read / Os_Port_CompareAndSwap() loop; a loop only repeats if an
+ *   interrupt modified the same word in between
+ * - The reference count of a free block is 0; PduPool_Retain() and
+ *   PduPool_Release() of a free block are rejected (DET PDUPOOL_E_INV_BLOCK)
+ * - Statistics are updated after the block operation, so in_use and the
+ *   high watermark may lag an interrupting allocation by one block
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see pdu_pool.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "pdu_pool.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define PDUPOOL_C_VENDOR_ID                     43U
+#define PDUPOOL_C_SW_MAJOR_VERSION              1U
+#define PDUPOOL_C_SW_MINOR_VERSION              0U
+#define PDUPOOL_C_SW_PATCH_VERSION              0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (PDUPOOL_C_VENDOR_ID != PDUPOOL_VENDOR_ID)
+    #error "pdu_pool.c and pdu_pool.h have different vendor IDs"
+#endif
+
+#if ((PDUPOOL_C_SW_MAJOR_VERSION != PDUPOOL_SW_MAJOR_VERSION) || \
+     (PDUPOOL_C_SW_MINOR_VERSION != PDUPOOL_SW_MINOR_VERSION) || \
+     (PDUPOOL_C_SW_PATCH_VERSION != PDUPOOL_SW_PATCH_VERSION))
+    #error "Software version mismatch between pdu_pool.c and pdu_pool.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (PDUPOOL_DEV_ERROR_DETECT == STD_ON)
+    #define PDUPOOL_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(PDUPOOL_MODULE_ID, PDUPOOL_INSTANCE_ID, (api), (err)))
+#else
+    #define PDUPOOL_REPORT_ERROR(api, err)      ((void)0)
+#endif
+
+/* Free list head: tag (high 16 bits), first free block (low 16 bits) */
+#define PDUPOOL_INDEX_MASK                      0x0000FFFFUL
+#define PDUPOOL_TAG_MASK                        0xFFFF0000UL
+#define PDUPOOL_TAG_ONE                         0x00010000UL
+#define PDUPOOL_HEAD(old, block)                ((((old) + PDUPOOL_TAG_ONE) & PDUPOOL_TAG_MASK) | (uint32)(block))
+
+/** @brief End of a free list */
+#define PDUPOOL_NO_BLOCK                        0xFFFFU
+
+/* End of each class in the storage (bytes) and first block index of each class */
+#define PDUPOOL_END_64                          (64UL * PDUPOOL_BLOCKS_64)
+#define PDUPOOL_END_256                         (PDUPOOL_END_64 + (256UL * PDUPOOL_BLOCKS_256))
+#define PDUPOOL_END_1536                        (PDUPOOL_END_256 + (1536UL * PDUPOOL_BLOCKS_1536))
+#define PDUPOOL_END_4096                        (PDUPOOL_END_1536 + (4096UL * PDUPOOL_BLOCKS_4096))
+
+#define PDUPOOL_FIRST_256                       (PDUPOOL_BLOCKS_64)
+#define PDUPOOL_FIRST_1536                      (PDUPOOL_FIRST_256 + PDUPOOL_BLOCKS_256)
+#define PDUPOOL_FIRST_4096                      (PDUPOOL_FIRST_1536 + PDUPOOL_BLOCKS_1536)
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct PduPool_ClassType
+ * @brief Layout of one size class in the storage
+ */
+typedef struct
+{
+    uint32 offset;                              /**< First byte in PduPool_Storage */
+    uint32 end;                                 /**< Byte behind the last block */
+    uint16 block_size;                          /**< Bytes per block */
+    uint16 first;                               /**< Index of the first block */
+    uint16 count;                               /**< PDUPOOL_BLOCKS_* */
+} PduPool_ClassType;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+STATIC const PduPool_ClassType PduPool_Class[PDUPOOL_CLASS_COUNT] =
+{
+    { 0UL,              PDUPOOL_END_64,   64U,   0U,                          PDUPOOL_BLOCKS_64   },
+    { PDUPOOL_END_64,   PDUPOOL_END_256,  256U,  (uint16)PDUPOOL_FIRST_256,   PDUPOOL_BLOCKS_256  },
+    { PDUPOOL_END_256,  PDUPOOL_END_1536, 1536U, (uint16)PDUPOOL_FIRST_1536,  PDUPOOL_BLOCKS_1536 },
+    { PDUPOOL_END_1536, PDUPOOL_END_4096, 4096U, (uint16)PDUPOOL_FIRST_4096,  PDUPOOL_BLOCKS_4096 }
+};
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after PduPool_Init() */
+STATIC boolean PduPool_Initialized = FALSE;
+
+STATIC VAR_SECTION(PDUPOOL_SECTION) uint8 PduPool_Storage[PDUPOOL_STORAGE_SIZE] ALIGNED(32);
+
+/** @brief Free list head of each class (tag, first free block) */
+STATIC volatile uint32 PduPool_FreeHead[PDUPOOL_CLASS_COUNT];
+
+/** @brief Successor of each free block in its free list */
+STATIC volatile uint16 PduPool_Next[PDUPOOL_BLOCK_COUNT];
+
+/** @brief References of each block, 0 while free */
+STATIC volatile uint32 PduPool_RefCount[PDUPOOL_BLOCK_COUNT];
+
+/* Statistics of each class */
+STATIC volatile uint32 PduPool_InUse[PDUPOOL_CLASS_COUNT];
+STATIC volatile uint32 PduPool_HighWatermark[PDUPOOL_CLASS_COUNT];
+STATIC volatile uint32 PduPool_Allocations[PDUPOOL_CLASS_COUNT];
+STATIC volatile uint32 PduPool_Fallbacks[PDUPOOL_CLASS_COUNT];
+STATIC volatile uint32 PduPool_Failures[PDUPOOL_CLASS_COUNT];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Atomically add to a counter
+ * @return New value
+ */
+STATIC uint32 PduPool_Add(volatile uint32 *Counter, uint32 Delta)
+{
+    uint32 value;
+
+    do
+    {
+        value = *Counter;
+    } while (Os_Port_CompareAndSwap(Counter, value, value + Delta) == FALSE);
+
+    return value + Delta;
+}
+
+/**
+ * @brief Atomically decrement a counter that is not 0
+ */
+STATIC void PduPool_Decrement(volatile uint32 *Counter)
+{
+    uint32 value;
+
+    do
+    {
+        value = *Counter;
+    } while ((value != 0UL) && (Os_Port_CompareAndSwap(Counter, value, value - 1UL) == FALSE));
+}
+
+/**
+ * @brief Atomically raise a maximum to Value
+ */
+STATIC void PduPool_Max(volatile uint32 *Maximum, uint32 Value)
+{
+    uint32 value;
+
+    do
+    {
+        value = *Maximum;
+    } while ((Value > value) && (Os_Port_CompareAndSwap(Maximum, value, Value) == FALSE));
+}
+
+/**
+ * @brief Take the first block of the free list of a class
+ * @return Block index, or PDUPOOL_NO_BLOCK if the class is exhausted
+ */
+STATIC uint16 PduPool_Pop(uint8 Class)
+{
+    volatile uint32 *head = &PduPool_FreeHead[Class];
+    uint32 old;
+    uint32 block;
+
+    do
+    {
+        old = *head;
+        block = old & PDUPOOL_INDEX_MASK;
+        if (block == PDUPOOL_NO_BLOCK)
+        {
+            return PDUPOOL_NO_BLOCK;
+        }
+        /* A stale successor (block popped meanwhile) fails on the changed tag */
+    } while (Os_Port_CompareAndSwap(head, old, PDUPOOL_HEAD(old, PduPool_Next[block])) == FALSE);
+
+    return (uint16)block;
+}
+
+/**
+ * @brief Put a block in front of the free list of its class
+ */
+STATIC void PduPool_Push(uint8 Class, uint16 Block)
+{
+    volatile uint32 *head = &PduPool_FreeHead[Class];
+    uint32 old;
+
+    do
+    {
+        old = *head;
+        PduPool_Next[Block] = (uint16)(old & PDUPOOL_INDEX_MASK);
+    } while (Os_Port_CompareAndSwap(head, old, PDUPOOL_HEAD(old, Block)) == FALSE);
+}
+
+/**
+ * @brief Class and index of the block at a data pointer
+ * @return Block index, or PDUPOOL_NO_BLOCK if Block is not the start of a block
+ */
+STATIC uint16 PduPool_BlockOf(uint8 ApiId, P2CONST(uint8, AUTOMATIC, PDUPOOL_APPL_DATA) Block,
+    P2VAR(uint8, AUTOMATIC, AUTOMATIC) ClassPtr)
+{
+    P2CONST(PduPool_ClassType, AUTOMATIC, PDUPOOL_CONST) class_cfg;
+    uint32 offset;
+    uint8 c = 0U;
+
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (PduPool_Initialized == FALSE)
+    {
+        PDUPOOL_REPORT_ERROR(ApiId, PDUPOOL_E_UNINIT);
+        return PDUPOOL_NO_BLOCK;
+    }
+    if (Block == NULL_PTR)
+    {
+        PDUPOOL_REPORT_ERROR(ApiId, PDUPOOL_E_PARAM_POINTER);
+        return PDUPOOL_NO_BLOCK;
+    }
+    if ((Block < &PduPool_Storage[0]) || (Block >= &PduPool_Storage[PDUPOOL_STORAGE_SIZE]))
+    {
+        PDUPOOL_REPORT_ERROR(ApiId, PDUPOOL_E_INV_BLOCK);
+        return PDUPOOL_NO_BLOCK;
+    }
+
+    offset = (uint32)(Block - &PduPool_Storage[0]);
+    while (offset >= PduPool_Class[c].end)
+    {
+        c++;                                            /* Ends at the last class: offset < its end */
+    }
+    class_cfg = &PduPool_Class[c];
+    offset -= class_cfg->offset;
+    if ((offset % class_cfg->block_size) != 0UL)
+    {
+        PDUPOOL_REPORT_ERROR(ApiId, PDUPOOL_E_INV_BLOCK);
+        return PDUPOOL_NO_BLOCK;
+    }
+
+    *ClassPtr = c;
+    return (uint16)(class_cfg->first + (offset / class_cfg->block_size));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void PduPool_Init(void)
+{
+    uint8 c;
+    uint16 i;
+    uint16 block;
+    uint32 head;
+
+    PduPool_Initialized = FALSE;
+    for (c = 0U; c < PDUPOOL_CLASS_COUNT; c++)
+    {
+        /* Linked in ascending order, so a fresh pool hands out its blocks front to back */
+        head = PDUPOOL_NO_BLOCK;
+        for (i = PduPool_Class[c].count; i > 0U; i--)
+        {
+            block = (uint16)(PduPool_Class[c].first + i - 1U);
+            PduPool_Next[block] = (uint16)head;
+            PduPool_RefCount[block] = 0UL;
+            head = block;
+        }
+        PduPool_FreeHead[c] = head;
+        PduPool_InUse[c] = 0UL;
+        PduPool_HighWatermark[c] = 0UL;
+        PduPool_Allocations[c] = 0UL;
+        PduPool_Fallbacks[c] = 0UL;
+        PduPool_Failures[c] = 0UL;
+    }
+    PduPool_Initialized = TRUE;
+}
+
+P2VAR(uint8, AUTOMATIC, PDUPOOL_VAR) PduPool_Alloc(uint32 Length)
+{
+    P2CONST(PduPool_ClassType, AUTOMATIC, PDUPOOL_CONST) class_cfg;
+    uint16 block = PDUPOOL_NO_BLOCK;
+    uint8 wanted = 0U;
+    uint8 c;
+
+    if (PduPool_Initialized == FALSE)
+    {
+        PDUPOOL_REPORT_ERROR(PDUPOOL_ALLOC_API_ID, PDUPOOL_E_UNINIT);
+        return NULL_PTR;
+    }
+    if ((Length == 0UL) || (Length > PDUPOOL_MAX_LENGTH))
+    {
+        PDUPOOL_REPORT_ERROR(PDUPOOL_ALLOC_API_ID, PDUPOOL_E_INV_ARG);
+        return NULL_PTR;
+    }
+
+    while (Length > PduPool_Class[wanted].block_size)
+    {
+        wanted++;
+    }
+    for (c = wanted; c < PDUPOOL_CLASS_COUNT; c++)
+    {
+        block = PduPool_Pop(c);
+        if (block != PDUPOOL_NO_BLOCK)
+        {
+            break;
+        }
+    }
+    if (block == PDUPOOL_NO_BLOCK)
+    {
+        (void)PduPool_Add(&PduPool_Failures[wanted], 1UL);
+        return NULL_PTR;
+    }
+
+    /* The block is owned by this caller only: no other context can reach it yet */
+    PduPool_RefCount[block] = 1UL;
+    if (c != wanted)
+    {
+        (void)PduPool_Add(&PduPool_Fallbacks[c], 1UL);
+    }
+    (void)PduPool_Add(&PduPool_Allocations[c], 1UL);
+    PduPool_Max(&PduPool_HighWatermark[c], PduPool_Add(&PduPool_InUse[c], 1UL));
+
+    class_cfg = &PduPool_Class[c];
+    return &PduPool_Storage[class_cfg->offset + ((uint32)(block - class_cfg->first) * class_cfg->block_size)];
+}
+
+Std_ReturnType PduPool_Retain(P2CONST(uint8, AUTOMATIC, PDUPOOL_APPL_DATA) Block)
+{
+    uint8 c;
+    uint16 block = PduPool_BlockOf(PDUPOOL_RETAIN_API_ID, Block, &c);
+    uint32 count;
+
+    if (block == PDUPOOL_NO_BLOCK)
+    {
+        return E_NOT_OK;
+    }
+
+    do
+    {
+        count = PduPool_RefCount[block];
+        if (count == 0UL)
+        {
+            PDUPOOL_REPORT_ERROR(PDUPOOL_RETAIN_API_ID, PDUPOOL_E_INV_BLOCK);
+            return E_NOT_OK;
+        }
+    } while (Os_Port_CompareAndSwap(&PduPool_RefCount[block], count, count + 1UL) == FALSE);
+
+    return E_OK;
+}
+
+Std_ReturnType PduPool_Release(P2CONST(uint8, AUTOMATIC, PDUPOOL_APPL_DATA) Block)
+{
+    uint8 c;
+    uint16 block = PduPool_BlockOf(PDUPOOL_RELEASE_API_ID, Block, &c);
+    uint32 count;
+
+    if (block == PDUPOOL_NO_BLOCK)
+    {
+        return E_NOT_OK;
+    }
+
+    do
+    {
+        count = PduPool_RefCount[block];
+        if (count == 0UL)
+        {
+            PDUPOOL_REPORT_ERROR(PDUPOOL_RELEASE_API_ID, PDUPOOL_E_INV_BLOCK);
+            return E_NOT_OK;
+        }
+    } while (Os_Port_CompareAndSwap(&PduPool_RefCount[block], count, count - 1UL) == FALSE);
+
+    if (count == 1UL)
+    {
+        /* Last reference: no other context holds the block any more. Counted
+           out before it is free, so in_use never exceeds the blocks of the class */
+        PduPool_Decrement(&PduPool_InUse[c]);
+        PduPool_Push(c, block);
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType PduPool_GetStatistics(uint8 Class,
+    P2VAR(PduPool_StatisticsType, AUTOMATIC, PDUPOOL_APPL_DATA) StatisticsPtr)
+{
+    if (Class >= PDUPOOL_CLASS_COUNT)
+    {
+        PDUPOOL_REPORT_ERROR(PDUPOOL_GET_STATISTICS_API_ID, PDUPOOL_E_INV_ARG);
+        return E_NOT_OK;
+    }
+    if (StatisticsPtr == NULL_PTR)
+    {
+        PDUPOOL_REPORT_ERROR(PDUPOOL_GET_STATISTICS_API_ID, PDUPOOL_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    StatisticsPtr->blocks = PduPool_Class[Class].count;
+    StatisticsPtr->in_use = (uint16)PduPool_InUse[Class];
+    StatisticsPtr->high_watermark = (uint16)PduPool_HighWatermark[Class];
+    StatisticsPtr->allocations = PduPool_Allocations[Class];
+    StatisticsPtr->fallbacks = PduPool_Fallbacks[Class];
+    StatisticsPtr->failures = PduPool_Failures[Class];
+
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
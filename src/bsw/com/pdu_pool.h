@@ -0,0 +1,274 @@
+/**
+ * @file    pdu_pool.h
+ * @brief   PduPool - Fixed-Block PDU Buffer Pool with Reference Counting
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Shared buffer pool of the communication stack. Instead of every layer
+ * reserving static buffers for its own worst case (the EthTp transmit ring,
+ * the last-is-best gateway buffers of the PduR), the layers take blocks of
+ * four fixed size classes from one pool, sized for the peak the layers
+ * reach together:
+ *
+ * | Class                | Block    | Blocks                | Typical user                        |
+ * |----------------------|----------|-----------------------|-------------------------------------|
+ * | PDUPOOL_CLASS_64     | 64 B     | PDUPOOL_BLOCKS_64     | CAN / CAN-FD gateway PDUs           |
+ * | PDUPOOL_CLASS_256    | 256 B    | PDUPOOL_BLOCKS_256    | Long gateway PDUs, TP segments      |
+ * | PDUPOOL_CLASS_1536   | 1536 B   | PDUPOOL_BLOCKS_1536   | Ethernet frames (EthTp datagrams)   |
+ * | PDUPOOL_CLASS_4096   | 4096 B   | PDUPOOL_BLOCKS_4096   | Reassembled TP messages             |
+ *
+ * PduPool_Alloc() returns a block of the smallest class the length fits
+ * into; if that class is exhausted, a block of the next larger class
+ * (counted as a fallback). A block carries a reference count: the owner
+ * holds one reference, PduPool_Retain() adds one for every further user
+ * of the same data (fan-out: one block for all destinations of a routing
+ * path instead of a copy each), PduPool_Release() drops one and returns
+ * the block to its free list with the last.
+ *
+ * Implementation Notes:
+ * - Lock-free: the free lists, reference counts and statistics are only
+ *   updated with Os_Port_CompareAndSwap(), so tasks and interrupts of one
+ *   core may allocate and release concurrently without a critical section;
+ *   the free list heads carry a modification tag against ABA
+ * - The blocks are placed in PDUPOOL_SECTION, which the linker script must
+ *   map to non-cacheable RAM: EthTp hands its blocks to the GMAC DMA
+ * - Blocks are 32-byte aligned (cache line and DMA burst)
+ * - The contents of a block are undefined after PduPool_Alloc()
+ * - A block is identified by its data pointer; PduPool_Retain() and
+ *   PduPool_Release() accept only pointers returned by PduPool_Alloc()
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see pdu_pool.c
+ * @see eth_tp.h
+ * @see pdu_router.h
+ */
+
+#ifndef PDU_POOL_H
+#define PDU_POOL_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define PDUPOOL_VENDOR_ID                       43U
+#define PDUPOOL_MODULE_ID                       262U    /**< Vendor-specific CDD range */
+#define PDUPOOL_INSTANCE_ID                     0U
+
+#define PDUPOOL_SW_MAJOR_VERSION                1U
+#define PDUPOOL_SW_MINOR_VERSION                0U
+#define PDUPOOL_SW_PATCH_VERSION                0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (PDUPOOL_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "pdu_pool.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define PDUPOOL_INIT_API_ID                     0x01U
+#define PDUPOOL_ALLOC_API_ID                    0x02U
+#define PDUPOOL_RETAIN_API_ID                   0x03U
+#define PDUPOOL_RELEASE_API_ID                  0x04U
+#define PDUPOOL_GET_STATISTICS_API_ID           0x0AU
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define PDUPOOL_E_UNINIT                        0x01U   /**< PduPool_Init() not called */
+#define PDUPOOL_E_PARAM_POINTER                 0x02U   /**< NULL pointer parameter */
+#define PDUPOOL_E_INV_ARG                       0x03U   /**< Length 0 or invalid class */
+#define PDUPOOL_E_INV_BLOCK                     0x04U   /**< Not a block, or a free block */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def PDUPOOL_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef PDUPOOL_DEV_ERROR_DETECT
+    #define PDUPOOL_DEV_ERROR_DETECT            STD_ON
+#endif
+
+/**
+ * @def PDUPOOL_BLOCKS_64
+ * @brief Blocks of 64 bytes: one held per gateway path with a transmit
+ *        buffer (8), one per concurrent update or fetch
+ */
+#ifndef PDUPOOL_BLOCKS_64
+    #define PDUPOOL_BLOCKS_64                   16U
+#endif
+
+/**
+ * @def PDUPOOL_BLOCKS_256
+ * @brief Blocks of 256 bytes
+ */
+#ifndef PDUPOOL_BLOCKS_256
+    #define PDUPOOL_BLOCKS_256                  2U
+#endif
+
+/**
+ * @def PDUPOOL_BLOCKS_1536
+ * @brief Blocks of 1536 bytes: one open datagram per EthTp socket
+ *        connection (3) and as many in the DMA
+ */
+#ifndef PDUPOOL_BLOCKS_1536
+    #define PDUPOOL_BLOCKS_1536                 6U
+#endif
+
+/**
+ * @def PDUPOOL_BLOCKS_4096
+ * @brief Blocks of 4096 bytes; no user in the current configuration
+ */
+#ifndef PDUPOOL_BLOCKS_4096
+    #define PDUPOOL_BLOCKS_4096                 0U
+#endif
+
+/**
+ * @def PDUPOOL_SECTION
+ * @brief Linker section of the blocks (non-cacheable, DMA accessible)
+ */
+#ifndef PDUPOOL_SECTION
+    #define PDUPOOL_SECTION                     ".os_shared_noncacheable"
+#endif
+
+/* Configuration validation */
+#if (PDUPOOL_DEV_ERROR_DETECT != STD_ON) && (PDUPOOL_DEV_ERROR_DETECT != STD_OFF)
+    #error "PDUPOOL_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+/** @brief Blocks of all classes */
+#define PDUPOOL_BLOCK_COUNT \
+    (PDUPOOL_BLOCKS_64 + PDUPOOL_BLOCKS_256 + PDUPOOL_BLOCKS_1536 + PDUPOOL_BLOCKS_4096)
+
+#if (PDUPOOL_BLOCK_COUNT == 0U) || (PDUPOOL_BLOCK_COUNT > 4096U)
+    #error "The pool must have from 1 to 4096 blocks"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/* Size classes, ascending */
+#define PDUPOOL_CLASS_64                        0U
+#define PDUPOOL_CLASS_256                       1U
+#define PDUPOOL_CLASS_1536                      2U
+#define PDUPOOL_CLASS_4096                      3U
+#define PDUPOOL_CLASS_COUNT                     4U
+
+/** @brief Largest length PduPool_Alloc() can serve */
+#define PDUPOOL_MAX_LENGTH                      4096U
+
+/** @brief Bytes of the blocks of all classes */
+#define PDUPOOL_STORAGE_SIZE \
+    ((64UL * PDUPOOL_BLOCKS_64) + (256UL * PDUPOOL_BLOCKS_256) + \
+     (1536UL * PDUPOOL_BLOCKS_1536) + (4096UL * PDUPOOL_BLOCKS_4096))
+
+/**
+ * @struct PduPool_StatisticsType
+ * @brief Usage of one size class since PduPool_Init()
+ */
+typedef struct
+{
+    uint16 blocks;                      /**< Configured blocks */
+    uint16 in_use;                      /**< Blocks currently allocated */
+    uint16 high_watermark;              /**< Most blocks allocated at once */
+    uint32 allocations;                 /**< Blocks handed out */
+    uint32 fallbacks;                   /**< Allocations served here because the smaller class was empty */
+    uint32 failures;                    /**< Allocations of this class no class could serve */
+} PduPool_StatisticsType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Put all blocks on the free lists of their classes and clear the statistics
+ *
+ * @serviceID PDUPOOL_INIT_API_ID (0x01)
+ * @reentrancy Non-Reentrant
+ * @note Called before the users of the pool are initialized
+ */
+extern void PduPool_Init(void);
+
+/**
+ * @brief Allocate a block of at least Length bytes with one reference
+ * @param[in] Length Bytes needed, 1 to PDUPOOL_MAX_LENGTH
+ * @return Block, or NULL_PTR if no block of a fitting class is free
+ *
+ * @serviceID PDUPOOL_ALLOC_API_ID (0x02)
+ * @reentrancy Reentrant
+ */
+extern P2VAR(uint8, AUTOMATIC, PDUPOOL_VAR) PduPool_Alloc(uint32 Length);
+
+/**
+ * @brief Add a reference to an allocated block
+ * @param[in] Block Block returned by PduPool_Alloc()
+ * @return E_OK, or E_NOT_OK if Block is not an allocated block
+ *
+ * @serviceID PDUPOOL_RETAIN_API_ID (0x03)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType PduPool_Retain(P2CONST(uint8, AUTOMATIC, PDUPOOL_APPL_DATA) Block);
+
+/**
+ * @brief Drop a reference; the last one returns the block to the pool
+ * @param[in] Block Block returned by PduPool_Alloc()
+ * @return E_OK, or E_NOT_OK if Block is not an allocated block
+ *
+ * @serviceID PDUPOOL_RELEASE_API_ID (0x04)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType PduPool_Release(P2CONST(uint8, AUTOMATIC, PDUPOOL_APPL_DATA) Block);
+
+/**
+ * @brief Copy the usage of a size class
+ * @param[in]  Class         PDUPOOL_CLASS_*
+ * @param[out] StatisticsPtr Destination
+ * @return E_OK, or E_NOT_OK on an invalid class or a NULL pointer
+ *
+ * @serviceID PDUPOOL_GET_STATISTICS_API_ID (0x0A)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType PduPool_GetStatistics(uint8 Class,
+    P2VAR(PduPool_StatisticsType, AUTOMATIC, PDUPOOL_APPL_DATA) StatisticsPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PDU_POOL_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
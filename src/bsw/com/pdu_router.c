@@ -0,0 +1,719 @@
+/**
+ * @file    pdu_router.c
+ * @brief   PduR - PDU Router between COM, Dcm, CanIf, CanTp, SoAd and EthComm
+ * @version 1.4.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Routing services of pdu_router.h. Every service indexes the generated
+ * tables with its handle and then walks the destinations of one routing
+ * path:
+ *
+ * | Service                        | Lookup                                           |
+ * |--------------------------------|--------------------------------------------------|
+ * | PduR_<Lo>RxIndication()        | PduR_RoutingPath[RxPduId] -> destinations        |
+ * | PduR_ComTransmit()             | PduR_RoutingPath[TxPduId] -> destinations        |
+ * | PduR_ComTransmitBatch()        | PduR_RoutingPath[TxPduIds[i]] -> destinations -> |
+ * |                                | PduR_TxController, counting sort                 |
+ * | PduR_<Lo>TriggerTransmit()     | PduR_DestPdu[TxPduId] -> transmit buffer or COM  |
+ * | PduR_<Lo>TxConfirmation()      | PduR_DestPdu[TxPduId] -> upper module of source  |
+ * | PduR_DcmTransmit()             | PduR_RoutingPath[TxPduId] -> CanTp destination   |
+ * | PduR_CanTp<Rx service>()       | PduR_RoutingPath[id] -> Dcm destination          |
+ * | PduR_CanTp<Tx service>()       | PduR_DestPdu[id] -> Dcm source                   |
+ *
+ * Implementation Notes:
+ * - The PduInfoType of the caller is handed to every PDUR_DIRECT and upper
+ *   destination unchanged. PDUR_TRIGGERTRANSMIT destinations are given a
+ *   PduInfoType with the length only (SduDataPtr NULL_PTR)
+ * - A gateway path copies the payload once into a new PduPool block before
+ *   any destination is called, outside of the critical section, and then
+ *   swaps it with the block of its transmit buffer under
+ *   PDUR_ENTER_CRITICAL(). PduR_<Lo>TriggerTransmit() takes a reference to
+ *   the current block under the section and copies from it outside: the
+ *   section covers a pointer swap, not a copy of up to PduRPduMaxLength
+ * - EthComm is a lower module with PDUR_DIRECT destinations only, so the
+ *   CAN-FD payload reaches EthComm_Transmit() without a copy in the PduR
+ * - PduR_ComTransmitBatch() sorts the destinations of at most
+ *   PDUR_TX_BATCH_SIZE per round into stack arrays: one counting pass, one
+ *   placing pass (stable, so the PDUs of a controller keep the COM order)
+ *   and one <Lo>_TransmitBatch() call per controller with destinations
+ * - The TP services only translate the handle: CanTp hands its segment
+ *   buffer to Dcm_CopyTxData() / Dcm_CopyRxData() through the PduR
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | EthComm gateway destinations       |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Dcm / CanTp TP routing             |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | PduR_ComTransmitBatch()            |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Transmit buffers in PduPool blocks |
+ *
+ * @see pdu_router.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "pdu_router.h"
+#include "pdu_pool.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define PDUR_C_VENDOR_ID                        43U
+#define PDUR_C_SW_MAJOR_VERSION                 1U
+#define PDUR_C_SW_MINOR_VERSION                 4U
+#define PDUR_C_SW_PATCH_VERSION                 0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (PDUR_C_VENDOR_ID != PDUR_VENDOR_ID)
+    #error "pdu_router.c and pdu_router.h have different vendor IDs"
+#endif
+
+#if ((PDUR_C_SW_MAJOR_VERSION != PDUR_SW_MAJOR_VERSION) || \
+     (PDUR_C_SW_MINOR_VERSION != PDUR_SW_MINOR_VERSION) || \
+     (PDUR_C_SW_PATCH_VERSION != PDUR_SW_PATCH_VERSION))
+    #error "Software version mismatch between pdu_router.c and pdu_router.h"
+#endif
+
+#if (PDUR_TX_BATCH_SIZE < PDUR_MAX_FAN_OUT)
+    #error "PDUR_TX_BATCH_SIZE must hold the destinations of the largest routing path (PDUR_MAX_FAN_OUT)"
+#endif
+
+#if (PDUR_MAX_TX_BUFFER_LENGTH > PDUPOOL_MAX_LENGTH)
+    #error "A PduRPduMaxLength exceeds the largest PduPool block (PDUPOOL_MAX_LENGTH)"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (PDUR_DEV_ERROR_DETECT == STD_ON)
+    #define PDUR_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(PDUR_MODULE_ID, PDUR_INSTANCE_ID, (api), (err)))
+#else
+    #define PDUR_REPORT_ERROR(api, err)         ((void)0)
+#endif
+
+#ifndef PDUR_ENTER_CRITICAL
+    #define PDUR_ENTER_CRITICAL(key)            ((key) = Os_Port_DisableInterrupts())
+    #define PDUR_EXIT_CRITICAL(key)             Os_Port_RestoreInterrupts(key)
+#endif
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after PduR_Init() */
+STATIC boolean PduR_Initialized = FALSE;
+
+/** @brief PduPool block with the PDU of each transmit buffer, NULL_PTR while empty */
+STATIC P2VAR(uint8, AUTOMATIC, PDUR_VAR) PduR_TxBlock[PDUR_TX_BUFFER_COUNT];
+
+/** @brief Length of the PDU in each transmit buffer */
+STATIC PduLengthType PduR_TxBufferLength[PDUR_TX_BUFFER_COUNT];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Check the source handle of a routing path
+ */
+STATIC boolean PduR_CheckPath(uint8 ApiId, uint8 Module, PduIdType SrcPduId)
+{
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (PduR_Initialized == FALSE)
+    {
+        PDUR_REPORT_ERROR(ApiId, PDUR_E_UNINIT);
+        return FALSE;
+    }
+    if ((SrcPduId >= PDUR_ROUTING_PATH_COUNT) || (PduR_RoutingPath[SrcPduId].src_module != Module))
+    {
+        PDUR_REPORT_ERROR(ApiId, PDUR_E_PDU_ID_INVALID);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Check the source handle and payload of PduR_<Lo>RxIndication / PduR_<Up>Transmit
+ */
+STATIC boolean PduR_CheckSource(uint8 ApiId, uint8 Module, PduIdType SrcPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (PduR_CheckPath(ApiId, Module, SrcPduId) == FALSE)
+    {
+        return FALSE;
+    }
+    if ((PduInfoPtr == NULL_PTR) ||
+        ((PduInfoPtr->SduDataPtr == NULL_PTR) && (PduR_BswModule[Module].transmit != NULL_PTR)))
+    {
+        PDUR_REPORT_ERROR(ApiId, PDUR_E_PARAM_POINTER);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Check the destination handle of PduR_<Lo>TriggerTransmit / PduR_<Lo>TxConfirmation
+ */
+STATIC boolean PduR_CheckDest(uint8 ApiId, uint8 Module, PduIdType DestPduId)
+{
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (PduR_Initialized == FALSE)
+    {
+        PDUR_REPORT_ERROR(ApiId, PDUR_E_UNINIT);
+        return FALSE;
+    }
+    if ((DestPduId >= PDUR_DEST_PDU_COUNT) || (PduR_DestPdu[DestPduId].module != Module))
+    {
+        PDUR_REPORT_ERROR(ApiId, PDUR_E_PDU_ID_INVALID);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Hand a PDU to every destination of its routing path
+ * @return E_OK if at least one destination accepted the PDU
+ */
+STATIC Std_ReturnType PduR_Route(PduIdType SrcPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(PduR_RoutingPathType, AUTOMATIC, PDUR_CONST) path = &PduR_RoutingPath[SrcPduId];
+    PduInfoType announce;
+    Std_ReturnType result = E_NOT_OK;
+    boolean buffered = TRUE;
+    uint16 index;
+    uint16 last;
+
+    announce.SduDataPtr = NULL_PTR;
+    announce.MetaDataPtr = PduInfoPtr->MetaDataPtr;
+    announce.SduLength = PduInfoPtr->SduLength;
+
+    if (path->tx_buffer != PDUR_NO_TX_BUFFER)
+    {
+        P2CONST(PduR_TxBufferType, AUTOMATIC, PDUR_CONST) buffer = &PduR_TxBuffer[path->tx_buffer];
+        PduLengthType length = (PduInfoPtr->SduLength < buffer->max_length) ?
+                               PduInfoPtr->SduLength : buffer->max_length;
+        P2VAR(uint8, AUTOMATIC, PDUR_VAR) block = PduPool_Alloc(buffer->max_length);
+        P2VAR(uint8, AUTOMATIC, PDUR_VAR) previous;
+        uint32 key;
+
+        if (block != NULL_PTR)
+        {
+            (void)memcpy(block, PduInfoPtr->SduDataPtr, length);
+            PDUR_ENTER_CRITICAL(key);
+            previous = PduR_TxBlock[path->tx_buffer];
+            PduR_TxBlock[path->tx_buffer] = block;
+            PduR_TxBufferLength[path->tx_buffer] = length;
+            PDUR_EXIT_CRITICAL(key);
+            if (previous != NULL_PTR)
+            {
+                (void)PduPool_Release(previous);
+            }
+        }
+        else
+        {
+            buffered = FALSE;                           /* Pool exhausted: counted by PduPool */
+        }
+        announce.SduLength = length;
+    }
+
+    last = path->dest_first + path->dest_count;
+    for (index = path->dest_first; index < last; index++)
+    {
+        P2CONST(PduR_DestType, AUTOMATIC, PDUR_CONST) dest = &PduR_DestPdu[index];
+        P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) module = &PduR_BswModule[dest->module];
+
+        if (module->rx_indication != NULL_PTR)
+        {
+            module->rx_indication(dest->module_pdu, PduInfoPtr);
+            result = E_OK;
+        }
+        else if ((dest->provision == (uint8)PDUR_TRIGGERTRANSMIT) && (buffered == FALSE))
+        {
+            /* Nothing to fetch: the destination is not triggered */
+        }
+        else if (module->transmit(dest->module_pdu,
+                     (dest->provision == (uint8)PDUR_DIRECT) ? PduInfoPtr : &announce) == E_OK)
+        {
+            result = E_OK;
+        }
+        else
+        {
+            /* Destination busy: the other destinations are still served */
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Hand the destinations of COM PDUs to their controllers, one call per controller
+ * @note The PDUs have at most PDUR_TX_BATCH_SIZE destinations together
+ * @return E_OK if every destination accepted its PDU
+ */
+STATIC Std_ReturnType PduR_TransmitRound(P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count)
+{
+    uint16 start[PDUR_TX_CONTROLLER_COUNT + 1U];
+    uint16 fill[PDUR_TX_CONTROLLER_COUNT];
+    PduIdType ids[PDUR_TX_BATCH_SIZE];
+    PduInfoType infos[PDUR_TX_BATCH_SIZE];
+    Std_ReturnType result = E_OK;
+    uint16 i;
+    uint16 k;
+    uint16 index;
+    uint16 last;
+    uint8 c;
+
+    (void)memset(start, 0, sizeof(start));
+    for (i = 0U; i < Count; i++)
+    {
+        last = PduR_RoutingPath[TxPduIds[i]].dest_first + PduR_RoutingPath[TxPduIds[i]].dest_count;
+        for (index = PduR_RoutingPath[TxPduIds[i]].dest_first; index < last; index++)
+        {
+            if (PduR_DestPdu[index].controller != PDUR_NO_TX_CONTROLLER)
+            {
+                start[PduR_DestPdu[index].controller + 1U]++;
+            }
+        }
+    }
+    for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+    {
+        start[c + 1U] += start[c];
+        fill[c] = start[c];
+    }
+
+    for (i = 0U; i < Count; i++)
+    {
+        last = PduR_RoutingPath[TxPduIds[i]].dest_first + PduR_RoutingPath[TxPduIds[i]].dest_count;
+        for (index = PduR_RoutingPath[TxPduIds[i]].dest_first; index < last; index++)
+        {
+            P2CONST(PduR_DestType, AUTOMATIC, PDUR_CONST) dest = &PduR_DestPdu[index];
+
+            if (dest->controller == PDUR_NO_TX_CONTROLLER)
+            {
+                PduR_BswModule[dest->module].rx_indication(dest->module_pdu, &PduInfos[i]);
+            }
+            else
+            {
+                k = fill[dest->controller];
+                fill[dest->controller]++;
+                ids[k] = dest->module_pdu;
+                infos[k] = PduInfos[i];
+                if (dest->provision == (uint8)PDUR_TRIGGERTRANSMIT)
+                {
+                    infos[k].SduDataPtr = NULL_PTR;
+                }
+            }
+        }
+    }
+
+    for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+    {
+        P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) module = &PduR_BswModule[PduR_TxController[c].module];
+
+        if (start[c + 1U] == start[c])
+        {
+            continue;
+        }
+        if (module->transmit_batch != NULL_PTR)
+        {
+            if (module->transmit_batch(PduR_TxController[c].controller, &ids[start[c]], &infos[start[c]],
+                                       (uint16)(start[c + 1U] - start[c])) != E_OK)
+            {
+                result = E_NOT_OK;
+            }
+        }
+        else
+        {
+            for (k = start[c]; k < start[c + 1U]; k++)
+            {
+                if (module->transmit(ids[k], &infos[k]) != E_OK)
+                {
+                    result = E_NOT_OK;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Copy the payload of a PDUR_TRIGGERTRANSMIT destination
+ */
+STATIC Std_ReturnType PduR_TriggerTransmit(uint8 Module, PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(PduR_RoutingPathType, AUTOMATIC, PDUR_CONST) path;
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) source;
+    Std_ReturnType result = E_NOT_OK;
+
+    if (PduR_CheckDest(PDUR_TRIGGER_TRANSMIT_API_ID, Module, TxPduId) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR))
+    {
+        PDUR_REPORT_ERROR(PDUR_TRIGGER_TRANSMIT_API_ID, PDUR_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    path = &PduR_RoutingPath[PduR_DestPdu[TxPduId].path];
+    if (path->tx_buffer != PDUR_NO_TX_BUFFER)
+    {
+        P2VAR(uint8, AUTOMATIC, PDUR_VAR) block = NULL_PTR;
+        PduLengthType length;
+        uint32 key;
+
+        /* The reference keeps the block valid if a new PDU replaces it during the copy */
+        PDUR_ENTER_CRITICAL(key);
+        length = PduR_TxBufferLength[path->tx_buffer];
+        if ((PduR_TxBlock[path->tx_buffer] != NULL_PTR) && (length <= PduInfoPtr->SduLength))
+        {
+            block = PduR_TxBlock[path->tx_buffer];
+            (void)PduPool_Retain(block);
+        }
+        PDUR_EXIT_CRITICAL(key);
+
+        if (block != NULL_PTR)
+        {
+            (void)memcpy(PduInfoPtr->SduDataPtr, block, length);
+            PduInfoPtr->SduLength = length;
+            (void)PduPool_Release(block);
+            result = E_OK;
+        }
+    }
+    else
+    {
+        source = &PduR_BswModule[path->src_module];
+        if (source->trigger_transmit != NULL_PTR)
+        {
+            result = source->trigger_transmit(path->src_pdu, PduInfoPtr);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Forward the confirmation of a destination to the upper module of its source
+ */
+STATIC void PduR_TxConfirmation(uint8 Module, PduIdType TxPduId, Std_ReturnType Result)
+{
+    P2CONST(PduR_RoutingPathType, AUTOMATIC, PDUR_CONST) path;
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) source;
+
+    if (PduR_CheckDest(PDUR_TX_CONFIRMATION_API_ID, Module, TxPduId) == FALSE)
+    {
+        return;
+    }
+
+    path = &PduR_RoutingPath[PduR_DestPdu[TxPduId].path];
+    source = &PduR_BswModule[path->src_module];
+    if ((source->tx_confirmation != NULL_PTR) && (TxPduId == path->dest_first))
+    {
+        source->tx_confirmation(path->src_pdu, Result);
+    }
+}
+
+/**
+ * @brief Upper TP module and handle of the destination of a CanTp reception path
+ * @return Upper module interface, NULL_PTR if the handle is invalid
+ */
+STATIC P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) PduR_TpRxUpper(uint8 ApiId, PduIdType id,
+    P2VAR(PduIdType, AUTOMATIC, AUTOMATIC) UpperPduId)
+{
+    P2CONST(PduR_DestType, AUTOMATIC, PDUR_CONST) dest;
+
+    if (PduR_CheckPath(ApiId, PduRConf_PduRBswModule_CanTp, id) == FALSE)
+    {
+        return NULL_PTR;
+    }
+
+    dest = &PduR_DestPdu[PduR_RoutingPath[id].dest_first];
+    *UpperPduId = dest->module_pdu;
+    return &PduR_BswModule[dest->module];
+}
+
+/**
+ * @brief Upper TP module and handle of the source of a CanTp transmission path
+ * @return Upper module interface, NULL_PTR if the handle is invalid
+ */
+STATIC P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) PduR_TpTxUpper(uint8 ApiId, PduIdType id,
+    P2VAR(PduIdType, AUTOMATIC, AUTOMATIC) UpperPduId)
+{
+    P2CONST(PduR_RoutingPathType, AUTOMATIC, PDUR_CONST) path;
+
+    if (PduR_CheckDest(ApiId, PduRConf_PduRBswModule_CanTp, id) == FALSE)
+    {
+        return NULL_PTR;
+    }
+
+    path = &PduR_RoutingPath[PduR_DestPdu[id].path];
+    *UpperPduId = path->src_pdu;
+    return &PduR_BswModule[path->src_module];
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize the PDU Router
+ */
+void PduR_Init(void)
+{
+    uint16 i;
+
+    for (i = 0U; i < PDUR_TX_BUFFER_COUNT; i++)
+    {
+        if (PduR_TxBlock[i] != NULL_PTR)
+        {
+            (void)PduPool_Release(PduR_TxBlock[i]);
+            PduR_TxBlock[i] = NULL_PTR;
+        }
+        PduR_TxBufferLength[i] = 0U;
+    }
+    PduR_Initialized = TRUE;
+}
+
+/**
+ * @brief Route a PDU received by CanIf
+ */
+void PduR_CanIfRxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    if (PduR_CheckSource(PDUR_RX_INDICATION_API_ID, PduRConf_PduRBswModule_CanIf, RxPduId, PduInfoPtr) == TRUE)
+    {
+        (void)PduR_Route(RxPduId, PduInfoPtr);
+    }
+}
+
+/**
+ * @brief Route a PDU received by SoAd
+ */
+void PduR_SoAdIfRxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    if (PduR_CheckSource(PDUR_RX_INDICATION_API_ID, PduRConf_PduRBswModule_SoAd, RxPduId, PduInfoPtr) == TRUE)
+    {
+        (void)PduR_Route(RxPduId, PduInfoPtr);
+    }
+}
+
+/**
+ * @brief Transmit a PDU of COM
+ */
+Std_ReturnType PduR_ComTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    if (PduR_CheckSource(PDUR_TRANSMIT_API_ID, PduRConf_PduRBswModule_Com, TxPduId, PduInfoPtr) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    return PduR_Route(TxPduId, PduInfoPtr);
+}
+
+/**
+ * @brief Transmit several PDUs of COM, grouped by transmit controller
+ */
+Std_ReturnType PduR_ComTransmitBatch(P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count)
+{
+    Std_ReturnType result = E_OK;
+    uint32 dests = 0UL;
+    uint16 first = 0U;
+    uint16 i;
+
+    if ((TxPduIds == NULL_PTR) || (PduInfos == NULL_PTR))
+    {
+        PDUR_REPORT_ERROR(PDUR_TRANSMIT_BATCH_API_ID, PDUR_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    for (i = 0U; i < Count; i++)
+    {
+        if (PduR_CheckSource(PDUR_TRANSMIT_BATCH_API_ID, PduRConf_PduRBswModule_Com, TxPduIds[i],
+                             &PduInfos[i]) == FALSE)
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    /* Rounds of at most PDUR_TX_BATCH_SIZE destinations */
+    for (i = 0U; i < Count; i++)
+    {
+        if ((dests + PduR_RoutingPath[TxPduIds[i]].dest_count) > PDUR_TX_BATCH_SIZE)
+        {
+            if (PduR_TransmitRound(&TxPduIds[first], &PduInfos[first], (uint16)(i - first)) != E_OK)
+            {
+                result = E_NOT_OK;
+            }
+            first = i;
+            dests = 0UL;
+        }
+        dests += PduR_RoutingPath[TxPduIds[i]].dest_count;
+    }
+    if ((first < Count) && (PduR_TransmitRound(&TxPduIds[first], &PduInfos[first],
+                                               (uint16)(Count - first)) != E_OK))
+    {
+        result = E_NOT_OK;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Transmit a TP PDU of Dcm
+ */
+Std_ReturnType PduR_DcmTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    if (PduR_CheckSource(PDUR_TRANSMIT_API_ID, PduRConf_PduRBswModule_Dcm, TxPduId, PduInfoPtr) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    return PduR_Route(TxPduId, PduInfoPtr);
+}
+
+/**
+ * @brief Start of a TP reception by CanTp
+ */
+BufReq_ReturnType PduR_CanTpStartOfReception(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info, PduLengthType TpSduLength,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr)
+{
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) upper;
+    PduIdType upper_pdu = 0U;
+
+    upper = PduR_TpRxUpper(PDUR_START_OF_RECEPTION_API_ID, id, &upper_pdu);
+    if (upper == NULL_PTR)
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    return upper->start_of_reception(upper_pdu, info, TpSduLength, bufferSizePtr);
+}
+
+/**
+ * @brief Copy received TP data of CanTp to the upper module
+ */
+BufReq_ReturnType PduR_CanTpCopyRxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr)
+{
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) upper;
+    PduIdType upper_pdu = 0U;
+
+    upper = PduR_TpRxUpper(PDUR_COPY_RX_DATA_API_ID, id, &upper_pdu);
+    if (upper == NULL_PTR)
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    return upper->copy_rx_data(upper_pdu, info, bufferSizePtr);
+}
+
+/**
+ * @brief End of a TP reception by CanTp
+ */
+void PduR_CanTpRxIndication(PduIdType id, Std_ReturnType result)
+{
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) upper;
+    PduIdType upper_pdu = 0U;
+
+    upper = PduR_TpRxUpper(PDUR_TP_RX_INDICATION_API_ID, id, &upper_pdu);
+    if (upper != NULL_PTR)
+    {
+        upper->tp_rx_indication(upper_pdu, result);
+    }
+}
+
+/**
+ * @brief Copy TP data of the upper module into a segment of CanTp
+ */
+BufReq_ReturnType PduR_CanTpCopyTxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2CONST(RetryInfoType, AUTOMATIC, PDUR_APPL_DATA) retry,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) availableDataPtr)
+{
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) upper;
+    PduIdType upper_pdu = 0U;
+
+    upper = PduR_TpTxUpper(PDUR_COPY_TX_DATA_API_ID, id, &upper_pdu);
+    if (upper == NULL_PTR)
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    return upper->copy_tx_data(upper_pdu, info, retry, availableDataPtr);
+}
+
+/**
+ * @brief End of a TP transmission by CanTp
+ */
+void PduR_CanTpTxConfirmation(PduIdType id, Std_ReturnType result)
+{
+    P2CONST(PduR_BswModuleType, AUTOMATIC, PDUR_CONST) upper;
+    PduIdType upper_pdu = 0U;
+
+    upper = PduR_TpTxUpper(PDUR_TP_TX_CONFIRMATION_API_ID, id, &upper_pdu);
+    if (upper != NULL_PTR)
+    {
+        upper->tp_tx_confirmation(upper_pdu, result);
+    }
+}
+
+/**
+ * @brief Copy the payload of a PDUR_TRIGGERTRANSMIT destination of CanIf
+ */
+Std_ReturnType PduR_CanIfTriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    return PduR_TriggerTransmit(PduRConf_PduRBswModule_CanIf, TxPduId, PduInfoPtr);
+}
+
+/**
+ * @brief Copy the payload of a PDUR_TRIGGERTRANSMIT destination of SoAd
+ */
+Std_ReturnType PduR_SoAdIfTriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr)
+{
+    return PduR_TriggerTransmit(PduRConf_PduRBswModule_SoAd, TxPduId, PduInfoPtr);
+}
+
+/**
+ * @brief Transmission of a destination PDU by CanIf finished
+ */
+void PduR_CanIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result)
+{
+    PduR_TxConfirmation(PduRConf_PduRBswModule_CanIf, TxPduId, result);
+}
+
+/**
+ * @brief Transmission of a destination PDU by SoAd finished
+ */
+void PduR_SoAdIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result)
+{
+    PduR_TxConfirmation(PduRConf_PduRBswModule_SoAd, TxPduId, result);
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
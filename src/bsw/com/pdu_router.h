@@ -0,0 +1,527 @@
+/**
+ * @file    pdu_router.h
+ * @brief   PduR - PDU Router between COM, Dcm, CanIf, CanTp, SoAd and EthComm
+ * @version 1.4.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * AUTOSAR PDU Router for the communication interface PDUs of the VCU: the
+ * PDUs received by COM, transmitted by COM and gatewayed between the CAN-FD
+ * buses and the Ethernet backbone, and for the diagnostic transport
+ * protocol PDUs between Dcm and CanTp, configured in
+ * config/autosar/communication/pdu_router.arxml.
+ *
+ * Routing is table driven; the tables are generated by
+ * tools/pdur/pdur_generator.py:
+ *
+ * | Table            | Indexed by                      | Entry                                  |
+ * |------------------|---------------------------------|----------------------------------------|
+ * | PduR_RoutingPath | Source handle                   | Destinations, source, transmit buffer  |
+ * |                  | (PduRConf_PduRSrcPdu_*)         |                                        |
+ * | PduR_DestPdu     | Destination handle              | Module, module handle, data provision, |
+ * |                  | (PduRConf_PduRDestPdu_*)        | routing path                           |
+ * | PduR_BswModule   | PduRConf_PduRBswModule_*        | Interface functions of the module      |
+ *
+ * Source and destination handles are dense, so a received or transmitted
+ * PDU finds its destinations with one table access, and a TriggerTransmit
+ * or TxConfirmation finds its routing path the same way, independent of
+ * the number of routing paths.
+ *
+ * Fan-out does not copy the payload per destination:
+ *
+ * | Destination                    | Payload                                               |
+ * |--------------------------------|-------------------------------------------------------|
+ * | Upper module (COM)             | PduInfoPtr of the lower layer                         |
+ * | Lower, PDUR_DIRECT             | PduInfoPtr of the source                              |
+ * | Lower, PDUR_TRIGGERTRANSMIT,   | None; fetched from COM in TriggerTransmit             |
+ * | from COM                       |                                                       |
+ * | Lower, PDUR_TRIGGERTRANSMIT,   | One copy in a PduPool block held by the path, shared  |
+ * | gateway                        | by all its PDUR_TRIGGERTRANSMIT destinations          |
+ *
+ * Gateway mode towards the Ethernet backbone: CAN-FD frames routed to
+ * EthComm (src/swc/EthernetComm) are not sent as one SoAd PDU each but
+ * aggregated into IEEE 1722 ACF-CAN frames. The routing path hands the
+ * PduInfoPtr of CanIf, i.e. the received mailbox data, to EthComm_Transmit()
+ * as a PDUR_DIRECT destination, which copies it once into the GMAC transmit
+ * buffer of its stream; EthComm flushes the frame when it is full or its
+ * flush timeout expires.
+ *
+ * Batched transmission: Com_MainFunctionTx() hands all I-PDUs due in its
+ * cycle to PduR_ComTransmitBatch() at once. The PduR sorts their
+ * destinations by transmit controller (PduR_TxController: a CAN controller
+ * of CanIf, the Ethernet controller of SoAd) with a counting sort and calls
+ * <Lo>_TransmitBatch() once per controller, so the lower module takes its
+ * lock and fills its controller once per cycle instead of once per PDU.
+ * Lower modules without a batched transmit get one <Lo>_Transmit() per PDU,
+ * still grouped by controller.
+ *
+ * Transport protocol (TP) routing paths connect one upper and one lower TP
+ * module 1:1. The PduR does not buffer TP data: PduR_CanTp<Service>() calls
+ * the same service of Dcm with the Dcm handle, so CanTp copies the segments
+ * straight from and into the Dcm buffers.
+ *
+ * Implementation Notes:
+ * - No TP gateway and no TP fan-out; a TP routing path has exactly one
+ *   PDUR_DIRECT destination
+ * - Transmit buffers have a depth of one PDU (last is best); a PDU received
+ *   before the previous one was fetched replaces it
+ * - A gateway path takes a new block from the PDU buffer pool for every
+ *   received PDU and releases the previous one; a TriggerTransmit holds a
+ *   reference while it copies, so it never reads a block being replaced.
+ *   If the pool is exhausted, the PDU is not routed to the
+ *   PDUR_TRIGGERTRANSMIT destinations. PduPool_Init() precedes PduR_Init()
+ * - The upper module of a multicast path is confirmed by the first
+ *   destination of the path
+ * - PduR_<Module>Transmit() returns E_OK if at least one destination
+ *   accepted the PDU
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Direct-index routing tables        |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Gateway to EthComm ACF-CAN frames  |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Dcm / CanTp transport protocol     |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Batched COM transmit per controller|
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Gateway buffers from the PduPool   |
+ *
+ * @see pdu_router.c
+ * @see pdur_cfg.h
+ * @see EthernetComm.h
+ * @see can_tp.h
+ * @see pdu_pool.h
+ */
+
+#ifndef PDU_ROUTER_H
+#define PDU_ROUTER_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define PDUR_VENDOR_ID                          43U
+#define PDUR_MODULE_ID                          51U     /**< AUTOSAR PduR */
+#define PDUR_INSTANCE_ID                        0U
+
+#define PDUR_SW_MAJOR_VERSION                   1U
+#define PDUR_SW_MINOR_VERSION                   4U
+#define PDUR_SW_PATCH_VERSION                   0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (PDUR_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "pdu_router.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define PDUR_INIT_API_ID                        0xF0U
+#define PDUR_TX_CONFIRMATION_API_ID             0x40U   /**< PduR_<Lo>TxConfirmation */
+#define PDUR_TRIGGER_TRANSMIT_API_ID            0x41U   /**< PduR_<Lo>TriggerTransmit */
+#define PDUR_RX_INDICATION_API_ID               0x42U   /**< PduR_<Lo>RxIndication */
+#define PDUR_COPY_TX_DATA_API_ID                0x43U   /**< PduR_<Lo>CopyTxData */
+#define PDUR_COPY_RX_DATA_API_ID                0x44U   /**< PduR_<Lo>CopyRxData */
+#define PDUR_TP_RX_INDICATION_API_ID            0x45U   /**< PduR_<Lo>TpRxIndication */
+#define PDUR_START_OF_RECEPTION_API_ID          0x46U   /**< PduR_<Lo>StartOfReception */
+#define PDUR_TP_TX_CONFIRMATION_API_ID          0x48U   /**< PduR_<Lo>TpTxConfirmation */
+#define PDUR_TRANSMIT_API_ID                    0x49U   /**< PduR_<Up>Transmit */
+#define PDUR_TRANSMIT_BATCH_API_ID              0x80U   /**< Vendor-specific: PduR_ComTransmitBatch */
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define PDUR_E_UNINIT                           0x01U   /**< PduR_Init() not called */
+#define PDUR_E_PDU_ID_INVALID                   0x02U   /**< Handle out of range or of another module */
+#define PDUR_E_PARAM_POINTER                    0x09U   /**< NULL pointer parameter */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def PDUR_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef PDUR_DEV_ERROR_DETECT
+    #define PDUR_DEV_ERROR_DETECT               STD_ON
+#endif
+
+/**
+ * @def PDUR_TX_BATCH_SIZE
+ * @brief Destinations sorted at once by PduR_ComTransmitBatch() (stack
+ *        arrays); a larger batch is routed in several rounds, each with one
+ *        <Lo>_TransmitBatch() call per controller
+ */
+#ifndef PDUR_TX_BATCH_SIZE
+    #define PDUR_TX_BATCH_SIZE                  32U
+#endif
+
+/* Configuration validation */
+#if (PDUR_DEV_ERROR_DETECT != STD_ON) && (PDUR_DEV_ERROR_DETECT != STD_OFF)
+    #error "PDUR_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (PDUR_TX_BATCH_SIZE < 1U) || (PDUR_TX_BATCH_SIZE > 0xFFFFU)
+    #error "PDUR_TX_BATCH_SIZE must be 1 .. 0xFFFF"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @enum PduR_DataProvisionType
+ * @brief How a lower destination gets the payload (PduRDestPduDataProvision)
+ */
+typedef enum
+{
+    PDUR_DIRECT = 0x00U,                /**< Passed with <Lo>_Transmit() */
+    PDUR_TRIGGERTRANSMIT = 0x01U        /**< Fetched by the lower module with PduR_<Lo>TriggerTransmit() */
+} PduR_DataProvisionType;
+
+/** @brief PduR_RoutingPathType.tx_buffer of a path without transmit buffer */
+#define PDUR_NO_TX_BUFFER                       0xFFFFU
+
+/** @brief <Lo>_Transmit() of a lower module */
+typedef Std_ReturnType (*PduR_TransmitFctType)(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/** @brief PduR_DestType.controller of an upper or TP destination */
+#define PDUR_NO_TX_CONTROLLER                   0xFFU
+
+/** @brief <Lo>_TransmitBatch() of a lower module: PDUs of one controller */
+typedef Std_ReturnType (*PduR_TransmitBatchFctType)(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count);
+
+/** @brief <Up>_RxIndication() of an upper module */
+typedef void (*PduR_RxIndicationFctType)(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/** @brief <Up>_TriggerTransmit() of an upper module */
+typedef Std_ReturnType (*PduR_TriggerTransmitFctType)(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/** @brief <Up>_TxConfirmation() of an upper module */
+typedef void (*PduR_TxConfirmationFctType)(PduIdType TxPduId, Std_ReturnType result);
+
+/** @brief <Up>_StartOfReception() of an upper TP module */
+typedef BufReq_ReturnType (*PduR_StartOfReceptionFctType)(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info, PduLengthType TpSduLength,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+
+/** @brief <Up>_CopyRxData() of an upper TP module */
+typedef BufReq_ReturnType (*PduR_CopyRxDataFctType)(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+
+/** @brief <Up>_TpRxIndication() of an upper TP module */
+typedef void (*PduR_TpRxIndicationFctType)(PduIdType id, Std_ReturnType result);
+
+/** @brief <Up>_CopyTxData() of an upper TP module */
+typedef BufReq_ReturnType (*PduR_CopyTxDataFctType)(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2CONST(RetryInfoType, AUTOMATIC, PDUR_APPL_DATA) retry,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) availableDataPtr);
+
+/** @brief <Up>_TpTxConfirmation() of an upper TP module */
+typedef void (*PduR_TpTxConfirmationFctType)(PduIdType id, Std_ReturnType result);
+
+/**
+ * @struct PduR_BswModuleType
+ * @brief Interface of a module at one end of the routing paths (generated, PduRBswModules)
+ */
+typedef struct
+{
+    PduR_TransmitFctType transmit;                      /**< Lower module, NULL_PTR for upper */
+    PduR_TransmitBatchFctType transmit_batch;           /**< Lower IF module, NULL_PTR if not supported */
+    PduR_RxIndicationFctType rx_indication;             /**< Upper IF module, else NULL_PTR */
+    PduR_TriggerTransmitFctType trigger_transmit;       /**< Upper IF module, NULL_PTR if not used */
+    PduR_TxConfirmationFctType tx_confirmation;         /**< Upper IF module, NULL_PTR if not used */
+    PduR_StartOfReceptionFctType start_of_reception;    /**< Upper TP module, else NULL_PTR */
+    PduR_CopyRxDataFctType copy_rx_data;                /**< Upper TP module, else NULL_PTR */
+    PduR_TpRxIndicationFctType tp_rx_indication;        /**< Upper TP module, else NULL_PTR */
+    PduR_CopyTxDataFctType copy_tx_data;                /**< Upper TP module, else NULL_PTR */
+    PduR_TpTxConfirmationFctType tp_tx_confirmation;    /**< Upper TP module, else NULL_PTR */
+} PduR_BswModuleType;
+
+/**
+ * @struct PduR_TxBufferType
+ * @brief Transmit buffer of a gateway path (generated, PduRTxBuffer); the
+ *        PDU itself is held in a PduPool block
+ */
+typedef struct
+{
+    PduLengthType max_length;                           /**< PduRPduMaxLength */
+} PduR_TxBufferType;
+
+/**
+ * @struct PduR_TxControllerType
+ * @brief Bus controller of lower interface destinations (generated)
+ */
+typedef struct
+{
+    uint8 module;                                       /**< PduRConf_PduRBswModule_* of the lower module */
+    uint8 controller;                                   /**< Controller in the module (CanIfCtrlId, 0) */
+} PduR_TxControllerType;
+
+/**
+ * @struct PduR_RoutingPathType
+ * @brief Routing path of one source PDU (generated, PduRRoutingPath)
+ */
+typedef struct
+{
+    uint16 dest_first;                                  /**< First destination in PduR_DestPdu */
+    PduIdType src_pdu;                                  /**< Handle of the source PDU in its module */
+    uint8 src_module;                                   /**< PduRConf_PduRBswModule_* of the source */
+    uint8 dest_count;                                   /**< Consecutive destinations from dest_first */
+    uint16 tx_buffer;                                   /**< PduR_TxBuffer, or PDUR_NO_TX_BUFFER */
+} PduR_RoutingPathType;
+
+/**
+ * @struct PduR_DestType
+ * @brief Destination PDU of a routing path (generated, PduRDestPdu)
+ */
+typedef struct
+{
+    PduIdType module_pdu;                               /**< Handle of the PDU in the destination module */
+    PduIdType path;                                     /**< Routing path (source handle) */
+    uint8 module;                                       /**< PduRConf_PduRBswModule_* */
+    uint8 provision;                                    /**< PduR_DataProvisionType */
+    uint8 controller;                                   /**< PduR_TxController, or PDUR_NO_TX_CONTROLLER */
+} PduR_DestType;
+
+#include "pdur_cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief Module interfaces, indexed by PduRConf_PduRBswModule_* */
+extern const PduR_BswModuleType PduR_BswModule[PDUR_BSW_MODULE_COUNT];
+
+/** @brief Transmit buffers of the gateway paths */
+extern const PduR_TxBufferType PduR_TxBuffer[PDUR_TX_BUFFER_COUNT];
+
+/** @brief Transmit controllers, indexed by PduRConf_PduRTxController_* */
+extern const PduR_TxControllerType PduR_TxController[PDUR_TX_CONTROLLER_COUNT];
+
+/** @brief Routing paths, indexed by PduRConf_PduRSrcPdu_* */
+extern const PduR_RoutingPathType PduR_RoutingPath[PDUR_ROUTING_PATH_COUNT];
+
+/** @brief Destinations, indexed by PduRConf_PduRDestPdu_* */
+extern const PduR_DestType PduR_DestPdu[PDUR_DEST_PDU_COUNT];
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize the PDU Router; the transmit buffers are emptied
+ *
+ * @serviceID PDUR_INIT_API_ID (0xF0)
+ * @reentrancy Non-Reentrant
+ */
+extern void PduR_Init(void);
+
+/**
+ * @brief Route a PDU received by CanIf to the destinations of its routing path
+ * @param[in] RxPduId    Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in] PduInfoPtr Payload; passed on without copy except into a transmit buffer
+ *
+ * @serviceID PDUR_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_CanIfRxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Route a PDU received by SoAd to the destinations of its routing path
+ * @param[in] RxPduId    Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in] PduInfoPtr Payload; passed on without copy except into a transmit buffer
+ *
+ * @serviceID PDUR_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_SoAdIfRxIndication(PduIdType RxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Transmit a PDU of COM to the destinations of its routing path
+ * @param[in] TxPduId    Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in] PduInfoPtr Payload for PDUR_DIRECT destinations; SduDataPtr may
+ *                       be NULL_PTR if all destinations use PDUR_TRIGGERTRANSMIT
+ * @return E_OK if at least one destination accepted the PDU, else E_NOT_OK
+ *
+ * @serviceID PDUR_TRANSMIT_API_ID (0x49)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern Std_ReturnType PduR_ComTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Transmit several PDUs of COM, grouped by transmit controller
+ * @param[in] TxPduIds Source handles (PduRConf_PduRSrcPdu_*)
+ * @param[in] PduInfos Payload of each PDU, as for PduR_ComTransmit()
+ * @param[in] Count    Number of PDUs
+ * @return E_OK if every destination accepted its PDU, else E_NOT_OK
+ * @note The PDUs of one controller keep their order in TxPduIds
+ *
+ * @serviceID PDUR_TRANSMIT_BATCH_API_ID (0x80)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType PduR_ComTransmitBatch(P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count);
+
+/**
+ * @brief Transmit a TP PDU of Dcm to the TP module of its routing path
+ * @param[in] TxPduId    Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in] PduInfoPtr SduLength: total length; the data is fetched with CopyTxData
+ * @return E_OK if the TP module accepted the request, else E_NOT_OK
+ *
+ * @serviceID PDUR_TRANSMIT_API_ID (0x49)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern Std_ReturnType PduR_DcmTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Start of a TP reception by CanTp, forwarded to the upper TP module
+ * @param[in]  id            Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in]  info          Data of the first frame, may be NULL_PTR
+ * @param[in]  TpSduLength   Total length of the N-SDU
+ * @param[out] bufferSizePtr Receives the buffer space of the upper module
+ * @return Result of the upper module, BUFREQ_E_NOT_OK on invalid parameters
+ *
+ * @serviceID PDUR_START_OF_RECEPTION_API_ID (0x46)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern BufReq_ReturnType PduR_CanTpStartOfReception(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info, PduLengthType TpSduLength,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+
+/**
+ * @brief Copy received TP data of CanTp into the upper TP module
+ * @param[in]  id            Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in]  info          Data to copy; SduLength 0 only queries the buffer space
+ * @param[out] bufferSizePtr Receives the remaining buffer space
+ * @return Result of the upper module, BUFREQ_E_NOT_OK on invalid parameters
+ *
+ * @serviceID PDUR_COPY_RX_DATA_API_ID (0x44)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern BufReq_ReturnType PduR_CanTpCopyRxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+
+/**
+ * @brief End of a TP reception by CanTp
+ * @param[in] id     Source handle (PduRConf_PduRSrcPdu_*)
+ * @param[in] result E_OK if the N-SDU was received completely
+ *
+ * @serviceID PDUR_TP_RX_INDICATION_API_ID (0x45)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_CanTpRxIndication(PduIdType id, Std_ReturnType result);
+
+/**
+ * @brief Copy TP data of the upper TP module into a segment of CanTp
+ * @param[in]  id               Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[in]  info             Destination of the data and its length
+ * @param[in]  retry            Retry information, NULL_PTR if not used
+ * @param[out] availableDataPtr Receives the data remaining in the upper module
+ * @return Result of the upper module, BUFREQ_E_NOT_OK on invalid parameters
+ *
+ * @serviceID PDUR_COPY_TX_DATA_API_ID (0x43)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern BufReq_ReturnType PduR_CanTpCopyTxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2CONST(RetryInfoType, AUTOMATIC, PDUR_APPL_DATA) retry,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) availableDataPtr);
+
+/**
+ * @brief End of a TP transmission by CanTp
+ * @param[in] id     Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[in] result E_OK if the N-SDU was transmitted completely
+ *
+ * @serviceID PDUR_TP_TX_CONFIRMATION_API_ID (0x48)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_CanTpTxConfirmation(PduIdType id, Std_ReturnType result);
+
+/**
+ * @brief Copy the payload of a PDUR_TRIGGERTRANSMIT destination of CanIf
+ * @param[in]    TxPduId    Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[inout] PduInfoPtr SduDataPtr: destination; SduLength: in the
+ *                          capacity, out the PDU length
+ * @return E_OK, or E_NOT_OK if there is no PDU or it does not fit
+ *
+ * @serviceID PDUR_TRIGGER_TRANSMIT_API_ID (0x41)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern Std_ReturnType PduR_CanIfTriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Copy the payload of a PDUR_TRIGGERTRANSMIT destination of SoAd
+ * @param[in]    TxPduId    Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[inout] PduInfoPtr SduDataPtr: destination; SduLength: in the
+ *                          capacity, out the PDU length
+ * @return E_OK, or E_NOT_OK if there is no PDU or it does not fit
+ *
+ * @serviceID PDUR_TRIGGER_TRANSMIT_API_ID (0x41)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern Std_ReturnType PduR_SoAdIfTriggerTransmit(PduIdType TxPduId,
+    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Transmission of a destination PDU by CanIf finished
+ * @param[in] TxPduId Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[in] result  E_OK if transmitted
+ *
+ * @serviceID PDUR_TX_CONFIRMATION_API_ID (0x40)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_CanIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result);
+
+/**
+ * @brief Transmission of a destination PDU by SoAd finished
+ * @param[in] TxPduId Destination handle (PduRConf_PduRDestPdu_*)
+ * @param[in] result  E_OK if transmitted
+ *
+ * @serviceID PDUR_TX_CONFIRMATION_API_ID (0x40)
+ * @reentrancy Reentrant for different PDUs
+ */
+extern void PduR_SoAdIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PDU_ROUTER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
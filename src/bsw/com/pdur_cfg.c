@@ -0,0 +1,575 @@
+/**
+ * @file    pdur_cfg.c
+ * @brief   PduR Configuration - Routing Tables
+ * @version 1.4.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static PduR configuration of the VCU: module interfaces, transmit
+ * buffer lengths of the gateway paths, routing table and destination table.
+ *
+ * @note Generated by tools/pdur/pdur_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "pdu_router.h"
+#include "com_stack.h"
+#include "can_tp.h"
+
+/*==================================================================================================
+*                                        MODULE INTERFACES
+==================================================================================================*/
+
+extern Std_ReturnType CanIf_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+extern Std_ReturnType CanIf_TransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count);
+extern Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+extern Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller,
+    P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count);
+extern Std_ReturnType EthComm_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);
+extern BufReq_ReturnType Dcm_StartOfReception(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info, PduLengthType TpSduLength,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+extern BufReq_ReturnType Dcm_CopyRxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);
+extern void Dcm_TpRxIndication(PduIdType id, Std_ReturnType result);
+extern BufReq_ReturnType Dcm_CopyTxData(PduIdType id,
+    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,
+    P2CONST(RetryInfoType, AUTOMATIC, PDUR_APPL_DATA) retry,
+    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) availableDataPtr);
+extern void Dcm_TpTxConfirmation(PduIdType id, Std_ReturnType result);
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const PduR_BswModuleType PduR_BswModule[PDUR_BSW_MODULE_COUNT] =
+{
+    {   /* Com */
+        NULL_PTR, NULL_PTR, Com_RxIndication, Com_TriggerTransmit, NULL_PTR,
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    },
+    {   /* CanIf */
+        CanIf_Transmit, CanIf_TransmitBatch, NULL_PTR, NULL_PTR, NULL_PTR,
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    },
+    {   /* SoAd */
+        SoAd_IfTransmit, SoAd_IfTransmitBatch, NULL_PTR, NULL_PTR, NULL_PTR,
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    },
+    {   /* EthComm */
+        EthComm_Transmit, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR,
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    },
+    {   /* Dcm */
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR,
+        Dcm_StartOfReception, Dcm_CopyRxData, Dcm_TpRxIndication, Dcm_CopyTxData, Dcm_TpTxConfirmation
+    },
+    {   /* CanTp */
+        CanTp_Transmit, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR,
+        NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    }
+};
+
+const PduR_TxBufferType PduR_TxBuffer[PDUR_TX_BUFFER_COUNT] =
+{
+    { 8U },  /* TXBUF_ESP_WheelSpeeds */
+    { 8U },  /* TXBUF_GwPt_200 */
+    { 8U },  /* TXBUF_GwPt_210 */
+    { 64U },  /* TXBUF_GwPt_220 */
+    { 24U },  /* TXBUF_GwPt_230 */
+    { 16U },  /* TXBUF_GwCh_280 */
+    { 16U },  /* TXBUF_GwCh_290 */
+    { 12U }   /* TXBUF_GwCh_2A0 */
+};
+
+const PduR_RoutingPathType PduR_RoutingPath[PDUR_ROUTING_PATH_COUNT] =
+{
+    { 0U,    0U,    PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* BMS_PackStatus */
+    { 2U,    1U,    PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* BMS_CellVoltages1 */
+    { 3U,    2U,    PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* BMS_CellVoltages2 */
+    { 4U,    3U,    PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* BMS_CellVoltages3 */
+    { 5U,    4U,    PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* BMS_CellTemps */
+    { 6U,    5U,    PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* MCU_Status */
+    { 8U,    6U,    PduRConf_PduRBswModule_CanIf,   3U,  0U },  /* ESP_WheelSpeeds */
+    { 11U,   7U,    PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* ESP_Dynamics */
+    { 13U,   8U,    PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* SAS_Steering */
+    { 15U,   9U,    PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* APS_Pedals */
+    { 16U,   10U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GW_VehicleInfo */
+    { 17U,   11U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* OBC_Status */
+    { 18U,   12U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* DCDC_Status */
+    { 19U,   13U,   PduRConf_PduRBswModule_Com,     2U,  PDUR_NO_TX_BUFFER },  /* VCU_TorqueRequest */
+    { 21U,   14U,   PduRConf_PduRBswModule_Com,     2U,  PDUR_NO_TX_BUFFER },  /* VCU_Status */
+    { 23U,   15U,   PduRConf_PduRBswModule_Com,     1U,  PDUR_NO_TX_BUFFER },  /* VCU_PowertrainData */
+    { 24U,   16U,   PduRConf_PduRBswModule_Com,     1U,  PDUR_NO_TX_BUFFER },  /* VCU_PowertrainDataMot */
+    { 25U,   17U,   PduRConf_PduRBswModule_Com,     1U,  PDUR_NO_TX_BUFFER },  /* VCU_ChargeControl */
+    { 26U,   18U,   PduRConf_PduRBswModule_Com,     1U,  PDUR_NO_TX_BUFFER },  /* VCU_ThermalRequest */
+    { 27U,   19U,   PduRConf_PduRBswModule_Com,     1U,  PDUR_NO_TX_BUFFER },  /* VCU_DcdcControl */
+    { 28U,   13U,   PduRConf_PduRBswModule_CanIf,   2U,  1U },  /* GwPt_200 */
+    { 30U,   14U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_201 */
+    { 31U,   15U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_202 */
+    { 32U,   16U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_203 */
+    { 33U,   17U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_204 */
+    { 34U,   18U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_205 */
+    { 35U,   19U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_206 */
+    { 36U,   20U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_207 */
+    { 37U,   21U,   PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwPt_208 */
+    { 39U,   22U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_209 */
+    { 40U,   23U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20A */
+    { 41U,   24U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20B */
+    { 42U,   25U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20C */
+    { 43U,   26U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20D */
+    { 44U,   27U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20E */
+    { 45U,   28U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_20F */
+    { 46U,   29U,   PduRConf_PduRBswModule_CanIf,   2U,  2U },  /* GwPt_210 */
+    { 48U,   30U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_211 */
+    { 49U,   31U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_212 */
+    { 50U,   32U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_213 */
+    { 51U,   33U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_214 */
+    { 52U,   34U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_215 */
+    { 53U,   35U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_216 */
+    { 54U,   36U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_217 */
+    { 55U,   37U,   PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwPt_218 */
+    { 57U,   38U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_219 */
+    { 58U,   39U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21A */
+    { 59U,   40U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21B */
+    { 60U,   41U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21C */
+    { 61U,   42U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21D */
+    { 62U,   43U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21E */
+    { 63U,   44U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_21F */
+    { 64U,   45U,   PduRConf_PduRBswModule_CanIf,   2U,  3U },  /* GwPt_220 */
+    { 66U,   46U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_221 */
+    { 67U,   47U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_222 */
+    { 68U,   48U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_223 */
+    { 69U,   49U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_224 */
+    { 70U,   50U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_225 */
+    { 71U,   51U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_226 */
+    { 72U,   52U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_227 */
+    { 73U,   53U,   PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwPt_228 */
+    { 75U,   54U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_229 */
+    { 76U,   55U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22A */
+    { 77U,   56U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22B */
+    { 78U,   57U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22C */
+    { 79U,   58U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22D */
+    { 80U,   59U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22E */
+    { 81U,   60U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_22F */
+    { 82U,   61U,   PduRConf_PduRBswModule_CanIf,   2U,  4U },  /* GwPt_230 */
+    { 84U,   62U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_231 */
+    { 85U,   63U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_232 */
+    { 86U,   64U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_233 */
+    { 87U,   65U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_234 */
+    { 88U,   66U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_235 */
+    { 89U,   67U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_236 */
+    { 90U,   68U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_237 */
+    { 91U,   69U,   PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwPt_238 */
+    { 93U,   70U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_239 */
+    { 94U,   71U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23A */
+    { 95U,   72U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23B */
+    { 96U,   73U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23C */
+    { 97U,   74U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23D */
+    { 98U,   75U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23E */
+    { 99U,   76U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwPt_23F */
+    { 100U,  77U,   PduRConf_PduRBswModule_CanIf,   2U,  5U },  /* GwCh_280 */
+    { 102U,  78U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_281 */
+    { 103U,  79U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_282 */
+    { 104U,  80U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_283 */
+    { 105U,  81U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_284 */
+    { 106U,  82U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_285 */
+    { 107U,  83U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_286 */
+    { 108U,  84U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_287 */
+    { 109U,  85U,   PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwCh_288 */
+    { 111U,  86U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_289 */
+    { 112U,  87U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28A */
+    { 113U,  88U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28B */
+    { 114U,  89U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28C */
+    { 115U,  90U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28D */
+    { 116U,  91U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28E */
+    { 117U,  92U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_28F */
+    { 118U,  93U,   PduRConf_PduRBswModule_CanIf,   2U,  6U },  /* GwCh_290 */
+    { 120U,  94U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_291 */
+    { 121U,  95U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_292 */
+    { 122U,  96U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_293 */
+    { 123U,  97U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_294 */
+    { 124U,  98U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_295 */
+    { 125U,  99U,   PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_296 */
+    { 126U,  100U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_297 */
+    { 127U,  101U,  PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwCh_298 */
+    { 129U,  102U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_299 */
+    { 130U,  103U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29A */
+    { 131U,  104U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29B */
+    { 132U,  105U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29C */
+    { 133U,  106U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29D */
+    { 134U,  107U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29E */
+    { 135U,  108U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_29F */
+    { 136U,  109U,  PduRConf_PduRBswModule_CanIf,   2U,  7U },  /* GwCh_2A0 */
+    { 138U,  110U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A1 */
+    { 139U,  111U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A2 */
+    { 140U,  112U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A3 */
+    { 141U,  113U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A4 */
+    { 142U,  114U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A5 */
+    { 143U,  115U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A6 */
+    { 144U,  116U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A7 */
+    { 145U,  117U,  PduRConf_PduRBswModule_CanIf,   2U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A8 */
+    { 147U,  118U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2A9 */
+    { 148U,  119U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AA */
+    { 149U,  120U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AB */
+    { 150U,  121U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AC */
+    { 151U,  122U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AD */
+    { 152U,  123U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AE */
+    { 153U,  124U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwCh_2AF */
+    { 154U,  125U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_400 */
+    { 155U,  126U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_401 */
+    { 156U,  127U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_402 */
+    { 157U,  128U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_403 */
+    { 158U,  129U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_404 */
+    { 159U,  130U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_405 */
+    { 160U,  131U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_406 */
+    { 161U,  132U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_407 */
+    { 162U,  133U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_408 */
+    { 163U,  134U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_409 */
+    { 164U,  135U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40A */
+    { 165U,  136U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40B */
+    { 166U,  137U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40C */
+    { 167U,  138U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40D */
+    { 168U,  139U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40E */
+    { 169U,  140U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_40F */
+    { 170U,  141U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_410 */
+    { 171U,  142U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_411 */
+    { 172U,  143U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_412 */
+    { 173U,  144U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_413 */
+    { 174U,  145U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_414 */
+    { 175U,  146U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_415 */
+    { 176U,  147U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_416 */
+    { 177U,  148U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_417 */
+    { 178U,  149U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_418 */
+    { 179U,  150U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_419 */
+    { 180U,  151U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41A */
+    { 181U,  152U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41B */
+    { 182U,  153U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41C */
+    { 183U,  154U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41D */
+    { 184U,  155U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41E */
+    { 185U,  156U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_41F */
+    { 186U,  157U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_420 */
+    { 187U,  158U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_421 */
+    { 188U,  159U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_422 */
+    { 189U,  160U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_423 */
+    { 190U,  161U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_424 */
+    { 191U,  162U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_425 */
+    { 192U,  163U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_426 */
+    { 193U,  164U,  PduRConf_PduRBswModule_CanIf,   1U,  PDUR_NO_TX_BUFFER },  /* GwBd_427 */
+    { 194U,  0U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_500 */
+    { 195U,  1U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_501 */
+    { 196U,  2U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_502 */
+    { 197U,  3U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_503 */
+    { 198U,  4U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_504 */
+    { 199U,  5U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_505 */
+    { 200U,  6U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_506 */
+    { 201U,  7U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_507 */
+    { 202U,  8U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_508 */
+    { 203U,  9U,    PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_509 */
+    { 204U,  10U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50A */
+    { 205U,  11U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50B */
+    { 206U,  12U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50C */
+    { 207U,  13U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50D */
+    { 208U,  14U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50E */
+    { 209U,  15U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_PT_50F */
+    { 210U,  16U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_540 */
+    { 211U,  17U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_541 */
+    { 212U,  18U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_542 */
+    { 213U,  19U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_543 */
+    { 214U,  20U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_544 */
+    { 215U,  21U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_545 */
+    { 216U,  22U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_546 */
+    { 217U,  23U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_547 */
+    { 218U,  24U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_548 */
+    { 219U,  25U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_549 */
+    { 220U,  26U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_54A */
+    { 221U,  27U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_CH_54B */
+    { 222U,  28U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_580 */
+    { 223U,  29U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_581 */
+    { 224U,  30U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_582 */
+    { 225U,  31U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_583 */
+    { 226U,  32U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_584 */
+    { 227U,  33U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_585 */
+    { 228U,  34U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_586 */
+    { 229U,  35U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_587 */
+    { 230U,  36U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_588 */
+    { 231U,  37U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_589 */
+    { 232U,  38U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_58A */
+    { 233U,  39U,   PduRConf_PduRBswModule_SoAd,    1U,  PDUR_NO_TX_BUFFER },  /* GwEth_BD_58B */
+    { 234U,  0U,    PduRConf_PduRBswModule_CanTp,   1U,  PDUR_NO_TX_BUFFER },  /* UDS_PT_PhysReq */
+    { 235U,  1U,    PduRConf_PduRBswModule_CanTp,   1U,  PDUR_NO_TX_BUFFER },  /* UDS_CH_PhysReq */
+    { 236U,  2U,    PduRConf_PduRBswModule_CanTp,   1U,  PDUR_NO_TX_BUFFER },  /* UDS_BD_PhysReq */
+    { 237U,  3U,    PduRConf_PduRBswModule_CanTp,   1U,  PDUR_NO_TX_BUFFER },  /* UDS_FuncReq */
+    { 238U,  0U,    PduRConf_PduRBswModule_Dcm,     1U,  PDUR_NO_TX_BUFFER },  /* UDS_PT_Resp */
+    { 239U,  1U,    PduRConf_PduRBswModule_Dcm,     1U,  PDUR_NO_TX_BUFFER },  /* UDS_CH_Resp */
+    { 240U,  2U,    PduRConf_PduRBswModule_Dcm,     1U,  PDUR_NO_TX_BUFFER }   /* UDS_BD_Resp */
+};
+
+const PduR_TxControllerType PduR_TxController[PDUR_TX_CONTROLLER_COUNT] =
+{
+    { PduRConf_PduRBswModule_CanIf,   0U },  /* CAN_PT */
+    { PduRConf_PduRBswModule_CanIf,   1U },  /* CAN_CH */
+    { PduRConf_PduRBswModule_CanIf,   2U },  /* CAN_BD */
+    { PduRConf_PduRBswModule_SoAd,    0U },  /* SoAd */
+    { PduRConf_PduRBswModule_EthComm, 0U }   /* EthComm */
+};
+
+const PduR_DestType PduR_DestPdu[PDUR_DEST_PDU_COUNT] =
+{
+    { 0U,    0U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* BMS_PackStatus_Com */
+    { 0U,    0U,    PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_SoAd    },  /* BMS_PackStatus_Eth */
+    { 1U,    1U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* BMS_CellVoltages1_Com */
+    { 2U,    2U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* BMS_CellVoltages2_Com */
+    { 3U,    3U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* BMS_CellVoltages3_Com */
+    { 4U,    4U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* BMS_CellTemps_Com */
+    { 5U,    5U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* MCU_Status_Com */
+    { 1U,    5U,    PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_SoAd    },  /* MCU_Status_Eth */
+    { 6U,    6U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* ESP_WheelSpeeds_Com */
+    { 2U,    6U,    PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_SoAd    },  /* ESP_WheelSpeeds_Eth */
+    { 0U,    6U,    PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_BD  },  /* ESP_WheelSpeeds_BD */
+    { 7U,    7U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* ESP_Dynamics_Com */
+    { 3U,    7U,    PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_SoAd    },  /* ESP_Dynamics_Eth */
+    { 8U,    8U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* SAS_Steering_Com */
+    { 4U,    8U,    PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_SoAd    },  /* SAS_Steering_Eth */
+    { 9U,    9U,    PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* APS_Pedals_Com */
+    { 10U,   10U,   PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* GW_VehicleInfo_Com */
+    { 11U,   11U,   PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* OBC_Status_Com */
+    { 12U,   12U,   PduRConf_PduRBswModule_Com,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* DCDC_Status_Com */
+    { 1U,    13U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* VCU_TorqueRequest_CanIf */
+    { 5U,    13U,   PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_SoAd    },  /* VCU_TorqueRequest_Eth */
+    { 2U,    14U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_CH  },  /* VCU_Status_CanIf */
+    { 6U,    14U,   PduRConf_PduRBswModule_SoAd,    (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_SoAd    },  /* VCU_Status_Eth */
+    { 3U,    15U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* VCU_PowertrainData_CanIf */
+    { 4U,    16U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* VCU_PowertrainDataMot_CanIf */
+    { 5U,    17U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* VCU_ChargeControl_CanIf */
+    { 6U,    18U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_BD  },  /* VCU_ThermalRequest_CanIf */
+    { 7U,    19U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* VCU_DcdcControl_CanIf */
+    { 0U,    20U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_200_Acf */
+    { 8U,    20U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_CH  },  /* GwPt_200_CH */
+    { 1U,    21U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_201_Acf */
+    { 2U,    22U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_202_Acf */
+    { 3U,    23U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_203_Acf */
+    { 4U,    24U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_204_Acf */
+    { 5U,    25U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_205_Acf */
+    { 6U,    26U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_206_Acf */
+    { 7U,    27U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_207_Acf */
+    { 8U,    28U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_208_Acf */
+    { 9U,    28U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwPt_208_CH */
+    { 9U,    29U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_209_Acf */
+    { 10U,   30U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20A_Acf */
+    { 11U,   31U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20B_Acf */
+    { 12U,   32U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20C_Acf */
+    { 13U,   33U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20D_Acf */
+    { 14U,   34U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20E_Acf */
+    { 15U,   35U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_20F_Acf */
+    { 16U,   36U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_210_Acf */
+    { 10U,   36U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_CH  },  /* GwPt_210_CH */
+    { 17U,   37U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_211_Acf */
+    { 18U,   38U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_212_Acf */
+    { 19U,   39U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_213_Acf */
+    { 20U,   40U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_214_Acf */
+    { 21U,   41U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_215_Acf */
+    { 22U,   42U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_216_Acf */
+    { 23U,   43U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_217_Acf */
+    { 24U,   44U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_218_Acf */
+    { 11U,   44U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwPt_218_CH */
+    { 25U,   45U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_219_Acf */
+    { 26U,   46U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21A_Acf */
+    { 27U,   47U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21B_Acf */
+    { 28U,   48U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21C_Acf */
+    { 29U,   49U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21D_Acf */
+    { 30U,   50U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21E_Acf */
+    { 31U,   51U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_21F_Acf */
+    { 32U,   52U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_220_Acf */
+    { 12U,   52U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_CH  },  /* GwPt_220_CH */
+    { 33U,   53U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_221_Acf */
+    { 34U,   54U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_222_Acf */
+    { 35U,   55U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_223_Acf */
+    { 36U,   56U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_224_Acf */
+    { 37U,   57U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_225_Acf */
+    { 38U,   58U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_226_Acf */
+    { 39U,   59U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_227_Acf */
+    { 40U,   60U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_228_Acf */
+    { 13U,   60U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwPt_228_CH */
+    { 41U,   61U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_229_Acf */
+    { 42U,   62U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22A_Acf */
+    { 43U,   63U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22B_Acf */
+    { 44U,   64U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22C_Acf */
+    { 45U,   65U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22D_Acf */
+    { 46U,   66U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22E_Acf */
+    { 47U,   67U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_22F_Acf */
+    { 48U,   68U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_230_Acf */
+    { 14U,   68U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_CH  },  /* GwPt_230_CH */
+    { 49U,   69U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_231_Acf */
+    { 50U,   70U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_232_Acf */
+    { 51U,   71U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_233_Acf */
+    { 52U,   72U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_234_Acf */
+    { 53U,   73U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_235_Acf */
+    { 54U,   74U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_236_Acf */
+    { 55U,   75U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_237_Acf */
+    { 56U,   76U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_238_Acf */
+    { 15U,   76U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwPt_238_CH */
+    { 57U,   77U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_239_Acf */
+    { 58U,   78U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23A_Acf */
+    { 59U,   79U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23B_Acf */
+    { 60U,   80U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23C_Acf */
+    { 61U,   81U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23D_Acf */
+    { 62U,   82U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23E_Acf */
+    { 63U,   83U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwPt_23F_Acf */
+    { 64U,   84U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_280_Acf */
+    { 16U,   84U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* GwCh_280_PT */
+    { 65U,   85U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_281_Acf */
+    { 66U,   86U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_282_Acf */
+    { 67U,   87U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_283_Acf */
+    { 68U,   88U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_284_Acf */
+    { 69U,   89U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_285_Acf */
+    { 70U,   90U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_286_Acf */
+    { 71U,   91U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_287_Acf */
+    { 72U,   92U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_288_Acf */
+    { 17U,   92U,   PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwCh_288_PT */
+    { 73U,   93U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_289_Acf */
+    { 74U,   94U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28A_Acf */
+    { 75U,   95U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28B_Acf */
+    { 76U,   96U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28C_Acf */
+    { 77U,   97U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28D_Acf */
+    { 78U,   98U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28E_Acf */
+    { 79U,   99U,   PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_28F_Acf */
+    { 80U,   100U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_290_Acf */
+    { 18U,   100U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* GwCh_290_PT */
+    { 81U,   101U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_291_Acf */
+    { 82U,   102U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_292_Acf */
+    { 83U,   103U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_293_Acf */
+    { 84U,   104U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_294_Acf */
+    { 85U,   105U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_295_Acf */
+    { 86U,   106U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_296_Acf */
+    { 87U,   107U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_297_Acf */
+    { 88U,   108U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_298_Acf */
+    { 19U,   108U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwCh_298_PT */
+    { 89U,   109U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_299_Acf */
+    { 90U,   110U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29A_Acf */
+    { 91U,   111U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29B_Acf */
+    { 92U,   112U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29C_Acf */
+    { 93U,   113U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29D_Acf */
+    { 94U,   114U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29E_Acf */
+    { 95U,   115U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_29F_Acf */
+    { 96U,   116U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A0_Acf */
+    { 20U,   116U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_TRIGGERTRANSMIT, PduRConf_PduRTxController_CAN_PT  },  /* GwCh_2A0_PT */
+    { 97U,   117U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A1_Acf */
+    { 98U,   118U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A2_Acf */
+    { 99U,   119U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A3_Acf */
+    { 100U,  120U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A4_Acf */
+    { 101U,  121U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A5_Acf */
+    { 102U,  122U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A6_Acf */
+    { 103U,  123U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A7_Acf */
+    { 104U,  124U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A8_Acf */
+    { 21U,   124U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwCh_2A8_PT */
+    { 105U,  125U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2A9_Acf */
+    { 106U,  126U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AA_Acf */
+    { 107U,  127U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AB_Acf */
+    { 108U,  128U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AC_Acf */
+    { 109U,  129U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AD_Acf */
+    { 110U,  130U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AE_Acf */
+    { 111U,  131U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwCh_2AF_Acf */
+    { 112U,  132U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_400_Acf */
+    { 113U,  133U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_401_Acf */
+    { 114U,  134U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_402_Acf */
+    { 115U,  135U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_403_Acf */
+    { 116U,  136U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_404_Acf */
+    { 117U,  137U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_405_Acf */
+    { 118U,  138U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_406_Acf */
+    { 119U,  139U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_407_Acf */
+    { 120U,  140U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_408_Acf */
+    { 121U,  141U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_409_Acf */
+    { 122U,  142U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40A_Acf */
+    { 123U,  143U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40B_Acf */
+    { 124U,  144U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40C_Acf */
+    { 125U,  145U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40D_Acf */
+    { 126U,  146U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40E_Acf */
+    { 127U,  147U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_40F_Acf */
+    { 128U,  148U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_410_Acf */
+    { 129U,  149U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_411_Acf */
+    { 130U,  150U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_412_Acf */
+    { 131U,  151U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_413_Acf */
+    { 132U,  152U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_414_Acf */
+    { 133U,  153U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_415_Acf */
+    { 134U,  154U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_416_Acf */
+    { 135U,  155U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_417_Acf */
+    { 136U,  156U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_418_Acf */
+    { 137U,  157U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_419_Acf */
+    { 138U,  158U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41A_Acf */
+    { 139U,  159U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41B_Acf */
+    { 140U,  160U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41C_Acf */
+    { 141U,  161U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41D_Acf */
+    { 142U,  162U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41E_Acf */
+    { 143U,  163U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_41F_Acf */
+    { 144U,  164U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_420_Acf */
+    { 145U,  165U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_421_Acf */
+    { 146U,  166U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_422_Acf */
+    { 147U,  167U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_423_Acf */
+    { 148U,  168U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_424_Acf */
+    { 149U,  169U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_425_Acf */
+    { 150U,  170U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_426_Acf */
+    { 151U,  171U,  PduRConf_PduRBswModule_EthComm, (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_EthComm },  /* GwBd_427_Acf */
+    { 22U,   172U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_500_Can */
+    { 23U,   173U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_501_Can */
+    { 24U,   174U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_502_Can */
+    { 25U,   175U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_503_Can */
+    { 26U,   176U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_504_Can */
+    { 27U,   177U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_505_Can */
+    { 28U,   178U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_506_Can */
+    { 29U,   179U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_507_Can */
+    { 30U,   180U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_508_Can */
+    { 31U,   181U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_509_Can */
+    { 32U,   182U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50A_Can */
+    { 33U,   183U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50B_Can */
+    { 34U,   184U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50C_Can */
+    { 35U,   185U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50D_Can */
+    { 36U,   186U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50E_Can */
+    { 37U,   187U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_PT  },  /* GwEth_PT_50F_Can */
+    { 38U,   188U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_540_Can */
+    { 39U,   189U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_541_Can */
+    { 40U,   190U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_542_Can */
+    { 41U,   191U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_543_Can */
+    { 42U,   192U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_544_Can */
+    { 43U,   193U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_545_Can */
+    { 44U,   194U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_546_Can */
+    { 45U,   195U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_547_Can */
+    { 46U,   196U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_548_Can */
+    { 47U,   197U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_549_Can */
+    { 48U,   198U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_54A_Can */
+    { 49U,   199U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_CH  },  /* GwEth_CH_54B_Can */
+    { 50U,   200U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_580_Can */
+    { 51U,   201U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_581_Can */
+    { 52U,   202U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_582_Can */
+    { 53U,   203U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_583_Can */
+    { 54U,   204U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_584_Can */
+    { 55U,   205U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_585_Can */
+    { 56U,   206U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_586_Can */
+    { 57U,   207U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_587_Can */
+    { 58U,   208U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_588_Can */
+    { 59U,   209U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_589_Can */
+    { 60U,   210U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_58A_Can */
+    { 61U,   211U,  PduRConf_PduRBswModule_CanIf,   (uint8)PDUR_DIRECT,          PduRConf_PduRTxController_CAN_BD  },  /* GwEth_BD_58B_Can */
+    { 0U,    212U,  PduRConf_PduRBswModule_Dcm,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_PT_PhysReq_Dcm */
+    { 1U,    213U,  PduRConf_PduRBswModule_Dcm,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_CH_PhysReq_Dcm */
+    { 2U,    214U,  PduRConf_PduRBswModule_Dcm,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_BD_PhysReq_Dcm */
+    { 3U,    215U,  PduRConf_PduRBswModule_Dcm,     (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_FuncReq_Dcm */
+    { 0U,    216U,  PduRConf_PduRBswModule_CanTp,   (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_PT_Resp_CanTp */
+    { 1U,    217U,  PduRConf_PduRBswModule_CanTp,   (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             },  /* UDS_CH_Resp_CanTp */
+    { 2U,    218U,  PduRConf_PduRBswModule_CanTp,   (uint8)PDUR_DIRECT,          PDUR_NO_TX_CONTROLLER             }   /* UDS_BD_Resp_CanTp */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
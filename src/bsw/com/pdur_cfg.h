@@ -0,0 +1,556 @@
+/**
+ * @file    pdur_cfg.h
+ * @brief   PduR Configuration - Routing Path and Destination Handles
+ * @version 1.4.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Handles of the routing paths and destination PDUs of the VCU PduR
+ * configuration (219 routing paths, 241 destinations, 8 transmit buffers):
+ *
+ * | Source | Destination | Data provision       | Destinations |
+ * |--------|-------------|----------------------|--------------|
+ * | CanIf  | CanIf       | PDUR_DIRECT          | 7            |
+ * | CanIf  | CanIf       | PDUR_TRIGGERTRANSMIT | 8            |
+ * | CanIf  | Com         | PDUR_DIRECT          | 13           |
+ * | CanIf  | EthComm     | PDUR_DIRECT          | 152          |
+ * | CanIf  | SoAd        | PDUR_DIRECT          | 5            |
+ * | CanTp  | Dcm         | PDUR_DIRECT          | 4            |
+ * | Com    | CanIf       | PDUR_TRIGGERTRANSMIT | 7            |
+ * | Com    | SoAd        | PDUR_TRIGGERTRANSMIT | 2            |
+ * | Dcm    | CanTp       | PDUR_DIRECT          | 3            |
+ * | SoAd   | CanIf       | PDUR_DIRECT          | 40           |
+ *
+ * Routing paths by number of destinations: 198 x 1, 20 x 2, 1 x 3.
+ *
+ * Transmit controllers (PduR_ComTransmitBatch() groups):
+ *
+ * | Controller | Module  | Destinations |
+ * |------------|---------|--------------|
+ * | CAN_PT     | CanIf   | 27           |
+ * | CAN_CH     | CanIf   | 21           |
+ * | CAN_BD     | CanIf   | 14           |
+ * | SoAd       | SoAd    | 7            |
+ * | EthComm    | EthComm | 152          |
+ *
+ * @note Generated by tools/pdur/pdur_generator.py from config/autosar/communication/com.arxml, config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef PDUR_CFG_H
+#define PDUR_CFG_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define PDUR_BSW_MODULE_COUNT                           6U
+#define PDUR_ROUTING_PATH_COUNT                         219U
+#define PDUR_DEST_PDU_COUNT                             241U
+#define PDUR_TX_BUFFER_COUNT                            8U
+#define PDUR_TX_CONTROLLER_COUNT                        5U
+#define PDUR_MAX_FAN_OUT                                3U
+#define PDUR_MAX_TX_BUFFER_LENGTH                       64U
+
+/* ===============================================================================================
+ *                                          BSW MODULES
+ * =============================================================================================== */
+
+#define PduRConf_PduRBswModule_Com                      0U
+#define PduRConf_PduRBswModule_CanIf                    1U
+#define PduRConf_PduRBswModule_SoAd                     2U
+#define PduRConf_PduRBswModule_EthComm                  3U
+#define PduRConf_PduRBswModule_Dcm                      4U
+#define PduRConf_PduRBswModule_CanTp                    5U
+
+/* ===============================================================================================
+ *                                      TRANSMIT CONTROLLERS
+ * =============================================================================================== */
+
+#define PduRConf_PduRTxController_CAN_PT                0U
+#define PduRConf_PduRTxController_CAN_CH                1U
+#define PduRConf_PduRTxController_CAN_BD                2U
+#define PduRConf_PduRTxController_SoAd                  3U
+#define PduRConf_PduRTxController_EthComm               4U
+
+/* ===============================================================================================
+ *             SOURCE PDU HANDLES (PduR_<Module>RxIndication / PduR_<Module>Transmit)
+ * =============================================================================================== */
+
+#define PduRConf_PduRSrcPdu_BMS_PackStatus              0U
+#define PduRConf_PduRSrcPdu_BMS_CellVoltages1           1U
+#define PduRConf_PduRSrcPdu_BMS_CellVoltages2           2U
+#define PduRConf_PduRSrcPdu_BMS_CellVoltages3           3U
+#define PduRConf_PduRSrcPdu_BMS_CellTemps               4U
+#define PduRConf_PduRSrcPdu_MCU_Status                  5U
+#define PduRConf_PduRSrcPdu_ESP_WheelSpeeds             6U
+#define PduRConf_PduRSrcPdu_ESP_Dynamics                7U
+#define PduRConf_PduRSrcPdu_SAS_Steering                8U
+#define PduRConf_PduRSrcPdu_APS_Pedals                  9U
+#define PduRConf_PduRSrcPdu_GW_VehicleInfo              10U
+#define PduRConf_PduRSrcPdu_OBC_Status                  11U
+#define PduRConf_PduRSrcPdu_DCDC_Status                 12U
+#define PduRConf_PduRSrcPdu_VCU_TorqueRequest           13U
+#define PduRConf_PduRSrcPdu_VCU_Status                  14U
+#define PduRConf_PduRSrcPdu_VCU_PowertrainData          15U
+#define PduRConf_PduRSrcPdu_VCU_PowertrainDataMot       16U
+#define PduRConf_PduRSrcPdu_VCU_ChargeControl           17U
+#define PduRConf_PduRSrcPdu_VCU_ThermalRequest          18U
+#define PduRConf_PduRSrcPdu_VCU_DcdcControl             19U
+#define PduRConf_PduRSrcPdu_GwPt_200                    20U
+#define PduRConf_PduRSrcPdu_GwPt_201                    21U
+#define PduRConf_PduRSrcPdu_GwPt_202                    22U
+#define PduRConf_PduRSrcPdu_GwPt_203                    23U
+#define PduRConf_PduRSrcPdu_GwPt_204                    24U
+#define PduRConf_PduRSrcPdu_GwPt_205                    25U
+#define PduRConf_PduRSrcPdu_GwPt_206                    26U
+#define PduRConf_PduRSrcPdu_GwPt_207                    27U
+#define PduRConf_PduRSrcPdu_GwPt_208                    28U
+#define PduRConf_PduRSrcPdu_GwPt_209                    29U
+#define PduRConf_PduRSrcPdu_GwPt_20A                    30U
+#define PduRConf_PduRSrcPdu_GwPt_20B                    31U
+#define PduRConf_PduRSrcPdu_GwPt_20C                    32U
+#define PduRConf_PduRSrcPdu_GwPt_20D                    33U
+#define PduRConf_PduRSrcPdu_GwPt_20E                    34U
+#define PduRConf_PduRSrcPdu_GwPt_20F                    35U
+#define PduRConf_PduRSrcPdu_GwPt_210                    36U
+#define PduRConf_PduRSrcPdu_GwPt_211                    37U
+#define PduRConf_PduRSrcPdu_GwPt_212                    38U
+#define PduRConf_PduRSrcPdu_GwPt_213                    39U
+#define PduRConf_PduRSrcPdu_GwPt_214                    40U
+#define PduRConf_PduRSrcPdu_GwPt_215                    41U
+#define PduRConf_PduRSrcPdu_GwPt_216                    42U
+#define PduRConf_PduRSrcPdu_GwPt_217                    43U
+#define PduRConf_PduRSrcPdu_GwPt_218                    44U
+#define PduRConf_PduRSrcPdu_GwPt_219                    45U
+#define PduRConf_PduRSrcPdu_GwPt_21A                    46U
+#define PduRConf_PduRSrcPdu_GwPt_21B                    47U
+#define PduRConf_PduRSrcPdu_GwPt_21C                    48U
+#define PduRConf_PduRSrcPdu_GwPt_21D                    49U
+#define PduRConf_PduRSrcPdu_GwPt_21E                    50U
+#define PduRConf_PduRSrcPdu_GwPt_21F                    51U
+#define PduRConf_PduRSrcPdu_GwPt_220                    52U
+#define PduRConf_PduRSrcPdu_GwPt_221                    53U
+#define PduRConf_PduRSrcPdu_GwPt_222                    54U
+#define PduRConf_PduRSrcPdu_GwPt_223                    55U
+#define PduRConf_PduRSrcPdu_GwPt_224                    56U
+#define PduRConf_PduRSrcPdu_GwPt_225                    57U
+#define PduRConf_PduRSrcPdu_GwPt_226                    58U
+#define PduRConf_PduRSrcPdu_GwPt_227                    59U
+#define PduRConf_PduRSrcPdu_GwPt_228                    60U
+#define PduRConf_PduRSrcPdu_GwPt_229                    61U
+#define PduRConf_PduRSrcPdu_GwPt_22A                    62U
+#define PduRConf_PduRSrcPdu_GwPt_22B                    63U
+#define PduRConf_PduRSrcPdu_GwPt_22C                    64U
+#define PduRConf_PduRSrcPdu_GwPt_22D                    65U
+#define PduRConf_PduRSrcPdu_GwPt_22E                    66U
+#define PduRConf_PduRSrcPdu_GwPt_22F                    67U
+#define PduRConf_PduRSrcPdu_GwPt_230                    68U
+#define PduRConf_PduRSrcPdu_GwPt_231                    69U
+#define PduRConf_PduRSrcPdu_GwPt_232                    70U
+#define PduRConf_PduRSrcPdu_GwPt_233                    71U
+#define PduRConf_PduRSrcPdu_GwPt_234                    72U
+#define PduRConf_PduRSrcPdu_GwPt_235                    73U
+#define PduRConf_PduRSrcPdu_GwPt_236                    74U
+#define PduRConf_PduRSrcPdu_GwPt_237                    75U
+#define PduRConf_PduRSrcPdu_GwPt_238                    76U
+#define PduRConf_PduRSrcPdu_GwPt_239                    77U
+#define PduRConf_PduRSrcPdu_GwPt_23A                    78U
+#define PduRConf_PduRSrcPdu_GwPt_23B                    79U
+#define PduRConf_PduRSrcPdu_GwPt_23C                    80U
+#define PduRConf_PduRSrcPdu_GwPt_23D                    81U
+#define PduRConf_PduRSrcPdu_GwPt_23E                    82U
+#define PduRConf_PduRSrcPdu_GwPt_23F                    83U
+#define PduRConf_PduRSrcPdu_GwCh_280                    84U
+#define PduRConf_PduRSrcPdu_GwCh_281                    85U
+#define PduRConf_PduRSrcPdu_GwCh_282                    86U
+#define PduRConf_PduRSrcPdu_GwCh_283                    87U
+#define PduRConf_PduRSrcPdu_GwCh_284                    88U
+#define PduRConf_PduRSrcPdu_GwCh_285                    89U
+#define PduRConf_PduRSrcPdu_GwCh_286                    90U
+#define PduRConf_PduRSrcPdu_GwCh_287                    91U
+#define PduRConf_PduRSrcPdu_GwCh_288                    92U
+#define PduRConf_PduRSrcPdu_GwCh_289                    93U
+#define PduRConf_PduRSrcPdu_GwCh_28A                    94U
+#define PduRConf_PduRSrcPdu_GwCh_28B                    95U
+#define PduRConf_PduRSrcPdu_GwCh_28C                    96U
+#define PduRConf_PduRSrcPdu_GwCh_28D                    97U
+#define PduRConf_PduRSrcPdu_GwCh_28E                    98U
+#define PduRConf_PduRSrcPdu_GwCh_28F                    99U
+#define PduRConf_PduRSrcPdu_GwCh_290                    100U
+#define PduRConf_PduRSrcPdu_GwCh_291                    101U
+#define PduRConf_PduRSrcPdu_GwCh_292                    102U
+#define PduRConf_PduRSrcPdu_GwCh_293                    103U
+#define PduRConf_PduRSrcPdu_GwCh_294                    104U
+#define PduRConf_PduRSrcPdu_GwCh_295                    105U
+#define PduRConf_PduRSrcPdu_GwCh_296                    106U
+#define PduRConf_PduRSrcPdu_GwCh_297                    107U
+#define PduRConf_PduRSrcPdu_GwCh_298                    108U
+#define PduRConf_PduRSrcPdu_GwCh_299                    109U
+#define PduRConf_PduRSrcPdu_GwCh_29A                    110U
+#define PduRConf_PduRSrcPdu_GwCh_29B                    111U
+#define PduRConf_PduRSrcPdu_GwCh_29C                    112U
+#define PduRConf_PduRSrcPdu_GwCh_29D                    113U
+#define PduRConf_PduRSrcPdu_GwCh_29E                    114U
+#define PduRConf_PduRSrcPdu_GwCh_29F                    115U
+#define PduRConf_PduRSrcPdu_GwCh_2A0                    116U
+#define PduRConf_PduRSrcPdu_GwCh_2A1                    117U
+#define PduRConf_PduRSrcPdu_GwCh_2A2                    118U
+#define PduRConf_PduRSrcPdu_GwCh_2A3                    119U
+#define PduRConf_PduRSrcPdu_GwCh_2A4                    120U
+#define PduRConf_PduRSrcPdu_GwCh_2A5                    121U
+#define PduRConf_PduRSrcPdu_GwCh_2A6                    122U
+#define PduRConf_PduRSrcPdu_GwCh_2A7                    123U
+#define PduRConf_PduRSrcPdu_GwCh_2A8                    124U
+#define PduRConf_PduRSrcPdu_GwCh_2A9                    125U
+#define PduRConf_PduRSrcPdu_GwCh_2AA                    126U
+#define PduRConf_PduRSrcPdu_GwCh_2AB                    127U
+#define PduRConf_PduRSrcPdu_GwCh_2AC                    128U
+#define PduRConf_PduRSrcPdu_GwCh_2AD                    129U
+#define PduRConf_PduRSrcPdu_GwCh_2AE                    130U
+#define PduRConf_PduRSrcPdu_GwCh_2AF                    131U
+#define PduRConf_PduRSrcPdu_GwBd_400                    132U
+#define PduRConf_PduRSrcPdu_GwBd_401                    133U
+#define PduRConf_PduRSrcPdu_GwBd_402                    134U
+#define PduRConf_PduRSrcPdu_GwBd_403                    135U
+#define PduRConf_PduRSrcPdu_GwBd_404                    136U
+#define PduRConf_PduRSrcPdu_GwBd_405                    137U
+#define PduRConf_PduRSrcPdu_GwBd_406                    138U
+#define PduRConf_PduRSrcPdu_GwBd_407                    139U
+#define PduRConf_PduRSrcPdu_GwBd_408                    140U
+#define PduRConf_PduRSrcPdu_GwBd_409                    141U
+#define PduRConf_PduRSrcPdu_GwBd_40A                    142U
+#define PduRConf_PduRSrcPdu_GwBd_40B                    143U
+#define PduRConf_PduRSrcPdu_GwBd_40C                    144U
+#define PduRConf_PduRSrcPdu_GwBd_40D                    145U
+#define PduRConf_PduRSrcPdu_GwBd_40E                    146U
+#define PduRConf_PduRSrcPdu_GwBd_40F                    147U
+#define PduRConf_PduRSrcPdu_GwBd_410                    148U
+#define PduRConf_PduRSrcPdu_GwBd_411                    149U
+#define PduRConf_PduRSrcPdu_GwBd_412                    150U
+#define PduRConf_PduRSrcPdu_GwBd_413                    151U
+#define PduRConf_PduRSrcPdu_GwBd_414                    152U
+#define PduRConf_PduRSrcPdu_GwBd_415                    153U
+#define PduRConf_PduRSrcPdu_GwBd_416                    154U
+#define PduRConf_PduRSrcPdu_GwBd_417                    155U
+#define PduRConf_PduRSrcPdu_GwBd_418                    156U
+#define PduRConf_PduRSrcPdu_GwBd_419                    157U
+#define PduRConf_PduRSrcPdu_GwBd_41A                    158U
+#define PduRConf_PduRSrcPdu_GwBd_41B                    159U
+#define PduRConf_PduRSrcPdu_GwBd_41C                    160U
+#define PduRConf_PduRSrcPdu_GwBd_41D                    161U
+#define PduRConf_PduRSrcPdu_GwBd_41E                    162U
+#define PduRConf_PduRSrcPdu_GwBd_41F                    163U
+#define PduRConf_PduRSrcPdu_GwBd_420                    164U
+#define PduRConf_PduRSrcPdu_GwBd_421                    165U
+#define PduRConf_PduRSrcPdu_GwBd_422                    166U
+#define PduRConf_PduRSrcPdu_GwBd_423                    167U
+#define PduRConf_PduRSrcPdu_GwBd_424                    168U
+#define PduRConf_PduRSrcPdu_GwBd_425                    169U
+#define PduRConf_PduRSrcPdu_GwBd_426                    170U
+#define PduRConf_PduRSrcPdu_GwBd_427                    171U
+#define PduRConf_PduRSrcPdu_GwEth_PT_500                172U
+#define PduRConf_PduRSrcPdu_GwEth_PT_501                173U
+#define PduRConf_PduRSrcPdu_GwEth_PT_502                174U
+#define PduRConf_PduRSrcPdu_GwEth_PT_503                175U
+#define PduRConf_PduRSrcPdu_GwEth_PT_504                176U
+#define PduRConf_PduRSrcPdu_GwEth_PT_505                177U
+#define PduRConf_PduRSrcPdu_GwEth_PT_506                178U
+#define PduRConf_PduRSrcPdu_GwEth_PT_507                179U
+#define PduRConf_PduRSrcPdu_GwEth_PT_508                180U
+#define PduRConf_PduRSrcPdu_GwEth_PT_509                181U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50A                182U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50B                183U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50C                184U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50D                185U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50E                186U
+#define PduRConf_PduRSrcPdu_GwEth_PT_50F                187U
+#define PduRConf_PduRSrcPdu_GwEth_CH_540                188U
+#define PduRConf_PduRSrcPdu_GwEth_CH_541                189U
+#define PduRConf_PduRSrcPdu_GwEth_CH_542                190U
+#define PduRConf_PduRSrcPdu_GwEth_CH_543                191U
+#define PduRConf_PduRSrcPdu_GwEth_CH_544                192U
+#define PduRConf_PduRSrcPdu_GwEth_CH_545                193U
+#define PduRConf_PduRSrcPdu_GwEth_CH_546                194U
+#define PduRConf_PduRSrcPdu_GwEth_CH_547                195U
+#define PduRConf_PduRSrcPdu_GwEth_CH_548                196U
+#define PduRConf_PduRSrcPdu_GwEth_CH_549                197U
+#define PduRConf_PduRSrcPdu_GwEth_CH_54A                198U
+#define PduRConf_PduRSrcPdu_GwEth_CH_54B                199U
+#define PduRConf_PduRSrcPdu_GwEth_BD_580                200U
+#define PduRConf_PduRSrcPdu_GwEth_BD_581                201U
+#define PduRConf_PduRSrcPdu_GwEth_BD_582                202U
+#define PduRConf_PduRSrcPdu_GwEth_BD_583                203U
+#define PduRConf_PduRSrcPdu_GwEth_BD_584                204U
+#define PduRConf_PduRSrcPdu_GwEth_BD_585                205U
+#define PduRConf_PduRSrcPdu_GwEth_BD_586                206U
+#define PduRConf_PduRSrcPdu_GwEth_BD_587                207U
+#define PduRConf_PduRSrcPdu_GwEth_BD_588                208U
+#define PduRConf_PduRSrcPdu_GwEth_BD_589                209U
+#define PduRConf_PduRSrcPdu_GwEth_BD_58A                210U
+#define PduRConf_PduRSrcPdu_GwEth_BD_58B                211U
+#define PduRConf_PduRSrcPdu_UDS_PT_PhysReq              212U
+#define PduRConf_PduRSrcPdu_UDS_CH_PhysReq              213U
+#define PduRConf_PduRSrcPdu_UDS_BD_PhysReq              214U
+#define PduRConf_PduRSrcPdu_UDS_FuncReq                 215U
+#define PduRConf_PduRSrcPdu_UDS_PT_Resp                 216U
+#define PduRConf_PduRSrcPdu_UDS_CH_Resp                 217U
+#define PduRConf_PduRSrcPdu_UDS_BD_Resp                 218U
+
+/* ===============================================================================================
+ *            DESTINATION PDU HANDLES (PduR_<Module>TriggerTransmit / TxConfirmation)
+ * =============================================================================================== */
+
+#define PduRConf_PduRDestPdu_BMS_PackStatus_Com         0U
+#define PduRConf_PduRDestPdu_BMS_PackStatus_Eth         1U
+#define PduRConf_PduRDestPdu_BMS_CellVoltages1_Com      2U
+#define PduRConf_PduRDestPdu_BMS_CellVoltages2_Com      3U
+#define PduRConf_PduRDestPdu_BMS_CellVoltages3_Com      4U
+#define PduRConf_PduRDestPdu_BMS_CellTemps_Com          5U
+#define PduRConf_PduRDestPdu_MCU_Status_Com             6U
+#define PduRConf_PduRDestPdu_MCU_Status_Eth             7U
+#define PduRConf_PduRDestPdu_ESP_WheelSpeeds_Com        8U
+#define PduRConf_PduRDestPdu_ESP_WheelSpeeds_Eth        9U
+#define PduRConf_PduRDestPdu_ESP_WheelSpeeds_BD         10U
+#define PduRConf_PduRDestPdu_ESP_Dynamics_Com           11U
+#define PduRConf_PduRDestPdu_ESP_Dynamics_Eth           12U
+#define PduRConf_PduRDestPdu_SAS_Steering_Com           13U
+#define PduRConf_PduRDestPdu_SAS_Steering_Eth           14U
+#define PduRConf_PduRDestPdu_APS_Pedals_Com             15U
+#define PduRConf_PduRDestPdu_GW_VehicleInfo_Com         16U
+#define PduRConf_PduRDestPdu_OBC_Status_Com             17U
+#define PduRConf_PduRDestPdu_DCDC_Status_Com            18U
+#define PduRConf_PduRDestPdu_VCU_TorqueRequest_CanIf    19U
+#define PduRConf_PduRDestPdu_VCU_TorqueRequest_Eth      20U
+#define PduRConf_PduRDestPdu_VCU_Status_CanIf           21U
+#define PduRConf_PduRDestPdu_VCU_Status_Eth             22U
+#define PduRConf_PduRDestPdu_VCU_PowertrainData_CanIf   23U
+#define PduRConf_PduRDestPdu_VCU_PowertrainDataMot_CanIf 24U
+#define PduRConf_PduRDestPdu_VCU_ChargeControl_CanIf    25U
+#define PduRConf_PduRDestPdu_VCU_ThermalRequest_CanIf   26U
+#define PduRConf_PduRDestPdu_VCU_DcdcControl_CanIf      27U
+#define PduRConf_PduRDestPdu_GwPt_200_Acf               28U
+#define PduRConf_PduRDestPdu_GwPt_200_CH                29U
+#define PduRConf_PduRDestPdu_GwPt_201_Acf               30U
+#define PduRConf_PduRDestPdu_GwPt_202_Acf               31U
+#define PduRConf_PduRDestPdu_GwPt_203_Acf               32U
+#define PduRConf_PduRDestPdu_GwPt_204_Acf               33U
+#define PduRConf_PduRDestPdu_GwPt_205_Acf               34U
+#define PduRConf_PduRDestPdu_GwPt_206_Acf               35U
+#define PduRConf_PduRDestPdu_GwPt_207_Acf               36U
+#define PduRConf_PduRDestPdu_GwPt_208_Acf               37U
+#define PduRConf_PduRDestPdu_GwPt_208_CH                38U
+#define PduRConf_PduRDestPdu_GwPt_209_Acf               39U
+#define PduRConf_PduRDestPdu_GwPt_20A_Acf               40U
+#define PduRConf_PduRDestPdu_GwPt_20B_Acf               41U
+#define PduRConf_PduRDestPdu_GwPt_20C_Acf               42U
+#define PduRConf_PduRDestPdu_GwPt_20D_Acf               43U
+#define PduRConf_PduRDestPdu_GwPt_20E_Acf               44U
+#define PduRConf_PduRDestPdu_GwPt_20F_Acf               45U
+#define PduRConf_PduRDestPdu_GwPt_210_Acf               46U
+#define PduRConf_PduRDestPdu_GwPt_210_CH                47U
+#define PduRConf_PduRDestPdu_GwPt_211_Acf               48U
+#define PduRConf_PduRDestPdu_GwPt_212_Acf               49U
+#define PduRConf_PduRDestPdu_GwPt_213_Acf               50U
+#define PduRConf_PduRDestPdu_GwPt_214_Acf               51U
+#define PduRConf_PduRDestPdu_GwPt_215_Acf               52U
+#define PduRConf_PduRDestPdu_GwPt_216_Acf               53U
+#define PduRConf_PduRDestPdu_GwPt_217_Acf               54U
+#define PduRConf_PduRDestPdu_GwPt_218_Acf               55U
+#define PduRConf_PduRDestPdu_GwPt_218_CH                56U
+#define PduRConf_PduRDestPdu_GwPt_219_Acf               57U
+#define PduRConf_PduRDestPdu_GwPt_21A_Acf               58U
+#define PduRConf_PduRDestPdu_GwPt_21B_Acf               59U
+#define PduRConf_PduRDestPdu_GwPt_21C_Acf               60U
+#define PduRConf_PduRDestPdu_GwPt_21D_Acf               61U
+#define PduRConf_PduRDestPdu_GwPt_21E_Acf               62U
+#define PduRConf_PduRDestPdu_GwPt_21F_Acf               63U
+#define PduRConf_PduRDestPdu_GwPt_220_Acf               64U
+#define PduRConf_PduRDestPdu_GwPt_220_CH                65U
+#define PduRConf_PduRDestPdu_GwPt_221_Acf               66U
+#define PduRConf_PduRDestPdu_GwPt_222_Acf               67U
+#define PduRConf_PduRDestPdu_GwPt_223_Acf               68U
+#define PduRConf_PduRDestPdu_GwPt_224_Acf               69U
+#define PduRConf_PduRDestPdu_GwPt_225_Acf               70U
+#define PduRConf_PduRDestPdu_GwPt_226_Acf               71U
+#define PduRConf_PduRDestPdu_GwPt_227_Acf               72U
+#define PduRConf_PduRDestPdu_GwPt_228_Acf               73U
+#define PduRConf_PduRDestPdu_GwPt_228_CH                74U
+#define PduRConf_PduRDestPdu_GwPt_229_Acf               75U
+#define PduRConf_PduRDestPdu_GwPt_22A_Acf               76U
+#define PduRConf_PduRDestPdu_GwPt_22B_Acf               77U
+#define PduRConf_PduRDestPdu_GwPt_22C_Acf               78U
+#define PduRConf_PduRDestPdu_GwPt_22D_Acf               79U
+#define PduRConf_PduRDestPdu_GwPt_22E_Acf               80U
+#define PduRConf_PduRDestPdu_GwPt_22F_Acf               81U
+#define PduRConf_PduRDestPdu_GwPt_230_Acf               82U
+#define PduRConf_PduRDestPdu_GwPt_230_CH                83U
+#define PduRConf_PduRDestPdu_GwPt_231_Acf               84U
+#define PduRConf_PduRDestPdu_GwPt_232_Acf               85U
+#define PduRConf_PduRDestPdu_GwPt_233_Acf               86U
+#define PduRConf_PduRDestPdu_GwPt_234_Acf               87U
+#define PduRConf_PduRDestPdu_GwPt_235_Acf               88U
+#define PduRConf_PduRDestPdu_GwPt_236_Acf               89U
+#define PduRConf_PduRDestPdu_GwPt_237_Acf               90U
+#define PduRConf_PduRDestPdu_GwPt_238_Acf               91U
+#define PduRConf_PduRDestPdu_GwPt_238_CH                92U
+#define PduRConf_PduRDestPdu_GwPt_239_Acf               93U
+#define PduRConf_PduRDestPdu_GwPt_23A_Acf               94U
+#define PduRConf_PduRDestPdu_GwPt_23B_Acf               95U
+#define PduRConf_PduRDestPdu_GwPt_23C_Acf               96U
+#define PduRConf_PduRDestPdu_GwPt_23D_Acf               97U
+#define PduRConf_PduRDestPdu_GwPt_23E_Acf               98U
+#define PduRConf_PduRDestPdu_GwPt_23F_Acf               99U
+#define PduRConf_PduRDestPdu_GwCh_280_Acf               100U
+#define PduRConf_PduRDestPdu_GwCh_280_PT                101U
+#define PduRConf_PduRDestPdu_GwCh_281_Acf               102U
+#define PduRConf_PduRDestPdu_GwCh_282_Acf               103U
+#define PduRConf_PduRDestPdu_GwCh_283_Acf               104U
+#define PduRConf_PduRDestPdu_GwCh_284_Acf               105U
+#define PduRConf_PduRDestPdu_GwCh_285_Acf               106U
+#define PduRConf_PduRDestPdu_GwCh_286_Acf               107U
+#define PduRConf_PduRDestPdu_GwCh_287_Acf               108U
+#define PduRConf_PduRDestPdu_GwCh_288_Acf               109U
+#define PduRConf_PduRDestPdu_GwCh_288_PT                110U
+#define PduRConf_PduRDestPdu_GwCh_289_Acf               111U
+#define PduRConf_PduRDestPdu_GwCh_28A_Acf               112U
+#define PduRConf_PduRDestPdu_GwCh_28B_Acf               113U
+#define PduRConf_PduRDestPdu_GwCh_28C_Acf               114U
+#define PduRConf_PduRDestPdu_GwCh_28D_Acf               115U
+#define PduRConf_PduRDestPdu_GwCh_28E_Acf               116U
+#define PduRConf_PduRDestPdu_GwCh_28F_Acf               117U
+#define PduRConf_PduRDestPdu_GwCh_290_Acf               118U
+#define PduRConf_PduRDestPdu_GwCh_290_PT                119U
+#define PduRConf_PduRDestPdu_GwCh_291_Acf               120U
+#define PduRConf_PduRDestPdu_GwCh_292_Acf               121U
+#define PduRConf_PduRDestPdu_GwCh_293_Acf               122U
+#define PduRConf_PduRDestPdu_GwCh_294_Acf               123U
+#define PduRConf_PduRDestPdu_GwCh_295_Acf               124U
+#define PduRConf_PduRDestPdu_GwCh_296_Acf               125U
+#define PduRConf_PduRDestPdu_GwCh_297_Acf               126U
+#define PduRConf_PduRDestPdu_GwCh_298_Acf               127U
+#define PduRConf_PduRDestPdu_GwCh_298_PT                128U
+#define PduRConf_PduRDestPdu_GwCh_299_Acf               129U
+#define PduRConf_PduRDestPdu_GwCh_29A_Acf               130U
+#define PduRConf_PduRDestPdu_GwCh_29B_Acf               131U
+#define PduRConf_PduRDestPdu_GwCh_29C_Acf               132U
+#define PduRConf_PduRDestPdu_GwCh_29D_Acf               133U
+#define PduRConf_PduRDestPdu_GwCh_29E_Acf               134U
+#define PduRConf_PduRDestPdu_GwCh_29F_Acf               135U
+#define PduRConf_PduRDestPdu_GwCh_2A0_Acf               136U
+#define PduRConf_PduRDestPdu_GwCh_2A0_PT                137U
+#define PduRConf_PduRDestPdu_GwCh_2A1_Acf               138U
+#define PduRConf_PduRDestPdu_GwCh_2A2_Acf               139U
+#define PduRConf_PduRDestPdu_GwCh_2A3_Acf               140U
+#define PduRConf_PduRDestPdu_GwCh_2A4_Acf               141U
+#define PduRConf_PduRDestPdu_GwCh_2A5_Acf               142U
+#define PduRConf_PduRDestPdu_GwCh_2A6_Acf               143U
+#define PduRConf_PduRDestPdu_GwCh_2A7_Acf               144U
+#define PduRConf_PduRDestPdu_GwCh_2A8_Acf               145U
+#define PduRConf_PduRDestPdu_GwCh_2A8_PT                146U
+#define PduRConf_PduRDestPdu_GwCh_2A9_Acf               147U
+#define PduRConf_PduRDestPdu_GwCh_2AA_Acf               148U
+#define PduRConf_PduRDestPdu_GwCh_2AB_Acf               149U
+#define PduRConf_PduRDestPdu_GwCh_2AC_Acf               150U
+#define PduRConf_PduRDestPdu_GwCh_2AD_Acf               151U
+#define PduRConf_PduRDestPdu_GwCh_2AE_Acf               152U
+#define PduRConf_PduRDestPdu_GwCh_2AF_Acf               153U
+#define PduRConf_PduRDestPdu_GwBd_400_Acf               154U
+#define PduRConf_PduRDestPdu_GwBd_401_Acf               155U
+#define PduRConf_PduRDestPdu_GwBd_402_Acf               156U
+#define PduRConf_PduRDestPdu_GwBd_403_Acf               157U
+#define PduRConf_PduRDestPdu_GwBd_404_Acf               158U
+#define PduRConf_PduRDestPdu_GwBd_405_Acf               159U
+#define PduRConf_PduRDestPdu_GwBd_406_Acf               160U
+#define PduRConf_PduRDestPdu_GwBd_407_Acf               161U
+#define PduRConf_PduRDestPdu_GwBd_408_Acf               162U
+#define PduRConf_PduRDestPdu_GwBd_409_Acf               163U
+#define PduRConf_PduRDestPdu_GwBd_40A_Acf               164U
+#define PduRConf_PduRDestPdu_GwBd_40B_Acf               165U
+#define PduRConf_PduRDestPdu_GwBd_40C_Acf               166U
+#define PduRConf_PduRDestPdu_GwBd_40D_Acf               167U
+#define PduRConf_PduRDestPdu_GwBd_40E_Acf               168U
+#define PduRConf_PduRDestPdu_GwBd_40F_Acf               169U
+#define PduRConf_PduRDestPdu_GwBd_410_Acf               170U
+#define PduRConf_PduRDestPdu_GwBd_411_Acf               171U
+#define PduRConf_PduRDestPdu_GwBd_412_Acf               172U
+#define PduRConf_PduRDestPdu_GwBd_413_Acf               173U
+#define PduRConf_PduRDestPdu_GwBd_414_Acf               174U
+#define PduRConf_PduRDestPdu_GwBd_415_Acf               175U
+#define PduRConf_PduRDestPdu_GwBd_416_Acf               176U
+#define PduRConf_PduRDestPdu_GwBd_417_Acf               177U
+#define PduRConf_PduRDestPdu_GwBd_418_Acf               178U
+#define PduRConf_PduRDestPdu_GwBd_419_Acf               179U
+#define PduRConf_PduRDestPdu_GwBd_41A_Acf               180U
+#define PduRConf_PduRDestPdu_GwBd_41B_Acf               181U
+#define PduRConf_PduRDestPdu_GwBd_41C_Acf               182U
+#define PduRConf_PduRDestPdu_GwBd_41D_Acf               183U
+#define PduRConf_PduRDestPdu_GwBd_41E_Acf               184U
+#define PduRConf_PduRDestPdu_GwBd_41F_Acf               185U
+#define PduRConf_PduRDestPdu_GwBd_420_Acf               186U
+#define PduRConf_PduRDestPdu_GwBd_421_Acf               187U
+#define PduRConf_PduRDestPdu_GwBd_422_Acf               188U
+#define PduRConf_PduRDestPdu_GwBd_423_Acf               189U
+#define PduRConf_PduRDestPdu_GwBd_424_Acf               190U
+#define PduRConf_PduRDestPdu_GwBd_425_Acf               191U
+#define PduRConf_PduRDestPdu_GwBd_426_Acf               192U
+#define PduRConf_PduRDestPdu_GwBd_427_Acf               193U
+#define PduRConf_PduRDestPdu_GwEth_PT_500_Can           194U
+#define PduRConf_PduRDestPdu_GwEth_PT_501_Can           195U
+#define PduRConf_PduRDestPdu_GwEth_PT_502_Can           196U
+#define PduRConf_PduRDestPdu_GwEth_PT_503_Can           197U
+#define PduRConf_PduRDestPdu_GwEth_PT_504_Can           198U
+#define PduRConf_PduRDestPdu_GwEth_PT_505_Can           199U
+#define PduRConf_PduRDestPdu_GwEth_PT_506_Can           200U
+#define PduRConf_PduRDestPdu_GwEth_PT_507_Can           201U
+#define PduRConf_PduRDestPdu_GwEth_PT_508_Can           202U
+#define PduRConf_PduRDestPdu_GwEth_PT_509_Can           203U
+#define PduRConf_PduRDestPdu_GwEth_PT_50A_Can           204U
+#define PduRConf_PduRDestPdu_GwEth_PT_50B_Can           205U
+#define PduRConf_PduRDestPdu_GwEth_PT_50C_Can           206U
+#define PduRConf_PduRDestPdu_GwEth_PT_50D_Can           207U
+#define PduRConf_PduRDestPdu_GwEth_PT_50E_Can           208U
+#define PduRConf_PduRDestPdu_GwEth_PT_50F_Can           209U
+#define PduRConf_PduRDestPdu_GwEth_CH_540_Can           210U
+#define PduRConf_PduRDestPdu_GwEth_CH_541_Can           211U
+#define PduRConf_PduRDestPdu_GwEth_CH_542_Can           212U
+#define PduRConf_PduRDestPdu_GwEth_CH_543_Can           213U
+#define PduRConf_PduRDestPdu_GwEth_CH_544_Can           214U
+#define PduRConf_PduRDestPdu_GwEth_CH_545_Can           215U
+#define PduRConf_PduRDestPdu_GwEth_CH_546_Can           216U
+#define PduRConf_PduRDestPdu_GwEth_CH_547_Can           217U
+#define PduRConf_PduRDestPdu_GwEth_CH_548_Can           218U
+#define PduRConf_PduRDestPdu_GwEth_CH_549_Can           219U
+#define PduRConf_PduRDestPdu_GwEth_CH_54A_Can           220U
+#define PduRConf_PduRDestPdu_GwEth_CH_54B_Can           221U
+#define PduRConf_PduRDestPdu_GwEth_BD_580_Can           222U
+#define PduRConf_PduRDestPdu_GwEth_BD_581_Can           223U
+#define PduRConf_PduRDestPdu_GwEth_BD_582_Can           224U
+#define PduRConf_PduRDestPdu_GwEth_BD_583_Can           225U
+#define PduRConf_PduRDestPdu_GwEth_BD_584_Can           226U
+#define PduRConf_PduRDestPdu_GwEth_BD_585_Can           227U
+#define PduRConf_PduRDestPdu_GwEth_BD_586_Can           228U
+#define PduRConf_PduRDestPdu_GwEth_BD_587_Can           229U
+#define PduRConf_PduRDestPdu_GwEth_BD_588_Can           230U
+#define PduRConf_PduRDestPdu_GwEth_BD_589_Can           231U
+#define PduRConf_PduRDestPdu_GwEth_BD_58A_Can           232U
+#define PduRConf_PduRDestPdu_GwEth_BD_58B_Can           233U
+#define PduRConf_PduRDestPdu_UDS_PT_PhysReq_Dcm         234U
+#define PduRConf_PduRDestPdu_UDS_CH_PhysReq_Dcm         235U
+#define PduRConf_PduRDestPdu_UDS_BD_PhysReq_Dcm         236U
+#define PduRConf_PduRDestPdu_UDS_FuncReq_Dcm            237U
+#define PduRConf_PduRDestPdu_UDS_PT_Resp_CanTp          238U
+#define PduRConf_PduRDestPdu_UDS_CH_Resp_CanTp          239U
+#define PduRConf_PduRDestPdu_UDS_BD_Resp_CanTp          240U
+
+#endif /* PDUR_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
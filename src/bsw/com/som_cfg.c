@@ -0,0 +1,633 @@
+/**
+ * @file    som_cfg.c
+ * @brief   SOME/IP Configuration - Serializers and Tables
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static SOME/IP configuration of the VCU: serializers, length checks and
+ * deserializers of the data types, the shadows and TP buffers of the consumed
+ * events and the service, event group and event tables.
+ *
+ * @note Generated by tools/som/som_generator.py from config/autosar/communication/som.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "som_stack.h"
+#include "som_pack.h"
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC Som_PedalInputsType Som_Shadow_PedalInputs;
+STATIC Som_SteeringInputType Som_Shadow_SteeringInput;
+STATIC Som_RearSensorsType Som_Shadow_RearSensors;
+STATIC Som_RearDiagnosticsType Som_Shadow_RearDiagnostics;
+
+STATIC uint8 Som_TpBuffer_RearDiagnostics[6012U] ALIGNED(8);
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Serialize VehicleMotion (19 bytes)
+ */
+STATIC uint32 Som_Serialize_VehicleMotion(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_VehicleMotionType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_VehicleMotionType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    Som_StoreBe16(&Buffer[0], d->Speed);
+    Som_StoreBe16(&Buffer[2], (uint16)d->Acceleration);
+    Som_StoreF32(&Buffer[4], d->YawRate);
+    Buffer[8] = d->Gear;
+    Buffer[9] = d->Direction;
+    Buffer[10] = d->Standstill;
+    Som_StoreBe64(&Buffer[11], d->Timestamp);
+
+    return 19U;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialized length of a VehicleMotion payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_VehicleMotion(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 19UL) ? 19UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a VehicleMotion payload of valid length
+ */
+STATIC void Som_Deserialize_VehicleMotion(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_VehicleMotionType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_VehicleMotionType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    d->Speed = Som_LoadBe16(&Buffer[0]);
+    d->Acceleration = (sint16)Som_LoadBe16(&Buffer[2]);
+    d->YawRate = Som_LoadF32(&Buffer[4]);
+    d->Gear = Buffer[8];
+    d->Direction = Buffer[9];
+    d->Standstill = (Buffer[10] != 0U) ? TRUE : FALSE;
+    d->Timestamp = Som_LoadBe64(&Buffer[11]);
+}
+#endif
+
+/**
+ * @brief Serialize PowertrainState (38 bytes)
+ */
+STATIC uint32 Som_Serialize_PowertrainState(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_PowertrainStateType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_PowertrainStateType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    Som_StoreF32(&Buffer[0], d->TorqueRequest);
+    Som_StoreF32(&Buffer[4], d->TorqueActual);
+    for (i = 0U; i < 4U; i++)
+    {
+        Som_StoreF32(&Buffer[8U + (4U * i)], d->WheelTorque[i]);
+    }
+    Som_StoreBe32(&Buffer[24], (uint32)d->MotorSpeed);
+    Som_StoreBe16(&Buffer[28], d->HvVoltage);
+    Som_StoreBe16(&Buffer[30], (uint16)d->HvCurrent);
+    Buffer[32] = d->DerateActive;
+    Buffer[33] = d->DriveMode;
+    Som_StoreBe32(&Buffer[34], d->ActiveFaults);
+
+    return 38U;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialized length of a PowertrainState payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_PowertrainState(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 38UL) ? 38UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a PowertrainState payload of valid length
+ */
+STATIC void Som_Deserialize_PowertrainState(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_PowertrainStateType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_PowertrainStateType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    d->TorqueRequest = Som_LoadF32(&Buffer[0]);
+    d->TorqueActual = Som_LoadF32(&Buffer[4]);
+    for (i = 0U; i < 4U; i++)
+    {
+        d->WheelTorque[i] = Som_LoadF32(&Buffer[8U + (4U * i)]);
+    }
+    d->MotorSpeed = (sint32)Som_LoadBe32(&Buffer[24]);
+    d->HvVoltage = Som_LoadBe16(&Buffer[28]);
+    d->HvCurrent = (sint16)Som_LoadBe16(&Buffer[30]);
+    d->DerateActive = (Buffer[32] != 0U) ? TRUE : FALSE;
+    d->DriveMode = Buffer[33];
+    d->ActiveFaults = Som_LoadBe32(&Buffer[34]);
+}
+#endif
+
+/**
+ * @brief Serialize BatteryStatus (at most 508 bytes)
+ */
+STATIC uint32 Som_Serialize_BatteryStatus(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_BatteryStatusType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_BatteryStatusType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+    uint32 pos;
+
+    if ((d->CellVoltagesLength > 192U) ||
+        (d->CellTempsLength > 96U))
+    {
+        return SOM_SER_ERROR;
+    }
+    Som_StoreBe16(&Buffer[0], d->Soc);
+    Som_StoreBe16(&Buffer[2], d->Soh);
+    Som_StoreF32(&Buffer[4], d->PackVoltage);
+    Som_StoreF32(&Buffer[8], d->PackCurrent);
+    Som_StoreBe32(&Buffer[12], (uint32)d->CellVoltagesLength * 2U);
+    for (i = 0U; i < d->CellVoltagesLength; i++)
+    {
+        Som_StoreBe16(&Buffer[16U + (2U * i)], d->CellVoltages[i]);
+    }
+    pos = 16U + (2U * (uint32)d->CellVoltagesLength);
+    Som_StoreBe32(&Buffer[pos], (uint32)d->CellTempsLength);
+    (void)memcpy(&Buffer[pos + 4U], d->CellTemps, (uint32)d->CellTempsLength);
+    pos += 4U + (uint32)d->CellTempsLength;
+    Som_StoreBe64(&Buffer[pos], d->Timestamp);
+
+    return pos + 8U;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialized length of a BatteryStatus payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_BatteryStatus(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    uint32 pos;
+    uint32 bytes;
+
+    pos = 12UL;
+    if (Length < (pos + 4UL))
+    {
+        return SOM_SER_ERROR;
+    }
+    bytes = Som_LoadBe32(&Buffer[pos]);
+    if ((bytes > 384UL) || ((bytes % 2UL) != 0UL) || (bytes > (Length - pos - 4UL)))
+    {
+        return SOM_SER_ERROR;
+    }
+    pos += 4UL + bytes;
+    if (Length < (pos + 4UL))
+    {
+        return SOM_SER_ERROR;
+    }
+    bytes = Som_LoadBe32(&Buffer[pos]);
+    if ((bytes > 96UL) || (bytes > (Length - pos - 4UL)))
+    {
+        return SOM_SER_ERROR;
+    }
+    pos += 4UL + bytes + 8UL;
+
+    return (pos <= Length) ? pos : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a BatteryStatus payload of valid length
+ */
+STATIC void Som_Deserialize_BatteryStatus(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_BatteryStatusType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_BatteryStatusType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+    uint32 pos;
+
+    d->Soc = Som_LoadBe16(&Buffer[0]);
+    d->Soh = Som_LoadBe16(&Buffer[2]);
+    d->PackVoltage = Som_LoadF32(&Buffer[4]);
+    d->PackCurrent = Som_LoadF32(&Buffer[8]);
+    d->CellVoltagesLength = (uint16)(Som_LoadBe32(&Buffer[12]) / 2U);
+    for (i = 0U; i < d->CellVoltagesLength; i++)
+    {
+        d->CellVoltages[i] = Som_LoadBe16(&Buffer[16U + (2U * i)]);
+    }
+    pos = 16U + (2U * (uint32)d->CellVoltagesLength);
+    d->CellTempsLength = (uint16)Som_LoadBe32(&Buffer[pos]);
+    (void)memcpy(d->CellTemps, &Buffer[pos + 4U], (uint32)d->CellTempsLength);
+    pos += 4U + (uint32)d->CellTempsLength;
+    d->Timestamp = Som_LoadBe64(&Buffer[pos]);
+}
+#endif
+
+/**
+ * @brief Serialize DiagSample (8 bytes)
+ */
+STATIC uint32 Som_Serialize_DiagSample(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_DiagSampleType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_DiagSampleType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    Som_StoreBe32(&Buffer[0], d->Time);
+    Som_StoreBe16(&Buffer[4], d->Channel);
+    Som_StoreBe16(&Buffer[6], (uint16)d->Value);
+
+    return 8U;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Deserialize a DiagSample payload of valid length
+ */
+STATIC void Som_Deserialize_DiagSample(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_DiagSampleType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_DiagSampleType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    d->Time = Som_LoadBe32(&Buffer[0]);
+    d->Channel = Som_LoadBe16(&Buffer[4]);
+    d->Value = (sint16)Som_LoadBe16(&Buffer[6]);
+}
+#endif
+
+/**
+ * @brief Serialize DiagSnapshot (4108 bytes)
+ */
+STATIC uint32 Som_Serialize_DiagSnapshot(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_DiagSnapshotType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_DiagSnapshotType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    Som_StoreBe64(&Buffer[0], d->Timestamp);
+    Som_StoreBe32(&Buffer[8], d->TriggerId);
+    for (i = 0U; i < 512U; i++)
+    {
+        (void)Som_Serialize_DiagSample(&d->Samples[i], &Buffer[12U + (8U * i)]);
+    }
+
+    return 4108U;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialized length of a DiagSnapshot payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_DiagSnapshot(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 4108UL) ? 4108UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a DiagSnapshot payload of valid length
+ */
+STATIC void Som_Deserialize_DiagSnapshot(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_DiagSnapshotType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_DiagSnapshotType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    d->Timestamp = Som_LoadBe64(&Buffer[0]);
+    d->TriggerId = Som_LoadBe32(&Buffer[8]);
+    for (i = 0U; i < 512U; i++)
+    {
+        Som_Deserialize_DiagSample(&Buffer[12U + (8U * i)], &d->Samples[i]);
+    }
+}
+
+/**
+ * @brief Serialize PedalInputs (17 bytes)
+ */
+STATIC uint32 Som_Serialize_PedalInputs(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_PedalInputsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_PedalInputsType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    Som_StoreBe16(&Buffer[0], d->AccelPedal1);
+    Som_StoreBe16(&Buffer[2], d->AccelPedal2);
+    Som_StoreF32(&Buffer[4], d->BrakePressure);
+    Buffer[8] = d->BrakeSwitch;
+    Som_StoreBe64(&Buffer[9], d->Timestamp);
+
+    return 17U;
+}
+#endif
+
+/**
+ * @brief Serialized length of a PedalInputs payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_PedalInputs(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 17UL) ? 17UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a PedalInputs payload of valid length
+ */
+STATIC void Som_Deserialize_PedalInputs(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_PedalInputsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_PedalInputsType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    d->AccelPedal1 = Som_LoadBe16(&Buffer[0]);
+    d->AccelPedal2 = Som_LoadBe16(&Buffer[2]);
+    d->BrakePressure = Som_LoadF32(&Buffer[4]);
+    d->BrakeSwitch = (Buffer[8] != 0U) ? TRUE : FALSE;
+    d->Timestamp = Som_LoadBe64(&Buffer[9]);
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialize SteeringInput (5 bytes)
+ */
+STATIC uint32 Som_Serialize_SteeringInput(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_SteeringInputType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_SteeringInputType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    Som_StoreBe16(&Buffer[0], (uint16)d->Angle);
+    Som_StoreBe16(&Buffer[2], (uint16)d->AngleRate);
+    Buffer[4] = d->Valid;
+
+    return 5U;
+}
+#endif
+
+/**
+ * @brief Serialized length of a SteeringInput payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_SteeringInput(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 5UL) ? 5UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a SteeringInput payload of valid length
+ */
+STATIC void Som_Deserialize_SteeringInput(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_SteeringInputType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_SteeringInputType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    d->Angle = (sint16)Som_LoadBe16(&Buffer[0]);
+    d->AngleRate = (sint16)Som_LoadBe16(&Buffer[2]);
+    d->Valid = (Buffer[4] != 0U) ? TRUE : FALSE;
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialize RearSensors (25 bytes)
+ */
+STATIC uint32 Som_Serialize_RearSensors(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_RearSensorsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_RearSensorsType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        Som_StoreBe16(&Buffer[2U * i], d->ParkDistance[i]);
+    }
+    Buffer[16] = d->TrailerConnected;
+    Som_StoreF64(&Buffer[17], d->AmbientTemp);
+
+    return 25U;
+}
+#endif
+
+/**
+ * @brief Serialized length of a RearSensors payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_RearSensors(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    (void)Buffer;
+    return (Length >= 25UL) ? 25UL : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a RearSensors payload of valid length
+ */
+STATIC void Som_Deserialize_RearSensors(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_RearSensorsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_RearSensorsType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        d->ParkDistance[i] = Som_LoadBe16(&Buffer[2U * i]);
+    }
+    d->TrailerConnected = (Buffer[16] != 0U) ? TRUE : FALSE;
+    d->AmbientTemp = Som_LoadF64(&Buffer[17]);
+}
+
+#if (SOM_PEER_CODECS == STD_ON)
+/**
+ * @brief Serialize RearDiagnostics (at most 6012 bytes)
+ */
+STATIC uint32 Som_Serialize_RearDiagnostics(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)
+{
+    P2CONST(Som_RearDiagnosticsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2CONST(Som_RearDiagnosticsType, AUTOMATIC, SOM_APPL_DATA))Data;
+    uint32 pos;
+
+    if (d->BlocksLength > 6000U)
+    {
+        return SOM_SER_ERROR;
+    }
+    Som_StoreBe64(&Buffer[0], d->Timestamp);
+    Som_StoreBe32(&Buffer[8], (uint32)d->BlocksLength);
+    (void)memcpy(&Buffer[12], d->Blocks, (uint32)d->BlocksLength);
+    pos = 12U + (uint32)d->BlocksLength;
+
+    return pos;
+}
+#endif
+
+/**
+ * @brief Serialized length of a RearDiagnostics payload, SOM_SER_ERROR if malformed
+ */
+STATIC uint32 Som_Check_RearDiagnostics(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)
+{
+    uint32 pos;
+    uint32 bytes;
+
+    pos = 8UL;
+    if (Length < (pos + 4UL))
+    {
+        return SOM_SER_ERROR;
+    }
+    bytes = Som_LoadBe32(&Buffer[pos]);
+    if ((bytes > 6000UL) || (bytes > (Length - pos - 4UL)))
+    {
+        return SOM_SER_ERROR;
+    }
+    pos += 4UL + bytes;
+
+    return (pos <= Length) ? pos : SOM_SER_ERROR;
+}
+
+/**
+ * @brief Deserialize a RearDiagnostics payload of valid length
+ */
+STATIC void Som_Deserialize_RearDiagnostics(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2VAR(Som_RearDiagnosticsType, AUTOMATIC, SOM_APPL_DATA) d =
+        (P2VAR(Som_RearDiagnosticsType, AUTOMATIC, SOM_APPL_DATA))Data;
+
+    d->Timestamp = Som_LoadBe64(&Buffer[0]);
+    d->BlocksLength = (uint16)Som_LoadBe32(&Buffer[8]);
+    (void)memcpy(d->Blocks, &Buffer[12], (uint32)d->BlocksLength);
+}
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const Som_ServiceConfigType Som_ProvidedService[SOM_PROVIDED_SERVICE_COUNT] =
+{
+    { 0UL, 0x1101U, 0x0001U, 0U, 2U, 1U },  /* VehicleState */
+    { 0UL, 0x1102U, 0x0001U, 2U, 1U, 1U }   /* VehicleDiagnostics */
+};
+
+const Som_ServiceConfigType Som_ConsumedService[SOM_CONSUMED_SERVICE_COUNT] =
+{
+    { 0UL, 0x2101U, 0x0001U, 0U, 1U, 1U },  /* ZoneFrontIo */
+    { 0UL, 0x2102U, 0x0001U, 1U, 2U, 1U }   /* ZoneRearIo */
+};
+
+const Som_EventGroupConfigType Som_ProvidedEventGroup[SOM_PROVIDED_EVENTGROUP_COUNT] =
+{
+    { SomConf_SomProvidedService_VehicleState,       1U },  /* VehicleState_Dynamics */
+    { SomConf_SomProvidedService_VehicleState,       2U },  /* VehicleState_Energy */
+    { SomConf_SomProvidedService_VehicleDiagnostics, 1U }   /* VehicleDiagnostics_Logging */
+};
+
+const Som_EventGroupConfigType Som_ConsumedEventGroup[SOM_CONSUMED_EVENTGROUP_COUNT] =
+{
+    { SomConf_SomConsumedService_ZoneFrontIo, 1U },  /* ZoneFrontIo_Inputs */
+    { SomConf_SomConsumedService_ZoneRearIo,  1U },  /* ZoneRearIo_Sensors */
+    { SomConf_SomConsumedService_ZoneRearIo,  2U }   /* ZoneRearIo_Diagnostics */
+};
+
+const Som_TxEventConfigType Som_TxEvent[SOM_TX_EVENT_COUNT] =
+{
+    {   /* VehicleMotion */
+        Som_Serialize_VehicleMotion, 19UL,
+        SomConf_SomProvidedEventGroup_VehicleState_Dynamics, 0x8001U, FALSE
+    },
+    {   /* PowertrainState */
+        Som_Serialize_PowertrainState, 38UL,
+        SomConf_SomProvidedEventGroup_VehicleState_Dynamics, 0x8002U, FALSE
+    },
+    {   /* BatteryStatus */
+        Som_Serialize_BatteryStatus, 508UL,
+        SomConf_SomProvidedEventGroup_VehicleState_Energy, 0x8003U, FALSE
+    },
+    {   /* DiagSnapshot */
+        Som_Serialize_DiagSnapshot, 4108UL,
+        SomConf_SomProvidedEventGroup_VehicleDiagnostics_Logging, 0x8010U, TRUE
+    }
+};
+
+const Som_RxEventConfigType Som_RxEvent[SOM_RX_EVENT_COUNT] =
+{
+    {   /* PedalInputs */
+        Som_Check_PedalInputs, Som_Deserialize_PedalInputs,
+        &Som_Shadow_PedalInputs, NULL_PTR,
+        17UL, (uint32)sizeof(Som_PedalInputsType),
+        SomConf_SomConsumedEventGroup_ZoneFrontIo_Inputs, 0x2101U, 0x8001U
+    },
+    {   /* SteeringInput */
+        Som_Check_SteeringInput, Som_Deserialize_SteeringInput,
+        &Som_Shadow_SteeringInput, NULL_PTR,
+        5UL, (uint32)sizeof(Som_SteeringInputType),
+        SomConf_SomConsumedEventGroup_ZoneFrontIo_Inputs, 0x2101U, 0x8002U
+    },
+    {   /* RearSensors */
+        Som_Check_RearSensors, Som_Deserialize_RearSensors,
+        &Som_Shadow_RearSensors, NULL_PTR,
+        25UL, (uint32)sizeof(Som_RearSensorsType),
+        SomConf_SomConsumedEventGroup_ZoneRearIo_Sensors, 0x2102U, 0x8001U
+    },
+    {   /* RearDiagnostics */
+        Som_Check_RearDiagnostics, Som_Deserialize_RearDiagnostics,
+        &Som_Shadow_RearDiagnostics, Som_TpBuffer_RearDiagnostics,
+        6012UL, (uint32)sizeof(Som_RearDiagnosticsType),
+        SomConf_SomConsumedEventGroup_ZoneRearIo_Diagnostics, 0x2102U, 0x8002U
+    }
+};
+
+const uint16 Som_RxEventIndex[SOM_RX_EVENT_COUNT] =
+{
+    0U,   /* PedalInputs */
+    1U,   /* SteeringInput */
+    2U,   /* RearSensors */
+    3U    /* RearDiagnostics */
+};
+
+#if (SOM_PEER_CODECS == STD_ON)
+const Som_SerializeFctType Som_RxEventSerialize[SOM_RX_EVENT_COUNT] =
+{
+    Som_Serialize_PedalInputs,       /* PedalInputs */
+    Som_Serialize_SteeringInput,     /* SteeringInput */
+    Som_Serialize_RearSensors,       /* RearSensors */
+    Som_Serialize_RearDiagnostics    /* RearDiagnostics */
+};
+
+const Som_CheckFctType Som_TxEventCheck[SOM_TX_EVENT_COUNT] =
+{
+    Som_Check_VehicleMotion,     /* VehicleMotion */
+    Som_Check_PowertrainState,   /* PowertrainState */
+    Som_Check_BatteryStatus,     /* BatteryStatus */
+    Som_Check_DiagSnapshot       /* DiagSnapshot */
+};
+
+const Som_DeserializeFctType Som_TxEventDeserialize[SOM_TX_EVENT_COUNT] =
+{
+    Som_Deserialize_VehicleMotion,     /* VehicleMotion */
+    Som_Deserialize_PowertrainState,   /* PowertrainState */
+    Som_Deserialize_BatteryStatus,     /* BatteryStatus */
+    Som_Deserialize_DiagSnapshot       /* DiagSnapshot */
+};
+#endif
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
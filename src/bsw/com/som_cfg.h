@@ -0,0 +1,194 @@
+/**
+ * @file    som_cfg.h
+ * @brief   SOME/IP Configuration - Data Types and Handles
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * General parameters, data types and handles of the SOME/IP configuration of
+ * the VCU (local endpoint 192.168.10.1:30501, SD 239.192.255.251:30490):
+ *
+ * | Event                | Dir | Service                   | Group | Event ID | Type            | Bytes  | TP  |
+ * |----------------------|-----|---------------------------|-------|----------|-----------------|--------|-----|
+ * | VehicleMotion        | TX  | VehicleState 0x1101       | 1     | 0x8001   | VehicleMotion   | 19     | -   |
+ * | PowertrainState      | TX  | VehicleState 0x1101       | 1     | 0x8002   | PowertrainState | 38     | -   |
+ * | BatteryStatus        | TX  | VehicleState 0x1101       | 2     | 0x8003   | BatteryStatus   | <=508  | -   |
+ * | DiagSnapshot         | TX  | VehicleDiagnostics 0x1102 | 1     | 0x8010   | DiagSnapshot    | 4108   | yes |
+ * | PedalInputs          | RX  | ZoneFrontIo 0x2101        | 1     | 0x8001   | PedalInputs     | 17     | -   |
+ * | SteeringInput        | RX  | ZoneFrontIo 0x2101        | 1     | 0x8002   | SteeringInput   | 5      | -   |
+ * | RearSensors          | RX  | ZoneRearIo 0x2102         | 1     | 0x8001   | RearSensors     | 25     | -   |
+ * | RearDiagnostics      | RX  | ZoneRearIo 0x2102         | 2     | 0x8002   | RearDiagnostics | <=6012 | yes |
+ *
+ * @note Generated by tools/som/som_generator.py from config/autosar/communication/som.arxml - do not edit.
+ */
+
+#ifndef SOM_CFG_H
+#define SOM_CFG_H
+
+/* ===============================================================================================
+ *                                       GENERAL PARAMETERS
+ * =============================================================================================== */
+
+#define SOM_LOCAL_ADDRESS                               0xC0A80A01UL   /* 192.168.10.1 */
+#define SOM_LOCAL_PORT                                  30501U
+#define SOM_SD_MULTICAST_ADDRESS                        0xEFC0FFFBUL   /* 239.192.255.251 */
+#define SOM_SD_PORT                                     30490U
+
+#define SOM_MAX_DATAGRAM_LENGTH                         1400U
+#define SOM_TP_SEGMENT_LENGTH                           1376U
+#define SOM_TX_BUFFER_LENGTH                            4128U
+#define SOM_SD_MAX_ENTRIES                              10U
+
+#define SOM_MAIN_FUNCTION_PERIOD_MS                     5UL
+#define SOM_SD_INITIAL_DELAY_MS                         20UL
+#define SOM_SD_REPETITION_BASE_DELAY_MS                 30UL
+#define SOM_SD_REPETITIONS_MAX                          3U
+#define SOM_SD_CYCLIC_OFFER_DELAY_MS                    1000UL
+#define SOM_SD_OFFER_TTL                                3UL
+#define SOM_SD_SUBSCRIBE_TTL                            3UL
+#define SOM_MAX_SUBSCRIBERS                             4U
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define SOM_PROVIDED_SERVICE_COUNT                      2U
+#define SOM_CONSUMED_SERVICE_COUNT                      2U
+#define SOM_PROVIDED_EVENTGROUP_COUNT                   3U
+#define SOM_CONSUMED_EVENTGROUP_COUNT                   3U
+#define SOM_TX_EVENT_COUNT                              4U
+#define SOM_RX_EVENT_COUNT                              4U
+
+/* ===============================================================================================
+ *                                           DATA TYPES
+ * =============================================================================================== */
+
+/** @brief SomDataType VehicleMotion, 19 bytes serialized */
+typedef struct
+{
+    uint64  Timestamp;                           /**< Wire position 6 */
+    float32 YawRate;                             /**< Wire position 2 */
+    uint16  Speed;                               /**< Wire position 0 */
+    sint16  Acceleration;                        /**< Wire position 1 */
+    uint8   Gear;                                /**< Wire position 3 */
+    uint8   Direction;                           /**< Wire position 4 */
+    boolean Standstill;                          /**< Wire position 5 */
+} Som_VehicleMotionType;
+
+/** @brief SomDataType PowertrainState, 38 bytes serialized */
+typedef struct
+{
+    float32 TorqueRequest;                       /**< Wire position 0 */
+    float32 TorqueActual;                        /**< Wire position 1 */
+    float32 WheelTorque[4U];                     /**< Wire position 2 */
+    sint32  MotorSpeed;                          /**< Wire position 3 */
+    uint32  ActiveFaults;                        /**< Wire position 8 */
+    uint16  HvVoltage;                           /**< Wire position 4 */
+    sint16  HvCurrent;                           /**< Wire position 5 */
+    boolean DerateActive;                        /**< Wire position 6 */
+    uint8   DriveMode;                           /**< Wire position 7 */
+} Som_PowertrainStateType;
+
+/** @brief SomDataType BatteryStatus, at most 508 bytes serialized */
+typedef struct
+{
+    uint64  Timestamp;                           /**< Wire position 6 */
+    float32 PackVoltage;                         /**< Wire position 2 */
+    float32 PackCurrent;                         /**< Wire position 3 */
+    uint16  Soc;                                 /**< Wire position 0 */
+    uint16  Soh;                                 /**< Wire position 1 */
+    uint16  CellVoltages[192U];                  /**< Wire position 4, dynamic */
+    uint16  CellVoltagesLength;                  /**< Elements in CellVoltages */
+    uint16  CellTempsLength;                     /**< Elements in CellTemps */
+    sint8   CellTemps[96U];                      /**< Wire position 5, dynamic */
+} Som_BatteryStatusType;
+
+/** @brief SomDataType DiagSample, 8 bytes serialized */
+typedef struct
+{
+    uint32  Time;                                /**< Wire position 0 */
+    uint16  Channel;                             /**< Wire position 1 */
+    sint16  Value;                               /**< Wire position 2 */
+} Som_DiagSampleType;
+
+/** @brief SomDataType DiagSnapshot, 4108 bytes serialized */
+typedef struct
+{
+    uint64             Timestamp;                /**< Wire position 0 */
+    uint32             TriggerId;                /**< Wire position 1 */
+    Som_DiagSampleType Samples[512U];            /**< Wire position 2 */
+} Som_DiagSnapshotType;
+
+/** @brief SomDataType PedalInputs, 17 bytes serialized */
+typedef struct
+{
+    uint64  Timestamp;                           /**< Wire position 4 */
+    float32 BrakePressure;                       /**< Wire position 2 */
+    uint16  AccelPedal1;                         /**< Wire position 0 */
+    uint16  AccelPedal2;                         /**< Wire position 1 */
+    boolean BrakeSwitch;                         /**< Wire position 3 */
+} Som_PedalInputsType;
+
+/** @brief SomDataType SteeringInput, 5 bytes serialized */
+typedef struct
+{
+    sint16  Angle;                               /**< Wire position 0 */
+    sint16  AngleRate;                           /**< Wire position 1 */
+    boolean Valid;                               /**< Wire position 2 */
+} Som_SteeringInputType;
+
+/** @brief SomDataType RearSensors, 25 bytes serialized */
+typedef struct
+{
+    float64 AmbientTemp;                         /**< Wire position 2 */
+    uint16  ParkDistance[8U];                    /**< Wire position 0 */
+    boolean TrailerConnected;                    /**< Wire position 1 */
+} Som_RearSensorsType;
+
+/** @brief SomDataType RearDiagnostics, at most 6012 bytes serialized */
+typedef struct
+{
+    uint64  Timestamp;                           /**< Wire position 0 */
+    uint16  BlocksLength;                        /**< Elements in Blocks */
+    uint8   Blocks[6000U];                       /**< Wire position 1, dynamic */
+} Som_RearDiagnosticsType;
+
+/* ===============================================================================================
+ *                                    SERVICE INSTANCE HANDLES
+ * =============================================================================================== */
+
+#define SomConf_SomProvidedService_VehicleState         0U
+#define SomConf_SomProvidedService_VehicleDiagnostics   1U
+#define SomConf_SomConsumedService_ZoneFrontIo          0U
+#define SomConf_SomConsumedService_ZoneRearIo           1U
+
+/* ===============================================================================================
+ *                                      EVENT GROUP HANDLES
+ * =============================================================================================== */
+
+#define SomConf_SomProvidedEventGroup_VehicleState_Dynamics 0U
+#define SomConf_SomProvidedEventGroup_VehicleState_Energy 1U
+#define SomConf_SomProvidedEventGroup_VehicleDiagnostics_Logging 2U
+#define SomConf_SomConsumedEventGroup_ZoneFrontIo_Inputs 0U
+#define SomConf_SomConsumedEventGroup_ZoneRearIo_Sensors 1U
+#define SomConf_SomConsumedEventGroup_ZoneRearIo_Diagnostics 2U
+
+/* ===============================================================================================
+ *                        EVENT HANDLES (Som_SendEvent / Som_ReceiveEvent)
+ * =============================================================================================== */
+
+#define SomConf_SomTxEvent_VehicleMotion                0U
+#define SomConf_SomTxEvent_PowertrainState              1U
+#define SomConf_SomTxEvent_BatteryStatus                2U
+#define SomConf_SomTxEvent_DiagSnapshot                 3U
+#define SomConf_SomRxEvent_PedalInputs                  0U
+#define SomConf_SomRxEvent_SteeringInput                1U
+#define SomConf_SomRxEvent_RearSensors                  2U
+#define SomConf_SomRxEvent_RearDiagnostics              3U
+
+#endif /* SOM_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,160 @@
+/**
+ * @file    som_pack.h
+ * @brief   SOME/IP - Network Byte Order Primitives of the Generated Serializers
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Loads and stores of SOME/IP payload and header fields. SOME/IP transmits
+ * every integer and IEEE 754 float in big endian byte order without padding,
+ * so a field can start at any byte offset of the datagram:
+ *
+ * | Access          | Field                                | Cortex-M7 (little endian)  |
+ * |-----------------|--------------------------------------|----------------------------|
+ * | Be16            | uint16 / sint16                      | REV16 + STRH / LDRH        |
+ * | Be32            | uint32 / sint32, header words        | REV + STR / LDR            |
+ * | Be64            | uint64 / sint64                      | 2 x REV + STR / LDR        |
+ * | F32 / F64       | float32 / float64 as Be32 / Be64     | VMOV + Be32 / Be64         |
+ *
+ * Implementation Notes:
+ * - The words are copied with memcpy(), which the compiler turns into an
+ *   unaligned LDR/STR (Cortex-M7 supports unaligned word access on normal
+ *   memory); the byte swap is BYTE_SWAP32() selected by CPU_BYTE_ORDER
+ * - Floats are reinterpreted through memcpy() as well, never through a
+ *   pointer cast
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @see som_stack.h
+ * @see com_pack.h
+ */
+
+#ifndef SOM_PACK_H
+#define SOM_PACK_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include <string.h>
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    INLINE FUNCTIONS
+ * =============================================================================================== */
+
+/**
+ * @brief Store 2 bytes in network byte order
+ */
+STATIC_INLINE void Som_StoreBe16(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, uint16 Value)
+{
+    Dst[0] = (uint8)(Value >> 8U);
+    Dst[1] = (uint8)Value;
+}
+
+/**
+ * @brief Load 2 bytes in network byte order
+ */
+STATIC_INLINE uint16 Som_LoadBe16(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    return (uint16)(((uint16)Src[0] << 8U) | (uint16)Src[1]);
+}
+
+/**
+ * @brief Store 4 bytes in network byte order
+ */
+STATIC_INLINE void Som_StoreBe32(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, uint32 Value)
+{
+#if (CPU_BYTE_ORDER == LOW_BYTE_FIRST)
+    Value = BYTE_SWAP32(Value);
+#endif
+    (void)memcpy(Dst, &Value, sizeof(Value));
+}
+
+/**
+ * @brief Load 4 bytes in network byte order
+ */
+STATIC_INLINE uint32 Som_LoadBe32(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    uint32 value;
+
+    (void)memcpy(&value, Src, sizeof(value));
+#if (CPU_BYTE_ORDER == LOW_BYTE_FIRST)
+    value = BYTE_SWAP32(value);
+#endif
+    return value;
+}
+
+/**
+ * @brief Store 8 bytes in network byte order
+ */
+STATIC_INLINE void Som_StoreBe64(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, uint64 Value)
+{
+    Som_StoreBe32(Dst, (uint32)(Value >> 32U));
+    Som_StoreBe32(&Dst[4], (uint32)Value);
+}
+
+/**
+ * @brief Load 8 bytes in network byte order
+ */
+STATIC_INLINE uint64 Som_LoadBe64(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    return ((uint64)Som_LoadBe32(Src) << 32U) | (uint64)Som_LoadBe32(&Src[4]);
+}
+
+/**
+ * @brief Store an IEEE 754 single in network byte order
+ */
+STATIC_INLINE void Som_StoreF32(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, float32 Value)
+{
+    uint32 bits;
+
+    (void)memcpy(&bits, &Value, sizeof(bits));
+    Som_StoreBe32(Dst, bits);
+}
+
+/**
+ * @brief Load an IEEE 754 single in network byte order
+ */
+STATIC_INLINE float32 Som_LoadF32(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    uint32 bits = Som_LoadBe32(Src);
+    float32 value;
+
+    (void)memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Store an IEEE 754 double in network byte order
+ */
+STATIC_INLINE void Som_StoreF64(P2VAR(uint8, AUTOMATIC, AUTOMATIC) Dst, float64 Value)
+{
+    uint64 bits;
+
+    (void)memcpy(&bits, &Value, sizeof(bits));
+    Som_StoreBe64(Dst, bits);
+}
+
+/**
+ * @brief Load an IEEE 754 double in network byte order
+ */
+STATIC_INLINE float64 Som_LoadF64(P2CONST(uint8, AUTOMATIC, AUTOMATIC) Src)
+{
+    uint64 bits = Som_LoadBe64(Src);
+    float64 value;
+
+    (void)memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#endif /* SOM_PACK_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
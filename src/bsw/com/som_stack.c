@@ -0,0 +1,1576 @@
+/**
+ * @file    som_stack.c
+ * @brief   SOME/IP - Serialization, Service Discovery and Transport Protocol
+ * @version 1.0.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Services of som_stack.h. Messages (PRS SOME/IP, SOME/IP-SD, SOME/IP-TP):
+ *
+ * | Message              | Message ID      | Type | Payload                                  |
+ * |----------------------|-----------------|------|------------------------------------------|
+ * | Event                | service / event | 0x02 | Serialized data type                     |
+ * | Event segment (TP)   | service / event | 0x22 | Offset / more flag, segment              |
+ * | SD                   | 0xFFFF / 0x8100 | 0x02 | Flags, entries, IPv4 endpoint option     |
+ *
+ * SD state machines:
+ *
+ * | Side   | Phases                                    | Sends                                   |
+ * |--------|-------------------------------------------|-----------------------------------------|
+ * | Server | DOWN, INITIAL_WAIT, REPETITION, MAIN      | Offer (multicast, unicast on Find), Ack |
+ * | Client | SEARCH, WAIT, AVAILABLE                   | Find (SEARCH), Subscribe (AVAILABLE)    |
+ *
+ * Implementation Notes:
+ * - An event is serialized once, directly into Som_TxBuffer behind the
+ *   SOME/IP header, and the same datagram goes to every subscriber. Without
+ *   subscribers nothing is serialized
+ * - A TP event is serialized completely at offset 20. The header of segment
+ *   k is written in front of its data, over the tail of segment k - 1 that
+ *   Som_UdpTransmit() has already copied, so segmentation copies nothing
+ * - A received event is looked up by binary search over Som_RxEvent; its
+ *   length check runs on the datagram and only a valid payload is
+ *   deserialized into the shadow, under SOM_ENTER_CRITICAL()
+ * - Som_OfferService(), Som_StopOfferService(), Som_RxIndication() and
+ *   Som_MainFunction() run in one task. Som_SendEvent() and
+ *   Som_ReceiveEvent() may be called from any task: the subscribers and the
+ *   shadows are accessed under SOM_ENTER_CRITICAL(). Som_SendEvent() copies
+ *   the subscriber endpoints and claims Som_TxBuffer (Som_TxBusy) in the
+ *   critical section, then serializes and transmits with interrupts enabled;
+ *   a concurrent call finding the buffer busy returns E_NOT_OK
+ * - The SD messages are built in Som_SdBuffer; one reply message collects
+ *   the answers to all entries of a received SD message
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.0.1   | 2026-10-16 | BSW Team        | Send events outside the lock       |
+ *
+ * @see som_stack.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "som_stack.h"
+#include "som_pack.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define SOM_STACK_C_VENDOR_ID                   43U
+#define SOM_STACK_C_SW_MAJOR_VERSION            1U
+#define SOM_STACK_C_SW_MINOR_VERSION            0U
+#define SOM_STACK_C_SW_PATCH_VERSION            0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (SOM_STACK_C_VENDOR_ID != SOM_VENDOR_ID)
+    #error "som_stack.c and som_stack.h have different vendor IDs"
+#endif
+
+#if ((SOM_STACK_C_SW_MAJOR_VERSION != SOM_SW_MAJOR_VERSION) || \
+     (SOM_STACK_C_SW_MINOR_VERSION != SOM_SW_MINOR_VERSION) || \
+     (SOM_STACK_C_SW_PATCH_VERSION != SOM_SW_PATCH_VERSION))
+    #error "Software version mismatch between som_stack.c and som_stack.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (SOM_DEV_ERROR_DETECT == STD_ON)
+    #define SOM_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(SOM_MODULE_ID, SOM_INSTANCE_ID, (api), (err)))
+#else
+    #define SOM_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+#ifndef SOM_ENTER_CRITICAL
+    #define SOM_ENTER_CRITICAL(key)             ((key) = Os_Port_DisableInterrupts())
+    #define SOM_EXIT_CRITICAL(key)              Os_Port_RestoreInterrupts(key)
+#endif
+
+/* SOME/IP header */
+#define SOM_HEADER_LENGTH                       16U
+#define SOM_LENGTH_BASE                         8U      /**< Length field: request ID .. return code */
+#define SOM_PROTOCOL_VERSION                    0x01U
+#define SOM_MSG_NOTIFICATION                    0x02U
+#define SOM_MSG_TP_FLAG                         0x20U
+#define SOM_RETURN_OK                           0x00U
+
+/* SOME/IP-TP header */
+#define SOM_TP_HEADER_LENGTH                    4U
+#define SOM_TP_OFFSET_MASK                      0xFFFFFFF0UL
+#define SOM_TP_MORE_SEGMENTS                    0x00000001UL
+
+/* SOME/IP-SD message */
+#define SOM_SD_SERVICE_ID                       0xFFFFU
+#define SOM_SD_METHOD_ID                        0x8100U
+#define SOM_SD_INTERFACE_VERSION                0x01U
+#define SOM_SD_FLAG_REBOOT                      0x80U
+#define SOM_SD_FLAG_UNICAST                     0x40U
+#define SOM_SD_ENTRIES_OFFSET                   (SOM_HEADER_LENGTH + 8U)
+#define SOM_SD_ENTRY_LENGTH                     16U
+#define SOM_SD_OPTION_IPV4_LENGTH               12U
+#define SOM_SD_BUFFER_LENGTH                    (SOM_SD_ENTRIES_OFFSET + (SOM_SD_ENTRY_LENGTH * SOM_SD_MAX_ENTRIES) + \
+                                                 4U + SOM_SD_OPTION_IPV4_LENGTH)
+
+/* SOME/IP-SD entry and option types */
+#define SOM_SD_FIND_SERVICE                     0x00U
+#define SOM_SD_OFFER_SERVICE                    0x01U
+#define SOM_SD_SUBSCRIBE                        0x06U
+#define SOM_SD_SUBSCRIBE_ACK                    0x07U
+#define SOM_SD_IPV4_ENDPOINT                    0x04U
+#define SOM_SD_L4_UDP                           0x11U
+#define SOM_SD_ANY_INSTANCE                     0xFFFFU
+#define SOM_SD_ANY_MAJOR                        0xFFU
+
+/** @brief Longest TTL in ms that the wrap-safe time comparison supports (about 23 days) */
+#define SOM_SD_TTL_MAX_S                        2000000UL
+
+/* Phases of a provided service */
+#define SOM_SERVER_DOWN                         0U
+#define SOM_SERVER_INITIAL_WAIT                 1U
+#define SOM_SERVER_REPETITION                   2U
+#define SOM_SERVER_MAIN                         3U
+
+/* Phases of a consumed service */
+#define SOM_CLIENT_SEARCH                       0U      /**< Sending FindService */
+#define SOM_CLIENT_WAIT                         1U      /**< Waiting for an offer */
+#define SOM_CLIENT_AVAILABLE                    2U      /**< Offer valid */
+
+/** @brief No consumed event with the message ID */
+#define SOM_NO_EVENT                            0xFFFFU
+
+/** @brief TRUE once Now has reached Time (wrap-safe for half the millisecond range) */
+#define SOM_TIME_REACHED(now, time)             (((uint32)((now) - (time))) < 0x80000000UL)
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct Som_ServerType
+ * @brief SD server state of one provided service
+ */
+typedef struct
+{
+    uint32 timer;                               /**< Time of the next offer */
+    uint32 delay;                               /**< Current repetition delay */
+    uint8 phase;                                /**< SOM_SERVER_* */
+    uint8 repetitions;                          /**< Offers sent in the repetition phase */
+} Som_ServerType;
+
+/**
+ * @struct Som_SubscriberType
+ * @brief Cached subscription of a remote client to a provided event group
+ */
+typedef struct
+{
+    Som_EndpointType endpoint;                  /**< UDP endpoint of the client */
+    uint32 expiry;                              /**< End of the granted TTL */
+    boolean used;
+} Som_SubscriberType;
+
+/**
+ * @struct Som_ClientType
+ * @brief SD client state of one consumed service
+ */
+typedef struct
+{
+    Som_EndpointType sd_endpoint;               /**< SD endpoint of the server */
+    Som_EndpointType endpoint;                  /**< UDP endpoint of the server (offer option) */
+    uint32 timer;                               /**< SEARCH: next Find, AVAILABLE: offer expiry */
+    uint32 delay;                               /**< Current Find repetition delay */
+    uint16 session;                             /**< Last SD session ID of the server */
+    uint8 phase;                                /**< SOM_CLIENT_* */
+    uint8 repetitions;                          /**< Finds sent */
+    boolean reboot;                             /**< Reboot flag of the last SD message of the server */
+} Som_ClientType;
+
+/**
+ * @struct Som_ClientGroupType
+ * @brief Subscription state of one consumed event group
+ */
+typedef struct
+{
+    uint32 expiry;                              /**< SUBSCRIBED: end of the granted TTL */
+    uint32 renewal;                             /**< SUBSCRIBED: time of the next renewal */
+    uint8 state;                                /**< Som_EventGroupStateType */
+} Som_ClientGroupType;
+
+/**
+ * @struct Som_TpRxType
+ * @brief Reassembly of a segmented consumed event
+ */
+typedef struct
+{
+    uint32 next;                                /**< Offset of the next segment */
+    uint16 session;                             /**< Session ID of the message */
+    boolean active;
+} Som_TpRxType;
+
+/**
+ * @struct Som_SdMessageType
+ * @brief SD message being built in Som_SdBuffer
+ */
+typedef struct
+{
+    uint16 entries;                             /**< Entries written */
+    boolean option;                             /**< An entry refers to the local endpoint option */
+} Som_SdMessageType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after Som_Init() */
+STATIC boolean Som_Initialized = FALSE;
+
+/** @brief Time in ms, advanced by Som_MainFunction() */
+STATIC uint32 Som_Now;
+
+/** @brief Session ID of the next SD message and the reboot flag (set until the session wraps) */
+STATIC uint16 Som_SdSession;
+STATIC boolean Som_SdReboot;
+
+/** @brief Event datagram: header and serialized payload, TP segments in place */
+STATIC uint8 Som_TxBuffer[SOM_TX_BUFFER_LENGTH] ALIGNED(8);
+
+/** @brief Som_TxBuffer is in use by a Som_SendEvent() call; claimed under SOM_ENTER_CRITICAL() */
+STATIC volatile boolean Som_TxBusy;
+
+/** @brief SD message under construction */
+STATIC uint8 Som_SdBuffer[SOM_SD_BUFFER_LENGTH] ALIGNED(8);
+
+/** @brief Session ID of the last notification of each provided event */
+STATIC uint16 Som_TxSession[SOM_TX_EVENT_COUNT];
+
+STATIC Som_ServerType Som_Server[SOM_PROVIDED_SERVICE_COUNT];
+STATIC Som_SubscriberType Som_Subscriber[SOM_PROVIDED_EVENTGROUP_COUNT][SOM_MAX_SUBSCRIBERS];
+STATIC Som_ClientType Som_Client[SOM_CONSUMED_SERVICE_COUNT];
+STATIC Som_ClientGroupType Som_ClientGroup[SOM_CONSUMED_EVENTGROUP_COUNT];
+
+/** @brief Reception state of the consumed events, in the order of Som_RxEvent */
+STATIC boolean Som_RxReceived[SOM_RX_EVENT_COUNT];
+STATIC Som_TpRxType Som_TpRx[SOM_RX_EVENT_COUNT];
+
+STATIC Som_StatisticsType Som_Statistics;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Check that Som_Init() was called
+ */
+STATIC boolean Som_CheckInit(uint8 ApiId)
+{
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+
+    if (Som_Initialized == FALSE)
+    {
+        SOM_REPORT_ERROR(ApiId, SOM_E_UNINIT);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief TTL in seconds to ms, limited to SOM_SD_TTL_MAX_S
+ */
+STATIC uint32 Som_TtlMs(uint32 Ttl)
+{
+    return ((Ttl < SOM_SD_TTL_MAX_S) ? Ttl : SOM_SD_TTL_MAX_S) * 1000UL;
+}
+
+STATIC boolean Som_SameEndpoint(P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) A,
+    P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) B)
+{
+    return ((A->address == B->address) && (A->port == B->port)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Hand a datagram to the lower layer and count it
+ */
+STATIC void Som_Transmit(uint8 Socket, P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_VAR) Data, uint32 Length)
+{
+    Std_ReturnType result = Som_UdpTransmit(Socket, Remote, Data, (uint16)Length);
+    uint32 key;
+
+    SOM_ENTER_CRITICAL(key);
+    if (result == E_OK)
+    {
+        Som_Statistics.tx_messages++;
+    }
+    else
+    {
+        Som_Statistics.tx_errors++;
+    }
+    SOM_EXIT_CRITICAL(key);
+}
+
+STATIC void Som_Dropped(void)
+{
+    uint32 key;
+
+    SOM_ENTER_CRITICAL(key);
+    Som_Statistics.rx_dropped++;
+    SOM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Write a SOME/IP header
+ * @param[in] Length Bytes behind the header
+ */
+STATIC void Som_WriteHeader(P2VAR(uint8, AUTOMATIC, SOM_VAR) Msg, uint16 ServiceId, uint16 MethodId,
+    uint32 Length, uint16 Session, uint8 InterfaceVersion, uint8 Type)
+{
+    Som_StoreBe32(Msg, ((uint32)ServiceId << 16U) | (uint32)MethodId);
+    Som_StoreBe32(&Msg[4], SOM_LENGTH_BASE + Length);
+    Som_StoreBe32(&Msg[8], (uint32)Session);            /* Client ID 0 */
+    Msg[12] = SOM_PROTOCOL_VERSION;
+    Msg[13] = InterfaceVersion;
+    Msg[14] = Type;
+    Msg[15] = SOM_RETURN_OK;
+}
+
+/* ------------------------------------------------------------------------------------------------
+ * SD messages
+ * ------------------------------------------------------------------------------------------------ */
+
+STATIC void Som_SdBegin(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message)
+{
+    Message->entries = 0U;
+    Message->option = FALSE;
+}
+
+/**
+ * @brief Append an entry with the fields common to service and event group entries
+ * @return Entry, NULL_PTR if the message is full
+ */
+STATIC P2VAR(uint8, AUTOMATIC, SOM_VAR) Som_SdEntry(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message,
+    uint8 Type, P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) Service, uint32 Ttl, boolean Endpoint)
+{
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) entry;
+
+    if (Message->entries >= SOM_SD_MAX_ENTRIES)
+    {
+        return NULL_PTR;
+    }
+    entry = &Som_SdBuffer[SOM_SD_ENTRIES_OFFSET + (SOM_SD_ENTRY_LENGTH * (uint32)Message->entries)];
+    Message->entries++;
+
+    entry[0] = Type;
+    entry[1] = 0U;                                      /* First options run: index 0 */
+    entry[2] = 0U;
+    entry[3] = (Endpoint == TRUE) ? 0x10U : 0x00U;      /* One option in the first run */
+    Som_StoreBe16(&entry[4], Service->service_id);
+    Som_StoreBe16(&entry[6], Service->instance_id);
+    Som_StoreBe32(&entry[8], ((uint32)Service->major_version << 24U) | (Ttl & 0x00FFFFFFUL));
+    if (Endpoint == TRUE)
+    {
+        Message->option = TRUE;
+    }
+    return entry;
+}
+
+/**
+ * @brief Append a FindService or OfferService entry
+ */
+STATIC void Som_SdServiceEntry(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message, uint8 Type,
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) Service, uint32 Ttl)
+{
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) entry;
+
+    entry = Som_SdEntry(Message, Type, Service, Ttl, (Type == SOM_SD_OFFER_SERVICE) ? TRUE : FALSE);
+    if (entry != NULL_PTR)
+    {
+        Som_StoreBe32(&entry[12], Service->minor_version);
+    }
+}
+
+/**
+ * @brief Append a SubscribeEventgroup or SubscribeEventgroupAck entry
+ */
+STATIC void Som_SdEventGroupEntry(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message, uint8 Type,
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) Service, uint16 EventGroupId, uint32 Ttl)
+{
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) entry;
+
+    entry = Som_SdEntry(Message, Type, Service, Ttl, (Type == SOM_SD_SUBSCRIBE) ? TRUE : FALSE);
+    if (entry != NULL_PTR)
+    {
+        Som_StoreBe32(&entry[12], (uint32)EventGroupId);  /* Reserved, counter 0 */
+    }
+}
+
+/**
+ * @brief Complete the SD message with header and endpoint option and send it
+ */
+STATIC void Som_SdSend(P2CONST(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message,
+    P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote)
+{
+    uint32 entries = SOM_SD_ENTRY_LENGTH * (uint32)Message->entries;
+    uint32 options = (Message->option == TRUE) ? SOM_SD_OPTION_IPV4_LENGTH : 0U;
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) option = &Som_SdBuffer[SOM_SD_ENTRIES_OFFSET + entries];
+    uint32 length = SOM_SD_ENTRIES_OFFSET + entries + 4U + options;
+
+    if (Message->entries == 0U)
+    {
+        return;
+    }
+
+    Som_WriteHeader(Som_SdBuffer, SOM_SD_SERVICE_ID, SOM_SD_METHOD_ID, length - SOM_HEADER_LENGTH,
+                    Som_SdSession, SOM_SD_INTERFACE_VERSION, SOM_MSG_NOTIFICATION);
+    Som_StoreBe32(&Som_SdBuffer[SOM_HEADER_LENGTH],
+                  ((uint32)(((Som_SdReboot == TRUE) ? SOM_SD_FLAG_REBOOT : 0U) | SOM_SD_FLAG_UNICAST)) << 24U);
+    Som_StoreBe32(&Som_SdBuffer[SOM_HEADER_LENGTH + 4U], entries);
+    Som_StoreBe32(option, options);
+    if (options != 0U)
+    {
+        Som_StoreBe16(&option[4], 0x0009U);             /* Length: type .. port */
+        option[6] = SOM_SD_IPV4_ENDPOINT;
+        option[7] = 0U;
+        Som_StoreBe32(&option[8], SOM_LOCAL_ADDRESS);
+        option[12] = 0U;
+        option[13] = SOM_SD_L4_UDP;
+        Som_StoreBe16(&option[14], SOM_LOCAL_PORT);
+    }
+
+    Som_Transmit(SOM_SOCKET_SD, Remote, Som_SdBuffer, length);
+
+    if (Som_SdSession == 0xFFFFU)
+    {
+        Som_SdSession = 1U;
+        Som_SdReboot = FALSE;
+    }
+    else
+    {
+        Som_SdSession++;
+    }
+}
+
+/**
+ * @brief First IPv4 UDP endpoint among the options an entry refers to
+ * @return TRUE if found
+ */
+STATIC boolean Som_SdEndpoint(P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Entry,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Options, uint32 OptionsLength,
+    P2VAR(Som_EndpointType, AUTOMATIC, AUTOMATIC) Endpoint)
+{
+    uint32 first[2];
+    uint32 count[2];
+    uint32 pos = 0U;
+    uint32 index = 0U;
+    uint32 run;
+
+    first[0] = Entry[1];
+    first[1] = Entry[2];
+    count[0] = (uint32)Entry[3] >> 4U;
+    count[1] = (uint32)Entry[3] & 0x0FU;
+
+    while ((pos + 3U) <= OptionsLength)
+    {
+        uint32 length = (uint32)Som_LoadBe16(&Options[pos]) + 3U;
+
+        if ((pos + length) > OptionsLength)
+        {
+            return FALSE;
+        }
+        for (run = 0U; run < 2U; run++)
+        {
+            if ((index >= first[run]) && (index < (first[run] + count[run])) &&
+                (length == SOM_SD_OPTION_IPV4_LENGTH) && (Options[pos + 2U] == SOM_SD_IPV4_ENDPOINT) &&
+                (Options[pos + 9U] == SOM_SD_L4_UDP))
+            {
+                Endpoint->address = Som_LoadBe32(&Options[pos + 4U]);
+                Endpoint->port = Som_LoadBe16(&Options[pos + 10U]);
+                return TRUE;
+            }
+        }
+        pos += length;
+        index++;
+    }
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------------------------------
+ * SD server
+ * ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief Drop all subscribers of the event groups of a provided service
+ */
+STATIC void Som_ServerDropSubscribers(Som_ServiceIdType Service)
+{
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_ProvidedService[Service];
+    uint16 group;
+    uint32 key;
+
+    SOM_ENTER_CRITICAL(key);
+    for (group = cfg->eventgroup_first; group < (cfg->eventgroup_first + cfg->eventgroup_count); group++)
+    {
+        (void)memset(Som_Subscriber[group], 0, sizeof(Som_Subscriber[group]));
+    }
+    SOM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Add or renew the subscription of a client to a provided event group
+ * @return FALSE if all subscriber slots are taken
+ */
+STATIC boolean Som_ServerSubscribe(uint16 Group, P2CONST(Som_EndpointType, AUTOMATIC, AUTOMATIC) Endpoint,
+    uint32 Ttl)
+{
+    P2VAR(Som_SubscriberType, AUTOMATIC, SOM_VAR) slot = NULL_PTR;
+    boolean result = TRUE;
+    uint8 index;
+    uint32 key;
+
+    SOM_ENTER_CRITICAL(key);
+    for (index = 0U; index < SOM_MAX_SUBSCRIBERS; index++)
+    {
+        P2VAR(Som_SubscriberType, AUTOMATIC, SOM_VAR) sub = &Som_Subscriber[Group][index];
+
+        if ((sub->used == TRUE) && (Som_SameEndpoint(&sub->endpoint, Endpoint) == TRUE))
+        {
+            slot = sub;                                 /* Renewal of a cached subscription */
+            break;
+        }
+        if ((sub->used == FALSE) && (slot == NULL_PTR))
+        {
+            slot = sub;
+        }
+    }
+    if (slot != NULL_PTR)
+    {
+        slot->endpoint = *Endpoint;
+        slot->expiry = Som_Now + Som_TtlMs(Ttl);
+        slot->used = TRUE;
+    }
+    else
+    {
+        result = FALSE;
+    }
+    SOM_EXIT_CRITICAL(key);
+    return result;
+}
+
+STATIC void Som_ServerUnsubscribe(uint16 Group, P2CONST(Som_EndpointType, AUTOMATIC, AUTOMATIC) Endpoint)
+{
+    uint8 index;
+    uint32 key;
+
+    SOM_ENTER_CRITICAL(key);
+    for (index = 0U; index < SOM_MAX_SUBSCRIBERS; index++)
+    {
+        P2VAR(Som_SubscriberType, AUTOMATIC, SOM_VAR) sub = &Som_Subscriber[Group][index];
+
+        if ((sub->used == TRUE) && (Som_SameEndpoint(&sub->endpoint, Endpoint) == TRUE))
+        {
+            sub->used = FALSE;
+        }
+    }
+    SOM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Provided service of an SD entry
+ * @return Handle, SOM_PROVIDED_SERVICE_COUNT if none
+ */
+STATIC Som_ServiceIdType Som_ServerFind(P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Entry)
+{
+    uint16 service_id = Som_LoadBe16(&Entry[4]);
+    uint16 instance_id = Som_LoadBe16(&Entry[6]);
+    uint8 major = Entry[8];
+    Som_ServiceIdType service;
+
+    for (service = 0U; service < SOM_PROVIDED_SERVICE_COUNT; service++)
+    {
+        P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_ProvidedService[service];
+
+        if ((cfg->service_id == service_id) &&
+            ((instance_id == cfg->instance_id) || (instance_id == SOM_SD_ANY_INSTANCE)) &&
+            ((major == cfg->major_version) || (major == SOM_SD_ANY_MAJOR)))
+        {
+            return service;
+        }
+    }
+    return SOM_PROVIDED_SERVICE_COUNT;
+}
+
+/**
+ * @brief Answer a FindService or SubscribeEventgroup entry
+ */
+STATIC void Som_ServerEntry(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Reply,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Entry, uint32 Ttl,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Options, uint32 OptionsLength)
+{
+    Som_ServiceIdType service = Som_ServerFind(Entry);
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg;
+    Som_EndpointType endpoint;
+    uint16 eventgroup_id;
+    uint16 group;
+
+    if ((service >= SOM_PROVIDED_SERVICE_COUNT) || (Som_Server[service].phase == SOM_SERVER_DOWN))
+    {
+        if (Entry[0] == SOM_SD_SUBSCRIBE)
+        {
+            Som_Dropped();
+        }
+        return;
+    }
+    cfg = &Som_ProvidedService[service];
+
+    if (Entry[0] == SOM_SD_FIND_SERVICE)
+    {
+        if (Som_Server[service].phase != SOM_SERVER_INITIAL_WAIT)
+        {
+            Som_SdServiceEntry(Reply, SOM_SD_OFFER_SERVICE, cfg, SOM_SD_OFFER_TTL);
+        }
+        return;
+    }
+
+    eventgroup_id = Som_LoadBe16(&Entry[14]);
+    for (group = cfg->eventgroup_first; group < (cfg->eventgroup_first + cfg->eventgroup_count); group++)
+    {
+        if (Som_ProvidedEventGroup[group].eventgroup_id == eventgroup_id)
+        {
+            break;
+        }
+    }
+    if ((group == (cfg->eventgroup_first + cfg->eventgroup_count)) ||
+        (Som_SdEndpoint(Entry, Options, OptionsLength, &endpoint) == FALSE))
+    {
+        Som_SdEventGroupEntry(Reply, SOM_SD_SUBSCRIBE_ACK, cfg, eventgroup_id, 0U);     /* Nack */
+        return;
+    }
+
+    if (Ttl == 0U)
+    {
+        Som_ServerUnsubscribe(group, &endpoint);        /* StopSubscribeEventgroup */
+    }
+    else if (Som_ServerSubscribe(group, &endpoint, Ttl) == TRUE)
+    {
+        Som_SdEventGroupEntry(Reply, SOM_SD_SUBSCRIBE_ACK, cfg, eventgroup_id, Ttl);
+    }
+    else
+    {
+        Som_SdEventGroupEntry(Reply, SOM_SD_SUBSCRIBE_ACK, cfg, eventgroup_id, 0U);     /* Nack: no slot */
+    }
+}
+
+/**
+ * @brief Offers due in this main function (server phases)
+ */
+STATIC void Som_ServerMain(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message)
+{
+    Som_ServiceIdType service;
+    uint16 group;
+    uint8 index;
+    uint32 key;
+
+    for (service = 0U; service < SOM_PROVIDED_SERVICE_COUNT; service++)
+    {
+        P2VAR(Som_ServerType, AUTOMATIC, SOM_VAR) server = &Som_Server[service];
+
+        if ((server->phase == SOM_SERVER_DOWN) || (SOM_TIME_REACHED(Som_Now, server->timer) == FALSE))
+        {
+            continue;
+        }
+        Som_SdServiceEntry(Message, SOM_SD_OFFER_SERVICE, &Som_ProvidedService[service], SOM_SD_OFFER_TTL);
+
+        if (server->phase == SOM_SERVER_INITIAL_WAIT)
+        {
+            server->phase = SOM_SERVER_REPETITION;
+            server->repetitions = 0U;
+            server->delay = SOM_SD_REPETITION_BASE_DELAY_MS;
+        }
+        else if (server->phase == SOM_SERVER_REPETITION)
+        {
+            server->repetitions++;
+            server->delay *= 2U;
+        }
+        else
+        {
+            /* Main phase: cyclic offers */
+        }
+        if ((server->phase == SOM_SERVER_REPETITION) && (server->repetitions >= SOM_SD_REPETITIONS_MAX))
+        {
+            server->phase = SOM_SERVER_MAIN;
+        }
+        server->timer = Som_Now + ((server->phase == SOM_SERVER_MAIN) ? SOM_SD_CYCLIC_OFFER_DELAY_MS : server->delay);
+    }
+
+    SOM_ENTER_CRITICAL(key);
+    for (group = 0U; group < SOM_PROVIDED_EVENTGROUP_COUNT; group++)
+    {
+        for (index = 0U; index < SOM_MAX_SUBSCRIBERS; index++)
+        {
+            P2VAR(Som_SubscriberType, AUTOMATIC, SOM_VAR) sub = &Som_Subscriber[group][index];
+
+            if ((sub->used == TRUE) && (SOM_TIME_REACHED(Som_Now, sub->expiry) == TRUE))
+            {
+                sub->used = FALSE;                      /* TTL expired without renewal */
+            }
+        }
+    }
+    SOM_EXIT_CRITICAL(key);
+}
+
+/* ------------------------------------------------------------------------------------------------
+ * SD client
+ * ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief Service lost (StopOffer, TTL expired or server reboot): event groups down
+ */
+STATIC void Som_ClientDown(Som_ServiceIdType Service)
+{
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_ConsumedService[Service];
+    uint16 group;
+    uint16 index;
+
+    Som_Client[Service].phase = SOM_CLIENT_WAIT;
+    for (group = cfg->eventgroup_first; group < (cfg->eventgroup_first + cfg->eventgroup_count); group++)
+    {
+        Som_ClientGroup[group].state = (uint8)SOM_EVENTGROUP_DOWN;
+    }
+    for (index = 0U; index < SOM_RX_EVENT_COUNT; index++)
+    {
+        if (Som_ConsumedEventGroup[Som_RxEvent[index].eventgroup].service == Service)
+        {
+            Som_TpRx[index].active = FALSE;
+        }
+    }
+}
+
+/**
+ * @brief Subscribe the event groups of an available service
+ * @param[in] Renew TRUE: only renew subscribed groups whose renewal is due
+ *                  (main function), FALSE: also (re)request the groups not
+ *                  subscribed (offer received)
+ */
+STATIC void Som_ClientSubscribe(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message, Som_ServiceIdType Service,
+    boolean Renew)
+{
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_ConsumedService[Service];
+    uint16 group;
+
+    for (group = cfg->eventgroup_first; group < (cfg->eventgroup_first + cfg->eventgroup_count); group++)
+    {
+        P2VAR(Som_ClientGroupType, AUTOMATIC, SOM_VAR) state = &Som_ClientGroup[group];
+
+        if (state->state == (uint8)SOM_EVENTGROUP_SUBSCRIBED)
+        {
+            if (SOM_TIME_REACHED(Som_Now, state->renewal) == FALSE)
+            {
+                continue;                               /* Cached subscription still fresh */
+            }
+            /* Retry after a quarter of the TTL if the acknowledge is lost */
+            state->renewal = Som_Now + (Som_TtlMs(SOM_SD_SUBSCRIBE_TTL) / 4U);
+        }
+        else if (Renew == TRUE)
+        {
+            continue;                                   /* Requested again on the next offer */
+        }
+        else
+        {
+            state->state = (uint8)SOM_EVENTGROUP_REQUESTED;
+        }
+        Som_SdEventGroupEntry(Message, SOM_SD_SUBSCRIBE, cfg, Som_ConsumedEventGroup[group].eventgroup_id,
+                              SOM_SD_SUBSCRIBE_TTL);
+    }
+}
+
+/**
+ * @brief Consumed service of an SD entry
+ * @return Handle, SOM_CONSUMED_SERVICE_COUNT if none
+ */
+STATIC Som_ServiceIdType Som_ClientFind(P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Entry)
+{
+    uint16 service_id = Som_LoadBe16(&Entry[4]);
+    uint16 instance_id = Som_LoadBe16(&Entry[6]);
+    Som_ServiceIdType service;
+
+    for (service = 0U; service < SOM_CONSUMED_SERVICE_COUNT; service++)
+    {
+        P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_ConsumedService[service];
+
+        if ((cfg->service_id == service_id) && (cfg->instance_id == instance_id) &&
+            (cfg->major_version == Entry[8]))
+        {
+            return service;
+        }
+    }
+    return SOM_CONSUMED_SERVICE_COUNT;
+}
+
+/**
+ * @brief Process an OfferService or SubscribeEventgroupAck entry
+ */
+STATIC void Som_ClientEntry(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Reply,
+    P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Entry, uint32 Ttl,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Options, uint32 OptionsLength)
+{
+    Som_ServiceIdType service = Som_ClientFind(Entry);
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) cfg;
+    P2VAR(Som_ClientType, AUTOMATIC, SOM_VAR) client;
+    uint16 group;
+
+    if (service >= SOM_CONSUMED_SERVICE_COUNT)
+    {
+        return;                                         /* Service of another client */
+    }
+    cfg = &Som_ConsumedService[service];
+    client = &Som_Client[service];
+
+    if (Entry[0] == SOM_SD_OFFER_SERVICE)
+    {
+        Som_EndpointType endpoint;
+
+        if (Ttl == 0U)
+        {
+            Som_ClientDown(service);                    /* StopOfferService */
+        }
+        else if (Som_SdEndpoint(Entry, Options, OptionsLength, &endpoint) == TRUE)
+        {
+            client->phase = SOM_CLIENT_AVAILABLE;
+            client->sd_endpoint = *Remote;
+            client->endpoint = endpoint;
+            client->timer = Som_Now + Som_TtlMs(Ttl);
+            Som_ClientSubscribe(Reply, service, FALSE);
+        }
+        else
+        {
+            Som_Dropped();                              /* Offer without UDP endpoint */
+        }
+        return;
+    }
+
+    for (group = cfg->eventgroup_first; group < (cfg->eventgroup_first + cfg->eventgroup_count); group++)
+    {
+        P2VAR(Som_ClientGroupType, AUTOMATIC, SOM_VAR) state = &Som_ClientGroup[group];
+
+        if ((Som_ConsumedEventGroup[group].eventgroup_id != Som_LoadBe16(&Entry[14])) ||
+            (state->state == (uint8)SOM_EVENTGROUP_DOWN))
+        {
+            continue;
+        }
+        if (Ttl != 0U)
+        {
+            state->state = (uint8)SOM_EVENTGROUP_SUBSCRIBED;
+            state->expiry = Som_Now + Som_TtlMs(Ttl);
+            state->renewal = Som_Now + (Som_TtlMs(Ttl) / 2U);   /* Renew at half of the TTL */
+        }
+        else
+        {
+            state->state = (uint8)SOM_EVENTGROUP_REQUESTED;  /* Nack: retried on the next offer */
+        }
+    }
+}
+
+/**
+ * @brief Detect a reboot of the servers behind an SD endpoint (PRS_SOMEIPSD_00399)
+ */
+STATIC void Som_ClientRebootCheck(P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    uint16 Session, boolean Reboot)
+{
+    Som_ServiceIdType service;
+
+    for (service = 0U; service < SOM_CONSUMED_SERVICE_COUNT; service++)
+    {
+        P2VAR(Som_ClientType, AUTOMATIC, SOM_VAR) client = &Som_Client[service];
+
+        if (client->phase == SOM_CLIENT_AVAILABLE)
+        {
+            if (Som_SameEndpoint(&client->sd_endpoint, Remote) == FALSE)
+            {
+                continue;                               /* Message of another server */
+            }
+            if ((Reboot == TRUE) && ((client->reboot == FALSE) || (Session <= client->session)))
+            {
+                Som_ClientDown(service);
+            }
+        }
+        /* Not available: an offer in this message makes Remote the server */
+        client->session = Session;
+        client->reboot = Reboot;
+    }
+}
+
+/**
+ * @brief Finds, offer expiry and subscription expiry due in this main function
+ */
+STATIC void Som_ClientMain(P2VAR(Som_SdMessageType, AUTOMATIC, AUTOMATIC) Message)
+{
+    Som_ServiceIdType service;
+    uint16 group;
+
+    for (group = 0U; group < SOM_CONSUMED_EVENTGROUP_COUNT; group++)
+    {
+        if ((Som_ClientGroup[group].state == (uint8)SOM_EVENTGROUP_SUBSCRIBED) &&
+            (SOM_TIME_REACHED(Som_Now, Som_ClientGroup[group].expiry) == TRUE))
+        {
+            Som_ClientGroup[group].state = (uint8)SOM_EVENTGROUP_REQUESTED;  /* Renewals not acknowledged */
+        }
+    }
+
+    for (service = 0U; service < SOM_CONSUMED_SERVICE_COUNT; service++)
+    {
+        P2VAR(Som_ClientType, AUTOMATIC, SOM_VAR) client = &Som_Client[service];
+
+        if ((client->phase == SOM_CLIENT_SEARCH) && (SOM_TIME_REACHED(Som_Now, client->timer) == TRUE))
+        {
+            Som_SdServiceEntry(Message, SOM_SD_FIND_SERVICE, &Som_ConsumedService[service], SOM_SD_OFFER_TTL);
+            client->repetitions++;
+            client->timer = Som_Now + client->delay;
+            client->delay *= 2U;
+            if (client->repetitions > SOM_SD_REPETITIONS_MAX)
+            {
+                client->phase = SOM_CLIENT_WAIT;        /* Further offers are cyclic */
+            }
+        }
+        else if ((client->phase == SOM_CLIENT_AVAILABLE) && (SOM_TIME_REACHED(Som_Now, client->timer) == TRUE))
+        {
+            Som_ClientDown(service);                    /* Offer TTL expired */
+        }
+        else
+        {
+            /* Renewals are sent per server below */
+        }
+    }
+}
+
+/**
+ * @brief Renew the subscriptions that have used half of their TTL, one message per server
+ */
+STATIC void Som_ClientRenew(void)
+{
+    Som_SdMessageType message;
+    Som_ServiceIdType service;
+
+    for (service = 0U; service < SOM_CONSUMED_SERVICE_COUNT; service++)
+    {
+        if (Som_Client[service].phase == SOM_CLIENT_AVAILABLE)
+        {
+            Som_SdBegin(&message);
+            Som_ClientSubscribe(&message, service, TRUE);
+            Som_SdSend(&message, &Som_Client[service].sd_endpoint);
+        }
+    }
+}
+
+/**
+ * @brief Process a received SD message
+ */
+STATIC void Som_SdRxIndication(P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Msg, uint32 Length)
+{
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) options;
+    Som_SdMessageType reply;
+    uint32 entries;
+    uint32 options_length;
+    uint32 pos;
+
+    if (Length < (SOM_SD_ENTRIES_OFFSET + 4U))
+    {
+        Som_Dropped();
+        return;
+    }
+    entries = Som_LoadBe32(&Msg[SOM_HEADER_LENGTH + 4U]);
+    if (((entries % SOM_SD_ENTRY_LENGTH) != 0U) || (entries > (Length - SOM_SD_ENTRIES_OFFSET - 4U)))
+    {
+        Som_Dropped();
+        return;
+    }
+    options_length = Som_LoadBe32(&Msg[SOM_SD_ENTRIES_OFFSET + entries]);
+    if (options_length > (Length - SOM_SD_ENTRIES_OFFSET - entries - 4U))
+    {
+        Som_Dropped();
+        return;
+    }
+    options = &Msg[SOM_SD_ENTRIES_OFFSET + entries + 4U];
+
+    Som_ClientRebootCheck(Remote, Som_LoadBe16(&Msg[10]),
+                          ((Msg[SOM_HEADER_LENGTH] & SOM_SD_FLAG_REBOOT) != 0U) ? TRUE : FALSE);
+
+    Som_SdBegin(&reply);
+    for (pos = SOM_SD_ENTRIES_OFFSET; pos < (SOM_SD_ENTRIES_OFFSET + entries); pos += SOM_SD_ENTRY_LENGTH)
+    {
+        P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) entry = &Msg[pos];
+        uint32 ttl = Som_LoadBe32(&entry[8]) & 0x00FFFFFFUL;
+
+        switch (entry[0])
+        {
+            case SOM_SD_FIND_SERVICE:
+            case SOM_SD_SUBSCRIBE:
+                Som_ServerEntry(&reply, entry, ttl, options, options_length);
+                break;
+            case SOM_SD_OFFER_SERVICE:
+            case SOM_SD_SUBSCRIBE_ACK:
+                Som_ClientEntry(&reply, Remote, entry, ttl, options, options_length);
+                break;
+            default:
+                break;                                  /* Entry type not used */
+        }
+    }
+    Som_SdSend(&reply, Remote);
+}
+
+/* ------------------------------------------------------------------------------------------------
+ * Events
+ * ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief Consumed event of a message ID (binary search over Som_RxEvent)
+ * @return Index into Som_RxEvent, SOM_NO_EVENT if none
+ */
+STATIC uint16 Som_FindRxEvent(uint16 ServiceId, uint16 EventId)
+{
+    uint32 key = ((uint32)ServiceId << 16U) | (uint32)EventId;
+    uint16 low = 0U;
+    uint16 high = SOM_RX_EVENT_COUNT;
+
+    while (low < high)
+    {
+        uint16 mid = (uint16)((low + high) / 2U);
+        uint32 mid_key = ((uint32)Som_RxEvent[mid].service_id << 16U) | (uint32)Som_RxEvent[mid].event_id;
+
+        if (mid_key == key)
+        {
+            return mid;
+        }
+        if (mid_key < key)
+        {
+            low = (uint16)(mid + 1U);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return SOM_NO_EVENT;
+}
+
+/**
+ * @brief Check a complete payload and deserialize it into the shadow
+ */
+STATIC void Som_Deliver(uint16 Index, P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Payload, uint32 Length)
+{
+    P2CONST(Som_RxEventConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_RxEvent[Index];
+    uint32 key;
+
+    if (cfg->check(Payload, Length) == SOM_SER_ERROR)
+    {
+        Som_Dropped();
+        return;
+    }
+    SOM_ENTER_CRITICAL(key);
+    cfg->deserialize(Payload, cfg->shadow);
+    Som_RxReceived[Index] = TRUE;
+    SOM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Reassemble a segment of a TP event; the last one delivers the event
+ */
+STATIC void Som_TpRxIndication(uint16 Index, uint16 Session, P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Payload,
+    uint32 Length)
+{
+    P2CONST(Som_RxEventConfigType, AUTOMATIC, SOM_CONST) cfg = &Som_RxEvent[Index];
+    P2VAR(Som_TpRxType, AUTOMATIC, SOM_VAR) tp = &Som_TpRx[Index];
+    uint32 word;
+    uint32 offset;
+    uint32 segment;
+    boolean more;
+
+    if (Length < SOM_TP_HEADER_LENGTH)
+    {
+        Som_Dropped();
+        return;
+    }
+    word = Som_LoadBe32(Payload);
+    offset = word & SOM_TP_OFFSET_MASK;
+    more = ((word & SOM_TP_MORE_SEGMENTS) != 0U) ? TRUE : FALSE;
+    segment = Length - SOM_TP_HEADER_LENGTH;
+
+    if (offset == 0U)
+    {
+        tp->active = TRUE;
+        tp->session = Session;
+        tp->next = 0U;
+    }
+    if ((tp->active == FALSE) || (tp->session != Session) || (offset != tp->next) ||
+        ((more == TRUE) && ((segment % 16U) != 0U)) || (segment > (cfg->max_length - offset)))
+    {
+        tp->active = FALSE;                             /* Lost, reordered or oversized segment */
+        Som_Dropped();
+        return;
+    }
+
+    (void)memcpy(&cfg->tp_buffer[offset], &Payload[SOM_TP_HEADER_LENGTH], segment);
+    tp->next = offset + segment;
+    if (more == FALSE)
+    {
+        tp->active = FALSE;
+        Som_Deliver(Index, cfg->tp_buffer, tp->next);
+    }
+}
+
+/**
+ * @brief Process a received notification
+ */
+STATIC void Som_EventRxIndication(P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Msg, uint32 Length)
+{
+    uint16 index = Som_FindRxEvent(Som_LoadBe16(Msg), Som_LoadBe16(&Msg[2]));
+    P2CONST(Som_RxEventConfigType, AUTOMATIC, SOM_CONST) cfg;
+    Som_ServiceIdType service;
+
+    if (index == SOM_NO_EVENT)
+    {
+        Som_Dropped();
+        return;
+    }
+    cfg = &Som_RxEvent[index];
+    service = Som_ConsumedEventGroup[cfg->eventgroup].service;
+    if ((Som_Client[service].phase != SOM_CLIENT_AVAILABLE) ||
+        (Msg[13] != Som_ConsumedService[service].major_version))
+    {
+        Som_Dropped();
+        return;
+    }
+
+    if ((Msg[14] & SOM_MSG_TP_FLAG) == 0U)
+    {
+        Som_Deliver(index, &Msg[SOM_HEADER_LENGTH], Length - SOM_HEADER_LENGTH);
+    }
+    else if (cfg->tp_buffer != NULL_PTR)
+    {
+        Som_TpRxIndication(index, Som_LoadBe16(&Msg[10]), &Msg[SOM_HEADER_LENGTH], Length - SOM_HEADER_LENGTH);
+    }
+    else
+    {
+        Som_Dropped();
+    }
+}
+
+/**
+ * @brief Send a notification in Som_TxBuffer at Msg to the subscriber endpoints taken by Som_SendEvent()
+ */
+STATIC void Som_SendToSubscribers(P2CONST(Som_EndpointType, AUTOMATIC, SOM_VAR) Endpoints, uint8 Count,
+    P2CONST(uint8, AUTOMATIC, SOM_VAR) Msg, uint32 Length)
+{
+    uint8 index;
+
+    for (index = 0U; index < Count; index++)
+    {
+        Som_Transmit(SOM_SOCKET_EVENT, &Endpoints[index], Msg, Length);
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize SOME/IP
+ */
+void Som_Init(void)
+{
+    Som_ServiceIdType service;
+    uint16 group;
+
+    (void)memset(Som_Server, 0, sizeof(Som_Server));
+    (void)memset(Som_Subscriber, 0, sizeof(Som_Subscriber));
+    (void)memset(Som_Client, 0, sizeof(Som_Client));
+    (void)memset(Som_ClientGroup, 0, sizeof(Som_ClientGroup));
+    (void)memset(Som_RxReceived, 0, sizeof(Som_RxReceived));
+    (void)memset(Som_TpRx, 0, sizeof(Som_TpRx));
+    (void)memset(Som_TxSession, 0, sizeof(Som_TxSession));
+    (void)memset(&Som_Statistics, 0, sizeof(Som_Statistics));
+
+    Som_Now = 0U;
+    Som_TxBusy = FALSE;
+    Som_SdSession = 1U;
+    Som_SdReboot = TRUE;
+    for (service = 0U; service < SOM_CONSUMED_SERVICE_COUNT; service++)
+    {
+        Som_Client[service].phase = SOM_CLIENT_SEARCH;
+        Som_Client[service].timer = SOM_SD_INITIAL_DELAY_MS;
+        Som_Client[service].delay = SOM_SD_REPETITION_BASE_DELAY_MS;
+    }
+    for (group = 0U; group < SOM_CONSUMED_EVENTGROUP_COUNT; group++)
+    {
+        Som_ClientGroup[group].state = (uint8)SOM_EVENTGROUP_DOWN;
+    }
+
+    Som_Initialized = TRUE;
+}
+
+/**
+ * @brief Start offering a provided service
+ */
+Std_ReturnType Som_OfferService(Som_ServiceIdType Service)
+{
+    if (Som_CheckInit(SOM_OFFER_SERVICE_API_ID) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    if (Service >= SOM_PROVIDED_SERVICE_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_OFFER_SERVICE_API_ID, SOM_E_PARAM);
+        return E_NOT_OK;
+    }
+
+    if (Som_Server[Service].phase == SOM_SERVER_DOWN)
+    {
+        Som_Server[Service].phase = SOM_SERVER_INITIAL_WAIT;
+        Som_Server[Service].timer = Som_Now + SOM_SD_INITIAL_DELAY_MS;
+    }
+    return E_OK;
+}
+
+/**
+ * @brief Stop offering a provided service
+ */
+void Som_StopOfferService(Som_ServiceIdType Service)
+{
+    Som_SdMessageType message;
+    Som_EndpointType multicast;
+
+    if (Som_CheckInit(SOM_STOP_OFFER_SERVICE_API_ID) == FALSE)
+    {
+        return;
+    }
+    if (Service >= SOM_PROVIDED_SERVICE_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_STOP_OFFER_SERVICE_API_ID, SOM_E_PARAM);
+        return;
+    }
+
+    if ((Som_Server[Service].phase == SOM_SERVER_REPETITION) || (Som_Server[Service].phase == SOM_SERVER_MAIN))
+    {
+        multicast.address = SOM_SD_MULTICAST_ADDRESS;
+        multicast.port = SOM_SD_PORT;
+        Som_SdBegin(&message);
+        Som_SdServiceEntry(&message, SOM_SD_OFFER_SERVICE, &Som_ProvidedService[Service], 0U);
+        Som_SdSend(&message, &multicast);
+    }
+    Som_Server[Service].phase = SOM_SERVER_DOWN;
+    Som_ServerDropSubscribers(Service);
+}
+
+/**
+ * @brief Serialize an event and send it to the subscribers of its event group
+ */
+Std_ReturnType Som_SendEvent(Som_EventIdType Event, P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2CONST(Som_TxEventConfigType, AUTOMATIC, SOM_CONST) cfg;
+    P2CONST(Som_ServiceConfigType, AUTOMATIC, SOM_CONST) service;
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) msg;
+    Som_EndpointType endpoints[SOM_MAX_SUBSCRIBERS];
+    Som_ServiceIdType handle;
+    uint32 header;
+    uint32 length;
+    uint32 offset;
+    uint16 session;
+    uint8 count = 0U;
+    uint8 index;
+    uint32 key;
+
+    if (Som_CheckInit(SOM_SEND_EVENT_API_ID) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    if (Event >= SOM_TX_EVENT_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_SEND_EVENT_API_ID, SOM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if (Data == NULL_PTR)
+    {
+        SOM_REPORT_ERROR(SOM_SEND_EVENT_API_ID, SOM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    cfg = &Som_TxEvent[Event];
+    handle = Som_ProvidedEventGroup[cfg->eventgroup].service;
+    service = &Som_ProvidedService[handle];
+    if (Som_Server[handle].phase == SOM_SERVER_DOWN)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Only the subscriber snapshot and the buffer claim are locked */
+    SOM_ENTER_CRITICAL(key);
+    for (index = 0U; index < SOM_MAX_SUBSCRIBERS; index++)
+    {
+        if (Som_Subscriber[cfg->eventgroup][index].used == TRUE)
+        {
+            endpoints[count] = Som_Subscriber[cfg->eventgroup][index].endpoint;
+            count++;
+        }
+    }
+    if (count == 0U)
+    {
+        SOM_EXIT_CRITICAL(key);
+        return E_OK;                                    /* Nobody subscribed: nothing to serialize */
+    }
+    if (Som_TxBusy == TRUE)
+    {
+        Som_Statistics.tx_busy++;
+        SOM_EXIT_CRITICAL(key);
+        return E_NOT_OK;
+    }
+    Som_TxBusy = TRUE;
+    SOM_EXIT_CRITICAL(key);
+
+    /* Som_TxBuffer and Som_TxSession belong to this call until Som_TxBusy is cleared */
+    header = SOM_HEADER_LENGTH + ((cfg->tp == TRUE) ? SOM_TP_HEADER_LENGTH : 0U);
+    length = cfg->serialize(Data, &Som_TxBuffer[header]);
+    if (length == SOM_SER_ERROR)
+    {
+        COMPILER_BARRIER();
+        Som_TxBusy = FALSE;
+        SOM_REPORT_ERROR(SOM_SEND_EVENT_API_ID, SOM_E_INVALID_LENGTH);
+        return E_NOT_OK;
+    }
+    session = (Som_TxSession[Event] == 0xFFFFU) ? 1U : (uint16)(Som_TxSession[Event] + 1U);
+    Som_TxSession[Event] = session;
+
+    if ((length + SOM_HEADER_LENGTH) <= SOM_MAX_DATAGRAM_LENGTH)
+    {
+        /* Fits one datagram: header directly in front of the payload */
+        msg = &Som_TxBuffer[header - SOM_HEADER_LENGTH];
+        Som_WriteHeader(msg, service->service_id, cfg->event_id, length, session, service->major_version,
+                        SOM_MSG_NOTIFICATION);
+        Som_SendToSubscribers(endpoints, count, msg, SOM_HEADER_LENGTH + length);
+    }
+    else
+    {
+        /* Segment k: headers at offset k * SOM_TP_SEGMENT_LENGTH, over data already sent */
+        for (offset = 0U; offset < length; offset += SOM_TP_SEGMENT_LENGTH)
+        {
+            uint32 segment = length - offset;
+            uint32 more = 0U;
+
+            if (segment > SOM_TP_SEGMENT_LENGTH)
+            {
+                segment = SOM_TP_SEGMENT_LENGTH;
+                more = SOM_TP_MORE_SEGMENTS;
+            }
+            msg = &Som_TxBuffer[offset];
+            Som_WriteHeader(msg, service->service_id, cfg->event_id, SOM_TP_HEADER_LENGTH + segment, session,
+                            service->major_version, SOM_MSG_NOTIFICATION | SOM_MSG_TP_FLAG);
+            Som_StoreBe32(&msg[SOM_HEADER_LENGTH], offset | more);
+            Som_SendToSubscribers(endpoints, count, msg, SOM_HEADER_LENGTH + SOM_TP_HEADER_LENGTH + segment);
+        }
+    }
+
+    COMPILER_BARRIER();
+    Som_TxBusy = FALSE;
+    return E_OK;
+}
+
+/**
+ * @brief Read the last received value of an event
+ */
+Std_ReturnType Som_ReceiveEvent(Som_EventIdType Event, P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)
+{
+    P2CONST(Som_RxEventConfigType, AUTOMATIC, SOM_CONST) cfg;
+    Std_ReturnType result = E_NOT_OK;
+    uint16 index;
+    uint32 key;
+
+    if (Som_CheckInit(SOM_RECEIVE_EVENT_API_ID) == FALSE)
+    {
+        return E_NOT_OK;
+    }
+    if (Event >= SOM_RX_EVENT_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_RECEIVE_EVENT_API_ID, SOM_E_PARAM);
+        return E_NOT_OK;
+    }
+    if (Data == NULL_PTR)
+    {
+        SOM_REPORT_ERROR(SOM_RECEIVE_EVENT_API_ID, SOM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    index = Som_RxEventIndex[Event];
+    cfg = &Som_RxEvent[index];
+    SOM_ENTER_CRITICAL(key);
+    if (Som_RxReceived[index] == TRUE)
+    {
+        (void)memcpy(Data, cfg->shadow, cfg->shadow_size);
+        result = E_OK;
+    }
+    SOM_EXIT_CRITICAL(key);
+    return result;
+}
+
+/**
+ * @brief Subscription state of a consumed event group
+ */
+Som_EventGroupStateType Som_GetEventGroupState(Som_EventGroupIdType EventGroup)
+{
+    if (Som_CheckInit(SOM_GET_EVENTGROUP_STATE_API_ID) == FALSE)
+    {
+        return SOM_EVENTGROUP_DOWN;
+    }
+    if (EventGroup >= SOM_CONSUMED_EVENTGROUP_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_GET_EVENTGROUP_STATE_API_ID, SOM_E_PARAM);
+        return SOM_EVENTGROUP_DOWN;
+    }
+    return (Som_EventGroupStateType)Som_ClientGroup[EventGroup].state;
+}
+
+/**
+ * @brief Number of cached subscribers of a provided event group
+ */
+uint8 Som_GetSubscriberCount(Som_EventGroupIdType EventGroup)
+{
+    uint8 count = 0U;
+    uint8 index;
+
+    if (Som_CheckInit(SOM_GET_SUBSCRIBER_COUNT_API_ID) == FALSE)
+    {
+        return 0U;
+    }
+    if (EventGroup >= SOM_PROVIDED_EVENTGROUP_COUNT)
+    {
+        SOM_REPORT_ERROR(SOM_GET_SUBSCRIBER_COUNT_API_ID, SOM_E_PARAM);
+        return 0U;
+    }
+    for (index = 0U; index < SOM_MAX_SUBSCRIBERS; index++)
+    {
+        if (Som_Subscriber[EventGroup][index].used == TRUE)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Copy the message counters
+ */
+void Som_GetStatistics(P2VAR(Som_StatisticsType, AUTOMATIC, SOM_APPL_DATA) Statistics)
+{
+    uint32 key;
+
+    if (Statistics == NULL_PTR)
+    {
+        SOM_REPORT_ERROR(SOM_GET_STATISTICS_API_ID, SOM_E_PARAM_POINTER);
+        return;
+    }
+    SOM_ENTER_CRITICAL(key);
+    *Statistics = Som_Statistics;
+    SOM_EXIT_CRITICAL(key);
+}
+
+/**
+ * @brief Process a received UDP datagram
+ */
+void Som_RxIndication(uint8 Socket, P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Data, uint16 Length)
+{
+    uint32 pos = 0U;
+
+    if (Som_CheckInit(SOM_RX_INDICATION_API_ID) == FALSE)
+    {
+        return;
+    }
+    if (Socket > SOM_SOCKET_EVENT)
+    {
+        SOM_REPORT_ERROR(SOM_RX_INDICATION_API_ID, SOM_E_PARAM);
+        return;
+    }
+    if ((Remote == NULL_PTR) || (Data == NULL_PTR))
+    {
+        SOM_REPORT_ERROR(SOM_RX_INDICATION_API_ID, SOM_E_PARAM_POINTER);
+        return;
+    }
+
+    /* A datagram may carry several messages back to back */
+    while ((pos + SOM_HEADER_LENGTH) <= Length)
+    {
+        P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) msg = &Data[pos];
+        uint32 length = Som_LoadBe32(&msg[4]);
+        boolean sd;
+
+        if ((length < SOM_LENGTH_BASE) || (length > ((uint32)Length - pos - SOM_LENGTH_BASE)) ||
+            (msg[12] != SOM_PROTOCOL_VERSION))
+        {
+            break;                                      /* Framing lost: drop the rest */
+        }
+        length += SOM_LENGTH_BASE;
+        pos += length;
+
+        sd = ((Som_LoadBe16(msg) == SOM_SD_SERVICE_ID) && (Som_LoadBe16(&msg[2]) == SOM_SD_METHOD_ID)) ? TRUE : FALSE;
+        if ((msg[15] != SOM_RETURN_OK) || ((msg[14] & (uint8)~SOM_MSG_TP_FLAG) != SOM_MSG_NOTIFICATION) ||
+            (sd != ((Socket == SOM_SOCKET_SD) ? TRUE : FALSE)))
+        {
+            Som_Dropped();
+            continue;
+        }
+        Som_Statistics.rx_messages++;
+        if (sd == TRUE)
+        {
+            Som_SdRxIndication(Remote, msg, length);
+        }
+        else
+        {
+            Som_EventRxIndication(msg, length);
+        }
+    }
+    if (pos < Length)
+    {
+        Som_Dropped();
+    }
+}
+
+/**
+ * @brief Run the SD state machines
+ */
+void Som_MainFunction(void)
+{
+    Som_SdMessageType message;
+    Som_EndpointType multicast;
+
+    if (Som_Initialized == FALSE)
+    {
+        return;
+    }
+
+    Som_Now += SOM_MAIN_FUNCTION_PERIOD_MS;
+    multicast.address = SOM_SD_MULTICAST_ADDRESS;
+    multicast.port = SOM_SD_PORT;
+
+    /* Offers and finds due now share one multicast message */
+    Som_SdBegin(&message);
+    Som_ServerMain(&message);
+    Som_ClientMain(&message);
+    Som_SdSend(&message, &multicast);
+
+    Som_ClientRenew();
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
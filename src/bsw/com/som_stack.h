@@ -0,0 +1,452 @@
+/**
+ * @file    som_stack.h
+ * @brief   SOME/IP - Serialization, Service Discovery and Transport Protocol
+ * @version 1.0.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * SOME/IP events of the zonal Ethernet backbone, configured in
+ * config/autosar/communication/som.arxml. The VCU provides services to the
+ * zone controllers and consumes their I/O services:
+ *
+ * | Part          | Protocol                      | Services                                  |
+ * |---------------|-------------------------------|-------------------------------------------|
+ * | Serializer    | SOME/IP payload (PRS 4.1)     | Som_SendEvent() / Som_ReceiveEvent()      |
+ * | SOME/IP-SD    | Offer / Find / Subscribe      | Som_OfferService() / Som_MainFunction()   |
+ * | SOME/IP-TP    | Segmented notifications       | TP events of som.arxml                    |
+ *
+ * Zero-copy, allocation-free serialization:
+ * - tools/som/som_generator.py emits one serializer, length check and
+ *   deserializer per data type (som_cfg.c). They move every element with a
+ *   constant offset (a running position after dynamic arrays), in network
+ *   byte order and without padding; there is no interpreter and no heap
+ * - Som_SendEvent() serializes the application data directly behind the
+ *   SOME/IP header in the datagram that goes to the lower layer
+ * - Som_RxIndication() deserializes the payload in place from the received
+ *   datagram into the shadow of the event. Only segmented events are
+ *   reassembled, into their generated TP buffer
+ *
+ * Service discovery:
+ * - Provided services run the SD server phases Initial Wait, Repetition and
+ *   Main; offers due in the same Som_MainFunction() share one SD message
+ * - Subscriptions of remote clients are cached per event group (at most
+ *   SOM_MAX_SUBSCRIBERS endpoints); a renewal refreshes the TTL of the cached
+ *   endpoint, the events go to the cached endpoints without any SD lookup
+ * - Consumed event groups are subscribed on the offer of their service and
+ *   renewed only when less than half of the granted TTL remains, so the
+ *   cyclic offers do not cause a subscription each
+ *
+ * Implementation Notes:
+ * - Events only (notifications); methods and fields are not supported
+ * - The UDP sockets belong to the lower layer: Som_UdpTransmit() is called
+ *   with the SOM_SOCKET_SD or SOM_SOCKET_EVENT socket and must copy the
+ *   datagram before it returns; received datagrams of both sockets are
+ *   handed to Som_RxIndication()
+ * - Endpoints are IPv4 address (host byte order) and UDP port
+ * - SD timing counts Som_MainFunction() calls of SOM_MAIN_FUNCTION_PERIOD_MS
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | SOME/IP events, SD and TP          |
+ * | 1.0.1   | 2026-10-16 | BSW Team        | tx_busy counter                    |
+ *
+ * @see som_stack.c
+ * @see som_cfg.h
+ * @see som_pack.h
+ */
+
+#ifndef SOM_STACK_H
+#define SOM_STACK_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define SOM_VENDOR_ID                           43U
+#define SOM_MODULE_ID                           171U    /**< AUTOSAR Sd */
+#define SOM_INSTANCE_ID                         0U
+
+#define SOM_SW_MAJOR_VERSION                    1U
+#define SOM_SW_MINOR_VERSION                    0U
+#define SOM_SW_PATCH_VERSION                    0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (SOM_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "som_stack.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define SOM_INIT_API_ID                         0x01U
+#define SOM_OFFER_SERVICE_API_ID                0x02U
+#define SOM_STOP_OFFER_SERVICE_API_ID           0x03U
+#define SOM_SEND_EVENT_API_ID                   0x04U
+#define SOM_RECEIVE_EVENT_API_ID                0x05U
+#define SOM_MAIN_FUNCTION_API_ID                0x06U
+#define SOM_GET_EVENTGROUP_STATE_API_ID         0x07U
+#define SOM_GET_SUBSCRIBER_COUNT_API_ID         0x08U
+#define SOM_GET_STATISTICS_API_ID               0x09U
+#define SOM_RX_INDICATION_API_ID                0x42U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define SOM_E_PARAM                             0x01U   /**< Invalid handle or socket */
+#define SOM_E_UNINIT                            0x02U   /**< Som_Init() not called */
+#define SOM_E_PARAM_POINTER                     0x03U   /**< NULL pointer parameter */
+#define SOM_E_INVALID_LENGTH                    0x04U   /**< Dynamic array above its maximum */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def SOM_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef SOM_DEV_ERROR_DETECT
+    #define SOM_DEV_ERROR_DETECT                STD_ON
+#endif
+
+/**
+ * @def SOM_PEER_CODECS
+ * @brief STD_ON: som_cfg.c also provides the codecs of the opposite direction
+ *        (Som_RxEventSerialize, Som_TxEventCheck, Som_TxEventDeserialize),
+ *        for test peers and benchmarks; not used by SOME/IP itself
+ */
+#ifndef SOM_PEER_CODECS
+    #define SOM_PEER_CODECS                     STD_OFF
+#endif
+
+/* Configuration validation */
+#if (SOM_DEV_ERROR_DETECT != STD_ON) && (SOM_DEV_ERROR_DETECT != STD_OFF)
+    #error "SOM_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (SOM_PEER_CODECS != STD_ON) && (SOM_PEER_CODECS != STD_OFF)
+    #error "SOM_PEER_CODECS must be STD_ON or STD_OFF"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Socket of the SD messages (SomSdPort) */
+#define SOM_SOCKET_SD                           0U
+
+/** @brief Socket of the events (SomLocalPort) */
+#define SOM_SOCKET_EVENT                        1U
+
+/** @brief Return value of the generated serializers and length checks on error */
+#define SOM_SER_ERROR                           0xFFFFFFFFUL
+
+/**
+ * @typedef Som_EventIdType
+ * @brief Handle of an event (SomConf_SomTxEvent_* / SomConf_SomRxEvent_*)
+ */
+typedef uint16 Som_EventIdType;
+
+/**
+ * @typedef Som_ServiceIdType
+ * @brief Handle of a service instance (SomConf_SomProvidedService_* / SomConf_SomConsumedService_*)
+ */
+typedef uint16 Som_ServiceIdType;
+
+/**
+ * @typedef Som_EventGroupIdType
+ * @brief Handle of an event group (SomConf_SomProvidedEventGroup_* / SomConf_SomConsumedEventGroup_*)
+ */
+typedef uint16 Som_EventGroupIdType;
+
+/**
+ * @enum Som_EventGroupStateType
+ * @brief Subscription state of a consumed event group
+ */
+typedef enum
+{
+    SOM_EVENTGROUP_DOWN = 0x00U,        /**< Service not offered */
+    SOM_EVENTGROUP_REQUESTED = 0x01U,   /**< Subscribe sent, no acknowledge yet */
+    SOM_EVENTGROUP_SUBSCRIBED = 0x02U   /**< Subscription acknowledged */
+} Som_EventGroupStateType;
+
+/**
+ * @struct Som_EndpointType
+ * @brief UDP/IPv4 endpoint
+ */
+typedef struct
+{
+    uint32 address;                     /**< IPv4 address, host byte order */
+    uint16 port;                        /**< UDP port */
+} Som_EndpointType;
+
+/**
+ * @struct Som_StatisticsType
+ * @brief Message counters since Som_Init()
+ */
+typedef struct
+{
+    uint32 tx_messages;                 /**< Datagrams accepted by Som_UdpTransmit() */
+    uint32 tx_errors;                   /**< Datagrams rejected by Som_UdpTransmit() */
+    uint32 rx_messages;                 /**< SOME/IP messages processed */
+    uint32 rx_dropped;                  /**< Malformed, unknown or unexpected messages */
+    uint32 tx_busy;                     /**< Notifications rejected, TX buffer used by another call */
+} Som_StatisticsType;
+
+/** @brief Generated serializer: data type -> payload, returns the length or SOM_SER_ERROR */
+typedef uint32 (*Som_SerializeFctType)(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data,
+    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer);
+
+/** @brief Generated length check: serialized length of a payload, or SOM_SER_ERROR if malformed */
+typedef uint32 (*Som_CheckFctType)(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length);
+
+/** @brief Generated deserializer: payload accepted by the length check -> data type */
+typedef void (*Som_DeserializeFctType)(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data);
+
+/**
+ * @struct Som_ServiceConfigType
+ * @brief Static configuration of one provided or consumed service instance (generated)
+ */
+typedef struct
+{
+    uint32 minor_version;               /**< SomMinorVersion */
+    uint16 service_id;                  /**< SomServiceId */
+    uint16 instance_id;                 /**< SomInstanceId */
+    uint16 eventgroup_first;            /**< First event group of the service */
+    uint16 eventgroup_count;            /**< Number of event groups */
+    uint8 major_version;                /**< SomMajorVersion, also the interface version */
+} Som_ServiceConfigType;
+
+/**
+ * @struct Som_EventGroupConfigType
+ * @brief Static configuration of one event group (generated)
+ */
+typedef struct
+{
+    Som_ServiceIdType service;          /**< Service instance of the group */
+    uint16 eventgroup_id;               /**< SomEventGroupId */
+} Som_EventGroupConfigType;
+
+/**
+ * @struct Som_TxEventConfigType
+ * @brief Static configuration of one provided event (generated)
+ */
+typedef struct
+{
+    Som_SerializeFctType serialize;     /**< Serializer of the data type */
+    uint32 max_length;                  /**< Maximum serialized length */
+    Som_EventGroupIdType eventgroup;    /**< Provided event group of the event */
+    uint16 event_id;                    /**< SomEventId (method ID of the notification) */
+    boolean tp;                         /**< SomEventSegmentation */
+} Som_TxEventConfigType;
+
+/**
+ * @struct Som_RxEventConfigType
+ * @brief Static configuration of one consumed event (generated), sorted by service and event ID
+ */
+typedef struct
+{
+    Som_CheckFctType check;             /**< Length check of the data type */
+    Som_DeserializeFctType deserialize; /**< Deserializer of the data type */
+    P2VAR(void, TYPEDEF, SOM_VAR) shadow;               /**< Last received value */
+    P2VAR(uint8, TYPEDEF, SOM_VAR) tp_buffer;           /**< Reassembly buffer, NULL_PTR if not TP */
+    uint32 max_length;                  /**< Maximum serialized length */
+    uint32 shadow_size;                 /**< sizeof the data type */
+    Som_EventGroupIdType eventgroup;    /**< Consumed event group of the event */
+    uint16 service_id;                  /**< SomServiceId of the consumed service */
+    uint16 event_id;                    /**< SomEventId */
+} Som_RxEventConfigType;
+
+#include "som_cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief Provided service instances, indexed by SomConf_SomProvidedService_* */
+extern const Som_ServiceConfigType Som_ProvidedService[SOM_PROVIDED_SERVICE_COUNT];
+
+/** @brief Consumed service instances, indexed by SomConf_SomConsumedService_* */
+extern const Som_ServiceConfigType Som_ConsumedService[SOM_CONSUMED_SERVICE_COUNT];
+
+/** @brief Provided event groups, indexed by SomConf_SomProvidedEventGroup_* */
+extern const Som_EventGroupConfigType Som_ProvidedEventGroup[SOM_PROVIDED_EVENTGROUP_COUNT];
+
+/** @brief Consumed event groups, indexed by SomConf_SomConsumedEventGroup_* */
+extern const Som_EventGroupConfigType Som_ConsumedEventGroup[SOM_CONSUMED_EVENTGROUP_COUNT];
+
+/** @brief Provided events, indexed by SomConf_SomTxEvent_* */
+extern const Som_TxEventConfigType Som_TxEvent[SOM_TX_EVENT_COUNT];
+
+/** @brief Consumed events, sorted by SomServiceId and SomEventId for the reception lookup */
+extern const Som_RxEventConfigType Som_RxEvent[SOM_RX_EVENT_COUNT];
+
+/** @brief Position of each consumed event in Som_RxEvent, indexed by SomConf_SomRxEvent_* */
+extern const uint16 Som_RxEventIndex[SOM_RX_EVENT_COUNT];
+
+#if (SOM_PEER_CODECS == STD_ON)
+/** @brief Serializers of the consumed events, indexed by SomConf_SomRxEvent_* */
+extern const Som_SerializeFctType Som_RxEventSerialize[SOM_RX_EVENT_COUNT];
+
+/** @brief Length checks and deserializers of the provided events, indexed by SomConf_SomTxEvent_* */
+extern const Som_CheckFctType Som_TxEventCheck[SOM_TX_EVENT_COUNT];
+extern const Som_DeserializeFctType Som_TxEventDeserialize[SOM_TX_EVENT_COUNT];
+#endif
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize SOME/IP: services not offered, no subscriptions, start
+ *        searching the consumed services
+ *
+ * @serviceID SOM_INIT_API_ID (0x01)
+ * @reentrancy Non-Reentrant
+ */
+extern void Som_Init(void);
+
+/**
+ * @brief Start offering a provided service (SD Initial Wait phase)
+ * @param[in] Service Provided service instance (SomConf_SomProvidedService_*)
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID SOM_OFFER_SERVICE_API_ID (0x02)
+ * @reentrancy Non-Reentrant
+ */
+extern Std_ReturnType Som_OfferService(Som_ServiceIdType Service);
+
+/**
+ * @brief Stop offering a provided service; sends a StopOffer and drops its subscribers
+ * @param[in] Service Provided service instance (SomConf_SomProvidedService_*)
+ *
+ * @serviceID SOM_STOP_OFFER_SERVICE_API_ID (0x03)
+ * @reentrancy Non-Reentrant
+ */
+extern void Som_StopOfferService(Som_ServiceIdType Service);
+
+/**
+ * @brief Serialize an event and send it to every subscriber of its event group
+ * @param[in] Event Provided event (SomConf_SomTxEvent_*)
+ * @param[in] Data  Value, of the generated data type of the event (Som_<Type>Type)
+ * @return E_OK (also without subscribers), or E_NOT_OK if the service is not
+ *         offered, a dynamic array exceeds its maximum, another call is
+ *         sending (tx_busy) or on invalid parameters
+ *
+ * @serviceID SOM_SEND_EVENT_API_ID (0x04)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Som_SendEvent(Som_EventIdType Event,
+    P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data);
+
+/**
+ * @brief Read the last received value of an event
+ * @param[in]  Event Consumed event (SomConf_SomRxEvent_*)
+ * @param[out] Data  Receives the value, of the generated data type of the event
+ * @return E_OK, or E_NOT_OK if nothing was received yet or on invalid parameters
+ *
+ * @serviceID SOM_RECEIVE_EVENT_API_ID (0x05)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Som_ReceiveEvent(Som_EventIdType Event,
+    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data);
+
+/**
+ * @brief Subscription state of a consumed event group
+ * @param[in] EventGroup Consumed event group (SomConf_SomConsumedEventGroup_*)
+ * @return State, SOM_EVENTGROUP_DOWN on invalid parameters
+ *
+ * @serviceID SOM_GET_EVENTGROUP_STATE_API_ID (0x07)
+ * @reentrancy Reentrant
+ */
+extern Som_EventGroupStateType Som_GetEventGroupState(Som_EventGroupIdType EventGroup);
+
+/**
+ * @brief Number of cached subscribers of a provided event group
+ * @param[in] EventGroup Provided event group (SomConf_SomProvidedEventGroup_*)
+ * @return Subscribers, 0 on invalid parameters
+ *
+ * @serviceID SOM_GET_SUBSCRIBER_COUNT_API_ID (0x08)
+ * @reentrancy Reentrant
+ */
+extern uint8 Som_GetSubscriberCount(Som_EventGroupIdType EventGroup);
+
+/**
+ * @brief Copy the message counters
+ * @param[out] Statistics Receives the counters
+ *
+ * @serviceID SOM_GET_STATISTICS_API_ID (0x09)
+ * @reentrancy Reentrant
+ */
+extern void Som_GetStatistics(P2VAR(Som_StatisticsType, AUTOMATIC, SOM_APPL_DATA) Statistics);
+
+/**
+ * @brief Process a received UDP datagram (one or more SOME/IP messages)
+ * @param[in] Socket SOM_SOCKET_SD or SOM_SOCKET_EVENT
+ * @param[in] Remote Sender
+ * @param[in] Data   Datagram
+ * @param[in] Length Datagram length
+ *
+ * @serviceID SOM_RX_INDICATION_API_ID (0x42)
+ * @reentrancy Non-Reentrant
+ */
+extern void Som_RxIndication(uint8 Socket,
+    P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Data, uint16 Length);
+
+/**
+ * @brief Run the SD state machines: offers, subscription renewal and TTL supervision
+ *
+ * Called every SOM_MAIN_FUNCTION_PERIOD_MS.
+ *
+ * @serviceID SOM_MAIN_FUNCTION_API_ID (0x06)
+ * @reentrancy Non-Reentrant
+ */
+extern void Som_MainFunction(void);
+
+/**
+ * @brief Send a UDP datagram (callout, implemented by the lower layer)
+ * @param[in] Socket SOM_SOCKET_SD or SOM_SOCKET_EVENT: source port SomSdPort or SomLocalPort
+ * @param[in] Remote Destination
+ * @param[in] Data   Datagram; only valid during the call
+ * @param[in] Length Datagram length
+ * @return E_OK if the datagram was queued for transmission
+ */
+extern Std_ReturnType Som_UdpTransmit(uint8 Socket,
+    P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Data, uint16 Length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOM_STACK_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
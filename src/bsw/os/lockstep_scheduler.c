@@ -0,0 +1,255 @@
+/**
+ * @file    lockstep_scheduler.c
+ * @brief   OS Multi-Core Support - Core Partitioning and Inter-Core Activation Implementation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the inter-core activation mailboxes declared in
+ * lockstep_scheduler.h.
+ *
+ * Implementation Notes:
+ * - head and tail are free-running 32-bit indices; the fill level is
+ *   (head - tail), which stays correct across wrap-around
+ * - Every mailbox word has exactly one writing core: head, posted and
+ *   overflows belong to the source core, tail and delivered to the target
+ *   core. Plain loads and stores are therefore sufficient; only the order
+ *   of slot and index accesses needs DMBs
+ * - The target core acknowledges the MSCM interrupt before reading head,
+ *   so a request published after the read re-raises the interrupt
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see lockstep_scheduler.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "lockstep_scheduler.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define OS_LOCKSTEP_SCHEDULER_C_VENDOR_ID       43U
+#define OS_LOCKSTEP_SCHEDULER_C_SW_MAJOR_VERSION 1U
+#define OS_LOCKSTEP_SCHEDULER_C_SW_MINOR_VERSION 0U
+#define OS_LOCKSTEP_SCHEDULER_C_SW_PATCH_VERSION 0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (OS_LOCKSTEP_SCHEDULER_C_VENDOR_ID != OS_VENDOR_ID)
+    #error "lockstep_scheduler.c and os_types.h have different vendor IDs"
+#endif
+
+#if ((OS_LOCKSTEP_SCHEDULER_C_SW_MAJOR_VERSION != OS_SW_MAJOR_VERSION) || \
+     (OS_LOCKSTEP_SCHEDULER_C_SW_MINOR_VERSION != OS_SW_MINOR_VERSION) || \
+     (OS_LOCKSTEP_SCHEDULER_C_SW_PATCH_VERSION != OS_SW_PATCH_VERSION))
+    #error "Software version mismatch between lockstep_scheduler.c and os_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    #define OS_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, (api), (err)))
+#else
+    #define OS_REPORT_ERROR(api, err)           ((void)0)
+#endif
+
+#define OS_ICM_INDEX_MASK                       (OS_ICM_MAILBOX_SIZE - 1U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Single producer / single consumer activation mailbox
+ */
+typedef struct
+{
+    volatile uint32   head;                         /**< Next slot to write (source core) */
+    volatile uint32   posted;                       /**< Accepted requests (source core) */
+    volatile uint32   overflows;                    /**< Rejected requests (source core) */
+    volatile uint32   tail;                         /**< Next slot to read (target core) */
+    volatile uint32   delivered;                    /**< Drained requests (target core) */
+    volatile TaskType slots[OS_ICM_MAILBOX_SIZE];   /**< Requested task IDs */
+} Os_CoreMailboxType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Mailboxes indexed [source core][target core]; the diagonal is unused */
+STATIC VAR_SECTION(OS_ICM_SECTION) Os_CoreMailboxType Os_CoreMailbox[OS_NUM_CORES][OS_NUM_CORES];
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Reset all inter-core mailboxes
+ */
+void Os_Core_Init(void)
+{
+    uint8 source;
+    uint8 target;
+    uint8 i;
+
+    for (source = 0U; source < OS_NUM_CORES; source++)
+    {
+        for (target = 0U; target < OS_NUM_CORES; target++)
+        {
+            P2VAR(Os_CoreMailboxType, AUTOMATIC, OS_VAR) mb = &Os_CoreMailbox[source][target];
+
+            mb->head = 0UL;
+            mb->posted = 0UL;
+            mb->overflows = 0UL;
+            mb->tail = 0UL;
+            mb->delivered = 0UL;
+            for (i = 0U; i < OS_ICM_MAILBOX_SIZE; i++)
+            {
+                mb->slots[i] = 0U;
+            }
+        }
+    }
+
+    MEMORY_BARRIER();
+}
+
+/**
+ * @brief Post an activation request to the mailbox of another core
+ */
+StatusType Os_Core_PostActivation(CoreIdType Core, TaskType TaskID)
+{
+    CoreIdType source = Os_Port_GetCoreId();
+    P2VAR(Os_CoreMailboxType, AUTOMATIC, OS_VAR) mb;
+    uint32 head;
+    uint32 key;
+
+    if ((Core >= OS_NUM_CORES) || (Core == source))
+    {
+        OS_REPORT_ERROR(OS_CORE_POST_ACTIVATION_API_ID, E_OS_CORE);
+        return E_OS_CORE;
+    }
+
+    mb = &Os_CoreMailbox[source][Core];
+
+    /* Serializes the producers (tasks and ISRs) of this core only */
+    key = Os_Port_DisableInterrupts();
+    head = mb->head;
+    if ((head - mb->tail) >= OS_ICM_MAILBOX_SIZE)
+    {
+        mb->overflows++;
+        Os_Port_RestoreInterrupts(key);
+        OS_REPORT_ERROR(OS_CORE_POST_ACTIVATION_API_ID, E_OS_LIMIT);
+        return E_OS_LIMIT;
+    }
+
+    mb->slots[head & OS_ICM_INDEX_MASK] = TaskID;
+    MEMORY_BARRIER();                   /* Slot visible before the new head */
+    mb->head = head + 1UL;
+    mb->posted++;
+    Os_Port_RestoreInterrupts(key);
+
+    Os_Port_SignalCore(Core);
+
+    return E_OK;
+}
+
+/**
+ * @brief Inter-core interrupt handler
+ */
+void Os_Core_IntercoreIsr(void)
+{
+    CoreIdType target = Os_Port_GetCoreId();
+    uint8 source;
+
+    if (target >= OS_NUM_CORES)
+    {
+        OS_REPORT_ERROR(OS_CORE_INTERCORE_ISR_API_ID, E_OS_CORE);
+        return;
+    }
+
+    Os_EnterIsr();
+    Os_Port_ClearCoreSignal();
+
+    for (source = 0U; source < OS_NUM_CORES; source++)
+    {
+        P2VAR(Os_CoreMailboxType, AUTOMATIC, OS_VAR) mb = &Os_CoreMailbox[source][target];
+        uint32 tail = mb->tail;
+        uint32 head = mb->head;
+
+        if ((source == target) || (tail == head))
+        {
+            continue;
+        }
+
+        MEMORY_BARRIER();               /* Slots read after head */
+        while (tail != head)
+        {
+            TaskType task = mb->slots[tail & OS_ICM_INDEX_MASK];
+
+            tail++;
+            mb->delivered++;
+            (void)ActivateTask(task);
+        }
+        MEMORY_BARRIER();               /* Slots consumed before they are released */
+        mb->tail = tail;
+    }
+
+    Os_LeaveIsr();
+}
+
+/**
+ * @brief Read the counters of one mailbox
+ */
+Std_ReturnType Os_Core_GetMailboxStatus(CoreIdType Source, CoreIdType Target,
+    P2VAR(Os_CoreMailboxStatusType, AUTOMATIC, OS_APPL_DATA) Status)
+{
+    P2CONST(Os_CoreMailboxType, AUTOMATIC, OS_VAR) mb;
+
+    if (Status == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_CORE_GET_MAILBOX_STATUS_API_ID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if ((Source >= OS_NUM_CORES) || (Target >= OS_NUM_CORES))
+    {
+        OS_REPORT_ERROR(OS_CORE_GET_MAILBOX_STATUS_API_ID, E_OS_ID);
+        return E_NOT_OK;
+    }
+
+    mb = &Os_CoreMailbox[Source][Target];
+    Status->posted = mb->posted;
+    Status->delivered = mb->delivered;
+    Status->overflows = mb->overflows;
+
+    return E_OK;
+}
+
+/**
+ * @brief Logical number of the executing core
+ */
+CoreIdType GetCoreID(void)
+{
+    return Os_Port_GetCoreId();
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
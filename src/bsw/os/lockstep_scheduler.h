@@ -0,0 +1,166 @@
+/**
+ * @file    lockstep_scheduler.h
+ * @brief   OS Multi-Core Support - Core Partitioning and Inter-Core Activation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * S32K3 parts either run their Cortex-M7 cores in lockstep (one logical
+ * core, OS_NUM_CORES = 1) or, on S32K358/S32K356, in split-lock mode with
+ * two independent cores. In split-lock mode each core runs its own
+ * scheduler instance (scheduler.h) on a static task partition, typically
+ * ASIL-D workload on core 0 and QM workload on core 1.
+ *
+ * Cross-core ActivateTask() requests travel through mailboxes in shared
+ * SRAM, one per (source core, target core) pair:
+ *
+ * - Single producer / single consumer ring of task IDs with free-running
+ *   head (written by the source core only) and tail (written by the target
+ *   core only), so no inter-core lock or read-modify-write is required
+ * - Tasks and ISRs of the same source core serialize on the producer side
+ *   with a short local interrupt lock
+ * - The slot is published with a DMB before head is advanced, and the
+ *   target core is then signalled through the MSCM core-to-core interrupt
+ * - The target core's inter-core ISR acknowledges the interrupt first and
+ *   then drains all of its mailboxes, so no request can be left behind
+ *
+ * A full mailbox is reported to the caller as E_OS_LIMIT; nothing blocks,
+ * so a stalled QM core can never hold up the safety core.
+ *
+ * The mailboxes are placed in OS_ICM_SECTION, which the linker script must
+ * map to SRAM that both cores access non-cacheable (MPU attribute), since
+ * the Cortex-M7 data caches are not coherent between cores.
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_OS_MC_001: Static partitioning of tasks to cores
+ * - SR_OS_MC_002: Inter-core activation without blocking the sender
+ * - SR_OS_MC_003: Mailbox overflow detected and reported
+ *
+ * @see lockstep_scheduler.c
+ * @see scheduler.h
+ * @see os_port.h
+ */
+
+#ifndef LOCKSTEP_SCHEDULER_H
+#define LOCKSTEP_SCHEDULER_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "scheduler.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define OS_CORE_INIT_API_ID                     0x20U
+#define OS_CORE_POST_ACTIVATION_API_ID          0x21U
+#define OS_CORE_INTERCORE_ISR_API_ID            0x22U
+#define OS_CORE_GET_MAILBOX_STATUS_API_ID       0x23U
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def OS_ICM_MAILBOX_SIZE
+ * @brief Activation requests per mailbox (power of two)
+ */
+#ifndef OS_ICM_MAILBOX_SIZE
+    #define OS_ICM_MAILBOX_SIZE                 16U
+#endif
+
+#if ((OS_ICM_MAILBOX_SIZE == 0U) || ((OS_ICM_MAILBOX_SIZE & (OS_ICM_MAILBOX_SIZE - 1U)) != 0U))
+    #error "OS_ICM_MAILBOX_SIZE must be a power of two"
+#endif
+
+/**
+ * @def OS_ICM_SECTION
+ * @brief Linker section of the mailboxes (shared, non-cacheable SRAM)
+ */
+#ifndef OS_ICM_SECTION
+    #define OS_ICM_SECTION                      ".os_shared_noncacheable"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @struct Os_CoreMailboxStatusType
+ * @brief Counters of one (source, target) mailbox
+ */
+typedef struct
+{
+    uint32 posted;                      /**< Requests accepted from the source core */
+    uint32 delivered;                   /**< Requests drained by the target core */
+    uint32 overflows;                   /**< Requests rejected because the mailbox was full */
+} Os_CoreMailboxStatusType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Reset all inter-core mailboxes (master core, from Os_Init)
+ *
+ * @serviceID OS_CORE_INIT_API_ID (0x20)
+ */
+extern void Os_Core_Init(void);
+
+/**
+ * @brief Post an activation request to the mailbox of another core
+ * @param[in] Core   Target core (!= executing core)
+ * @param[in] TaskID Task partitioned to Core
+ * @return E_OK, E_OS_LIMIT if the mailbox is full
+ *
+ * @serviceID OS_CORE_POST_ACTIVATION_API_ID (0x21)
+ * @reentrancy Reentrant (serialized per source core)
+ */
+extern StatusType Os_Core_PostActivation(CoreIdType Core, TaskType TaskID);
+
+/**
+ * @brief Inter-core interrupt handler (Category 2, MSCM core-to-core IRQ 0)
+ * @details Activates every task requested by the other cores; the dispatch
+ *          happens when the interrupt returns.
+ *
+ * @serviceID OS_CORE_INTERCORE_ISR_API_ID (0x22)
+ */
+extern void Os_Core_IntercoreIsr(void);
+
+/**
+ * @brief Read the counters of one mailbox
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID OS_CORE_GET_MAILBOX_STATUS_API_ID (0x23)
+ */
+extern Std_ReturnType Os_Core_GetMailboxStatus(CoreIdType Source, CoreIdType Target,
+    P2VAR(Os_CoreMailboxStatusType, AUTOMATIC, OS_APPL_DATA) Status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOCKSTEP_SCHEDULER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,136 @@
+/**
+ * @file    os_port.c
+ * @brief   OS Port Layer - Cortex-M7 Thread-Level Dispatch
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Single-stack preemption for run-to-completion basic tasks:
+ *
+ * 1. An ISR activates a task and pends PendSV (lowest exception priority),
+ *    so PendSV runs once all nested ISRs have returned.
+ * 2. PendSV saves its EXC_RETURN and stacks a fake basic exception frame
+ *    whose return address is Os_Port_ThreadDispatch, then "returns" to it
+ *    in thread mode.
+ * 3. Os_Port_ThreadDispatch calls Os_Schedule() in thread mode with
+ *    interrupts enabled; the preempting tasks run nested on the MSP.
+ * 4. It then executes SVC; the SVC handler discards its own frame and
+ *    returns with the saved EXC_RETURN, which unstacks the original frame
+ *    and resumes the preempted task.
+ *
+ * Thread mode must use the MSP (single-stack kernel). With the FPU enabled,
+ * PendSV forces the lazy FP state of the preempted context into its frame
+ * and the dispatcher clears CONTROL.FPCA, so the SVC frame is always a
+ * basic 8-word frame.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see os_port.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "os_port.h"
+#include "scheduler.h"
+
+#if !defined(OS_PORT_POSIX)
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define OS_PORT_SHPR3_PENDSV_MASK               0x00FF0000UL
+#define OS_PORT_SHPR2_SVC_MASK                  0xFF000000UL
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+NAKED NORETURN void Os_Port_ThreadDispatch(void);
+NAKED void PendSV_Handler(void);
+NAKED void SVC_Handler(void);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Thread-mode trampoline entered from PendSV
+ */
+NAKED NORETURN void Os_Port_ThreadDispatch(void)
+{
+    __asm volatile (
+        "bl      Os_Schedule            \n"
+        "cpsid   i                      \n"
+        "mrs     r0, control            \n"
+        "bic     r0, r0, #4             \n"     /* FPCA = 0: basic SVC frame */
+        "msr     control, r0            \n"
+        "isb                            \n"
+        "cpsie   i                      \n"
+        "svc     #0                     \n"
+        "b       .                      \n"
+    );
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Configure PendSV and SVC exception priorities
+ */
+void Os_Port_Init(void)
+{
+    OS_PORT_SCB_SHPR3 |= OS_PORT_SHPR3_PENDSV_MASK;
+    OS_PORT_SCB_SHPR2 &= ~OS_PORT_SHPR2_SVC_MASK;
+}
+
+/**
+ * @brief PendSV: return into the thread-level dispatcher
+ */
+NAKED void PendSV_Handler(void)
+{
+    __asm volatile (
+        "cpsid   i                      \n"
+#if defined(__ARM_FP)
+        "tst     lr, #0x10              \n"     /* extended frame stacked? */
+        "it      eq                     \n"
+        "vmoveq.f32 s0, s0              \n"     /* complete lazy FP state preservation */
+#endif
+        "push    {r0, lr}               \n"     /* EXC_RETURN of the preempted context */
+        "sub     sp, sp, #32            \n"     /* fake basic exception frame */
+        "ldr     r0, =Os_Port_ThreadDispatch \n"
+        "bic     r0, r0, #1             \n"
+        "str     r0, [sp, #24]          \n"     /* frame PC */
+        "mov     r0, #0x01000000        \n"
+        "str     r0, [sp, #28]          \n"     /* frame xPSR (Thumb) */
+        "mvn     lr, #6                 \n"     /* EXC_RETURN 0xFFFFFFF9: thread, MSP, basic */
+        "cpsie   i                      \n"
+        "bx      lr                     \n"
+    );
+}
+
+/**
+ * @brief SVC: drop the dispatcher frame and resume the preempted context
+ */
+NAKED void SVC_Handler(void)
+{
+    __asm volatile (
+        "add     sp, sp, #32            \n"
+        "pop     {r0, lr}               \n"
+        "bx      lr                     \n"
+    );
+}
+
+#endif /* !OS_PORT_POSIX */
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,273 @@
+/**
+ * @file    os_port.h
+ * @brief   OS Port Layer - Cortex-M7 Interrupt Masking and Time Stamps
+ * @version 1.4.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Processor specific primitives used by the OS kernel. Everything that
+ * touches core registers is kept here so the kernel sources stay portable.
+ *
+ * Interrupt masking uses BASEPRI rather than PRIMASK: raising BASEPRI to a
+ * resource ceiling only blocks interrupts that share the resource, while
+ * higher-priority interrupts (safety watchdog, FCCU, CAN RX) keep their
+ * latency. BASEPRI_MAX is used for raising so nested ceilings can never
+ * lower the current mask by accident.
+ *
+ * Time stamps come from the DWT cycle counter (CYCCNT, core clock).
+ * OS_PORT_CORE_CLOCK_HZ is the one place the core clock is configured; the
+ * modules converting between time and time-stamp ticks derive their rates
+ * from OS_PORT_TICKS_PER_US.
+ *
+ * Dispatch requests from interrupt level pend PendSV (lowest priority);
+ * the PendSV handler in os_port.c returns into Os_Schedule() at thread
+ * level, so preempting tasks run outside exception context.
+ *
+ * On split-lock parts the core number comes from MCM CPXNUM and inter-core
+ * activation requests are signalled through the MSCM interrupt router
+ * (core-to-core interrupt 0 of the target core).
+ *
+ * Os_Port_CompareAndSwap() is the lock-free primitive for data shared by
+ * preempting tasks and by both cores (LDREX/STREX). The shared RAM must be
+ * covered by the global exclusive monitor for the cross-core case.
+ *
+ * Building with OS_PORT_POSIX selects the host port (os_port_posix.h) used
+ * by software-in-the-loop simulation instead.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | PendSV dispatch, POSIX host port   |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Core ID, inter-core interrupt      |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Compare-and-swap                   |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Core clock                         |
+ *
+ * @see resource_manager.c
+ * @see scheduler.c
+ */
+
+#ifndef OS_PORT_H
+#define OS_PORT_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "os_types.h"
+
+/* ===============================================================================================
+ *                                         CORE CLOCK
+ * =============================================================================================== */
+
+/**
+ * @def OS_PORT_CORE_CLOCK_HZ
+ * @brief Core clock, the rate of Os_Port_GetTimestamp() (S32K348: 240 MHz)
+ * @note The SIL virtual clock (core_clock_hz of sil_config.yaml) must match
+ */
+#ifndef OS_PORT_CORE_CLOCK_HZ
+    #define OS_PORT_CORE_CLOCK_HZ               240000000UL
+#endif
+
+/** @brief Os_Port_GetTimestamp() ticks per microsecond */
+#define OS_PORT_TICKS_PER_US                    (OS_PORT_CORE_CLOCK_HZ / 1000000UL)
+
+#if ((OS_PORT_CORE_CLOCK_HZ % 1000000UL) != 0UL)
+    #error "OS_PORT_CORE_CLOCK_HZ must be a whole number of MHz"
+#endif
+
+#if defined(OS_PORT_POSIX)
+
+#include "os_port_posix.h"
+
+#else /* Cortex-M7 */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def OS_PORT_NVIC_PRIO_BITS
+ * @brief Implemented NVIC priority bits (S32K3: 4 bits, 16 levels)
+ */
+#ifndef OS_PORT_NVIC_PRIO_BITS
+    #define OS_PORT_NVIC_PRIO_BITS              4U
+#endif
+
+/**
+ * @brief Convert an NVIC priority (0 = most urgent) to a BASEPRI value
+ * @note BASEPRI 0 disables masking, so NVIC priority 0 cannot be a ceiling
+ */
+#define OS_PORT_PRIO_TO_BASEPRI(prio)           ((uint32)(prio) << (8U - OS_PORT_NVIC_PRIO_BITS))
+
+/** @brief DWT registers used for time stamps */
+#define OS_PORT_DWT_CTRL                        (*(volatile uint32 *)0xE0001000UL)
+#define OS_PORT_DWT_CYCCNT                      (*(volatile uint32 *)0xE0001004UL)
+#define OS_PORT_DEMCR                           (*(volatile uint32 *)0xE000EDFCUL)
+#define OS_PORT_DEMCR_TRCENA                    (1UL << 24U)
+#define OS_PORT_DWT_CTRL_CYCCNTENA              (1UL << 0U)
+
+/** @brief SCB registers used for PendSV dispatch */
+#define OS_PORT_SCB_ICSR                        (*(volatile uint32 *)0xE000ED04UL)
+#define OS_PORT_SCB_SHPR2                       (*(volatile uint32 *)0xE000ED1CUL)
+#define OS_PORT_SCB_SHPR3                       (*(volatile uint32 *)0xE000ED20UL)
+#define OS_PORT_ICSR_PENDSVSET                  (1UL << 28U)
+
+/** @brief MCM processor number register (0 = CM7_0, 1 = CM7_1) */
+#define OS_PORT_MCM_CPXNUM                      (*(volatile uint32 *)0x40260004UL)
+
+/**
+ * @brief MSCM core-to-core interrupt 0 registers of a core
+ * @details IRCPnIGR0 raises the interrupt on core n, IRCPnISR0 holds one
+ *          write-1-to-clear bit per requesting core.
+ */
+#define OS_PORT_MSCM_IRCP_ISR0(core)            (*(volatile uint32 *)(0x40198200UL + ((uint32)(core) * 0x20UL)))
+#define OS_PORT_MSCM_IRCP_IGR0(core)            (*(volatile uint32 *)(0x40198204UL + ((uint32)(core) * 0x20UL)))
+
+/** @brief Pend a dispatch at thread level (safe from any ISR) */
+#define OS_PORT_REQUEST_DISPATCH()              (OS_PORT_SCB_ICSR = OS_PORT_ICSR_PENDSVSET)
+
+/** @brief Idle wait for the next interrupt */
+#define OS_PORT_IDLE()                          __asm volatile ("wfi")
+
+/* ===============================================================================================
+ *                                    INLINE FUNCTIONS
+ * =============================================================================================== */
+
+/**
+ * @brief Raise BASEPRI (never lowers it) and return the previous value
+ * @param BasePri Ceiling as BASEPRI register value, 0 leaves the mask unchanged
+ */
+STATIC_INLINE uint32 Os_Port_RaiseBasePri(uint32 BasePri)
+{
+    uint32 previous;
+
+    __asm volatile ("mrs %0, basepri" : "=r" (previous) :: "memory");
+    __asm volatile ("msr basepri_max, %0\n\tisb" :: "r" (BasePri) : "memory");
+
+    return previous;
+}
+
+/**
+ * @brief Restore a BASEPRI value returned by Os_Port_RaiseBasePri()
+ */
+STATIC_INLINE void Os_Port_RestoreBasePri(uint32 BasePri)
+{
+    __asm volatile ("msr basepri, %0\n\tisb" :: "r" (BasePri) : "memory");
+}
+
+/**
+ * @brief Short kernel critical section (PRIMASK), returns previous state
+ */
+STATIC_INLINE uint32 Os_Port_DisableInterrupts(void)
+{
+    uint32 primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by Os_Port_DisableInterrupts()
+ */
+STATIC_INLINE void Os_Port_RestoreInterrupts(uint32 Key)
+{
+    __asm volatile ("msr primask, %0" :: "r" (Key) : "memory");
+}
+
+/**
+ * @brief Enable the DWT cycle counter (once, at OS start)
+ */
+STATIC_INLINE void Os_Port_InitTimestamp(void)
+{
+    OS_PORT_DEMCR |= OS_PORT_DEMCR_TRCENA;
+    OS_PORT_DWT_CYCCNT = 0UL;
+    OS_PORT_DWT_CTRL |= OS_PORT_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Free-running core cycle time stamp (wraps modulo 2^32)
+ */
+STATIC_INLINE uint32 Os_Port_GetTimestamp(void)
+{
+    return OS_PORT_DWT_CYCCNT;
+}
+
+/**
+ * @brief Logical number of the executing core
+ */
+STATIC_INLINE CoreIdType Os_Port_GetCoreId(void)
+{
+#if (OS_NUM_CORES > 1U)
+    return (CoreIdType)(OS_PORT_MCM_CPXNUM & 0xFFUL);
+#else
+    return OS_CORE_ID_MASTER;
+#endif
+}
+
+/**
+ * @brief Raise the inter-core interrupt on another core
+ * @note The caller publishes the request (DMB) before signalling
+ */
+STATIC_INLINE void Os_Port_SignalCore(CoreIdType Core)
+{
+    DATA_SYNC_BARRIER();
+    OS_PORT_MSCM_IRCP_IGR0(Core) = 1UL;
+}
+
+/**
+ * @brief Acknowledge all pending inter-core interrupts of the executing core
+ * @note Call before draining the mailboxes, so a request posted while
+ *       draining raises the interrupt again instead of being lost
+ */
+STATIC_INLINE void Os_Port_ClearCoreSignal(void)
+{
+    CoreIdType core = Os_Port_GetCoreId();
+
+    OS_PORT_MSCM_IRCP_ISR0(core) = OS_PORT_MSCM_IRCP_ISR0(core);
+    DATA_SYNC_BARRIER();
+}
+
+/**
+ * @brief Atomically replace *Address by Desired if it equals Expected
+ * @return TRUE if the value was replaced. FALSE if it differed, or if the
+ *         exclusive access was lost (exception entry, store by another
+ *         core) - callers retry with a fresh value
+ */
+STATIC_INLINE boolean Os_Port_CompareAndSwap(volatile uint32 *Address, uint32 Expected, uint32 Desired)
+{
+    uint32 value;
+    uint32 failed = 1UL;
+
+    __asm volatile ("ldrex %0, [%1]" : "=r" (value) : "r" (Address) : "memory");
+    if (value == Expected)
+    {
+        __asm volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (Address), "r" (Desired) : "memory");
+    }
+    else
+    {
+        __asm volatile ("clrex" ::: "memory");
+    }
+
+    return (failed == 0UL) ? TRUE : FALSE;
+}
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Configure PendSV (lowest) and SVC (highest) exception priorities
+ */
+extern void Os_Port_Init(void);
+
+#endif /* OS_PORT_POSIX */
+
+#endif /* OS_PORT_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
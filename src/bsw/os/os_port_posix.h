@@ -0,0 +1,160 @@
+/**
+ * @file    os_port_posix.h
+ * @brief   OS Port Layer - POSIX Host Port for Software-in-the-Loop
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Host replacement of the Cortex-M7 primitives in os_port.h, selected with
+ * OS_PORT_POSIX. The simulated ECU is single-threaded: interrupts are
+ * injected synchronously by the SIL wrapper between task bodies, so kernel
+ * critical sections reduce to nothing and BASEPRI is a plain variable that
+ * keeps the BASEPRI_MAX semantics for the resource manager.
+ *
+ * Time stamps are derived from the SIL virtual clock (simulated core cycles)
+ * rather than from host time, which keeps runs reproducible. Task bodies
+ * consume no virtual time, so measured lock-hold times are zero on the host.
+ *
+ * With OS_NUM_CORES > 1 the wrapper runs every core's OS instance on the
+ * host thread in turn: Os_Port_PosixCoreId names the core being simulated
+ * and inter-core interrupts are latched in Os_Port_PosixCoreSignals until
+ * the wrapper services them.
+ *
+ * Os_Port_CompareAndSwap() maps to the compiler builtin so that host tests
+ * running producers on real threads exercise the lock-free paths.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Simulated cores                    |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Compare-and-swap                   |
+ *
+ * @see os_port.h
+ * @see sil_wrapper.c
+ */
+
+#ifndef OS_PORT_POSIX_H
+#define OS_PORT_POSIX_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "os_types.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/** @brief Emulated NVIC priority bits (same as S32K3) */
+#define OS_PORT_NVIC_PRIO_BITS                  4U
+
+/** @brief Convert an NVIC priority to an (emulated) BASEPRI value */
+#define OS_PORT_PRIO_TO_BASEPRI(prio)           ((uint32)(prio) << (8U - OS_PORT_NVIC_PRIO_BITS))
+
+/** @brief Defer the dispatch until the injected interrupt returns */
+#define OS_PORT_REQUEST_DISPATCH()              (Os_Port_PosixDispatchPending = TRUE)
+
+/** @brief Idle is handled by the virtual clock loop */
+#define OS_PORT_IDLE()                          ((void)0)
+
+/* ===============================================================================================
+ *                                    GLOBAL VARIABLES
+ * =============================================================================================== */
+
+/** @brief Emulated BASEPRI register */
+extern uint32 Os_Port_PosixBasePri;
+
+/** @brief Dispatch requested from (simulated) interrupt level */
+extern boolean Os_Port_PosixDispatchPending;
+
+/** @brief Core whose OS instance is currently simulated */
+extern CoreIdType Os_Port_PosixCoreId;
+
+/** @brief Bit n set: inter-core interrupt pending on core n */
+extern uint32 Os_Port_PosixCoreSignals;
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Virtual core cycle counter (provided by the SIL wrapper)
+ */
+extern uint32 Sil_GetCycleCount(void);
+
+/* ===============================================================================================
+ *                                    INLINE FUNCTIONS
+ * =============================================================================================== */
+
+STATIC_INLINE uint32 Os_Port_RaiseBasePri(uint32 BasePri)
+{
+    uint32 previous = Os_Port_PosixBasePri;
+
+    /* BASEPRI_MAX: only a more urgent (smaller, non-zero) value takes effect */
+    if ((BasePri != 0UL) && ((previous == 0UL) || (BasePri < previous)))
+    {
+        Os_Port_PosixBasePri = BasePri;
+    }
+
+    return previous;
+}
+
+STATIC_INLINE void Os_Port_RestoreBasePri(uint32 BasePri)
+{
+    Os_Port_PosixBasePri = BasePri;
+}
+
+STATIC_INLINE uint32 Os_Port_DisableInterrupts(void)
+{
+    return 0UL;
+}
+
+STATIC_INLINE void Os_Port_RestoreInterrupts(uint32 Key)
+{
+    (void)Key;
+}
+
+STATIC_INLINE void Os_Port_InitTimestamp(void)
+{
+}
+
+STATIC_INLINE uint32 Os_Port_GetTimestamp(void)
+{
+    return Sil_GetCycleCount();
+}
+
+STATIC_INLINE CoreIdType Os_Port_GetCoreId(void)
+{
+    return Os_Port_PosixCoreId;
+}
+
+STATIC_INLINE void Os_Port_SignalCore(CoreIdType Core)
+{
+    Os_Port_PosixCoreSignals |= (1UL << Core);
+}
+
+STATIC_INLINE void Os_Port_ClearCoreSignal(void)
+{
+    Os_Port_PosixCoreSignals &= ~(1UL << Os_Port_PosixCoreId);
+}
+
+STATIC_INLINE boolean Os_Port_CompareAndSwap(volatile uint32 *Address, uint32 Expected, uint32 Desired)
+{
+    return __sync_bool_compare_and_swap(Address, Expected, Desired) ? TRUE : FALSE;
+}
+
+STATIC_INLINE void Os_Port_Init(void)
+{
+    Os_Port_PosixBasePri = 0UL;
+    Os_Port_PosixDispatchPending = FALSE;
+}
+
+#endif /* OS_PORT_POSIX_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,134 @@
+/**
+ * @file    os_types.h
+ * @brief   OS Common Types and Status Codes
+ * @version 1.1.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Types shared by the OS sub-modules (scheduler, resource manager, port
+ * layer). Status codes follow OSEK/VDX OS 2.2.3 and AUTOSAR OS
+ * (StatusType from platform_types.h).
+ *
+ * Priority convention: larger numeric value = higher task priority
+ * (OSEK). Hardware interrupt priorities keep the NVIC convention
+ * (smaller value = more urgent) and are only handled by os_port.h.
+ *
+ * OS_NUM_CORES selects the number of cores running an OS instance: 1 for
+ * lockstep parts (S32K344/S32K348), 2 for split-lock S32K358/S32K356.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Core identifiers, E_OS_CORE        |
+ *
+ * @see scheduler.h
+ * @see resource_manager.h
+ */
+
+#ifndef OS_TYPES_H
+#define OS_TYPES_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define OS_VENDOR_ID                            43U
+#define OS_MODULE_ID                            1U      /**< AUTOSAR Os */
+#define OS_INSTANCE_ID                          0U
+
+#define OS_SW_MAJOR_VERSION                     1U
+#define OS_SW_MINOR_VERSION                     0U
+#define OS_SW_PATCH_VERSION                     0U
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def OS_NUM_CORES
+ * @brief Number of cores with their own scheduler instance (1..4)
+ */
+#ifndef OS_NUM_CORES
+    #define OS_NUM_CORES                        1U
+#endif
+
+#if ((OS_NUM_CORES == 0U) || (OS_NUM_CORES > 4U))
+    #error "OS_NUM_CORES must be in the range 1..4"
+#endif
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (OS_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "os_types.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    STATUS CODES (OSEK/VDX)
+ * =============================================================================================== */
+
+#ifndef E_OS_ACCESS
+#define E_OS_ACCESS                             ((StatusType)1U)    /**< Access rights violated */
+#define E_OS_CALLEVEL                           ((StatusType)2U)    /**< Call at wrong level */
+#define E_OS_ID                                 ((StatusType)3U)    /**< Invalid object ID */
+#define E_OS_LIMIT                              ((StatusType)4U)    /**< Activation limit exceeded */
+#define E_OS_NOFUNC                             ((StatusType)5U)    /**< Object not in required state */
+#define E_OS_RESOURCE                           ((StatusType)6U)    /**< Resource still occupied */
+#define E_OS_STATE                              ((StatusType)7U)    /**< Object in wrong state */
+#define E_OS_VALUE                              ((StatusType)8U)    /**< Value out of range */
+#endif
+
+#ifndef E_OS_CORE
+#define E_OS_CORE                               ((StatusType)9U)    /**< Object owned by another core (AUTOSAR) */
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @typedef Os_PriorityType
+ * @brief Task priority (0 = lowest, 255 = highest)
+ */
+typedef uint8 Os_PriorityType;
+
+/**
+ * @typedef ResourceType
+ * @brief OSEK resource identifier (index into the resource configuration)
+ */
+typedef uint8 ResourceType;
+
+/**
+ * @typedef Os_OwnerType
+ * @brief Task or ISR identifier recorded as resource owner
+ */
+typedef uint8 Os_OwnerType;
+
+/** @brief No owner / idle context */
+#define OS_INVALID_OWNER                        ((Os_OwnerType)0xFFU)
+
+/** @brief No resource (end of a resource chain) */
+#define OS_INVALID_RESOURCE                     ((ResourceType)0xFFU)
+
+/* CoreIdType (AUTOSAR logical core identifier) comes from platform_types.h */
+
+/** @brief Core that boots first and initializes the OS */
+#define OS_CORE_ID_MASTER                       ((CoreIdType)0U)
+
+#endif /* OS_TYPES_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
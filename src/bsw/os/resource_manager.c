@@ -0,0 +1,439 @@
+/**
+ * @file    resource_manager.c
+ * @brief   OS Resource Manager - Immediate Priority Ceiling Protocol Implementation
+ * @version 1.2.1
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the resource services declared in resource_manager.h.
+ *
+ * Implementation Notes:
+ * - The BASEPRI value of each ceiling is precomputed at init; GetResource()
+ *   for an ISR-shared resource costs one MRS and one MSR BASEPRI_MAX
+ * - BASEPRI and the task ceiling are raised before the resource state is
+ *   inspected and dropped only after it is freed, so a sharer never finds
+ *   the resource occupied (E_OS_ACCESS) in between
+ * - Held resources form a LIFO chain through the resource state (next), so
+ *   nesting needs no separate stack
+ * - Hold time is measured with the ceiling still in effect and reported to
+ *   the deadlock detector before the ceiling is dropped
+ * - The running context is kept per core; resource state is only written by
+ *   the owning core, so no inter-core locking is needed
+ * - Os_Resource_MainFunction() supervises the holds of the calling core's
+ *   resources only: acquisition time stamps come from the core's own cycle
+ *   counter and cannot be compared across cores
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Per-core running context           |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Periodic deadlock supervision      |
+ * | 1.2.1   | 2026-10-16 | BSW Team        | Ceilings raised before occupation  |
+ *
+ * @see resource_manager.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "resource_manager.h"
+#include "scheduler.h"
+#include "os_port.h"
+#include "det.h"
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    #include "deadlock_detection.h"
+#endif
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define OS_RESOURCE_C_VENDOR_ID                 43U
+#define OS_RESOURCE_C_SW_MAJOR_VERSION          1U
+#define OS_RESOURCE_C_SW_MINOR_VERSION          0U
+#define OS_RESOURCE_C_SW_PATCH_VERSION          0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (OS_RESOURCE_C_VENDOR_ID != OS_VENDOR_ID)
+    #error "resource_manager.c and os_types.h have different vendor IDs"
+#endif
+
+#if ((OS_RESOURCE_C_SW_MAJOR_VERSION != OS_SW_MAJOR_VERSION) || \
+     (OS_RESOURCE_C_SW_MINOR_VERSION != OS_SW_MINOR_VERSION) || \
+     (OS_RESOURCE_C_SW_PATCH_VERSION != OS_SW_PATCH_VERSION))
+    #error "Software version mismatch between resource_manager.c and os_types.h"
+#endif
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    #if (OS_MAX_RESOURCES > DEADLOCKDET_MAX_RESOURCES)
+        #error "OS_MAX_RESOURCES exceeds the resources supervised by the deadlock detector"
+    #endif
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    #define OS_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, (api), (err)))
+#else
+    #define OS_REPORT_ERROR(api, err)           ((void)0)
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Runtime state of one resource
+ */
+typedef struct
+{
+    uint32          basepri;            /**< Precomputed ISR ceiling, 0 = task-only resource */
+    uint32          saved_basepri;      /**< BASEPRI before acquisition */
+    uint32          acquire_timestamp;  /**< Cycle counter at acquisition */
+    Os_PriorityType task_ceiling;       /**< Task ceiling priority */
+    Os_PriorityType saved_priority;     /**< Holder priority before acquisition */
+    Os_OwnerType    owner;              /**< Holder, OS_INVALID_OWNER if free */
+    ResourceType    next;               /**< Resource held before this one (LIFO chain) */
+    CoreIdType      core;               /**< Owning core */
+    boolean         occupied;           /**< Currently held */
+} Os_ResourceStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC Os_ResourceStateType Os_ResourceState[OS_MAX_RESOURCES];
+STATIC Os_ResourceTelemetryType Os_ResourceTelemetry[OS_MAX_RESOURCES];
+STATIC uint8 Os_ResourceCount = 0U;
+
+/** @brief Context of the running task/ISR of each core */
+STATIC Os_ResourceContextType Os_ResourceCurrent[OS_NUM_CORES];
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+/** @brief Resources of each core, one bit per resource ID */
+STATIC uint32 Os_ResourceCoreMask[OS_NUM_CORES];
+#endif
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Os_Resource_Release(P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) Current,
+                                P2VAR(Os_ResourceStateType, AUTOMATIC, OS_VAR) Res, ResourceType ResID);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Record the hold, pop the resource and drop its ceilings
+ * @note Res is the innermost resource of the running context Current
+ */
+STATIC void Os_Resource_Release(P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) Current,
+                                P2VAR(Os_ResourceStateType, AUTOMATIC, OS_VAR) Res, ResourceType ResID)
+{
+    P2VAR(Os_ResourceTelemetryType, AUTOMATIC, OS_VAR) tel = &Os_ResourceTelemetry[ResID];
+    uint32 hold = Os_Port_GetTimestamp() - Res->acquire_timestamp;
+    uint32 basepri = Res->saved_basepri;
+
+    tel->last_hold_time = hold;
+    if (hold > tel->max_hold_time)
+    {
+        tel->max_hold_time = hold;
+        tel->max_hold_owner = Res->owner;
+    }
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    DeadlockDet_NotifyRelease(ResID, hold);
+#endif
+
+    /* Free before dropping the ceilings: a sharer released by the drop finds it free */
+    Current->last_resource = Res->next;
+    Res->owner = OS_INVALID_OWNER;
+    Res->next = OS_INVALID_RESOURCE;
+    Res->occupied = FALSE;
+    COMPILER_BARRIER();
+    Current->current_priority = Res->saved_priority;
+
+    if (Res->basepri != 0UL)
+    {
+        Os_Port_RestoreBasePri(basepri);
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize the resource manager
+ */
+void Os_Resource_Init(P2CONST(Os_ResourceConfigType, AUTOMATIC, OS_APPL_CONST) Config,
+                      uint8 Count)
+{
+    uint8 id;
+
+    if (Config == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_RESOURCE_INIT_API_ID, OS_E_PARAM_POINTER);
+        return;
+    }
+
+    if (Count > OS_MAX_RESOURCES)
+    {
+        OS_REPORT_ERROR(OS_RESOURCE_INIT_API_ID, OS_E_PARAM_CONFIG);
+        return;
+    }
+
+    for (id = 0U; id < Count; id++)
+    {
+        /* NVIC priority 0 cannot be expressed as BASEPRI ceiling */
+        if ((Config[id].isr_ceiling == 0U) || (Config[id].core >= OS_NUM_CORES))
+        {
+            OS_REPORT_ERROR(OS_RESOURCE_INIT_API_ID, OS_E_PARAM_CONFIG);
+            return;
+        }
+    }
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    for (id = 0U; id < OS_NUM_CORES; id++)
+    {
+        Os_ResourceCoreMask[id] = 0UL;
+    }
+#endif
+
+    for (id = 0U; id < Count; id++)
+    {
+        Os_ResourceState[id].basepri = (Config[id].isr_ceiling == OS_RESOURCE_NO_ISR) ?
+                                       0UL : OS_PORT_PRIO_TO_BASEPRI(Config[id].isr_ceiling);
+        Os_ResourceState[id].saved_basepri = 0UL;
+        Os_ResourceState[id].acquire_timestamp = 0UL;
+        Os_ResourceState[id].task_ceiling = Config[id].task_ceiling;
+        Os_ResourceState[id].saved_priority = 0U;
+        Os_ResourceState[id].owner = OS_INVALID_OWNER;
+        Os_ResourceState[id].next = OS_INVALID_RESOURCE;
+        Os_ResourceState[id].core = Config[id].core;
+        Os_ResourceState[id].occupied = FALSE;
+
+        Os_ResourceTelemetry[id].acquisitions = 0UL;
+        Os_ResourceTelemetry[id].last_hold_time = 0UL;
+        Os_ResourceTelemetry[id].max_hold_time = 0UL;
+        Os_ResourceTelemetry[id].max_hold_owner = OS_INVALID_OWNER;
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+        Os_ResourceCoreMask[Config[id].core] |= (1UL << id);
+        DeadlockDet_RegisterResource(id, Config[id].hold_budget);
+#endif
+    }
+
+    for (id = 0U; id < OS_NUM_CORES; id++)
+    {
+        Os_ResourceCurrent[id].owner = OS_INVALID_OWNER;
+        Os_ResourceCurrent[id].base_priority = 0U;
+        Os_ResourceCurrent[id].current_priority = 0U;
+        Os_ResourceCurrent[id].last_resource = OS_INVALID_RESOURCE;
+    }
+
+    Os_Port_InitTimestamp();
+    Os_ResourceCount = Count;
+}
+
+/**
+ * @brief Occupy a resource
+ */
+StatusType GetResource(ResourceType ResID)
+{
+    P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) cur;
+    P2VAR(Os_ResourceStateType, AUTOMATIC, OS_VAR) res;
+    uint32 basepri = 0UL;
+    Os_PriorityType priority;
+
+    if (ResID >= Os_ResourceCount)
+    {
+        OS_REPORT_ERROR(OS_GET_RESOURCE_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    res = &Os_ResourceState[ResID];
+
+    if (res->core != Os_Port_GetCoreId())
+    {
+        OS_REPORT_ERROR(OS_GET_RESOURCE_API_ID, E_OS_CORE);
+        return E_OS_CORE;
+    }
+
+    cur = &Os_ResourceCurrent[res->core];
+
+    /* Raise both ceilings first: the checks and writes below then run with
+     * every sharer, task or ISR, kept from preempting */
+    if (res->basepri != 0UL)
+    {
+        basepri = Os_Port_RaiseBasePri(res->basepri);
+    }
+    priority = cur->current_priority;
+    if (res->task_ceiling > priority)
+    {
+        cur->current_priority = res->task_ceiling;
+    }
+    COMPILER_BARRIER();
+
+    if ((res->occupied == TRUE) ||
+        (cur->base_priority > res->task_ceiling))
+    {
+        cur->current_priority = priority;
+        if (res->basepri != 0UL)
+        {
+            Os_Port_RestoreBasePri(basepri);
+        }
+        OS_REPORT_ERROR(OS_GET_RESOURCE_API_ID, E_OS_ACCESS);
+        return E_OS_ACCESS;
+    }
+
+    res->saved_basepri = basepri;
+    res->saved_priority = priority;
+    res->owner = cur->owner;
+    res->next = cur->last_resource;
+    res->occupied = TRUE;
+    cur->last_resource = ResID;
+
+    Os_ResourceTelemetry[ResID].acquisitions++;
+    res->acquire_timestamp = Os_Port_GetTimestamp();
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    DeadlockDet_NotifyAcquire(ResID, res->next, res->acquire_timestamp);
+#endif
+
+    return E_OK;
+}
+
+/**
+ * @brief Release a resource
+ */
+StatusType ReleaseResource(ResourceType ResID)
+{
+    P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) cur = &Os_ResourceCurrent[Os_Port_GetCoreId()];
+    Os_PriorityType previous;
+
+    if (ResID >= Os_ResourceCount)
+    {
+        OS_REPORT_ERROR(OS_RELEASE_RESOURCE_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    /* Only the innermost resource of the running context may be released */
+    if (cur->last_resource != ResID)
+    {
+        OS_REPORT_ERROR(OS_RELEASE_RESOURCE_API_ID, E_OS_NOFUNC);
+        return E_OS_NOFUNC;
+    }
+
+    previous = cur->current_priority;
+    Os_Resource_Release(cur, &Os_ResourceState[ResID], ResID);
+
+    if (cur->current_priority < previous)
+    {
+        OS_RESOURCE_RESCHEDULE_HOOK();
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Switch to a new task/ISR context
+ */
+void Os_Resource_EnterContext(Os_OwnerType Owner, Os_PriorityType Priority,
+                              P2VAR(Os_ResourceContextType, AUTOMATIC, OS_APPL_DATA) Saved)
+{
+    P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) cur = &Os_ResourceCurrent[Os_Port_GetCoreId()];
+
+    *Saved = *cur;
+
+    cur->owner = Owner;
+    cur->base_priority = Priority;
+    cur->current_priority = Priority;
+    cur->last_resource = OS_INVALID_RESOURCE;
+}
+
+/**
+ * @brief Return to the preempted context
+ */
+StatusType Os_Resource_LeaveContext(P2CONST(Os_ResourceContextType, AUTOMATIC, OS_APPL_DATA) Saved)
+{
+    P2VAR(Os_ResourceContextType, AUTOMATIC, OS_VAR) cur = &Os_ResourceCurrent[Os_Port_GetCoreId()];
+    StatusType status = E_OK;
+
+    /* Force-release everything the finishing context still holds */
+    while (cur->last_resource != OS_INVALID_RESOURCE)
+    {
+        ResourceType id = cur->last_resource;
+
+        Os_Resource_Release(cur, &Os_ResourceState[id], id);
+        status = E_OS_RESOURCE;
+    }
+
+    if (status != E_OK)
+    {
+        OS_REPORT_ERROR(OS_RESOURCE_LEAVE_CONTEXT_API_ID, E_OS_RESOURCE);
+    }
+
+    *cur = *Saved;
+
+    return status;
+}
+
+/**
+ * @brief Current priority of the running context including held ceilings
+ */
+Os_PriorityType Os_Resource_GetCurrentPriority(void)
+{
+    return Os_ResourceCurrent[Os_Port_GetCoreId()].current_priority;
+}
+
+/**
+ * @brief Copy the hold telemetry of a resource
+ */
+Std_ReturnType Os_Resource_GetTelemetry(ResourceType ResID,
+    P2VAR(Os_ResourceTelemetryType, AUTOMATIC, OS_APPL_DATA) Telemetry)
+{
+    if (Telemetry == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_RESOURCE_GET_TELEMETRY_API_ID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (ResID >= Os_ResourceCount)
+    {
+        OS_REPORT_ERROR(OS_RESOURCE_GET_TELEMETRY_API_ID, E_OS_ID);
+        return E_NOT_OK;
+    }
+
+    *Telemetry = Os_ResourceTelemetry[ResID];
+
+    return E_OK;
+}
+
+/**
+ * @brief Periodic resource supervision
+ */
+void Os_Resource_MainFunction(void)
+{
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    /* Only the caller's resources: the others are stamped by another core's cycle counter */
+    DeadlockDet_MainFunction(Os_Port_GetTimestamp(), Os_ResourceCoreMask[Os_Port_GetCoreId()]);
+#endif
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
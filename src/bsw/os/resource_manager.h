@@ -0,0 +1,261 @@
+/**
+ * @file    resource_manager.h
+ * @brief   OS Resource Manager - Immediate Priority Ceiling Protocol
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * OSEK/AUTOSAR GetResource()/ReleaseResource() with the immediate priority
+ * ceiling protocol (OSEK PCP):
+ *
+ * - Task ceiling: the running context's priority is raised to the highest
+ *   priority of all tasks sharing the resource. The scheduler reads it via
+ *   Os_Resource_GetCurrentPriority() and does not dispatch tasks at or below
+ *   it, so no task sharing the resource can preempt the holder.
+ * - ISR ceiling: if a Category 2 ISR shares the resource, BASEPRI is raised
+ *   to that ISR's NVIC priority. Only interrupts at or below the ceiling are
+ *   held off; more urgent interrupts are never blocked. Task-only resources
+ *   do not touch BASEPRI at all.
+ *
+ * Compared with SuspendAllInterrupts()-style critical sections this bounds
+ * the interrupt latency impact of a resource to the ISRs that share it.
+ *
+ * Lock-hold telemetry:
+ * - Every hold is time-stamped with the DWT cycle counter
+ * - Per-resource maximum/last hold time and acquisition counters
+ * - Holds are forwarded to the deadlock detector (hold budget, stuck holds,
+ *   acquisition-order cycles)
+ *
+ * Resources must be released in LIFO order; a task must release all
+ * resources before it terminates (checked in Os_Resource_LeaveContext()).
+ *
+ * Multi-core: every core keeps its own running context, and a resource is
+ * owned by one core (Os_ResourceConfigType.core). Ceilings only order tasks
+ * of the same core, so a resource can never be shared across cores;
+ * GetResource() from another core is rejected with E_OS_CORE.
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Per-core context, owning core      |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Periodic deadlock supervision      |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_OS_RES_001: Mutual exclusion without unbounded priority inversion
+ * - SR_OS_RES_002: Deadlock freedom by construction (ICPP), supervised at runtime
+ * - SR_OS_RES_003: Resource hold times observable and bounded
+ *
+ * @see resource_manager.c
+ * @see os_port.h
+ * @see deadlock_detection.h
+ */
+
+#ifndef RESOURCE_MANAGER_H
+#define RESOURCE_MANAGER_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "os_types.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define OS_RESOURCE_INIT_API_ID                 0x10U
+#define OS_GET_RESOURCE_API_ID                  0x11U
+#define OS_RELEASE_RESOURCE_API_ID              0x12U
+#define OS_RESOURCE_LEAVE_CONTEXT_API_ID        0x13U
+#define OS_RESOURCE_GET_TELEMETRY_API_ID        0x14U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define OS_E_PARAM_POINTER                      0x01U   /**< NULL pointer parameter */
+#define OS_E_UNINIT                             0x02U   /**< Resource manager not initialized */
+#define OS_E_PARAM_CONFIG                       0x03U   /**< Invalid resource configuration */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def OS_MAX_RESOURCES
+ * @brief Maximum number of configured resources
+ */
+#ifndef OS_MAX_RESOURCES
+    #define OS_MAX_RESOURCES                    32U
+#endif
+
+/**
+ * @def OS_DEV_ERROR_DETECT
+ * @brief Report OS API misuse to DET in addition to the returned StatusType
+ */
+#ifndef OS_DEV_ERROR_DETECT
+    #define OS_DEV_ERROR_DETECT                 STD_ON
+#endif
+
+/**
+ * @def OS_RESOURCE_DEADLOCK_DETECTION
+ * @brief Forward lock-hold telemetry to the deadlock detector
+ */
+#ifndef OS_RESOURCE_DEADLOCK_DETECTION
+    #define OS_RESOURCE_DEADLOCK_DETECTION      STD_ON
+#endif
+
+/**
+ * @def OS_RESOURCE_RESCHEDULE_HOOK
+ * @brief Called after ReleaseResource() lowered the running priority
+ * @details Dispatches tasks that became eligible (scheduler.h).
+ */
+#ifndef OS_RESOURCE_RESCHEDULE_HOOK
+    #define OS_RESOURCE_RESCHEDULE_HOOK()       Os_Schedule()
+#endif
+
+/** @brief isr_ceiling value for resources shared by tasks only */
+#define OS_RESOURCE_NO_ISR                      0xFFU
+
+#if (OS_MAX_RESOURCES > 0xFEU)
+    #error "OS_MAX_RESOURCES must leave room for OS_INVALID_RESOURCE"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @struct Os_ResourceConfigType
+ * @brief Generated resource configuration (one entry per ResourceType)
+ */
+typedef struct
+{
+    Os_PriorityType task_ceiling;       /**< Highest priority of all tasks using the resource */
+    uint8           isr_ceiling;        /**< Most urgent NVIC priority of sharing ISRs, OS_RESOURCE_NO_ISR */
+    uint32          hold_budget;        /**< Allowed hold time in cycles, 0 = unmonitored */
+    CoreIdType      core;               /**< Owning core */
+} Os_ResourceConfigType;
+
+/**
+ * @struct Os_ResourceContextType
+ * @brief Resource state of the running task/ISR, saved across preemption
+ */
+typedef struct
+{
+    Os_OwnerType    owner;              /**< Running task/ISR */
+    Os_PriorityType base_priority;      /**< Statically assigned priority */
+    Os_PriorityType current_priority;   /**< Priority raised by held ceilings */
+    ResourceType    last_resource;      /**< Innermost held resource, OS_INVALID_RESOURCE if none */
+} Os_ResourceContextType;
+
+/**
+ * @struct Os_ResourceTelemetryType
+ * @brief Per-resource lock-hold telemetry
+ */
+typedef struct
+{
+    uint32          acquisitions;       /**< Successful GetResource calls */
+    uint32          last_hold_time;     /**< Last completed hold in cycles */
+    uint32          max_hold_time;      /**< Longest completed hold in cycles */
+    Os_OwnerType    max_hold_owner;     /**< Owner of the longest hold */
+} Os_ResourceTelemetryType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize the resource manager
+ * @param[in] Config Generated resource table
+ * @param[in] Count  Number of entries (<= OS_MAX_RESOURCES)
+ *
+ * @serviceID OS_RESOURCE_INIT_API_ID (0x10)
+ * @reentrancy Non-Reentrant
+ */
+extern void Os_Resource_Init(P2CONST(Os_ResourceConfigType, AUTOMATIC, OS_APPL_CONST) Config,
+                             uint8 Count);
+
+/**
+ * @brief Occupy a resource (OSEK GetResource)
+ * @return E_OK, E_OS_ID for an invalid resource, E_OS_ACCESS if the resource
+ *         is occupied or the caller's priority is above the ceiling,
+ *         E_OS_CORE if the resource belongs to another core
+ *
+ * @serviceID OS_GET_RESOURCE_API_ID (0x11)
+ */
+extern StatusType GetResource(ResourceType ResID);
+
+/**
+ * @brief Release a resource (OSEK ReleaseResource)
+ * @return E_OK, E_OS_ID for an invalid resource, E_OS_NOFUNC if the resource
+ *         is not the innermost resource held by the caller
+ *
+ * @serviceID OS_RELEASE_RESOURCE_API_ID (0x12)
+ */
+extern StatusType ReleaseResource(ResourceType ResID);
+
+/**
+ * @brief Switch to a new task/ISR context (called by the dispatcher)
+ * @param[in]  Owner    Task or ISR about to run
+ * @param[in]  Priority Its statically assigned priority (0 for ISRs)
+ * @param[out] Saved    Receives the preempted context
+ */
+extern void Os_Resource_EnterContext(Os_OwnerType Owner, Os_PriorityType Priority,
+                                     P2VAR(Os_ResourceContextType, AUTOMATIC, OS_APPL_DATA) Saved);
+
+/**
+ * @brief Return to the preempted context (called by the dispatcher)
+ * @details Resources still held by the finishing context are released and
+ *          E_OS_RESOURCE is returned (OSEK: TerminateTask with occupied
+ *          resources).
+ *
+ * @serviceID OS_RESOURCE_LEAVE_CONTEXT_API_ID (0x13)
+ */
+extern StatusType Os_Resource_LeaveContext(P2CONST(Os_ResourceContextType, AUTOMATIC, OS_APPL_DATA) Saved);
+
+/**
+ * @brief Current priority of the running context including held ceilings
+ */
+extern Os_PriorityType Os_Resource_GetCurrentPriority(void);
+
+/**
+ * @brief Copy the hold telemetry of a resource
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID OS_RESOURCE_GET_TELEMETRY_API_ID (0x14)
+ */
+extern Std_ReturnType Os_Resource_GetTelemetry(ResourceType ResID,
+    P2VAR(Os_ResourceTelemetryType, AUTOMATIC, OS_APPL_DATA) Telemetry);
+
+/**
+ * @brief Periodic resource supervision (stuck holds, lock-order cycles)
+ * @details Runs the deadlock detector on the resource time base; called from
+ *          a periodic task. Stuck holds are checked for the resources of the
+ *          calling core only, their time stamps being taken from its cycle
+ *          counter. Empty if OS_RESOURCE_DEADLOCK_DETECTION is off.
+ */
+extern void Os_Resource_MainFunction(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESOURCE_MANAGER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,520 @@
+/**
+ * @file    scheduler.c
+ * @brief   OS Scheduler - Fixed-Priority Preemptive Basic Tasks and Alarms Implementation
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the scheduler declared in scheduler.h.
+ *
+ * Implementation Notes:
+ * - Task priorities are unique, so the ready queue is a single 32-bit mask
+ *   plus an activation counter per task; dispatch is one CLZ
+ * - Os_Schedule() runs a task body nested inside the preempted one; the
+ *   resource manager context is swapped around each body so ceilings and
+ *   held resources are per task
+ * - Alarms are timing-wheel timers; their callbacks run from Os_Tick() /
+ *   Os_AdvanceTicks() at interrupt level and only activate tasks
+ * - All dispatch state lives in one Os_CoreStateType per core, selected by
+ *   Os_Port_GetCoreId(); per-task and per-alarm state is only written by
+ *   the core the object is partitioned to
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Per-core scheduler instances       |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Deadlock detector initialization   |
+ *
+ * @see scheduler.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "scheduler.h"
+#include "lockstep_scheduler.h"
+#include "os_port.h"
+#include "det.h"
+
+#if (OS_STACK_MONITORING == STD_ON)
+    #include "stack_monitor.h"
+#endif
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    #include "deadlock_detection.h"
+#endif
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define OS_SCHEDULER_C_VENDOR_ID                43U
+#define OS_SCHEDULER_C_SW_MAJOR_VERSION         1U
+#define OS_SCHEDULER_C_SW_MINOR_VERSION         0U
+#define OS_SCHEDULER_C_SW_PATCH_VERSION         0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (OS_SCHEDULER_C_VENDOR_ID != OS_VENDOR_ID)
+    #error "scheduler.c and os_types.h have different vendor IDs"
+#endif
+
+#if ((OS_SCHEDULER_C_SW_MAJOR_VERSION != OS_SW_MAJOR_VERSION) || \
+     (OS_SCHEDULER_C_SW_MINOR_VERSION != OS_SW_MINOR_VERSION) || \
+     (OS_SCHEDULER_C_SW_PATCH_VERSION != OS_SW_PATCH_VERSION))
+    #error "Software version mismatch between scheduler.c and os_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    #define OS_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, (api), (err)))
+#else
+    #define OS_REPORT_ERROR(api, err)           ((void)0)
+#endif
+
+#define OS_PRIORITY_BIT(prio)                   (1UL << (prio))
+
+/** @brief Core an alarm belongs to (the core of the task it activates) */
+#define OS_ALARM_CORE(alarm)                    (Os_Cfg->tasks[Os_Cfg->alarms[(alarm)].task].core)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Scheduler instance of one core
+ */
+typedef struct
+{
+    volatile uint32    ready_mask;                          /**< Bit p: task with priority p ready */
+    TaskType           priority_task[OS_MAX_PRIORITIES];    /**< Task of each priority on this core */
+    TimerMgr_WheelType alarm_wheel;                         /**< OS counter and alarms of this core */
+    volatile uint8     isr_nesting;                         /**< Category 2 ISR nesting depth */
+} Os_CoreStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC P2CONST(Os_ConfigType, AUTOMATIC, OS_APPL_CONST) Os_Cfg = NULL_PTR;
+
+STATIC Os_CoreStateType Os_Core[OS_NUM_CORES];
+
+STATIC uint8 Os_Activations[OS_MAX_TASKS];
+
+STATIC TimerMgr_TimerType Os_AlarmTimers[OS_MAX_ALARMS];
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Os_AlarmExpired(P2VAR(TimerMgr_TimerType, AUTOMATIC, OS_VAR) Timer,
+                            P2VAR(void, AUTOMATIC, OS_VAR) Context);
+STATIC boolean Os_ValidateConfig(P2CONST(Os_ConfigType, AUTOMATIC, OS_APPL_CONST) Config);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Alarm action: activate the configured task
+ */
+STATIC void Os_AlarmExpired(P2VAR(TimerMgr_TimerType, AUTOMATIC, OS_VAR) Timer,
+                            P2VAR(void, AUTOMATIC, OS_VAR) Context)
+{
+    uint32 alarm = (uint32)(Timer - Os_AlarmTimers);
+
+    (void)Context;
+    (void)ActivateTask(Os_Cfg->alarms[alarm].task);
+}
+
+/**
+ * @brief Check limits and priority uniqueness of a configuration
+ */
+STATIC boolean Os_ValidateConfig(P2CONST(Os_ConfigType, AUTOMATIC, OS_APPL_CONST) Config)
+{
+    uint32 used[OS_NUM_CORES] = { 0UL };
+    boolean valid = TRUE;
+    uint8 i;
+
+    if ((Config->task_count > OS_MAX_TASKS) || (Config->alarm_count > OS_MAX_ALARMS))
+    {
+        valid = FALSE;
+    }
+
+    for (i = 0U; (valid == TRUE) && (i < Config->task_count); i++)
+    {
+        Os_PriorityType prio = Config->tasks[i].priority;
+        CoreIdType core = Config->tasks[i].core;
+
+        /* Priorities are unique within the partition of a core */
+        if ((core >= OS_NUM_CORES) || (prio == 0U) || (prio >= OS_MAX_PRIORITIES) ||
+            ((used[core] & OS_PRIORITY_BIT(prio)) != 0UL) ||
+            (Config->tasks[i].max_activations == 0U) || (Config->tasks[i].entry == NULL_PTR))
+        {
+            valid = FALSE;
+        }
+        else
+        {
+            used[core] |= OS_PRIORITY_BIT(prio);
+        }
+    }
+
+    for (i = 0U; (valid == TRUE) && (i < Config->alarm_count); i++)
+    {
+        if (Config->alarms[i].task >= Config->task_count)
+        {
+            valid = FALSE;
+        }
+    }
+
+    return valid;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Initialize scheduler, alarms and resources
+ */
+void Os_Init(P2CONST(Os_ConfigType, AUTOMATIC, OS_APPL_CONST) Config)
+{
+    uint8 i;
+
+    if (Config == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_INIT_API_ID, OS_E_PARAM_POINTER);
+        return;
+    }
+
+    if (Os_ValidateConfig(Config) == FALSE)
+    {
+        OS_REPORT_ERROR(OS_INIT_API_ID, OS_E_PARAM_CONFIG);
+        return;
+    }
+
+    Os_Port_Init();
+
+    for (i = 0U; i < OS_NUM_CORES; i++)
+    {
+        Os_Core[i].ready_mask = 0UL;
+        Os_Core[i].isr_nesting = 0U;
+        TimerMgr_Init(&Os_Core[i].alarm_wheel, 0U);
+    }
+
+    for (i = 0U; i < Config->task_count; i++)
+    {
+        Os_Activations[i] = 0U;
+        Os_Core[Config->tasks[i].core].priority_task[Config->tasks[i].priority] = i;
+    }
+
+    for (i = 0U; i < Config->alarm_count; i++)
+    {
+        TimerMgr_InitTimer(&Os_AlarmTimers[i], &Os_AlarmExpired, NULL_PTR);
+    }
+
+#if (OS_RESOURCE_DEADLOCK_DETECTION == STD_ON)
+    DeadlockDet_Init();                 /* Clears the hold budgets, so before Os_Resource_Init() */
+#endif
+
+    if (Config->resources != NULL_PTR)
+    {
+        Os_Resource_Init(Config->resources, Config->resource_count);
+    }
+
+    Os_Core_Init();
+
+    Os_Cfg = Config;
+}
+
+/**
+ * @brief Activate autostart tasks/alarms and run the first dispatch
+ */
+void Os_Start(void)
+{
+    CoreIdType core = Os_Port_GetCoreId();
+    uint8 i;
+
+    if (Os_Cfg == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_START_API_ID, OS_E_UNINIT);
+        return;
+    }
+
+    /* Os_Init() set up the port of the master core only */
+    if (core != OS_CORE_ID_MASTER)
+    {
+        Os_Port_Init();
+        Os_Port_InitTimestamp();
+    }
+
+    for (i = 0U; i < Os_Cfg->alarm_count; i++)
+    {
+        if ((Os_Cfg->alarms[i].offset != 0U) && (OS_ALARM_CORE(i) == core))
+        {
+            (void)SetRelAlarm(i, Os_Cfg->alarms[i].offset, Os_Cfg->alarms[i].cycle);
+        }
+    }
+
+    for (i = 0U; i < Os_Cfg->task_count; i++)
+    {
+        if ((Os_Cfg->tasks[i].autostart == TRUE) && (Os_Cfg->tasks[i].core == core))
+        {
+            (void)ActivateTask(i);
+        }
+    }
+
+    Os_Schedule();
+}
+
+/**
+ * @brief Activate a task
+ */
+StatusType ActivateTask(TaskType TaskID)
+{
+    P2CONST(Os_TaskConfigType, AUTOMATIC, OS_APPL_CONST) task;
+    uint32 key;
+
+    if ((Os_Cfg == NULL_PTR) || (TaskID >= Os_Cfg->task_count))
+    {
+        OS_REPORT_ERROR(OS_ACTIVATE_TASK_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    task = &Os_Cfg->tasks[TaskID];
+
+    if (task->core != Os_Port_GetCoreId())
+    {
+        return Os_Core_PostActivation(task->core, TaskID);
+    }
+
+    key = Os_Port_DisableInterrupts();
+    if (Os_Activations[TaskID] >= task->max_activations)
+    {
+        Os_Port_RestoreInterrupts(key);
+        OS_REPORT_ERROR(OS_ACTIVATE_TASK_API_ID, E_OS_LIMIT);
+        return E_OS_LIMIT;
+    }
+    Os_Activations[TaskID]++;
+    Os_Core[task->core].ready_mask |= OS_PRIORITY_BIT(task->priority);
+    Os_Port_RestoreInterrupts(key);
+
+    Os_Schedule();
+
+    return E_OK;
+}
+
+/**
+ * @brief Arm an alarm relative to the current counter value
+ */
+StatusType SetRelAlarm(AlarmType AlarmID, TickType Increment, TickType Cycle)
+{
+    if ((Os_Cfg == NULL_PTR) || (AlarmID >= Os_Cfg->alarm_count))
+    {
+        OS_REPORT_ERROR(OS_SET_REL_ALARM_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    if (OS_ALARM_CORE(AlarmID) != Os_Port_GetCoreId())
+    {
+        OS_REPORT_ERROR(OS_SET_REL_ALARM_API_ID, E_OS_CORE);
+        return E_OS_CORE;
+    }
+
+    if ((Increment == 0U) || (Increment > TIMERMGR_MAX_DELAY) || (Cycle > TIMERMGR_MAX_DELAY))
+    {
+        OS_REPORT_ERROR(OS_SET_REL_ALARM_API_ID, E_OS_VALUE);
+        return E_OS_VALUE;
+    }
+
+    if (TimerMgr_IsActive(&Os_AlarmTimers[AlarmID]) == TRUE)
+    {
+        OS_REPORT_ERROR(OS_SET_REL_ALARM_API_ID, E_OS_STATE);
+        return E_OS_STATE;
+    }
+
+    (void)TimerMgr_Start(&Os_Core[OS_ALARM_CORE(AlarmID)].alarm_wheel, &Os_AlarmTimers[AlarmID],
+                         Increment, Cycle);
+
+    return E_OK;
+}
+
+/**
+ * @brief Cancel an alarm
+ */
+StatusType CancelAlarm(AlarmType AlarmID)
+{
+    if ((Os_Cfg == NULL_PTR) || (AlarmID >= Os_Cfg->alarm_count))
+    {
+        OS_REPORT_ERROR(OS_CANCEL_ALARM_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    if (OS_ALARM_CORE(AlarmID) != Os_Port_GetCoreId())
+    {
+        OS_REPORT_ERROR(OS_CANCEL_ALARM_API_ID, E_OS_CORE);
+        return E_OS_CORE;
+    }
+
+    if (TimerMgr_IsActive(&Os_AlarmTimers[AlarmID]) == FALSE)
+    {
+        return E_OS_NOFUNC;
+    }
+
+    TimerMgr_Stop(&Os_Core[OS_ALARM_CORE(AlarmID)].alarm_wheel, &Os_AlarmTimers[AlarmID]);
+
+    return E_OK;
+}
+
+/**
+ * @brief Ticks until an alarm expires
+ */
+StatusType GetAlarm(AlarmType AlarmID, P2VAR(TickType, AUTOMATIC, OS_APPL_DATA) Tick)
+{
+    if ((Os_Cfg == NULL_PTR) || (AlarmID >= Os_Cfg->alarm_count))
+    {
+        OS_REPORT_ERROR(OS_GET_ALARM_API_ID, E_OS_ID);
+        return E_OS_ID;
+    }
+
+    if (OS_ALARM_CORE(AlarmID) != Os_Port_GetCoreId())
+    {
+        OS_REPORT_ERROR(OS_GET_ALARM_API_ID, E_OS_CORE);
+        return E_OS_CORE;
+    }
+
+    if (Tick == NULL_PTR)
+    {
+        OS_REPORT_ERROR(OS_GET_ALARM_API_ID, OS_E_PARAM_POINTER);
+        return E_OS_VALUE;
+    }
+
+    if (TimerMgr_IsActive(&Os_AlarmTimers[AlarmID]) == FALSE)
+    {
+        return E_OS_NOFUNC;
+    }
+
+    *Tick = TimerMgr_GetRemaining(&Os_Core[OS_ALARM_CORE(AlarmID)].alarm_wheel, &Os_AlarmTimers[AlarmID]);
+
+    return E_OK;
+}
+
+/**
+ * @brief Counter tick
+ */
+void Os_Tick(void)
+{
+    P2VAR(TimerMgr_WheelType, AUTOMATIC, OS_VAR) wheel = &Os_Core[Os_Port_GetCoreId()].alarm_wheel;
+
+    if (TimerMgr_Tick(wheel) != 0U)
+    {
+        (void)TimerMgr_DispatchExpired(wheel);
+    }
+}
+
+/**
+ * @brief Advance the counter by several ticks
+ */
+void Os_AdvanceTicks(TickType Ticks)
+{
+    P2VAR(TimerMgr_WheelType, AUTOMATIC, OS_VAR) wheel = &Os_Core[Os_Port_GetCoreId()].alarm_wheel;
+
+    if (TimerMgr_Advance(wheel, Ticks) != 0U)
+    {
+        (void)TimerMgr_DispatchExpired(wheel);
+    }
+}
+
+/**
+ * @brief Ticks until the next alarm-related counter event
+ */
+TickType Os_GetTicksToNextAlarm(void)
+{
+    return TimerMgr_GetTicksToNextEvent(&Os_Core[Os_Port_GetCoreId()].alarm_wheel);
+}
+
+/**
+ * @brief Current OS counter value
+ */
+TickType Os_GetCounterValue(void)
+{
+    return TimerMgr_GetTime(&Os_Core[Os_Port_GetCoreId()].alarm_wheel);
+}
+
+/**
+ * @brief Run all ready tasks above the current priority
+ */
+void Os_Schedule(void)
+{
+    P2VAR(Os_CoreStateType, AUTOMATIC, OS_VAR) cs = &Os_Core[Os_Port_GetCoreId()];
+    Os_ResourceContextType preempted;
+    uint32 key;
+
+    if (cs->isr_nesting != 0U)
+    {
+        OS_PORT_REQUEST_DISPATCH();
+        return;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    while (cs->ready_mask != 0UL)
+    {
+        Os_PriorityType top = (Os_PriorityType)(31U - COUNT_LEADING_ZEROS(cs->ready_mask));
+        TaskType task;
+
+        /* Running task (or held ceiling) at or above the best ready task */
+        if (top <= Os_Resource_GetCurrentPriority())
+        {
+            break;
+        }
+
+        task = cs->priority_task[top];
+        Os_Activations[task]--;
+        if (Os_Activations[task] == 0U)
+        {
+            cs->ready_mask &= ~OS_PRIORITY_BIT(top);
+        }
+        Os_Port_RestoreInterrupts(key);
+
+        Os_Resource_EnterContext(task, top, &preempted);
+#if (OS_STACK_MONITORING == STD_ON)
+        StackMon_NotifyTaskEntry(task);
+#endif
+        Os_Cfg->tasks[task].entry();
+        (void)Os_Resource_LeaveContext(&preempted);
+
+        key = Os_Port_DisableInterrupts();
+    }
+    Os_Port_RestoreInterrupts(key);
+}
+
+/**
+ * @brief Category 2 ISR prologue
+ */
+void Os_EnterIsr(void)
+{
+    Os_Core[Os_Port_GetCoreId()].isr_nesting++;
+}
+
+/**
+ * @brief Category 2 ISR epilogue
+ */
+void Os_LeaveIsr(void)
+{
+    Os_Core[Os_Port_GetCoreId()].isr_nesting--;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,297 @@
+/**
+ * @file    scheduler.h
+ * @brief   OS Scheduler - Fixed-Priority Preemptive Basic Tasks and Alarms
+ * @version 1.1.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * OSEK BCC1/BCC2-style scheduler for the VCU task set:
+ *
+ * - Basic tasks with unique static priorities (1..OS_MAX_PRIORITIES-1),
+ *   run to completion on a single stack; preemption nests task bodies
+ * - O(1) ready queue: one bit per priority, highest found with CLZ
+ * - Multiple activation requests per task (max_activations)
+ * - Alarms on a hierarchical timing wheel (timer_manager.h) driven by the
+ *   OS counter; alarm expiry activates the configured task
+ * - Ceiling priorities from the resource manager are honoured by dispatch
+ *
+ * Dispatch from interrupt level is requested through the port layer
+ * (OS_PORT_REQUEST_DISPATCH: PendSV on Cortex-M, deferred call on the POSIX
+ * host port), so task bodies never run inside an ISR.
+ *
+ * Multi-core (OS_NUM_CORES > 1, split-lock S32K358/S32K356): every core runs
+ * its own scheduler instance (ready queue, ISR nesting, OS counter and alarm
+ * wheel). Tasks are statically partitioned to cores by configuration and
+ * task priorities only need to be unique per core. Alarms belong to the
+ * core of the task they activate. ActivateTask() for a task of another core
+ * is posted to a lock-free mailbox (lockstep_scheduler.h) and takes effect
+ * when the target core services its inter-core interrupt.
+ *
+ * The counter can be advanced tick by tick (Os_Tick) or in larger steps
+ * (Os_AdvanceTicks). Together with Os_GetTicksToNextAlarm() this lets the
+ * host port jump a virtual clock over idle time.
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Per-core instances, partitioning   |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_OS_SCH_001: Deterministic fixed-priority preemptive scheduling
+ * - SR_OS_SCH_002: Bounded dispatch latency (O(1) ready queue)
+ * - SR_OS_SCH_003: Activation overruns detected (E_OS_LIMIT)
+ * - SR_OS_SCH_004: Freedom from interference between core partitions
+ *
+ * @see scheduler.c
+ * @see resource_manager.h
+ * @see os_port.h
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "os_types.h"
+#include "resource_manager.h"
+#include "timer_manager.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define OS_INIT_API_ID                          0x00U
+#define OS_ACTIVATE_TASK_API_ID                 0x01U
+#define OS_SET_REL_ALARM_API_ID                 0x02U
+#define OS_CANCEL_ALARM_API_ID                  0x03U
+#define OS_GET_ALARM_API_ID                     0x04U
+#define OS_START_API_ID                         0x05U
+#define OS_GET_CORE_ID_API_ID                   0x06U
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def OS_MAX_TASKS
+ * @brief Maximum number of configured tasks
+ */
+#ifndef OS_MAX_TASKS
+    #define OS_MAX_TASKS                        31U
+#endif
+
+/**
+ * @def OS_MAX_ALARMS
+ * @brief Maximum number of configured alarms
+ */
+#ifndef OS_MAX_ALARMS
+    #define OS_MAX_ALARMS                       32U
+#endif
+
+/**
+ * @def OS_STACK_MONITORING
+ * @brief Record the stack depth at every task entry (stack_monitor.h)
+ */
+#ifndef OS_STACK_MONITORING
+    #define OS_STACK_MONITORING                 STD_OFF
+#endif
+
+/** @brief Number of task priority levels (0 is reserved for the idle context) */
+#define OS_MAX_PRIORITIES                       32U
+
+#if (OS_MAX_TASKS > (OS_MAX_PRIORITIES - 1U))
+    #error "OS_MAX_TASKS exceeds the number of unique task priorities"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Task identifier (index into the task configuration) */
+typedef uint8 TaskType;
+
+/** @brief Alarm identifier (index into the alarm configuration) */
+typedef uint8 AlarmType;
+
+/** @brief OS counter ticks */
+typedef TimerMgr_TickType TickType;
+
+/** @brief Task body */
+typedef void (*Os_TaskEntryType)(void);
+
+/**
+ * @struct Os_TaskConfigType
+ * @brief Static task configuration
+ */
+typedef struct
+{
+    Os_TaskEntryType entry;             /**< Task body */
+    Os_PriorityType  priority;          /**< Unique priority 1..OS_MAX_PRIORITIES-1 */
+    uint8            max_activations;   /**< Queued activation limit (>= 1) */
+    boolean          autostart;         /**< Activated by Os_Start() */
+    CoreIdType       core;              /**< Core the task is partitioned to */
+} Os_TaskConfigType;
+
+/**
+ * @struct Os_AlarmConfigType
+ * @brief Static alarm configuration (action: activate task)
+ */
+typedef struct
+{
+    TaskType         task;              /**< Task activated on expiry */
+    TickType         offset;            /**< Autostart: ticks to first expiry, 0 = no autostart */
+    TickType         cycle;             /**< Autostart: cycle in ticks, 0 = one-shot */
+} Os_AlarmConfigType;
+
+/**
+ * @struct Os_ConfigType
+ * @brief Complete OS configuration (generated, see task_config.c)
+ */
+typedef struct
+{
+    P2CONST(Os_TaskConfigType, TYPEDEF, OS_APPL_CONST)     tasks;
+    P2CONST(Os_AlarmConfigType, TYPEDEF, OS_APPL_CONST)    alarms;
+    P2CONST(Os_ResourceConfigType, TYPEDEF, OS_APPL_CONST) resources;
+    uint8                                                  task_count;
+    uint8                                                  alarm_count;
+    uint8                                                  resource_count;
+} Os_ConfigType;
+
+/* ===============================================================================================
+ *                                    GENERATED CONFIGURATION
+ * =============================================================================================== */
+
+/** @brief OS configuration of the application (task_config.c) */
+extern const Os_ConfigType Os_Config;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize scheduler, alarms and resources
+ * @details Called once by the master core before the other cores are
+ *          released from reset.
+ *
+ * @serviceID OS_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ */
+extern void Os_Init(P2CONST(Os_ConfigType, AUTOMATIC, OS_APPL_CONST) Config);
+
+/**
+ * @brief Activate autostart tasks/alarms and run the first dispatch
+ * @details Called on every core; starts the alarms and autostart tasks of
+ *          the calling core. Returns to the caller, which then acts as the
+ *          idle context of that core.
+ *
+ * @serviceID OS_START_API_ID (0x05)
+ */
+extern void Os_Start(void);
+
+/**
+ * @brief Activate a task (OSEK ActivateTask)
+ * @details Activation of a task of another core is asynchronous: E_OK means
+ *          the request was posted; an activation limit hit on the target core
+ *          is reported to DET there.
+ * @return E_OK, E_OS_ID for an invalid task, E_OS_LIMIT if the activation
+ *         limit is reached or the inter-core mailbox is full
+ *
+ * @serviceID OS_ACTIVATE_TASK_API_ID (0x01)
+ */
+extern StatusType ActivateTask(TaskType TaskID);
+
+/**
+ * @brief Arm an alarm relative to the current counter value
+ * @param[in] AlarmID   Alarm
+ * @param[in] Increment Ticks to first expiry (1..TIMERMGR_MAX_DELAY)
+ * @param[in] Cycle     Cycle in ticks, 0 = one-shot
+ * @return E_OK, E_OS_ID, E_OS_STATE if already armed, E_OS_VALUE,
+ *         E_OS_CORE if the alarm belongs to another core
+ *
+ * @serviceID OS_SET_REL_ALARM_API_ID (0x02)
+ */
+extern StatusType SetRelAlarm(AlarmType AlarmID, TickType Increment, TickType Cycle);
+
+/**
+ * @brief Cancel an alarm
+ * @return E_OK, E_OS_ID, E_OS_NOFUNC if not armed, E_OS_CORE
+ *
+ * @serviceID OS_CANCEL_ALARM_API_ID (0x03)
+ */
+extern StatusType CancelAlarm(AlarmType AlarmID);
+
+/**
+ * @brief Ticks until an alarm expires
+ * @return E_OK, E_OS_ID, E_OS_NOFUNC if not armed, E_OS_CORE
+ *
+ * @serviceID OS_GET_ALARM_API_ID (0x04)
+ */
+extern StatusType GetAlarm(AlarmType AlarmID, P2VAR(TickType, AUTOMATIC, OS_APPL_DATA) Tick);
+
+/**
+ * @brief Counter tick (called from the system tick ISR of each core)
+ */
+extern void Os_Tick(void);
+
+/**
+ * @brief Advance the counter by several ticks (tickless idle, virtual clock)
+ * @details Must not skip beyond Os_GetTicksToNextAlarm() if alarms shall
+ *          expire at their exact tick; expiries inside the span are
+ *          processed at the end of the span otherwise.
+ */
+extern void Os_AdvanceTicks(TickType Ticks);
+
+/**
+ * @brief Ticks until the next alarm-related counter event
+ */
+extern TickType Os_GetTicksToNextAlarm(void);
+
+/**
+ * @brief Current OS counter value
+ */
+extern TickType Os_GetCounterValue(void);
+
+/**
+ * @brief Run all ready tasks above the current priority (task level only)
+ */
+extern void Os_Schedule(void);
+
+/**
+ * @brief Logical number of the executing core (AUTOSAR GetCoreID)
+ *
+ * @serviceID OS_GET_CORE_ID_API_ID (0x06)
+ */
+extern CoreIdType GetCoreID(void);
+
+/**
+ * @brief Category 2 ISR prologue/epilogue
+ * @details Activations inside an ISR request a dispatch from the port
+ *          instead of running tasks in interrupt context.
+ */
+extern void Os_EnterIsr(void);
+extern void Os_LeaveIsr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,95 @@
+/**
+ * @file    task_config.c
+ * @brief   OS Configuration - VCU Task Set
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static configuration of the VCU task set (1 ms OS counter tick):
+ *
+ * | Task              | Core   | Priority | Activation          |
+ * |-------------------|--------|----------|---------------------|
+ * | Task_Init         | Safety | 31       | Autostart           |
+ * | Task_1ms          | Safety | 30       | Alarm, 1 ms         |
+ * | Task_Event        | Safety | 27       | RTE events          |
+ * | Task_5ms          | Safety | 25       | Alarm, 5 ms         |
+ * | Task_10ms         | Safety | 20       | Alarm, 10 ms        |
+ * | Task_100ms        | Safety | 10       | Alarm, 100 ms       |
+ * | Task_QmBackground | QM     | 5        | Task_100ms          |
+ *
+ * Ceilings: RES_VEHICLE_STATE is shared by the 10 ms and 100 ms tasks,
+ * RES_CAN_RX by the 5 ms task and the CAN RX ISR (NVIC priority 5). Hold
+ * budgets are 100 us and 20 us, in time-stamp ticks of the core clock.
+ *
+ * Task_Event runs the event-triggered runnables. The RTE activates it once
+ * per burst of events (rte_scheduler.c), so one activation is enough.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial configuration              |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Core partitions, QM task           |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | RTE event task                     |
+ * | 1.2.1   | 2026-10-16 | BSW Team        | Hold budgets from the core clock   |
+ *
+ * @see task_config.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "task_config.h"
+#include "os_port.h"
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+static const Os_TaskConfigType Os_TaskConfig[OS_TASK_COUNT] =
+{
+    /* entry,             priority, max_activations, autostart, core */
+    { &Task_Init,         31U,      1U,              TRUE,      OS_CORE_SAFETY },
+    { &Task_1ms,          30U,      1U,              FALSE,     OS_CORE_SAFETY },
+    { &Task_5ms,          25U,      1U,              FALSE,     OS_CORE_SAFETY },
+    { &Task_10ms,         20U,      1U,              FALSE,     OS_CORE_SAFETY },
+    { &Task_100ms,        10U,      1U,              FALSE,     OS_CORE_SAFETY },
+    { &Task_QmBackground, 5U,       2U,              FALSE,     OS_CORE_QM     },
+    { &Task_Event,        27U,      1U,              FALSE,     OS_CORE_SAFETY }
+};
+
+static const Os_AlarmConfigType Os_AlarmConfig[OS_ALARM_COUNT] =
+{
+    /* task,          offset, cycle */
+    { OS_TASK_1MS,    1U,     1U   },
+    { OS_TASK_5MS,    2U,     5U   },
+    { OS_TASK_10MS,   3U,     10U  },
+    { OS_TASK_100MS,  4U,     100U }
+};
+
+static const Os_ResourceConfigType Os_ResourceConfig[OS_RESOURCE_COUNT] =
+{
+    /* task_ceiling, isr_ceiling,        hold_budget (cycles),            core */
+    { 20U,           OS_RESOURCE_NO_ISR, 100UL * OS_PORT_TICKS_PER_US, OS_CORE_SAFETY },
+    { 25U,           5U,                 20UL * OS_PORT_TICKS_PER_US,  OS_CORE_SAFETY }
+};
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+const Os_ConfigType Os_Config =
+{
+    Os_TaskConfig,
+    Os_AlarmConfig,
+    Os_ResourceConfig,
+    OS_TASK_COUNT,
+    OS_ALARM_COUNT,
+    OS_RESOURCE_COUNT
+};
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,92 @@
+/**
+ * @file    task_config.h
+ * @brief   OS Configuration - VCU Task, Alarm and Resource Identifiers
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Symbolic identifiers of the configured OS objects (task_config.c) and the
+ * task bodies implemented by the application (src/app/task_definitions.c).
+ *
+ * Core partitions: ASIL-D tasks run on OS_CORE_SAFETY. QM tasks run on
+ * OS_CORE_QM, which is the second core on split-lock parts and the same
+ * core on lockstep parts, so one configuration serves both.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Core partitions, QM task           |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | RTE event task                     |
+ *
+ * @see task_config.c
+ */
+
+#ifndef TASK_CONFIG_H
+#define TASK_CONFIG_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "scheduler.h"
+
+/* ===============================================================================================
+ *                                    OBJECT IDENTIFIERS
+ * =============================================================================================== */
+
+/** @name Core partitions @{ */
+#define OS_CORE_SAFETY                          ((CoreIdType)0U)
+#if (OS_NUM_CORES > 1U)
+    #define OS_CORE_QM                          ((CoreIdType)1U)
+#else
+    #define OS_CORE_QM                          OS_CORE_SAFETY
+#endif
+/** @} */
+
+/** @name Tasks @{ */
+#define OS_TASK_INIT                            ((TaskType)0U)
+#define OS_TASK_1MS                             ((TaskType)1U)
+#define OS_TASK_5MS                             ((TaskType)2U)
+#define OS_TASK_10MS                            ((TaskType)3U)
+#define OS_TASK_100MS                           ((TaskType)4U)
+#define OS_TASK_QM_BACKGROUND                   ((TaskType)5U)
+#define OS_TASK_EVENT                           ((TaskType)6U)
+#define OS_TASK_COUNT                           7U
+/** @} */
+
+/** @name Alarms @{ */
+#define OS_ALARM_1MS                            ((AlarmType)0U)
+#define OS_ALARM_5MS                            ((AlarmType)1U)
+#define OS_ALARM_10MS                           ((AlarmType)2U)
+#define OS_ALARM_100MS                          ((AlarmType)3U)
+#define OS_ALARM_COUNT                          4U
+/** @} */
+
+/** @name Resources @{ */
+#define OS_RES_VEHICLE_STATE                    ((ResourceType)0U)  /**< Tasks only */
+#define OS_RES_CAN_RX                           ((ResourceType)1U)  /**< Shared with CAN RX ISR */
+#define OS_RESOURCE_COUNT                       2U
+/** @} */
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/** @name Task bodies (task_definitions.c) @{ */
+extern void Task_Init(void);
+extern void Task_1ms(void);
+extern void Task_5ms(void);
+extern void Task_10ms(void);
+extern void Task_100ms(void);
+extern void Task_QmBackground(void);
+extern void Task_Event(void);
+/** @} */
+
+#endif /* TASK_CONFIG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
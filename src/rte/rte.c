@@ -0,0 +1,406 @@
+/**
+ * @file    rte.c
+ * @brief   RTE - Lifecycle, Implicit and Explicit Communication Implementation
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the implicit communication declared in rte.h.
+ *
+ * Implementation Notes:
+ * - The copy plan is executed block by block; each block is a single
+ *   memcpy() so the library can use word and burst copies
+ * - The interrupt lock of RTE_COPY_LOCKED blocks is taken per block, never
+ *   across the whole plan, so higher-priority interrupts wait for at most
+ *   one block
+ * - Rte_Start() runs the fill blocks of all tasks. The local copy of a
+ *   writer needs no alignment: it is the only source of its group, and
+ *   both start from the same initial values
+ * - Sequence-lock update (latch): sequence odd -> rewrite copy 0 -> sequence
+ *   even -> rewrite copy 1. Readers are always directed to the copy that is
+ *   not being written, so a writer preempted mid-update (single core) or
+ *   running concurrently (other core) never forces a reader to wait. The
+ *   DMBs order the sequence stores against the data stores for readers on
+ *   the other core
+ * - The sequence skips 0 and 1 on wrap-around; they mark "never written"
+ * - Connection signals are accessed with their own width, so every access
+ *   is a single aligned load or store
+ * - Replay builds (RTE_RECORDER_REPLAY) skip the flush blocks of the input
+ *   channels while a replay runs; the recorder writes those groups instead
+ * - Rte_Task_Fill() re-arms the event activation of the task before the
+ *   copies, so events raised during the fill already activate it again
+ * - Rte_Start() resets the replication channels before any task of either
+ *   core can run, so the first batch of every channel carries all signals
+ * - Rte_Task_Fill() and Rte_Task_Flush() open and close the error batch of
+ *   the task; errors of the flush copies are still counted in it
+ * - The trace stamps of a task's inputs are taken before its fill copies
+ *   and those of its outputs published after its flush copies (RTE_TRACE)
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Sequence-lock ports                |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Connection table                   |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Module version 1.3.0 (rte_com.c)   |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Flush bypass during replay         |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Event task re-arm in the fill      |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Replication reset in Rte_Start()   |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Errors batched per task            |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Trace hooks in fill and flush      |
+ *
+ * @see rte.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_C_VENDOR_ID                         43U
+#define RTE_C_SW_MAJOR_VERSION                  1U
+#define RTE_C_SW_MINOR_VERSION                  8U
+#define RTE_C_SW_PATCH_VERSION                  0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte.c and rte_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+/** @brief First sequence value of a completed update */
+#define RTE_SEQLOCK_FIRST_VALID                 2UL
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC boolean Rte_Started = FALSE;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Rte_CopyBlocks(P2CONST(Rte_CopyBlockType, AUTOMATIC, RTE_CONST) Blocks, uint8 Count);
+#if (RTE_RECORDER_REPLAY == STD_ON)
+STATIC void Rte_FlushBlocks(P2CONST(Rte_CopyBlockType, AUTOMATIC, RTE_CONST) Blocks, uint8 Count);
+#endif
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Execute a list of copy blocks
+ */
+STATIC void Rte_CopyBlocks(P2CONST(Rte_CopyBlockType, AUTOMATIC, RTE_CONST) Blocks, uint8 Count)
+{
+    uint8 i;
+
+    for (i = 0U; i < Count; i++)
+    {
+        if ((Blocks[i].flags & RTE_COPY_LOCKED) != 0U)
+        {
+            uint32 key = Os_Port_DisableInterrupts();
+            (void)memcpy(Blocks[i].dst, Blocks[i].src, Blocks[i].size);
+            Os_Port_RestoreInterrupts(key);
+        }
+        else
+        {
+            (void)memcpy(Blocks[i].dst, Blocks[i].src, Blocks[i].size);
+        }
+    }
+}
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+/**
+ * @brief Execute flush blocks except those of the replayed inputs
+ */
+STATIC void Rte_FlushBlocks(P2CONST(Rte_CopyBlockType, AUTOMATIC, RTE_CONST) Blocks, uint8 Count)
+{
+    uint8 i;
+
+    for (i = 0U; i < Count; i++)
+    {
+        if (Rte_Recorder_IsReplayed(Blocks[i].dst) == FALSE)
+        {
+            Rte_CopyBlocks(&Blocks[i], 1U);
+        }
+    }
+}
+#endif
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Start the RTE: align all task-local copies with the global buffers
+ */
+Std_ReturnType Rte_Start(void)
+{
+    TaskType task;
+
+    for (task = 0U; task < OS_TASK_COUNT; task++)
+    {
+        Rte_CopyBlocks(Rte_CopyPlan[task].fill, Rte_CopyPlan[task].fill_count);
+    }
+    Rte_Lockstep_Init();
+
+    MEMORY_BARRIER();
+    Rte_Started = TRUE;
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Stop the RTE; subsequent fills and flushes are ignored
+ */
+Std_ReturnType Rte_Stop(void)
+{
+    Rte_Started = FALSE;
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Copy the inputs of a task into its task-local buffers
+ */
+void Rte_Task_Fill(TaskType TaskID)
+{
+    if (Rte_Started == FALSE)
+    {
+        RTE_REPORT_ERROR(RTE_TASK_FILL_API_ID, RTE_E_DET_UNINIT);
+        return;
+    }
+
+    if (TaskID >= OS_TASK_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_TASK_FILL_API_ID, RTE_E_DET_PARAM_ID);
+        return;
+    }
+
+    Rte_Error_StartTask(TaskID);
+    Rte_Event_StartTask(TaskID);
+#if (RTE_TRACE == STD_ON)
+    Rte_Trace_Fill(TaskID);
+#endif
+    Rte_CopyBlocks(Rte_CopyPlan[TaskID].fill, Rte_CopyPlan[TaskID].fill_count);
+}
+
+/**
+ * @brief Publish the outputs of a task from its task-local buffers
+ */
+void Rte_Task_Flush(TaskType TaskID)
+{
+    if (Rte_Started == FALSE)
+    {
+        RTE_REPORT_ERROR(RTE_TASK_FLUSH_API_ID, RTE_E_DET_UNINIT);
+        return;
+    }
+
+    if (TaskID >= OS_TASK_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_TASK_FLUSH_API_ID, RTE_E_DET_PARAM_ID);
+        return;
+    }
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+    Rte_FlushBlocks(Rte_CopyPlan[TaskID].flush, Rte_CopyPlan[TaskID].flush_count);
+#else
+    Rte_CopyBlocks(Rte_CopyPlan[TaskID].flush, Rte_CopyPlan[TaskID].flush_count);
+#endif
+#if (RTE_TRACE == STD_ON)
+    Rte_Trace_Flush(TaskID);
+#endif
+    Rte_Error_FlushTask(TaskID);
+}
+
+/**
+ * @brief Publish a new value on a sequence-lock port - never blocks
+ */
+Std_ReturnType Rte_Seqlock_Write(Rte_SeqlockPortIdType PortId,
+    P2CONST(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    P2CONST(Rte_SeqlockPortType, AUTOMATIC, RTE_CONST) port;
+    uint32 sequence;
+
+    if (PortId >= RTE_SEQLOCK_PORT_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_SEQLOCK_WRITE_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_SEQLOCK_WRITE_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    port = &Rte_SeqlockPort[PortId];
+    sequence = port->state->sequence + 2UL;
+    if (sequence < RTE_SEQLOCK_FIRST_VALID)
+    {
+        /* 32-bit wrap: skip to 4, so that the odd value published first (3) stays valid */
+        sequence = RTE_SEQLOCK_FIRST_VALID + 2UL;
+    }
+
+    port->state->sequence = sequence - 1UL;             /* Readers -> copy 1 */
+    MEMORY_BARRIER();
+    (void)memcpy(port->copy[0], Data, port->size);
+    MEMORY_BARRIER();
+    port->state->sequence = sequence;                   /* Readers -> copy 0 */
+    MEMORY_BARRIER();
+    (void)memcpy(port->copy[1], Data, port->size);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Read a consistent value from a sequence-lock port
+ */
+Std_ReturnType Rte_Seqlock_Read(Rte_SeqlockPortIdType PortId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    P2CONST(Rte_SeqlockPortType, AUTOMATIC, RTE_CONST) port;
+    uint8 attempt;
+
+    if (PortId >= RTE_SEQLOCK_PORT_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_SEQLOCK_READ_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_SEQLOCK_READ_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    port = &Rte_SeqlockPort[PortId];
+
+    for (attempt = 0U; attempt < RTE_SEQLOCK_MAX_RETRIES; attempt++)
+    {
+        uint32 sequence = port->state->sequence;
+
+        if (sequence < RTE_SEQLOCK_FIRST_VALID)
+        {
+            return RTE_E_NEVER_RECEIVED;
+        }
+
+        MEMORY_BARRIER();                                /* Data read after the sequence */
+        (void)memcpy(Data, port->copy[sequence & 1UL], port->size);
+        MEMORY_BARRIER();                                /* Data read before the re-check */
+
+        if (port->state->sequence == sequence)
+        {
+            return RTE_E_OK;
+        }
+    }
+
+    Rte_Error_Report(RTE_SEQLOCK_READ_API_ID, RTE_E_DET_SEQLOCK_RETRY);
+
+    return RTE_E_LIMIT;
+}
+
+/**
+ * @brief Write a scalar signal of the connection table
+ */
+Std_ReturnType Rte_Connection_Write(Rte_ConnectionIdType ConnectionId, uint32 Value)
+{
+    P2CONST(Rte_ConnectionType, AUTOMATIC, RTE_CONST) conn;
+
+    if (ConnectionId >= RTE_CONNECTION_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_CONNECTION_WRITE_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    conn = &Rte_Connection[ConnectionId];
+    switch (conn->size)
+    {
+        case 1U:
+            *(volatile uint8 *)conn->data = (uint8)Value;
+            break;
+        case 2U:
+            *(volatile uint16 *)conn->data = (uint16)Value;
+            break;
+        default:
+            *(volatile uint32 *)conn->data = Value;
+            break;
+    }
+    MEMORY_BARRIER();                                   /* Visible before later signals */
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Read a scalar signal of the connection table
+ */
+Std_ReturnType Rte_Connection_Read(Rte_ConnectionIdType ConnectionId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    P2CONST(Rte_ConnectionType, AUTOMATIC, RTE_CONST) conn;
+
+    if (ConnectionId >= RTE_CONNECTION_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_CONNECTION_READ_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_CONNECTION_READ_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    conn = &Rte_Connection[ConnectionId];
+    MEMORY_BARRIER();                                   /* Ordered after earlier signals */
+    switch (conn->size)
+    {
+        case 1U:
+            *(uint8 *)Data = *(volatile const uint8 *)conn->data;
+            break;
+        case 2U:
+            *(uint16 *)Data = *(volatile const uint16 *)conn->data;
+            break;
+        default:
+            *(uint32 *)Data = *(volatile const uint32 *)conn->data;
+            break;
+    }
+
+    return RTE_E_OK;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
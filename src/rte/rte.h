@@ -0,0 +1,655 @@
+/**
+ * @file    rte.h
+ * @brief   RTE - Lifecycle, Implicit and Explicit Communication API
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implicit sender/receiver communication (AUTOSAR Rte_IRead/Rte_IWrite
+ * semantics):
+ *
+ * - Runnables access task-local copies of their data elements through the
+ *   generated Rte_IRead_* / Rte_IWrite_* macros (rte_cfg.h). An access is a
+ *   plain load or store: no lock, no function call
+ * - Rte_Task_Fill() refreshes the task-local copies from the global buffers
+ *   once at task start; Rte_Task_Flush() publishes the task's writes once
+ *   at task end. Both execute the task's entry of the generated copy plan,
+ *   one memcpy() per contiguous block
+ * - All runnables of a task activation therefore see one consistent
+ *   snapshot, and other tasks see the writes of an activation only after it
+ *   has completed
+ *
+ * A block is copied with interrupts disabled only if a conflicting copy of
+ * a higher-priority task could preempt it (RTE_COPY_LOCKED, see
+ * rte_types.h). The lock covers one block copy, so its duration is bounded
+ * by the largest locked block instead of growing with the number of
+ * accesses.
+ *
+ * Sequence-lock ports (Rte_Seqlock_Write() / Rte_Seqlock_Read()) carry
+ * large structures from one writer to many readers, also across cores,
+ * without any lock:
+ * - The writer never blocks or retries. It keeps two copies and always
+ *   rewrites the one readers are currently not directed to (latched
+ *   sequence counter, see Rte_SeqlockStateType)
+ * - A reader copies the current copy and retries only if an update was
+ *   started meanwhile, i.e. at most once per writer period in practice.
+ *   Readers that preempt the writer read the other, stable copy and never
+ *   retry, so priority order does not matter on a single core
+ * - Cost: twice the data size of RAM and two copies per update
+ *
+ * Explicit scalar signals (<= 32 bit) are plain variables: the generated
+ * Rte_Write_* / Rte_Read_* macros store and load them directly when writer
+ * and reader share a core. Readers on another core, and the writer of such
+ * a signal, go through the connection table (Rte_Connection_Write() /
+ * Rte_Connection_Read()), which adds the barriers for the shared memory.
+ *
+ * Queued data elements (events such as driver inputs and diagnostic
+ * requests) are carried by fixed-size ring buffers, one per receiver port
+ * (rte_com.c). Nothing is overwritten: a full queue rejects the new element,
+ * counts it and flags RTE_E_LOST_DATA on the receiver's next call.
+ * Rte_Queue_ReceiveN() hands out up to N elements with at most two copies,
+ * so draining a queue costs one call per activation instead of one per
+ * element. Queues with senders in more than one task are multi-producer
+ * (compare-and-swap reservation, Os_Port_CompareAndSwap()); all others use
+ * the cheaper single-producer protocol. Neither side ever takes a lock.
+ *
+ * The recorder (rte_recorder.c) snapshots the configured signal groups
+ * once per cycle of the recording task into a RAM ring buffer, delta and
+ * run-length encoded. A fault freezes the buffer after a number of
+ * post-trigger frames (Rte_Recorder_Freeze(), called by the fault reaction);
+ * the frozen buffer survives a warm reset and is read out with
+ * Rte_Recorder_Export(). Host builds (RTE_RECORDER_REPLAY) feed a recording
+ * back: the recorded inputs replace the flushes of their writers, and the
+ * recorded outputs are compared with the ones the software produces.
+ *
+ * Event-triggered runnables (DATA-RECEIVED-EVENT, DATA-RECEIVE-ERROR-EVENT,
+ * rte_scheduler.c) run in event tasks, which are activated by the RTE
+ * instead of an alarm. An event only sets its bit in the runnable's
+ * pending set; the task is activated for the first event after it has
+ * started, so a burst of elements arriving before the task runs costs one
+ * activation. The task body takes each runnable's pending set
+ * (Rte_Event_Take()) and calls the runnable with it; the runnable then
+ * drains its queue with Rte_Queue_ReceiveN(). Queues raise their events
+ * themselves; BSW notifications (e.g. COM reception callbacks) call
+ * Rte_Event_Raise().
+ *
+ * Replicated signals (ECUC RteReplication, rte_lockstep.h) are read on the
+ * other core from a local replica instead of the shared memory. The writer
+ * core marks written signals dirty and sends all of them once per cycle as
+ * one batch protected by one CRC (Rte_Lockstep_Transmit()); the reader core
+ * checks and unpacks the batch (Rte_Lockstep_Receive()). On lockstep parts,
+ * where both partitions share a core, the batch degenerates to a direct
+ * copy into the replicas.
+ *
+ * Runtime errors of the RTE go through one error path (rte_error.c):
+ * Rte_Error_Report() looks the error up in the generated routing table,
+ * indexed by the error code, which names the DET and DEM reports of the
+ * error. Errors of a task are only counted while the task runs and routed
+ * once per error at its end (Rte_Task_Flush()), so a burst of the same
+ * error within one activation costs one DET and one DEM report.
+ *
+ * The data-flow tracer (ECUC RteTimingChain, rte_trace.h) time-stamps the
+ * signal groups of configured cause-effect chains in Rte_Task_Fill() and
+ * Rte_Task_Flush() and keeps the latency of every hop and the end-to-end
+ * age of every chain as minimum, maximum and histogram.
+ *
+ * The configuration (rte_cfg.h / rte_cfg.c) is generated from the ARXML
+ * system description by tools/rte/rte_generator.py.
+ *
+ * Task body pattern:
+ * @code
+ * void Task_10ms(void)
+ * {
+ *     Rte_Task_Fill(OS_TASK_10MS);
+ *     VehicleState_Run10ms();
+ *     TorqueArb_Run10ms();
+ *     Rte_Task_Flush(OS_TASK_10MS);
+ * }
+ *
+ * void Task_Event(void)
+ * {
+ *     uint32 events;
+ *
+ *     Rte_Task_Fill(OS_TASK_EVENT);
+ *     events = Rte_Events_DiagnosticManager_OnFaultEvent();
+ *     if (events != 0UL)
+ *     {
+ *         DiagnosticManager_OnFaultEvent(events);
+ *     }
+ *     Rte_Task_Flush(OS_TASK_EVENT);
+ * }
+ * @endcode
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Sequence-lock ports                |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Connection table, generated config |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Queued communication               |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Recorder and replay                |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Event-triggered runnables          |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Batched cross-core replication     |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Error routing to DET and DEM       |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Data-flow timing tracer            |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_RTE_001: Data consistency of implicit communication within a task activation
+ * - SR_RTE_002: Bounded interrupt lock time of the RTE
+ * - SR_RTE_003: Consistent multi-reader access to structured signals across cores
+ * - SR_RTE_004: No silent loss of queued events
+ * - SR_RTE_005: Post-mortem record of the signal history before a fault
+ * - SR_RTE_006: Corrupted cross-core safety data is detected and never used
+ * - SR_RTE_007: Measured end-to-end age of the cause-effect chains
+ *
+ * @see rte.c
+ * @see rte_com.c
+ * @see rte_recorder.c
+ * @see rte_scheduler.c
+ * @see rte_lockstep.h
+ * @see rte_error.c
+ * @see rte_trace.h
+ * @see rte_cfg.h
+ */
+
+#ifndef RTE_H
+#define RTE_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "rte_types.h"
+#include "rte_cfg.h"
+#include "rte_lockstep.h"
+#include "rte_trace.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define RTE_START_API_ID                        0x70U
+#define RTE_STOP_API_ID                         0x71U
+#define RTE_TASK_FILL_API_ID                    0x72U
+#define RTE_TASK_FLUSH_API_ID                   0x73U
+#define RTE_SEQLOCK_WRITE_API_ID                0x74U
+#define RTE_SEQLOCK_READ_API_ID                 0x75U
+#define RTE_CONNECTION_WRITE_API_ID             0x76U
+#define RTE_CONNECTION_READ_API_ID              0x77U
+#define RTE_QUEUE_SEND_API_ID                   0x78U
+#define RTE_QUEUE_RECEIVE_API_ID                0x79U
+#define RTE_QUEUE_RECEIVE_N_API_ID              0x7AU
+#define RTE_QUEUE_GET_STATUS_API_ID             0x7BU
+#define RTE_RECORDER_INIT_API_ID                0x7CU
+#define RTE_RECORDER_CYCLE_API_ID               0x7DU
+#define RTE_RECORDER_FREEZE_API_ID              0x7EU
+#define RTE_RECORDER_RELEASE_API_ID             0x7FU
+#define RTE_RECORDER_GET_EXPORT_SIZE_API_ID     0x80U
+#define RTE_RECORDER_EXPORT_API_ID              0x81U
+#define RTE_RECORDER_GET_STATUS_API_ID          0x82U
+#define RTE_RECORDER_START_REPLAY_API_ID        0x83U
+#define RTE_EVENT_RAISE_API_ID                  0x84U
+#define RTE_EVENT_TAKE_API_ID                   0x85U
+#define RTE_LOCKSTEP_TRANSMIT_API_ID            0x86U
+#define RTE_LOCKSTEP_RECEIVE_API_ID             0x87U
+#define RTE_LOCKSTEP_UPDATE_API_ID              0x88U
+#define RTE_LOCKSTEP_READ_API_ID                0x89U
+#define RTE_LOCKSTEP_GET_STATUS_API_ID          0x8AU
+#define RTE_LOCKSTEP_DMA_COMPLETE_API_ID        0x8BU
+#define RTE_ERROR_REPORT_API_ID                 0x8CU
+#define RTE_ERROR_GET_COUNT_API_ID              0x8DU
+#define RTE_TRACE_GET_HOP_STATUS_API_ID         0x8EU
+#define RTE_TRACE_GET_CHAIN_STATUS_API_ID       0x8FU
+#define RTE_TRACE_RESET_API_ID                  0x90U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define RTE_E_DET_PARAM_POINTER                 0x01U   /**< NULL pointer parameter */
+#define RTE_E_DET_UNINIT                        0x02U   /**< RTE not started */
+#define RTE_E_DET_PARAM_ID                      0x03U   /**< Task, port, connection or queue ID out of range */
+
+/** @brief Runtime errors (Rte_Error_Report(), routed by Rte_ErrorRoute) */
+#define RTE_E_DET_RUNTIME_FIRST                 0x10U
+#define RTE_E_DET_SEQLOCK_RETRY                 0x10U   /**< Read retries exhausted */
+#define RTE_E_DET_RECORDER_BUDGET               0x11U   /**< Recorder cycle exceeded RTE_RECORDER_BUDGET_TICKS */
+#define RTE_E_DET_EVENT_ACTIVATION              0x12U   /**< ActivateTask() of an event task failed */
+#define RTE_E_DET_REPLICA_CRC                   0x13U   /**< Replication batch failed its CRC check */
+#define RTE_E_DET_QUEUE_OVERFLOW                0x14U   /**< Queue full, element discarded */
+#define RTE_E_DET_RUNTIME_LAST                  0x14U
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def RTE_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef RTE_DEV_ERROR_DETECT
+    #define RTE_DEV_ERROR_DETECT                STD_ON
+#endif
+
+/**
+ * @def RTE_SEQLOCK_MAX_RETRIES
+ * @brief Read attempts of Rte_Seqlock_Read() before it gives up with RTE_E_LIMIT
+ */
+#ifndef RTE_SEQLOCK_MAX_RETRIES
+    #define RTE_SEQLOCK_MAX_RETRIES             4U
+#endif
+
+/**
+ * @def RTE_SHARED_SECTION
+ * @brief Linker section of data shared by all cores (non-cacheable):
+ *        sequence-lock ports, connection signals and cross-core queues
+ */
+#ifndef RTE_SHARED_SECTION
+    #define RTE_SHARED_SECTION                  ".os_shared_noncacheable"
+#endif
+
+/**
+ * @def RTE_ERROR_DEM_REPORT
+ * @brief Optional integrator callout reporting a routed error to the DEM
+ * @details Signature: void Callout(uint16 EventId, uint16 Count). Called once
+ *          per error and task activation with the occurrences counted in
+ *          it; typically mapped to Dem_SetEventStatus(EventId,
+ *          DEM_EVENT_STATUS_FAILED). Without the callout DEM routes are
+ *          only counted.
+ */
+
+/**
+ * @def RTE_RECORDER_BUFFER_SIZE
+ * @brief Recorder ring buffer in bytes (power of two)
+ */
+#ifndef RTE_RECORDER_BUFFER_SIZE
+    #define RTE_RECORDER_BUFFER_SIZE            16384UL
+#endif
+
+/**
+ * @def RTE_RECORDER_KEYFRAME_INTERVAL
+ * @brief Frames between two full images; an export starts at a full image
+ */
+#ifndef RTE_RECORDER_KEYFRAME_INTERVAL
+    #define RTE_RECORDER_KEYFRAME_INTERVAL      256UL
+#endif
+
+/**
+ * @def RTE_RECORDER_KEYFRAME_SLOTS
+ * @brief Full images remembered as export start points (power of two).
+ *        Bounds the exported history to SLOTS * INTERVAL frames
+ */
+#ifndef RTE_RECORDER_KEYFRAME_SLOTS
+    #define RTE_RECORDER_KEYFRAME_SLOTS         64UL
+#endif
+
+/**
+ * @def RTE_RECORDER_POST_TRIGGER_FRAMES
+ * @brief Frames still recorded after Rte_Recorder_Freeze()
+ */
+#ifndef RTE_RECORDER_POST_TRIGGER_FRAMES
+    #define RTE_RECORDER_POST_TRIGGER_FRAMES    100UL
+#endif
+
+/**
+ * @def RTE_RECORDER_BUDGET_TICKS
+ * @brief Longest acceptable Rte_Recorder_Cycle() in Os_Port_GetTimestamp()
+ *        ticks: 2 % of a 1 ms cycle
+ */
+#ifndef RTE_RECORDER_BUDGET_TICKS
+    #define RTE_RECORDER_BUDGET_TICKS           (20UL * OS_PORT_TICKS_PER_US)
+#endif
+
+/**
+ * @def RTE_RECORDER_SECTION
+ * @brief Linker section of the recorder (not cleared at reset)
+ */
+#ifndef RTE_RECORDER_SECTION
+    #define RTE_RECORDER_SECTION                ".rte_recorder_noinit"
+#endif
+
+/**
+ * @def RTE_RECORDER_REPLAY
+ * @brief Replay support (host builds only)
+ */
+#ifndef RTE_RECORDER_REPLAY
+    #define RTE_RECORDER_REPLAY                 STD_OFF
+#endif
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Start the RTE: align all task-local copies with the global buffers
+ * @return RTE_E_OK
+ *
+ * @serviceID RTE_START_API_ID (0x70)
+ * @reentrancy Non-Reentrant
+ * @note Called from the init task before any other task can run
+ */
+extern Std_ReturnType Rte_Start(void);
+
+/**
+ * @brief Stop the RTE; subsequent fills and flushes are ignored
+ * @return RTE_E_OK
+ *
+ * @serviceID RTE_STOP_API_ID (0x71)
+ */
+extern Std_ReturnType Rte_Stop(void);
+
+/**
+ * @brief Copy the inputs of a task into its task-local buffers
+ * @param[in] TaskID Calling task
+ *
+ * Also re-arms the activation of an event task: events raised from here
+ * on activate the task again.
+ *
+ * @serviceID RTE_TASK_FILL_API_ID (0x72)
+ * @note First statement of the task body
+ */
+extern void Rte_Task_Fill(TaskType TaskID);
+
+/**
+ * @brief Publish the outputs of a task from its task-local buffers
+ * @param[in] TaskID Calling task
+ *
+ * @serviceID RTE_TASK_FLUSH_API_ID (0x73)
+ * @note Last statement of the task body
+ */
+extern void Rte_Task_Flush(TaskType TaskID);
+
+/**
+ * @brief Publish a new value on a sequence-lock port - never blocks
+ * @param[in] PortId Port to write
+ * @param[in] Data   New value (size of the port)
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_SEQLOCK_WRITE_API_ID (0x74)
+ * @reentrancy Non-Reentrant per port (single writer)
+ */
+extern Std_ReturnType Rte_Seqlock_Write(Rte_SeqlockPortIdType PortId,
+    P2CONST(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Read a consistent value from a sequence-lock port
+ * @param[in]  PortId Port to read
+ * @param[out] Data   Receives the value (size of the port)
+ * @return RTE_E_OK; RTE_E_NEVER_RECEIVED before the first update completed;
+ *         RTE_E_LIMIT if RTE_SEQLOCK_MAX_RETRIES attempts were torn (Data
+ *         is then undefined); RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_SEQLOCK_READ_API_ID (0x75)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Seqlock_Read(Rte_SeqlockPortIdType PortId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Write a scalar signal of the connection table
+ * @param[in] ConnectionId Connection to write
+ * @param[in] Value        New value, truncated to the signal size
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_CONNECTION_WRITE_API_ID (0x76)
+ */
+extern Std_ReturnType Rte_Connection_Write(Rte_ConnectionIdType ConnectionId, uint32 Value);
+
+/**
+ * @brief Read a scalar signal of the connection table
+ * @param[in]  ConnectionId Connection to read
+ * @param[out] Data         Receives the value (signal size)
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_CONNECTION_READ_API_ID (0x77)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Connection_Read(Rte_ConnectionIdType ConnectionId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Append one element to a queue - never blocks
+ * @param[in] QueueId Queue to write
+ * @param[in] Data    Element (element size of the queue)
+ * @return RTE_E_OK; RTE_E_LIMIT if the queue was full (element discarded
+ *         and counted); RTE_E_INVALID on invalid parameters
+ *
+ * Raises the receiver's data received event, or its receive error event
+ * if the element was discarded.
+ *
+ * @serviceID RTE_QUEUE_SEND_API_ID (0x78)
+ * @reentrancy Reentrant for multi-producer queues, else single task only
+ */
+extern Std_ReturnType Rte_Queue_Send(Rte_QueueIdType QueueId,
+    P2CONST(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Take the oldest element from a queue
+ * @param[in]  QueueId Queue to read
+ * @param[out] Data    Receives the element
+ * @return RTE_E_OK or RTE_E_NO_DATA, with RTE_E_LOST_DATA added if elements
+ *         were discarded since the previous receive; RTE_E_INVALID on
+ *         invalid parameters
+ *
+ * @serviceID RTE_QUEUE_RECEIVE_API_ID (0x79)
+ * @reentrancy Non-Reentrant per queue (single consumer)
+ */
+extern Std_ReturnType Rte_Queue_Receive(Rte_QueueIdType QueueId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Take up to MaxCount elements from a queue in one call
+ * @param[in]  QueueId  Queue to read
+ * @param[out] Data     Array of at least MaxCount elements, oldest first
+ * @param[in]  MaxCount Capacity of Data in elements
+ * @param[out] Count    Number of elements written to Data
+ * @return As Rte_Queue_Receive(); RTE_E_OK if at least one element was
+ *         returned
+ *
+ * @serviceID RTE_QUEUE_RECEIVE_N_API_ID (0x7A)
+ * @reentrancy Non-Reentrant per queue (single consumer)
+ */
+extern Std_ReturnType Rte_Queue_ReceiveN(Rte_QueueIdType QueueId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data, uint16 MaxCount,
+    P2VAR(uint16, AUTOMATIC, RTE_APPL_DATA) Count);
+
+/**
+ * @brief Read the fill level and overflow counter of a queue
+ * @param[in]  QueueId Queue to inspect
+ * @param[out] Status  Receives the counters
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_QUEUE_GET_STATUS_API_ID (0x7B)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Queue_GetStatus(Rte_QueueIdType QueueId,
+    P2VAR(Rte_QueueStatusType, AUTOMATIC, RTE_APPL_DATA) Status);
+
+/**
+ * @brief Start recording; keeps a frozen recording from before a reset
+ *
+ * @serviceID RTE_RECORDER_INIT_API_ID (0x7C)
+ * @reentrancy Non-Reentrant
+ * @note Called from the init task after Rte_Start()
+ */
+extern void Rte_Recorder_Init(void);
+
+/**
+ * @brief Record one frame of the configured channels (replay: inject one)
+ *
+ * @serviceID RTE_RECORDER_CYCLE_API_ID (0x7D)
+ * @reentrancy Non-Reentrant
+ * @note First statement of the recording task (RTE_RECORDER_TASK), before
+ *       Rte_Task_Fill()
+ */
+extern void Rte_Recorder_Cycle(void);
+
+/**
+ * @brief Freeze the recording after RTE_RECORDER_POST_TRIGGER_FRAMES frames
+ * @param[in] FaultId Fault stored with the recording
+ *
+ * Only the first request of a recording is taken; later ones are ignored.
+ *
+ * @serviceID RTE_RECORDER_FREEZE_API_ID (0x7E)
+ * @reentrancy Reentrant
+ */
+extern void Rte_Recorder_Freeze(uint16 FaultId);
+
+/**
+ * @brief Discard a frozen recording and record again
+ *
+ * @serviceID RTE_RECORDER_RELEASE_API_ID (0x7F)
+ */
+extern void Rte_Recorder_Release(void);
+
+/**
+ * @brief Size of the export image of a frozen recording
+ * @param[out] Size Export header plus encoded frames, in bytes
+ * @return RTE_E_OK; RTE_E_NO_DATA if the recording is not frozen;
+ *         RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_RECORDER_GET_EXPORT_SIZE_API_ID (0x80)
+ */
+extern Std_ReturnType Rte_Recorder_GetExportSize(P2VAR(uint32, AUTOMATIC, RTE_APPL_DATA) Size);
+
+/**
+ * @brief Copy a part of the export image of a frozen recording
+ * @param[in]  Offset Byte offset in the export image
+ * @param[out] Buffer Receives Length bytes
+ * @param[in]  Length Bytes to copy; Offset + Length <= export size
+ * @return RTE_E_OK; RTE_E_NO_DATA if the recording is not frozen;
+ *         RTE_E_INVALID on invalid parameters
+ *
+ * The export image is the header (little endian: magic "RTER", format
+ * version, channel count, image size, layout ID, first frame, trigger
+ * frame, fault ID) followed by the encoded frames from the oldest full
+ * image on. It is the input of Rte_Recorder_StartReplay() and of
+ * tools/rte/rte_recorder.py.
+ *
+ * @serviceID RTE_RECORDER_EXPORT_API_ID (0x81)
+ * @note Read out piecewise by the diagnostic or debug interface
+ */
+extern Std_ReturnType Rte_Recorder_Export(uint32 Offset,
+    P2VAR(uint8, AUTOMATIC, RTE_APPL_DATA) Buffer, uint32 Length);
+
+/**
+ * @brief Read the recorder state and counters
+ * @param[out] Status Receives the counters
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_RECORDER_GET_STATUS_API_ID (0x82)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Recorder_GetStatus(P2VAR(Rte_RecorderStatusType, AUTOMATIC, RTE_APPL_DATA) Status);
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+/**
+ * @brief Replay an export image from the next Rte_Recorder_Cycle() on
+ * @param[in] Data Export image; must stay valid until the replay is done
+ * @param[in] Size Size of Data in bytes
+ * @return RTE_E_OK; RTE_E_INVALID if Data is not an export image of the
+ *         current channel layout
+ *
+ * @serviceID RTE_RECORDER_START_REPLAY_API_ID (0x83)
+ */
+extern Std_ReturnType Rte_Recorder_StartReplay(P2CONST(uint8, AUTOMATIC, RTE_APPL_DATA) Data, uint32 Size);
+
+/**
+ * @brief Whether a global buffer is an input injected by the replay
+ * @param[in] Address Destination of a flush block
+ * @return TRUE while replaying and Address lies in an input channel
+ * @note RTE internal: flushes skip blocks written by the replay
+ */
+extern boolean Rte_Recorder_IsReplayed(P2CONST(void, AUTOMATIC, RTE_VAR) Address);
+#endif
+
+/**
+ * @brief Raise an event: mark it pending and activate the runnable's task
+ * @param[in] EventId Event to raise
+ *
+ * The task is activated only if no activation is outstanding since it last
+ * started; otherwise the event is merged into the pending set.
+ *
+ * @serviceID RTE_EVENT_RAISE_API_ID (0x84)
+ * @reentrancy Reentrant (any core, task and interrupt level)
+ */
+extern void Rte_Event_Raise(Rte_EventIdType EventId);
+
+/**
+ * @brief Take the events raised for a runnable since its last take
+ * @param[in] RunnableId Event-triggered runnable
+ * @return Pending-event set (RTE_MASK_* bits), 0 if no event is pending
+ *
+ * @serviceID RTE_EVENT_TAKE_API_ID (0x85)
+ * @reentrancy Non-Reentrant per runnable (its event task)
+ */
+extern uint32 Rte_Event_Take(Rte_RunnableIdType RunnableId);
+
+/**
+ * @brief Re-arm the activation of a task by its events
+ * @param[in] TaskID Task starting its activation
+ * @note RTE internal: called by Rte_Task_Fill()
+ */
+extern void Rte_Event_StartTask(TaskType TaskID);
+
+/**
+ * @brief Report a runtime error of the RTE
+ * @param[in] ApiId   Service that detected the error
+ * @param[in] ErrorId RTE_E_DET_* runtime error
+ *
+ * Counted in the running task and routed at its end; routed at once if
+ * no task of the calling core is between Rte_Task_Fill() and
+ * Rte_Task_Flush().
+ *
+ * @serviceID RTE_ERROR_REPORT_API_ID (0x8C)
+ * @reentrancy Reentrant (any core, task and interrupt level)
+ * @note RTE internal: called by the RTE services instead of Det_ReportRuntimeError()
+ */
+extern void Rte_Error_Report(uint8 ApiId, uint8 ErrorId);
+
+/**
+ * @brief Number of routed occurrences of a runtime error since start
+ * @param[in]  ErrorId RTE_E_DET_* runtime error
+ * @param[out] Count   Receives the occurrences (saturating)
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_ERROR_GET_COUNT_API_ID (0x8D)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Error_GetCount(uint8 ErrorId, P2VAR(uint32, AUTOMATIC, RTE_APPL_DATA) Count);
+
+/**
+ * @brief Make a task the target of the errors reported on its core
+ * @param[in] TaskID Task starting its activation
+ * @note RTE internal: called by Rte_Task_Fill()
+ */
+extern void Rte_Error_StartTask(TaskType TaskID);
+
+/**
+ * @brief Route the errors counted in a task activation
+ * @param[in] TaskID Task ending its activation
+ * @note RTE internal: called by Rte_Task_Flush()
+ */
+extern void Rte_Error_FlushTask(TaskType TaskID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTE_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
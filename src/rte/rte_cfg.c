@@ -0,0 +1,319 @@
+/**
+ * @file    rte_cfg.c
+ * @brief   RTE Configuration - Buffers, Copy Plan, Ports and Connections
+ * @version 1.7.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Buffers and tables declared in rte_cfg.h. The STATIC_ASSERTs pin the
+ * type layouts the copy plan and the port sizes were computed from.
+ *
+ * @note Generated by tools/rte/rte_generator.py from config/autosar/system/rte.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "rte.h"
+
+/*==================================================================================================
+*                                          LAYOUT CHECKS
+==================================================================================================*/
+
+STATIC_ASSERT(sizeof(Rte_VehicleStateVectorType) == 60U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, Timestamp) == 0U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, LongitudinalAccel) == 4U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, LateralAccel) == 8U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, YawRate) == 12U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, RoadGradient) == 16U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, VehicleMass) == 20U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, VehicleSpeed) == 24U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, WheelSpeed) == 26U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, WheelSlip) == 34U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, MotorSpeed) == 42U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, MotorTorqueActual) == 44U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, HvVoltage) == 46U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, HvCurrent) == 48U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, StateOfCharge) == 50U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, AmbientTemperature) == 52U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, DriveMode) == 54U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, GearActual) == 55U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, EstimatorQuality) == 56U, "VehicleStateVectorType layout");
+STATIC_ASSERT(OFFSETOF(Rte_VehicleStateVectorType, StatusFlags) == 57U, "VehicleStateVectorType layout");
+STATIC_ASSERT(sizeof(Rte_DiagRequestType) == 4U, "DiagRequestType layout");
+STATIC_ASSERT(OFFSETOF(Rte_DiagRequestType, Did) == 0U, "DiagRequestType layout");
+STATIC_ASSERT(OFFSETOF(Rte_DiagRequestType, Sid) == 2U, "DiagRequestType layout");
+STATIC_ASSERT(OFFSETOF(Rte_DiagRequestType, Source) == 3U, "DiagRequestType layout");
+STATIC_ASSERT(sizeof(Rte_FaultEventType) == 8U, "FaultEventType layout");
+STATIC_ASSERT(OFFSETOF(Rte_FaultEventType, Timestamp) == 0U, "FaultEventType layout");
+STATIC_ASSERT(OFFSETOF(Rte_FaultEventType, EventId) == 4U, "FaultEventType layout");
+STATIC_ASSERT(OFFSETOF(Rte_FaultEventType, Status) == 6U, "FaultEventType layout");
+STATIC_ASSERT(OFFSETOF(Rte_FaultEventType, Source) == 7U, "FaultEventType layout");
+STATIC_ASSERT(sizeof(Rte_GrpBrakeType) == 4U, "Brake layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpBrakeType, RegenTorque) == 0U, "Brake layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpBrakeType, FrictionTorque) == 2U, "Brake layout");
+STATIC_ASSERT(sizeof(Rte_GrpPowerType) == 4U, "Power layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpPowerType, PowerMode) == 0U, "Power layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpPowerType, DerateActive) == 1U, "Power layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpPowerType, LvVoltage) == 2U, "Power layout");
+STATIC_ASSERT(sizeof(Rte_GrpTorqueType) == 4U, "Torque layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpTorqueType, Request) == 0U, "Torque layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpTorqueType, Limit) == 2U, "Torque layout");
+STATIC_ASSERT(sizeof(Rte_GrpDriverInputType) == 14U, "DriverInput layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpDriverInputType, BrakePedal) == 0U, "DriverInput layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpDriverInputType, AccelPedal) == 2U, "DriverInput layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpDriverInputType, WheelSpeed) == 4U, "DriverInput layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpDriverInputType, GearSelector) == 12U, "DriverInput layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpDriverInputType, IgnitionState) == 13U, "DriverInput layout");
+STATIC_ASSERT(sizeof(Rte_GrpStateType) == 4U, "State layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpStateType, VehicleSpeed) == 0U, "State layout");
+STATIC_ASSERT(OFFSETOF(Rte_GrpStateType, DriveMode) == 2U, "State layout");
+STATIC_ASSERT(sizeof(Rte_GlobalBuffersType) == 30U, "Rte_Global layout");
+STATIC_ASSERT(OFFSETOF(Rte_GlobalBuffersType, Brake) == 0U, "Rte_Global layout");
+STATIC_ASSERT(OFFSETOF(Rte_GlobalBuffersType, Torque) == 4U, "Rte_Global layout");
+STATIC_ASSERT(OFFSETOF(Rte_GlobalBuffersType, DriverInput) == 8U, "Rte_Global layout");
+STATIC_ASSERT(OFFSETOF(Rte_GlobalBuffersType, Power) == 22U, "Rte_Global layout");
+STATIC_ASSERT(OFFSETOF(Rte_GlobalBuffersType, State) == 26U, "Rte_Global layout");
+STATIC_ASSERT((OFFSETOF(Rte_GlobalBuffersType, DriverInput) + 14U) <= RTE_CACHE_LINE_SIZE,
+              "Task_1ms groups span cache lines");
+STATIC_ASSERT(sizeof(Rte_Task1msBuffersType) == 22U, "Rte_Task1ms layout");
+STATIC_ASSERT(sizeof(Rte_Task1msBuffersType) <= RTE_CACHE_LINE_SIZE, "Task_1ms buffers span cache lines");
+STATIC_ASSERT(sizeof(Rte_Task5msBuffersType) == 14U, "Rte_Task5ms layout");
+STATIC_ASSERT(sizeof(Rte_Task10msBuffersType) == 30U, "Rte_Task10ms layout");
+STATIC_ASSERT(sizeof(Rte_Task100msBuffersType) == 8U, "Rte_Task100ms layout");
+STATIC_ASSERT(sizeof(Rte_Signal_DiagStatus_ActiveFaults) <= 4U, "DiagStatus.ActiveFaults not single-copy atomic");
+STATIC_ASSERT(sizeof(Rte_Signal_PowerRequest_KeepAwake) <= 4U, "PowerRequest.KeepAwake not single-copy atomic");
+STATIC_ASSERT(RTE_E_DET_SEQLOCK_RETRY == 0x10U, "Rte_ErrorRoute index");
+STATIC_ASSERT(RTE_E_DET_RECORDER_BUDGET == 0x11U, "Rte_ErrorRoute index");
+STATIC_ASSERT(RTE_E_DET_EVENT_ACTIVATION == 0x12U, "Rte_ErrorRoute index");
+STATIC_ASSERT(RTE_E_DET_REPLICA_CRC == 0x13U, "Rte_ErrorRoute index");
+STATIC_ASSERT(RTE_E_DET_QUEUE_OVERFLOW == 0x14U, "Rte_ErrorRoute index");
+
+/*==================================================================================================
+*                                           LOCAL MACROS
+==================================================================================================*/
+
+/** @brief Byte range [first, end) of a group */
+#define RTE_BLOCK(dst, src, first, end, flags) \
+    { (uint8 *)&(dst) + (first), (const uint8 *)&(src) + (first), (uint16)((end) - (first)), (flags) }
+
+/*==================================================================================================
+*                                         GLOBAL VARIABLES
+==================================================================================================*/
+
+Rte_GlobalBuffersType Rte_Global ALIGNED(RTE_CACHE_LINE_SIZE);
+Rte_Task1msBuffersType Rte_Task1ms ALIGNED(RTE_CACHE_LINE_SIZE);
+Rte_Task5msBuffersType Rte_Task5ms ALIGNED(RTE_CACHE_LINE_SIZE);
+Rte_Task10msBuffersType Rte_Task10ms ALIGNED(RTE_CACHE_LINE_SIZE);
+Rte_Task100msBuffersType Rte_Task100ms ALIGNED(RTE_CACHE_LINE_SIZE);
+
+volatile uint16 Rte_Signal_DiagStatus_ActiveFaults;
+VAR_SECTION(RTE_SHARED_SECTION) volatile uint8 Rte_Signal_PowerRequest_KeepAwake;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC Rte_SeqlockStateType Rte_Seqlock_StateVector_Value;
+STATIC Rte_VehicleStateVectorType Rte_SeqlockData_StateVector_Value[2];
+
+/* SafetyQm: handshake and batch buffer shared, staging on OS_CORE_SAFETY, receive on OS_CORE_QM */
+STATIC VAR_SECTION(RTE_SHARED_SECTION) Rte_LockstepLinkType Rte_LockstepLink_SafetyQm;
+STATIC VAR_SECTION(RTE_SHARED_SECTION) uint32 Rte_LockstepShared_SafetyQm[18];
+STATIC Rte_LockstepTxStateType Rte_LockstepTx_SafetyQm;
+STATIC uint32 Rte_LockstepStaging_SafetyQm[18] ALIGNED(RTE_CACHE_LINE_SIZE);
+STATIC Rte_LockstepRxStateType Rte_LockstepRx_SafetyQm;
+STATIC uint32 Rte_LockstepReceive_SafetyQm[18];
+STATIC Rte_VehicleStateVectorType Rte_Replica_StateVector_Value;
+
+STATIC VAR_SECTION(RTE_SHARED_SECTION) Rte_QueueStateType Rte_QueueState_DiagnosticManager_DiagRequest_Request;
+STATIC VAR_SECTION(RTE_SHARED_SECTION) Rte_DiagRequestType Rte_QueueBuffer_DiagnosticManager_DiagRequest_Request[16] ALIGNED(RTE_CACHE_LINE_SIZE);
+
+STATIC Rte_QueueStateType Rte_QueueState_DiagnosticManager_FaultEvent_Event;
+STATIC Rte_FaultEventType Rte_QueueBuffer_DiagnosticManager_FaultEvent_Event[32] ALIGNED(RTE_CACHE_LINE_SIZE);
+STATIC volatile uint32 Rte_QueueSequence_DiagnosticManager_FaultEvent_Event[32];
+
+STATIC Rte_QueueStateType Rte_QueueState_TorqueArb_DriverEvent_Event;
+STATIC uint16 Rte_QueueBuffer_TorqueArb_DriverEvent_Event[8] ALIGNED(RTE_CACHE_LINE_SIZE);
+
+STATIC VAR_SECTION(RTE_SHARED_SECTION) volatile uint32 Rte_EventPending_DiagnosticManager_OnFaultEvent;
+STATIC VAR_SECTION(RTE_SHARED_SECTION) volatile uint32 Rte_EventPending_DiagnosticManager_OnDiagRequest;
+
+/*==================================================================================================
+*                                         LOCAL CONSTANTS
+==================================================================================================*/
+
+static const Rte_CopyBlockType Rte_Fill_Task1ms[2] =
+{
+    RTE_BLOCK(Rte_Task1ms.Torque, Rte_Global.Torque, 0U, 4U, 0U),
+    RTE_BLOCK(Rte_Task1ms.DriverInput, Rte_Global.DriverInput, 0U, 2U, 0U)
+};
+
+static const Rte_CopyBlockType Rte_Flush_Task1ms[1] =
+{
+    RTE_BLOCK(Rte_Global.Brake, Rte_Task1ms.Brake, 0U, 4U, 0U)
+};
+
+static const Rte_CopyBlockType Rte_Flush_Task5ms[1] =
+{
+    RTE_BLOCK(Rte_Global.DriverInput, Rte_Task5ms.DriverInput, 0U, 14U, RTE_COPY_LOCKED)
+};
+
+static const Rte_CopyBlockType Rte_Fill_Task10ms[3] =
+{
+    RTE_BLOCK(Rte_Task10ms.Brake, Rte_Global.Brake, 0U, 2U, RTE_COPY_LOCKED),
+    RTE_BLOCK(Rte_Task10ms.Power, Rte_Global.Power, 0U, 2U, 0U),
+    RTE_BLOCK(Rte_Task10ms.DriverInput, Rte_Global.DriverInput, 0U, 14U, RTE_COPY_LOCKED)
+};
+
+static const Rte_CopyBlockType Rte_Flush_Task10ms[2] =
+{
+    RTE_BLOCK(Rte_Global.Torque, Rte_Task10ms.Torque, 0U, 4U, RTE_COPY_LOCKED),
+    RTE_BLOCK(Rte_Global.State, Rte_Task10ms.State, 0U, 4U, RTE_COPY_LOCKED)
+};
+
+static const Rte_CopyBlockType Rte_Fill_Task100ms[1] =
+{
+    RTE_BLOCK(Rte_Task100ms.State, Rte_Global.State, 0U, 3U, RTE_COPY_LOCKED)
+};
+
+static const Rte_CopyBlockType Rte_Flush_Task100ms[1] =
+{
+    RTE_BLOCK(Rte_Global.Power, Rte_Task100ms.Power, 0U, 4U, RTE_COPY_LOCKED)
+};
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const Rte_TaskCopyPlanType Rte_CopyPlan[OS_TASK_COUNT] =
+{
+    /* fill,               flush,               fill_count, flush_count */
+    { NULL_PTR,           NULL_PTR,            0U, 0U },  /* Task_Init */
+    { Rte_Fill_Task1ms,   Rte_Flush_Task1ms,   2U, 1U },  /* Task_1ms */
+    { NULL_PTR,           Rte_Flush_Task5ms,   0U, 1U },  /* Task_5ms */
+    { Rte_Fill_Task10ms,  Rte_Flush_Task10ms,  3U, 2U },  /* Task_10ms */
+    { Rte_Fill_Task100ms, Rte_Flush_Task100ms, 1U, 1U },  /* Task_100ms */
+    { NULL_PTR,           NULL_PTR,            0U, 0U },  /* Task_QmBackground */
+    { NULL_PTR,           NULL_PTR,            0U, 0U }   /* Task_Event */
+};
+
+const Rte_SeqlockPortType Rte_SeqlockPort[RTE_SEQLOCK_PORT_COUNT] =
+{
+    { &Rte_Seqlock_StateVector_Value,
+      { &Rte_SeqlockData_StateVector_Value[0], &Rte_SeqlockData_StateVector_Value[1] },
+      (uint16)sizeof(Rte_VehicleStateVectorType) }
+};
+
+const Rte_ConnectionType Rte_Connection[RTE_CONNECTION_COUNT] =
+{
+    { &Rte_Signal_PowerRequest_KeepAwake, (uint8)sizeof(Rte_Signal_PowerRequest_KeepAwake) }
+};
+
+const Rte_ReplicaType Rte_Replica[RTE_REPLICA_COUNT] =
+{
+    { NULL_PTR, &Rte_Replica_StateVector_Value,
+      (uint16)sizeof(Rte_Replica_StateVector_Value), RTE_SEQLOCK_STATE_VECTOR_VALUE, RTE_LOCKSTEP_CHANNEL_SAFETY_QM }
+};
+
+const Rte_LockstepChannelType Rte_LockstepChannel[RTE_LOCKSTEP_CHANNEL_COUNT] =
+{
+    { &Rte_LockstepLink_SafetyQm, Rte_LockstepShared_SafetyQm,
+      &Rte_LockstepTx_SafetyQm, Rte_LockstepStaging_SafetyQm,
+      &Rte_LockstepRx_SafetyQm, Rte_LockstepReceive_SafetyQm,
+      0U, 1U, OS_CORE_SAFETY, OS_CORE_QM }
+};
+
+const Rte_QueueType Rte_Queue[RTE_QUEUE_COUNT] =
+{
+    { &Rte_QueueState_DiagnosticManager_DiagRequest_Request,
+      Rte_QueueBuffer_DiagnosticManager_DiagRequest_Request,
+      NULL_PTR,
+      (uint16)sizeof(Rte_QueueBuffer_DiagnosticManager_DiagRequest_Request[0]), 16U,
+      RTE_EVENT_DIAGNOSTIC_MANAGER_DRE_DIAG_REQUEST, RTE_NO_EVENT },
+    { &Rte_QueueState_DiagnosticManager_FaultEvent_Event,
+      Rte_QueueBuffer_DiagnosticManager_FaultEvent_Event,
+      Rte_QueueSequence_DiagnosticManager_FaultEvent_Event,
+      (uint16)sizeof(Rte_QueueBuffer_DiagnosticManager_FaultEvent_Event[0]), 32U,
+      RTE_EVENT_DIAGNOSTIC_MANAGER_DRE_FAULT_EVENT, RTE_EVENT_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT },
+    { &Rte_QueueState_TorqueArb_DriverEvent_Event,
+      Rte_QueueBuffer_TorqueArb_DriverEvent_Event,
+      NULL_PTR,
+      (uint16)sizeof(Rte_QueueBuffer_TorqueArb_DriverEvent_Event[0]), 8U,
+      RTE_NO_EVENT, RTE_NO_EVENT }
+};
+
+const Rte_EventType Rte_Event[RTE_EVENT_COUNT] =
+{
+    { RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_FAULT_EVENT, RTE_MASK_DIAGNOSTIC_MANAGER_DRE_FAULT_EVENT },
+    { RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_FAULT_EVENT, RTE_MASK_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT },
+    { RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_DIAG_REQUEST, RTE_MASK_DIAGNOSTIC_MANAGER_DRE_DIAG_REQUEST }
+};
+
+const Rte_EventRunnableType Rte_EventRunnable[RTE_RUNNABLE_COUNT] =
+{
+    { &Rte_EventPending_DiagnosticManager_OnFaultEvent, OS_TASK_EVENT },
+    { &Rte_EventPending_DiagnosticManager_OnDiagRequest, OS_TASK_EVENT }
+};
+
+const Rte_RecorderChannelType Rte_RecorderChannel[RTE_RECORDER_CHANNEL_COUNT] =
+{
+    { &Rte_Global.DriverInput, (uint16)sizeof(Rte_Global.DriverInput), RTE_RECORDER_INPUT },
+    { &Rte_Global.Power, (uint16)sizeof(Rte_Global.Power), 0U },
+    { &Rte_Global.Torque, (uint16)sizeof(Rte_Global.Torque), 0U },
+    { &Rte_Global.Brake, (uint16)sizeof(Rte_Global.Brake), 0U },
+    { &Rte_Global.State, (uint16)sizeof(Rte_Global.State), 0U }
+};
+
+const Rte_TraceHopType Rte_TraceHop[RTE_TRACE_HOP_COUNT] =
+{
+    { RTE_NO_TRACE_HOP,
+      RTE_TRACE_CHAIN_PEDAL_TO_WHEEL_TORQUE, OS_TASK_5MS },
+    { RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_DRIVER_INPUT,
+      RTE_TRACE_CHAIN_PEDAL_TO_WHEEL_TORQUE, OS_TASK_10MS },
+    { RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_STATE,
+      RTE_TRACE_CHAIN_PEDAL_TO_WHEEL_TORQUE, OS_TASK_10MS },
+    { RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_TORQUE,
+      RTE_TRACE_CHAIN_PEDAL_TO_WHEEL_TORQUE, OS_TASK_1MS },
+    { RTE_NO_TRACE_HOP,
+      RTE_TRACE_CHAIN_BRAKE_PEDAL_TO_BRAKE, OS_TASK_5MS },
+    { RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_DRIVER_INPUT,
+      RTE_TRACE_CHAIN_BRAKE_PEDAL_TO_BRAKE, OS_TASK_1MS }
+};
+
+const Rte_TraceChainType Rte_TraceChain[RTE_TRACE_CHAIN_COUNT] =
+{
+    { RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_DRIVER_INPUT,
+      RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_BRAKE, 12000UL },
+    { RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_DRIVER_INPUT,
+      RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_BRAKE, 5000UL }
+};
+
+const uint32 Rte_TraceTaskHops[OS_TASK_COUNT] =
+{
+    0UL,  /* Task_Init */
+    (1UL << RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_BRAKE) |
+    (1UL << RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_BRAKE),  /* Task_1ms */
+    (1UL << RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_DRIVER_INPUT) |
+    (1UL << RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_DRIVER_INPUT),  /* Task_5ms */
+    (1UL << RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_STATE) |
+    (1UL << RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_TORQUE),  /* Task_10ms */
+    0UL,  /* Task_100ms */
+    0UL,  /* Task_QmBackground */
+    0UL   /* Task_Event */
+};
+
+const Rte_ErrorRouteType Rte_ErrorRoute[RTE_ERROR_ROUTE_COUNT] =
+{
+    { 257U, RTE_ERROR_ROUTE_DET | RTE_ERROR_ROUTE_DEM },  /* RTE_E_DET_SEQLOCK_RETRY -> DemEvent_RteDataInconsistent */
+    { 0U,   RTE_ERROR_ROUTE_DET                       },  /* RTE_E_DET_RECORDER_BUDGET -> DET only */
+    { 258U, RTE_ERROR_ROUTE_DET | RTE_ERROR_ROUTE_DEM },  /* RTE_E_DET_EVENT_ACTIVATION -> DemEvent_RteTaskActivation */
+    { 257U, RTE_ERROR_ROUTE_DET | RTE_ERROR_ROUTE_DEM },  /* RTE_E_DET_REPLICA_CRC -> DemEvent_RteDataInconsistent */
+    { 259U, RTE_ERROR_ROUTE_DEM                       }   /* RTE_E_DET_QUEUE_OVERFLOW -> DemEvent_RteQueueOverflow */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
@@ -0,0 +1,540 @@
+/**
+ * @file    rte_cfg.h
+ * @brief   RTE Configuration - Types, Buffers, Ports and Access Macros
+ * @version 1.7.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static RTE configuration of the VCU software components.
+ *
+ * Implicit communication copy plan (byte ranges of the signal groups,
+ * L = copied with interrupts disabled):
+ * | Task              | Prio | Fill (global -> local)          | Flush (local -> global)         |
+ * |-------------------|------|---------------------------------|---------------------------------|
+ * | Task_Init         | 31   | -                               | -                               |
+ * | Task_1ms          | 30   | Torque[0..4)                    | Brake[0..4)                     |
+ * |                   |      | DriverInput[0..2)               |                                 |
+ * | Task_5ms          | 25   | -                               | DriverInput[0..14) L            |
+ * | Task_10ms         | 20   | Brake[0..2) L                   | Torque[0..4) L                  |
+ * |                   |      | Power[0..2)                     | State[0..4) L                   |
+ * |                   |      | DriverInput[0..14) L            |                                 |
+ * | Task_100ms        | 10   | State[0..3) L                   | Power[0..4) L                   |
+ * | Task_QmBackground | 5    | -                               | -                               |
+ * | Task_Event        | 27   | -                               | -                               |
+ *
+ * Layout (bytes; declared = element order of the ARXML, H = copied by Task_1ms,
+ * placed in the first cache line of Rte_Global):
+ * | Type                          | Declared | Packed | H |
+ * |-------------------------------|----------|--------|---|
+ * | Rte_VehicleStateVectorType    | 60       | 60     |   |
+ * | Rte_DiagRequestType           | 4        | 4      |   |
+ * | Rte_FaultEventType            | 8        | 8      |   |
+ * | Rte_GrpBrakeType              | 4        | 4      | H |
+ * | Rte_GrpTorqueType             | 4        | 4      | H |
+ * | Rte_GrpDriverInputType        | 14       | 14     | H |
+ * | Rte_GrpPowerType              | 4        | 4      |   |
+ * | Rte_GrpStateType              | 4        | 4      |   |
+ *
+ * Explicit communication:
+ * | Signal                          | Writer task       | Access                  |
+ * |---------------------------------|-------------------|-------------------------|
+ * | DiagStatus.ActiveFaults         | Task_100ms        | direct variable         |
+ * | PowerRequest.KeepAwake          | Task_100ms        | connection table        |
+ * | StateVector.Value               | Task_10ms         | sequence lock + replica |
+ *
+ * Replication channels (one batch, one CRC-32 per cycle; bytes = largest batch):
+ * | Channel           | Source core       | Target core       | Signals                   | Bytes |
+ * |-------------------|-------------------|-------------------|---------------------------|-------|
+ * | SafetyQm          | OS_CORE_SAFETY    | OS_CORE_QM        | StateVector.Value         | 72    |
+ *
+ * Queues (SP = single producer, MP = multi producer):
+ * | Receiver                              | Length | Senders                        | Type |
+ * |---------------------------------------|--------|--------------------------------|------|
+ * | DiagnosticManager.DiagRequest.Request | 16     | Task_QmBackground              | SP X |
+ * | DiagnosticManager.FaultEvent.Event    | 32     | Task_1ms, Task_10ms            | MP   |
+ * | TorqueArb.DriverEvent.Event           | 8      | Task_5ms                       | SP   |
+ * (X = senders on another core, storage in RTE_SHARED_SECTION)
+ *
+ * Event-triggered runnables (pending-event bits):
+ * | Runnable                        | Task              | Event                | Kind     | Bit |
+ * |---------------------------------|-------------------|----------------------|----------|-----|
+ * | DiagnosticManager_OnFaultEvent  | Task_Event        | DRE_FaultEvent       | received | 0   |
+ * |                                 |                   | DREE_FaultEvent      | error    | 1   |
+ * | DiagnosticManager_OnDiagRequest | Task_Event        | DRE_DiagRequest      | received | 0   |
+ *
+ * Recorder channels (task Task_1ms, I = replayed input):
+ * | Channel           | Writer task       | Size | I |
+ * |-------------------|-------------------|------|---|
+ * | DriverInput       | Task_5ms          | 14   | I |
+ * | Power             | Task_100ms        | 4    |   |
+ * | Torque            | Task_10ms         | 4    |   |
+ * | Brake             | Task_1ms          | 4    |   |
+ * | State             | Task_10ms         | 4    |   |
+ *
+ * Timing chains (hops in data-flow order):
+ * | Chain                 | Budget us | Hop               | Writer task       |
+ * |-----------------------|-----------|-------------------|-------------------|
+ * | PedalToWheelTorque    | 12000     | DriverInput       | Task_5ms          |
+ * |                       |           | State             | Task_10ms         |
+ * |                       |           | Torque            | Task_10ms         |
+ * |                       |           | Brake             | Task_1ms          |
+ * | BrakePedalToBrake     | 5000      | DriverInput       | Task_5ms          |
+ * |                       |           | Brake             | Task_1ms          |
+ *
+ * Error routing (runtime errors, reported once per error and task activation):
+ * | Error                          | DET | DEM event (id)                     |
+ * |--------------------------------|-----|------------------------------------|
+ * | RTE_E_DET_SEQLOCK_RETRY        | x   | DemEvent_RteDataInconsistent (257) |
+ * | RTE_E_DET_RECORDER_BUDGET      | x   | -                                  |
+ * | RTE_E_DET_EVENT_ACTIVATION     | x   | DemEvent_RteTaskActivation (258)   |
+ * | RTE_E_DET_REPLICA_CRC          | x   | DemEvent_RteDataInconsistent (257) |
+ * | RTE_E_DET_QUEUE_OVERFLOW       |     | DemEvent_RteQueueOverflow (259)    |
+ *
+ * @note Generated by tools/rte/rte_generator.py from config/autosar/system/rte.arxml - do not edit.
+ */
+
+#ifndef RTE_CFG_H
+#define RTE_CFG_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "rte_types.h"
+#include "task_config.h"
+
+/* ===============================================================================================
+ *                                           DATA TYPES
+ * =============================================================================================== */
+
+/** @brief VehicleStateVectorType (60 bytes) */
+typedef struct
+{
+    uint32 Timestamp;                   /**< +0 */
+    sint32 LongitudinalAccel;           /**< +4 */
+    sint32 LateralAccel;                /**< +8 */
+    sint32 YawRate;                     /**< +12 */
+    sint32 RoadGradient;                /**< +16 */
+    uint32 VehicleMass;                 /**< +20 */
+    uint16 VehicleSpeed;                /**< +24 */
+    uint16 WheelSpeed[4];               /**< +26 */
+    uint16 WheelSlip[4];                /**< +34 */
+    sint16 MotorSpeed;                  /**< +42 */
+    sint16 MotorTorqueActual;           /**< +44 */
+    uint16 HvVoltage;                   /**< +46 */
+    sint16 HvCurrent;                   /**< +48 */
+    uint16 StateOfCharge;               /**< +50 */
+    sint16 AmbientTemperature;          /**< +52 */
+    uint8  DriveMode;                   /**< +54 */
+    uint8  GearActual;                  /**< +55 */
+    uint8  EstimatorQuality;            /**< +56 */
+    uint8  StatusFlags;                 /**< +57 */
+} Rte_VehicleStateVectorType;
+
+/** @brief DiagRequestType (4 bytes) */
+typedef struct
+{
+    uint16 Did;                         /**< +0 */
+    uint8  Sid;                         /**< +2 */
+    uint8  Source;                      /**< +3 */
+} Rte_DiagRequestType;
+
+/** @brief FaultEventType (8 bytes) */
+typedef struct
+{
+    uint32 Timestamp;                   /**< +0 */
+    uint16 EventId;                     /**< +4 */
+    uint8  Status;                      /**< +6 */
+    uint8  Source;                      /**< +7 */
+} Rte_FaultEventType;
+
+/* ===============================================================================================
+ *                                         SIGNAL GROUPS
+ * =============================================================================================== */
+
+/** @brief BrakeBlend.Brake (writer: Task_1ms, 4 bytes) */
+typedef struct
+{
+    sint16 RegenTorque;                 /**< +0 */
+    sint16 FrictionTorque;              /**< +2 */
+} Rte_GrpBrakeType;
+
+/** @brief PowerManagement.Power (writer: Task_100ms, 4 bytes) */
+typedef struct
+{
+    uint8  PowerMode;                   /**< +0 */
+    uint8  DerateActive;                /**< +1 */
+    uint16 LvVoltage;                   /**< +2 */
+} Rte_GrpPowerType;
+
+/** @brief TorqueArb.Torque (writer: Task_10ms, 4 bytes) */
+typedef struct
+{
+    sint16 Request;                     /**< +0 */
+    sint16 Limit;                       /**< +2 */
+} Rte_GrpTorqueType;
+
+/** @brief VehicleState.DriverInput (writer: Task_5ms, 14 bytes) */
+typedef struct
+{
+    uint16 BrakePedal;                  /**< +0 */
+    uint16 AccelPedal;                  /**< +2 */
+    uint16 WheelSpeed[4];               /**< +4 */
+    uint8  GearSelector;                /**< +12 */
+    uint8  IgnitionState;               /**< +13 */
+} Rte_GrpDriverInputType;
+
+/** @brief VehicleState.State (writer: Task_10ms, 4 bytes) */
+typedef struct
+{
+    uint16 VehicleSpeed;                /**< +0 */
+    uint8  DriveMode;                   /**< +2 */
+} Rte_GrpStateType;
+
+/* ===============================================================================================
+ *                                         GLOBAL BUFFERS
+ * =============================================================================================== */
+
+/** @brief Global buffers, groups of Task_1ms first (30 bytes, cache-line aligned) */
+typedef struct
+{
+    Rte_GrpBrakeType         Brake;             /**< +0 */
+    Rte_GrpTorqueType        Torque;            /**< +4 */
+    Rte_GrpDriverInputType   DriverInput;       /**< +8 */
+    Rte_GrpPowerType         Power;             /**< +22 */
+    Rte_GrpStateType         State;             /**< +26 */
+} Rte_GlobalBuffersType;
+
+extern Rte_GlobalBuffersType Rte_Global;
+
+/* ===============================================================================================
+ *                                       TASK-LOCAL BUFFERS
+ * =============================================================================================== */
+
+/** @brief Buffers of Task_1ms (22 bytes, cache-line aligned) */
+typedef struct
+{
+    Rte_GrpBrakeType         Brake;             /**< +0 */
+    Rte_GrpTorqueType        Torque;            /**< +4 */
+    Rte_GrpDriverInputType   DriverInput;       /**< +8 */
+} Rte_Task1msBuffersType;
+
+extern Rte_Task1msBuffersType Rte_Task1ms;
+
+/** @brief Buffers of Task_5ms (14 bytes, cache-line aligned) */
+typedef struct
+{
+    Rte_GrpDriverInputType   DriverInput;       /**< +0 */
+} Rte_Task5msBuffersType;
+
+extern Rte_Task5msBuffersType Rte_Task5ms;
+
+/** @brief Buffers of Task_10ms (30 bytes, cache-line aligned) */
+typedef struct
+{
+    Rte_GrpBrakeType         Brake;             /**< +0 */
+    Rte_GrpPowerType         Power;             /**< +4 */
+    Rte_GrpTorqueType        Torque;            /**< +8 */
+    Rte_GrpDriverInputType   DriverInput;       /**< +12 */
+    Rte_GrpStateType         State;             /**< +26 */
+} Rte_Task10msBuffersType;
+
+extern Rte_Task10msBuffersType Rte_Task10ms;
+
+/** @brief Buffers of Task_100ms (8 bytes, cache-line aligned) */
+typedef struct
+{
+    Rte_GrpPowerType         Power;             /**< +0 */
+    Rte_GrpStateType         State;             /**< +4 */
+} Rte_Task100msBuffersType;
+
+extern Rte_Task100msBuffersType Rte_Task100ms;
+
+/** @brief Copy plan indexed by TaskType */
+extern const Rte_TaskCopyPlanType Rte_CopyPlan[OS_TASK_COUNT];
+
+/* ===============================================================================================
+ *                                      SEQUENCE-LOCK PORTS
+ * =============================================================================================== */
+
+/** @name Port identifiers @{ */
+#define RTE_SEQLOCK_STATE_VECTOR_VALUE          ((Rte_SeqlockPortIdType)0U)
+#define RTE_SEQLOCK_PORT_COUNT                  1U
+/** @} */
+
+/** @brief Port configuration indexed by Rte_SeqlockPortIdType */
+extern const Rte_SeqlockPortType Rte_SeqlockPort[RTE_SEQLOCK_PORT_COUNT];
+
+/* ===============================================================================================
+ *                                          CONNECTIONS
+ * =============================================================================================== */
+
+/** @name Connection identifiers @{ */
+#define RTE_CONNECTION_POWER_REQUEST_KEEP_AWAKE ((Rte_ConnectionIdType)0U)
+#define RTE_CONNECTION_COUNT                    1U
+/** @} */
+
+/** @brief Connection table indexed by Rte_ConnectionIdType */
+extern const Rte_ConnectionType Rte_Connection[RTE_CONNECTION_COUNT];
+
+extern volatile uint16 Rte_Signal_DiagStatus_ActiveFaults;
+extern volatile uint8 Rte_Signal_PowerRequest_KeepAwake;
+
+/* ===============================================================================================
+ *                                          REPLICATION
+ * =============================================================================================== */
+
+/** @name Replica identifiers @{ */
+#define RTE_REPLICA_STATE_VECTOR_VALUE          ((Rte_ReplicaIdType)0U)
+#define RTE_REPLICA_COUNT                       1U
+/** @} */
+
+/** @name Replication channel identifiers @{ */
+#define RTE_LOCKSTEP_CHANNEL_SAFETY_QM          ((Rte_LockstepChannelIdType)0U)
+#define RTE_LOCKSTEP_CHANNEL_COUNT              1U
+/** @} */
+
+/** @brief Replicated signals indexed by Rte_ReplicaIdType */
+extern const Rte_ReplicaType Rte_Replica[RTE_REPLICA_COUNT];
+
+/** @brief Replication channels indexed by Rte_LockstepChannelIdType */
+extern const Rte_LockstepChannelType Rte_LockstepChannel[RTE_LOCKSTEP_CHANNEL_COUNT];
+
+/* ===============================================================================================
+ *                                             QUEUES
+ * =============================================================================================== */
+
+/** @name Queue identifiers @{ */
+#define RTE_QUEUE_DIAGNOSTIC_MANAGER_DIAG_REQUEST_REQUEST ((Rte_QueueIdType)0U)
+#define RTE_QUEUE_DIAGNOSTIC_MANAGER_FAULT_EVENT_EVENT    ((Rte_QueueIdType)1U)
+#define RTE_QUEUE_TORQUE_ARB_DRIVER_EVENT_EVENT           ((Rte_QueueIdType)2U)
+#define RTE_QUEUE_COUNT                                   3U
+/** @} */
+
+/** @brief Queue configuration indexed by Rte_QueueIdType */
+extern const Rte_QueueType Rte_Queue[RTE_QUEUE_COUNT];
+
+/* ===============================================================================================
+ *                                             EVENTS
+ * =============================================================================================== */
+
+/** @name Event identifiers @{ */
+#define RTE_EVENT_DIAGNOSTIC_MANAGER_DRE_FAULT_EVENT  ((Rte_EventIdType)0U)
+#define RTE_EVENT_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT ((Rte_EventIdType)1U)
+#define RTE_EVENT_DIAGNOSTIC_MANAGER_DRE_DIAG_REQUEST ((Rte_EventIdType)2U)
+#define RTE_EVENT_COUNT                               3U
+/** @} */
+
+/** @name Event-triggered runnable identifiers @{ */
+#define RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_FAULT_EVENT  ((Rte_RunnableIdType)0U)
+#define RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_DIAG_REQUEST ((Rte_RunnableIdType)1U)
+#define RTE_RUNNABLE_COUNT                              2U
+/** @} */
+
+/** @brief Tasks activated by events (bit = TaskType) */
+#define RTE_EVENT_TASK_MASK                     (1UL << OS_TASK_EVENT)
+
+/** @brief Event configuration indexed by Rte_EventIdType */
+extern const Rte_EventType Rte_Event[RTE_EVENT_COUNT];
+
+/** @brief Event-triggered runnables indexed by Rte_RunnableIdType */
+extern const Rte_EventRunnableType Rte_EventRunnable[RTE_RUNNABLE_COUNT];
+
+/* ===============================================================================================
+ *                                            RECORDER
+ * =============================================================================================== */
+
+#define RTE_RECORDER_TASK                       OS_TASK_1MS
+#define RTE_RECORDER_CHANNEL_COUNT              5U
+#define RTE_RECORDER_IMAGE_SIZE                 30U             /**< Sum of the channel sizes */
+#define RTE_RECORDER_LAYOUT_ID                  0x2C3D3F4BUL    /**< CRC-32 of the channel layout */
+
+/** @brief Recorded signal groups, in image order */
+extern const Rte_RecorderChannelType Rte_RecorderChannel[RTE_RECORDER_CHANNEL_COUNT];
+
+/* ===============================================================================================
+ *                                         TIMING CHAINS
+ * =============================================================================================== */
+
+/** @name Traced hop identifiers @{ */
+#define RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_DRIVER_INPUT ((Rte_TraceHopIdType)0U)
+#define RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_STATE        ((Rte_TraceHopIdType)1U)
+#define RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_TORQUE       ((Rte_TraceHopIdType)2U)
+#define RTE_TRACE_HOP_PEDAL_TO_WHEEL_TORQUE_BRAKE        ((Rte_TraceHopIdType)3U)
+#define RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_DRIVER_INPUT  ((Rte_TraceHopIdType)4U)
+#define RTE_TRACE_HOP_BRAKE_PEDAL_TO_BRAKE_BRAKE         ((Rte_TraceHopIdType)5U)
+#define RTE_TRACE_HOP_COUNT                              6U
+/** @} */
+
+/** @name Timing chain identifiers @{ */
+#define RTE_TRACE_CHAIN_PEDAL_TO_WHEEL_TORQUE   ((Rte_TraceChainIdType)0U)
+#define RTE_TRACE_CHAIN_BRAKE_PEDAL_TO_BRAKE    ((Rte_TraceChainIdType)1U)
+#define RTE_TRACE_CHAIN_COUNT                   2U
+/** @} */
+
+/** @brief Traced hops indexed by Rte_TraceHopIdType */
+extern const Rte_TraceHopType Rte_TraceHop[RTE_TRACE_HOP_COUNT];
+
+/** @brief Timing chains indexed by Rte_TraceChainIdType */
+extern const Rte_TraceChainType Rte_TraceChain[RTE_TRACE_CHAIN_COUNT];
+
+/** @brief Hops published by each task (bit = Rte_TraceHopIdType), indexed by TaskType */
+extern const uint32 Rte_TraceTaskHops[OS_TASK_COUNT];
+
+/* ===============================================================================================
+ *                                         ERROR ROUTING
+ * =============================================================================================== */
+
+#define RTE_ERROR_ROUTE_COUNT                   5U
+
+/** @brief Reports per runtime error, indexed by error code - RTE_E_DET_RUNTIME_FIRST */
+extern const Rte_ErrorRouteType Rte_ErrorRoute[RTE_ERROR_ROUTE_COUNT];
+
+/* ===============================================================================================
+ *                                     IMPLICIT ACCESS MACROS
+ * =============================================================================================== */
+
+/** @name BrakeBlend_Run1ms (Task_1ms) @{ */
+#define Rte_IRead_BrakeBlend_Run1ms_DriverInput_BrakePedal()         (Rte_Task1ms.DriverInput.BrakePedal)
+#define Rte_IRead_BrakeBlend_Run1ms_Torque_Request()                 (Rte_Task1ms.Torque.Request)
+#define Rte_IRead_BrakeBlend_Run1ms_Torque_Limit()                   (Rte_Task1ms.Torque.Limit)
+#define Rte_IWrite_BrakeBlend_Run1ms_Brake_FrictionTorque(data)      (Rte_Task1ms.Brake.FrictionTorque = (data))
+#define Rte_IWrite_BrakeBlend_Run1ms_Brake_RegenTorque(data)         (Rte_Task1ms.Brake.RegenTorque = (data))
+/** @} */
+
+/** @name VehicleState_Input5ms (Task_5ms) @{ */
+#define Rte_IWrite_VehicleState_Input5ms_DriverInput_AccelPedal(data) (Rte_Task5ms.DriverInput.AccelPedal = (data))
+#define Rte_IWriteRef_VehicleState_Input5ms_DriverInput_WheelSpeed() (&Rte_Task5ms.DriverInput.WheelSpeed[0])
+#define Rte_IWrite_VehicleState_Input5ms_DriverInput_GearSelector(data) (Rte_Task5ms.DriverInput.GearSelector = (data))
+#define Rte_IWrite_VehicleState_Input5ms_DriverInput_IgnitionState(data) \
+    (Rte_Task5ms.DriverInput.IgnitionState = (data))
+#define Rte_IWrite_VehicleState_Input5ms_DriverInput_BrakePedal(data) (Rte_Task5ms.DriverInput.BrakePedal = (data))
+/** @} */
+
+/** @name VehicleState_Run10ms (Task_10ms) @{ */
+#define Rte_IRead_VehicleState_Run10ms_DriverInput_WheelSpeed()      (&Rte_Task10ms.DriverInput.WheelSpeed[0])
+#define Rte_IRead_VehicleState_Run10ms_DriverInput_GearSelector()    (Rte_Task10ms.DriverInput.GearSelector)
+#define Rte_IRead_VehicleState_Run10ms_DriverInput_IgnitionState()   (Rte_Task10ms.DriverInput.IgnitionState)
+#define Rte_IRead_VehicleState_Run10ms_Power_PowerMode()             (Rte_Task10ms.Power.PowerMode)
+#define Rte_IWrite_VehicleState_Run10ms_State_VehicleSpeed(data)     (Rte_Task10ms.State.VehicleSpeed = (data))
+#define Rte_IWrite_VehicleState_Run10ms_State_DriveMode(data)        (Rte_Task10ms.State.DriveMode = (data))
+/** @} */
+
+/** @name TorqueArb_Run10ms (Task_10ms) @{ */
+#define Rte_IRead_TorqueArb_Run10ms_DriverInput_AccelPedal()         (Rte_Task10ms.DriverInput.AccelPedal)
+#define Rte_IRead_TorqueArb_Run10ms_DriverInput_BrakePedal()         (Rte_Task10ms.DriverInput.BrakePedal)
+#define Rte_IRead_TorqueArb_Run10ms_Brake_RegenTorque()              (Rte_Task10ms.Brake.RegenTorque)
+#define Rte_IRead_TorqueArb_Run10ms_Power_DerateActive()             (Rte_Task10ms.Power.DerateActive)
+#define Rte_IRead_TorqueArb_Run10ms_State_DriveMode()                (Rte_Task10ms.State.DriveMode)
+#define Rte_IWrite_TorqueArb_Run10ms_Torque_Request(data)            (Rte_Task10ms.Torque.Request = (data))
+#define Rte_IWrite_TorqueArb_Run10ms_Torque_Limit(data)              (Rte_Task10ms.Torque.Limit = (data))
+/** @} */
+
+/** @name PowerManagement_Run100ms (Task_100ms) @{ */
+#define Rte_IRead_PowerManagement_Run100ms_State_VehicleSpeed()      (Rte_Task100ms.State.VehicleSpeed)
+#define Rte_IRead_PowerManagement_Run100ms_State_DriveMode()         (Rte_Task100ms.State.DriveMode)
+#define Rte_IWrite_PowerManagement_Run100ms_Power_LvVoltage(data)    (Rte_Task100ms.Power.LvVoltage = (data))
+#define Rte_IWrite_PowerManagement_Run100ms_Power_PowerMode(data)    (Rte_Task100ms.Power.PowerMode = (data))
+#define Rte_IWrite_PowerManagement_Run100ms_Power_DerateActive(data) (Rte_Task100ms.Power.DerateActive = (data))
+/** @} */
+
+/** @name DiagnosticManager_Run100ms (Task_100ms) @{ */
+#define Rte_IRead_DiagnosticManager_Run100ms_State_VehicleSpeed()    (Rte_Task100ms.State.VehicleSpeed)
+/** @} */
+
+/* ===============================================================================================
+ *                                     EXPLICIT ACCESS MACROS
+ * =============================================================================================== */
+
+/** @name BrakeBlend_Run1ms (Task_1ms) @{ */
+#define Rte_Send_BrakeBlend_FaultEvent_Event(data) \
+    Rte_Queue_Send(RTE_QUEUE_DIAGNOSTIC_MANAGER_FAULT_EVENT_EVENT, (data))
+#define Rte_Read_BrakeBlend_StateVector_Value(data) \
+    Rte_Seqlock_Read(RTE_SEQLOCK_STATE_VECTOR_VALUE, (data))
+/** @} */
+
+/** @name VehicleState_Input5ms (Task_5ms) @{ */
+#define Rte_Send_VehicleState_DriverEvent_Event(data) \
+    Rte_Queue_Send(RTE_QUEUE_TORQUE_ARB_DRIVER_EVENT_EVENT, (data))
+/** @} */
+
+/** @name VehicleState_Run10ms (Task_10ms) @{ */
+#define Rte_Write_VehicleState_StateVector_Value(data) \
+    Rte_Lockstep_Update(RTE_REPLICA_STATE_VECTOR_VALUE, Rte_Seqlock_Write(RTE_SEQLOCK_STATE_VECTOR_VALUE, (data)))
+/** @} */
+
+/** @name TorqueArb_Run10ms (Task_10ms) @{ */
+#define Rte_Send_TorqueArb_FaultEvent_Event(data) \
+    Rte_Queue_Send(RTE_QUEUE_DIAGNOSTIC_MANAGER_FAULT_EVENT_EVENT, (data))
+#define Rte_Read_TorqueArb_StateVector_Value(data) \
+    Rte_Seqlock_Read(RTE_SEQLOCK_STATE_VECTOR_VALUE, (data))
+#define Rte_Read_TorqueArb_DiagStatus_ActiveFaults(data) \
+    (*(data) = Rte_Signal_DiagStatus_ActiveFaults, RTE_E_OK)
+#define Rte_Receive_TorqueArb_DriverEvent_Event(data) \
+    Rte_Queue_Receive(RTE_QUEUE_TORQUE_ARB_DRIVER_EVENT_EVENT, (data))
+#define Rte_ReceiveN_TorqueArb_DriverEvent_Event(data, max, count) \
+    Rte_Queue_ReceiveN(RTE_QUEUE_TORQUE_ARB_DRIVER_EVENT_EVENT, (data), (max), (count))
+/** @} */
+
+/** @name PowerManagement_Run100ms (Task_100ms) @{ */
+#define Rte_Write_PowerManagement_PowerRequest_KeepAwake(data) \
+    Rte_Connection_Write(RTE_CONNECTION_POWER_REQUEST_KEEP_AWAKE, (uint32)(data))
+#define Rte_Read_PowerManagement_StateVector_Value(data) \
+    Rte_Seqlock_Read(RTE_SEQLOCK_STATE_VECTOR_VALUE, (data))
+/** @} */
+
+/** @name DiagnosticManager_Run100ms (Task_100ms) @{ */
+#define Rte_Write_DiagnosticManager_DiagStatus_ActiveFaults(data) \
+    (Rte_Signal_DiagStatus_ActiveFaults = (data), RTE_E_OK)
+#define Rte_Read_DiagnosticManager_StateVector_Value(data) \
+    Rte_Seqlock_Read(RTE_SEQLOCK_STATE_VECTOR_VALUE, (data))
+#define Rte_Read_DiagnosticManager_PowerRequest_KeepAwake(data) \
+    (*(data) = Rte_Signal_PowerRequest_KeepAwake, RTE_E_OK)
+/** @} */
+
+/** @name EthernetComm_RunBackground (Task_QmBackground) @{ */
+#define Rte_Send_EthernetComm_DiagRequest_Request(data) \
+    Rte_Queue_Send(RTE_QUEUE_DIAGNOSTIC_MANAGER_DIAG_REQUEST_REQUEST, (data))
+#define Rte_Read_EthernetComm_StateVector_Value(data) \
+    Rte_Lockstep_Read(RTE_REPLICA_STATE_VECTOR_VALUE, (data))
+#define Rte_Read_EthernetComm_PowerRequest_KeepAwake(data) \
+    Rte_Connection_Read(RTE_CONNECTION_POWER_REQUEST_KEEP_AWAKE, (data))
+/** @} */
+
+/** @name DiagnosticManager_OnFaultEvent (Task_Event) @{ */
+#define Rte_Receive_DiagnosticManager_FaultEvent_Event(data) \
+    Rte_Queue_Receive(RTE_QUEUE_DIAGNOSTIC_MANAGER_FAULT_EVENT_EVENT, (data))
+#define Rte_ReceiveN_DiagnosticManager_FaultEvent_Event(data, max, count) \
+    Rte_Queue_ReceiveN(RTE_QUEUE_DIAGNOSTIC_MANAGER_FAULT_EVENT_EVENT, (data), (max), (count))
+/** @} */
+
+/** @name DiagnosticManager_OnDiagRequest (Task_Event) @{ */
+#define Rte_Receive_DiagnosticManager_DiagRequest_Request(data) \
+    Rte_Queue_Receive(RTE_QUEUE_DIAGNOSTIC_MANAGER_DIAG_REQUEST_REQUEST, (data))
+#define Rte_ReceiveN_DiagnosticManager_DiagRequest_Request(data, max, count) \
+    Rte_Queue_ReceiveN(RTE_QUEUE_DIAGNOSTIC_MANAGER_DIAG_REQUEST_REQUEST, (data), (max), (count))
+/** @} */
+
+/* ===============================================================================================
+ *                                          EVENT MACROS
+ * =============================================================================================== */
+
+/** @name DiagnosticManager_OnFaultEvent (Task_Event) @{ */
+#define Rte_Events_DiagnosticManager_OnFaultEvent() \
+    Rte_Event_Take(RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_FAULT_EVENT)
+#define RTE_MASK_DIAGNOSTIC_MANAGER_DRE_FAULT_EVENT                  0x00000001UL
+#define RTE_MASK_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT                 0x00000002UL
+/** @} */
+
+/** @name DiagnosticManager_OnDiagRequest (Task_Event) @{ */
+#define Rte_Events_DiagnosticManager_OnDiagRequest() \
+    Rte_Event_Take(RTE_RUNNABLE_DIAGNOSTIC_MANAGER_ON_DIAG_REQUEST)
+#define RTE_MASK_DIAGNOSTIC_MANAGER_DRE_DIAG_REQUEST                 0x00000001UL
+/** @} */
+
+#endif /* RTE_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
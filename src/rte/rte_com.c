@@ -0,0 +1,401 @@
+/**
+ * @file    rte_com.c
+ * @brief   RTE - Queued Sender/Receiver Communication
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Ring buffers behind the queued data elements declared in rte.h. One queue
+ * per receiver port; the generated configuration (rte_cfg.c) provides the
+ * state, the element storage and, for multi-producer queues, the per-slot
+ * sequence numbers.
+ *
+ * Implementation Notes:
+ * - Single producer: the producer owns tail, the consumer owns head. An
+ *   element is written before tail is advanced past it and read before head
+ *   is advanced past it; the DMBs order these for the other core
+ * - Multi producer: a sender reserves a position by advancing tail with a
+ *   compare-and-swap, writes the slot and then publishes it by setting the
+ *   slot sequence to lap + 1 (lap = position - slot index). The consumer
+ *   frees a slot by setting its sequence to the next lap. A slot is free
+ *   for a sender when its sequence equals the sender's lap, so the all-zero
+ *   start-up state is valid and no initialisation call is needed
+ * - A sender preempted between reservation and publication delays only the
+ *   consumer, which stops at the first unpublished slot and returns the
+ *   rest on its next call; other senders keep reserving behind it
+ * - Receiving copies the run of available elements with at most two
+ *   memcpy() calls (before and after the wrap-around point)
+ * - The overflow counter is written by the producers only. The consumer
+ *   remembers the value it last reported and adds RTE_E_LOST_DATA when it
+ *   has changed. Every rejected element is also reported as a runtime
+ *   error; a burst of overflows in one task costs one DET and DEM report
+ * - A sent element raises the receiver's data received event, a rejected
+ *   one its receive error event (Rte_Event_Raise()). Raising after the
+ *   publication means the runnable always finds the element that
+ *   activated it
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Module version 1.4.0 (recorder)    |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Queue data received/error events   |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Module version 1.6.0               |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Queue overflow runtime error       |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Module version 1.8.0               |
+ *
+ * @see rte.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_COM_C_VENDOR_ID                     43U
+#define RTE_COM_C_SW_MAJOR_VERSION              1U
+#define RTE_COM_C_SW_MINOR_VERSION              8U
+#define RTE_COM_C_SW_PATCH_VERSION              0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_COM_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_com.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_COM_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_COM_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_COM_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_com.c and rte_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+/** @brief Address of the slot of a position */
+#define RTE_QUEUE_SLOT(queue, pos) \
+    ((uint8 *)(queue)->buffer + (((pos) & ((uint32)(queue)->length - 1UL)) * (uint32)(queue)->element_size))
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC uint32 Rte_Queue_Available(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue, uint32 Head,
+    uint32 Max);
+STATIC void Rte_Queue_CopyOut(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue, uint32 Head,
+    uint32 Count, P2VAR(uint8, AUTOMATIC, RTE_APPL_DATA) Data);
+STATIC Std_ReturnType Rte_Queue_Take(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data, uint16 MaxCount,
+    P2VAR(uint16, AUTOMATIC, RTE_APPL_DATA) Count);
+STATIC void Rte_Queue_Notify(Rte_EventIdType EventId);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Number of elements from Head on that can be taken, at most Max
+ */
+STATIC uint32 Rte_Queue_Available(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue, uint32 Head,
+    uint32 Max)
+{
+    uint32 count;
+
+    if (Queue->sequence == NULL_PTR)
+    {
+        count = Queue->state->tail - Head;
+        if (count > Max)
+        {
+            count = Max;
+        }
+    }
+    else
+    {
+        /* Contiguous run of published slots */
+        uint32 mask = (uint32)Queue->length - 1UL;
+
+        count = 0UL;
+        while ((count < Max) &&
+               (Queue->sequence[(Head + count) & mask] == (((Head + count) & ~mask) + 1UL)))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Copy Count elements starting at position Head into Data
+ */
+STATIC void Rte_Queue_CopyOut(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue, uint32 Head,
+    uint32 Count, P2VAR(uint8, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    uint32 first = (uint32)Queue->length - (Head & ((uint32)Queue->length - 1UL));
+
+    if (first > Count)
+    {
+        first = Count;
+    }
+
+    (void)memcpy(Data, RTE_QUEUE_SLOT(Queue, Head), first * Queue->element_size);
+    if (Count > first)
+    {
+        (void)memcpy(&Data[first * Queue->element_size], Queue->buffer,
+                     (Count - first) * Queue->element_size);
+    }
+}
+
+/**
+ * @brief Common part of Rte_Queue_Receive() and Rte_Queue_ReceiveN()
+ */
+STATIC Std_ReturnType Rte_Queue_Take(P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) Queue,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data, uint16 MaxCount,
+    P2VAR(uint16, AUTOMATIC, RTE_APPL_DATA) Count)
+{
+    P2VAR(Rte_QueueStateType, AUTOMATIC, RTE_VAR) state = Queue->state;
+    Std_ReturnType result;
+    uint32 head = state->head;
+    uint32 count;
+    uint32 overflows;
+    uint32 i;
+
+    count = Rte_Queue_Available(Queue, head, MaxCount);
+    MEMORY_BARRIER();                                   /* Elements after their publication */
+
+    if (count > 0UL)
+    {
+        Rte_Queue_CopyOut(Queue, head, count, (uint8 *)Data);
+        MEMORY_BARRIER();                               /* Copies complete before the slots are freed */
+
+        if (Queue->sequence != NULL_PTR)
+        {
+            uint32 mask = (uint32)Queue->length - 1UL;
+
+            for (i = head; i != (head + count); i++)
+            {
+                Queue->sequence[i & mask] = (i & ~mask) + (uint32)Queue->length;
+            }
+        }
+        state->head = head + count;
+        result = RTE_E_OK;
+    }
+    else
+    {
+        result = RTE_E_NO_DATA;
+    }
+
+    overflows = state->overflows;
+    if (overflows != state->overflows_seen)
+    {
+        state->overflows_seen = overflows;
+        result = (Std_ReturnType)(result | RTE_E_LOST_DATA);
+    }
+
+    *Count = (uint16)count;
+
+    return result;
+}
+
+/**
+ * @brief Raise a queue event if one is configured
+ */
+STATIC void Rte_Queue_Notify(Rte_EventIdType EventId)
+{
+    if (EventId != RTE_NO_EVENT)
+    {
+        Rte_Event_Raise(EventId);
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Append one element to a queue - never blocks
+ */
+Std_ReturnType Rte_Queue_Send(Rte_QueueIdType QueueId,
+    P2CONST(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    P2CONST(Rte_QueueType, AUTOMATIC, RTE_CONST) queue;
+    P2VAR(Rte_QueueStateType, AUTOMATIC, RTE_VAR) state;
+    uint32 tail;
+
+    if (QueueId >= RTE_QUEUE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_SEND_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_SEND_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    queue = &Rte_Queue[QueueId];
+    state = queue->state;
+    tail = state->tail;
+
+    if (queue->sequence == NULL_PTR)
+    {
+        if ((tail - state->head) >= (uint32)queue->length)
+        {
+            state->overflows++;
+            Rte_Queue_Notify(queue->error_event);
+            Rte_Error_Report(RTE_QUEUE_SEND_API_ID, RTE_E_DET_QUEUE_OVERFLOW);
+            return RTE_E_LIMIT;
+        }
+
+        MEMORY_BARRIER();                               /* Slot freed before it is rewritten */
+        (void)memcpy(RTE_QUEUE_SLOT(queue, tail), Data, queue->element_size);
+        MEMORY_BARRIER();                               /* Element before its publication */
+        state->tail = tail + 1UL;
+    }
+    else
+    {
+        uint32 mask = (uint32)queue->length - 1UL;
+        uint32 lap;
+        uint32 overflows;
+
+        /* Every retry means another sender has taken the position */
+        for (;;)
+        {
+            sint32 distance;
+
+            lap = tail & ~mask;
+            distance = (sint32)(queue->sequence[tail & mask] - lap);
+            if (distance == 0L)
+            {
+                if (Os_Port_CompareAndSwap(&state->tail, tail, tail + 1UL) == TRUE)
+                {
+                    break;
+                }
+            }
+            else if (distance < 0L)
+            {
+                /* Slot still holds the element of the previous lap */
+                do
+                {
+                    overflows = state->overflows;
+                } while (Os_Port_CompareAndSwap(&state->overflows, overflows, overflows + 1UL) == FALSE);
+
+                Rte_Queue_Notify(queue->error_event);
+                Rte_Error_Report(RTE_QUEUE_SEND_API_ID, RTE_E_DET_QUEUE_OVERFLOW);
+                return RTE_E_LIMIT;
+            }
+            else
+            {
+                /* Position already taken; retry with the current tail */
+            }
+            tail = state->tail;
+        }
+
+        MEMORY_BARRIER();                               /* Slot freed before it is rewritten */
+        (void)memcpy(RTE_QUEUE_SLOT(queue, tail), Data, queue->element_size);
+        MEMORY_BARRIER();                               /* Element before its publication */
+        queue->sequence[tail & mask] = lap + 1UL;
+    }
+
+    Rte_Queue_Notify(queue->received_event);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Take the oldest element from a queue
+ */
+Std_ReturnType Rte_Queue_Receive(Rte_QueueIdType QueueId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    uint16 count;
+
+    if (QueueId >= RTE_QUEUE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_RECEIVE_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_RECEIVE_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    return Rte_Queue_Take(&Rte_Queue[QueueId], Data, 1U, &count);
+}
+
+/**
+ * @brief Take up to MaxCount elements from a queue in one call
+ */
+Std_ReturnType Rte_Queue_ReceiveN(Rte_QueueIdType QueueId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data, uint16 MaxCount,
+    P2VAR(uint16, AUTOMATIC, RTE_APPL_DATA) Count)
+{
+    if (QueueId >= RTE_QUEUE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_RECEIVE_N_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if ((Data == NULL_PTR) || (Count == NULL_PTR))
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_RECEIVE_N_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    return Rte_Queue_Take(&Rte_Queue[QueueId], Data, MaxCount, Count);
+}
+
+/**
+ * @brief Read the fill level and overflow counter of a queue
+ */
+Std_ReturnType Rte_Queue_GetStatus(Rte_QueueIdType QueueId,
+    P2VAR(Rte_QueueStatusType, AUTOMATIC, RTE_APPL_DATA) Status)
+{
+    P2CONST(Rte_QueueStateType, AUTOMATIC, RTE_VAR) state;
+
+    if (QueueId >= RTE_QUEUE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_GET_STATUS_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Status == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_QUEUE_GET_STATUS_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    /* Reserved but unpublished elements of multi-producer queues count as queued */
+    state = Rte_Queue[QueueId].state;
+    Status->fill_level = (uint16)(state->tail - state->head);
+    Status->overflows = state->overflows;
+
+    return RTE_E_OK;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,290 @@
+/**
+ * @file    rte_error.c
+ * @brief   RTE - Runtime Error Routing to DET and DEM
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Single path of the RTE runtime errors declared in rte.h. The generated
+ * configuration (rte_cfg.c) provides the routing table Rte_ErrorRoute, one
+ * row per runtime error, indexed by the error code minus
+ * RTE_E_DET_RUNTIME_FIRST:
+ *
+ * | Route flag          | Report                                              |
+ * |---------------------|-----------------------------------------------------|
+ * | RTE_ERROR_ROUTE_DET | Det_ReportRuntimeError() with the reporting service |
+ * | RTE_ERROR_ROUTE_DEM | RTE_ERROR_DEM_REPORT(dem_event, occurrences)        |
+ *
+ * Batching: an error reported while a task of the calling core is between
+ * Rte_Task_Fill() and Rte_Task_Flush() is only counted in the batch of that
+ * task. Rte_Task_Flush() routes every error of the batch once, with the
+ * number of occurrences, so an error-heavy activation costs one DET and one
+ * DEM report per error code. Errors reported outside of a task batch
+ * (interrupts on an idle core, tasks without fill and flush, before
+ * Rte_Start()) are routed at once.
+ *
+ * Implementation Notes:
+ * - The current batch of a core is tracked by Rte_Error_StartTask() and
+ *   Rte_Error_FlushTask(), which store the batch they preempted. Tasks on a
+ *   core preempt strictly nested, so the batches form a stack
+ * - The batch of a task is only written by its core; interrupts of that
+ *   core report into it too, so the count update takes the interrupt lock
+ *   for a few instructions. The DET and DEM reports run outside of it
+ * - Current task and batch indices are stored +1, so the all-zero start-up
+ *   state means "no batch" and no initialisation call is needed
+ * - The routed totals are shared by all cores and updated with
+ *   Os_Port_CompareAndSwap(); they saturate at 0xFFFFFFFF
+ * - The occurrence count of a batch saturates at 0xFFFF; the API reported
+ *   with an error is the last service that raised it
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Module version 1.8.0               |
+ *
+ * @see rte.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_ERROR_C_VENDOR_ID                   43U
+#define RTE_ERROR_C_SW_MAJOR_VERSION            1U
+#define RTE_ERROR_C_SW_MINOR_VERSION            8U
+#define RTE_ERROR_C_SW_PATCH_VERSION            0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_ERROR_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_error.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_ERROR_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_ERROR_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_ERROR_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_error.c and rte_types.h"
+#endif
+
+#if (RTE_ERROR_ROUTE_COUNT != (RTE_E_DET_RUNTIME_LAST - RTE_E_DET_RUNTIME_FIRST + 1U))
+    #error "Rte_ErrorRoute does not cover the runtime errors of rte.h - regenerate rte_cfg"
+#endif
+
+#if (RTE_ERROR_ROUTE_COUNT > 32U)
+    #error "The pending mask of an error batch holds at most 32 errors"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+#define RTE_ERROR_COUNT_MAX                     0xFFFFU
+#define RTE_ERROR_TOTAL_MAX                     0xFFFFFFFFUL
+
+/** @brief No batch open on the core */
+#define RTE_ERROR_NO_TASK                       0U
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct Rte_ErrorBatchType
+ * @brief Errors counted in the running activation of a task
+ */
+typedef struct
+{
+    uint32 pending;                             /**< Bit per route with a count */
+    uint16 count[RTE_ERROR_ROUTE_COUNT];        /**< Occurrences per route */
+    uint8  api[RTE_ERROR_ROUTE_COUNT];          /**< Last reporting service per route */
+    uint8  preempted;                           /**< Batch open before this one (TaskID + 1) */
+} Rte_ErrorBatchType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC Rte_ErrorBatchType Rte_ErrorBatch[OS_TASK_COUNT];
+
+/** @brief Open batch per core (TaskID + 1, or RTE_ERROR_NO_TASK) */
+STATIC volatile uint8 Rte_ErrorCurrent[OS_NUM_CORES];
+
+/** @brief Routed occurrences per route since start */
+STATIC VAR_SECTION(RTE_SHARED_SECTION) volatile uint32 Rte_ErrorTotal[RTE_ERROR_ROUTE_COUNT];
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Rte_Error_Route(uint8 Route, uint8 ApiId, uint16 Count);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Count the occurrences of an error and report them as configured
+ */
+STATIC void Rte_Error_Route(uint8 Route, uint8 ApiId, uint16 Count)
+{
+    P2CONST(Rte_ErrorRouteType, AUTOMATIC, RTE_CONST) route = &Rte_ErrorRoute[Route];
+    uint32 total;
+    uint32 updated;
+
+    do
+    {
+        total = Rte_ErrorTotal[Route];
+        updated = (total > (RTE_ERROR_TOTAL_MAX - Count)) ? RTE_ERROR_TOTAL_MAX : (total + Count);
+    } while (Os_Port_CompareAndSwap(&Rte_ErrorTotal[Route], total, updated) == FALSE);
+
+    (void)ApiId;                                        /* Unused if the DET is compiled out */
+    if ((route->flags & RTE_ERROR_ROUTE_DET) != 0U)
+    {
+        (void)Det_ReportRuntimeError(RTE_MODULE_ID, RTE_INSTANCE_ID, ApiId,
+                                     (uint8)(RTE_E_DET_RUNTIME_FIRST + Route));
+    }
+
+#if defined(RTE_ERROR_DEM_REPORT)
+    if ((route->flags & RTE_ERROR_ROUTE_DEM) != 0U)
+    {
+        RTE_ERROR_DEM_REPORT(route->dem_event, Count);
+    }
+#endif
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Report a runtime error of the RTE
+ */
+void Rte_Error_Report(uint8 ApiId, uint8 ErrorId)
+{
+    P2VAR(Rte_ErrorBatchType, AUTOMATIC, RTE_VAR) batch;
+    uint8 route = (uint8)(ErrorId - RTE_E_DET_RUNTIME_FIRST);  /* Codes below the first wrap */
+    uint8 current;
+    uint32 key;
+
+    if (route >= RTE_ERROR_ROUTE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_ERROR_REPORT_API_ID, RTE_E_DET_PARAM_ID);
+        return;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    current = Rte_ErrorCurrent[GetCoreID()];
+    if (current != RTE_ERROR_NO_TASK)
+    {
+        batch = &Rte_ErrorBatch[current - 1U];
+        if (batch->count[route] < RTE_ERROR_COUNT_MAX)
+        {
+            batch->count[route]++;
+        }
+        batch->api[route] = ApiId;
+        batch->pending |= (1UL << route);
+    }
+    Os_Port_RestoreInterrupts(key);
+
+    if (current == RTE_ERROR_NO_TASK)
+    {
+        Rte_Error_Route(route, ApiId, 1U);
+    }
+}
+
+/**
+ * @brief Number of routed occurrences of a runtime error since start
+ */
+Std_ReturnType Rte_Error_GetCount(uint8 ErrorId, P2VAR(uint32, AUTOMATIC, RTE_APPL_DATA) Count)
+{
+    uint8 route = (uint8)(ErrorId - RTE_E_DET_RUNTIME_FIRST);
+
+    if (route >= RTE_ERROR_ROUTE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_ERROR_GET_COUNT_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Count == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_ERROR_GET_COUNT_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    *Count = Rte_ErrorTotal[route];
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Make a task the target of the errors reported on its core
+ */
+void Rte_Error_StartTask(TaskType TaskID)
+{
+    CoreIdType core = GetCoreID();
+    uint32 key = Os_Port_DisableInterrupts();
+
+    Rte_ErrorBatch[TaskID].preempted = Rte_ErrorCurrent[core];
+    Rte_ErrorCurrent[core] = (uint8)(TaskID + 1U);
+
+    Os_Port_RestoreInterrupts(key);
+}
+
+/**
+ * @brief Route the errors counted in a task activation
+ */
+void Rte_Error_FlushTask(TaskType TaskID)
+{
+    P2VAR(Rte_ErrorBatchType, AUTOMATIC, RTE_VAR) batch = &Rte_ErrorBatch[TaskID];
+    uint16 count[RTE_ERROR_ROUTE_COUNT];
+    uint8 api[RTE_ERROR_ROUTE_COUNT];
+    uint32 pending;
+    uint8 route;
+    uint32 key;
+
+    /* Close the batch first: errors of the routing itself go to the preempted one */
+    key = Os_Port_DisableInterrupts();
+    Rte_ErrorCurrent[GetCoreID()] = batch->preempted;
+    pending = batch->pending;
+    batch->pending = 0UL;
+    for (route = 0U; route < RTE_ERROR_ROUTE_COUNT; route++)
+    {
+        count[route] = batch->count[route];
+        api[route] = batch->api[route];
+        batch->count[route] = 0U;
+    }
+    Os_Port_RestoreInterrupts(key);
+
+    for (route = 0U; pending != 0UL; route++)
+    {
+        if ((pending & (1UL << route)) != 0UL)
+        {
+            pending &= ~(1UL << route);
+            Rte_Error_Route(route, api[route], count[route]);
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
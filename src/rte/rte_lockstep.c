@@ -0,0 +1,607 @@
+/**
+ * @file    rte_lockstep.c
+ * @brief   RTE - Batched Cross-Core Replication of Explicit Signals
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the replication channels declared in rte_lockstep.h.
+ * The generated configuration (rte_cfg.c) provides the replica table
+ * (source, replica and channel of every replicated signal) and the channel
+ * table (handshake, batch buffers and cores of every channel).
+ *
+ * Batch handshake of one channel:
+ *
+ * | Step                  | Source core                  | Target core                    |
+ * |-----------------------|------------------------------|--------------------------------|
+ * | ack == sequence       | Pack, CRC, copy, sequence++  | -                              |
+ * | ack != sequence       | Skip, signals stay dirty     | Copy, check, unpack, ack = seq |
+ * | CRC or header invalid | Next batch carries all       | Discard, resync++              |
+ *
+ * Implementation Notes:
+ * - The batch buffer in shared memory has exactly one owner at any time,
+ *   so neither side ever sees a half-written batch and no lock spans the
+ *   cores. The DMBs order the batch against the sequence and ack stores
+ * - Dirty sets are updated with Os_Port_CompareAndSwap() only; a write
+ *   between the take of the set and the pack of the signal is sent twice,
+ *   never lost
+ * - Signals are packed from their source with the source's own protocol:
+ *   Rte_Seqlock_Read() for structures, an interrupt-locked copy of at most
+ *   4 bytes for scalars. A torn sequence-lock read leaves the signal dirty
+ *   for the next cycle; a signal never written is not sent
+ * - Replicas are written and read with interrupts disabled, one signal at
+ *   a time, so the lock is bounded by the largest replicated signal
+ * - The CRC is CRC-32 (IEEE 802.3) over the sequence, the mask and the
+ *   payload; the software version uses a 16-entry table (two lookups per
+ *   byte, 64 bytes of constants)
+ * - Channels with equal source and target core (lockstep parts) are packed
+ *   into the staging buffer and unpacked from it on the spot
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Runtime errors to Rte_Error_Report |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Module version 1.8.0               |
+ *
+ * @see rte_lockstep.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_LOCKSTEP_C_VENDOR_ID                43U
+#define RTE_LOCKSTEP_C_SW_MAJOR_VERSION         1U
+#define RTE_LOCKSTEP_C_SW_MINOR_VERSION         8U
+#define RTE_LOCKSTEP_C_SW_PATCH_VERSION         0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_LOCKSTEP_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_lockstep.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_LOCKSTEP_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_LOCKSTEP_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_LOCKSTEP_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_lockstep.c and rte_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+/** @name Header words of a batch @{ */
+#define RTE_LOCKSTEP_SEQUENCE                   0U
+#define RTE_LOCKSTEP_MASK                       1U
+#define RTE_LOCKSTEP_CRC                        2U
+/** @} */
+
+#define RTE_LOCKSTEP_HEADER_SIZE                (RTE_LOCKSTEP_HEADER_WORDS * 4UL)
+
+/** @brief Bits of all replicas of a channel */
+#define RTE_LOCKSTEP_ALL(count)                 (((count) >= 32U) ? 0xFFFFFFFFUL : ((1UL << (count)) - 1UL))
+
+/** @brief Payload words of a signal */
+#define RTE_LOCKSTEP_WORDS(size)                (((uint32)(size) + 3UL) / 4UL)
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+#if !defined(RTE_LOCKSTEP_CRC32)
+/** @brief CRC-32 (reflected polynomial 0xEDB88320) of every nibble */
+STATIC const uint32 Rte_LockstepCrcTable[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+#endif
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC uint32 Rte_Lockstep_Crc(P2CONST(uint8, AUTOMATIC, RTE_VAR) Data, uint32 Length, uint32 Crc);
+STATIC uint32 Rte_Lockstep_BatchCrc(P2CONST(uint32, AUTOMATIC, RTE_VAR) Batch, uint32 PayloadSize);
+STATIC void Rte_Lockstep_MarkDirty(P2VAR(Rte_LockstepTxStateType, AUTOMATIC, RTE_VAR) Tx, uint32 Bits);
+STATIC uint32 Rte_Lockstep_TakeDirty(P2VAR(Rte_LockstepTxStateType, AUTOMATIC, RTE_VAR) Tx);
+STATIC uint32 Rte_Lockstep_PayloadSize(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Mask);
+STATIC uint32 Rte_Lockstep_Pack(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Dirty);
+STATIC void Rte_Lockstep_Unpack(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Mask,
+    P2CONST(uint32, AUTOMATIC, RTE_VAR) Payload);
+STATIC void Rte_Lockstep_Publish(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel);
+STATIC void Rte_Lockstep_TransmitChannel(Rte_LockstepChannelIdType ChannelId);
+STATIC void Rte_Lockstep_ReceiveChannel(Rte_LockstepChannelIdType ChannelId);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Continue a CRC-32 over Length bytes (Crc = 0 starts a new one)
+ */
+STATIC uint32 Rte_Lockstep_Crc(P2CONST(uint8, AUTOMATIC, RTE_VAR) Data, uint32 Length, uint32 Crc)
+{
+#if defined(RTE_LOCKSTEP_CRC32)
+    return RTE_LOCKSTEP_CRC32(Data, Length, Crc);
+#else
+    uint32 crc = ~Crc;
+    uint32 i;
+
+    for (i = 0UL; i < Length; i++)
+    {
+        crc ^= (uint32)Data[i];
+        crc = (crc >> 4) ^ Rte_LockstepCrcTable[crc & 0x0FUL];
+        crc = (crc >> 4) ^ Rte_LockstepCrcTable[crc & 0x0FUL];
+    }
+
+    return ~crc;
+#endif
+}
+
+/**
+ * @brief CRC of a batch: sequence and mask, then the payload
+ */
+STATIC uint32 Rte_Lockstep_BatchCrc(P2CONST(uint32, AUTOMATIC, RTE_VAR) Batch, uint32 PayloadSize)
+{
+    uint32 crc = Rte_Lockstep_Crc((const uint8 *)&Batch[RTE_LOCKSTEP_SEQUENCE], 8UL, 0UL);
+
+    return Rte_Lockstep_Crc((const uint8 *)&Batch[RTE_LOCKSTEP_HEADER_WORDS], PayloadSize, crc);
+}
+
+/**
+ * @brief Add bits to the dirty set of a channel
+ */
+STATIC void Rte_Lockstep_MarkDirty(P2VAR(Rte_LockstepTxStateType, AUTOMATIC, RTE_VAR) Tx, uint32 Bits)
+{
+    uint32 dirty = Tx->dirty;
+
+    while (((dirty & Bits) != Bits) && (Os_Port_CompareAndSwap(&Tx->dirty, dirty, dirty | Bits) == FALSE))
+    {
+        dirty = Tx->dirty;
+    }
+}
+
+/**
+ * @brief Take the dirty set of a channel
+ */
+STATIC uint32 Rte_Lockstep_TakeDirty(P2VAR(Rte_LockstepTxStateType, AUTOMATIC, RTE_VAR) Tx)
+{
+    uint32 dirty;
+
+    do
+    {
+        dirty = Tx->dirty;
+    } while ((dirty != 0UL) && (Os_Port_CompareAndSwap(&Tx->dirty, dirty, 0UL) == FALSE));
+
+    return dirty;
+}
+
+/**
+ * @brief Payload bytes of the signals in Mask
+ */
+STATIC uint32 Rte_Lockstep_PayloadSize(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Mask)
+{
+    uint32 words = 0UL;
+    uint8 i;
+
+    for (i = 0U; i < Channel->count; i++)
+    {
+        if ((Mask & (1UL << i)) != 0UL)
+        {
+            words += RTE_LOCKSTEP_WORDS(Rte_Replica[Channel->first + i].size);
+        }
+    }
+
+    return words * 4UL;
+}
+
+/**
+ * @brief Copy the dirty signals from their sources into the staging payload
+ * @return Mask of the signals packed
+ */
+STATIC uint32 Rte_Lockstep_Pack(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Dirty)
+{
+    P2VAR(uint32, AUTOMATIC, RTE_VAR) payload = &Channel->staging[RTE_LOCKSTEP_HEADER_WORDS];
+    uint32 mask = 0UL;
+    uint8 i;
+
+    for (i = 0U; i < Channel->count; i++)
+    {
+        P2CONST(Rte_ReplicaType, AUTOMATIC, RTE_CONST) replica = &Rte_Replica[Channel->first + i];
+        uint32 bit = 1UL << i;
+        Std_ReturnType result;
+
+        if ((Dirty & bit) == 0UL)
+        {
+            continue;
+        }
+
+        if (replica->source == NULL_PTR)
+        {
+            result = Rte_Seqlock_Read(replica->seqlock, payload);
+        }
+        else
+        {
+            uint32 key = Os_Port_DisableInterrupts();
+            (void)memcpy(payload, (const void *)replica->source, replica->size);
+            Os_Port_RestoreInterrupts(key);
+            result = RTE_E_OK;
+        }
+
+        if (result == RTE_E_OK)
+        {
+            mask |= bit;
+            payload = &payload[RTE_LOCKSTEP_WORDS(replica->size)];
+        }
+        else if (result != RTE_E_NEVER_RECEIVED)
+        {
+            Rte_Lockstep_MarkDirty(Channel->tx, bit);   /* Torn read: next cycle */
+        }
+        else
+        {
+            /* Not written yet: nothing to send */
+        }
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Copy the signals of a checked payload into their replicas
+ */
+STATIC void Rte_Lockstep_Unpack(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel, uint32 Mask,
+    P2CONST(uint32, AUTOMATIC, RTE_VAR) Payload)
+{
+    uint32 words = 0UL;
+    uint8 i;
+
+    for (i = 0U; i < Channel->count; i++)
+    {
+        P2CONST(Rte_ReplicaType, AUTOMATIC, RTE_CONST) replica = &Rte_Replica[Channel->first + i];
+        uint32 key;
+
+        if ((Mask & (1UL << i)) == 0UL)
+        {
+            continue;
+        }
+
+        key = Os_Port_DisableInterrupts();
+        (void)memcpy(replica->replica, &Payload[words], replica->size);
+        Os_Port_RestoreInterrupts(key);
+        words += RTE_LOCKSTEP_WORDS(replica->size);
+    }
+
+    Channel->rx->valid |= Mask;
+}
+
+/**
+ * @brief Hand the batch in the shared buffer over to the target core
+ */
+STATIC void Rte_Lockstep_Publish(P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) Channel)
+{
+    MEMORY_BARRIER();                                   /* Batch written before the sequence */
+    Channel->link->sequence = Channel->tx->sequence;
+    Channel->tx->batches++;
+}
+
+/**
+ * @brief Send the dirty signals of one channel
+ */
+STATIC void Rte_Lockstep_TransmitChannel(Rte_LockstepChannelIdType ChannelId)
+{
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel = &Rte_LockstepChannel[ChannelId];
+    P2VAR(Rte_LockstepTxStateType, AUTOMATIC, RTE_VAR) tx = channel->tx;
+    P2VAR(uint32, AUTOMATIC, RTE_VAR) batch = channel->staging;
+    uint32 resync;
+    uint32 dirty;
+    uint32 mask;
+    uint32 size;
+
+    if (channel->source_core == channel->target_core)
+    {
+        /* Lockstep part: both partitions on this core */
+        mask = Rte_Lockstep_Pack(channel, Rte_Lockstep_TakeDirty(tx));
+        if (mask != 0UL)
+        {
+            Rte_Lockstep_Unpack(channel, mask, &batch[RTE_LOCKSTEP_HEADER_WORDS]);
+            tx->batches++;
+        }
+        return;
+    }
+
+    if ((tx->dma_busy != FALSE) || (channel->link->ack != tx->sequence))
+    {
+        if (tx->dirty != 0UL)
+        {
+            tx->deferred++;
+        }
+        return;
+    }
+
+    resync = channel->link->resync;
+    if (resync != tx->resync_seen)
+    {
+        tx->resync_seen = resync;
+        Rte_Lockstep_MarkDirty(tx, RTE_LOCKSTEP_ALL(channel->count));
+    }
+
+    dirty = Rte_Lockstep_TakeDirty(tx);
+    if (dirty == 0UL)
+    {
+        return;
+    }
+
+    mask = Rte_Lockstep_Pack(channel, dirty);
+    if (mask == 0UL)
+    {
+        return;
+    }
+
+    size = Rte_Lockstep_PayloadSize(channel, mask);
+    tx->sequence++;
+    batch[RTE_LOCKSTEP_SEQUENCE] = tx->sequence;
+    batch[RTE_LOCKSTEP_MASK] = mask;
+    batch[RTE_LOCKSTEP_CRC] = Rte_Lockstep_BatchCrc(batch, size);
+    size += RTE_LOCKSTEP_HEADER_SIZE;
+    tx->bytes += size;
+
+#if defined(RTE_LOCKSTEP_DMA_START)
+    if (size >= RTE_LOCKSTEP_DMA_THRESHOLD)
+    {
+        tx->dma_busy = TRUE;
+        if (RTE_LOCKSTEP_DMA_START(ChannelId, channel->shared, batch, size) == E_OK)
+        {
+            return;                                     /* Published by Rte_Lockstep_DmaComplete() */
+        }
+        tx->dma_busy = FALSE;
+    }
+#endif
+
+    (void)memcpy(channel->shared, batch, size);
+    Rte_Lockstep_Publish(channel);
+}
+
+/**
+ * @brief Check and unpack the pending batch of one channel
+ */
+STATIC void Rte_Lockstep_ReceiveChannel(Rte_LockstepChannelIdType ChannelId)
+{
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel = &Rte_LockstepChannel[ChannelId];
+    P2VAR(Rte_LockstepLinkType, AUTOMATIC, RTE_VAR) link = channel->link;
+    P2VAR(uint32, AUTOMATIC, RTE_VAR) batch = channel->receive;
+    uint32 sequence = link->sequence;
+    uint32 mask;
+    uint32 size = 0UL;
+    boolean valid;
+
+    if (sequence == link->ack)
+    {
+        return;
+    }
+
+    MEMORY_BARRIER();                                   /* Batch read after the sequence */
+    (void)memcpy(batch, channel->shared, RTE_LOCKSTEP_HEADER_SIZE);
+    mask = batch[RTE_LOCKSTEP_MASK];
+    valid = (((mask & ~RTE_LOCKSTEP_ALL(channel->count)) == 0UL) &&
+             (batch[RTE_LOCKSTEP_SEQUENCE] == sequence)) ? TRUE : FALSE;
+    if (valid == TRUE)
+    {
+        size = Rte_Lockstep_PayloadSize(channel, mask);
+        (void)memcpy(&batch[RTE_LOCKSTEP_HEADER_WORDS], &channel->shared[RTE_LOCKSTEP_HEADER_WORDS], size);
+        valid = (batch[RTE_LOCKSTEP_CRC] == Rte_Lockstep_BatchCrc(batch, size)) ? TRUE : FALSE;
+    }
+
+    if (valid == TRUE)
+    {
+        Rte_Lockstep_Unpack(channel, mask, &batch[RTE_LOCKSTEP_HEADER_WORDS]);
+        channel->rx->batches++;
+    }
+    else
+    {
+        channel->rx->crc_errors++;
+        link->resync = link->resync + 1UL;              /* Next batch carries every signal */
+        Rte_Error_Report(RTE_LOCKSTEP_RECEIVE_API_ID, RTE_E_DET_REPLICA_CRC);
+    }
+
+    MEMORY_BARRIER();                                   /* Batch read before it is handed back */
+    link->ack = sequence;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Reset all channels; the first batch carries every signal
+ */
+void Rte_Lockstep_Init(void)
+{
+    Rte_LockstepChannelIdType id;
+
+    for (id = 0U; id < RTE_LOCKSTEP_CHANNEL_COUNT; id++)
+    {
+        P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel = &Rte_LockstepChannel[id];
+
+        channel->link->sequence = 0UL;
+        channel->link->ack = 0UL;
+        channel->link->resync = 0UL;
+        (void)memset(channel->tx, 0, sizeof(Rte_LockstepTxStateType));
+        (void)memset(channel->rx, 0, sizeof(Rte_LockstepRxStateType));
+        channel->tx->dirty = RTE_LOCKSTEP_ALL(channel->count);
+    }
+
+    MEMORY_BARRIER();
+}
+
+/**
+ * @brief Send the signals written since their last batch, for every
+ *        channel leaving the calling core
+ */
+void Rte_Lockstep_Transmit(void)
+{
+    CoreIdType core = GetCoreID();
+    Rte_LockstepChannelIdType id;
+
+    for (id = 0U; id < RTE_LOCKSTEP_CHANNEL_COUNT; id++)
+    {
+        if (Rte_LockstepChannel[id].source_core == core)
+        {
+            Rte_Lockstep_TransmitChannel(id);
+        }
+    }
+}
+
+/**
+ * @brief Check and unpack the pending batch of every channel arriving at
+ *        the calling core
+ */
+void Rte_Lockstep_Receive(void)
+{
+    CoreIdType core = GetCoreID();
+    Rte_LockstepChannelIdType id;
+
+    for (id = 0U; id < RTE_LOCKSTEP_CHANNEL_COUNT; id++)
+    {
+        if ((Rte_LockstepChannel[id].target_core == core) && (Rte_LockstepChannel[id].source_core != core))
+        {
+            Rte_Lockstep_ReceiveChannel(id);
+        }
+    }
+}
+
+/**
+ * @brief Mark a replicated signal as written
+ */
+Std_ReturnType Rte_Lockstep_Update(Rte_ReplicaIdType ReplicaId, Std_ReturnType Result)
+{
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel;
+
+    if (ReplicaId >= RTE_REPLICA_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_UPDATE_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Result == RTE_E_OK)
+    {
+        channel = &Rte_LockstepChannel[Rte_Replica[ReplicaId].channel];
+        Rte_Lockstep_MarkDirty(channel->tx, 1UL << (ReplicaId - channel->first));
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Read the replica of a signal on the reader core
+ */
+Std_ReturnType Rte_Lockstep_Read(Rte_ReplicaIdType ReplicaId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data)
+{
+    P2CONST(Rte_ReplicaType, AUTOMATIC, RTE_CONST) replica;
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel;
+    uint32 key;
+
+    if (ReplicaId >= RTE_REPLICA_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_READ_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_READ_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    replica = &Rte_Replica[ReplicaId];
+    channel = &Rte_LockstepChannel[replica->channel];
+    if ((channel->rx->valid & (1UL << (ReplicaId - channel->first))) == 0UL)
+    {
+        return RTE_E_NEVER_RECEIVED;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    (void)memcpy(Data, replica->replica, replica->size);
+    Os_Port_RestoreInterrupts(key);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Read the counters of a replication channel
+ */
+Std_ReturnType Rte_Lockstep_GetStatus(Rte_LockstepChannelIdType ChannelId,
+    P2VAR(Rte_LockstepStatusType, AUTOMATIC, RTE_APPL_DATA) Status)
+{
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel;
+
+    if (ChannelId >= RTE_LOCKSTEP_CHANNEL_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_GET_STATUS_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Status == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_GET_STATUS_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    channel = &Rte_LockstepChannel[ChannelId];
+    Status->batches = channel->tx->batches;
+    Status->bytes = channel->tx->bytes;
+    Status->deferred = channel->tx->deferred;
+    Status->crc_errors = channel->rx->crc_errors;
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Publish a batch whose DMA transfer has completed
+ */
+void Rte_Lockstep_DmaComplete(Rte_LockstepChannelIdType ChannelId)
+{
+    P2CONST(Rte_LockstepChannelType, AUTOMATIC, RTE_CONST) channel;
+
+    if (ChannelId >= RTE_LOCKSTEP_CHANNEL_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_LOCKSTEP_DMA_COMPLETE_API_ID, RTE_E_DET_PARAM_ID);
+        return;
+    }
+
+    channel = &Rte_LockstepChannel[ChannelId];
+    if (channel->tx->dma_busy != FALSE)
+    {
+        Rte_Lockstep_Publish(channel);
+        channel->tx->dma_busy = FALSE;
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
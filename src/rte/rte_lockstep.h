@@ -0,0 +1,215 @@
+/**
+ * @file    rte_lockstep.h
+ * @brief   RTE - Batched Cross-Core Replication of Explicit Signals
+ * @version 1.6.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * In split-lock mode the safety and the QM partition run on different
+ * cores. Without replication, every read of a cross-core signal on the
+ * reader core is an access to the non-cacheable shared memory (sequence
+ * lock, connection table), and every signal needs its own protection. The
+ * signals of the ECUC container RteReplication are instead carried by a
+ * replication channel per pair of cores:
+ *
+ * | Step                    | Core   | Work                                         |
+ * |-------------------------|--------|----------------------------------------------|
+ * | Rte_Write_*             | writer | Store the signal, set its dirty bit          |
+ * | Rte_Lockstep_Transmit() | writer | Pack the dirty signals, one CRC, one copy    |
+ * | Rte_Lockstep_Receive()  | reader | One copy, check the CRC, unpack the replicas |
+ * | Rte_Read_*              | reader | Copy from the local replica                  |
+ *
+ * A cycle without writes transfers nothing; a cycle with writes transfers
+ * one batch of the signals written since the previous batch, each once,
+ * however often it was written. Batches of at least
+ * RTE_LOCKSTEP_DMA_THRESHOLD bytes are moved by the integrator's DMA
+ * callout, so the writer core does not spend the copy itself.
+ *
+ * A batch that fails its CRC check is discarded and reported as a runtime
+ * error; the replicas keep their last good values and the reader requests
+ * a batch with all signals of the channel. The writer does not overwrite a
+ * batch the reader has not consumed yet; it skips the cycle and sends the
+ * accumulated signals in the next one.
+ *
+ * Lockstep parts run both partitions on one core (OS_CORE_QM equals
+ * OS_CORE_SAFETY). Channels whose source and target core are equal are
+ * copied straight into the replicas by Rte_Lockstep_Transmit(): no shared
+ * memory, no CRC; the lockstep checker covers the copy.
+ *
+ * Task body pattern (one call per core and cycle):
+ * @code
+ * void Task_100ms(void)                // Safety core
+ * {
+ *     Rte_Task_Fill(OS_TASK_100MS);
+ *     ...
+ *     Rte_Task_Flush(OS_TASK_100MS);
+ *     Rte_Lockstep_Transmit();
+ * }
+ *
+ * void Task_QmBackground(void)         // QM core
+ * {
+ *     Rte_Lockstep_Receive();
+ *     ...
+ * }
+ * @endcode
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_RTE_003: Consistent multi-reader access to structured signals across cores
+ * - SR_RTE_006: Corrupted cross-core safety data is detected and never used
+ *
+ * @see rte_lockstep.c
+ * @see rte.h
+ */
+
+#ifndef RTE_LOCKSTEP_H
+#define RTE_LOCKSTEP_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "rte_types.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def RTE_LOCKSTEP_DMA_THRESHOLD
+ * @brief Smallest batch in bytes moved by RTE_LOCKSTEP_DMA_START; smaller
+ *        batches are copied by the CPU, which is cheaper than a DMA setup
+ */
+#ifndef RTE_LOCKSTEP_DMA_THRESHOLD
+    #define RTE_LOCKSTEP_DMA_THRESHOLD          128U
+#endif
+
+/**
+ * @def RTE_LOCKSTEP_DMA_START
+ * @brief Optional integrator callout starting the transfer of a batch
+ * @details Signature: Std_ReturnType Callout(Rte_LockstepChannelIdType Channel,
+ *          volatile void *Dst, const void *Src, uint32 Size). Src lies in
+ *          cacheable RAM of the calling core; the callout cleans its cache
+ *          lines before it starts the transfer. Returns E_OK if the transfer
+ *          was started; the DMA completion interrupt then calls
+ *          Rte_Lockstep_DmaComplete(Channel). On E_NOT_OK the batch is
+ *          copied by the CPU.
+ */
+
+/**
+ * @def RTE_LOCKSTEP_CRC32
+ * @brief Optional integrator callout computing the batch CRC in hardware
+ * @details Signature: uint32 Callout(const uint8 *Data, uint32 Length, uint32 Crc).
+ *          CRC-32 (IEEE 802.3, reflected) continued from Crc; without the
+ *          callout a table-driven software CRC is used.
+ */
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Send the signals written since their last batch, for every
+ *        channel leaving the calling core
+ *
+ * Skips a channel while its previous batch is not consumed or still being
+ * moved by DMA; the signals stay dirty and go with the next batch.
+ *
+ * @serviceID RTE_LOCKSTEP_TRANSMIT_API_ID (0x86)
+ * @reentrancy Non-Reentrant per core
+ * @note Once per cycle, after the writers of the replicated signals
+ */
+extern void Rte_Lockstep_Transmit(void);
+
+/**
+ * @brief Check and unpack the pending batch of every channel arriving at
+ *        the calling core
+ *
+ * @serviceID RTE_LOCKSTEP_RECEIVE_API_ID (0x87)
+ * @reentrancy Non-Reentrant per core
+ * @note Once per cycle, before the readers of the replicated signals
+ */
+extern void Rte_Lockstep_Receive(void);
+
+/**
+ * @brief Mark a replicated signal as written
+ * @param[in] ReplicaId Signal written
+ * @param[in] Result    Result of the write to the signal
+ * @return Result
+ *
+ * Only a successful write (RTE_E_OK) marks the signal. Used by the
+ * generated Rte_Write_* macros of replicated signals.
+ *
+ * @serviceID RTE_LOCKSTEP_UPDATE_API_ID (0x88)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Lockstep_Update(Rte_ReplicaIdType ReplicaId, Std_ReturnType Result);
+
+/**
+ * @brief Read the replica of a signal on the reader core
+ * @param[in]  ReplicaId Signal to read
+ * @param[out] Data      Receives the value (signal size)
+ * @return RTE_E_OK; RTE_E_NEVER_RECEIVED before the first batch carrying
+ *         the signal; RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_LOCKSTEP_READ_API_ID (0x89)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Lockstep_Read(Rte_ReplicaIdType ReplicaId,
+    P2VAR(void, AUTOMATIC, RTE_APPL_DATA) Data);
+
+/**
+ * @brief Read the counters of a replication channel
+ * @param[in]  ChannelId Channel to inspect
+ * @param[out] Status    Receives the counters
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * The counters of the other core's side are as recent as its last write
+ * back to RAM.
+ *
+ * @serviceID RTE_LOCKSTEP_GET_STATUS_API_ID (0x8A)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType Rte_Lockstep_GetStatus(Rte_LockstepChannelIdType ChannelId,
+    P2VAR(Rte_LockstepStatusType, AUTOMATIC, RTE_APPL_DATA) Status);
+
+/**
+ * @brief Publish a batch whose DMA transfer has completed
+ * @param[in] ChannelId Channel of the transfer
+ *
+ * @serviceID RTE_LOCKSTEP_DMA_COMPLETE_API_ID (0x8B)
+ * @note Called from the DMA completion interrupt of RTE_LOCKSTEP_DMA_START
+ */
+extern void Rte_Lockstep_DmaComplete(Rte_LockstepChannelIdType ChannelId);
+
+/**
+ * @brief Reset all channels; the first batch carries every signal
+ * @note RTE internal: called by Rte_Start()
+ */
+extern void Rte_Lockstep_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTE_LOCKSTEP_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
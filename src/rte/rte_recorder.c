@@ -0,0 +1,809 @@
+/**
+ * @file    rte_recorder.c
+ * @brief   RTE - Signal Recorder with Fault Freeze and Replay
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Records the signal groups of the generated channel table
+ * (Rte_RecorderChannel, rte_cfg.c) once per cycle of the recording task
+ * into a RAM ring buffer. The concatenated groups form the image of a
+ * frame; frames are stored as a byte stream:
+ *
+ * | Tag  | Payload                          | Meaning                              |
+ * |------|----------------------------------|--------------------------------------|
+ * | 0xFF | frame number (u32 LE), image     | Full image (key frame)               |
+ * | 0xFE | n (1..255)                       | n frames identical to the previous   |
+ * | 0xFD | tokens covering the image        | Changes against the previous frame   |
+ *
+ * Delta tokens: 0x00..0x7F skip (t + 1) unchanged bytes; 0x80..0xFF are
+ * followed by ((t & 0x7F) + 1) new bytes. Signals that change slowly cost
+ * one repeat byte per frame in which nothing changed at all, and a few
+ * bytes per changed signal otherwise.
+ *
+ * Implementation Notes:
+ * - A key frame is written every RTE_RECORDER_KEYFRAME_INTERVAL frames and
+ *   its position kept in a small index. The export starts at the oldest
+ *   indexed key frame that has not been overwritten yet
+ * - A run of identical frames extends the count of the previous repeat tag
+ *   in place, so idle periods cost one byte per 255 frames
+ * - Cost per cycle: one memcpy() per channel, one memcmp() of the image
+ *   and, for changed frames, one pass over the image. The image size is
+ *   bounded at compile time and the longest cycle is measured with the
+ *   core cycle counter against RTE_RECORDER_BUDGET_TICKS
+ * - The recorder runs in the highest-priority task of its core. Flush
+ *   blocks of recorded groups are generated as locked when the recording
+ *   task has the higher priority, so a frame never contains a half-written
+ *   group
+ * - All recorder data is in RTE_RECORDER_SECTION, which the startup code
+ *   does not clear. Rte_Recorder_Init() keeps a frozen recording of the
+ *   same channel layout, so the history before a fault that ended in a
+ *   reset can be exported afterwards
+ * - Replay (RTE_RECORDER_REPLAY, host builds): each cycle decodes one
+ *   frame, compares the output channels with the values the software has
+ *   produced and then writes the input channels into the global buffers.
+ *   The flushes of the input groups are suppressed meanwhile (rte.c). The
+ *   outputs of the first frame stem from before the replay and are not
+ *   compared
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Module version 1.5.0 (events)      |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Module version 1.6.0               |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Runtime errors to Rte_Error_Report |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Module version 1.8.0               |
+ *
+ * @see rte.h
+ * @see tools/rte/rte_recorder.py
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_RECORDER_C_VENDOR_ID                43U
+#define RTE_RECORDER_C_SW_MAJOR_VERSION         1U
+#define RTE_RECORDER_C_SW_MINOR_VERSION         8U
+#define RTE_RECORDER_C_SW_PATCH_VERSION         0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_RECORDER_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_recorder.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_RECORDER_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_RECORDER_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_RECORDER_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_recorder.c and rte_types.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+/** @name Frame tags @{ */
+#define RTE_RECORDER_TAG_KEYFRAME               0xFFU
+#define RTE_RECORDER_TAG_REPEAT                 0xFEU
+#define RTE_RECORDER_TAG_DELTA                  0xFDU
+/** @} */
+
+/** @name Delta tokens @{ */
+#define RTE_RECORDER_TOKEN_LITERAL              0x80U   /**< Set: new bytes follow */
+#define RTE_RECORDER_TOKEN_MAX_RUN              128U    /**< Bytes covered by one token */
+/** @} */
+
+#define RTE_RECORDER_REPEAT_MAX                 255U
+
+/** @brief "RTER" little endian; also marks valid recorder data after reset */
+#define RTE_RECORDER_MAGIC                      0x52455452UL
+#define RTE_RECORDER_FORMAT_VERSION             1U
+#define RTE_RECORDER_HEADER_SIZE                28UL
+
+/** @brief Upper bound of one encoded frame (a delta alternating 1 changed / 1 unchanged byte) */
+#define RTE_RECORDER_MAX_FRAME_SIZE             (6UL + ((3UL * RTE_RECORDER_IMAGE_SIZE) / 2UL))
+
+/** @brief Largest image Rte_Recorder_Cycle() is dimensioned for */
+#define RTE_RECORDER_MAX_IMAGE_SIZE             256U
+
+#define RTE_RECORDER_INDEX(pos)                 ((pos) & (RTE_RECORDER_BUFFER_SIZE - 1UL))
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Export start point
+ */
+typedef struct
+{
+    uint32 position;                    /**< Stream position of the key frame tag */
+    uint32 frame;                       /**< Frame number of the key frame */
+} Rte_RecorderKeyframeType;
+
+/**
+ * @brief Recorder state; positions are free-running stream offsets
+ */
+typedef struct
+{
+    uint32 magic;                                   /**< RTE_RECORDER_MAGIC once initialised */
+    uint32 layout_id;                               /**< RTE_RECORDER_LAYOUT_ID of the content */
+    volatile Rte_RecorderStateType state;
+    uint32 write_pos;                               /**< Next stream position */
+    uint32 frames;                                  /**< Frames recorded */
+    uint32 keyframes;                               /**< Key frames written */
+    uint32 repeat_pos;                              /**< Position of the open repeat tag */
+    boolean repeat_open;                            /**< Last frame ended with a repeat tag */
+    uint32 post_trigger;                            /**< Frames left until frozen */
+    uint32 trigger_frame;                           /**< Frame of the freeze request */
+    uint16 fault_id;                                /**< Fault of the freeze request */
+    uint32 max_ticks;                               /**< Longest recording cycle */
+    Rte_RecorderKeyframeType keyframe[RTE_RECORDER_KEYFRAME_SLOTS];
+    uint8 previous[RTE_RECORDER_IMAGE_SIZE];        /**< Image of the last frame */
+    uint8 buffer[RTE_RECORDER_BUFFER_SIZE];         /**< Encoded frames */
+} Rte_RecorderType;
+
+/*==================================================================================================
+*                                     COMPILE-TIME CHECKS
+==================================================================================================*/
+
+STATIC_ASSERT((RTE_RECORDER_BUFFER_SIZE & (RTE_RECORDER_BUFFER_SIZE - 1UL)) == 0UL,
+              "RTE_RECORDER_BUFFER_SIZE must be a power of two");
+STATIC_ASSERT((RTE_RECORDER_KEYFRAME_SLOTS & (RTE_RECORDER_KEYFRAME_SLOTS - 1UL)) == 0UL,
+              "RTE_RECORDER_KEYFRAME_SLOTS must be a power of two");
+STATIC_ASSERT(RTE_RECORDER_IMAGE_SIZE <= RTE_RECORDER_MAX_IMAGE_SIZE,
+              "Recorder image exceeds the cycle budget");
+STATIC_ASSERT((RTE_RECORDER_KEYFRAME_INTERVAL * RTE_RECORDER_MAX_FRAME_SIZE) <= RTE_RECORDER_BUFFER_SIZE,
+              "Recorder buffer cannot hold one key frame interval");
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC VAR_SECTION(RTE_RECORDER_SECTION) Rte_RecorderType Rte_Recorder;
+
+/** @brief Image of the current frame */
+STATIC uint8 Rte_Recorder_Image[RTE_RECORDER_IMAGE_SIZE];
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+STATIC P2CONST(uint8, RTE_VAR, RTE_APPL_DATA) Rte_Replay_Data = NULL_PTR;
+STATIC uint32 Rte_Replay_Size = 0UL;
+STATIC uint32 Rte_Replay_Pos = 0UL;
+STATIC uint32 Rte_Replay_Repeat = 0UL;
+STATIC boolean Rte_Replay_Compare = FALSE;
+STATIC uint32 Rte_Replay_Mismatches = 0UL;
+STATIC uint32 Rte_Replay_FirstMismatch = 0UL;
+#endif
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC void Rte_Recorder_Put(uint8 Byte);
+STATIC void Rte_Recorder_PutN(P2CONST(uint8, AUTOMATIC, RTE_VAR) Data, uint32 Length);
+STATIC void Rte_Recorder_PutDelta(void);
+STATIC void Rte_Recorder_Encode(void);
+STATIC boolean Rte_Recorder_ExportStart(P2VAR(Rte_RecorderKeyframeType, AUTOMATIC, RTE_VAR) Start);
+STATIC void Rte_Recorder_PutLe32(P2VAR(uint8, AUTOMATIC, RTE_VAR) Dst, uint32 Value);
+#if (RTE_RECORDER_REPLAY == STD_ON)
+STATIC uint32 Rte_Recorder_GetLe32(P2CONST(uint8, AUTOMATIC, RTE_APPL_DATA) Src);
+STATIC boolean Rte_Recorder_DecodeFrame(void);
+STATIC void Rte_Recorder_ReplayFrame(void);
+#endif
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Append one byte to the stream
+ */
+STATIC void Rte_Recorder_Put(uint8 Byte)
+{
+    Rte_Recorder.buffer[RTE_RECORDER_INDEX(Rte_Recorder.write_pos)] = Byte;
+    Rte_Recorder.write_pos++;
+}
+
+/**
+ * @brief Append Length bytes to the stream, at most two copies
+ */
+STATIC void Rte_Recorder_PutN(P2CONST(uint8, AUTOMATIC, RTE_VAR) Data, uint32 Length)
+{
+    uint32 index = RTE_RECORDER_INDEX(Rte_Recorder.write_pos);
+    uint32 first = RTE_RECORDER_BUFFER_SIZE - index;
+
+    if (first >= Length)
+    {
+        (void)memcpy(&Rte_Recorder.buffer[index], Data, Length);
+    }
+    else
+    {
+        (void)memcpy(&Rte_Recorder.buffer[index], Data, first);
+        (void)memcpy(&Rte_Recorder.buffer[0], &Data[first], Length - first);
+    }
+    Rte_Recorder.write_pos += Length;
+}
+
+/**
+ * @brief Encode the difference between the current and the previous image
+ */
+STATIC void Rte_Recorder_PutDelta(void)
+{
+    uint32 i = 0UL;
+
+    while (i < RTE_RECORDER_IMAGE_SIZE)
+    {
+        boolean same = (Rte_Recorder_Image[i] == Rte_Recorder.previous[i]) ? TRUE : FALSE;
+        uint32 run = 1UL;
+
+        while (((i + run) < RTE_RECORDER_IMAGE_SIZE) && (run < RTE_RECORDER_TOKEN_MAX_RUN) &&
+               (((Rte_Recorder_Image[i + run] == Rte_Recorder.previous[i + run]) ? TRUE : FALSE) == same))
+        {
+            run++;
+        }
+
+        if (same == TRUE)
+        {
+            Rte_Recorder_Put((uint8)(run - 1UL));
+        }
+        else
+        {
+            Rte_Recorder_Put((uint8)(RTE_RECORDER_TOKEN_LITERAL | (run - 1UL)));
+            Rte_Recorder_PutN(&Rte_Recorder_Image[i], run);
+        }
+        i += run;
+    }
+}
+
+/**
+ * @brief Append the current image as key, repeat or delta frame
+ */
+STATIC void Rte_Recorder_Encode(void)
+{
+    if ((Rte_Recorder.frames % RTE_RECORDER_KEYFRAME_INTERVAL) == 0UL)
+    {
+        P2VAR(Rte_RecorderKeyframeType, AUTOMATIC, RTE_VAR) slot =
+            &Rte_Recorder.keyframe[Rte_Recorder.keyframes & (RTE_RECORDER_KEYFRAME_SLOTS - 1UL)];
+        uint8 frame[4];
+
+        slot->position = Rte_Recorder.write_pos;
+        slot->frame = Rte_Recorder.frames;
+        Rte_Recorder.keyframes++;
+
+        Rte_Recorder_PutLe32(frame, Rte_Recorder.frames);
+        Rte_Recorder_Put(RTE_RECORDER_TAG_KEYFRAME);
+        Rte_Recorder_PutN(frame, 4UL);
+        Rte_Recorder_PutN(Rte_Recorder_Image, RTE_RECORDER_IMAGE_SIZE);
+        Rte_Recorder.repeat_open = FALSE;
+    }
+    else if (memcmp(Rte_Recorder_Image, Rte_Recorder.previous, RTE_RECORDER_IMAGE_SIZE) == 0)
+    {
+        uint32 count = RTE_RECORDER_INDEX(Rte_Recorder.repeat_pos + 1UL);
+
+        if ((Rte_Recorder.repeat_open == TRUE) && (Rte_Recorder.buffer[count] < RTE_RECORDER_REPEAT_MAX))
+        {
+            Rte_Recorder.buffer[count]++;
+        }
+        else
+        {
+            Rte_Recorder.repeat_pos = Rte_Recorder.write_pos;
+            Rte_Recorder_Put(RTE_RECORDER_TAG_REPEAT);
+            Rte_Recorder_Put(1U);
+            Rte_Recorder.repeat_open = TRUE;
+        }
+    }
+    else
+    {
+        Rte_Recorder_Put(RTE_RECORDER_TAG_DELTA);
+        Rte_Recorder_PutDelta();
+        Rte_Recorder.repeat_open = FALSE;
+    }
+
+    (void)memcpy(Rte_Recorder.previous, Rte_Recorder_Image, RTE_RECORDER_IMAGE_SIZE);
+}
+
+/**
+ * @brief Oldest indexed key frame that is still complete in the buffer
+ */
+STATIC boolean Rte_Recorder_ExportStart(P2VAR(Rte_RecorderKeyframeType, AUTOMATIC, RTE_VAR) Start)
+{
+    uint32 k = (Rte_Recorder.keyframes > RTE_RECORDER_KEYFRAME_SLOTS) ?
+               (Rte_Recorder.keyframes - RTE_RECORDER_KEYFRAME_SLOTS) : 0UL;
+
+    for (; k < Rte_Recorder.keyframes; k++)
+    {
+        P2CONST(Rte_RecorderKeyframeType, AUTOMATIC, RTE_VAR) slot =
+            &Rte_Recorder.keyframe[k & (RTE_RECORDER_KEYFRAME_SLOTS - 1UL)];
+
+        if ((Rte_Recorder.write_pos - slot->position) <= RTE_RECORDER_BUFFER_SIZE)
+        {
+            *Start = *slot;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Store a 32-bit value little endian
+ */
+STATIC void Rte_Recorder_PutLe32(P2VAR(uint8, AUTOMATIC, RTE_VAR) Dst, uint32 Value)
+{
+    Dst[0] = (uint8)Value;
+    Dst[1] = (uint8)(Value >> 8U);
+    Dst[2] = (uint8)(Value >> 16U);
+    Dst[3] = (uint8)(Value >> 24U);
+}
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+/**
+ * @brief Load a 32-bit little endian value
+ */
+STATIC uint32 Rte_Recorder_GetLe32(P2CONST(uint8, AUTOMATIC, RTE_APPL_DATA) Src)
+{
+    return (uint32)Src[0] | ((uint32)Src[1] << 8U) | ((uint32)Src[2] << 16U) | ((uint32)Src[3] << 24U);
+}
+
+/**
+ * @brief Decode the next frame of the replay into Rte_Recorder.previous
+ * @return FALSE at the end of the recording or on malformed data
+ */
+STATIC boolean Rte_Recorder_DecodeFrame(void)
+{
+    uint8 tag;
+
+    if (Rte_Replay_Repeat > 0UL)
+    {
+        Rte_Replay_Repeat--;
+        return TRUE;
+    }
+
+    if (Rte_Replay_Pos >= Rte_Replay_Size)
+    {
+        return FALSE;
+    }
+
+    tag = Rte_Replay_Data[Rte_Replay_Pos];
+    Rte_Replay_Pos++;
+
+    if (tag == RTE_RECORDER_TAG_KEYFRAME)
+    {
+        if ((Rte_Replay_Size - Rte_Replay_Pos) < (4UL + RTE_RECORDER_IMAGE_SIZE))
+        {
+            return FALSE;
+        }
+        (void)memcpy(Rte_Recorder.previous, &Rte_Replay_Data[Rte_Replay_Pos + 4UL], RTE_RECORDER_IMAGE_SIZE);
+        Rte_Replay_Pos += 4UL + RTE_RECORDER_IMAGE_SIZE;
+    }
+    else if (tag == RTE_RECORDER_TAG_REPEAT)
+    {
+        if ((Rte_Replay_Pos >= Rte_Replay_Size) || (Rte_Replay_Data[Rte_Replay_Pos] == 0U))
+        {
+            return FALSE;
+        }
+        Rte_Replay_Repeat = (uint32)Rte_Replay_Data[Rte_Replay_Pos] - 1UL;
+        Rte_Replay_Pos++;
+    }
+    else if (tag == RTE_RECORDER_TAG_DELTA)
+    {
+        uint32 i = 0UL;
+
+        while (i < RTE_RECORDER_IMAGE_SIZE)
+        {
+            uint8 token;
+            uint32 run;
+
+            if (Rte_Replay_Pos >= Rte_Replay_Size)
+            {
+                return FALSE;
+            }
+            token = Rte_Replay_Data[Rte_Replay_Pos];
+            Rte_Replay_Pos++;
+            run = ((uint32)token & (RTE_RECORDER_TOKEN_LITERAL - 1U)) + 1UL;
+            if ((i + run) > RTE_RECORDER_IMAGE_SIZE)
+            {
+                return FALSE;
+            }
+            if ((token & RTE_RECORDER_TOKEN_LITERAL) != 0U)
+            {
+                if ((Rte_Replay_Size - Rte_Replay_Pos) < run)
+                {
+                    return FALSE;
+                }
+                (void)memcpy(&Rte_Recorder.previous[i], &Rte_Replay_Data[Rte_Replay_Pos], run);
+                Rte_Replay_Pos += run;
+            }
+            i += run;
+        }
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Replay one frame: compare the outputs, then inject the inputs
+ */
+STATIC void Rte_Recorder_ReplayFrame(void)
+{
+    boolean mismatch = FALSE;
+    uint32 offset = 0UL;
+    uint8 channel;
+
+    if (Rte_Recorder_DecodeFrame() == FALSE)
+    {
+        Rte_Recorder.state = RTE_RECORDER_REPLAY_DONE;
+        return;
+    }
+
+    for (channel = 0U; channel < RTE_RECORDER_CHANNEL_COUNT; channel++)
+    {
+        P2CONST(Rte_RecorderChannelType, AUTOMATIC, RTE_CONST) cfg = &Rte_RecorderChannel[channel];
+
+        if ((cfg->flags & RTE_RECORDER_INPUT) != 0U)
+        {
+            (void)memcpy(cfg->data, &Rte_Recorder.previous[offset], cfg->size);
+        }
+        else if ((Rte_Replay_Compare == TRUE) &&
+                 (memcmp(cfg->data, &Rte_Recorder.previous[offset], cfg->size) != 0))
+        {
+            mismatch = TRUE;
+        }
+        else
+        {
+            /* Output reproduced */
+        }
+        offset += cfg->size;
+    }
+
+    if (mismatch == TRUE)
+    {
+        if (Rte_Replay_Mismatches == 0UL)
+        {
+            Rte_Replay_FirstMismatch = Rte_Recorder.frames;
+        }
+        Rte_Replay_Mismatches++;
+    }
+    Rte_Replay_Compare = TRUE;
+    Rte_Recorder.frames++;
+}
+#endif
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Start recording; keeps a frozen recording from before a reset
+ */
+void Rte_Recorder_Init(void)
+{
+    if ((Rte_Recorder.magic == RTE_RECORDER_MAGIC) && (Rte_Recorder.layout_id == RTE_RECORDER_LAYOUT_ID) &&
+        ((Rte_Recorder.state == RTE_RECORDER_FROZEN) || (Rte_Recorder.state == RTE_RECORDER_TRIGGERED)))
+    {
+        /* Post-trigger phase cut short by the reset: keep what was recorded */
+        Rte_Recorder.state = RTE_RECORDER_FROZEN;
+    }
+    else
+    {
+        Rte_Recorder_Release();
+    }
+}
+
+/**
+ * @brief Record one frame of the configured channels (replay: inject one)
+ */
+void Rte_Recorder_Cycle(void)
+{
+    Rte_RecorderStateType state = Rte_Recorder.state;
+    uint32 start;
+    uint32 ticks;
+    uint32 offset = 0UL;
+    uint8 channel;
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+    if (state == RTE_RECORDER_REPLAYING)
+    {
+        Rte_Recorder_ReplayFrame();
+        return;
+    }
+#endif
+
+    if ((state != RTE_RECORDER_RECORDING) && (state != RTE_RECORDER_TRIGGERED))
+    {
+        return;
+    }
+
+    start = Os_Port_GetTimestamp();
+
+    for (channel = 0U; channel < RTE_RECORDER_CHANNEL_COUNT; channel++)
+    {
+        (void)memcpy(&Rte_Recorder_Image[offset], Rte_RecorderChannel[channel].data,
+                     Rte_RecorderChannel[channel].size);
+        offset += Rte_RecorderChannel[channel].size;
+    }
+
+    Rte_Recorder_Encode();
+    Rte_Recorder.frames++;
+
+    if (state == RTE_RECORDER_TRIGGERED)
+    {
+        Rte_Recorder.post_trigger--;
+        if (Rte_Recorder.post_trigger == 0UL)
+        {
+            Rte_Recorder.state = RTE_RECORDER_FROZEN;
+        }
+    }
+
+    ticks = Os_Port_GetTimestamp() - start;
+    if (ticks > Rte_Recorder.max_ticks)
+    {
+        Rte_Recorder.max_ticks = ticks;
+        if (ticks > RTE_RECORDER_BUDGET_TICKS)
+        {
+            Rte_Error_Report(RTE_RECORDER_CYCLE_API_ID, RTE_E_DET_RECORDER_BUDGET);
+        }
+    }
+}
+
+/**
+ * @brief Freeze the recording after RTE_RECORDER_POST_TRIGGER_FRAMES frames
+ */
+void Rte_Recorder_Freeze(uint16 FaultId)
+{
+    uint32 key = Os_Port_DisableInterrupts();
+
+    if (Rte_Recorder.state == RTE_RECORDER_RECORDING)
+    {
+        Rte_Recorder.fault_id = FaultId;
+        Rte_Recorder.trigger_frame = Rte_Recorder.frames;
+        Rte_Recorder.post_trigger = RTE_RECORDER_POST_TRIGGER_FRAMES;
+        Rte_Recorder.state = (RTE_RECORDER_POST_TRIGGER_FRAMES > 0UL) ? RTE_RECORDER_TRIGGERED
+                                                                      : RTE_RECORDER_FROZEN;
+    }
+
+    Os_Port_RestoreInterrupts(key);
+}
+
+/**
+ * @brief Discard a frozen recording and record again
+ */
+void Rte_Recorder_Release(void)
+{
+    Rte_Recorder.state = RTE_RECORDER_IDLE;
+    MEMORY_BARRIER();
+
+    Rte_Recorder.write_pos = 0UL;
+    Rte_Recorder.frames = 0UL;
+    Rte_Recorder.keyframes = 0UL;
+    Rte_Recorder.repeat_pos = 0UL;
+    Rte_Recorder.repeat_open = FALSE;
+    Rte_Recorder.post_trigger = 0UL;
+    Rte_Recorder.trigger_frame = 0UL;
+    Rte_Recorder.fault_id = 0U;
+    Rte_Recorder.max_ticks = 0UL;
+    Rte_Recorder.layout_id = RTE_RECORDER_LAYOUT_ID;
+    Rte_Recorder.magic = RTE_RECORDER_MAGIC;
+
+    MEMORY_BARRIER();
+    Rte_Recorder.state = RTE_RECORDER_RECORDING;
+}
+
+/**
+ * @brief Size of the export image of a frozen recording
+ */
+Std_ReturnType Rte_Recorder_GetExportSize(P2VAR(uint32, AUTOMATIC, RTE_APPL_DATA) Size)
+{
+    Rte_RecorderKeyframeType start;
+
+    if (Size == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_RECORDER_GET_EXPORT_SIZE_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    if ((Rte_Recorder.state != RTE_RECORDER_FROZEN) || (Rte_Recorder_ExportStart(&start) == FALSE))
+    {
+        return RTE_E_NO_DATA;
+    }
+
+    *Size = RTE_RECORDER_HEADER_SIZE + (Rte_Recorder.write_pos - start.position);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Copy a part of the export image of a frozen recording
+ */
+Std_ReturnType Rte_Recorder_Export(uint32 Offset,
+    P2VAR(uint8, AUTOMATIC, RTE_APPL_DATA) Buffer, uint32 Length)
+{
+    Rte_RecorderKeyframeType start;
+    uint8 header[RTE_RECORDER_HEADER_SIZE];
+    uint32 size;
+    uint32 done = 0UL;
+
+    if (Buffer == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_RECORDER_EXPORT_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    if ((Rte_Recorder.state != RTE_RECORDER_FROZEN) || (Rte_Recorder_ExportStart(&start) == FALSE))
+    {
+        return RTE_E_NO_DATA;
+    }
+
+    size = RTE_RECORDER_HEADER_SIZE + (Rte_Recorder.write_pos - start.position);
+    if ((Length > size) || (Offset > (size - Length)))
+    {
+        return RTE_E_INVALID;
+    }
+
+    if (Offset < RTE_RECORDER_HEADER_SIZE)
+    {
+        Rte_Recorder_PutLe32(&header[0], RTE_RECORDER_MAGIC);
+        header[4] = RTE_RECORDER_FORMAT_VERSION;
+        header[5] = (uint8)RTE_RECORDER_CHANNEL_COUNT;
+        header[6] = (uint8)RTE_RECORDER_IMAGE_SIZE;
+        header[7] = (uint8)(RTE_RECORDER_IMAGE_SIZE >> 8U);
+        Rte_Recorder_PutLe32(&header[8], RTE_RECORDER_LAYOUT_ID);
+        Rte_Recorder_PutLe32(&header[12], start.frame);
+        Rte_Recorder_PutLe32(&header[16], Rte_Recorder.trigger_frame);
+        Rte_Recorder_PutLe32(&header[20], Rte_Recorder.frames - start.frame);
+        header[24] = (uint8)Rte_Recorder.fault_id;
+        header[25] = (uint8)(Rte_Recorder.fault_id >> 8U);
+        header[26] = 0U;
+        header[27] = 0U;
+
+        done = RTE_RECORDER_HEADER_SIZE - Offset;
+        if (done > Length)
+        {
+            done = Length;
+        }
+        (void)memcpy(Buffer, &header[Offset], done);
+    }
+
+    while (done < Length)
+    {
+        uint32 index = RTE_RECORDER_INDEX(start.position + ((Offset + done) - RTE_RECORDER_HEADER_SIZE));
+        uint32 chunk = RTE_RECORDER_BUFFER_SIZE - index;
+
+        if (chunk > (Length - done))
+        {
+            chunk = Length - done;
+        }
+        (void)memcpy(&Buffer[done], &Rte_Recorder.buffer[index], chunk);
+        done += chunk;
+    }
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Read the recorder state and counters
+ */
+Std_ReturnType Rte_Recorder_GetStatus(P2VAR(Rte_RecorderStatusType, AUTOMATIC, RTE_APPL_DATA) Status)
+{
+    if (Status == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_RECORDER_GET_STATUS_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    Status->state = Rte_Recorder.state;
+    Status->frames = Rte_Recorder.frames;
+    Status->trigger_frame = Rte_Recorder.trigger_frame;
+    Status->max_cycles = Rte_Recorder.max_ticks;
+    Status->fault_id = Rte_Recorder.fault_id;
+#if (RTE_RECORDER_REPLAY == STD_ON)
+    Status->mismatches = Rte_Replay_Mismatches;
+    Status->first_mismatch_frame = Rte_Replay_FirstMismatch;
+#else
+    Status->mismatches = 0UL;
+    Status->first_mismatch_frame = 0UL;
+#endif
+
+    return RTE_E_OK;
+}
+
+#if (RTE_RECORDER_REPLAY == STD_ON)
+/**
+ * @brief Replay an export image from the next Rte_Recorder_Cycle() on
+ */
+Std_ReturnType Rte_Recorder_StartReplay(P2CONST(uint8, AUTOMATIC, RTE_APPL_DATA) Data, uint32 Size)
+{
+    if (Data == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_RECORDER_START_REPLAY_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    if ((Size <= RTE_RECORDER_HEADER_SIZE) ||
+        (Rte_Recorder_GetLe32(&Data[0]) != RTE_RECORDER_MAGIC) ||
+        (Data[4] != RTE_RECORDER_FORMAT_VERSION) ||
+        (Data[5] != (uint8)RTE_RECORDER_CHANNEL_COUNT) ||
+        (((uint32)Data[6] | ((uint32)Data[7] << 8U)) != RTE_RECORDER_IMAGE_SIZE) ||
+        (Rte_Recorder_GetLe32(&Data[8]) != RTE_RECORDER_LAYOUT_ID) ||
+        (Data[RTE_RECORDER_HEADER_SIZE] != RTE_RECORDER_TAG_KEYFRAME))
+    {
+        return RTE_E_INVALID;
+    }
+
+    Rte_Recorder.state = RTE_RECORDER_IDLE;
+    MEMORY_BARRIER();
+
+    Rte_Replay_Data = Data;
+    Rte_Replay_Size = Size;
+    Rte_Replay_Pos = RTE_RECORDER_HEADER_SIZE;
+    Rte_Replay_Repeat = 0UL;
+    Rte_Replay_Compare = FALSE;
+    Rte_Replay_Mismatches = 0UL;
+    Rte_Replay_FirstMismatch = 0UL;
+    Rte_Recorder.frames = Rte_Recorder_GetLe32(&Data[12]);
+    Rte_Recorder.trigger_frame = Rte_Recorder_GetLe32(&Data[16]);
+    Rte_Recorder.fault_id = (uint16)((uint32)Data[24] | ((uint32)Data[25] << 8U));
+
+    MEMORY_BARRIER();
+    Rte_Recorder.state = RTE_RECORDER_REPLAYING;
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Whether a global buffer is an input injected by the replay
+ */
+boolean Rte_Recorder_IsReplayed(P2CONST(void, AUTOMATIC, RTE_VAR) Address)
+{
+    uint8 channel;
+
+    if (Rte_Recorder.state != RTE_RECORDER_REPLAYING)
+    {
+        return FALSE;
+    }
+
+    for (channel = 0U; channel < RTE_RECORDER_CHANNEL_COUNT; channel++)
+    {
+        P2CONST(uint8, AUTOMATIC, RTE_VAR) first = (const uint8 *)Rte_RecorderChannel[channel].data;
+
+        if (((Rte_RecorderChannel[channel].flags & RTE_RECORDER_INPUT) != 0U) &&
+            ((const uint8 *)Address >= first) &&
+            ((const uint8 *)Address < &first[Rte_RecorderChannel[channel].size]))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+#endif
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
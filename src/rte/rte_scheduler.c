@@ -0,0 +1,189 @@
+/**
+ * @file    rte_scheduler.c
+ * @brief   RTE - Event-Triggered Runnable Activation
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Activation of the event-triggered runnables declared in rte.h. The
+ * generated configuration (rte_cfg.c) provides the event table (runnable
+ * and pending bit of every DATA-RECEIVED-EVENT and DATA-RECEIVE-ERROR-EVENT)
+ * and the runnable table (pending set and mapped task).
+ *
+ * Coalescing:
+ *
+ * | Step              | Pending set of the runnable | Armed flag of the task                    |
+ * |-------------------|-----------------------------|-------------------------------------------|
+ * | Rte_Event_Raise() | bit set                     | 0 -> 1 by the first event: ActivateTask() |
+ * | Rte_Task_Fill()   | -                           | 1 -> 0 (Rte_Event_StartTask())            |
+ * | Rte_Event_Take()  | swapped with 0              | -                                         |
+ *
+ * An event whose bit is already pending, or that finds the task armed,
+ * costs one compare-and-swap and no activation. A task that was re-armed
+ * is activated again by the next event, so an event raised after the take
+ * of its runnable is never lost; it runs in the next activation.
+ *
+ * Implementation Notes:
+ * - Pending sets and armed flags are updated with Os_Port_CompareAndSwap()
+ *   only, so events can be raised from any core and from interrupt level
+ *   without disabling interrupts. Both live in RTE_SHARED_SECTION
+ * - Invariant: a non-empty pending set implies an outstanding activation,
+ *   or a running activation that has not taken the set yet. The runnable
+ *   whose set turns non-empty arms the task; the task clears the flag
+ *   before it takes any set (barrier in Rte_Event_StartTask())
+ * - An event task is activated at most once per burst, so its activation
+ *   limit (max_activations) is 1. A failed activation (inter-core mailbox
+ *   full) disarms the task again and is reported as a runtime error; the
+ *   next event retries
+ * - A task re-armed after a take may run once with nothing pending; the
+ *   task body skips runnables with an empty set
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Module version 1.6.0               |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Runtime errors to Rte_Error_Report |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Module version 1.8.0               |
+ *
+ * @see rte.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_SCHEDULER_C_VENDOR_ID               43U
+#define RTE_SCHEDULER_C_SW_MAJOR_VERSION        1U
+#define RTE_SCHEDULER_C_SW_MINOR_VERSION        8U
+#define RTE_SCHEDULER_C_SW_PATCH_VERSION        0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_SCHEDULER_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_scheduler.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_SCHEDULER_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_SCHEDULER_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_SCHEDULER_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_scheduler.c and rte_types.h"
+#endif
+
+#if (OS_TASK_COUNT > 32U)
+    #error "RTE_EVENT_TASK_MASK holds at most 32 tasks"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief 1 while an activation of the task is outstanding (raised, task not started yet) */
+STATIC VAR_SECTION(RTE_SHARED_SECTION) volatile uint32 Rte_EventArmed[OS_TASK_COUNT];
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Raise an event: mark it pending and activate the runnable's task
+ */
+void Rte_Event_Raise(Rte_EventIdType EventId)
+{
+    P2CONST(Rte_EventType, AUTOMATIC, RTE_CONST) event;
+    P2CONST(Rte_EventRunnableType, AUTOMATIC, RTE_CONST) runnable;
+    uint32 pending;
+
+    if (EventId >= RTE_EVENT_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_EVENT_RAISE_API_ID, RTE_E_DET_PARAM_ID);
+        return;
+    }
+
+    event = &Rte_Event[EventId];
+    runnable = &Rte_EventRunnable[event->runnable];
+
+    /* Set the bit unless it is pending already */
+    pending = *runnable->pending;
+    while ((pending & event->mask) == 0UL)
+    {
+        if (Os_Port_CompareAndSwap(runnable->pending, pending, pending | event->mask) == TRUE)
+        {
+            break;
+        }
+        pending = *runnable->pending;
+    }
+
+    /* Only the event that made the set non-empty can owe an activation */
+    if ((pending == 0UL) &&
+        (Os_Port_CompareAndSwap(&Rte_EventArmed[runnable->task], 0UL, 1UL) == TRUE))
+    {
+        if (ActivateTask((TaskType)runnable->task) != E_OK)
+        {
+            Rte_EventArmed[runnable->task] = 0UL;
+            Rte_Error_Report(RTE_EVENT_RAISE_API_ID, RTE_E_DET_EVENT_ACTIVATION);
+        }
+    }
+}
+
+/**
+ * @brief Take the events raised for a runnable since its last take
+ */
+uint32 Rte_Event_Take(Rte_RunnableIdType RunnableId)
+{
+    P2VAR(volatile uint32, AUTOMATIC, RTE_VAR) set;
+    uint32 pending;
+
+    if (RunnableId >= RTE_RUNNABLE_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_EVENT_TAKE_API_ID, RTE_E_DET_PARAM_ID);
+        return 0UL;
+    }
+
+    set = Rte_EventRunnable[RunnableId].pending;
+    do
+    {
+        pending = *set;
+    } while ((pending != 0UL) && (Os_Port_CompareAndSwap(set, pending, 0UL) == FALSE));
+
+    return pending;
+}
+
+/**
+ * @brief Re-arm the activation of a task by its events
+ */
+void Rte_Event_StartTask(TaskType TaskID)
+{
+    if ((RTE_EVENT_TASK_MASK & (1UL << TaskID)) != 0UL)
+    {
+        Rte_EventArmed[TaskID] = 0UL;
+        MEMORY_BARRIER();                               /* Disarm before the pending sets are taken */
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
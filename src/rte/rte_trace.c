@@ -0,0 +1,374 @@
+/**
+ * @file    rte_trace.c
+ * @brief   RTE - Data-Flow Timing of Cause-Effect Chains
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the tracer declared in rte_trace.h. The generated
+ * configuration (rte_cfg.c) provides the hop table (input hop, chain and
+ * writer task of every traced signal group), the chain table (first and
+ * last hop, budget) and per task the mask of the hops it writes.
+ *
+ * Per hop:
+ *
+ * | Data    | Written by                             | Content                                    |
+ * |---------|----------------------------------------|--------------------------------------------|
+ * | Stamp   | Rte_Trace_Flush() of the writer        | Publication and origin of the global group |
+ * | Capture | Rte_Trace_Fill() / Flush of the writer | Input stamp of the running activation      |
+ * | Status  | Rte_Trace_Flush() of the writer        | Latency and age distributions              |
+ *
+ * Implementation Notes:
+ * - A task only visits the hops of its mask (Rte_TraceTaskHops); a task
+ *   writing no traced group costs one load per fill and flush
+ * - Stamps, captures and distributions are accessed with interrupts
+ *   disabled: a stamp is two words read by another task of the core, and
+ *   the distributions are read by Rte_Trace_GetHopStatus(). The lock covers
+ *   one hop at a time
+ * - Hops are visited in identifier order, i.e. in data-flow order within a
+ *   chain, so a hop whose input is written by the same task finds the
+ *   input already published by the same flush
+ * - Samples are converted to microseconds once, with one division; the
+ *   counters saturate at 0xFFFFFFFF
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see rte_trace.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "rte.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define RTE_TRACE_C_VENDOR_ID                   43U
+#define RTE_TRACE_C_SW_MAJOR_VERSION            1U
+#define RTE_TRACE_C_SW_MINOR_VERSION            8U
+#define RTE_TRACE_C_SW_PATCH_VERSION            0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (RTE_TRACE_C_VENDOR_ID != RTE_VENDOR_ID)
+    #error "rte_trace.c and rte_types.h have different vendor IDs"
+#endif
+
+#if ((RTE_TRACE_C_SW_MAJOR_VERSION != RTE_SW_MAJOR_VERSION) || \
+     (RTE_TRACE_C_SW_MINOR_VERSION != RTE_SW_MINOR_VERSION) || \
+     (RTE_TRACE_C_SW_PATCH_VERSION != RTE_SW_PATCH_VERSION))
+    #error "Software version mismatch between rte_trace.c and rte_types.h"
+#endif
+
+#if (RTE_TRACE_HOP_COUNT > 32U)
+    #error "Rte_TraceTaskHops holds at most 32 hops"
+#endif
+
+#if ((RTE_TRACE_HISTOGRAM_BINS == 0U) || (RTE_TRACE_BIN_US == 0UL) || (RTE_TRACE_TICKS_PER_US == 0UL))
+    #error "RTE_TRACE_HISTOGRAM_BINS, RTE_TRACE_BIN_US and RTE_TRACE_TICKS_PER_US must not be 0"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (RTE_DEV_ERROR_DETECT == STD_ON)
+    #define RTE_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(RTE_MODULE_ID, RTE_INSTANCE_ID, (api), (err)))
+#else
+    #define RTE_REPORT_ERROR(api, err)          ((void)0)
+#endif
+
+#define RTE_TRACE_COUNT_MAX                     0xFFFFFFFFUL
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct Rte_TraceStampType
+ * @brief Time stamps of the data of a hop (global group or task input)
+ */
+typedef struct
+{
+    uint32 published;                   /**< Flush of the data */
+    uint32 origin;                      /**< Start of the chain's first task for this data */
+    boolean valid;                      /**< FALSE until the hop is published once */
+} Rte_TraceStampType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Stamps of the global groups of the hops */
+STATIC Rte_TraceStampType Rte_TraceStamp[RTE_TRACE_HOP_COUNT];
+
+/** @brief Input stamps of the running activation of each hop's writer */
+STATIC Rte_TraceStampType Rte_TraceCapture[RTE_TRACE_HOP_COUNT];
+
+STATIC Rte_TraceHopStatusType Rte_TraceHopStatus[RTE_TRACE_HOP_COUNT];
+
+/** @brief End-to-end samples above the budget, per chain */
+STATIC uint32 Rte_TraceViolations[RTE_TRACE_CHAIN_COUNT];
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+STATIC uint32 Rte_Trace_Sample(P2VAR(Rte_TraceStatsType, AUTOMATIC, RTE_VAR) Stats, uint32 Ticks);
+STATIC void Rte_Trace_ClearStats(P2VAR(Rte_TraceStatsType, AUTOMATIC, RTE_VAR) Stats);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Add one sample to a distribution
+ * @return The sample in microseconds
+ */
+STATIC uint32 Rte_Trace_Sample(P2VAR(Rte_TraceStatsType, AUTOMATIC, RTE_VAR) Stats, uint32 Ticks)
+{
+    uint32 us = Ticks / RTE_TRACE_TICKS_PER_US;
+    uint32 bin = us / RTE_TRACE_BIN_US;
+
+    if (bin >= RTE_TRACE_HISTOGRAM_BINS)
+    {
+        bin = RTE_TRACE_HISTOGRAM_BINS - 1U;
+    }
+
+    if ((Stats->samples == 0UL) || (us < Stats->min_us))
+    {
+        Stats->min_us = us;
+    }
+    if (us > Stats->max_us)
+    {
+        Stats->max_us = us;
+    }
+    if (Stats->samples < RTE_TRACE_COUNT_MAX)
+    {
+        Stats->samples++;
+    }
+    if (Stats->histogram[bin] < RTE_TRACE_COUNT_MAX)
+    {
+        Stats->histogram[bin]++;
+    }
+
+    return us;
+}
+
+/**
+ * @brief Clear a distribution
+ */
+STATIC void Rte_Trace_ClearStats(P2VAR(Rte_TraceStatsType, AUTOMATIC, RTE_VAR) Stats)
+{
+    uint8 bin;
+
+    Stats->min_us = 0UL;
+    Stats->max_us = 0UL;
+    Stats->samples = 0UL;
+    for (bin = 0U; bin < RTE_TRACE_HISTOGRAM_BINS; bin++)
+    {
+        Stats->histogram[bin] = 0UL;
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Take over the input stamps of the hops written by a task
+ */
+void Rte_Trace_Fill(TaskType TaskID)
+{
+    uint32 hops = Rte_TraceTaskHops[TaskID];
+    uint32 now;
+    uint8 hop;
+
+    if (hops == 0UL)
+    {
+        return;
+    }
+
+    now = Os_Port_GetTimestamp();
+    for (hop = 0U; hops != 0UL; hop++)
+    {
+        P2CONST(Rte_TraceHopType, AUTOMATIC, RTE_CONST) config = &Rte_TraceHop[hop];
+        P2VAR(Rte_TraceStampType, AUTOMATIC, RTE_VAR) capture = &Rte_TraceCapture[hop];
+        uint32 key;
+
+        if ((hops & (1UL << hop)) == 0UL)
+        {
+            continue;
+        }
+        hops &= ~(1UL << hop);
+
+        key = Os_Port_DisableInterrupts();
+        if (config->input == RTE_NO_TRACE_HOP)
+        {
+            /* The data enters the chain with this activation */
+            capture->published = now;
+            capture->origin = now;
+            capture->valid = TRUE;
+        }
+        else if (Rte_TraceHop[config->input].task != TaskID)
+        {
+            *capture = Rte_TraceStamp[config->input];
+        }
+        else
+        {
+            /* Input written by this activation; taken over in the flush */
+        }
+        Os_Port_RestoreInterrupts(key);
+    }
+}
+
+/**
+ * @brief Publish and measure the hops written by a task
+ */
+void Rte_Trace_Flush(TaskType TaskID)
+{
+    uint32 hops = Rte_TraceTaskHops[TaskID];
+    uint32 now;
+    uint8 hop;
+
+    if (hops == 0UL)
+    {
+        return;
+    }
+
+    now = Os_Port_GetTimestamp();
+    for (hop = 0U; hops != 0UL; hop++)
+    {
+        P2CONST(Rte_TraceHopType, AUTOMATIC, RTE_CONST) config = &Rte_TraceHop[hop];
+        P2CONST(Rte_TraceChainType, AUTOMATIC, RTE_CONST) chain = &Rte_TraceChain[config->chain];
+        P2VAR(Rte_TraceStampType, AUTOMATIC, RTE_VAR) capture = &Rte_TraceCapture[hop];
+        P2VAR(Rte_TraceHopStatusType, AUTOMATIC, RTE_VAR) status = &Rte_TraceHopStatus[hop];
+        uint32 age;
+        uint32 key;
+
+        if ((hops & (1UL << hop)) == 0UL)
+        {
+            continue;
+        }
+        hops &= ~(1UL << hop);
+
+        key = Os_Port_DisableInterrupts();
+        if ((config->input != RTE_NO_TRACE_HOP) && (Rte_TraceHop[config->input].task == TaskID))
+        {
+            *capture = Rte_TraceStamp[config->input];   /* Published earlier in this flush */
+        }
+
+        if (capture->valid == TRUE)
+        {
+            Rte_TraceStamp[hop].published = now;
+            Rte_TraceStamp[hop].origin = capture->origin;
+            Rte_TraceStamp[hop].valid = TRUE;
+
+            (void)Rte_Trace_Sample(&status->latency, now - capture->published);
+            age = Rte_Trace_Sample(&status->age, now - capture->origin);
+            if ((chain->last == hop) && (age > chain->budget_us) &&
+                (Rte_TraceViolations[config->chain] < RTE_TRACE_COUNT_MAX))
+            {
+                Rte_TraceViolations[config->chain]++;
+            }
+        }
+        Os_Port_RestoreInterrupts(key);
+    }
+}
+
+/**
+ * @brief Read the measurements of a hop
+ */
+Std_ReturnType Rte_Trace_GetHopStatus(Rte_TraceHopIdType HopId,
+    P2VAR(Rte_TraceHopStatusType, AUTOMATIC, RTE_APPL_DATA) Status)
+{
+    uint32 key;
+
+    if (HopId >= RTE_TRACE_HOP_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_TRACE_GET_HOP_STATUS_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Status == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_TRACE_GET_HOP_STATUS_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    *Status = Rte_TraceHopStatus[HopId];
+    Os_Port_RestoreInterrupts(key);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Read the end-to-end measurements of a chain
+ */
+Std_ReturnType Rte_Trace_GetChainStatus(Rte_TraceChainIdType ChainId,
+    P2VAR(Rte_TraceChainStatusType, AUTOMATIC, RTE_APPL_DATA) Status)
+{
+    P2CONST(Rte_TraceChainType, AUTOMATIC, RTE_CONST) chain;
+    uint32 key;
+
+    if (ChainId >= RTE_TRACE_CHAIN_COUNT)
+    {
+        RTE_REPORT_ERROR(RTE_TRACE_GET_CHAIN_STATUS_API_ID, RTE_E_DET_PARAM_ID);
+        return RTE_E_INVALID;
+    }
+
+    if (Status == NULL_PTR)
+    {
+        RTE_REPORT_ERROR(RTE_TRACE_GET_CHAIN_STATUS_API_ID, RTE_E_DET_PARAM_POINTER);
+        return RTE_E_INVALID;
+    }
+
+    chain = &Rte_TraceChain[ChainId];
+    key = Os_Port_DisableInterrupts();
+    Status->end_to_end = Rte_TraceHopStatus[chain->last].age;
+    Status->violations = Rte_TraceViolations[ChainId];
+    Os_Port_RestoreInterrupts(key);
+    Status->budget_us = chain->budget_us;
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Clear the measurements of all hops and chains
+ */
+void Rte_Trace_Reset(void)
+{
+    uint8 index;
+    uint32 key;
+
+    for (index = 0U; index < RTE_TRACE_HOP_COUNT; index++)
+    {
+        key = Os_Port_DisableInterrupts();
+        Rte_Trace_ClearStats(&Rte_TraceHopStatus[index].latency);
+        Rte_Trace_ClearStats(&Rte_TraceHopStatus[index].age);
+        Os_Port_RestoreInterrupts(key);
+    }
+
+    for (index = 0U; index < RTE_TRACE_CHAIN_COUNT; index++)
+    {
+        Rte_TraceViolations[index] = 0UL;
+    }
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
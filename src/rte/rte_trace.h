@@ -0,0 +1,213 @@
+/**
+ * @file    rte_trace.h
+ * @brief   RTE - Data-Flow Timing of Cause-Effect Chains
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Measures how old the data is that leaves a cause-effect chain, and which
+ * hop of the chain makes it old. A chain (ECUC RteTimingChain) is a list of
+ * implicit signal groups in data-flow order, e.g. the driver input sampled
+ * by VehicleState, the torque request of TorqueArb and the brake torque of
+ * BrakeBlend. Every group of the chain is a hop; the writer task of each
+ * hop reads the group of the previous hop.
+ *
+ * Every publication of a hop (Rte_Task_Flush() of its writer) carries two
+ * time stamps: when it was published and when the data it derives from
+ * entered the chain (origin). The task reading the hop takes both over at
+ * its Rte_Task_Fill() and passes the origin on with its own output:
+ *
+ * | Quantity (per hop) | Measured at the flush of the hop as           |
+ * |--------------------|-----------------------------------------------|
+ * | Latency            | Now - publication of the input hop as read    |
+ * | Age                | Now - origin (start of the first hop's task)  |
+ *
+ * The latency of a hop is the wait for the reading task plus its response
+ * time, so the hop with the largest latency is the one to optimise. The
+ * age of the last hop is the end-to-end age of the chain, checked against
+ * the chain budget. Both are kept as minimum, maximum and histogram in
+ * microseconds.
+ *
+ * Implementation Notes:
+ * - The time stamps are Os_Port_GetTimestamp() ticks of one core. Implicit
+ *   groups are only read on the core of their writer, so a chain never
+ *   leaves its core
+ * - The input stamps are taken before the fill copies and the output stamps
+ *   published after the flush copies. A writer preempting in between can
+ *   only make the measured age larger than the real one, never smaller
+ * - Hops of one chain in the same task (e.g. VehicleState and TorqueArb in
+ *   Task_10ms) pass their origin on within the flush; their latency is the
+ *   time between the two publications, i.e. close to 0
+ * - A hop whose input was never published is not sampled and not published
+ * - A chain ends at the publication of its last hop, not at an actuator:
+ *   the time from that flush to the output stage reading the group is not
+ *   part of the end-to-end age
+ *
+ * Safety Classification: ASIL-D (measurement only; no influence on the data)
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_RTE_007: Measured end-to-end age of the cause-effect chains
+ *
+ * @see rte_trace.c
+ * @see rte.h
+ */
+
+#ifndef RTE_TRACE_H
+#define RTE_TRACE_H
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "rte_types.h"
+#include "os_port.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def RTE_TRACE
+ * @brief STD_ON: Rte_Task_Fill() / Rte_Task_Flush() time-stamp the chain hops
+ */
+#ifndef RTE_TRACE
+    #define RTE_TRACE                           STD_ON
+#endif
+
+/**
+ * @def RTE_TRACE_TICKS_PER_US
+ * @brief Os_Port_GetTimestamp() ticks per microsecond
+ */
+#define RTE_TRACE_TICKS_PER_US                  OS_PORT_TICKS_PER_US
+
+/**
+ * @def RTE_TRACE_HISTOGRAM_BINS
+ * @brief Histogram bins per measured quantity; the last bin also counts
+ *        everything beyond the range
+ */
+#ifndef RTE_TRACE_HISTOGRAM_BINS
+    #define RTE_TRACE_HISTOGRAM_BINS            16U
+#endif
+
+/**
+ * @def RTE_TRACE_BIN_US
+ * @brief Width of a histogram bin in microseconds
+ */
+#ifndef RTE_TRACE_BIN_US
+    #define RTE_TRACE_BIN_US                    1000UL
+#endif
+
+/* ===============================================================================================
+ *                                       TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/**
+ * @struct Rte_TraceStatsType
+ * @brief Distribution of one measured quantity in microseconds
+ */
+typedef struct
+{
+    uint32 min_us;                                      /**< Smallest sample */
+    uint32 max_us;                                      /**< Largest sample */
+    uint32 samples;                                     /**< Samples since start or reset */
+    uint32 histogram[RTE_TRACE_HISTOGRAM_BINS];         /**< Bin n: [n, n + 1) * RTE_TRACE_BIN_US */
+} Rte_TraceStatsType;
+
+/**
+ * @struct Rte_TraceHopStatusType
+ * @brief Measurements of one hop (Rte_Trace_GetHopStatus)
+ */
+typedef struct
+{
+    Rte_TraceStatsType latency;         /**< Input publication to output publication */
+    Rte_TraceStatsType age;             /**< Chain origin to output publication */
+} Rte_TraceHopStatusType;
+
+/**
+ * @struct Rte_TraceChainStatusType
+ * @brief End-to-end measurements of one chain (Rte_Trace_GetChainStatus)
+ */
+typedef struct
+{
+    Rte_TraceStatsType end_to_end;      /**< Age at the last hop */
+    uint32 budget_us;                   /**< Configured budget */
+    uint32 violations;                  /**< End-to-end samples above the budget */
+} Rte_TraceChainStatusType;
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Read the measurements of a hop
+ * @param[in]  HopId  Hop to inspect (RTE_TRACE_HOP_*)
+ * @param[out] Status Receives the measurements
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_TRACE_GET_HOP_STATUS_API_ID (0x8E)
+ * @reentrancy Reentrant; consistent when called on the core of the chain
+ */
+extern Std_ReturnType Rte_Trace_GetHopStatus(Rte_TraceHopIdType HopId,
+    P2VAR(Rte_TraceHopStatusType, AUTOMATIC, RTE_APPL_DATA) Status);
+
+/**
+ * @brief Read the end-to-end measurements of a chain
+ * @param[in]  ChainId Chain to inspect (RTE_TRACE_CHAIN_*)
+ * @param[out] Status  Receives the measurements
+ * @return RTE_E_OK, or RTE_E_INVALID on invalid parameters
+ *
+ * @serviceID RTE_TRACE_GET_CHAIN_STATUS_API_ID (0x8F)
+ * @reentrancy Reentrant; consistent when called on the core of the chain
+ */
+extern Std_ReturnType Rte_Trace_GetChainStatus(Rte_TraceChainIdType ChainId,
+    P2VAR(Rte_TraceChainStatusType, AUTOMATIC, RTE_APPL_DATA) Status);
+
+/**
+ * @brief Clear the measurements of all hops and chains
+ *
+ * The time stamps of the published data are kept, so the next samples
+ * are valid.
+ *
+ * @serviceID RTE_TRACE_RESET_API_ID (0x90)
+ * @reentrancy Non-Reentrant
+ */
+extern void Rte_Trace_Reset(void);
+
+/**
+ * @brief Take over the input stamps of the hops written by a task
+ * @param[in] TaskID Task starting its activation
+ * @note RTE internal: called by Rte_Task_Fill() before the copies
+ */
+extern void Rte_Trace_Fill(TaskType TaskID);
+
+/**
+ * @brief Publish and measure the hops written by a task
+ * @param[in] TaskID Task ending its activation
+ * @note RTE internal: called by Rte_Task_Flush() after the copies
+ */
+extern void Rte_Trace_Flush(TaskType TaskID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTE_TRACE_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,466 @@
+/**
+ * @file    rte_types.h
+ * @brief   RTE - Common Types, Status Codes and Configuration Structures
+ * @version 1.8.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Types shared by the RTE implementation (rte.c) and the generated RTE
+ * configuration (rte_cfg.h / rte_cfg.c):
+ *
+ * - AUTOSAR RTE status codes (Std_ReturnType values)
+ * - Implicit communication copy plan: for every task, the blocks copied from
+ *   the global signal buffers into the task-local buffer at task start
+ *   (fill) and back at task end (flush)
+ * - Sequence-lock ports: single writer, any number of readers on any core
+ * - Connection table: explicit scalar signals read on another core
+ * - Replication: explicit signals copied to the reader core in batches
+ * - Queues: queued (event) data elements, single- or multi-producer
+ * - Recorder: recorded signal groups and recorder status
+ * - Events: data received / receive error events of event-triggered
+ *   runnables and their pending-event sets
+ * - Error routing: DET and DEM reports of the RTE runtime errors
+ * - Timing chains: traced signal groups (hops) of the cause-effect chains
+ *
+ * A copy block is one contiguous byte range. The configuration lays out the
+ * signals of one writer as a group (one structure) and the task-local
+ * buffers with the same group types, so a block covers a whole group or a
+ * contiguous part of it and is copied with a single memcpy().
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ * | 1.1.0   | 2026-10-16 | BSW Team        | Sequence-lock ports                |
+ * | 1.2.0   | 2026-10-16 | BSW Team        | Connection table                   |
+ * | 1.3.0   | 2026-10-16 | BSW Team        | Queued communication               |
+ * | 1.4.0   | 2026-10-16 | BSW Team        | Recorder                           |
+ * | 1.5.0   | 2026-10-16 | BSW Team        | Events, queue event triggers       |
+ * | 1.6.0   | 2026-10-16 | BSW Team        | Replication channels               |
+ * | 1.7.0   | 2026-10-16 | BSW Team        | Error routing table                |
+ * | 1.8.0   | 2026-10-16 | BSW Team        | Timing chains                      |
+ *
+ * @see rte.h
+ * @see rte_cfg.h
+ */
+
+#ifndef RTE_TYPES_H
+#define RTE_TYPES_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define RTE_VENDOR_ID                           43U
+#define RTE_MODULE_ID                           2U      /**< AUTOSAR RTE */
+#define RTE_INSTANCE_ID                         0U
+
+#define RTE_SW_MAJOR_VERSION                    1U
+#define RTE_SW_MINOR_VERSION                    8U
+#define RTE_SW_PATCH_VERSION                    0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+#include "os_types.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def RTE_CACHE_LINE_SIZE
+ * @brief Alignment separating the producer and consumer side of a queue
+ */
+#ifndef RTE_CACHE_LINE_SIZE
+    #define RTE_CACHE_LINE_SIZE                 PLATFORM_CACHE_LINE_SIZE
+#endif
+
+/* ===============================================================================================
+ *                                    RTE STATUS CODES
+ * =============================================================================================== */
+
+/** @name AUTOSAR RTE status codes @{ */
+#define RTE_E_OK                                ((Std_ReturnType)0U)
+#define RTE_E_INVALID                           ((Std_ReturnType)1U)
+#define RTE_E_COM_STOPPED                       ((Std_ReturnType)128U)
+#define RTE_E_TIMEOUT                           ((Std_ReturnType)129U)
+#define RTE_E_LIMIT                             ((Std_ReturnType)130U)
+#define RTE_E_NO_DATA                           ((Std_ReturnType)131U)
+#define RTE_E_NEVER_RECEIVED                    ((Std_ReturnType)133U)
+#define RTE_E_UNCONNECTED                       ((Std_ReturnType)134U)
+#define RTE_E_OUT_OF_RANGE                      ((Std_ReturnType)137U)
+#define RTE_E_LOST_DATA                         ((Std_ReturnType)64U)   /**< Overlay flag */
+/** @} */
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @name Copy block flags @{ */
+#define RTE_COPY_LOCKED                         0x01U   /**< Copy with interrupts disabled */
+/** @} */
+
+/**
+ * @struct Rte_CopyBlockType
+ * @brief One contiguous range of the implicit communication copy plan
+ *
+ * For fill blocks dst is in the task-local buffer and src in the global
+ * buffer; for flush blocks the direction is reversed.
+ *
+ * RTE_COPY_LOCKED is set by the generator when a task of higher priority
+ * on the same core accesses the other end of the block, i.e. when the copy
+ * can be preempted by a conflicting copy. Copies that cannot be preempted
+ * by a conflicting copy run without any lock.
+ */
+typedef struct
+{
+    P2VAR(void, TYPEDEF, RTE_VAR) dst;      /**< Destination of the copy */
+    P2CONST(void, TYPEDEF, RTE_VAR) src;    /**< Source of the copy */
+    uint16 size;                            /**< Length in bytes */
+    uint8  flags;                           /**< RTE_COPY_* */
+} Rte_CopyBlockType;
+
+/**
+ * @struct Rte_TaskCopyPlanType
+ * @brief Implicit communication copy plan of one task
+ */
+typedef struct
+{
+    P2CONST(Rte_CopyBlockType, TYPEDEF, RTE_CONST) fill;    /**< Global -> local at task start */
+    P2CONST(Rte_CopyBlockType, TYPEDEF, RTE_CONST) flush;   /**< Local -> global at task end */
+    uint8 fill_count;                                       /**< Entries in fill */
+    uint8 flush_count;                                      /**< Entries in flush */
+} Rte_TaskCopyPlanType;
+
+/** @brief Identifier of a sequence-lock port (index into Rte_SeqlockPort) */
+typedef uint8 Rte_SeqlockPortIdType;
+
+/**
+ * @struct Rte_SeqlockStateType
+ * @brief Run-time state of a sequence-lock port
+ *
+ * Latched sequence counter: the writer increments it twice per update and
+ * rewrites the copy readers are not directed to. Even: readers use copy 0,
+ * odd: copy 1. Values 0 and 1 mean that no update has completed yet.
+ */
+typedef struct
+{
+    volatile uint32 sequence;           /**< Written by the writer only */
+} Rte_SeqlockStateType;
+
+/**
+ * @struct Rte_SeqlockPortType
+ * @brief Sequence-lock port configuration
+ */
+typedef struct
+{
+    P2VAR(Rte_SeqlockStateType, TYPEDEF, RTE_VAR) state;   /**< Sequence counter */
+    P2VAR(void, TYPEDEF, RTE_VAR) copy[2];                  /**< The two data copies */
+    uint16 size;                                            /**< Data size in bytes */
+} Rte_SeqlockPortType;
+
+/** @brief Identifier of a connection (index into Rte_Connection) */
+typedef uint8 Rte_ConnectionIdType;
+
+/**
+ * @struct Rte_ConnectionType
+ * @brief Explicit scalar signal exchanged across cores
+ */
+typedef struct
+{
+    P2VAR(volatile void, TYPEDEF, RTE_VAR) data;   /**< Signal variable (RTE_SHARED_SECTION) */
+    uint8 size;                                     /**< 1, 2 or 4 bytes */
+} Rte_ConnectionType;
+
+/** @brief Identifier of a replicated signal (index into Rte_Replica) */
+typedef uint8 Rte_ReplicaIdType;
+
+/** @brief Identifier of a replication channel (index into Rte_LockstepChannel) */
+typedef uint8 Rte_LockstepChannelIdType;
+
+/** @brief Header of a replication batch in 32-bit words: sequence, mask, CRC */
+#define RTE_LOCKSTEP_HEADER_WORDS               3U
+
+/**
+ * @struct Rte_ReplicaType
+ * @brief Explicit signal replicated to the reader core
+ *
+ * The source is the writer's signal: the signal variable of a scalar, or
+ * the sequence-lock port of a structure (source NULL_PTR). The replica is
+ * the copy the readers on the other core read.
+ */
+typedef struct
+{
+    P2CONST(volatile void, TYPEDEF, RTE_VAR) source;   /**< Signal variable, NULL_PTR: sequence-lock port */
+    P2VAR(void, TYPEDEF, RTE_VAR) replica;              /**< Copy on the reader core */
+    uint16 size;                                        /**< Signal size in bytes */
+    Rte_SeqlockPortIdType seqlock;                      /**< Source port if source is NULL_PTR */
+    Rte_LockstepChannelIdType channel;                  /**< Channel carrying the signal */
+} Rte_ReplicaType;
+
+/**
+ * @struct Rte_LockstepLinkType
+ * @brief Handshake of a replication channel (RTE_SHARED_SECTION)
+ *
+ * The source core owns the batch buffer while ack equals sequence and
+ * publishes a batch by incrementing sequence; the target core hands the
+ * buffer back by setting ack to sequence. Incrementing resync requests a
+ * batch with every signal of the channel.
+ */
+typedef struct
+{
+    volatile uint32 sequence;           /**< Last published batch (source core) */
+    volatile uint32 ack;                /**< Last consumed batch (target core) */
+    volatile uint32 resync;             /**< Full refresh requests (target core) */
+} Rte_LockstepLinkType;
+
+/**
+ * @struct Rte_LockstepTxStateType
+ * @brief Source core side of a replication channel
+ */
+typedef struct
+{
+    volatile uint32 dirty;              /**< Signals written since their last batch (bit = replica - first) */
+    volatile boolean dma_busy;          /**< Batch transfer by DMA in progress */
+    uint32 sequence;                    /**< Sequence of the last batch built */
+    uint32 resync_seen;                 /**< resync of the link at the last full refresh */
+    uint32 batches;                     /**< Batches published */
+    uint32 bytes;                       /**< Batch bytes transferred */
+    uint32 deferred;                    /**< Cycles skipped because the target had not consumed */
+} Rte_LockstepTxStateType;
+
+/**
+ * @struct Rte_LockstepRxStateType
+ * @brief Target core side of a replication channel
+ */
+typedef struct
+{
+    uint32 valid;                       /**< Replicas received at least once (bit = replica - first) */
+    uint32 batches;                     /**< Batches accepted */
+    uint32 crc_errors;                  /**< Batches rejected by the CRC or header check */
+} Rte_LockstepRxStateType;
+
+/**
+ * @struct Rte_LockstepChannelType
+ * @brief Replication channel from one core to another
+ *
+ * A batch is the header (RTE_LOCKSTEP_HEADER_WORDS) followed by the
+ * signals whose bit is set in its mask, in replica order, each padded to a
+ * multiple of 4 bytes. The three batch buffers hold the largest batch: the
+ * staging buffer on the source core, the shared buffer in
+ * RTE_SHARED_SECTION and the receive buffer on the target core.
+ */
+typedef struct
+{
+    P2VAR(Rte_LockstepLinkType, TYPEDEF, RTE_VAR) link;    /**< Handshake (shared) */
+    P2VAR(uint32, TYPEDEF, RTE_VAR) shared;                 /**< Batch buffer (shared) */
+    P2VAR(Rte_LockstepTxStateType, TYPEDEF, RTE_VAR) tx;   /**< Source core state */
+    P2VAR(uint32, TYPEDEF, RTE_VAR) staging;                /**< Batch being built (source core) */
+    P2VAR(Rte_LockstepRxStateType, TYPEDEF, RTE_VAR) rx;   /**< Target core state */
+    P2VAR(uint32, TYPEDEF, RTE_VAR) receive;                /**< Batch being checked (target core) */
+    Rte_ReplicaIdType first;                                /**< First replica of the channel */
+    uint8 count;                                            /**< Replicas, at most 32 */
+    CoreIdType source_core;                                 /**< Core of the writers */
+    CoreIdType target_core;                                 /**< Core of the readers */
+} Rte_LockstepChannelType;
+
+/**
+ * @struct Rte_LockstepStatusType
+ * @brief Counters of one replication channel (Rte_Lockstep_GetStatus)
+ */
+typedef struct
+{
+    uint32 batches;                     /**< Batches published by the source core */
+    uint32 bytes;                       /**< Batch bytes transferred */
+    uint32 deferred;                    /**< Cycles the source core had to skip */
+    uint32 crc_errors;                  /**< Batches rejected by the target core */
+} Rte_LockstepStatusType;
+
+/** @brief Identifier of an event (index into Rte_Event) */
+typedef uint8 Rte_EventIdType;
+
+/** @brief No event configured */
+#define RTE_NO_EVENT                            ((Rte_EventIdType)0xFFU)
+
+/** @brief Identifier of an event-triggered runnable (index into Rte_EventRunnable) */
+typedef uint8 Rte_RunnableIdType;
+
+/**
+ * @struct Rte_EventType
+ * @brief Event configuration: the runnable it starts and its pending bit
+ */
+typedef struct
+{
+    Rte_RunnableIdType runnable;        /**< Runnable started by the event */
+    uint32 mask;                        /**< Bit of the event in the runnable's pending set */
+} Rte_EventType;
+
+/**
+ * @struct Rte_EventRunnableType
+ * @brief Event-triggered runnable
+ *
+ * Events raised while the runnable has not run yet only add their bit to
+ * the pending set, so a burst of events costs one task activation. The
+ * runnable takes the whole set at once (Rte_Event_Take()).
+ */
+typedef struct
+{
+    P2VAR(volatile uint32, TYPEDEF, RTE_VAR) pending;  /**< Events raised since the last take */
+    uint8 task;                                         /**< TaskType of the mapped task */
+} Rte_EventRunnableType;
+
+/** @brief Identifier of a queue (index into Rte_Queue) */
+typedef uint8 Rte_QueueIdType;
+
+/**
+ * @struct Rte_QueueStateType
+ * @brief Run-time state of a queue
+ *
+ * Positions are free-running and wrap modulo 2^32; the slot of a position
+ * is (position & (length - 1)). The producer and the consumer fields are
+ * on separate cache lines so the two sides never write the same line.
+ */
+typedef struct
+{
+    volatile uint32 tail ALIGNED(RTE_CACHE_LINE_SIZE);  /**< Next position to write (producers) */
+    volatile uint32 overflows;                          /**< Elements rejected because the queue was full */
+    volatile uint32 head ALIGNED(RTE_CACHE_LINE_SIZE);  /**< Next position to read (consumer) */
+    uint32 overflows_seen;                              /**< overflows at the last receive */
+} Rte_QueueStateType;
+
+/**
+ * @struct Rte_QueueType
+ * @brief Queue configuration
+ *
+ * Single-producer queues (all senders in one task) publish elements through
+ * tail alone. Multi-producer queues reserve a position with a
+ * compare-and-swap on tail and publish each slot through its sequence
+ * number, so a sender preempted between reservation and publication never
+ * blocks the others.
+ *
+ * The events are the DATA-RECEIVED-EVENT and DATA-RECEIVE-ERROR-EVENT of
+ * the receiver port; an element rejected by a full queue is a receive error.
+ */
+typedef struct
+{
+    P2VAR(Rte_QueueStateType, TYPEDEF, RTE_VAR) state;     /**< Positions and counters */
+    P2VAR(void, TYPEDEF, RTE_VAR) buffer;                   /**< length elements, contiguous */
+    P2VAR(volatile uint32, TYPEDEF, RTE_VAR) sequence;      /**< Per-slot sequence, NULL_PTR: single producer */
+    uint16 element_size;                                    /**< Element size in bytes */
+    uint16 length;                                          /**< Elements, power of two >= 2 */
+    Rte_EventIdType received_event;                         /**< Raised per sent element, or RTE_NO_EVENT */
+    Rte_EventIdType error_event;                            /**< Raised per rejected element, or RTE_NO_EVENT */
+} Rte_QueueType;
+
+/**
+ * @struct Rte_QueueStatusType
+ * @brief Counters of one queue (Rte_Queue_GetStatus)
+ */
+typedef struct
+{
+    uint32 overflows;                   /**< Elements rejected since start */
+    uint16 fill_level;                  /**< Elements currently queued */
+} Rte_QueueStatusType;
+
+/** @name Recorder channel flags @{ */
+#define RTE_RECORDER_INPUT                      0x01U   /**< Injected from the recording during replay */
+/** @} */
+
+/**
+ * @struct Rte_RecorderChannelType
+ * @brief One recorded signal group (global buffer of the group)
+ */
+typedef struct
+{
+    P2VAR(void, TYPEDEF, RTE_VAR) data;     /**< Global buffer of the group */
+    uint16 size;                            /**< Group size in bytes */
+    uint8  flags;                           /**< RTE_RECORDER_* */
+} Rte_RecorderChannelType;
+
+/** @brief Recorder state */
+typedef enum
+{
+    RTE_RECORDER_IDLE = 0,              /**< Not started */
+    RTE_RECORDER_RECORDING,             /**< Recording into the ring buffer */
+    RTE_RECORDER_TRIGGERED,             /**< Fault seen, recording the post-trigger frames */
+    RTE_RECORDER_FROZEN,                /**< Buffer frozen, ready for export */
+    RTE_RECORDER_REPLAYING,             /**< Injecting a recording (host builds) */
+    RTE_RECORDER_REPLAY_DONE            /**< End of the recording reached */
+} Rte_RecorderStateType;
+
+/**
+ * @struct Rte_RecorderStatusType
+ * @brief Counters of the recorder (Rte_Recorder_GetStatus)
+ */
+typedef struct
+{
+    Rte_RecorderStateType state;        /**< Current state */
+    uint32 frames;                      /**< Frames recorded or replayed */
+    uint32 trigger_frame;               /**< Frame of the freeze request */
+    uint32 max_cycles;                  /**< Longest Rte_Recorder_Cycle() in timestamp ticks */
+    uint32 mismatches;                  /**< Replay: frames whose outputs differ from the recording */
+    uint32 first_mismatch_frame;        /**< Replay: first frame counted in mismatches */
+    uint16 fault_id;                    /**< Fault that froze the buffer */
+} Rte_RecorderStatusType;
+
+/** @name Error route flags @{ */
+#define RTE_ERROR_ROUTE_DET                     0x01U   /**< Reported to the DET (Det_ReportRuntimeError) */
+#define RTE_ERROR_ROUTE_DEM                     0x02U   /**< Reported to the DEM event dem_event */
+/** @} */
+
+/**
+ * @struct Rte_ErrorRouteType
+ * @brief Reports of one runtime error (Rte_ErrorRoute, indexed by
+ *        error code - RTE_E_DET_RUNTIME_FIRST)
+ */
+typedef struct
+{
+    uint16 dem_event;                   /**< Dem_EventIdType of the DEM event */
+    uint8  flags;                       /**< RTE_ERROR_ROUTE_* */
+} Rte_ErrorRouteType;
+
+/** @brief Identifier of a traced hop (index into Rte_TraceHop) */
+typedef uint8 Rte_TraceHopIdType;
+
+/** @brief Identifier of a timing chain (index into Rte_TraceChain) */
+typedef uint8 Rte_TraceChainIdType;
+
+/** @brief First hop of a chain: no input hop */
+#define RTE_NO_TRACE_HOP                        ((Rte_TraceHopIdType)0xFFU)
+
+/**
+ * @struct Rte_TraceHopType
+ * @brief One signal group of a timing chain, published by the flush of task
+ *
+ * The hops of a chain have consecutive identifiers in data-flow order.
+ */
+typedef struct
+{
+    Rte_TraceHopIdType input;           /**< Hop read by task, or RTE_NO_TRACE_HOP */
+    Rte_TraceChainIdType chain;         /**< Chain of the hop */
+    uint8 task;                         /**< TaskType of the writer */
+} Rte_TraceHopType;
+
+/**
+ * @struct Rte_TraceChainType
+ * @brief Timing chain (cause-effect chain) and its end-to-end budget
+ */
+typedef struct
+{
+    Rte_TraceHopIdType first;           /**< First hop (data enters the chain) */
+    Rte_TraceHopIdType last;            /**< Last hop (data leaves the chain) */
+    uint32 budget_us;                   /**< Largest acceptable end-to-end age */
+} Rte_TraceChainType;
+
+#endif /* RTE_TYPES_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
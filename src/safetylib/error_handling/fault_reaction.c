@@ -0,0 +1,169 @@
+/**
+ * @file    fault_reaction.c
+ * @brief   Fault Reaction - Central Entry Point for Detected Faults
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Implementation of the fault reaction declared in fault_reaction.h.
+ *
+ * Implementation Notes:
+ * - The latch is updated with interrupts disabled; reports from interrupt
+ *   level and from tasks may interleave
+ * - The recorder is triggered before the safe state callout, so the frames
+ *   recorded after the trigger show the reaction itself. A reset issued by
+ *   the callout keeps the recording (Rte_Recorder_Init())
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see fault_reaction.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "fault_reaction.h"
+#include "os_port.h"
+#include "det.h"
+#if (FAULTREACT_RECORDER == STD_ON)
+    #include "rte.h"
+#endif
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define FAULTREACT_C_VENDOR_ID                  43U
+#define FAULTREACT_C_SW_MAJOR_VERSION           1U
+#define FAULTREACT_C_SW_MINOR_VERSION           0U
+#define FAULTREACT_C_SW_PATCH_VERSION           0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (FAULTREACT_C_VENDOR_ID != FAULTREACT_VENDOR_ID)
+    #error "fault_reaction.c and fault_reaction.h have different vendor IDs"
+#endif
+
+#if ((FAULTREACT_C_SW_MAJOR_VERSION != FAULTREACT_SW_MAJOR_VERSION) || \
+     (FAULTREACT_C_SW_MINOR_VERSION != FAULTREACT_SW_MINOR_VERSION) || \
+     (FAULTREACT_C_SW_PATCH_VERSION != FAULTREACT_SW_PATCH_VERSION))
+    #error "Software version mismatch between fault_reaction.c and fault_reaction.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (FAULTREACT_DEV_ERROR_DETECT == STD_ON)
+    #define FAULTREACT_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(FAULTREACT_MODULE_ID, FAULTREACT_INSTANCE_ID, (api), (err)))
+#else
+    #define FAULTREACT_REPORT_ERROR(api, err)   ((void)0)
+#endif
+
+#define FAULTREACT_COUNT_MAX                    0xFFFFU
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+STATIC FaultReact_StatusType FaultReact_Status;
+STATIC boolean FaultReact_Latched = FALSE;
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Clear the latched faults
+ */
+void FaultReact_Init(void)
+{
+    uint32 key = Os_Port_DisableInterrupts();
+    uint8 i;
+
+    FaultReact_Status.first_fault = 0U;
+    FaultReact_Status.last_fault = 0U;
+    FaultReact_Status.highest_class = FAULTREACT_CLASS_MINOR;
+    for (i = 0U; i < (uint8)FAULTREACT_CLASS_COUNT; i++)
+    {
+        FaultReact_Status.count[i] = 0U;
+    }
+    FaultReact_Latched = FALSE;
+
+    Os_Port_RestoreInterrupts(key);
+}
+
+/**
+ * @brief Report a detected fault and execute the reaction of its class
+ */
+void FaultReact_Report(FaultReact_FaultIdType FaultId, FaultReact_ClassType Class)
+{
+    uint32 key;
+
+    if (Class >= FAULTREACT_CLASS_COUNT)
+    {
+        FAULTREACT_REPORT_ERROR(FAULTREACT_REPORT_API_ID, FAULTREACT_E_PARAM_CLASS);
+        return;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    if (FaultReact_Latched == FALSE)
+    {
+        FaultReact_Status.first_fault = FaultId;
+        FaultReact_Latched = TRUE;
+    }
+    FaultReact_Status.last_fault = FaultId;
+    if (Class > FaultReact_Status.highest_class)
+    {
+        FaultReact_Status.highest_class = Class;
+    }
+    if (FaultReact_Status.count[Class] < FAULTREACT_COUNT_MAX)
+    {
+        FaultReact_Status.count[Class]++;
+    }
+    Os_Port_RestoreInterrupts(key);
+
+#if (FAULTREACT_RECORDER == STD_ON)
+    if (Class >= FAULTREACT_RECORDER_CLASS)
+    {
+        Rte_Recorder_Freeze(FaultId);
+    }
+#endif
+
+#if defined(FAULTREACT_SAFE_STATE_CALLOUT)
+    FAULTREACT_SAFE_STATE_CALLOUT(FaultId, Class);
+#endif
+}
+
+/**
+ * @brief Read the latched faults
+ */
+Std_ReturnType FaultReact_GetStatus(P2VAR(FaultReact_StatusType, AUTOMATIC, FAULTREACT_APPL_DATA) Status)
+{
+    uint32 key;
+
+    if (Status == NULL_PTR)
+    {
+        FAULTREACT_REPORT_ERROR(FAULTREACT_GET_STATUS_API_ID, FAULTREACT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    key = Os_Port_DisableInterrupts();
+    *Status = FaultReact_Status;
+    Os_Port_RestoreInterrupts(key);
+
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
@@ -0,0 +1,194 @@
+/**
+ * @file    fault_reaction.h
+ * @brief   Fault Reaction - Central Entry Point for Detected Faults
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Software monitors report every detected fault here with its class from
+ * the safety manual (section 6.1.1):
+ *
+ * | Class    | Response time | Safe state             |
+ * |----------|---------------|------------------------|
+ * | Critical | < 1 ms        | Emergency shutdown     |
+ * | Severe   | < 10 ms       | Degraded mode          |
+ * | Moderate | < 100 ms      | Limp-home mode         |
+ * | Minor    | < 1 s         | Log and continue       |
+ *
+ * FaultReact_Report() latches the first and the most recent fault, counts
+ * the faults per class and, for faults of FAULTREACT_RECORDER_CLASS or
+ * above, freezes the RTE signal recorder so the signal history before the
+ * fault is kept for export (Rte_Recorder_Freeze()). The safe state itself
+ * is entered by the integrator callout FAULTREACT_SAFE_STATE_CALLOUT, which
+ * runs after the recorder has been triggered.
+ *
+ * Safety Classification: ASIL-D
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial release                    |
+ *
+ * @par Safety Requirements Traceability
+ * - SR_FLT_001: Every detected fault is classified and latched
+ * - SR_RTE_005: Post-mortem record of the signal history before a fault
+ *
+ * @see fault_reaction.c
+ * @see docs/safety_manual.md
+ */
+
+#ifndef FAULT_REACTION_H
+#define FAULT_REACTION_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define FAULTREACT_VENDOR_ID                    43U
+#define FAULTREACT_MODULE_ID                    260U    /**< Vendor-specific CDD range */
+#define FAULTREACT_INSTANCE_ID                  0U
+
+#define FAULTREACT_SW_MAJOR_VERSION             1U
+#define FAULTREACT_SW_MINOR_VERSION             0U
+#define FAULTREACT_SW_PATCH_VERSION             0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "platform_types.h"
+#include "compiler_abstraction.h"
+#include "std_types.h"
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define FAULTREACT_INIT_API_ID                  0x00U
+#define FAULTREACT_REPORT_API_ID                0x01U
+#define FAULTREACT_GET_STATUS_API_ID            0x02U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define FAULTREACT_E_PARAM_POINTER              0x01U   /**< NULL pointer parameter */
+#define FAULTREACT_E_PARAM_CLASS                0x02U   /**< Fault class out of range */
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @brief Fault identifier (DEM event or monitor specific) */
+typedef uint16 FaultReact_FaultIdType;
+
+/**
+ * @enum FaultReact_ClassType
+ * @brief Fault class, ordered by severity
+ */
+typedef enum
+{
+    FAULTREACT_CLASS_MINOR = 0,         /**< Log and continue */
+    FAULTREACT_CLASS_MODERATE,          /**< Limp-home mode */
+    FAULTREACT_CLASS_SEVERE,            /**< Degraded mode */
+    FAULTREACT_CLASS_CRITICAL,          /**< Emergency shutdown */
+    FAULTREACT_CLASS_COUNT
+} FaultReact_ClassType;
+
+/**
+ * @struct FaultReact_StatusType
+ * @brief Latched faults (FaultReact_GetStatus)
+ */
+typedef struct
+{
+    FaultReact_FaultIdType first_fault;             /**< First fault since init */
+    FaultReact_FaultIdType last_fault;              /**< Most recent fault */
+    FaultReact_ClassType   highest_class;           /**< Most severe class reported */
+    uint16 count[FAULTREACT_CLASS_COUNT];           /**< Faults per class (saturating) */
+} FaultReact_StatusType;
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def FAULTREACT_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef FAULTREACT_DEV_ERROR_DETECT
+    #define FAULTREACT_DEV_ERROR_DETECT         STD_ON
+#endif
+
+/**
+ * @def FAULTREACT_RECORDER
+ * @brief Freeze the RTE signal recorder on faults
+ */
+#ifndef FAULTREACT_RECORDER
+    #define FAULTREACT_RECORDER                 STD_ON
+#endif
+
+/**
+ * @def FAULTREACT_RECORDER_CLASS
+ * @brief Lowest fault class that freezes the recorder
+ */
+#ifndef FAULTREACT_RECORDER_CLASS
+    #define FAULTREACT_RECORDER_CLASS           FAULTREACT_CLASS_SEVERE
+#endif
+
+/**
+ * @def FAULTREACT_SAFE_STATE_CALLOUT
+ * @brief Optional integrator callout entering the safe state of a fault
+ * @details Signature: void Callout(FaultReact_FaultIdType FaultId, FaultReact_ClassType Class).
+ *          Called for every reported fault; typically mapped to the safe state manager.
+ */
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Clear the latched faults
+ *
+ * @serviceID FAULTREACT_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ */
+extern void FaultReact_Init(void);
+
+/**
+ * @brief Report a detected fault and execute the reaction of its class
+ * @param[in] FaultId Identifier of the fault
+ * @param[in] Class   Fault class
+ *
+ * @serviceID FAULTREACT_REPORT_API_ID (0x01)
+ * @reentrancy Reentrant (task and interrupt level)
+ */
+extern void FaultReact_Report(FaultReact_FaultIdType FaultId, FaultReact_ClassType Class);
+
+/**
+ * @brief Read the latched faults
+ * @param[out] Status Receives the latched faults
+ * @return E_OK, or E_NOT_OK on invalid parameters
+ *
+ * @serviceID FAULTREACT_GET_STATUS_API_ID (0x02)
+ */
+extern Std_ReturnType FaultReact_GetStatus(P2VAR(FaultReact_StatusType, AUTOMATIC, FAULTREACT_APPL_DATA) Status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAULT_REACTION_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
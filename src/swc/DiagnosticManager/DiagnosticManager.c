@@ -0,0 +1,280 @@
+/**
+ * @file    DiagnosticManager.c
+ * @brief   DiagnosticManager - Event-Triggered Fault and Diagnostic Request Handling
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runnables of DiagnosticManager.h. The fault memory is searched linearly;
+ * with DIAGMGR_FAULT_ENTRIES entries and a chunk of DIAGMGR_RECEIVE_CHUNK
+ * elements a drain stays within a few microseconds per chunk.
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see DiagnosticManager.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include "DiagnosticManager.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define DIAGMGR_C_VENDOR_ID                     43U
+#define DIAGMGR_C_SW_MAJOR_VERSION              1U
+#define DIAGMGR_C_SW_MINOR_VERSION              0U
+#define DIAGMGR_C_SW_PATCH_VERSION              0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (DIAGMGR_C_VENDOR_ID != DIAGMGR_VENDOR_ID)
+    #error "DiagnosticManager.c and DiagnosticManager.h have different vendor IDs"
+#endif
+
+#if ((DIAGMGR_C_SW_MAJOR_VERSION != DIAGMGR_SW_MAJOR_VERSION) || \
+     (DIAGMGR_C_SW_MINOR_VERSION != DIAGMGR_SW_MINOR_VERSION) || \
+     (DIAGMGR_C_SW_PATCH_VERSION != DIAGMGR_SW_PATCH_VERSION))
+    #error "Software version mismatch between DiagnosticManager.c and DiagnosticManager.h"
+#endif
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Fault memory */
+STATIC DiagMgr_FaultEntryType DiagMgr_Fault[DIAGMGR_FAULT_ENTRIES];
+
+/** @brief Counters */
+STATIC DiagMgr_StatisticsType DiagMgr_Statistics;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Fault memory entry of an event ID
+ * @param[in] EventId  Event ID
+ * @param[in] Allocate Take a free entry if the event ID has none
+ * @return The entry, or NULL_PTR
+ */
+STATIC P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) DiagMgr_FindFault(uint16 EventId,
+                                                                                  boolean Allocate)
+{
+    P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) free_entry = NULL_PTR;
+    uint32 i;
+
+    for (i = 0U; i < DIAGMGR_FAULT_ENTRIES; i++)
+    {
+        if (DiagMgr_Fault[i].used == FALSE)
+        {
+            if (free_entry == NULL_PTR)
+            {
+                free_entry = &DiagMgr_Fault[i];
+            }
+        }
+        else if (DiagMgr_Fault[i].event_id == EventId)
+        {
+            return &DiagMgr_Fault[i];
+        }
+        else
+        {
+            /* Other event ID */
+        }
+    }
+
+    if ((Allocate == TRUE) && (free_entry != NULL_PTR))
+    {
+        free_entry->used = TRUE;
+        free_entry->event_id = EventId;
+        free_entry->failed = FALSE;
+        free_entry->occurrences = 0U;
+        free_entry->last_failed = 0UL;
+    }
+    return (Allocate == TRUE) ? free_entry : NULL_PTR;
+}
+
+/**
+ * @brief Apply one fault event to the fault memory
+ */
+STATIC void DiagMgr_ProcessFault(P2CONST(Rte_FaultEventType, AUTOMATIC, RTE_APPL_DATA) Event)
+{
+    P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) entry;
+    boolean failed = (Event->Status != 0U) ? TRUE : FALSE;
+
+    /* A passed report of an unknown event ID needs no entry */
+    entry = DiagMgr_FindFault(Event->EventId, failed);
+    if (entry == NULL_PTR)
+    {
+        if (failed == TRUE)
+        {
+            DiagMgr_Statistics.fault_memory_overflows++;
+        }
+        return;
+    }
+
+    if (failed == TRUE)
+    {
+        if (entry->failed == FALSE)
+        {
+            entry->failed = TRUE;
+            DiagMgr_Statistics.active_faults++;
+        }
+        if (entry->occurrences < 0xFFFFU)
+        {
+            entry->occurrences++;
+        }
+        entry->last_failed = Event->Timestamp;
+    }
+    else if (entry->failed == TRUE)
+    {
+        entry->failed = FALSE;
+        DiagMgr_Statistics.active_faults--;
+    }
+    else
+    {
+        /* Passed again */
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Clear the fault memory and the counters
+ */
+void DiagnosticManager_Init(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < DIAGMGR_FAULT_ENTRIES; i++)
+    {
+        DiagMgr_Fault[i].used = FALSE;
+        DiagMgr_Fault[i].failed = FALSE;
+        DiagMgr_Fault[i].event_id = 0U;
+        DiagMgr_Fault[i].occurrences = 0U;
+        DiagMgr_Fault[i].last_failed = 0UL;
+    }
+
+    DiagMgr_Statistics.fault_events = 0UL;
+    DiagMgr_Statistics.fault_events_lost = 0UL;
+    DiagMgr_Statistics.fault_memory_overflows = 0UL;
+    DiagMgr_Statistics.diag_requests = 0UL;
+    DiagMgr_Statistics.diag_requests_lost = 0UL;
+    DiagMgr_Statistics.last_request.Did = 0U;
+    DiagMgr_Statistics.last_request.Sid = 0U;
+    DiagMgr_Statistics.last_request.Source = 0U;
+    DiagMgr_Statistics.active_faults = 0U;
+}
+
+/**
+ * @brief Event-triggered runnable: drain the fault event queue into the fault memory
+ */
+void DiagnosticManager_OnFaultEvent(uint32 Events)
+{
+    Rte_FaultEventType chunk[DIAGMGR_RECEIVE_CHUNK];
+    uint16 count;
+    uint16 i;
+
+    if ((Events & RTE_MASK_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT) != 0UL)
+    {
+        DiagMgr_Statistics.fault_events_lost++;
+    }
+
+    /* Drain to empty: one activation may stand for a burst of elements */
+    do
+    {
+        count = 0U;
+        if ((Rte_ReceiveN_DiagnosticManager_FaultEvent_Event(chunk, DIAGMGR_RECEIVE_CHUNK, &count)
+             & (Std_ReturnType)~RTE_E_LOST_DATA) != RTE_E_OK)
+        {
+            break;
+        }
+        for (i = 0U; i < count; i++)
+        {
+            DiagMgr_ProcessFault(&chunk[i]);
+        }
+        DiagMgr_Statistics.fault_events += count;
+    } while (count == DIAGMGR_RECEIVE_CHUNK);
+}
+
+/**
+ * @brief Event-triggered runnable: drain the diagnostic request queue
+ */
+void DiagnosticManager_OnDiagRequest(uint32 Events)
+{
+    Rte_DiagRequestType chunk[DIAGMGR_RECEIVE_CHUNK];
+    Std_ReturnType ret;
+    uint16 count;
+
+    (void)Events;                       /* Only DRE_DiagRequest is configured */
+
+    do
+    {
+        count = 0U;
+        ret = Rte_ReceiveN_DiagnosticManager_DiagRequest_Request(chunk, DIAGMGR_RECEIVE_CHUNK, &count);
+        if ((ret & RTE_E_LOST_DATA) != 0U)
+        {
+            DiagMgr_Statistics.diag_requests_lost++;
+        }
+        if ((ret & (Std_ReturnType)~RTE_E_LOST_DATA) != RTE_E_OK)
+        {
+            break;
+        }
+        DiagMgr_Statistics.last_request = chunk[count - 1U];
+        DiagMgr_Statistics.diag_requests += count;
+    } while (count == DIAGMGR_RECEIVE_CHUNK);
+}
+
+/**
+ * @brief Read the counters
+ */
+Std_ReturnType DiagnosticManager_GetStatistics(
+    P2VAR(DiagMgr_StatisticsType, AUTOMATIC, RTE_APPL_DATA) StatisticsPtr)
+{
+    if (StatisticsPtr == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    *StatisticsPtr = DiagMgr_Statistics;
+    return E_OK;
+}
+
+/**
+ * @brief Read the fault memory entry of an event ID
+ */
+Std_ReturnType DiagnosticManager_GetFault(uint16 EventId,
+    P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) EntryPtr)
+{
+    P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) entry;
+
+    if (EntryPtr == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    entry = DiagMgr_FindFault(EventId, FALSE);
+    if (entry == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    *EntryPtr = *entry;
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,177 @@
+/**
+ * @file    DiagnosticManager.h
+ * @brief   DiagnosticManager - Event-Triggered Fault and Diagnostic Request Handling
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Event-triggered runnables of the DiagnosticManager software component
+ * (config/autosar/system/rte.arxml). Both run in Task_Event, which calls
+ * them with the pending-event set taken by Rte_Events_<swc>_<runnable>():
+ *
+ * | Runnable                        | Events                          | Queue drained              |
+ * |---------------------------------|---------------------------------|----------------------------|
+ * | DiagnosticManager_OnFaultEvent  | DRE_FaultEvent, DREE_FaultEvent | FaultEvent.Event (32)      |
+ * | DiagnosticManager_OnDiagRequest | DRE_DiagRequest                 | DiagRequest.Request (16)   |
+ *
+ * A runnable drains its queue with Rte_ReceiveN in chunks of
+ * DIAGMGR_RECEIVE_CHUNK elements, so a burst of elements queued before the
+ * event task ran costs one activation and a few receive calls.
+ *
+ * Fault events update the fault memory: one entry per event ID with its
+ * status (failed while the last reported Status is not 0), the number of
+ * failed reports and the timestamp of the last one. An event ID that finds
+ * no free entry is counted as a fault memory overflow. A DREE_FaultEvent
+ * (elements rejected by the full queue, coalesced into one bit) counts one
+ * activation with lost fault events.
+ *
+ * Implementation Notes:
+ * - Both runnables run in the same task, no state is shared with another
+ *   task except through DiagnosticManager_GetStatistics()
+ * - Diagnostic requests are only counted and the last one kept; their
+ *   handling belongs to the Dcm once it is fed by the RTE
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Event-triggered runnables          |
+ *
+ * @see DiagnosticManager.c
+ * @see rte.h
+ */
+
+#ifndef DIAGNOSTICMANAGER_H
+#define DIAGNOSTICMANAGER_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define DIAGMGR_VENDOR_ID                       43U
+
+#define DIAGMGR_SW_MAJOR_VERSION                1U
+#define DIAGMGR_SW_MINOR_VERSION                0U
+#define DIAGMGR_SW_PATCH_VERSION                0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "rte.h"
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def DIAGMGR_FAULT_ENTRIES
+ * @brief Entries of the fault memory, one per event ID
+ */
+#ifndef DIAGMGR_FAULT_ENTRIES
+    #define DIAGMGR_FAULT_ENTRIES               32U
+#endif
+
+/**
+ * @def DIAGMGR_RECEIVE_CHUNK
+ * @brief Elements taken per Rte_ReceiveN call
+ */
+#ifndef DIAGMGR_RECEIVE_CHUNK
+    #define DIAGMGR_RECEIVE_CHUNK               8U
+#endif
+
+/* ===============================================================================================
+ *                                         TYPE DEFINITIONS
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Entry of the fault memory
+ */
+typedef struct
+{
+    uint32  last_failed;                /**< Timestamp of the last failed report */
+    uint16  event_id;                   /**< Event ID of the entry */
+    uint16  occurrences;                /**< Failed reports, saturated */
+    boolean used;                       /**< Entry holds event_id */
+    boolean failed;                     /**< Last reported Status was not 0 */
+} DiagMgr_FaultEntryType;
+
+/**
+ * @brief Counters of the DiagnosticManager
+ */
+typedef struct
+{
+    uint32 fault_events;                /**< Fault events taken from the queue */
+    uint32 fault_events_lost;           /**< Activations with fault events rejected by the full queue */
+    uint32 fault_memory_overflows;      /**< Fault events without a free fault memory entry */
+    uint32 diag_requests;               /**< Diagnostic requests taken from the queue */
+    uint32 diag_requests_lost;          /**< Receives reporting requests rejected by the full queue */
+    Rte_DiagRequestType last_request;   /**< Last diagnostic request taken */
+    uint16 active_faults;               /**< Entries currently failed */
+} DiagMgr_StatisticsType;
+
+/* ===============================================================================================
+ *                                       FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Clear the fault memory and the counters
+ *
+ * @reentrancy Non-Reentrant
+ */
+extern void DiagnosticManager_Init(void);
+
+/**
+ * @brief Event-triggered runnable: drain the fault event queue into the fault memory
+ * @param[in] Events Pending-event set (RTE_MASK_DIAGNOSTIC_MANAGER_DRE_FAULT_EVENT,
+ *                   RTE_MASK_DIAGNOSTIC_MANAGER_DREE_FAULT_EVENT)
+ *
+ * @reentrancy Non-Reentrant (Task_Event)
+ */
+extern void DiagnosticManager_OnFaultEvent(uint32 Events);
+
+/**
+ * @brief Event-triggered runnable: drain the diagnostic request queue
+ * @param[in] Events Pending-event set (RTE_MASK_DIAGNOSTIC_MANAGER_DRE_DIAG_REQUEST)
+ *
+ * @reentrancy Non-Reentrant (Task_Event)
+ */
+extern void DiagnosticManager_OnDiagRequest(uint32 Events);
+
+/**
+ * @brief Read the counters
+ * @param[out] StatisticsPtr Receives the counters
+ * @return E_OK, or E_NOT_OK on a NULL pointer
+ *
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType DiagnosticManager_GetStatistics(
+    P2VAR(DiagMgr_StatisticsType, AUTOMATIC, RTE_APPL_DATA) StatisticsPtr);
+
+/**
+ * @brief Read the fault memory entry of an event ID
+ * @param[in]  EventId  Event ID
+ * @param[out] EntryPtr Receives the entry
+ * @return E_OK, or E_NOT_OK if the event ID has no entry or on a NULL pointer
+ *
+ * @reentrancy Non-Reentrant (Task_Event)
+ */
+extern Std_ReturnType DiagnosticManager_GetFault(uint16 EventId,
+    P2VAR(DiagMgr_FaultEntryType, AUTOMATIC, RTE_APPL_DATA) EntryPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIAGNOSTICMANAGER_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
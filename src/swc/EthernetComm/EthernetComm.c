@@ -0,0 +1,482 @@
+/**
+ * @file    EthernetComm.c
+ * @brief   EthComm - CAN-FD to Ethernet Gateway with IEEE 1722 ACF-CAN Aggregation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Services of EthernetComm.h. Every stream owns at most one open transmit
+ * buffer, in which its frame is built; the other buffers are free or
+ * attached to a descriptor of the DMA transmit ring:
+ *
+ * | Buffer state | Enters                              | Leaves                            |
+ * |--------------|-------------------------------------|-----------------------------------|
+ * | Free         | EthComm_Init(), reclaim             | First message of a stream         |
+ * | Open         | First message of a stream           | Flush                             |
+ * | DMA          | Flush: descriptor OWN, tail pointer | Reclaim: DMA has cleared OWN      |
+ *
+ * Descriptors are used and reclaimed in ring order, so the ring is a FIFO
+ * of the flushed buffers and never fills up: it has as many descriptors as
+ * there are buffers.
+ *
+ * Implementation Notes:
+ * - The Ethernet, VLAN and NTSCF headers of a stream are built once in
+ *   EthComm_Init() and copied in front of every frame; a flush only writes
+ *   the data length and sequence number
+ * - Frames shorter than the Ethernet minimum are padded with zeros to 60
+ *   bytes; the NTSCF data length excludes the padding
+ * - Free buffers are only reclaimed when none is left and in
+ *   EthComm_MainFunction(), not per message
+ * - The GMAC registers are written through ETHCOMM_GMAC_WRITE(), and
+ *   buffer and descriptor addresses converted by ETHCOMM_DMA_ADDRESS(), so a
+ *   host build can replace the DMA by a simulation
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | Initial implementation             |
+ *
+ * @see EthernetComm.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#include <string.h>
+#include "EthernetComm.h"
+#include "os_port.h"
+#include "det.h"
+
+/*==================================================================================================
+*                                  SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+
+#define ETHCOMM_C_VENDOR_ID                     43U
+#define ETHCOMM_C_SW_MAJOR_VERSION              1U
+#define ETHCOMM_C_SW_MINOR_VERSION              0U
+#define ETHCOMM_C_SW_PATCH_VERSION              0U
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+#if (ETHCOMM_C_VENDOR_ID != ETHCOMM_VENDOR_ID)
+    #error "EthernetComm.c and EthernetComm.h have different vendor IDs"
+#endif
+
+#if ((ETHCOMM_C_SW_MAJOR_VERSION != ETHCOMM_SW_MAJOR_VERSION) || \
+     (ETHCOMM_C_SW_MINOR_VERSION != ETHCOMM_SW_MINOR_VERSION) || \
+     (ETHCOMM_C_SW_PATCH_VERSION != ETHCOMM_SW_PATCH_VERSION))
+    #error "Software version mismatch between EthernetComm.c and EthernetComm.h"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#if (ETHCOMM_DEV_ERROR_DETECT == STD_ON)
+    #define ETHCOMM_REPORT_ERROR(api, err) \
+        ((void)Det_ReportError(ETHCOMM_MODULE_ID, ETHCOMM_INSTANCE_ID, (api), (err)))
+#else
+    #define ETHCOMM_REPORT_ERROR(api, err)      ((void)0)
+#endif
+
+#ifndef ETHCOMM_ENTER_CRITICAL
+    #define ETHCOMM_ENTER_CRITICAL(key)         ((key) = Os_Port_DisableInterrupts())
+    #define ETHCOMM_EXIT_CRITICAL(key)          Os_Port_RestoreInterrupts(key)
+#endif
+
+/** @brief Write a GMAC register */
+#ifndef ETHCOMM_GMAC_WRITE
+    #define ETHCOMM_GMAC_WRITE(offset, value) \
+        (*(volatile uint32 *)(ETHCOMM_GMAC_BASE_ADDR + (offset)) = (value))
+#endif
+
+/** @brief Bus address of a buffer or descriptor as seen by the DMA */
+#ifndef ETHCOMM_DMA_ADDRESS
+    #define ETHCOMM_DMA_ADDRESS(ptr)            ((uint32)(ptr))
+#endif
+
+/* GMAC DMA channel registers (Synopsys DWC Ethernet QoS) */
+#define ETHCOMM_DMA_CH_OFFSET                   (0x1100UL + (0x80UL * (uint32)ETHCOMM_DMA_CHANNEL))
+#define ETHCOMM_DMA_TXDESC_LIST_ADDR            (ETHCOMM_DMA_CH_OFFSET + 0x14UL)
+#define ETHCOMM_DMA_TXDESC_TAIL_PTR             (ETHCOMM_DMA_CH_OFFSET + 0x20UL)
+#define ETHCOMM_DMA_TXDESC_RING_LENGTH          (ETHCOMM_DMA_CH_OFFSET + 0x2CUL)
+
+/* Transmit descriptor, read format */
+#define ETHCOMM_TDES2_B1L_MASK                  0x00003FFFUL    /**< Buffer 1 length */
+#define ETHCOMM_TDES3_OWN                       0x80000000UL    /**< Owned by the DMA */
+#define ETHCOMM_TDES3_FD                        0x20000000UL    /**< First descriptor of the frame */
+#define ETHCOMM_TDES3_LD                        0x10000000UL    /**< Last descriptor of the frame */
+#define ETHCOMM_TDES3_FL_MASK                   0x00007FFFUL    /**< Frame length */
+
+#define ETHCOMM_RING_MASK                       (ETHCOMM_TX_RING_SIZE - 1U)
+
+/* Frame layout */
+#define ETHCOMM_ETH_HEADER_LENGTH               18U     /**< MAC addresses, VLAN tag, EtherType */
+#define ETHCOMM_HEADER_LENGTH                   30U     /**< Ethernet + NTSCF header */
+#define ETHCOMM_MIN_FRAME_LENGTH                60U     /**< Ethernet minimum without FCS */
+#define ETHCOMM_ACF_HEADER_LENGTH               8U
+#define ETHCOMM_CAN_FD_MAX_LENGTH               64U
+/** @brief A frame without room for a message with 8 bytes of payload is full */
+#define ETHCOMM_ACF_MIN_MESSAGE_LENGTH          (ETHCOMM_ACF_HEADER_LENGTH + 8U)
+
+#define ETHCOMM_ETHERTYPE_VLAN                  0x8100U
+#define ETHCOMM_ETHERTYPE_AVTP                  0x22F0U
+#define ETHCOMM_AVTP_SUBTYPE_NTSCF              0x82U
+#define ETHCOMM_AVTP_SV                         0x80U   /**< stream_id valid, version 0 */
+#define ETHCOMM_ACF_MSG_CAN_BRIEF               0x02U
+
+/* Offsets of the NTSCF fields written per frame */
+#define ETHCOMM_NTSCF_LENGTH_OFFSET             (ETHCOMM_ETH_HEADER_LENGTH + 1U)
+#define ETHCOMM_NTSCF_SEQUENCE_OFFSET           (ETHCOMM_ETH_HEADER_LENGTH + 3U)
+
+/** @brief Stream without an open buffer */
+#define ETHCOMM_NO_BUFFER                       0xFFU
+
+/*==================================================================================================
+*                                       LOCAL TYPEDEFS
+==================================================================================================*/
+
+/**
+ * @struct EthComm_TxDescType
+ * @brief GMAC normal transmit descriptor (read format)
+ */
+typedef struct
+{
+    volatile uint32 des0;                       /**< Buffer 1 address */
+    volatile uint32 des1;                       /**< Buffer 2 address (unused) */
+    volatile uint32 des2;                       /**< Buffer 1 length */
+    volatile uint32 des3;                       /**< OWN, FD, LD, frame length */
+} EthComm_TxDescType;
+
+/**
+ * @struct EthComm_StreamStateType
+ * @brief Frame under construction of a stream
+ */
+typedef struct
+{
+    uint32 opened;                              /**< Timestamp of the first message */
+    uint16 length;                              /**< Bytes written into the buffer */
+    uint8  buffer;                              /**< Open buffer, or ETHCOMM_NO_BUFFER */
+    uint8  sequence;                            /**< NTSCF sequence_num of the next frame */
+} EthComm_StreamStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief TRUE after EthComm_Init() */
+STATIC boolean EthComm_Initialized = FALSE;
+
+STATIC VAR_SECTION(ETHCOMM_DMA_SECTION) uint8
+    EthComm_TxBuffer[ETHCOMM_TX_RING_SIZE][ETHCOMM_TX_BUFFER_SIZE] ALIGNED(32);
+
+STATIC VAR_SECTION(ETHCOMM_DMA_SECTION) EthComm_TxDescType EthComm_TxRing[ETHCOMM_TX_RING_SIZE] ALIGNED(32);
+
+/** @brief Buffer attached to each descriptor */
+STATIC uint8 EthComm_RingBuffer[ETHCOMM_TX_RING_SIZE];
+
+/** @brief Oldest descriptor owned by the DMA and next descriptor to use (free running) */
+STATIC uint32 EthComm_RingHead;
+STATIC uint32 EthComm_RingTail;
+
+/** @brief Stack of the free buffers */
+STATIC uint8 EthComm_FreeBuffer[ETHCOMM_TX_RING_SIZE];
+STATIC uint8 EthComm_FreeCount;
+
+/** @brief Ethernet and NTSCF header of each stream */
+STATIC uint8 EthComm_Header[ETHCOMM_STREAM_COUNT][ETHCOMM_HEADER_LENGTH];
+
+STATIC EthComm_StreamStateType EthComm_StreamState[ETHCOMM_STREAM_COUNT];
+
+STATIC EthComm_StatisticsType EthComm_Statistics;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+ * @brief Build the header of a stream: destination and source MAC, VLAN tag,
+ *        EtherType, NTSCF header without data length and sequence number
+ */
+STATIC void EthComm_BuildHeader(uint8 Stream)
+{
+    P2CONST(EthComm_StreamConfigType, AUTOMATIC, ETHCOMM_CONST) config = &EthComm_Stream[Stream];
+    P2VAR(uint8, AUTOMATIC, ETHCOMM_VAR) header = EthComm_Header[Stream];
+    uint8 i;
+
+    (void)memcpy(&header[0], config->dest_mac, 6U);
+    (void)memcpy(&header[6], EthComm_SourceMac, 6U);
+    header[12] = (uint8)(ETHCOMM_ETHERTYPE_VLAN >> 8);
+    header[13] = (uint8)ETHCOMM_ETHERTYPE_VLAN;
+    header[14] = (uint8)(config->vlan_tci >> 8);
+    header[15] = (uint8)config->vlan_tci;
+    header[16] = (uint8)(ETHCOMM_ETHERTYPE_AVTP >> 8);
+    header[17] = (uint8)ETHCOMM_ETHERTYPE_AVTP;
+    header[18] = ETHCOMM_AVTP_SUBTYPE_NTSCF;
+    header[19] = ETHCOMM_AVTP_SV;
+    header[20] = 0U;
+    header[21] = 0U;
+    for (i = 0U; i < 8U; i++)
+    {
+        header[22U + i] = (uint8)(config->stream_id >> (56U - (8U * i)));
+    }
+}
+
+/**
+ * @brief Return the buffers of the descriptors completed by the DMA to the free stack
+ * @note Called under ETHCOMM_ENTER_CRITICAL()
+ */
+STATIC void EthComm_Reclaim(void)
+{
+    uint32 slot;
+
+    while (EthComm_RingHead != EthComm_RingTail)
+    {
+        slot = EthComm_RingHead & ETHCOMM_RING_MASK;
+        if ((EthComm_TxRing[slot].des3 & ETHCOMM_TDES3_OWN) != 0UL)
+        {
+            break;
+        }
+        EthComm_FreeBuffer[EthComm_FreeCount] = EthComm_RingBuffer[slot];
+        EthComm_FreeCount++;
+        EthComm_RingHead++;
+    }
+}
+
+/**
+ * @brief Hand the frame of a stream to the DMA
+ * @note Called under ETHCOMM_ENTER_CRITICAL() with a buffer open
+ */
+STATIC void EthComm_Flush(P2VAR(EthComm_StreamStateType, AUTOMATIC, ETHCOMM_VAR) State)
+{
+    P2VAR(uint8, AUTOMATIC, ETHCOMM_VAR) frame = EthComm_TxBuffer[State->buffer];
+    uint32 data_length = (uint32)State->length - ETHCOMM_HEADER_LENGTH;
+    uint32 length = State->length;
+    uint32 slot = EthComm_RingTail & ETHCOMM_RING_MASK;
+    P2VAR(EthComm_TxDescType, AUTOMATIC, ETHCOMM_VAR) desc = &EthComm_TxRing[slot];
+
+    frame[ETHCOMM_NTSCF_LENGTH_OFFSET] = (uint8)(ETHCOMM_AVTP_SV | ((data_length >> 8) & 0x07UL));
+    frame[ETHCOMM_NTSCF_LENGTH_OFFSET + 1U] = (uint8)data_length;
+    frame[ETHCOMM_NTSCF_SEQUENCE_OFFSET] = State->sequence;
+    if (length < ETHCOMM_MIN_FRAME_LENGTH)
+    {
+        (void)memset(&frame[length], 0, ETHCOMM_MIN_FRAME_LENGTH - length);
+        length = ETHCOMM_MIN_FRAME_LENGTH;
+    }
+
+    /* The slot is free: there is one descriptor per buffer and this buffer is not in the ring */
+    EthComm_RingBuffer[slot] = State->buffer;
+    desc->des0 = ETHCOMM_DMA_ADDRESS(frame);
+    desc->des1 = 0UL;
+    desc->des2 = length & ETHCOMM_TDES2_B1L_MASK;
+    DATA_SYNC_BARRIER();
+    desc->des3 = ETHCOMM_TDES3_OWN | ETHCOMM_TDES3_FD | ETHCOMM_TDES3_LD | (length & ETHCOMM_TDES3_FL_MASK);
+    DATA_SYNC_BARRIER();
+    EthComm_RingTail++;
+    ETHCOMM_GMAC_WRITE(ETHCOMM_DMA_TXDESC_TAIL_PTR,
+        ETHCOMM_DMA_ADDRESS(&EthComm_TxRing[EthComm_RingTail & ETHCOMM_RING_MASK]));
+
+    State->buffer = ETHCOMM_NO_BUFFER;
+    State->length = 0U;
+    State->sequence++;
+    EthComm_Statistics.frames++;
+}
+
+/**
+ * @brief Open a free buffer for a stream and copy the header into it
+ * @return FALSE if no buffer is free
+ * @note Called under ETHCOMM_ENTER_CRITICAL()
+ */
+STATIC boolean EthComm_Open(uint8 Stream, uint32 Now)
+{
+    P2VAR(EthComm_StreamStateType, AUTOMATIC, ETHCOMM_VAR) state = &EthComm_StreamState[Stream];
+
+    if (EthComm_FreeCount == 0U)
+    {
+        EthComm_Reclaim();
+        if (EthComm_FreeCount == 0U)
+        {
+            return FALSE;
+        }
+    }
+    EthComm_FreeCount--;
+    state->buffer = EthComm_FreeBuffer[EthComm_FreeCount];
+    state->length = ETHCOMM_HEADER_LENGTH;
+    state->opened = Now;
+    (void)memcpy(EthComm_TxBuffer[state->buffer], EthComm_Header[Stream], ETHCOMM_HEADER_LENGTH);
+    return TRUE;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void EthComm_Init(void)
+{
+    uint8 i;
+
+    EthComm_Initialized = FALSE;
+    (void)memset((void *)EthComm_TxRing, 0, sizeof(EthComm_TxRing));
+    for (i = 0U; i < ETHCOMM_TX_RING_SIZE; i++)
+    {
+        EthComm_FreeBuffer[i] = i;
+    }
+    EthComm_FreeCount = (uint8)ETHCOMM_TX_RING_SIZE;
+    EthComm_RingHead = 0UL;
+    EthComm_RingTail = 0UL;
+    for (i = 0U; i < ETHCOMM_STREAM_COUNT; i++)
+    {
+        EthComm_BuildHeader(i);
+        EthComm_StreamState[i].buffer = ETHCOMM_NO_BUFFER;
+        EthComm_StreamState[i].length = 0U;
+        EthComm_StreamState[i].sequence = 0U;
+        EthComm_StreamState[i].opened = 0UL;
+    }
+    (void)memset(&EthComm_Statistics, 0, sizeof(EthComm_Statistics));
+
+    ETHCOMM_GMAC_WRITE(ETHCOMM_DMA_TXDESC_RING_LENGTH, (uint32)ETHCOMM_TX_RING_SIZE - 1UL);
+    ETHCOMM_GMAC_WRITE(ETHCOMM_DMA_TXDESC_LIST_ADDR, ETHCOMM_DMA_ADDRESS(&EthComm_TxRing[0]));
+    ETHCOMM_GMAC_WRITE(ETHCOMM_DMA_TXDESC_TAIL_PTR, ETHCOMM_DMA_ADDRESS(&EthComm_TxRing[0]));
+    EthComm_Initialized = TRUE;
+}
+
+Std_ReturnType EthComm_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHCOMM_APPL_DATA) PduInfoPtr)
+{
+    P2CONST(EthComm_AcfCanPduConfigType, AUTOMATIC, ETHCOMM_CONST) pdu;
+    P2CONST(EthComm_StreamConfigType, AUTOMATIC, ETHCOMM_CONST) config;
+    P2VAR(EthComm_StreamStateType, AUTOMATIC, ETHCOMM_VAR) state;
+    P2VAR(uint8, AUTOMATIC, ETHCOMM_VAR) msg;
+    Std_ReturnType result = E_OK;
+    uint32 length, pad, size, quadlets, now, key;
+
+    if (EthComm_Initialized == FALSE)
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_TRANSMIT_API_ID, ETHCOMM_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (TxPduId >= ETHCOMM_ACF_CAN_PDU_COUNT)
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_TRANSMIT_API_ID, ETHCOMM_E_PARAM_ID);
+        return E_NOT_OK;
+    }
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR))
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_TRANSMIT_API_ID, ETHCOMM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (PduInfoPtr->SduLength > ETHCOMM_CAN_FD_MAX_LENGTH)
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_TRANSMIT_API_ID, ETHCOMM_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+
+    pdu = &EthComm_AcfCanPdu[TxPduId];
+    config = &EthComm_Stream[pdu->stream];
+    state = &EthComm_StreamState[pdu->stream];
+    length = PduInfoPtr->SduLength;
+    pad = (4UL - (length & 3UL)) & 3UL;
+    size = ETHCOMM_ACF_HEADER_LENGTH + length + pad;
+    quadlets = size >> 2;
+    now = Os_Port_GetTimestamp();
+
+    ETHCOMM_ENTER_CRITICAL(key);
+    if ((state->buffer != ETHCOMM_NO_BUFFER) && (((uint32)state->length + size) > config->max_length))
+    {
+        EthComm_Flush(state);
+    }
+    if ((state->buffer == ETHCOMM_NO_BUFFER) && (EthComm_Open(pdu->stream, now) == FALSE))
+    {
+        EthComm_Statistics.dropped++;
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* ACF CAN_BRIEF: type and length in quadlets, pad and flags, bus ID, identifier */
+        msg = &EthComm_TxBuffer[state->buffer][state->length];
+        msg[0] = (uint8)((ETHCOMM_ACF_MSG_CAN_BRIEF << 1) | ((quadlets >> 8) & 0x01UL));
+        msg[1] = (uint8)quadlets;
+        msg[2] = (uint8)((pad << 6) | pdu->flags);
+        msg[3] = pdu->bus_id;
+        msg[4] = (uint8)(pdu->can_id >> 24);
+        msg[5] = (uint8)(pdu->can_id >> 16);
+        msg[6] = (uint8)(pdu->can_id >> 8);
+        msg[7] = (uint8)pdu->can_id;
+        (void)memcpy(&msg[ETHCOMM_ACF_HEADER_LENGTH], PduInfoPtr->SduDataPtr, length);
+        (void)memset(&msg[ETHCOMM_ACF_HEADER_LENGTH + length], 0, pad);
+        state->length = (uint16)(state->length + size);
+        EthComm_Statistics.messages++;
+
+        if ((now - state->opened) >= config->flush_ticks)
+        {
+            EthComm_Statistics.timeouts++;
+            EthComm_Flush(state);
+        }
+        else if (((uint32)state->length + ETHCOMM_ACF_MIN_MESSAGE_LENGTH) > config->max_length)
+        {
+            EthComm_Flush(state);
+        }
+        else
+        {
+            /* Frame stays open for more messages */
+        }
+    }
+    ETHCOMM_EXIT_CRITICAL(key);
+
+    return result;
+}
+
+void EthComm_MainFunction(void)
+{
+    uint32 now, key;
+    uint8 i;
+
+    if (EthComm_Initialized == FALSE)
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_MAIN_FUNCTION_API_ID, ETHCOMM_E_UNINIT);
+        return;
+    }
+
+    now = Os_Port_GetTimestamp();
+    for (i = 0U; i < ETHCOMM_STREAM_COUNT; i++)
+    {
+        ETHCOMM_ENTER_CRITICAL(key);
+        if ((EthComm_StreamState[i].buffer != ETHCOMM_NO_BUFFER) &&
+            ((now - EthComm_StreamState[i].opened) >= EthComm_Stream[i].flush_ticks))
+        {
+            EthComm_Statistics.timeouts++;
+            EthComm_Flush(&EthComm_StreamState[i]);
+        }
+        ETHCOMM_EXIT_CRITICAL(key);
+    }
+
+    ETHCOMM_ENTER_CRITICAL(key);
+    EthComm_Reclaim();
+    ETHCOMM_EXIT_CRITICAL(key);
+}
+
+Std_ReturnType EthComm_GetStatistics(
+    P2VAR(EthComm_StatisticsType, AUTOMATIC, ETHCOMM_APPL_DATA) StatisticsPtr)
+{
+    uint32 key;
+
+    if (StatisticsPtr == NULL_PTR)
+    {
+        ETHCOMM_REPORT_ERROR(ETHCOMM_GET_STATISTICS_API_ID, ETHCOMM_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ETHCOMM_ENTER_CRITICAL(key);
+    *StatisticsPtr = EthComm_Statistics;
+    ETHCOMM_EXIT_CRITICAL(key);
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                        END OF FILE
+==================================================================================================*/
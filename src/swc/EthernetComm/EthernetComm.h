@@ -0,0 +1,320 @@
+/**
+ * @file    EthernetComm.h
+ * @brief   EthComm - CAN-FD to Ethernet Gateway with IEEE 1722 ACF-CAN Aggregation
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Gateway of the VCU from the FlexCAN buses to the Ethernet backbone (GMAC),
+ * see docs/ethernet_tsn_manual.md. EthComm is a lower module of the PduR:
+ * the CAN-FD frames of the gateway routing paths (PduR destinations of
+ * EthCommAcfCanPdu in config/autosar/communication/pdu_router.arxml) are
+ * handed to EthComm_Transmit() and aggregated into one Ethernet frame per
+ * stream instead of one UDP frame each:
+ *
+ * | Bytes | Content                                                                   |
+ * |-------|---------------------------------------------------------------------------|
+ * | 18    | Ethernet header with VLAN tag (PCP / VID of the stream), EtherType 0x22F0 |
+ * | 12    | IEEE 1722 NTSCF header: data length, sequence number, stream ID           |
+ * | 8 + n | ACF CAN_BRIEF message per CAN-FD frame: flags, bus ID, CAN ID, payload    |
+ * |       | padded to a multiple of 4 bytes                                           |
+ *
+ * A frame is built in place in a GMAC transmit buffer: the only copy of the
+ * payload is the one from the received CAN-FD frame into the buffer. A
+ * stream sends its frame (flush) when
+ *
+ * | Condition                                       | Checked in                      |
+ * |-------------------------------------------------|---------------------------------|
+ * | The next message does not fit into the frame    | EthComm_Transmit()              |
+ * | The frame cannot take a message of 8 bytes more | EthComm_Transmit()              |
+ * | The oldest message has waited the flush timeout | EthComm_Transmit(),             |
+ * |                                                 | EthComm_MainFunction()          |
+ *
+ * A flushed buffer is attached to the next descriptor of the GMAC DMA
+ * transmit ring of ETHCOMM_DMA_CHANNEL and handed to the DMA by the OWN bit
+ * and the tail pointer; it is reused once the DMA has returned the
+ * descriptor. The Ethernet overhead of a frame (preamble, headers, FCS and
+ * inter-frame gap: 54 bytes) is shared by all CAN-FD frames in it, each
+ * adding its 8-byte ACF header; a UDP frame per CAN-FD frame costs 78 bytes
+ * of overhead each.
+ *
+ * Implementation Notes:
+ * - The Eth driver initializes the MAC and starts the DMA channel;
+ *   EthComm_Init() only sets up the transmit descriptor ring of the channel
+ * - The transmit buffers and descriptors are placed in ETHCOMM_DMA_SECTION,
+ *   which the linker script must map to non-cacheable RAM
+ * - The state of a stream is accessed under ETHCOMM_ENTER_CRITICAL(); a
+ *   stream may be fed from several CAN receive interrupts
+ * - EthComm_MainFunction() must run at least once per flush timeout, the
+ *   deadline of a stream is otherwise only checked on its next message
+ * - If no transmit buffer is free, the CAN-FD frame is dropped and counted
+ *
+ * Safety Classification: QM
+ *
+ * @par Change Log
+ * | Version | Date       | Author          | Description                        |
+ * |---------|------------|-----------------|------------------------------------|
+ * | 1.0.0   | 2026-10-16 | BSW Team        | ACF-CAN aggregation gateway        |
+ *
+ * @see EthernetComm.c
+ * @see EthernetComm_Cfg.h
+ * @see pdu_router.h
+ */
+
+#ifndef ETHERNETCOMM_H
+#define ETHERNETCOMM_H
+
+/* ===============================================================================================
+ *                                         VERSION INFORMATION
+ * =============================================================================================== */
+
+#define ETHCOMM_VENDOR_ID                       43U
+#define ETHCOMM_MODULE_ID                       261U    /**< Vendor-specific CDD range */
+#define ETHCOMM_INSTANCE_ID                     0U
+
+#define ETHCOMM_SW_MAJOR_VERSION                1U
+#define ETHCOMM_SW_MINOR_VERSION                0U
+#define ETHCOMM_SW_PATCH_VERSION                0U
+
+/* ===============================================================================================
+ *                                         INCLUDE FILES
+ * =============================================================================================== */
+
+#include "comstack_types.h"
+#include "os_port.h"
+
+/* ===============================================================================================
+ *                                    DEPENDENCY VERSION CHECKS
+ * =============================================================================================== */
+
+#if (ETHCOMM_VENDOR_ID != PLATFORM_VENDOR_ID)
+    #error "EthernetComm.h and platform_types.h have different vendor IDs"
+#endif
+
+/* ===============================================================================================
+ *                                    API SERVICE IDs
+ * =============================================================================================== */
+
+#define ETHCOMM_INIT_API_ID                     0x00U
+#define ETHCOMM_TRANSMIT_API_ID                 0x01U
+#define ETHCOMM_MAIN_FUNCTION_API_ID            0x02U
+#define ETHCOMM_GET_STATISTICS_API_ID           0x03U
+
+/* ===============================================================================================
+ *                                    ERROR CODES
+ * =============================================================================================== */
+
+#define ETHCOMM_E_UNINIT                        0x01U   /**< EthComm_Init() not called */
+#define ETHCOMM_E_PARAM_ID                      0x02U   /**< Invalid PDU handle */
+#define ETHCOMM_E_PARAM_POINTER                 0x03U   /**< NULL pointer parameter */
+#define ETHCOMM_E_PARAM_LENGTH                  0x04U   /**< Payload longer than a CAN-FD frame */
+
+/* ===============================================================================================
+ *                                    CONFIGURATION PARAMETERS
+ * =============================================================================================== */
+
+/**
+ * @def ETHCOMM_DEV_ERROR_DETECT
+ * @brief Enable parameter checking with DET reporting
+ */
+#ifndef ETHCOMM_DEV_ERROR_DETECT
+    #define ETHCOMM_DEV_ERROR_DETECT            STD_ON
+#endif
+
+/**
+ * @def ETHCOMM_TX_RING_SIZE
+ * @brief Transmit buffers and DMA descriptors (power of two); at least one
+ *        more than the streams, so a flushed frame never blocks a stream
+ */
+#ifndef ETHCOMM_TX_RING_SIZE
+    #define ETHCOMM_TX_RING_SIZE                8U
+#endif
+
+/**
+ * @def ETHCOMM_TX_BUFFER_SIZE
+ * @brief Bytes per transmit buffer; the largest EthCommMaxFrameLength
+ *        (without FCS) must fit
+ */
+#ifndef ETHCOMM_TX_BUFFER_SIZE
+    #define ETHCOMM_TX_BUFFER_SIZE              1536U
+#endif
+
+/**
+ * @def ETHCOMM_DMA_CHANNEL
+ * @brief GMAC DMA channel (transmit queue) of the ACF-CAN streams
+ */
+#ifndef ETHCOMM_DMA_CHANNEL
+    #define ETHCOMM_DMA_CHANNEL                 1U
+#endif
+
+/**
+ * @def ETHCOMM_GMAC_BASE_ADDR
+ * @brief Register base of the GMAC (MCU_GMAC0_BASE_ADDR of mcu_select.h)
+ */
+#ifndef ETHCOMM_GMAC_BASE_ADDR
+    #define ETHCOMM_GMAC_BASE_ADDR              0x40480000UL
+#endif
+
+/**
+ * @def ETHCOMM_DMA_SECTION
+ * @brief Linker section of the transmit buffers and descriptors (non-cacheable)
+ */
+#ifndef ETHCOMM_DMA_SECTION
+    #define ETHCOMM_DMA_SECTION                 ".os_shared_noncacheable"
+#endif
+
+/**
+ * @def ETHCOMM_TICKS_PER_US
+ * @brief Os_Port_GetTimestamp() ticks per microsecond
+ */
+#define ETHCOMM_TICKS_PER_US                    OS_PORT_TICKS_PER_US
+
+/**
+ * @def ETHCOMM_US_TO_TICKS
+ * @brief Microseconds to Os_Port_GetTimestamp() ticks
+ */
+#define ETHCOMM_US_TO_TICKS(us)                 ((uint32)(us) * ETHCOMM_TICKS_PER_US)
+
+/* Configuration validation */
+#if (ETHCOMM_DEV_ERROR_DETECT != STD_ON) && (ETHCOMM_DEV_ERROR_DETECT != STD_OFF)
+    #error "ETHCOMM_DEV_ERROR_DETECT must be STD_ON or STD_OFF"
+#endif
+
+#if (ETHCOMM_TX_RING_SIZE < 2U) || (ETHCOMM_TX_RING_SIZE > 128U) || \
+    ((ETHCOMM_TX_RING_SIZE & (ETHCOMM_TX_RING_SIZE - 1U)) != 0U)
+    #error "ETHCOMM_TX_RING_SIZE must be a power of two from 2 to 128"
+#endif
+
+#if ((ETHCOMM_TX_BUFFER_SIZE % 32U) != 0U) || (ETHCOMM_TX_BUFFER_SIZE > 16352U)
+    #error "ETHCOMM_TX_BUFFER_SIZE must be a multiple of 32 of at most 16352"
+#endif
+
+/* ===============================================================================================
+ *                                    TYPE DEFINITIONS
+ * =============================================================================================== */
+
+/** @name ACF CAN message flags (EthComm_AcfCanPduConfigType.flags) @{ */
+#define ETHCOMM_ACF_FDF                         0x02U   /**< CAN-FD format */
+#define ETHCOMM_ACF_BRS                         0x04U   /**< Bit rate switch */
+#define ETHCOMM_ACF_EFF                         0x08U   /**< 29-bit identifier */
+/** @} */
+
+/**
+ * @struct EthComm_StreamConfigType
+ * @brief Static configuration of one ACF-CAN stream (EthCommAcfStream, generated)
+ */
+typedef struct
+{
+    uint64 stream_id;                   /**< EthCommStreamId (IEEE 1722 stream_id) */
+    uint32 flush_ticks;                 /**< EthCommFlushTimeout in timestamp ticks */
+    uint16 vlan_tci;                    /**< PCP (EthCommVlanPriority) and VID (EthCommVlanId) */
+    uint16 max_length;                  /**< EthCommMaxFrameLength, without FCS */
+    uint8 dest_mac[6];                  /**< EthCommDestMacAddress */
+} EthComm_StreamConfigType;
+
+/**
+ * @struct EthComm_AcfCanPduConfigType
+ * @brief Static configuration of one aggregated CAN-FD frame (EthCommAcfCanPdu, generated)
+ */
+typedef struct
+{
+    uint32 can_id;                      /**< EthCommAcfCanId, 11 or 29 bits */
+    uint8 stream;                       /**< EthCommAcfStream handle */
+    uint8 flags;                        /**< ACF CAN flags: EFF, BRS, FDF (ETHCOMM_ACF_*) */
+    uint8 bus_id;                       /**< EthCommAcfCanBusId (1..31) */
+} EthComm_AcfCanPduConfigType;
+
+/**
+ * @struct EthComm_StatisticsType
+ * @brief Counters since EthComm_Init()
+ */
+typedef struct
+{
+    uint32 messages;                    /**< CAN-FD frames aggregated */
+    uint32 frames;                      /**< Ethernet frames handed to the DMA */
+    uint32 dropped;                     /**< CAN-FD frames dropped, no transmit buffer free */
+    uint32 timeouts;                    /**< Frames flushed by their flush timeout */
+} EthComm_StatisticsType;
+
+#include "EthernetComm_Cfg.h"
+
+/* ===============================================================================================
+ *                                    GLOBAL CONSTANTS
+ * =============================================================================================== */
+
+/** @brief Stream configuration, indexed by EthCommConf_EthCommAcfStream_* */
+extern const EthComm_StreamConfigType EthComm_Stream[ETHCOMM_STREAM_COUNT];
+
+/** @brief CAN-FD frame configuration, indexed by EthCommConf_EthCommAcfCanPdu_* */
+extern const EthComm_AcfCanPduConfigType EthComm_AcfCanPdu[ETHCOMM_ACF_CAN_PDU_COUNT];
+
+/** @brief EthCommSourceMacAddress */
+extern const uint8 EthComm_SourceMac[6];
+
+#if (ETHCOMM_STREAM_COUNT >= ETHCOMM_TX_RING_SIZE)
+    #error "ETHCOMM_TX_RING_SIZE must exceed the number of ACF-CAN streams"
+#endif
+
+/* ===============================================================================================
+ *                                    C++ COMPATIBILITY
+ * =============================================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===============================================================================================
+ *                                    FUNCTION PROTOTYPES
+ * =============================================================================================== */
+
+/**
+ * @brief Initialize the streams and the DMA transmit descriptor ring
+ *
+ * @serviceID ETHCOMM_INIT_API_ID (0x00)
+ * @reentrancy Non-Reentrant
+ */
+extern void EthComm_Init(void);
+
+/**
+ * @brief Append a received CAN-FD frame to the frame of its stream
+ * @param[in] TxPduId    CAN-FD frame (EthCommConf_EthCommAcfCanPdu_*)
+ * @param[in] PduInfoPtr Payload of up to 64 bytes, copied into the transmit buffer
+ * @return E_OK, or E_NOT_OK if no transmit buffer is free or on invalid parameters
+ *
+ * @serviceID ETHCOMM_TRANSMIT_API_ID (0x01)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType EthComm_Transmit(PduIdType TxPduId,
+    P2CONST(PduInfoType, AUTOMATIC, ETHCOMM_APPL_DATA) PduInfoPtr);
+
+/**
+ * @brief Flush the streams whose flush timeout has expired and reclaim the
+ *        descriptors returned by the DMA
+ *
+ * @serviceID ETHCOMM_MAIN_FUNCTION_API_ID (0x02)
+ * @reentrancy Non-Reentrant
+ */
+extern void EthComm_MainFunction(void);
+
+/**
+ * @brief Read the counters
+ * @param[out] StatisticsPtr Receives the counters
+ * @return E_OK, or E_NOT_OK on a NULL pointer
+ *
+ * @serviceID ETHCOMM_GET_STATISTICS_API_ID (0x03)
+ * @reentrancy Reentrant
+ */
+extern Std_ReturnType EthComm_GetStatistics(
+    P2VAR(EthComm_StatisticsType, AUTOMATIC, ETHCOMM_APPL_DATA) StatisticsPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ETHERNETCOMM_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
@@ -0,0 +1,192 @@
+/**
+ * @file    EthernetComm_Cfg.c
+ * @brief   EthComm Configuration - Stream and CAN-FD Frame Tables
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Static EthComm configuration of the VCU: source MAC address, ACF-CAN
+ * streams and the CAN-FD frames aggregated into them.
+ *
+ * @note Generated by tools/ethcomm/ethcomm_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+
+#include "EthernetComm.h"
+
+/*==================================================================================================
+*                                         GLOBAL CONSTANTS
+==================================================================================================*/
+
+const uint8 EthComm_SourceMac[6] = { 0x02U, 0x56U, 0x43U, 0x55U, 0x00U, 0x01U };
+
+const EthComm_StreamConfigType EthComm_Stream[ETHCOMM_STREAM_COUNT] =
+{
+    { 0x0256435500010001ULL, ETHCOMM_US_TO_TICKS(500U), 0x6002U, 1518U, { 0x91U, 0xE0U, 0xF0U, 0x00U, 0xFEU, 0x01U } },  /* ACF_PT */
+    { 0x0256435500010002ULL, ETHCOMM_US_TO_TICKS(500U), 0x6002U, 1518U, { 0x91U, 0xE0U, 0xF0U, 0x00U, 0xFEU, 0x02U } },  /* ACF_CH */
+    { 0x0256435500010003ULL, ETHCOMM_US_TO_TICKS(2000U), 0x4002U, 1518U, { 0x91U, 0xE0U, 0xF0U, 0x00U, 0xFEU, 0x03U } }   /* ACF_BD */
+};
+
+const EthComm_AcfCanPduConfigType EthComm_AcfCanPdu[ETHCOMM_ACF_CAN_PDU_COUNT] =
+{
+    { 0x200UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_200_Acf */
+    { 0x201UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_201_Acf */
+    { 0x202UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_202_Acf */
+    { 0x203UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_203_Acf */
+    { 0x204UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_204_Acf */
+    { 0x205UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_205_Acf */
+    { 0x206UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_206_Acf */
+    { 0x207UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_207_Acf */
+    { 0x208UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_208_Acf */
+    { 0x209UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_209_Acf */
+    { 0x20AUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20A_Acf */
+    { 0x20BUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20B_Acf */
+    { 0x20CUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20C_Acf */
+    { 0x20DUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20D_Acf */
+    { 0x20EUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20E_Acf */
+    { 0x20FUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_20F_Acf */
+    { 0x210UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_210_Acf */
+    { 0x211UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_211_Acf */
+    { 0x212UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_212_Acf */
+    { 0x213UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_213_Acf */
+    { 0x214UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_214_Acf */
+    { 0x215UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_215_Acf */
+    { 0x216UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_216_Acf */
+    { 0x217UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_217_Acf */
+    { 0x218UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_218_Acf */
+    { 0x219UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_219_Acf */
+    { 0x21AUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21A_Acf */
+    { 0x21BUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21B_Acf */
+    { 0x21CUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21C_Acf */
+    { 0x21DUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21D_Acf */
+    { 0x21EUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21E_Acf */
+    { 0x21FUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_21F_Acf */
+    { 0x220UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_220_Acf */
+    { 0x221UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_221_Acf */
+    { 0x222UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_222_Acf */
+    { 0x223UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_223_Acf */
+    { 0x224UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_224_Acf */
+    { 0x225UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_225_Acf */
+    { 0x226UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_226_Acf */
+    { 0x227UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_227_Acf */
+    { 0x228UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_228_Acf */
+    { 0x229UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_229_Acf */
+    { 0x22AUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22A_Acf */
+    { 0x22BUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22B_Acf */
+    { 0x22CUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22C_Acf */
+    { 0x22DUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22D_Acf */
+    { 0x22EUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22E_Acf */
+    { 0x22FUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_22F_Acf */
+    { 0x230UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_230_Acf */
+    { 0x231UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_231_Acf */
+    { 0x232UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_232_Acf */
+    { 0x233UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_233_Acf */
+    { 0x234UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_234_Acf */
+    { 0x235UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_235_Acf */
+    { 0x236UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_236_Acf */
+    { 0x237UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_237_Acf */
+    { 0x238UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_238_Acf */
+    { 0x239UL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_239_Acf */
+    { 0x23AUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23A_Acf */
+    { 0x23BUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23B_Acf */
+    { 0x23CUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23C_Acf */
+    { 0x23DUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23D_Acf */
+    { 0x23EUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23E_Acf */
+    { 0x23FUL,      EthCommConf_EthCommAcfStream_ACF_PT, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 1U },  /* GwPt_23F_Acf */
+    { 0x280UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_280_Acf */
+    { 0x281UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_281_Acf */
+    { 0x282UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_282_Acf */
+    { 0x283UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_283_Acf */
+    { 0x284UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_284_Acf */
+    { 0x285UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_285_Acf */
+    { 0x286UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_286_Acf */
+    { 0x287UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_287_Acf */
+    { 0x288UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_288_Acf */
+    { 0x289UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_289_Acf */
+    { 0x28AUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28A_Acf */
+    { 0x28BUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28B_Acf */
+    { 0x28CUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28C_Acf */
+    { 0x28DUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28D_Acf */
+    { 0x28EUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28E_Acf */
+    { 0x28FUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_28F_Acf */
+    { 0x290UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_290_Acf */
+    { 0x291UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_291_Acf */
+    { 0x292UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_292_Acf */
+    { 0x293UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_293_Acf */
+    { 0x294UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_294_Acf */
+    { 0x295UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_295_Acf */
+    { 0x296UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_296_Acf */
+    { 0x297UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_297_Acf */
+    { 0x298UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_298_Acf */
+    { 0x299UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_299_Acf */
+    { 0x29AUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29A_Acf */
+    { 0x29BUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29B_Acf */
+    { 0x29CUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29C_Acf */
+    { 0x29DUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29D_Acf */
+    { 0x29EUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29E_Acf */
+    { 0x29FUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_29F_Acf */
+    { 0x2A0UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A0_Acf */
+    { 0x2A1UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A1_Acf */
+    { 0x2A2UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A2_Acf */
+    { 0x2A3UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A3_Acf */
+    { 0x2A4UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A4_Acf */
+    { 0x2A5UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A5_Acf */
+    { 0x2A6UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A6_Acf */
+    { 0x2A7UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A7_Acf */
+    { 0x2A8UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A8_Acf */
+    { 0x2A9UL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2A9_Acf */
+    { 0x2AAUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AA_Acf */
+    { 0x2ABUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AB_Acf */
+    { 0x2ACUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AC_Acf */
+    { 0x2ADUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AD_Acf */
+    { 0x2AEUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AE_Acf */
+    { 0x2AFUL,      EthCommConf_EthCommAcfStream_ACF_CH, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 2U },  /* GwCh_2AF_Acf */
+    { 0x400UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_400_Acf */
+    { 0x401UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_401_Acf */
+    { 0x402UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_402_Acf */
+    { 0x403UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_403_Acf */
+    { 0x404UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_404_Acf */
+    { 0x405UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_405_Acf */
+    { 0x406UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_406_Acf */
+    { 0x407UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_407_Acf */
+    { 0x408UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_408_Acf */
+    { 0x409UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_409_Acf */
+    { 0x40AUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40A_Acf */
+    { 0x40BUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40B_Acf */
+    { 0x40CUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40C_Acf */
+    { 0x40DUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40D_Acf */
+    { 0x40EUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40E_Acf */
+    { 0x40FUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_40F_Acf */
+    { 0x410UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_410_Acf */
+    { 0x411UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_411_Acf */
+    { 0x412UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_412_Acf */
+    { 0x413UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_413_Acf */
+    { 0x414UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_414_Acf */
+    { 0x415UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_415_Acf */
+    { 0x416UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_416_Acf */
+    { 0x417UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_417_Acf */
+    { 0x418UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_418_Acf */
+    { 0x419UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_419_Acf */
+    { 0x41AUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41A_Acf */
+    { 0x41BUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41B_Acf */
+    { 0x41CUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41C_Acf */
+    { 0x41DUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41D_Acf */
+    { 0x41EUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41E_Acf */
+    { 0x41FUL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_41F_Acf */
+    { 0x420UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_420_Acf */
+    { 0x421UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_421_Acf */
+    { 0x422UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_422_Acf */
+    { 0x423UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_423_Acf */
+    { 0x424UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_424_Acf */
+    { 0x425UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_425_Acf */
+    { 0x426UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U },  /* GwBd_426_Acf */
+    { 0x427UL,      EthCommConf_EthCommAcfStream_ACF_BD, (uint8)(ETHCOMM_ACF_FDF | ETHCOMM_ACF_BRS), 3U }   /* GwBd_427_Acf */
+};
+
+/*==================================================================================================
+*                                           END OF FILE
+==================================================================================================*/
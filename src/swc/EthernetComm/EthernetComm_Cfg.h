@@ -0,0 +1,200 @@
+/**
+ * @file    EthernetComm_Cfg.h
+ * @brief   EthComm Configuration - Stream and CAN-FD Frame Handles
+ * @version 1.0.0
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Handles of the ACF-CAN streams and aggregated CAN-FD frames of the VCU
+ * CAN-FD to Ethernet gateway (source MAC 02:56:43:55:00:01):
+ *
+ * | Stream | Stream ID          | Destination MAC   | VID  | PCP | Max frame | Flush timeout | Frames |
+ * |--------|--------------------|-------------------|------|-----|-----------|---------------|--------|
+ * | ACF_PT | 0x0256435500010001 | 91:E0:F0:00:FE:01 | 2    | 3   | 1518      | 500 us        | 64     |
+ * | ACF_CH | 0x0256435500010002 | 91:E0:F0:00:FE:02 | 2    | 3   | 1518      | 500 us        | 48     |
+ * | ACF_BD | 0x0256435500010003 | 91:E0:F0:00:FE:03 | 2    | 2   | 1518      | 2000 us       | 40     |
+ *
+ * @note Generated by tools/ethcomm/ethcomm_generator.py from config/autosar/communication/pdu_router.arxml - do not edit.
+ */
+
+#ifndef ETHERNETCOMM_CFG_H
+#define ETHERNETCOMM_CFG_H
+
+/* ===============================================================================================
+ *                                      CONFIGURATION COUNTS
+ * =============================================================================================== */
+
+#define ETHCOMM_STREAM_COUNT                            3U
+#define ETHCOMM_ACF_CAN_PDU_COUNT                       152U
+
+/* ===============================================================================================
+ *                                         STREAM HANDLES
+ * =============================================================================================== */
+
+#define EthCommConf_EthCommAcfStream_ACF_PT             0U
+#define EthCommConf_EthCommAcfStream_ACF_CH             1U
+#define EthCommConf_EthCommAcfStream_ACF_BD             2U
+
+/* ===============================================================================================
+ *                            CAN-FD FRAME HANDLES (EthComm_Transmit)
+ * =============================================================================================== */
+
+#define EthCommConf_EthCommAcfCanPdu_GwPt_200_Acf       0U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_201_Acf       1U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_202_Acf       2U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_203_Acf       3U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_204_Acf       4U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_205_Acf       5U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_206_Acf       6U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_207_Acf       7U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_208_Acf       8U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_209_Acf       9U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20A_Acf       10U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20B_Acf       11U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20C_Acf       12U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20D_Acf       13U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20E_Acf       14U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_20F_Acf       15U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_210_Acf       16U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_211_Acf       17U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_212_Acf       18U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_213_Acf       19U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_214_Acf       20U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_215_Acf       21U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_216_Acf       22U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_217_Acf       23U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_218_Acf       24U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_219_Acf       25U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21A_Acf       26U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21B_Acf       27U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21C_Acf       28U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21D_Acf       29U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21E_Acf       30U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_21F_Acf       31U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_220_Acf       32U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_221_Acf       33U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_222_Acf       34U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_223_Acf       35U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_224_Acf       36U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_225_Acf       37U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_226_Acf       38U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_227_Acf       39U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_228_Acf       40U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_229_Acf       41U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22A_Acf       42U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22B_Acf       43U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22C_Acf       44U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22D_Acf       45U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22E_Acf       46U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_22F_Acf       47U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_230_Acf       48U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_231_Acf       49U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_232_Acf       50U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_233_Acf       51U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_234_Acf       52U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_235_Acf       53U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_236_Acf       54U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_237_Acf       55U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_238_Acf       56U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_239_Acf       57U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23A_Acf       58U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23B_Acf       59U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23C_Acf       60U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23D_Acf       61U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23E_Acf       62U
+#define EthCommConf_EthCommAcfCanPdu_GwPt_23F_Acf       63U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_280_Acf       64U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_281_Acf       65U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_282_Acf       66U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_283_Acf       67U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_284_Acf       68U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_285_Acf       69U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_286_Acf       70U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_287_Acf       71U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_288_Acf       72U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_289_Acf       73U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28A_Acf       74U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28B_Acf       75U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28C_Acf       76U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28D_Acf       77U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28E_Acf       78U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_28F_Acf       79U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_290_Acf       80U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_291_Acf       81U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_292_Acf       82U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_293_Acf       83U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_294_Acf       84U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_295_Acf       85U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_296_Acf       86U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_297_Acf       87U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_298_Acf       88U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_299_Acf       89U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29A_Acf       90U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29B_Acf       91U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29C_Acf       92U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29D_Acf       93U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29E_Acf       94U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_29F_Acf       95U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A0_Acf       96U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A1_Acf       97U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A2_Acf       98U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A3_Acf       99U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A4_Acf       100U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A5_Acf       101U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A6_Acf       102U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A7_Acf       103U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A8_Acf       104U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2A9_Acf       105U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AA_Acf       106U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AB_Acf       107U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AC_Acf       108U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AD_Acf       109U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AE_Acf       110U
+#define EthCommConf_EthCommAcfCanPdu_GwCh_2AF_Acf       111U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_400_Acf       112U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_401_Acf       113U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_402_Acf       114U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_403_Acf       115U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_404_Acf       116U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_405_Acf       117U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_406_Acf       118U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_407_Acf       119U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_408_Acf       120U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_409_Acf       121U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40A_Acf       122U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40B_Acf       123U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40C_Acf       124U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40D_Acf       125U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40E_Acf       126U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_40F_Acf       127U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_410_Acf       128U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_411_Acf       129U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_412_Acf       130U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_413_Acf       131U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_414_Acf       132U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_415_Acf       133U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_416_Acf       134U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_417_Acf       135U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_418_Acf       136U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_419_Acf       137U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41A_Acf       138U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41B_Acf       139U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41C_Acf       140U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41D_Acf       141U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41E_Acf       142U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_41F_Acf       143U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_420_Acf       144U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_421_Acf       145U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_422_Acf       146U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_423_Acf       147U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_424_Acf       148U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_425_Acf       149U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_426_Acf       150U
+#define EthCommConf_EthCommAcfCanPdu_GwBd_427_Acf       151U
+
+#endif /* ETHERNETCOMM_CFG_H */
+
+/* ===============================================================================================
+ *                                          END OF FILE
+ * =============================================================================================== */
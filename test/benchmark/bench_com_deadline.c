@@ -0,0 +1,588 @@
+/**
+ * @file    bench_com_deadline.c
+ * @brief   Host benchmark: COM reception deadline monitoring, per-cycle scan vs. timing wheels
+ * @version 1.2.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Part 1 checks the deadline monitoring of com_stack.c with the I-PDUs of
+ * com.arxml: all RECEIVE I-PDUs are received every Com_MainFunctionRx()
+ * cycle except
+ * - APS_Pedals (30 ms, REPLACE), silent from cycle SILENCE_START to
+ *   SILENCE_END: must time out ComTimeout cycles after its last reception,
+ *   read its init values while timed out and recover on reception
+ * - DCDC_Status (ComFirstTimeout 2 s), never received: must time out
+ *   ComFirstTimeout cycles after Com_Init()
+ * No other I-PDU may time out.
+ *
+ * Part 2 measures the real Com_RxIndication() and Com_MainFunctionRx() with
+ * the RECEIVE I-PDUs of com.arxml. A monitored I-PDU is received every
+ * ComTimeout / 3 cycles, an unmonitored one every cycle; one transmission in
+ * DROP_RATE is lost and a sender falls silent for a while in one cycle out
+ * of SILENCE_RATE. The reception schedule is replayed RUNS times, once with
+ * the receptions only and once with receptions and main function; the cost
+ * per cycle is timed over the whole replay, and the main function share is
+ * the difference. Both include the unpack kernels (IMMEDIATE I-PDUs in the
+ * reception, DEFERRED ones in the main function).
+ *
+ * Part 3 scales the same scheme to N deadlines and compares three ways of
+ * monitoring them:
+ * - scan: the counter scan of com_stack.c (a reception stores its deadline
+ *   cycle, the main function compares every deadline with the cycle count)
+ * - wheel: timers of timer_manager.c, re-armed by every reception, ticked
+ *   and drained by the main function
+ * - lazy: the same timers, but a reception only stamps the wheel time and
+ *   arms an idle timer; an expired timer whose PDU was received meanwhile
+ *   is re-inserted for the rest of its deadline
+ * Each of the N PDUs is sent with a period of 2..10 cycles and a deadline of
+ * 3 periods, with the same losses and silences as in Part 2. All three run
+ * the same reception schedule and must report the same number of missed
+ * deadlines; the total per cycle is the figure to compare.
+ *
+ * Expected result: the wheel keeps the main function flat (about 50 to
+ * 110 ns from 16 to 4096 PDUs), but a re-arm relinks a wheel node where the
+ * scan stores a word, so its total per cycle is two to four times the
+ * scan's (host, 4096 PDUs: about 11 us against 3 to 5 us). The lazy re-arm
+ * makes the reception cheap but moves the relinks into the main function:
+ * a timer expires, is drained and re-inserted once or twice per deadline,
+ * which costs as much as the re-arms it saves. Neither wheel reaches the
+ * total of the scan, so com_stack.c keeps the scan.
+ *
+ * Build (host toolchain profile, single-threaded):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DCOM_DEV_ERROR_DETECT=STD_OFF \
+ *     -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF -DTIMERMGR_DEV_ERROR_DETECT=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     -Iplatform/baremetal_core/timing \
+ *     test/benchmark/bench_com_deadline.c src/bsw/com/com_stack.c src/bsw/com/com_cfg.c \
+ *     platform/baremetal_core/timing/timer_manager.c -o bench_com_deadline
+ * @endcode
+ *
+ * @see com_stack.h
+ * @see timer_manager.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "com_stack.h"
+#include "timer_manager.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_COM_CYCLES                        500U
+#define BENCH_SILENCE_START                     100U
+#define BENCH_SILENCE_END                       300U
+
+#define BENCH_MAX_PDUS                          4096U
+#define BENCH_CYCLES                            2000U
+#define BENCH_DROP_RATE                         64U     /**< One lost transmission in ... */
+#define BENCH_SILENCE_RATE                      4096U   /**< One sender falling silent in ... */
+#define BENCH_SILENCE_CYCLES                    50U
+#define BENCH_DRAIN_BATCH                       32U
+#define BENCH_COM_RUNS                          200U
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+typedef struct
+{
+    double rx_ns;                       /**< Receptions, per cycle */
+    double main_ns;                     /**< Main function, per cycle */
+    uint32 timeouts;                    /**< Missed deadlines */
+} BenchResultType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Reception schedule: PDUs received in cycle c are Bench_Rx[Bench_RxStart[c] .. Bench_RxStart[c + 1]) */
+static uint32 *Bench_Rx;
+static uint32 Bench_RxStart[BENCH_CYCLES + 1U];
+
+static uint32 Bench_Timeout[BENCH_MAX_PDUS];
+
+/* Counter scan, as in com_stack.c */
+static uint32 Bench_Deadline[BENCH_MAX_PDUS];
+
+/* Timing wheel */
+static TimerMgr_WheelType Bench_Wheel;
+static TimerMgr_TimerType Bench_Timer[BENCH_MAX_PDUS];
+static TimerMgr_TickType Bench_RxStamp[BENCH_MAX_PDUS];
+
+static volatile uint32 Bench_Sink;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static boolean Bench_TimedOut(PduIdType ipdu)
+{
+    boolean timed_out = FALSE;
+
+    (void)Com_GetRxDeadlineStatus(ipdu, &timed_out);
+
+    return timed_out;
+}
+
+static Com_SignalIdType Bench_FirstSignal(PduIdType ipdu)
+{
+    Com_SignalIdType id;
+
+    for (id = 0U; id < COM_SIGNAL_COUNT; id++)
+    {
+        if (Com_Signal[id].ipdu == ipdu)
+        {
+            break;
+        }
+    }
+
+    return id;
+}
+
+/**
+ * @brief Part 1: deadline monitoring of com_stack.c
+ * @return Number of failed checks
+ */
+static uint32 Bench_CheckCom(void)
+{
+    const PduIdType aps = ComConf_ComIPdu_APS_Pedals;
+    const PduIdType dcdc = ComConf_ComIPdu_DCDC_Status;
+    const Com_SignalIdType signal = Bench_FirstSignal(aps);
+    uint8 payload[64];
+    PduInfoType info;
+    uint64 init = 0U;
+    uint64 value;
+    uint32 aps_timeout_cycle = 0U;
+    uint32 dcdc_timeout_cycle = 0U;
+    uint32 replaced = 0U;
+    uint32 spurious = 0U;
+    uint32 errors = 0U;
+    uint32 cycle;
+    PduIdType id;
+
+    (void)memset(payload, 0xA5, sizeof(payload));
+    info.SduDataPtr = payload;
+
+    Com_Init();
+    (void)Com_ReceiveSignal(signal, &init);
+
+    for (cycle = 0U; cycle < BENCH_COM_CYCLES; cycle++)
+    {
+        for (id = 0U; id < COM_IPDU_COUNT; id++)
+        {
+            if ((Com_IPdu[id].direction != (uint8)COM_RECEIVE) || (id == dcdc) ||
+                ((id == aps) && (cycle >= BENCH_SILENCE_START) && (cycle < BENCH_SILENCE_END)))
+            {
+                continue;
+            }
+            info.SduLength = Com_IPdu[id].length;
+            Com_RxIndication(id, &info);
+        }
+
+        Com_MainFunctionRx();
+
+        if ((aps_timeout_cycle == 0U) && (Bench_TimedOut(aps) == TRUE))
+        {
+            aps_timeout_cycle = cycle;
+            value = 0U;
+            (void)Com_ReceiveSignal(signal, &value);
+            replaced = (value == init) ? 1U : 0U;
+        }
+        if ((dcdc_timeout_cycle == 0U) && (Bench_TimedOut(dcdc) == TRUE))
+        {
+            dcdc_timeout_cycle = cycle;
+        }
+        for (id = 0U; id < COM_IPDU_COUNT; id++)
+        {
+            if ((Com_IPdu[id].direction == (uint8)COM_RECEIVE) && (id != aps) && (id != dcdc) &&
+                (Bench_TimedOut(id) == TRUE))
+            {
+                spurious++;
+            }
+        }
+    }
+
+    (void)printf("APS_Pedals:  last reception cycle %u, timed out in cycle %u (ComTimeout %u cycles), "
+                 "%s, %s after reception\n",
+                 (unsigned)(BENCH_SILENCE_START - 1U), (unsigned)aps_timeout_cycle,
+                 (unsigned)Com_IPdu[aps].timeout, (replaced != 0U) ? "replaced" : "NOT replaced",
+                 (Bench_TimedOut(aps) == FALSE) ? "recovered" : "NOT recovered");
+    (void)printf("DCDC_Status: never received, timed out in cycle %u (ComFirstTimeout %u cycles)\n",
+                 (unsigned)dcdc_timeout_cycle, (unsigned)Com_IPdu[dcdc].first_timeout);
+    (void)printf("other I-PDUs: %u spurious timeouts\n\n", (unsigned)spurious);
+
+    /* A reception in cycle c is missed in cycle c + timeout - 1 (one cycle per main function) */
+    if (aps_timeout_cycle != ((BENCH_SILENCE_START - 1U) + Com_IPdu[aps].timeout - 1U))
+    {
+        errors++;
+    }
+    if (dcdc_timeout_cycle != (Com_IPdu[dcdc].first_timeout - 1U))
+    {
+        errors++;
+    }
+    if ((replaced == 0U) || (Bench_TimedOut(aps) == TRUE) || (spurious != 0U))
+    {
+        errors++;
+    }
+
+    Com_DeInit();
+    return errors;
+}
+
+/**
+ * @brief Build a reception schedule: PDU i sent every period[i] cycles (0: never)
+ */
+static void Bench_Schedule(uint32 pdus, const uint32 *period)
+{
+    uint32 silent_until[BENCH_MAX_PDUS];
+    uint32 seed = 0x2545F491UL;
+    uint32 count = 0U;
+    uint32 cycle;
+    uint32 i;
+
+    for (i = 0U; i < pdus; i++)
+    {
+        silent_until[i] = 0U;
+    }
+
+    for (cycle = 0U; cycle < BENCH_CYCLES; cycle++)
+    {
+        Bench_RxStart[cycle] = count;
+        for (i = 0U; i < pdus; i++)
+        {
+            if ((Bench_Random(&seed) % BENCH_SILENCE_RATE) == 0U)
+            {
+                silent_until[i] = cycle + BENCH_SILENCE_CYCLES;
+            }
+            if ((period[i] != 0U) && ((cycle % period[i]) == (i % period[i])) &&
+                (cycle >= silent_until[i]) && ((Bench_Random(&seed) % BENCH_DROP_RATE) != 0U))
+            {
+                Bench_Rx[count] = i;
+                count++;
+            }
+        }
+    }
+    Bench_RxStart[BENCH_CYCLES] = count;
+}
+
+/**
+ * @brief Build the reception schedule of Part 3 for N PDUs
+ */
+static void Bench_ScheduleModel(uint32 pdus)
+{
+    uint32 period[BENCH_MAX_PDUS];
+    uint32 seed = 0x9E3779B9UL;
+    uint32 i;
+
+    for (i = 0U; i < pdus; i++)
+    {
+        period[i] = 2U + (Bench_Random(&seed) % 9U);
+        Bench_Timeout[i] = 3U * period[i];
+    }
+
+    Bench_Schedule(pdus, period);
+}
+
+/**
+ * @brief Replay the schedule on com_stack.c
+ * @param[in] main_function Call Com_MainFunctionRx() after the receptions of each cycle
+ * @return Host time per cycle [ns]
+ */
+static double Bench_RunCom(boolean main_function)
+{
+    uint8 payload[64];
+    PduInfoType info;
+    uint32 run;
+    uint32 cycle;
+    uint32 i;
+    double t0;
+
+    (void)memset(payload, 0x5A, sizeof(payload));
+    info.SduDataPtr = payload;
+    info.MetaDataPtr = NULL_PTR;
+
+    Com_Init();
+    t0 = Bench_NowNs();
+    for (run = 0U; run < BENCH_COM_RUNS; run++)
+    {
+        for (cycle = 0U; cycle < BENCH_CYCLES; cycle++)
+        {
+            for (i = Bench_RxStart[cycle]; i < Bench_RxStart[cycle + 1U]; i++)
+            {
+                info.SduLength = Com_IPdu[Bench_Rx[i]].length;
+                Com_RxIndication((PduIdType)Bench_Rx[i], &info);
+            }
+            if (main_function == TRUE)
+            {
+                Com_MainFunctionRx();
+            }
+        }
+    }
+    t0 = (Bench_NowNs() - t0) / ((double)BENCH_COM_RUNS * (double)BENCH_CYCLES);
+    Com_DeInit();
+
+    return t0;
+}
+
+/**
+ * @brief Part 2: cost of the real reception path per Com_MainFunctionRx() cycle
+ */
+static void Bench_MeasureCom(void)
+{
+    uint32 period[COM_IPDU_COUNT];
+    uint32 monitored = 0U;
+    uint32 deferred = 0U;
+    double rx_ns;
+    double total_ns;
+    double receptions;
+    PduIdType id;
+
+    for (id = 0U; id < COM_IPDU_COUNT; id++)
+    {
+        period[id] = 0U;
+        if (Com_IPdu[id].direction == (uint8)COM_RECEIVE)
+        {
+            period[id] = (Com_IPdu[id].timeout >= 3U) ? (Com_IPdu[id].timeout / 3U) : 1U;
+            monitored += (Com_IPdu[id].timeout != 0U) ? 1U : 0U;
+            deferred += (Com_IPdu[id].processing == (uint8)COM_DEFERRED) ? 1U : 0U;
+        }
+    }
+    Bench_Schedule(COM_IPDU_COUNT, period);
+    receptions = (double)Bench_RxStart[BENCH_CYCLES] / (double)BENCH_CYCLES;
+
+    rx_ns = Bench_RunCom(FALSE);
+    total_ns = Bench_RunCom(TRUE);
+
+    (void)printf("com.arxml: %u I-PDUs, %u monitored, %u DEFERRED; %.1f receptions per cycle\n",
+                 (unsigned)COM_IPDU_COUNT, (unsigned)monitored, (unsigned)deferred, receptions);
+    (void)printf("per cycle: Com_RxIndication %.1f ns (%.1f ns each), Com_MainFunctionRx %.1f ns, "
+                 "total %.1f ns\n\n",
+                 rx_ns, rx_ns / receptions, total_ns - rx_ns, total_ns);
+}
+
+static void Bench_RunScan(uint32 pdus, BenchResultType *result)
+{
+    uint32 cycle;
+    uint32 i;
+    double t0;
+    double t1;
+    double t2;
+
+    result->rx_ns = 0.0;
+    result->main_ns = 0.0;
+    result->timeouts = 0U;
+
+    for (i = 0U; i < pdus; i++)
+    {
+        Bench_Deadline[i] = Bench_Timeout[i];
+    }
+
+    for (cycle = 0U; cycle < BENCH_CYCLES; cycle++)
+    {
+        t0 = Bench_NowNs();
+        for (i = Bench_RxStart[cycle]; i < Bench_RxStart[cycle + 1U]; i++)
+        {
+            Bench_Deadline[Bench_Rx[i]] = cycle + Bench_Timeout[Bench_Rx[i]];
+        }
+        t1 = Bench_NowNs();
+        for (i = 0U; i < pdus; i++)
+        {
+            if (Bench_Deadline[i] == (cycle + 1U))
+            {
+                result->timeouts++;
+            }
+        }
+        t2 = Bench_NowNs();
+        result->rx_ns += t1 - t0;
+        result->main_ns += t2 - t1;
+    }
+
+    result->rx_ns /= (double)BENCH_CYCLES;
+    result->main_ns /= (double)BENCH_CYCLES;
+}
+
+/**
+ * @brief Replay the schedule of Part 3 on a timing wheel
+ * @param[in] lazy FALSE: a reception re-arms the timer; TRUE: a reception
+ *                 stamps the wheel time, an expired timer re-inserts itself
+ *                 for the rest of the deadline if its I-PDU was received meanwhile
+ */
+static void Bench_RunWheel(uint32 pdus, boolean lazy, BenchResultType *result)
+{
+    TimerMgr_TimerType *expired[BENCH_DRAIN_BATCH];
+    TimerMgr_TickType elapsed;
+    uint32 count;
+    uint32 cycle;
+    uint32 pdu;
+    uint32 i;
+    double t0;
+    double t1;
+    double t2;
+
+    result->rx_ns = 0.0;
+    result->main_ns = 0.0;
+    result->timeouts = 0U;
+
+    TimerMgr_Init(&Bench_Wheel, 0U);
+    for (i = 0U; i < pdus; i++)
+    {
+        TimerMgr_InitTimer(&Bench_Timer[i], NULL_PTR, NULL_PTR);
+        (void)TimerMgr_Start(&Bench_Wheel, &Bench_Timer[i], Bench_Timeout[i], 0U);
+        Bench_RxStamp[i] = (TimerMgr_TickType)0UL - Bench_Timeout[i];
+    }
+
+    for (cycle = 0U; cycle < BENCH_CYCLES; cycle++)
+    {
+        t0 = Bench_NowNs();
+        for (i = Bench_RxStart[cycle]; i < Bench_RxStart[cycle + 1U]; i++)
+        {
+            pdu = Bench_Rx[i];
+            if (lazy == FALSE)
+            {
+                (void)TimerMgr_Start(&Bench_Wheel, &Bench_Timer[pdu], Bench_Timeout[pdu], 0U);
+            }
+            else
+            {
+                Bench_RxStamp[pdu] = TimerMgr_GetTime(&Bench_Wheel);
+                if (TimerMgr_IsActive(&Bench_Timer[pdu]) == FALSE)
+                {
+                    (void)TimerMgr_Start(&Bench_Wheel, &Bench_Timer[pdu], Bench_Timeout[pdu], 0U);
+                }
+            }
+        }
+        t1 = Bench_NowNs();
+        if (TimerMgr_Tick(&Bench_Wheel) != 0U)
+        {
+            do
+            {
+                count = TimerMgr_DrainExpired(&Bench_Wheel, expired, BENCH_DRAIN_BATCH);
+                for (i = 0U; i < count; i++)
+                {
+                    pdu = (uint32)(expired[i] - Bench_Timer);
+                    elapsed = TimerMgr_GetTime(&Bench_Wheel) - Bench_RxStamp[pdu];
+                    if ((lazy == TRUE) && (elapsed < Bench_Timeout[pdu]))
+                    {
+                        (void)TimerMgr_Start(&Bench_Wheel, expired[i], Bench_Timeout[pdu] - elapsed, 0U);
+                    }
+                    else
+                    {
+                        Bench_Sink += pdu;
+                        result->timeouts++;
+                    }
+                }
+            } while (count == BENCH_DRAIN_BATCH);
+        }
+        t2 = Bench_NowNs();
+        result->rx_ns += t1 - t0;
+        result->main_ns += t2 - t1;
+    }
+
+    result->rx_ns /= (double)BENCH_CYCLES;
+    result->main_ns /= (double)BENCH_CYCLES;
+}
+
+/*==================================================================================================
+*                                   LOWER LAYER STUBS
+==================================================================================================*/
+
+/* Com_MainFunctionTx() is not called here; com_stack.c is linked without the PduR */
+Std_ReturnType PduR_ComTransmitBatch(const PduIdType *TxPduIds, const PduInfoType *PduInfos, uint16 Count)
+{
+    (void)TxPduIds;
+    (void)PduInfos;
+    (void)Count;
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    static const uint32 sizes[] = { 16U, 128U, 1024U, 4096U };
+    BenchResultType scan;
+    BenchResultType wheel;
+    BenchResultType lazy;
+    uint32 i;
+    int status = EXIT_SUCCESS;
+
+    if (Bench_CheckCom() != 0U)
+    {
+        (void)printf("ERROR: COM deadline monitoring check failed\n");
+        status = EXIT_FAILURE;
+    }
+
+    Bench_Rx = (uint32 *)malloc(sizeof(uint32) * BENCH_MAX_PDUS * BENCH_CYCLES);
+    if (Bench_Rx == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    Bench_MeasureCom();
+
+    (void)printf("%6s %9s | %9s %9s %9s | %9s %9s %9s | %9s %9s %9s | %9s\n", "PDUs", "rx/cycle",
+                 "scan rx", "main", "total[ns]", "wheel rx", "main", "total[ns]",
+                 "lazy rx", "main", "total[ns]", "timeouts");
+
+    for (i = 0U; i < ARRAY_SIZE(sizes); i++)
+    {
+        Bench_ScheduleModel(sizes[i]);
+        Bench_RunScan(sizes[i], &scan);
+        Bench_RunWheel(sizes[i], FALSE, &wheel);
+        Bench_RunWheel(sizes[i], TRUE, &lazy);
+
+        (void)printf("%6u %9.1f | %9.1f %9.1f %9.1f | %9.1f %9.1f %9.1f | %9.1f %9.1f %9.1f | %9u\n",
+                     (unsigned)sizes[i], (double)Bench_RxStart[BENCH_CYCLES] / (double)BENCH_CYCLES,
+                     scan.rx_ns, scan.main_ns, scan.rx_ns + scan.main_ns,
+                     wheel.rx_ns, wheel.main_ns, wheel.rx_ns + wheel.main_ns,
+                     lazy.rx_ns, lazy.main_ns, lazy.rx_ns + lazy.main_ns, (unsigned)scan.timeouts);
+        if ((wheel.timeouts != scan.timeouts) || (lazy.timeouts != scan.timeouts))
+        {
+            (void)printf("ERROR: timing wheels and counter scan disagree\n");
+            status = EXIT_FAILURE;
+        }
+    }
+
+    free(Bench_Rx);
+    return status;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,395 @@
+/**
+ * @file    bench_com_pack.c
+ * @brief   Host benchmark: generated COM pack/unpack kernels vs. table-interpreted signal copy
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Compares the kernels generated by tools/com/com_generator.py against the
+ * classic table-driven COM implementation, which walks a per-signal layout
+ * table (bit position, size, byte order) at runtime and moves each signal
+ * byte by byte with read-modify-write masks.
+ *
+ * Workloads (64-byte CAN-FD I-PDUs of com.arxml):
+ * - pack Intel:      VCU_PowertrainData (32 LITTLE_ENDIAN signals)
+ * - pack Motorola:   VCU_PowertrainDataMot (the same signals, BIG_ENDIAN)
+ * - unpack Intel:    BMS_CellVoltages1 (34 LITTLE_ENDIAN signals)
+ *
+ * Every workload runs with random signal values / PDU contents, and the
+ * result of the generated kernel is compared with the interpreter's, so
+ * the benchmark doubles as a functional check of the generated layout
+ * against the trivially correct bytewise reference.
+ *
+ * Build (host toolchain profile; the layout table is only compiled in for
+ * the reference):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DCOM_DEV_ERROR_DETECT=STD_OFF -DCOM_SIGNAL_LAYOUT_TABLE=STD_ON \
+ *     -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     -Iplatform/baremetal_core/timing \
+ *     test/benchmark/bench_com_pack.c src/bsw/com/com_stack.c src/bsw/com/com_cfg.c \
+ *     platform/baremetal_core/timing/timer_manager.c -o bench_com_pack
+ * @endcode
+ *
+ * @see com_stack.h
+ * @see com_pack.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "com_stack.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_ITERATIONS                        200000U
+#define BENCH_CHECK_ROUNDS                      1000U
+#define BENCH_MAX_PDU_SIGNALS                   64U
+
+#if (COM_SIGNAL_LAYOUT_TABLE != STD_ON)
+    #error "bench_com_pack.c needs -DCOM_SIGNAL_LAYOUT_TABLE=STD_ON"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+typedef struct
+{
+    const char *name;
+    PduIdType ipdu;
+    boolean pack;                       /**< TRUE: pack kernel, FALSE: unpack kernel */
+} BenchWorkloadType;
+
+typedef struct
+{
+    double generated_ns;
+    double interpreted_ns;
+    uint32 mismatches;
+} BenchResultType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static Com_SignalIdType Bench_Signals[BENCH_MAX_PDU_SIGNALS];
+static uint32 Bench_SignalCount;
+
+static uint8 Bench_Pdu[64];
+static uint64 Bench_Values[BENCH_MAX_PDU_SIGNALS];
+
+static volatile uint32 Bench_Sink;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static void Bench_CollectSignals(PduIdType ipdu)
+{
+    Com_SignalIdType id;
+
+    Bench_SignalCount = 0U;
+    for (id = 0U; id < COM_SIGNAL_COUNT; id++)
+    {
+        if ((Com_Signal[id].ipdu == ipdu) && (Bench_SignalCount < BENCH_MAX_PDU_SIGNALS))
+        {
+            Bench_Signals[Bench_SignalCount] = id;
+            Bench_SignalCount++;
+        }
+    }
+}
+
+/** @brief Signal value of the shadow, zero-extended */
+static uint64 Bench_GetValue(Com_SignalIdType id)
+{
+    const Com_SignalConfigType *signal = &Com_Signal[id];
+    uint8 v8;
+    uint16 v16;
+    uint32 v32;
+    uint64 v64;
+
+    switch (signal->size)
+    {
+        case 1U:  (void)memcpy(&v8, signal->value, 1U);  return v8;
+        case 2U:  (void)memcpy(&v16, signal->value, 2U); return v16;
+        case 4U:  (void)memcpy(&v32, signal->value, 4U); return v32;
+        default:  (void)memcpy(&v64, signal->value, 8U); return v64;
+    }
+}
+
+/** @brief Signal value of the C type of the signal, from its low ComBitSize bits (sign-extended) */
+static uint64 Bench_Normalize(Com_SignalIdType id, uint64 raw)
+{
+    const Com_SignalLayoutType *layout = &Com_SignalLayout[id];
+    uint64 mask = (layout->bit_size == 64U) ? ~0ULL : ((1ULL << layout->bit_size) - 1ULL);
+    uint64 value = raw & mask;
+    uint64 type_mask = (Com_Signal[id].size == 8U) ? ~0ULL : ((1ULL << (8U * Com_Signal[id].size)) - 1ULL);
+
+    if ((layout->is_signed == TRUE) && (layout->bit_size < 64U) && (((value >> (layout->bit_size - 1U)) & 1ULL) != 0ULL))
+    {
+        value |= ~mask;
+    }
+    return value & type_mask;
+}
+
+/* ----------------------------------- table-driven reference ---------------------------------- */
+
+/** @brief Next byte of a signal: Intel towards higher, Motorola towards lower addresses */
+static sint32 Bench_NextByte(const Com_SignalLayoutType *layout, sint32 byte)
+{
+    return (layout->big_endian == TRUE) ? (byte - 1) : (byte + 1);
+}
+
+static void Bench_InterpretedPack(uint8 *pdu)
+{
+    uint32 i;
+
+    for (i = 0U; i < Bench_SignalCount; i++)
+    {
+        const Com_SignalLayoutType *layout = &Com_SignalLayout[Bench_Signals[i]];
+        uint64 value = Bench_GetValue(Bench_Signals[i]);
+        sint32 byte = (sint32)(layout->bit_position / 8U);
+        uint32 offset = layout->bit_position % 8U;
+        uint32 remaining = layout->bit_size;
+
+        while (remaining > 0U)
+        {
+            uint32 bits = ((8U - offset) < remaining) ? (8U - offset) : remaining;
+            uint8 mask = (uint8)(((1U << bits) - 1U) << offset);
+
+            pdu[byte] = (uint8)((pdu[byte] & (uint8)~mask) | ((uint8)(value << offset) & mask));
+            value >>= bits;
+            remaining -= bits;
+            offset = 0U;
+            byte = Bench_NextByte(layout, byte);
+        }
+    }
+}
+
+static void Bench_InterpretedUnpack(const uint8 *pdu, uint64 *values)
+{
+    uint32 i;
+
+    for (i = 0U; i < Bench_SignalCount; i++)
+    {
+        const Com_SignalLayoutType *layout = &Com_SignalLayout[Bench_Signals[i]];
+        sint32 byte = (sint32)(layout->bit_position / 8U);
+        uint32 offset = layout->bit_position % 8U;
+        uint32 done = 0U;
+        uint64 value = 0U;
+
+        while (done < layout->bit_size)
+        {
+            uint32 remaining = layout->bit_size - done;
+            uint32 bits = ((8U - offset) < remaining) ? (8U - offset) : remaining;
+
+            value |= (uint64)((pdu[byte] >> offset) & ((1U << bits) - 1U)) << done;
+            done += bits;
+            offset = 0U;
+            byte = Bench_NextByte(layout, byte);
+        }
+        values[i] = Bench_Normalize(Bench_Signals[i], value);
+    }
+}
+
+/* --------------------------------------------- runs ------------------------------------------ */
+
+static void Bench_RandomSignals(uint32 *seed)
+{
+    uint32 i;
+
+    for (i = 0U; i < Bench_SignalCount; i++)
+    {
+        uint64 value = ((uint64)Bench_Random(seed) << 32) | Bench_Random(seed);
+
+        if (Com_Signal[Bench_Signals[i]].size == 1U)
+        {
+            value &= (Com_SignalLayout[Bench_Signals[i]].bit_size == 1U) ? 1ULL : 0xFFULL;
+        }
+        (void)Com_SendSignal(Bench_Signals[i], &value);     /* Low bytes: little-endian host */
+    }
+}
+
+static void Bench_RunPack(PduIdType ipdu, BenchResultType *result)
+{
+    const Com_IPduConfigType *config = &Com_IPdu[ipdu];
+    uint32 seed = 0x12345678UL;
+    uint32 round;
+    uint32 i;
+    double t0;
+
+    result->mismatches = 0U;
+    for (round = 0U; round < BENCH_CHECK_ROUNDS; round++)
+    {
+        Bench_RandomSignals(&seed);
+        for (i = 0U; i < config->length; i++)
+        {
+            config->data[i] = (uint8)Bench_Random(&seed);
+        }
+        (void)memcpy(Bench_Pdu, config->data, config->length);
+        config->pack();
+        Bench_InterpretedPack(Bench_Pdu);
+        if (memcmp(Bench_Pdu, config->data, config->length) != 0)
+        {
+            result->mismatches++;
+        }
+    }
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        config->pack();
+        Bench_Sink += config->data[i & 63U];
+    }
+    result->generated_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Bench_InterpretedPack(Bench_Pdu);
+        Bench_Sink += Bench_Pdu[i & 63U];
+    }
+    result->interpreted_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+}
+
+static void Bench_RunUnpack(PduIdType ipdu, BenchResultType *result)
+{
+    const Com_IPduConfigType *config = &Com_IPdu[ipdu];
+    uint32 seed = 0x9E3779B9UL;
+    uint32 round;
+    uint32 i;
+    double t0;
+
+    result->mismatches = 0U;
+    for (round = 0U; round < BENCH_CHECK_ROUNDS; round++)
+    {
+        for (i = 0U; i < config->length; i++)
+        {
+            config->data[i] = (uint8)Bench_Random(&seed);
+        }
+        config->unpack();
+        Bench_InterpretedUnpack(config->data, Bench_Values);
+        for (i = 0U; i < Bench_SignalCount; i++)
+        {
+            if (Bench_GetValue(Bench_Signals[i]) != Bench_Values[i])
+            {
+                result->mismatches++;
+            }
+        }
+    }
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        config->data[0] = (uint8)i;
+        config->unpack();
+        Bench_Sink += (uint32)Bench_GetValue(Bench_Signals[0]);
+    }
+    result->generated_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        config->data[0] = (uint8)i;
+        Bench_InterpretedUnpack(config->data, Bench_Values);
+        Bench_Sink += (uint32)Bench_Values[0];
+    }
+    result->interpreted_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+}
+
+/*==================================================================================================
+*                                   LOWER LAYER STUBS
+==================================================================================================*/
+
+/* Com_MainFunctionTx() is not called here; com_stack.c is linked without the PduR */
+Std_ReturnType PduR_ComTransmitBatch(const PduIdType *TxPduIds, const PduInfoType *PduInfos, uint16 Count)
+{
+    (void)TxPduIds;
+    (void)PduInfos;
+    (void)Count;
+    return E_OK;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    static const BenchWorkloadType workloads[] = {
+        { "pack Intel", ComConf_ComIPdu_VCU_PowertrainData, TRUE },
+        { "pack Motorola", ComConf_ComIPdu_VCU_PowertrainDataMot, TRUE },
+        { "unpack Intel", ComConf_ComIPdu_BMS_CellVoltages1, FALSE }
+    };
+    BenchResultType result;
+    uint32 i;
+    int status = EXIT_SUCCESS;
+
+    Com_Init();
+
+    (void)printf("%-14s %6s %8s %15s %15s %8s %10s\n",
+                 "workload", "bytes", "signals", "generated[ns]", "interpreted[ns]", "speedup", "mismatches");
+
+    for (i = 0U; i < ARRAY_SIZE(workloads); i++)
+    {
+        const BenchWorkloadType *w = &workloads[i];
+
+        Bench_CollectSignals(w->ipdu);
+        if (w->pack == TRUE)
+        {
+            Bench_RunPack(w->ipdu, &result);
+        }
+        else
+        {
+            Bench_RunUnpack(w->ipdu, &result);
+        }
+
+        (void)printf("%-14s %6u %8u %15.1f %15.1f %7.1fx %10u\n", w->name, (unsigned)Com_IPdu[w->ipdu].length,
+                     (unsigned)Bench_SignalCount, result.generated_ns, result.interpreted_ns,
+                     result.interpreted_ns / result.generated_ns, (unsigned)result.mismatches);
+        if (result.mismatches != 0U)
+        {
+            (void)printf("ERROR: generated kernel differs from the layout table\n");
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
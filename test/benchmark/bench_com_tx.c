@@ -0,0 +1,575 @@
+/**
+ * @file    bench_com_tx.c
+ * @brief   Host benchmark: COM transmission modes and batched transmission per controller
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs com_stack.c and pdu_router.c with the configuration of com.arxml and
+ * pdu_router.arxml on stub lower layers. The CanIf and SoAd stubs fetch the
+ * PDUs with PduR_CanIfTriggerTransmit() / PduR_SoAdIfTriggerTransmit() and
+ * record per Com_MainFunctionTx() cycle which I-PDUs were sent, the bytes
+ * per controller and the calls made.
+ *
+ * Part 1 checks the transmission modes: for BENCH_TX_CYCLES cycles the
+ * signals of the DIRECT and MIXED I-PDUs are sent at random with random
+ * values (so TRIGGERED_ON_CHANGE signals sometimes keep their value). The
+ * I-PDUs sent in every cycle must match a reference model of the
+ * configuration: a request per elapsed period (cycle % period == offset)
+ * and per triggering signal, served once the minimum delay time since the
+ * last transmission elapsed. Every controller must get at most one call
+ * per cycle, and no I-PDU may go through the per-PDU transmit.
+ *
+ * Part 2 compares the cost of handing the same cycle (all TX I-PDUs due)
+ * to the lower layers: PduR_ComTransmitBatch(), one call per controller,
+ * against PduR_ComTransmit() per I-PDU, one call per destination. Each
+ * call to a stub costs BENCH_CALL_COST volatile accesses (driver entry,
+ * lock, controller state) and each frame BENCH_FRAME_COST (mailbox write).
+ *
+ * Part 3 runs the periodic I-PDUs alone for one hyperperiod and reports
+ * the largest byte count a controller gets in one cycle, against the same
+ * configuration with all offsets 0 (every periodic I-PDU in cycle 0).
+ *
+ * Build (host toolchain profile, single-threaded):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DCOM_DEV_ERROR_DETECT=STD_OFF -DPDUR_DEV_ERROR_DETECT=STD_OFF \
+ *     -DPDUPOOL_DEV_ERROR_DETECT=STD_OFF \
+ *     -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF -DTIMERMGR_DEV_ERROR_DETECT=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     -Iplatform/baremetal_core/timing \
+ *     test/benchmark/bench_com_tx.c src/bsw/com/com_stack.c src/bsw/com/com_cfg.c \
+ *     src/bsw/com/pdu_router.c src/bsw/com/pdur_cfg.c src/bsw/com/pdu_pool.c \
+ *     platform/baremetal_core/timing/timer_manager.c -o bench_com_tx
+ * @endcode
+ *
+ * @see com_stack.h
+ * @see pdu_router.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "com_stack.h"
+#include "pdu_router.h"
+#include "pdu_pool.h"
+#include "can_tp.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_TX_CYCLES                         2000U
+#define BENCH_SEND_RATE                         16U     /**< One Com_SendSignal() per signal in ... cycles */
+#define BENCH_LOAD_CYCLES                       2000U
+#define BENCH_ITERATIONS                        100000U
+#define BENCH_CALL_COST                         40U
+#define BENCH_FRAME_COST                        4U
+#define BENCH_MAX_MODULE_PDUS                   256U
+#define BENCH_NO_DEST                           0xFFFFU
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Destination of a CanIf / SoAd PDU handle, BENCH_NO_DEST if none */
+static uint16 Bench_DestOf[PDUR_BSW_MODULE_COUNT][BENCH_MAX_MODULE_PDUS];
+
+/* Per cycle, reset by Bench_StartCycle() */
+static boolean Bench_Sent[COM_IPDU_COUNT];
+static uint32 Bench_CycleBytes[PDUR_TX_CONTROLLER_COUNT];
+static uint32 Bench_CycleCalls[PDUR_TX_CONTROLLER_COUNT];
+
+/* Totals */
+static uint32 Bench_BatchCalls;
+static uint32 Bench_SingleCalls;
+static uint32 Bench_Frames;
+static uint32 Bench_Errors;
+
+static volatile uint32 Bench_Mailbox;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static void Bench_Work(uint32 cost)
+{
+    uint32 i;
+
+    for (i = 0U; i < cost; i++)
+    {
+        Bench_Mailbox += i;
+    }
+}
+
+static void Bench_StartCycle(void)
+{
+    (void)memset(Bench_Sent, 0, sizeof(Bench_Sent));
+    (void)memset(Bench_CycleBytes, 0, sizeof(Bench_CycleBytes));
+    (void)memset(Bench_CycleCalls, 0, sizeof(Bench_CycleCalls));
+}
+
+static void Bench_MapDestinations(void)
+{
+    uint16 index;
+
+    (void)memset(Bench_DestOf, 0xFF, sizeof(Bench_DestOf));
+    for (index = 0U; index < PDUR_DEST_PDU_COUNT; index++)
+    {
+        if (PduR_DestPdu[index].module_pdu < BENCH_MAX_MODULE_PDUS)
+        {
+            Bench_DestOf[PduR_DestPdu[index].module][PduR_DestPdu[index].module_pdu] = index;
+        }
+    }
+}
+
+/**
+ * @brief One frame of a lower layer: fetch it if triggered, account it to its controller and I-PDU
+ */
+static void Bench_Frame(uint8 module, PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    uint8 buffer[64];
+    PduInfoType fetched;
+    uint16 dest = (TxPduId < BENCH_MAX_MODULE_PDUS) ? Bench_DestOf[module][TxPduId] : BENCH_NO_DEST;
+    PduLengthType length = PduInfoPtr->SduLength;
+    const PduR_RoutingPathType *path;
+
+    if (dest == BENCH_NO_DEST)
+    {
+        Bench_Errors++;
+        return;
+    }
+    if (PduInfoPtr->SduDataPtr == NULL_PTR)
+    {
+        fetched.SduDataPtr = buffer;
+        fetched.MetaDataPtr = NULL_PTR;
+        fetched.SduLength = (PduLengthType)sizeof(buffer);
+        if (((module == PduRConf_PduRBswModule_CanIf) ? PduR_CanIfTriggerTransmit(dest, &fetched)
+                                                      : PduR_SoAdIfTriggerTransmit(dest, &fetched)) != E_OK)
+        {
+            Bench_Errors++;
+            return;
+        }
+        length = fetched.SduLength;
+    }
+
+    Bench_Work(BENCH_FRAME_COST);
+    Bench_Frames++;
+    Bench_CycleBytes[PduR_DestPdu[dest].controller] += length;
+    path = &PduR_RoutingPath[PduR_DestPdu[dest].path];
+    if (path->src_module == PduRConf_PduRBswModule_Com)
+    {
+        Bench_Sent[path->src_pdu] = TRUE;
+    }
+}
+
+static Std_ReturnType Bench_Batch(uint8 module, uint8 Controller, const PduIdType *TxPduIds,
+                                  const PduInfoType *PduInfos, uint16 Count)
+{
+    uint16 i;
+    uint8 c;
+
+    Bench_Work(BENCH_CALL_COST);
+    Bench_BatchCalls++;
+    for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+    {
+        if ((PduR_TxController[c].module == module) && (PduR_TxController[c].controller == Controller))
+        {
+            Bench_CycleCalls[c]++;
+        }
+    }
+    for (i = 0U; i < Count; i++)
+    {
+        Bench_Frame(module, TxPduIds[i], &PduInfos[i]);
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Transmissions of the I-PDUs in a Com_MainFunctionTx() cycle, per the configuration
+ */
+typedef struct
+{
+    boolean request[COM_IPDU_COUNT];
+    sint32 last[COM_IPDU_COUNT];
+} BenchReferenceType;
+
+static void Bench_ReferenceInit(BenchReferenceType *ref)
+{
+    PduIdType id;
+
+    for (id = 0U; id < COM_IPDU_COUNT; id++)
+    {
+        ref->request[id] = FALSE;
+        ref->last[id] = -(sint32)Com_IPdu[id].tx_mdt - 1;
+    }
+}
+
+static boolean Bench_ReferenceDue(BenchReferenceType *ref, PduIdType id, uint32 cycle)
+{
+    const Com_IPduConfigType *ipdu = &Com_IPdu[id];
+
+    if ((ipdu->tx_period != 0U) && ((cycle % ipdu->tx_period) == ipdu->tx_offset))
+    {
+        ref->request[id] = TRUE;
+    }
+    if ((ref->request[id] == TRUE) && (((sint32)cycle - ref->last[id]) >= (sint32)ipdu->tx_mdt))
+    {
+        ref->request[id] = FALSE;
+        ref->last[id] = (sint32)cycle;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Part 1: transmission modes, minimum delay time and one call per controller
+ * @return Number of failed checks
+ */
+static uint32 Bench_CheckModes(void)
+{
+    BenchReferenceType ref;
+    uint32 seed = 0x9E3779B9UL;
+    uint32 mismatches = 0U;
+    uint32 sent = 0U;
+    uint32 triggered = 0U;
+    uint32 repeated_calls = 0U;
+    uint32 cycle;
+    Com_SignalIdType sig;
+    PduIdType id;
+    uint8 c;
+
+    Com_Init();
+    PduR_Init();
+    Bench_ReferenceInit(&ref);
+    Bench_SingleCalls = 0U;
+    Bench_Errors = 0U;
+
+    for (cycle = 0U; cycle < BENCH_TX_CYCLES; cycle++)
+    {
+        Bench_StartCycle();
+
+        for (sig = 0U; sig < COM_SIGNAL_COUNT; sig++)
+        {
+            const Com_SignalConfigType *signal = &Com_Signal[sig];
+            uint8 mode = Com_IPdu[signal->ipdu].tx_mode;
+            uint64 old = 0U;
+            uint64 value;
+
+            if (((mode != (uint8)COM_TX_DIRECT) && (mode != (uint8)COM_TX_MIXED)) ||
+                ((Bench_Random(&seed) % BENCH_SEND_RATE) != 0U))
+            {
+                continue;
+            }
+            value = (uint64)(Bench_Random(&seed) & 1U);
+            (void)Com_ReceiveSignal(sig, &old);
+            if ((signal->transfer == (uint8)COM_TRIGGERED) ||
+                ((signal->transfer == (uint8)COM_TRIGGERED_ON_CHANGE) &&
+                 (memcmp(&old, &value, signal->size) != 0)))
+            {
+                ref.request[signal->ipdu] = TRUE;
+                triggered++;
+            }
+            (void)Com_SendSignal(sig, &value);
+        }
+
+        Com_MainFunctionTx();
+
+        for (id = 0U; id < COM_IPDU_COUNT; id++)
+        {
+            if (Com_IPdu[id].tx_mode == (uint8)COM_TX_NONE)
+            {
+                continue;
+            }
+            if (Bench_ReferenceDue(&ref, id, cycle) != Bench_Sent[id])
+            {
+                mismatches++;
+            }
+            sent += (Bench_Sent[id] == TRUE) ? 1U : 0U;
+        }
+        for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+        {
+            repeated_calls += (Bench_CycleCalls[c] > 1U) ? 1U : 0U;
+        }
+    }
+
+    (void)printf("Part 1: %u cycles, %u I-PDU transmissions, %u triggering sends, "
+                 "%u mismatches with the reference, %u controllers called twice in a cycle, "
+                 "%u per-PDU calls, %u stub errors\n\n",
+                 (unsigned)BENCH_TX_CYCLES, (unsigned)sent, (unsigned)triggered, (unsigned)mismatches,
+                 (unsigned)repeated_calls, (unsigned)Bench_SingleCalls, (unsigned)Bench_Errors);
+
+    Com_DeInit();
+    return mismatches + repeated_calls + Bench_SingleCalls + Bench_Errors + ((sent == 0U) ? 1U : 0U);
+}
+
+/**
+ * @brief Part 2: one cycle with every TX I-PDU due, batched vs. per I-PDU
+ */
+static void Bench_CompareBatch(void)
+{
+    PduIdType ids[COM_IPDU_COUNT];
+    PduInfoType infos[COM_IPDU_COUNT];
+    uint16 count = 0U;
+    uint32 iteration;
+    uint32 calls;
+    uint16 i;
+    PduIdType id;
+    double t0;
+    double batch_ns;
+    double single_ns;
+
+    Com_Init();
+    PduR_Init();
+    for (id = 0U; id < COM_IPDU_COUNT; id++)
+    {
+        if (Com_IPdu[id].tx_mode != (uint8)COM_TX_NONE)
+        {
+            ids[count] = Com_IPdu[id].pdur_pdu;
+            infos[count].SduDataPtr = Com_IPdu[id].data;
+            infos[count].MetaDataPtr = NULL_PTR;
+            infos[count].SduLength = Com_IPdu[id].length;
+            count++;
+        }
+    }
+
+    Bench_BatchCalls = 0U;
+    Bench_SingleCalls = 0U;
+    Bench_Frames = 0U;
+    t0 = Bench_NowNs();
+    for (iteration = 0U; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        (void)PduR_ComTransmitBatch(ids, infos, count);
+    }
+    batch_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+    calls = Bench_BatchCalls;
+
+    t0 = Bench_NowNs();
+    for (iteration = 0U; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            (void)PduR_ComTransmit(ids[i], &infos[i]);
+        }
+    }
+    single_ns = (Bench_NowNs() - t0) / (double)BENCH_ITERATIONS;
+
+    (void)printf("Part 2: %u I-PDUs, %u frames per cycle\n", (unsigned)count,
+                 (unsigned)(Bench_Frames / (2U * BENCH_ITERATIONS)));
+    (void)printf("%-26s %14s %14s\n", "", "calls/cycle", "ns/cycle");
+    (void)printf("%-26s %14u %14.1f\n", "PduR_ComTransmitBatch()", (unsigned)(calls / BENCH_ITERATIONS), batch_ns);
+    (void)printf("%-26s %14u %14.1f\n\n", "PduR_ComTransmit() x N",
+                 (unsigned)(Bench_SingleCalls / BENCH_ITERATIONS), single_ns);
+
+    Com_DeInit();
+}
+
+/**
+ * @brief Part 3: peak bytes per controller and cycle of the periodic I-PDUs
+ * @return Number of failed checks
+ */
+static uint32 Bench_CheckLoad(void)
+{
+    uint32 peak[PDUR_TX_CONTROLLER_COUNT];
+    uint32 unspread[PDUR_TX_CONTROLLER_COUNT];
+    uint32 errors = 0U;
+    uint32 cycle;
+    uint16 index;
+    PduIdType id;
+    uint8 c;
+
+    (void)memset(peak, 0, sizeof(peak));
+    (void)memset(unspread, 0, sizeof(unspread));
+
+    for (id = 0U; id < COM_IPDU_COUNT; id++)
+    {
+        const PduR_RoutingPathType *path = &PduR_RoutingPath[Com_IPdu[id].pdur_pdu];
+
+        if (Com_IPdu[id].tx_period == 0U)
+        {
+            continue;
+        }
+        for (index = path->dest_first; index < (path->dest_first + path->dest_count); index++)
+        {
+            if (PduR_DestPdu[index].controller != PDUR_NO_TX_CONTROLLER)
+            {
+                unspread[PduR_DestPdu[index].controller] += Com_IPdu[id].length;
+            }
+        }
+    }
+
+    Com_Init();
+    PduR_Init();
+    for (cycle = 0U; cycle < BENCH_LOAD_CYCLES; cycle++)
+    {
+        Bench_StartCycle();
+        Com_MainFunctionTx();
+        for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+        {
+            peak[c] = (Bench_CycleBytes[c] > peak[c]) ? Bench_CycleBytes[c] : peak[c];
+        }
+    }
+    Com_DeInit();
+
+    (void)printf("Part 3: periodic bytes in the busiest cycle (%u cycles of %lu us)\n",
+                 (unsigned)BENCH_LOAD_CYCLES, (unsigned long)COM_MAIN_FUNCTION_TX_PERIOD_US);
+    (void)printf("%-12s %18s %18s\n", "controller", "generated offsets", "all offsets 0");
+    for (c = 0U; c < PDUR_TX_CONTROLLER_COUNT; c++)
+    {
+        (void)printf("%-12u %18u %18u\n", (unsigned)c, (unsigned)peak[c], (unsigned)unspread[c]);
+        if (peak[c] > unspread[c])
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/*==================================================================================================
+*                                   LOWER LAYER STUBS
+==================================================================================================*/
+
+Std_ReturnType CanIf_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    Bench_Work(BENCH_CALL_COST);
+    Bench_SingleCalls++;
+    Bench_Frame(PduRConf_PduRBswModule_CanIf, TxPduId, PduInfoPtr);
+    return E_OK;
+}
+
+Std_ReturnType CanIf_TransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                   const PduInfoType *PduInfos, uint16 Count)
+{
+    return Bench_Batch(PduRConf_PduRBswModule_CanIf, Controller, TxPduIds, PduInfos, Count);
+}
+
+Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    Bench_Work(BENCH_CALL_COST);
+    Bench_SingleCalls++;
+    Bench_Frame(PduRConf_PduRBswModule_SoAd, TxPduId, PduInfoPtr);
+    return E_OK;
+}
+
+Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                    const PduInfoType *PduInfos, uint16 Count)
+{
+    return Bench_Batch(PduRConf_PduRBswModule_SoAd, Controller, TxPduIds, PduInfos, Count);
+}
+
+Std_ReturnType EthComm_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_OK;
+}
+
+Std_ReturnType CanTp_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+BufReq_ReturnType Dcm_StartOfReception(PduIdType id, const PduInfoType *info, PduLengthType TpSduLength,
+                                       PduLengthType *bufferSizePtr)
+{
+    (void)id;
+    (void)info;
+    (void)TpSduLength;
+    (void)bufferSizePtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+BufReq_ReturnType Dcm_CopyRxData(PduIdType id, const PduInfoType *info, PduLengthType *bufferSizePtr)
+{
+    (void)id;
+    (void)info;
+    (void)bufferSizePtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+void Dcm_TpRxIndication(PduIdType id, Std_ReturnType result)
+{
+    (void)id;
+    (void)result;
+}
+
+BufReq_ReturnType Dcm_CopyTxData(PduIdType id, const PduInfoType *info, const RetryInfoType *retry,
+                                 PduLengthType *availableDataPtr)
+{
+    (void)id;
+    (void)info;
+    (void)retry;
+    (void)availableDataPtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+void Dcm_TpTxConfirmation(PduIdType id, Std_ReturnType result)
+{
+    (void)id;
+    (void)result;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    int status = EXIT_SUCCESS;
+
+    PduPool_Init();
+    Bench_MapDestinations();
+
+    if (Bench_CheckModes() != 0U)
+    {
+        (void)printf("ERROR: COM transmission mode check failed\n");
+        status = EXIT_FAILURE;
+    }
+    Bench_CompareBatch();
+    if (Bench_CheckLoad() != 0U)
+    {
+        (void)printf("ERROR: offsets increase the peak load of a controller\n");
+        status = EXIT_FAILURE;
+    }
+
+    return status;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
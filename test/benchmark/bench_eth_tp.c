@@ -0,0 +1,493 @@
+/**
+ * @file    bench_eth_tp.c
+ * @brief   Host benchmark: EthTp batched UDP datagrams against one datagram per PDU
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs eth_tp.c with the generated configuration (eth_tp_cfg.c) against a
+ * simulated GMAC: eth_tp.c is included into this file, ETHTP_GMAC_WRITE()
+ * is redirected to Bench_GmacWrite(), which completes every descriptor up
+ * to the new tail pointer at once, as a DMA faster than the CPU would.
+ * PduR_SoAdIfTriggerTransmit() and PduR_SoAdIfRxIndication() are stubs.
+ *
+ * Phases:
+ * - Check: every transmit PDU is sent once with data and once through
+ *   PduR_SoAdIfTriggerTransmit(), and the datagrams are parsed and checked
+ *   against an independent RFC 1071 checksum and the expected PDU headers
+ *   and payload. A datagram with all receive routes of SoCon_Hpc, one
+ *   unknown header ID and a truncated PDU is passed to EthTp_RxIndication()
+ * - Throughput: the PDUs of SoCon_Hpc are sent for BENCH_CYCLES cycles,
+ *   batched (EthTp_MainFunctionTx() at the end of the cycle) and one
+ *   datagram per PDU (EthTp_MainFunctionTx() after every PDU): ns per PDU
+ *   on the host, datagrams and wire bytes per PDU (with preamble, FCS and
+ *   inter-frame gap) and the PDU rate this allows on 1 Gbit/s
+ *
+ * Build (host toolchain profile):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DETHTP_DEV_ERROR_DETECT=STD_OFF -DPDUPOOL_DEV_ERROR_DETECT=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     test/benchmark/bench_eth_tp.c src/bsw/com/eth_tp_cfg.c src/bsw/com/pdu_pool.c -o bench_eth_tp
+ * @endcode
+ *
+ * @see eth_tp.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "eth_tp.h"
+#include "pdu_router.h"
+
+/*==================================================================================================
+*                                     SIMULATED GMAC
+==================================================================================================*/
+
+static void Bench_GmacWrite(uint32 offset, uint32 value);
+
+#define ETHTP_GMAC_WRITE(offset, value)         Bench_GmacWrite((offset), (value))
+#define ETHTP_DMA_ADDRESS(ptr)                  ((uint32)(unsigned long)(ptr))
+
+#include "eth_tp.c"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_CYCLES                            200000U
+#define BENCH_PDUS_PER_CYCLE                    4U      /**< Sends of every SoCon_Hpc PDU per cycle */
+#define BENCH_FRAMES_MAX                        64U
+#define BENCH_WIRE_OVERHEAD                     24U     /**< Preamble, FCS, inter-frame gap */
+#define BENCH_LINK_BYTES_PER_S                  125.0e6 /**< 1 Gbit/s */
+
+/** @brief Address of the remote of SoCon_Hpc as the sender of the receive check */
+#define BENCH_SOCON_RX                          EthTpConf_EthTpSocketConnection_SoCon_Hpc
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+typedef struct
+{
+    double ns_per_pdu;
+    double datagrams_per_pdu;
+    double wire_bytes_per_pdu;
+} BenchResultType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/** @brief Frames completed by the simulated DMA (check phase only) */
+static uint8 Bench_Frame[BENCH_FRAMES_MAX][ETHTP_TX_BUFFER_SIZE];
+static uint32 Bench_FrameLength[BENCH_FRAMES_MAX];
+static uint32 Bench_FrameCount;
+static boolean Bench_Capture;
+
+static uint32 Bench_DmaNext;
+static uint64 Bench_WireBytes;
+static uint32 Bench_Errors;
+
+/** @brief Received PDUs per PduR source handle */
+static uint32 Bench_RxCount[256];
+static uint32 Bench_RxLength[256];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static uint8 Bench_Pattern(uint32 pdu, uint32 i)
+{
+    return (uint8)((pdu * 37U) + (i * 11U) + 1U);
+}
+
+/**
+ * @brief Simulated DMA: a tail pointer write completes all descriptors up to the tail
+ */
+static void Bench_GmacWrite(uint32 offset, uint32 value)
+{
+    uint32 slot, length;
+
+    (void)value;
+    if (offset != ETHTP_DMA_TXDESC_TAIL_PTR)
+    {
+        return;
+    }
+    while (Bench_DmaNext != EthTp_RingTail)
+    {
+        slot = Bench_DmaNext & ETHTP_RING_MASK;
+        length = EthTp_TxRing[slot].des3 & ETHTP_TDES3_FL_MASK;
+        if ((EthTp_TxRing[slot].des3 & ETHTP_TDES3_OWN) == 0UL)
+        {
+            Bench_Errors++;
+        }
+        if ((Bench_Capture == TRUE) && (Bench_FrameCount < BENCH_FRAMES_MAX))
+        {
+            (void)memcpy(Bench_Frame[Bench_FrameCount], EthTp_RingFrame[slot], length);
+            Bench_FrameLength[Bench_FrameCount] = length;
+            Bench_FrameCount++;
+        }
+        Bench_WireBytes += (uint64)length + BENCH_WIRE_OVERHEAD;
+        EthTp_TxRing[slot].des3 &= ~ETHTP_TDES3_OWN;
+        Bench_DmaNext++;
+    }
+}
+
+Std_ReturnType PduR_SoAdIfTriggerTransmit(PduIdType TxPduId, PduInfoType *PduInfoPtr)
+{
+    uint32 pdu, i;
+
+    for (pdu = 0U; pdu < ETHTP_TX_PDU_COUNT; pdu++)
+    {
+        if (EthTp_TxPdu[pdu].pdur_pdu == TxPduId)
+        {
+            break;
+        }
+    }
+    if ((pdu == ETHTP_TX_PDU_COUNT) || (PduInfoPtr->SduLength < EthTp_TxPdu[pdu].length))
+    {
+        return E_NOT_OK;
+    }
+    for (i = 0U; i < EthTp_TxPdu[pdu].length; i++)
+    {
+        PduInfoPtr->SduDataPtr[i] = Bench_Pattern(pdu, i);
+    }
+    PduInfoPtr->SduLength = EthTp_TxPdu[pdu].length;
+    return E_OK;
+}
+
+void PduR_SoAdIfRxIndication(PduIdType RxPduId, const PduInfoType *PduInfoPtr)
+{
+    uint32 i;
+
+    for (i = 0U; i < PduInfoPtr->SduLength; i++)
+    {
+        if (PduInfoPtr->SduDataPtr[i] != Bench_Pattern(RxPduId, i))
+        {
+            Bench_Errors++;
+            break;
+        }
+    }
+    Bench_RxCount[RxPduId & 0xFFU]++;
+    Bench_RxLength[RxPduId & 0xFFU] = PduInfoPtr->SduLength;
+}
+
+/**
+ * @brief Reference Internet checksum: plain RFC 1071 over a byte range
+ */
+static uint32 Bench_RefSum(uint32 sum, const uint8 *data, uint32 length)
+{
+    uint32 i;
+
+    for (i = 0U; i < length; i++)
+    {
+        sum += ((i & 1U) == 0U) ? ((uint32)data[i] << 8) : (uint32)data[i];
+    }
+    while ((sum >> 16) != 0U)
+    {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+    return sum;
+}
+
+static uint32 Bench_Get(const uint8 *p, uint32 n)
+{
+    uint32 value = 0U, i;
+
+    for (i = 0U; i < n; i++)
+    {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static void Bench_Put(uint8 *p, uint32 n, uint32 value)
+{
+    uint32 i;
+
+    for (i = 0U; i < n; i++)
+    {
+        p[i] = (uint8)(value >> (8U * (n - 1U - i)));
+    }
+}
+
+/**
+ * @brief Check headers and checksums of a captured frame and its PDUs
+ * @return PDUs in the datagram
+ */
+static uint32 Bench_CheckFrame(const uint8 *frame, uint32 length)
+{
+    const uint8 *ip = &frame[18], *udp = &frame[38];
+    uint32 ip_length = Bench_Get(&ip[2], 2U), udp_length = Bench_Get(&udp[4], 2U);
+    uint32 socon, sum, pos, id, pdu_length, pdu, i, pdus = 0U;
+    uint8 pseudo[12];
+
+    for (socon = 0U; socon < ETHTP_SOCON_COUNT; socon++)
+    {
+        if ((memcmp(frame, EthTp_SoCon[socon].remote_mac, 6U) == 0) &&
+            (Bench_Get(&ip[16], 4U) == EthTp_SoCon[socon].remote_ip) &&
+            (Bench_Get(&udp[2], 2U) == EthTp_SoCon[socon].remote_port))
+        {
+            break;
+        }
+    }
+    if ((socon == ETHTP_SOCON_COUNT) || (Bench_Get(&frame[12], 2U) != 0x8100U) ||
+        (Bench_Get(&frame[16], 2U) != 0x0800U) || (ip[0] != 0x45U) ||
+        (ip_length != (udp_length + 20U)) || ((ip_length + 18U) > length) ||
+        ((length > 60U) && ((ip_length + 18U) != length)) ||
+        (Bench_RefSum(0U, ip, 20U) != 0xFFFFU))
+    {
+        (void)printf("ERROR: frame headers or IPv4 checksum\n");
+        return 0U;
+    }
+
+    (void)memcpy(&pseudo[0], &ip[12], 8U);
+    pseudo[8] = 0U;
+    pseudo[9] = 17U;
+    Bench_Put(&pseudo[10], 2U, udp_length);
+    sum = Bench_RefSum(Bench_RefSum(0U, pseudo, 12U), udp, udp_length);
+    if ((EthTp_SoCon[socon].udp_checksum == TRUE) ? (sum != 0xFFFFU) : (Bench_Get(&udp[6], 2U) != 0U))
+    {
+        (void)printf("ERROR: UDP checksum of socket connection %u\n", (unsigned)socon);
+        Bench_Errors++;
+    }
+
+    for (pos = 8U; (pos + 8U) <= udp_length; pos += 8U + pdu_length)
+    {
+        id = Bench_Get(&udp[pos], 4U);
+        pdu_length = Bench_Get(&udp[pos + 4U], 4U);
+        for (pdu = 0U; pdu < ETHTP_TX_PDU_COUNT; pdu++)
+        {
+            if ((EthTp_TxPdu[pdu].header_id == id) && (EthTp_TxPdu[pdu].socon == socon))
+            {
+                break;
+            }
+        }
+        if ((pdu == ETHTP_TX_PDU_COUNT) || (pdu_length != EthTp_TxPdu[pdu].length))
+        {
+            Bench_Errors++;
+            break;
+        }
+        for (i = 0U; i < pdu_length; i++)
+        {
+            if (udp[pos + 8U + i] != Bench_Pattern(pdu, i))
+            {
+                Bench_Errors++;
+                break;
+            }
+        }
+        pdus++;
+    }
+    if (pos != udp_length)
+    {
+        Bench_Errors++;
+    }
+    return pdus;
+}
+
+/**
+ * @brief Datagram from the remote of SoCon_Hpc with every receive route,
+ *        one unknown header ID and a truncated PDU, built independently of eth_tp.c
+ */
+static uint32 Bench_BuildRxFrame(uint8 *frame)
+{
+    const EthTp_SoConConfigType *socon = &EthTp_SoCon[BENCH_SOCON_RX];
+    uint8 *ip = &frame[18], *udp = &frame[38];
+    uint32 pos = 8U, route, length, i;
+
+    (void)memset(frame, 0, ETHTP_TX_BUFFER_SIZE);
+    (void)memcpy(&frame[0], EthTp_SourceMac, 6U);
+    (void)memcpy(&frame[6], socon->remote_mac, 6U);
+    Bench_Put(&frame[12], 2U, 0x8100U);
+    Bench_Put(&frame[14], 2U, ETHTP_VLAN_TCI);
+    Bench_Put(&frame[16], 2U, 0x0800U);
+
+    for (route = socon->rx_route_first; route < (uint32)socon->rx_route_first + socon->rx_route_count; route++)
+    {
+        length = 1U + (route % 13U);
+        Bench_Put(&udp[pos], 4U, EthTp_RxRoute[route].header_id);
+        Bench_Put(&udp[pos + 4U], 4U, length);
+        for (i = 0U; i < length; i++)
+        {
+            udp[pos + 8U + i] = Bench_Pattern(EthTp_RxRoute[route].pdur_pdu, i);
+        }
+        pos += 8U + length;
+    }
+    Bench_Put(&udp[pos], 4U, 0xDEADBEEFUL);    /* Unknown header ID */
+    Bench_Put(&udp[pos + 4U], 4U, 2U);
+    pos += 10U;
+    Bench_Put(&udp[pos], 4U, EthTp_RxRoute[socon->rx_route_first].header_id);
+    Bench_Put(&udp[pos + 4U], 4U, 100U);       /* Longer than the rest of the datagram */
+    pos += 12U;
+
+    ip[0] = 0x45U;
+    Bench_Put(&ip[2], 2U, 20U + pos);
+    ip[6] = 0x40U;
+    ip[8] = 64U;
+    ip[9] = 17U;
+    Bench_Put(&ip[12], 4U, socon->remote_ip);
+    Bench_Put(&ip[16], 4U, ETHTP_LOCAL_IP_ADDRESS);
+    Bench_Put(&ip[10], 2U, ~Bench_RefSum(0U, ip, 20U) & 0xFFFFU);
+    Bench_Put(&udp[0], 2U, socon->remote_port);
+    Bench_Put(&udp[2], 2U, socon->local_port);
+    Bench_Put(&udp[4], 2U, pos);
+
+    return 18U + 20U + pos;
+}
+
+static void Bench_Check(void)
+{
+    static uint8 data[ETHTP_MAX_DATAGRAM_LENGTH];
+    static uint8 rx[ETHTP_TX_BUFFER_SIZE];
+    PduInfoType info;
+    EthTp_StatisticsType stats;
+    uint32 pdu, i, pdus = 0U, route, length;
+    const EthTp_SoConConfigType *socon = &EthTp_SoCon[BENCH_SOCON_RX];
+
+    Bench_Capture = TRUE;
+    for (pdu = 0U; pdu < ETHTP_TX_PDU_COUNT; pdu++)
+    {
+        for (i = 0U; i < EthTp_TxPdu[pdu].length; i++)
+        {
+            data[i] = Bench_Pattern(pdu, i);
+        }
+        info.SduDataPtr = data;
+        info.SduLength = EthTp_TxPdu[pdu].length;
+        if (EthTp_IfTransmit((PduIdType)pdu, &info) != E_OK)
+        {
+            Bench_Errors++;
+        }
+        info.SduDataPtr = NULL_PTR;
+        if (SoAd_IfTransmit((PduIdType)pdu, &info) != E_OK)
+        {
+            Bench_Errors++;
+        }
+    }
+    EthTp_MainFunctionTx();
+    Bench_Capture = FALSE;
+
+    for (i = 0U; i < Bench_FrameCount; i++)
+    {
+        pdus += Bench_CheckFrame(Bench_Frame[i], Bench_FrameLength[i]);
+    }
+    (void)printf("check: %u PDUs in %u datagrams\n", (unsigned)pdus, (unsigned)Bench_FrameCount);
+    if (pdus != (2U * ETHTP_TX_PDU_COUNT))
+    {
+        Bench_Errors++;
+    }
+
+    length = Bench_BuildRxFrame(rx);
+    EthTp_RxIndication(rx, (uint16)length);
+    for (route = socon->rx_route_first; route < (uint32)socon->rx_route_first + socon->rx_route_count; route++)
+    {
+        if ((Bench_RxCount[EthTp_RxRoute[route].pdur_pdu] != 1U) ||
+            (Bench_RxLength[EthTp_RxRoute[route].pdur_pdu] != (1U + (route % 13U))))
+        {
+            Bench_Errors++;
+        }
+    }
+    (void)EthTp_GetStatistics(&stats);
+    (void)printf("check: received %u of %u PDUs, %u dropped\n", (unsigned)stats.rx_pdus,
+                 (unsigned)socon->rx_route_count, (unsigned)stats.rx_dropped);
+    if ((stats.rx_pdus != socon->rx_route_count) || (stats.rx_dropped != 2U) || (stats.rx_datagrams != 1U))
+    {
+        Bench_Errors++;
+    }
+}
+
+static void Bench_Throughput(boolean batched, BenchResultType *result)
+{
+    static uint8 data[ETHTP_MAX_DATAGRAM_LENGTH];
+    PduInfoType info;
+    EthTp_StatisticsType before, after;
+    uint32 cycle, round, pdu, sent = 0U;
+    uint64 wire;
+    double start;
+
+    (void)memset(data, 0x5A, sizeof(data));
+    info.SduDataPtr = data;
+    (void)EthTp_GetStatistics(&before);
+    wire = Bench_WireBytes;
+
+    start = Bench_NowNs();
+    for (cycle = 0U; cycle < BENCH_CYCLES; cycle++)
+    {
+        for (round = 0U; round < BENCH_PDUS_PER_CYCLE; round++)
+        {
+            for (pdu = 0U; pdu < ETHTP_TX_PDU_COUNT; pdu++)
+            {
+                if (EthTp_TxPdu[pdu].socon != EthTpConf_EthTpSocketConnection_SoCon_Hpc)
+                {
+                    continue;
+                }
+                info.SduLength = EthTp_TxPdu[pdu].length;
+                (void)EthTp_IfTransmit((PduIdType)pdu, &info);
+                sent++;
+                if (batched == FALSE)
+                {
+                    EthTp_MainFunctionTx();
+                }
+            }
+        }
+        EthTp_MainFunctionTx();
+    }
+    result->ns_per_pdu = (Bench_NowNs() - start) / (double)sent;
+
+    (void)EthTp_GetStatistics(&after);
+    if ((after.tx_pdus - before.tx_pdus) != sent)
+    {
+        Bench_Errors++;
+    }
+    result->datagrams_per_pdu = (double)(after.tx_datagrams - before.tx_datagrams) / (double)sent;
+    result->wire_bytes_per_pdu = (double)(Bench_WireBytes - wire) / (double)sent;
+}
+
+int main(void)
+{
+    BenchResultType batched, single;
+
+    PduPool_Init();
+    EthTp_Init();
+    Bench_Check();
+
+    Bench_Throughput(FALSE, &single);
+    Bench_Throughput(TRUE, &batched);
+
+    (void)printf("%-22s %10s %14s %14s %16s\n", "mode", "ns/PDU", "datagrams/PDU", "wire B/PDU", "PDU/s @1Gbit/s");
+    (void)printf("%-22s %10.1f %14.3f %14.1f %16.0f\n", "datagram per PDU", single.ns_per_pdu,
+                 single.datagrams_per_pdu, single.wire_bytes_per_pdu,
+                 BENCH_LINK_BYTES_PER_S / single.wire_bytes_per_pdu);
+    (void)printf("%-22s %10.1f %14.3f %14.1f %16.0f\n", "batched per cycle", batched.ns_per_pdu,
+                 batched.datagrams_per_pdu, batched.wire_bytes_per_pdu,
+                 BENCH_LINK_BYTES_PER_S / batched.wire_bytes_per_pdu);
+
+    if (Bench_Errors != 0U)
+    {
+        (void)printf("ERROR: %u check failures\n", (unsigned)Bench_Errors);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,845 @@
+/**
+ * @file    bench_pdu_pool.c
+ * @brief   Host benchmark: PDU buffer pool under interrupt preemption, gateway fan-out, cost and RAM
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs pdu_pool.c alone and together with pdu_router.c and the generated
+ * PduR configuration. A SIGALRM timer (setitimer, BENCH_ISR_PERIOD_US)
+ * plays the role of an interrupt on the same core: its handler preempts
+ * the main loop at arbitrary instructions, also in the middle of the
+ * compare-and-swap loops of the pool.
+ *
+ * Part 1 checks the pool: every block has the alignment and the class of
+ * its length, fallbacks to the next class are counted, a block with
+ * references survives until the last PduPool_Release(), double releases
+ * and foreign pointers are rejected, and a drained pool hands out exactly
+ * the configured blocks.
+ *
+ * Part 2 stresses the free lists: the main loop and the handler allocate
+ * blocks of random length, retain them for 0 to 2 further users (fan-out),
+ * stamp them with an owner tag and release them in random order. A block
+ * handed out twice shows up as an overwritten tag. Afterwards no block may
+ * be in use and the drain check of part 1 must pass again.
+ *
+ * Part 3 routes the gateway paths with a transmit buffer: the main loop
+ * indicates PDUs whose bytes all carry a sequence number, the handler
+ * fetches them with PduR_<Lo>TriggerTransmit() for every
+ * PDUR_TRIGGERTRANSMIT destination. A fetched PDU must be of one sequence
+ * number (no PDU replaced during the copy); the pool must hold one block
+ * per transmit buffer at the end.
+ *
+ * Part 4 compares the cost of an allocation and release: PduPool against
+ * the same free list under a critical section and against malloc() /
+ * free(). On the host Os_Port_DisableInterrupts() costs nothing; on the
+ * target the section adds CPSID / CPSIE and delays interrupts.
+ *
+ * Part 5 reports the communication buffer RAM before (EthTp transmit
+ * ring, PduR gateway buffers) and after (pool storage and bookkeeping).
+ *
+ * Build (host toolchain profile):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DPDUR_DEV_ERROR_DETECT=STD_OFF -DPDUPOOL_DEV_ERROR_DETECT=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     test/benchmark/bench_pdu_pool.c src/bsw/com/pdu_pool.c \
+ *     src/bsw/com/pdu_router.c src/bsw/com/pdur_cfg.c -o bench_pdu_pool
+ * @endcode
+ *
+ * @see pdu_pool.h
+ * @see pdu_router.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _XOPEN_SOURCE 600               /* clock_gettime(), sigaction(), setitimer() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/time.h>
+
+#include "pdu_pool.h"
+#include "pdu_router.h"
+#include "com_stack.h"
+#include "can_tp.h"
+#include "os_port.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_ISR_PERIOD_US                     20L
+#define BENCH_STRESS_ITERATIONS                 2000000U
+#define BENCH_GATEWAY_ITERATIONS                2000000U
+#define BENCH_COST_ITERATIONS                   2000000U
+#define BENCH_MAIN_HELD                         8U      /**< Blocks the main loop holds at most */
+#define BENCH_ISR_HELD                          4U      /**< Blocks the handler holds at most */
+#define BENCH_MAX_FAN_OUT                       3U      /**< References per block at most */
+
+/** @brief Owner tags: the main loop and the handler stamp from separate ranges */
+#define BENCH_TAG_ISR                           0x80000000UL
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief A block held by the main loop or the handler
+ */
+typedef struct
+{
+    uint8 *data;
+    uint32 tag;
+    uint32 length;
+    uint32 refs;
+} BenchHeldType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static uint32 Bench_Errors;
+
+/* Handler state; the main loop only reads it after the timer is stopped */
+static volatile sig_atomic_t Bench_IsrMode;     /**< 0: idle, 1: part 2, 2: part 3 */
+static BenchHeldType Bench_IsrHeld[BENCH_ISR_HELD];
+static uint32 Bench_IsrSeed = 0x2545F491UL;
+static uint32 Bench_IsrTag = BENCH_TAG_ISR;
+static volatile uint32 Bench_IsrCalls;
+static volatile uint32 Bench_IsrErrors;
+static volatile uint32 Bench_IsrFetches;
+static volatile uint32 Bench_IsrAllocFailures;
+
+/* Part 3: TRIGGERTRANSMIT destinations of the gateway paths with a transmit buffer */
+static uint16 Bench_TtDest[PDUR_DEST_PDU_COUNT];
+static uint16 Bench_TtDestCount;
+static uint16 Bench_TtNext;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Random length, weighted towards the small classes like the PDU mix of the VCU
+ */
+static uint32 Bench_RandomLength(uint32 *seed)
+{
+    uint32 r = Bench_Random(seed);
+
+    switch (r & 7U)
+    {
+        case 0U:
+        case 1U:
+        case 2U:
+        case 3U:
+            return 1U + ((r >> 8) % 64U);
+        case 4U:
+        case 5U:
+            return 65U + ((r >> 8) % 192U);
+        case 6U:
+            return 257U + ((r >> 8) % 1280U);
+        default:
+            return 1537U + ((r >> 8) % 2560U);
+    }
+}
+
+/**
+ * @brief Offset of the tail tag: the last word of the length, the first for short lengths
+ */
+static uint32 Bench_TailOffset(uint32 length)
+{
+    return (length >= 8U) ? (length - 4U) : 0U;
+}
+
+/**
+ * @brief Take a block, stamp it with a tag and add 0 .. BENCH_MAX_FAN_OUT - 1 references
+ * @return FALSE if the pool had no block
+ */
+static boolean Bench_Take(BenchHeldType *held, uint32 tag, uint32 *seed)
+{
+    uint32 i;
+
+    held->length = Bench_RandomLength(seed);
+    held->data = PduPool_Alloc(held->length);
+    if (held->data == NULL_PTR)
+    {
+        return FALSE;
+    }
+    held->tag = tag;
+    held->refs = 1U + (Bench_Random(seed) % BENCH_MAX_FAN_OUT);
+    (void)memcpy(held->data, &tag, sizeof(tag));
+    (void)memcpy(&held->data[Bench_TailOffset(held->length)], &tag, sizeof(tag));
+    for (i = 1U; i < held->refs; i++)
+    {
+        if (PduPool_Retain(held->data) != E_OK)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Check the tags of a held block and drop one reference
+ * @return Number of errors
+ */
+static uint32 Bench_Drop(BenchHeldType *held)
+{
+    uint32 head, tail;
+    uint32 errors = 0U;
+
+    (void)memcpy(&head, held->data, sizeof(head));
+    (void)memcpy(&tail, &held->data[Bench_TailOffset(held->length)], sizeof(tail));
+    if ((head != held->tag) || (tail != held->tag))
+    {
+        errors++;                                       /* Handed out twice */
+    }
+    if (PduPool_Release(held->data) != E_OK)
+    {
+        errors++;
+    }
+    held->refs--;
+    if (held->refs == 0U)
+    {
+        held->data = NULL_PTR;
+    }
+    return errors;
+}
+
+/**
+ * @brief Simulated interrupt
+ */
+static void Bench_Isr(int signal_number)
+{
+    uint32 slot = Bench_Random(&Bench_IsrSeed) % BENCH_ISR_HELD;
+    BenchHeldType *held = &Bench_IsrHeld[slot];
+    PduInfoType info;
+    uint8 buffer[64];
+    uint16 dest;
+    uint32 i;
+
+    (void)signal_number;
+    Bench_IsrCalls++;
+
+    if (Bench_IsrMode == 1)
+    {
+        if (held->data != NULL_PTR)
+        {
+            Bench_IsrErrors += Bench_Drop(held);
+        }
+        else if (Bench_Take(held, Bench_IsrTag, &Bench_IsrSeed) == TRUE)
+        {
+            Bench_IsrTag++;
+        }
+        else
+        {
+            Bench_IsrAllocFailures++;
+        }
+    }
+    else if ((Bench_IsrMode == 2) && (Bench_TtDestCount != 0U))
+    {
+        dest = Bench_TtDest[Bench_TtNext];
+        Bench_TtNext = (uint16)((Bench_TtNext + 1U) % Bench_TtDestCount);
+        info.SduDataPtr = buffer;
+        info.MetaDataPtr = NULL_PTR;
+        info.SduLength = (PduLengthType)sizeof(buffer);
+        if (((PduR_DestPdu[dest].module == PduRConf_PduRBswModule_CanIf) ?
+             PduR_CanIfTriggerTransmit(dest, &info) : PduR_SoAdIfTriggerTransmit(dest, &info)) == E_OK)
+        {
+            Bench_IsrFetches++;
+            for (i = 1U; i < info.SduLength; i++)
+            {
+                if (buffer[i] != buffer[0])
+                {
+                    Bench_IsrErrors++;                  /* Torn: replaced during the copy */
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Idle */
+    }
+}
+
+static void Bench_StartIsr(int mode)
+{
+    struct sigaction action;
+    struct itimerval timer;
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = Bench_Isr;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaction(SIGALRM, &action, NULL);
+
+    Bench_IsrMode = mode;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = BENCH_ISR_PERIOD_US;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+static void Bench_StopIsr(void)
+{
+    struct itimerval timer;
+
+    (void)memset(&timer, 0, sizeof(timer));
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+    Bench_IsrMode = 0;
+}
+
+/**
+ * @brief Allocate every block, largest class first, then expect an empty pool; release all
+ * @return Number of errors
+ */
+static uint32 Bench_Drain(void)
+{
+    static const uint32 size[PDUPOOL_CLASS_COUNT] = { 64U, 256U, 1536U, 4096U };
+    static uint8 *block[PDUPOOL_BLOCK_COUNT];
+    PduPool_StatisticsType stats;
+    uint32 errors = 0U;
+    uint32 count = 0U;
+    uint32 i;
+    sint32 c;
+
+    for (c = (sint32)PDUPOOL_CLASS_COUNT - 1; c >= 0; c--)
+    {
+        (void)PduPool_GetStatistics((uint8)c, &stats);
+        for (i = 0U; i < stats.blocks; i++)
+        {
+            block[count] = PduPool_Alloc(size[c]);
+            if ((block[count] == NULL_PTR) || (((unsigned long)block[count] & 31UL) != 0UL))
+            {
+                errors++;
+                continue;
+            }
+            count++;
+        }
+    }
+    if (PduPool_Alloc(1U) != NULL_PTR)
+    {
+        errors++;                                       /* More blocks than configured */
+    }
+    for (i = 0U; i < count; i++)
+    {
+        errors += (PduPool_Release(block[i]) == E_OK) ? 0U : 1U;
+    }
+    for (c = 0; c < (sint32)PDUPOOL_CLASS_COUNT; c++)
+    {
+        (void)PduPool_GetStatistics((uint8)c, &stats);
+        errors += (stats.in_use == 0U) ? 0U : 1U;
+    }
+
+    return errors + ((count == PDUPOOL_BLOCK_COUNT) ? 0U : 1U);
+}
+
+/**
+ * @brief Part 1: classes, fallback, reference counting, invalid blocks, drain
+ */
+static void Bench_CheckPool(void)
+{
+    PduPool_StatisticsType before;
+    PduPool_StatisticsType after;
+    uint8 *block;
+    uint8 *first;
+    uint32 errors = 0U;
+
+    PduPool_Init();
+
+    /* Smallest fitting class */
+    block = PduPool_Alloc(64U);
+    (void)PduPool_GetStatistics(PDUPOOL_CLASS_64, &after);
+    errors += ((block != NULL_PTR) && (after.in_use == 1U)) ? 0U : 1U;
+    errors += (PduPool_Release(block) == E_OK) ? 0U : 1U;
+    block = PduPool_Alloc(65U);
+    (void)PduPool_GetStatistics(PDUPOOL_CLASS_256, &after);
+    errors += ((block != NULL_PTR) && (after.in_use == 1U)) ? 0U : 1U;
+    errors += (PduPool_Release(block) == E_OK) ? 0U : 1U;
+
+    /* Reference counting: the block stays allocated until the last release */
+    first = PduPool_Alloc(8U);
+    errors += (PduPool_Retain(first) == E_OK) ? 0U : 1U;
+    errors += (PduPool_Retain(first) == E_OK) ? 0U : 1U;
+    errors += (PduPool_Release(first) == E_OK) ? 0U : 1U;
+    errors += (PduPool_Release(first) == E_OK) ? 0U : 1U;
+    (void)PduPool_GetStatistics(PDUPOOL_CLASS_64, &before);
+    errors += (before.in_use == 1U) ? 0U : 1U;
+    errors += (PduPool_Release(first) == E_OK) ? 0U : 1U;
+    (void)PduPool_GetStatistics(PDUPOOL_CLASS_64, &after);
+    errors += (after.in_use == 0U) ? 0U : 1U;
+
+    /* Double release, retain of a free block, pointers that are not blocks */
+    errors += (PduPool_Release(first) == E_NOT_OK) ? 0U : 1U;
+    errors += (PduPool_Retain(first) == E_NOT_OK) ? 0U : 1U;
+    errors += (PduPool_Release(&first[1]) == E_NOT_OK) ? 0U : 1U;
+    errors += (PduPool_Release((const uint8 *)&before) == E_NOT_OK) ? 0U : 1U;
+    errors += (PduPool_Alloc(0U) == NULL_PTR) ? 0U : 1U;
+    errors += (PduPool_Alloc(PDUPOOL_MAX_LENGTH + 1U) == NULL_PTR) ? 0U : 1U;
+
+    errors += Bench_Drain();
+
+    /* Fallback: with the 64-byte class exhausted, 64 bytes come from the 256-byte class */
+    PduPool_Init();
+    {
+        static uint8 *held[PDUPOOL_BLOCKS_64];
+        uint32 i;
+
+        for (i = 0U; i < PDUPOOL_BLOCKS_64; i++)
+        {
+            held[i] = PduPool_Alloc(1U);
+        }
+        (void)PduPool_GetStatistics(PDUPOOL_CLASS_256, &before);
+        block = PduPool_Alloc(1U);
+        (void)PduPool_GetStatistics(PDUPOOL_CLASS_256, &after);
+        errors += ((block != NULL_PTR) && (after.fallbacks == (before.fallbacks + 1U)) &&
+                   (after.in_use == 1U)) ? 0U : 1U;
+        (void)PduPool_Release(block);
+        for (i = 0U; i < PDUPOOL_BLOCKS_64; i++)
+        {
+            (void)PduPool_Release(held[i]);
+        }
+        (void)PduPool_GetStatistics(PDUPOOL_CLASS_64, &after);
+        errors += (after.high_watermark == PDUPOOL_BLOCKS_64) ? 0U : 1U;
+    }
+
+    (void)printf("Part 1: pool checks: %u errors\n\n", (unsigned)errors);
+    Bench_Errors += errors;
+}
+
+/**
+ * @brief Part 2: main loop and simulated interrupt allocate and release concurrently
+ */
+static void Bench_Stress(void)
+{
+    static const char *name[PDUPOOL_CLASS_COUNT] = { "64 B", "256 B", "1536 B", "4096 B" };
+    BenchHeldType held[BENCH_MAIN_HELD];
+    PduPool_StatisticsType stats;
+    uint32 seed = 0x9E3779B9UL;
+    uint32 tag = 1U;
+    uint32 errors = 0U;
+    uint32 failures = 0U;
+    uint32 iteration;
+    uint32 slot;
+    uint8 c;
+
+    PduPool_Init();
+    (void)memset(held, 0, sizeof(held));
+    (void)memset(Bench_IsrHeld, 0, sizeof(Bench_IsrHeld));
+    Bench_IsrCalls = 0U;
+    Bench_IsrErrors = 0U;
+    Bench_IsrAllocFailures = 0U;
+
+    Bench_StartIsr(1);
+    for (iteration = 0U; iteration < BENCH_STRESS_ITERATIONS; iteration++)
+    {
+        slot = Bench_Random(&seed) % BENCH_MAIN_HELD;
+        if (held[slot].data != NULL_PTR)
+        {
+            errors += Bench_Drop(&held[slot]);
+        }
+        else if (Bench_Take(&held[slot], tag, &seed) == TRUE)
+        {
+            tag = (tag + 1U) & ~BENCH_TAG_ISR;
+        }
+        else
+        {
+            failures++;
+        }
+    }
+    Bench_StopIsr();
+
+    for (slot = 0U; slot < BENCH_MAIN_HELD; slot++)
+    {
+        while (held[slot].data != NULL_PTR)
+        {
+            errors += Bench_Drop(&held[slot]);
+        }
+    }
+    for (slot = 0U; slot < BENCH_ISR_HELD; slot++)
+    {
+        while (Bench_IsrHeld[slot].data != NULL_PTR)
+        {
+            errors += Bench_Drop(&Bench_IsrHeld[slot]);
+        }
+    }
+    errors += Bench_IsrErrors;
+
+    (void)printf("Part 2: %u main loop operations, %u interrupts; %u allocations found no block\n",
+                 (unsigned)BENCH_STRESS_ITERATIONS, (unsigned)Bench_IsrCalls,
+                 (unsigned)(failures + Bench_IsrAllocFailures));
+    (void)printf("%-8s %8s %14s %12s %12s %10s\n", "class", "blocks", "high watermark", "allocations",
+                 "fallbacks", "failures");
+    for (c = 0U; c < PDUPOOL_CLASS_COUNT; c++)
+    {
+        (void)PduPool_GetStatistics(c, &stats);
+        (void)printf("%-8s %8u %14u %12u %12u %10u\n", name[c], (unsigned)stats.blocks,
+                     (unsigned)stats.high_watermark, (unsigned)stats.allocations, (unsigned)stats.fallbacks,
+                     (unsigned)stats.failures);
+        errors += (stats.in_use == 0U) ? 0U : 1U;
+    }
+    errors += Bench_Drain();
+    (void)printf("Tag mismatches, rejected releases, blocks left or lost: %u\n\n", (unsigned)errors);
+    Bench_Errors += errors;
+}
+
+/**
+ * @brief Part 3: gateway paths updated by the main loop, fetched by the simulated interrupt
+ */
+static void Bench_Gateway(void)
+{
+    uint8 payload[PDUR_MAX_TX_BUFFER_LENGTH];
+    uint16 gateway[PDUR_ROUTING_PATH_COUNT];
+    uint16 gateway_count = 0U;
+    PduPool_StatisticsType stats;
+    PduInfoType info;
+    uint32 iteration;
+    uint32 errors = 0U;
+    uint16 path;
+    uint16 index;
+
+    PduPool_Init();
+    PduR_Init();
+    Bench_TtDestCount = 0U;
+    for (path = 0U; path < PDUR_ROUTING_PATH_COUNT; path++)
+    {
+        const PduR_RoutingPathType *route = &PduR_RoutingPath[path];
+
+        if (route->tx_buffer == PDUR_NO_TX_BUFFER)
+        {
+            continue;
+        }
+        gateway[gateway_count] = path;
+        gateway_count++;
+        for (index = route->dest_first; index < (route->dest_first + route->dest_count); index++)
+        {
+            if (PduR_DestPdu[index].provision == (uint8)PDUR_TRIGGERTRANSMIT)
+            {
+                Bench_TtDest[Bench_TtDestCount] = index;
+                Bench_TtDestCount++;
+            }
+        }
+    }
+
+    Bench_IsrCalls = 0U;
+    Bench_IsrErrors = 0U;
+    Bench_IsrFetches = 0U;
+    Bench_StartIsr(2);
+    for (iteration = 0U; iteration < BENCH_GATEWAY_ITERATIONS; iteration++)
+    {
+        const PduR_RoutingPathType *route;
+
+        path = gateway[iteration % gateway_count];
+        route = &PduR_RoutingPath[path];
+        (void)memset(payload, (int)(iteration & 0xFFU), sizeof(payload));
+        info.SduDataPtr = payload;
+        info.MetaDataPtr = NULL_PTR;
+        info.SduLength = PduR_TxBuffer[route->tx_buffer].max_length;
+        if (route->src_module == PduRConf_PduRBswModule_CanIf)
+        {
+            PduR_CanIfRxIndication(path, &info);
+        }
+        else
+        {
+            PduR_SoAdIfRxIndication(path, &info);
+        }
+    }
+    Bench_StopIsr();
+
+    (void)PduPool_GetStatistics(PDUPOOL_CLASS_64, &stats);
+    errors += Bench_IsrErrors;
+    errors += (stats.in_use == PDUR_TX_BUFFER_COUNT) ? 0U : 1U;
+    errors += (stats.failures == 0U) ? 0U : 1U;
+    errors += (Bench_IsrFetches != 0U) ? 0U : 1U;
+
+    (void)printf("Part 3: %u gateway paths, %u TRIGGERTRANSMIT destinations; %u PDUs routed, %u fetched "
+                 "in %u interrupts\n", (unsigned)gateway_count, (unsigned)Bench_TtDestCount,
+                 (unsigned)BENCH_GATEWAY_ITERATIONS, (unsigned)Bench_IsrFetches, (unsigned)Bench_IsrCalls);
+    (void)printf("64-byte blocks: %u held at the end (one per transmit buffer), high watermark %u of %u; "
+                 "%u torn fetches or errors\n\n", (unsigned)stats.in_use, (unsigned)stats.high_watermark,
+                 (unsigned)stats.blocks, (unsigned)errors);
+    Bench_Errors += errors;
+}
+
+/* Baseline for part 4: the same free list and statistics under a critical section */
+static uint16 Bench_LockedFree[PDUPOOL_BLOCKS_64];
+static uint16 Bench_LockedCount;
+static uint32 Bench_LockedInUse;
+static uint32 Bench_LockedHighWatermark;
+static uint8 Bench_LockedStorage[PDUPOOL_BLOCKS_64][64] ALIGNED(32);
+
+static uint8 *Bench_LockedAlloc(void)
+{
+    uint8 *block = NULL_PTR;
+    uint32 key = Os_Port_DisableInterrupts();
+
+    if (Bench_LockedCount != 0U)
+    {
+        Bench_LockedCount--;
+        block = Bench_LockedStorage[Bench_LockedFree[Bench_LockedCount]];
+        Bench_LockedInUse++;
+        if (Bench_LockedInUse > Bench_LockedHighWatermark)
+        {
+            Bench_LockedHighWatermark = Bench_LockedInUse;
+        }
+    }
+    Os_Port_RestoreInterrupts(key);
+
+    return block;
+}
+
+static void Bench_LockedRelease(const uint8 *block)
+{
+    uint32 key = Os_Port_DisableInterrupts();
+
+    Bench_LockedFree[Bench_LockedCount] = (uint16)((block - &Bench_LockedStorage[0][0]) / 64);
+    Bench_LockedCount++;
+    Bench_LockedInUse--;
+    Os_Port_RestoreInterrupts(key);
+}
+
+/**
+ * @brief Part 4: cost of an allocation and release of a 64-byte block
+ */
+static void Bench_Cost(void)
+{
+    static uint8 *volatile sink;
+    uint32 iteration;
+    uint16 i;
+    double t0;
+    double pool_ns;
+    double locked_ns;
+    double malloc_ns;
+
+    PduPool_Init();
+    t0 = Bench_NowNs();
+    for (iteration = 0U; iteration < BENCH_COST_ITERATIONS; iteration++)
+    {
+        sink = PduPool_Alloc(64U);
+        (void)PduPool_Release(sink);
+    }
+    pool_ns = (Bench_NowNs() - t0) / (double)BENCH_COST_ITERATIONS;
+
+    for (i = 0U; i < PDUPOOL_BLOCKS_64; i++)
+    {
+        Bench_LockedFree[i] = i;
+    }
+    Bench_LockedCount = PDUPOOL_BLOCKS_64;
+    t0 = Bench_NowNs();
+    for (iteration = 0U; iteration < BENCH_COST_ITERATIONS; iteration++)
+    {
+        sink = Bench_LockedAlloc();
+        Bench_LockedRelease(sink);
+    }
+    locked_ns = (Bench_NowNs() - t0) / (double)BENCH_COST_ITERATIONS;
+
+    t0 = Bench_NowNs();
+    for (iteration = 0U; iteration < BENCH_COST_ITERATIONS; iteration++)
+    {
+        sink = malloc(64U);
+        free(sink);
+    }
+    malloc_ns = (Bench_NowNs() - t0) / (double)BENCH_COST_ITERATIONS;
+
+    (void)printf("Part 4: allocation and release of 64 bytes\n");
+    (void)printf("%-40s %12s\n", "", "ns/pair");
+    (void)printf("%-40s %12.1f\n", "PduPool (compare-and-swap)", pool_ns);
+    (void)printf("%-40s %12.1f\n", "Free list under critical section", locked_ns);
+    (void)printf("%-40s %12.1f\n", "malloc() / free()", malloc_ns);
+    (void)printf("PduPool runs 6 to 7 compare-and-swaps per pair: locked instructions on the host, LDREX / STREX\n"
+                 "on the target. The critical section is free on the host; on the target it costs\n"
+                 "CPSID / CPSIE and holds off every interrupt for the duration of the update.\n\n");
+}
+
+/**
+ * @brief Part 5: communication buffer RAM before and after the pool
+ */
+static void Bench_Ram(void)
+{
+    uint32 gateway = 0U;
+    uint32 ethtp = 8U * 1536U;
+    uint32 bookkeeping = (PDUPOOL_BLOCK_COUNT * (uint32)(sizeof(uint16) + sizeof(uint32))) +
+                         (PDUPOOL_CLASS_COUNT * 6U * (uint32)sizeof(uint32));
+    uint32 before;
+    uint32 after;
+    uint16 i;
+
+    for (i = 0U; i < PDUR_TX_BUFFER_COUNT; i++)
+    {
+        gateway += PduR_TxBuffer[i].max_length;
+    }
+    before = ethtp + gateway;
+    after = (uint32)PDUPOOL_STORAGE_SIZE + bookkeeping;
+
+    (void)printf("Part 5: communication buffer RAM (bytes)\n");
+    (void)printf("%-48s %10s\n", "", "bytes");
+    (void)printf("%-48s %10u\n", "Before: EthTp transmit ring (8 x 1536)", (unsigned)ethtp);
+    (void)printf("%-48s %10u\n", "Before: PduR gateway transmit buffers", (unsigned)gateway);
+    (void)printf("%-48s %10u\n", "Before: total", (unsigned)before);
+    (void)printf("%-48s %10u\n", "After: pool storage", (unsigned)PDUPOOL_STORAGE_SIZE);
+    (void)printf("%-48s %10u\n", "After: free lists, reference counts, statistics", (unsigned)bookkeeping);
+    (void)printf("%-48s %10u (%+.1f %%)\n\n", "After: total", (unsigned)after,
+                 (100.0 * ((double)after - (double)before)) / (double)before);
+    if (after >= before)
+    {
+        (void)printf("ERROR: the pool does not reduce the buffer RAM\n");
+        Bench_Errors++;
+    }
+}
+
+/*==================================================================================================
+*                                   LOWER / UPPER LAYER STUBS
+==================================================================================================*/
+
+void Com_RxIndication(PduIdType RxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)RxPduId;
+    (void)PduInfoPtr;
+}
+
+Std_ReturnType Com_TriggerTransmit(PduIdType TxPduId, PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+Std_ReturnType CanIf_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_OK;
+}
+
+Std_ReturnType CanIf_TransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                   const PduInfoType *PduInfos, uint16 Count)
+{
+    (void)Controller;
+    (void)TxPduIds;
+    (void)PduInfos;
+    (void)Count;
+    return E_OK;
+}
+
+Std_ReturnType SoAd_IfTransmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_OK;
+}
+
+Std_ReturnType SoAd_IfTransmitBatch(uint8 Controller, const PduIdType *TxPduIds,
+                                    const PduInfoType *PduInfos, uint16 Count)
+{
+    (void)Controller;
+    (void)TxPduIds;
+    (void)PduInfos;
+    (void)Count;
+    return E_OK;
+}
+
+Std_ReturnType EthComm_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_OK;
+}
+
+Std_ReturnType CanTp_Transmit(PduIdType TxPduId, const PduInfoType *PduInfoPtr)
+{
+    (void)TxPduId;
+    (void)PduInfoPtr;
+    return E_NOT_OK;
+}
+
+BufReq_ReturnType Dcm_StartOfReception(PduIdType id, const PduInfoType *info, PduLengthType TpSduLength,
+                                       PduLengthType *bufferSizePtr)
+{
+    (void)id;
+    (void)info;
+    (void)TpSduLength;
+    (void)bufferSizePtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+BufReq_ReturnType Dcm_CopyRxData(PduIdType id, const PduInfoType *info, PduLengthType *bufferSizePtr)
+{
+    (void)id;
+    (void)info;
+    (void)bufferSizePtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+void Dcm_TpRxIndication(PduIdType id, Std_ReturnType result)
+{
+    (void)id;
+    (void)result;
+}
+
+BufReq_ReturnType Dcm_CopyTxData(PduIdType id, const PduInfoType *info, const RetryInfoType *retry,
+                                 PduLengthType *availableDataPtr)
+{
+    (void)id;
+    (void)info;
+    (void)retry;
+    (void)availableDataPtr;
+    return BUFREQ_E_NOT_OK;
+}
+
+void Dcm_TpTxConfirmation(PduIdType id, Std_ReturnType result)
+{
+    (void)id;
+    (void)result;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    Bench_CheckPool();
+    Bench_Stress();
+    Bench_Gateway();
+    Bench_Cost();
+    Bench_Ram();
+
+    if (Bench_Errors != 0U)
+    {
+        (void)printf("ERROR: %u check failures\n", (unsigned)Bench_Errors);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
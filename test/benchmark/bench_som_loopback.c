@@ -0,0 +1,677 @@
+/**
+ * @file    bench_som_loopback.c
+ * @brief   Host benchmark: SOME/IP serializers, SD and TP over localhost UDP against an emulated zone controller
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs the VCU SOME/IP stack (som_stack.c, som_cfg.c) against a minimal
+ * zone controller emulator over four real UDP sockets on 127.0.0.1:
+ *
+ * | Socket      | Owner | Traffic                                               |
+ * |-------------|-------|-------------------------------------------------------|
+ * | VCU SD      | VCU   | Offers / Finds / Subscribes of the VCU, peer replies  |
+ * | VCU event   | VCU   | Zone events (PedalInputs ... RearDiagnostics)         |
+ * | Peer SD     | Peer  | SD messages of the VCU                                |
+ * | Peer event  | Peer  | VCU events (VehicleMotion ... DiagSnapshot)           |
+ *
+ * Som_UdpTransmit() maps every destination of the configuration (multicast
+ * group, subscriber endpoints) to the peer socket of the same kind, so the
+ * SD exchange and the TP segmentation run unchanged on the host.
+ *
+ * Phases:
+ * - SD: Som_MainFunction() cycles until the peer has offered both zone
+ *   services, every consumed event group is acknowledged and the peer has
+ *   subscribed every provided event group
+ * - Codecs: ns per serialize and per check + deserialize of every event,
+ *   in memory (the peer side uses the SOM_PEER_CODECS tables)
+ * - Loopback: events/s through Som_SendEvent() -> UDP -> peer decode, and
+ *   peer encode -> UDP -> Som_RxIndication() -> Som_ReceiveEvent(); the
+ *   payload of the last event is compared on the wire against a reference
+ *   serialization, so the run doubles as a functional check
+ *
+ * Build (host toolchain profile):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DSOM_DEV_ERROR_DETECT=STD_OFF -DSOM_PEER_CODECS=STD_ON \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com \
+ *     test/benchmark/bench_som_loopback.c src/bsw/com/som_stack.c src/bsw/com/som_cfg.c \
+ *     -o bench_som_loopback
+ * @endcode
+ *
+ * @see som_stack.h
+ * @see som_pack.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 200112L         /* clock_gettime(), sockets */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "som_stack.h"
+#include "som_pack.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_CODEC_ITERATIONS                  100000U
+#define BENCH_LOOPBACK_EVENTS                   20000U
+#define BENCH_SD_CYCLES_MAX                     1000U
+#define BENCH_DATAGRAM_MAX                      2048U
+#define BENCH_PAYLOAD_MAX                       8192U
+
+#define BENCH_VCU_SD                            0U
+#define BENCH_VCU_EVENT                         1U
+#define BENCH_PEER_SD                           2U
+#define BENCH_PEER_EVENT                        3U
+#define BENCH_SOCKET_COUNT                      4U
+
+/** @brief Logical address of the emulated zone controller */
+#define BENCH_PEER_ADDRESS                      0xC0A80A02UL
+
+#if (SOM_PEER_CODECS != STD_ON)
+    #error "bench_som_loopback.c needs -DSOM_PEER_CODECS=STD_ON"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+typedef struct
+{
+    uint8 payload[BENCH_PAYLOAD_MAX];   /**< Last complete payload */
+    uint32 length;
+    uint32 next;                        /**< TP: offset of the next segment */
+    uint32 received;                    /**< Complete events */
+} BenchPeerEventType;
+
+typedef struct
+{
+    double serialize_ns;
+    double deserialize_ns;              /**< Check + deserialize */
+    double events_per_s;
+    uint32 length;
+    uint32 mismatches;
+} BenchResultType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static int Bench_Socket[BENCH_SOCKET_COUNT];
+static struct sockaddr_in Bench_Address[BENCH_SOCKET_COUNT];
+
+static const Som_EndpointType Bench_PeerSdEndpoint = { BENCH_PEER_ADDRESS, SOM_SD_PORT };
+static const Som_EndpointType Bench_PeerEventEndpoint = { BENCH_PEER_ADDRESS, SOM_LOCAL_PORT };
+
+static BenchPeerEventType Bench_PeerEvent[SOM_TX_EVENT_COUNT];
+static uint32 Bench_PeerAcks;
+static uint16 Bench_PeerSession = 1U;
+
+/** @brief Application values: largest variants of every data type */
+static union
+{
+    Som_VehicleMotionType vehicle_motion;
+    Som_PowertrainStateType powertrain_state;
+    Som_BatteryStatusType battery_status;
+    Som_DiagSnapshotType diag_snapshot;
+    Som_PedalInputsType pedal_inputs;
+    Som_SteeringInputType steering_input;
+    Som_RearSensorsType rear_sensors;
+    Som_RearDiagnosticsType rear_diagnostics;
+} Bench_Value, Bench_Decoded;
+
+static uint8 Bench_Buffer[BENCH_PAYLOAD_MAX];
+static uint8 Bench_Reference[BENCH_PAYLOAD_MAX];
+static uint8 Bench_Datagram[BENCH_DATAGRAM_MAX];
+
+static volatile uint32 Bench_Sink;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Random Bench_Value, dynamic arrays at their maximum length (the
+ *        length members of the union members do not overlap)
+ */
+static void Bench_RandomValue(uint32 *seed)
+{
+    uint8 *bytes = (uint8 *)&Bench_Value;
+    uint32 i;
+
+    for (i = 0U; i < sizeof(Bench_Value); i++)
+    {
+        bytes[i] = (uint8)Bench_Random(seed);
+    }
+    Bench_Value.battery_status.CellVoltagesLength = 192U;
+    Bench_Value.battery_status.CellTempsLength = 96U;
+    Bench_Value.rear_diagnostics.BlocksLength = 6000U;
+}
+
+/* ------------------------------------------- sockets ------------------------------------------ */
+
+static boolean Bench_OpenSockets(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < BENCH_SOCKET_COUNT; i++)
+    {
+        socklen_t length = sizeof(Bench_Address[i]);
+        int buffer = 1 << 20;
+
+        Bench_Socket[i] = socket(AF_INET, SOCK_DGRAM, 0);
+        if (Bench_Socket[i] < 0)
+        {
+            return FALSE;
+        }
+        (void)memset(&Bench_Address[i], 0, sizeof(Bench_Address[i]));
+        Bench_Address[i].sin_family = AF_INET;
+        Bench_Address[i].sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        Bench_Address[i].sin_port = 0U;
+        (void)setsockopt(Bench_Socket[i], SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+        if ((bind(Bench_Socket[i], (struct sockaddr *)&Bench_Address[i], sizeof(Bench_Address[i])) != 0) ||
+            (getsockname(Bench_Socket[i], (struct sockaddr *)&Bench_Address[i], &length) != 0))
+        {
+            return FALSE;
+        }
+        (void)fcntl(Bench_Socket[i], F_SETFL, O_NONBLOCK);
+    }
+    return TRUE;
+}
+
+static void Bench_Send(uint32 from, uint32 to, const uint8 *data, uint32 length)
+{
+    (void)sendto(Bench_Socket[from], data, length, 0, (const struct sockaddr *)&Bench_Address[to],
+                 sizeof(Bench_Address[to]));
+}
+
+/** @brief Lower layer of the VCU: every destination maps to the peer socket of the same kind */
+Std_ReturnType Som_UdpTransmit(uint8 Socket, P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Data, uint16 Length)
+{
+    (void)Remote;
+    Bench_Send((Socket == SOM_SOCKET_SD) ? BENCH_VCU_SD : BENCH_VCU_EVENT,
+               (Socket == SOM_SOCKET_SD) ? BENCH_PEER_SD : BENCH_PEER_EVENT, Data, Length);
+    return E_OK;
+}
+
+/* -------------------------------------------- peer -------------------------------------------- */
+
+/** @brief Append an SD entry referring to the peer's endpoint option (index 0) */
+static uint32 Bench_PeerEntry(uint8 *entry, uint8 type, const Som_ServiceConfigType *service, uint32 ttl,
+    uint32 last_word)
+{
+    entry[0] = type;
+    entry[1] = 0U;
+    entry[2] = 0U;
+    entry[3] = 0x10U;
+    Som_StoreBe16(&entry[4], service->service_id);
+    Som_StoreBe16(&entry[6], service->instance_id);
+    Som_StoreBe32(&entry[8], ((uint32)service->major_version << 24U) | ttl);
+    Som_StoreBe32(&entry[12], last_word);
+    return 16U;
+}
+
+/** @brief Send an SD message with the entries at Bench_Datagram[24] and the peer's event endpoint */
+static void Bench_PeerSdSend(uint32 entries)
+{
+    uint8 *option = &Bench_Datagram[24U + entries];
+    uint32 length = 24U + entries + 4U + 12U;
+
+    Som_StoreBe32(&Bench_Datagram[0], 0xFFFF8100UL);
+    Som_StoreBe32(&Bench_Datagram[4], length - 8U);
+    Som_StoreBe32(&Bench_Datagram[8], Bench_PeerSession);
+    Bench_Datagram[12] = 0x01U;
+    Bench_Datagram[13] = 0x01U;
+    Bench_Datagram[14] = 0x02U;
+    Bench_Datagram[15] = 0x00U;
+    Som_StoreBe32(&Bench_Datagram[16], 0xC0000000UL);   /* Reboot, unicast */
+    Som_StoreBe32(&Bench_Datagram[20], entries);
+    Som_StoreBe32(option, 12U);
+    Som_StoreBe16(&option[4], 0x0009U);
+    option[6] = 0x04U;
+    option[7] = 0U;
+    Som_StoreBe32(&option[8], Bench_PeerEventEndpoint.address);
+    option[12] = 0U;
+    option[13] = 0x11U;
+    Som_StoreBe16(&option[14], Bench_PeerEventEndpoint.port);
+    Bench_PeerSession++;
+
+    Bench_Send(BENCH_PEER_SD, BENCH_VCU_SD, Bench_Datagram, length);
+}
+
+/** @brief Zone controller SD: offer on Find, subscribe on Offer, count acknowledges */
+static void Bench_PeerSd(const uint8 *msg, uint32 length)
+{
+    uint32 entries = Som_LoadBe32(&msg[20]);
+    uint32 out = 0U;
+    uint32 pos;
+    uint32 s;
+    uint32 g;
+
+    for (pos = 24U; (pos + 16U) <= (24U + entries) && (pos + 16U) <= length; pos += 16U)
+    {
+        const uint8 *entry = &msg[pos];
+        uint16 service_id = Som_LoadBe16(&entry[4]);
+        uint32 ttl = Som_LoadBe32(&entry[8]) & 0x00FFFFFFUL;
+
+        if ((entry[0] == 0x00U) || (entry[0] == 0x01U))
+        {
+            const Som_ServiceConfigType *list = (entry[0] == 0x00U) ? Som_ConsumedService : Som_ProvidedService;
+            uint32 count = (entry[0] == 0x00U) ? SOM_CONSUMED_SERVICE_COUNT : SOM_PROVIDED_SERVICE_COUNT;
+
+            for (s = 0U; s < count; s++)
+            {
+                if ((list[s].service_id != service_id) || (ttl == 0U))
+                {
+                    continue;
+                }
+                if (entry[0] == 0x00U)
+                {
+                    out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x01U, &list[s], SOM_SD_OFFER_TTL,
+                                           list[s].minor_version);
+                }
+                else
+                {
+                    for (g = 0U; g < list[s].eventgroup_count; g++)
+                    {
+                        out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x06U, &list[s], SOM_SD_SUBSCRIBE_TTL,
+                                               Som_ProvidedEventGroup[list[s].eventgroup_first + g].eventgroup_id);
+                    }
+                }
+            }
+        }
+        else if (entry[0] == 0x06U)
+        {
+            for (s = 0U; s < SOM_CONSUMED_SERVICE_COUNT; s++)
+            {
+                if (Som_ConsumedService[s].service_id == service_id)
+                {
+                    out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x07U, &Som_ConsumedService[s], ttl,
+                                           Som_LoadBe32(&entry[12]));
+                }
+            }
+        }
+        else if ((entry[0] == 0x07U) && (ttl != 0U))
+        {
+            Bench_PeerAcks++;
+        }
+        else
+        {
+            /* Nack or unused entry */
+        }
+    }
+    if (out != 0U)
+    {
+        Bench_PeerSdSend(out);
+    }
+}
+
+/** @brief Zone controller event reception: reassemble and keep the payload */
+static void Bench_PeerEventRx(const uint8 *msg, uint32 length)
+{
+    uint16 event_id = Som_LoadBe16(&msg[2]);
+    uint32 e;
+
+    for (e = 0U; e < SOM_TX_EVENT_COUNT; e++)
+    {
+        BenchPeerEventType *peer = &Bench_PeerEvent[e];
+
+        if (Som_TxEvent[e].event_id != event_id)
+        {
+            continue;
+        }
+        if ((msg[14] & 0x20U) == 0U)
+        {
+            (void)memcpy(peer->payload, &msg[16], length - 16U);
+            peer->length = length - 16U;
+            peer->received++;
+        }
+        else
+        {
+            uint32 word = Som_LoadBe32(&msg[16]);
+            uint32 offset = word & 0xFFFFFFF0UL;
+            uint32 segment = length - 20U;
+
+            if ((offset != ((offset == 0U) ? 0U : peer->next)) || ((offset + segment) > BENCH_PAYLOAD_MAX))
+            {
+                peer->next = 0U;
+                return;
+            }
+            (void)memcpy(&peer->payload[offset], &msg[20], segment);
+            peer->next = offset + segment;
+            if ((word & 1UL) == 0U)
+            {
+                peer->length = peer->next;
+                peer->received++;
+            }
+        }
+    }
+}
+
+/* -------------------------------------------- polling ----------------------------------------- */
+
+/** @brief Drain all sockets: VCU datagrams to Som_RxIndication(), peer datagrams to the emulator */
+static uint32 Bench_Poll(void)
+{
+    uint32 handled = 0U;
+    uint32 i;
+
+    for (i = 0U; i < BENCH_SOCKET_COUNT; i++)
+    {
+        ssize_t length;
+
+        while ((length = recv(Bench_Socket[i], Bench_Datagram, sizeof(Bench_Datagram), 0)) > 0)
+        {
+            handled++;
+            if (i == BENCH_VCU_SD)
+            {
+                Som_RxIndication(SOM_SOCKET_SD, &Bench_PeerSdEndpoint, Bench_Datagram, (uint16)length);
+            }
+            else if (i == BENCH_VCU_EVENT)
+            {
+                Som_RxIndication(SOM_SOCKET_EVENT, &Bench_PeerEventEndpoint, Bench_Datagram, (uint16)length);
+            }
+            else if (i == BENCH_PEER_SD)
+            {
+                static uint8 sd[BENCH_DATAGRAM_MAX];
+
+                (void)memcpy(sd, Bench_Datagram, (size_t)length);
+                Bench_PeerSd(sd, (uint32)length);
+            }
+            else
+            {
+                Bench_PeerEventRx(Bench_Datagram, (uint32)length);
+            }
+        }
+    }
+    return handled;
+}
+
+static boolean Bench_Connected(void)
+{
+    uint32 g;
+
+    for (g = 0U; g < SOM_CONSUMED_EVENTGROUP_COUNT; g++)
+    {
+        if (Som_GetEventGroupState(g) != SOM_EVENTGROUP_SUBSCRIBED)
+        {
+            return FALSE;
+        }
+    }
+    for (g = 0U; g < SOM_PROVIDED_EVENTGROUP_COUNT; g++)
+    {
+        if (Som_GetSubscriberCount(g) == 0U)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* --------------------------------------------- runs ------------------------------------------- */
+
+static void Bench_RunTx(Som_EventIdType event, BenchResultType *result)
+{
+    const Som_TxEventConfigType *cfg = &Som_TxEvent[event];
+    BenchPeerEventType *peer = &Bench_PeerEvent[event];
+    uint32 seed = 0x12345678UL + event;
+    uint32 i;
+    double t0;
+
+    Bench_RandomValue(&seed);
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_CODEC_ITERATIONS; i++)
+    {
+        Bench_Buffer[0] = (uint8)i;
+        result->length = cfg->serialize(&Bench_Value, Bench_Buffer);
+        Bench_Sink += Bench_Buffer[result->length - 1U];
+    }
+    result->serialize_ns = (Bench_NowNs() - t0) / (double)BENCH_CODEC_ITERATIONS;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_CODEC_ITERATIONS; i++)
+    {
+        if (Som_TxEventCheck[event](Bench_Buffer, result->length) != SOM_SER_ERROR)
+        {
+            Som_TxEventDeserialize[event](Bench_Buffer, &Bench_Decoded);
+        }
+        Bench_Sink += *(volatile uint8 *)&Bench_Decoded;
+    }
+    result->deserialize_ns = (Bench_NowNs() - t0) / (double)BENCH_CODEC_ITERATIONS;
+
+    peer->received = 0U;
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_LOOPBACK_EVENTS; i++)
+    {
+        (void)Som_SendEvent(event, &Bench_Value);
+        (void)Bench_Poll();
+    }
+    while (Bench_Poll() != 0U)
+    {
+    }
+    result->events_per_s = (double)peer->received * 1.0e9 / (Bench_NowNs() - t0);
+
+    /* Wire check: the peer's payload decodes and re-encodes to the reference serialization */
+    result->mismatches = BENCH_LOOPBACK_EVENTS - peer->received;
+    (void)cfg->serialize(&Bench_Value, Bench_Reference);
+    if ((peer->length != result->length) || (Som_TxEventCheck[event](peer->payload, peer->length) != peer->length) ||
+        (memcmp(peer->payload, Bench_Reference, result->length) != 0))
+    {
+        result->mismatches++;
+    }
+}
+
+/** @brief Send one zone event from the peer, segmented like the VCU does */
+static void Bench_PeerSendEvent(const Som_RxEventConfigType *cfg, uint16 session, uint32 length)
+{
+    uint32 offset = 0U;
+
+    do
+    {
+        boolean tp = (cfg->tp_buffer != NULL_PTR) ? TRUE : FALSE;
+        uint32 header = (tp == TRUE) ? 20U : 16U;
+        uint32 segment = length - offset;
+        uint32 more = 0U;
+
+        if ((tp == TRUE) && (segment > SOM_TP_SEGMENT_LENGTH))
+        {
+            segment = SOM_TP_SEGMENT_LENGTH;
+            more = 1U;
+        }
+        Som_StoreBe16(&Bench_Datagram[0], cfg->service_id);
+        Som_StoreBe16(&Bench_Datagram[2], cfg->event_id);
+        Som_StoreBe32(&Bench_Datagram[4], header - 8U + segment);
+        Som_StoreBe32(&Bench_Datagram[8], session);
+        Bench_Datagram[12] = 0x01U;
+        Bench_Datagram[13] = 0x01U;
+        Bench_Datagram[14] = (tp == TRUE) ? 0x22U : 0x02U;
+        Bench_Datagram[15] = 0x00U;
+        if (tp == TRUE)
+        {
+            Som_StoreBe32(&Bench_Datagram[16], offset | more);
+        }
+        (void)memcpy(&Bench_Datagram[header], &Bench_Buffer[offset], segment);
+        Bench_Send(BENCH_PEER_EVENT, BENCH_VCU_EVENT, Bench_Datagram, header + segment);
+        offset += segment;
+    } while (offset < length);
+}
+
+static void Bench_RunRx(Som_EventIdType event, BenchResultType *result)
+{
+    const Som_RxEventConfigType *cfg = &Som_RxEvent[Som_RxEventIndex[event]];
+    uint32 seed = 0x9E3779B9UL + event;
+    Som_StatisticsType before;
+    Som_StatisticsType after;
+    uint32 i;
+    double t0;
+
+    Bench_RandomValue(&seed);
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_CODEC_ITERATIONS; i++)
+    {
+        Bench_Buffer[0] = (uint8)i;
+        result->length = Som_RxEventSerialize[event](&Bench_Value, Bench_Buffer);
+        Bench_Sink += Bench_Buffer[result->length - 1U];
+    }
+    result->serialize_ns = (Bench_NowNs() - t0) / (double)BENCH_CODEC_ITERATIONS;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_CODEC_ITERATIONS; i++)
+    {
+        if (cfg->check(Bench_Buffer, result->length) != SOM_SER_ERROR)
+        {
+            cfg->deserialize(Bench_Buffer, &Bench_Decoded);
+        }
+        Bench_Sink += *(volatile uint8 *)&Bench_Decoded;
+    }
+    result->deserialize_ns = (Bench_NowNs() - t0) / (double)BENCH_CODEC_ITERATIONS;
+
+    /* Canonical payload: the deserializer maps any non-zero boolean to TRUE */
+    result->length = Som_RxEventSerialize[event](&Bench_Decoded, Bench_Buffer);
+
+    Som_GetStatistics(&before);
+    t0 = Bench_NowNs();
+    for (i = 0U; i < BENCH_LOOPBACK_EVENTS; i++)
+    {
+        Bench_PeerSendEvent(cfg, (uint16)(i + 1U), result->length);
+        (void)Bench_Poll();
+        (void)Som_ReceiveEvent(event, &Bench_Decoded);
+    }
+    while (Bench_Poll() != 0U)
+    {
+    }
+    Som_GetStatistics(&after);
+    result->events_per_s = (double)BENCH_LOOPBACK_EVENTS * 1.0e9 / (Bench_NowNs() - t0);
+
+    /* Wire check: the shadow re-encodes to the payload the peer sent */
+    result->mismatches = after.rx_dropped - before.rx_dropped;
+    (void)memset(&Bench_Decoded, 0, sizeof(Bench_Decoded));
+    if ((Som_ReceiveEvent(event, &Bench_Decoded) != E_OK) ||
+        (Som_RxEventSerialize[event](&Bench_Decoded, Bench_Reference) != result->length) ||
+        (memcmp(Bench_Reference, Bench_Buffer, result->length) != 0))
+    {
+        result->mismatches++;
+    }
+}
+
+static boolean Bench_Print(const char *name, const char *direction, const BenchResultType *result)
+{
+    (void)printf("%-16s %-3s %6u %14.1f %14.1f %12.0f %10u\n", name, direction, (unsigned)result->length,
+                 result->serialize_ns, result->deserialize_ns, result->events_per_s, (unsigned)result->mismatches);
+    return (result->mismatches == 0U) ? TRUE : FALSE;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    static const char *const tx_names[SOM_TX_EVENT_COUNT] = {
+        "VehicleMotion", "PowertrainState", "BatteryStatus", "DiagSnapshot"
+    };
+    static const char *const rx_names[SOM_RX_EVENT_COUNT] = {
+        "PedalInputs", "SteeringInput", "RearSensors", "RearDiagnostics"
+    };
+    BenchResultType result;
+    Som_StatisticsType statistics;
+    Som_EventIdType event;
+    uint32 cycles;
+    int status = EXIT_SUCCESS;
+
+    if (Bench_OpenSockets() == FALSE)
+    {
+        (void)printf("ERROR: cannot open the localhost UDP sockets\n");
+        return EXIT_FAILURE;
+    }
+
+    Som_Init();
+    (void)Som_OfferService(SomConf_SomProvidedService_VehicleState);
+    (void)Som_OfferService(SomConf_SomProvidedService_VehicleDiagnostics);
+
+    for (cycles = 0U; (cycles < BENCH_SD_CYCLES_MAX) && (Bench_Connected() == FALSE); cycles++)
+    {
+        Som_MainFunction();
+        (void)Bench_Poll();
+        (void)Bench_Poll();
+    }
+    if (Bench_Connected() == FALSE)
+    {
+        (void)printf("ERROR: service discovery did not complete in %u cycles\n", (unsigned)cycles);
+        return EXIT_FAILURE;
+    }
+    (void)printf("SD complete after %u main function cycles (%u ms), %u subscribe acks\n\n", (unsigned)cycles,
+                 (unsigned)(cycles * SOM_MAIN_FUNCTION_PERIOD_MS), (unsigned)Bench_PeerAcks);
+
+    (void)printf("%-16s %-3s %6s %14s %14s %12s %10s\n",
+                 "event", "dir", "bytes", "serialize[ns]", "deserial.[ns]", "events/s", "mismatches");
+    for (event = 0U; event < SOM_TX_EVENT_COUNT; event++)
+    {
+        Bench_RunTx(event, &result);
+        if (Bench_Print(tx_names[event], "tx", &result) == FALSE)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+    for (event = 0U; event < SOM_RX_EVENT_COUNT; event++)
+    {
+        Bench_RunRx(event, &result);
+        if (Bench_Print(rx_names[event], "rx", &result) == FALSE)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    Som_GetStatistics(&statistics);
+    (void)printf("\nVCU: %u datagrams sent, %u tx errors, %u messages received, %u dropped\n",
+                 (unsigned)statistics.tx_messages, (unsigned)statistics.tx_errors,
+                 (unsigned)statistics.rx_messages, (unsigned)statistics.rx_dropped);
+    if (status != EXIT_SUCCESS)
+    {
+        (void)printf("ERROR: events lost or payload differs from the reference serialization\n");
+    }
+
+    return status;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
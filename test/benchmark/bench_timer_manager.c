@@ -0,0 +1,354 @@
+/**
+ * @file    bench_timer_manager.c
+ * @brief   Host benchmark: hierarchical timing wheel vs. sorted timer list
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Compares timer_manager.c against the classic sorted doubly linked list
+ * (O(n) insertion, O(1) removal, O(1) head expiry) with 1k and 10k timers.
+ *
+ * Workloads per timer count N:
+ * - start:   arm N timers with pseudo-random delays (1..MAX_DELAY_TICKS)
+ * - restart: N x RESTART_ROUNDS retriggers of random timers, the COM
+ *            deadline-monitoring pattern (every reception re-arms a timer)
+ * - expire:  run ticks until every timer expired, batch-dispatching each tick
+ * - stop:    re-arm all timers and cancel them again
+ *
+ * Both implementations are fed the same operation sequence and the number of
+ * expirations per tick is cross-checked, so the benchmark doubles as a
+ * functional comparison against a trivially correct reference.
+ *
+ * Expected result: the wheel starts and restarts timers orders of magnitude
+ * faster, but its tick is slower (speedup 0.2-0.4x): every tick advances the
+ * slot cursor and cascades the upper levels, while the sorted list only
+ * compares its head. The tick cost is paid once per tick, not per timer.
+ *
+ * Build (host toolchain profile, no critical sections needed single-threaded):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF \
+ *     -DTIMERMGR_DEV_ERROR_DETECT=STD_OFF \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Iplatform/baremetal_core/timing \
+ *     test/benchmark/bench_timer_manager.c platform/baremetal_core/timing/timer_manager.c \
+ *     -o bench_timer_manager
+ * @endcode
+ *
+ * @see timer_manager.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 199309L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "timer_manager.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_MAX_TIMERS                        10000U
+#define BENCH_MAX_DELAY_TICKS                   10000U
+#define BENCH_RESTART_ROUNDS                    10U
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/**
+ * @brief Reference implementation: timer in a list sorted by expiry
+ */
+typedef struct BenchSortedTimerTag
+{
+    struct BenchSortedTimerTag *next;
+    struct BenchSortedTimerTag *prev;
+    uint32 expiry;
+    boolean armed;
+} BenchSortedTimerType;
+
+typedef struct
+{
+    BenchSortedTimerType head;          /**< Sentinel */
+    uint32 now;
+} BenchSortedListType;
+
+typedef struct
+{
+    double start_ns;
+    double restart_ns;
+    double expire_ns;
+    double stop_ns;
+    uint32 expirations;
+} BenchResultType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static TimerMgr_WheelType Bench_Wheel;
+static TimerMgr_TimerType Bench_WheelTimers[BENCH_MAX_TIMERS];
+static TimerMgr_TimerType *Bench_Drained[BENCH_MAX_TIMERS];
+
+static BenchSortedListType Bench_List;
+static BenchSortedTimerType Bench_ListTimers[BENCH_MAX_TIMERS];
+
+static uint32 Bench_Delays[BENCH_MAX_TIMERS * (BENCH_RESTART_ROUNDS + 1U)];
+static uint32 Bench_Targets[BENCH_MAX_TIMERS * BENCH_RESTART_ROUNDS];
+static uint32 Bench_ExpiredPerTick[BENCH_MAX_DELAY_TICKS * 2U + 2U];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+/* ------------------------------------ sorted list reference ---------------------------------- */
+
+static void Bench_ListInit(BenchSortedListType *list)
+{
+    list->head.next = &list->head;
+    list->head.prev = &list->head;
+    list->now = 0U;
+}
+
+static void Bench_ListStop(BenchSortedTimerType *timer)
+{
+    if (timer->armed == TRUE)
+    {
+        timer->prev->next = timer->next;
+        timer->next->prev = timer->prev;
+        timer->armed = FALSE;
+    }
+}
+
+static void Bench_ListStart(BenchSortedListType *list, BenchSortedTimerType *timer, uint32 delay)
+{
+    BenchSortedTimerType *pos = list->head.next;
+
+    Bench_ListStop(timer);
+    timer->expiry = list->now + delay;
+
+    /* O(n) ordered insertion (stable: after equal expiries) */
+    while ((pos != &list->head) && ((sint32)(pos->expiry - timer->expiry) <= 0))
+    {
+        pos = pos->next;
+    }
+
+    timer->next = pos;
+    timer->prev = pos->prev;
+    pos->prev->next = timer;
+    pos->prev = timer;
+    timer->armed = TRUE;
+}
+
+static uint32 Bench_ListTick(BenchSortedListType *list)
+{
+    uint32 count = 0U;
+
+    list->now++;
+    while ((list->head.next != &list->head) && (list->head.next->expiry == list->now))
+    {
+        Bench_ListStop(list->head.next);
+        count++;
+    }
+
+    return count;
+}
+
+/* ------------------------------------------ workloads ---------------------------------------- */
+
+static void Bench_PrepareWorkload(uint32 count)
+{
+    uint32 seed = 0x2545F491U;
+    uint32 i;
+
+    for (i = 0U; i < (count * (BENCH_RESTART_ROUNDS + 1U)); i++)
+    {
+        Bench_Delays[i] = (Bench_Random(&seed) % BENCH_MAX_DELAY_TICKS) + 1U;
+    }
+
+    for (i = 0U; i < (count * BENCH_RESTART_ROUNDS); i++)
+    {
+        Bench_Targets[i] = Bench_Random(&seed) % count;
+    }
+}
+
+static void Bench_RunWheel(uint32 count, BenchResultType *result)
+{
+    uint32 i;
+    uint32 tick;
+    uint32 total = 0U;
+    double t0;
+
+    TimerMgr_Init(&Bench_Wheel, 0U);
+    for (i = 0U; i < count; i++)
+    {
+        TimerMgr_InitTimer(&Bench_WheelTimers[i], NULL_PTR, NULL_PTR);
+    }
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < count; i++)
+    {
+        (void)TimerMgr_Start(&Bench_Wheel, &Bench_WheelTimers[i], Bench_Delays[i], 0U);
+    }
+    result->start_ns = (Bench_NowNs() - t0) / (double)count;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < (count * BENCH_RESTART_ROUNDS); i++)
+    {
+        (void)TimerMgr_Start(&Bench_Wheel, &Bench_WheelTimers[Bench_Targets[i]],
+                             Bench_Delays[count + i], 0U);
+    }
+    result->restart_ns = (Bench_NowNs() - t0) / (double)(count * BENCH_RESTART_ROUNDS);
+
+    t0 = Bench_NowNs();
+    for (tick = 0U; tick < ARRAY_SIZE(Bench_ExpiredPerTick); tick++)
+    {
+        (void)TimerMgr_Tick(&Bench_Wheel);
+        Bench_ExpiredPerTick[tick] = TimerMgr_DrainExpired(&Bench_Wheel, Bench_Drained, count);
+        total += Bench_ExpiredPerTick[tick];
+    }
+    result->expire_ns = (Bench_NowNs() - t0) / (double)ARRAY_SIZE(Bench_ExpiredPerTick);
+    result->expirations = total;
+
+    for (i = 0U; i < count; i++)
+    {
+        (void)TimerMgr_Start(&Bench_Wheel, &Bench_WheelTimers[i], Bench_Delays[i], 0U);
+    }
+    t0 = Bench_NowNs();
+    for (i = 0U; i < count; i++)
+    {
+        TimerMgr_Stop(&Bench_Wheel, &Bench_WheelTimers[i]);
+    }
+    result->stop_ns = (Bench_NowNs() - t0) / (double)count;
+}
+
+static void Bench_RunList(uint32 count, BenchResultType *result, uint32 *mismatches)
+{
+    uint32 i;
+    uint32 tick;
+    uint32 expired;
+    uint32 total = 0U;
+    double t0;
+
+    Bench_ListInit(&Bench_List);
+    for (i = 0U; i < count; i++)
+    {
+        Bench_ListTimers[i].armed = FALSE;
+    }
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < count; i++)
+    {
+        Bench_ListStart(&Bench_List, &Bench_ListTimers[i], Bench_Delays[i]);
+    }
+    result->start_ns = (Bench_NowNs() - t0) / (double)count;
+
+    t0 = Bench_NowNs();
+    for (i = 0U; i < (count * BENCH_RESTART_ROUNDS); i++)
+    {
+        Bench_ListStart(&Bench_List, &Bench_ListTimers[Bench_Targets[i]], Bench_Delays[count + i]);
+    }
+    result->restart_ns = (Bench_NowNs() - t0) / (double)(count * BENCH_RESTART_ROUNDS);
+
+    *mismatches = 0U;
+    t0 = Bench_NowNs();
+    for (tick = 0U; tick < ARRAY_SIZE(Bench_ExpiredPerTick); tick++)
+    {
+        expired = Bench_ListTick(&Bench_List);
+        if (expired != Bench_ExpiredPerTick[tick])
+        {
+            (*mismatches)++;
+        }
+        total += expired;
+    }
+    result->expire_ns = (Bench_NowNs() - t0) / (double)ARRAY_SIZE(Bench_ExpiredPerTick);
+    result->expirations = total;
+
+    for (i = 0U; i < count; i++)
+    {
+        Bench_ListStart(&Bench_List, &Bench_ListTimers[i], Bench_Delays[i]);
+    }
+    t0 = Bench_NowNs();
+    for (i = 0U; i < count; i++)
+    {
+        Bench_ListStop(&Bench_ListTimers[i]);
+    }
+    result->stop_ns = (Bench_NowNs() - t0) / (double)count;
+}
+
+static void Bench_PrintRow(const char *name, uint32 count, const BenchResultType *r)
+{
+    (void)printf("%-12s %6u %12.1f %12.1f %12.1f %12.1f %10u\n",
+                 name, (unsigned)count, r->start_ns, r->restart_ns, r->expire_ns, r->stop_ns,
+                 (unsigned)r->expirations);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    static const uint32 counts[] = { 1000U, 10000U };
+    BenchResultType wheel;
+    BenchResultType list;
+    uint32 mismatches;
+    uint32 i;
+    int status = EXIT_SUCCESS;
+
+    (void)printf("%-12s %6s %12s %12s %12s %12s %10s\n",
+                 "impl", "timers", "start[ns]", "restart[ns]", "tick[ns]", "stop[ns]", "expired");
+
+    for (i = 0U; i < ARRAY_SIZE(counts); i++)
+    {
+        Bench_PrepareWorkload(counts[i]);
+        Bench_RunWheel(counts[i], &wheel);
+        Bench_RunList(counts[i], &list, &mismatches);
+
+        Bench_PrintRow("wheel", counts[i], &wheel);
+        Bench_PrintRow("sorted-list", counts[i], &list);
+        (void)printf("%-12s %6u %11.1fx %11.1fx %11.1fx %11.1fx\n", "speedup", (unsigned)counts[i],
+                     list.start_ns / wheel.start_ns, list.restart_ns / wheel.restart_ns,
+                     list.expire_ns / wheel.expire_ns, list.stop_ns / wheel.stop_ns);
+
+        if ((mismatches != 0U) || (wheel.expirations != counts[i]) || (list.expirations != counts[i]))
+        {
+            (void)printf("ERROR: expiry sequence mismatch (%u ticks differ)\n", (unsigned)mismatches);
+            status = EXIT_FAILURE;
+        }
+    }
+    (void)printf("note: tick speedup < 1 is expected, the wheel advances and cascades slots every tick\n");
+
+    return status;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
@@ -0,0 +1,1270 @@
+/**
+ * @file    bench_vbus_gateway.c
+ * @brief   Host benchmark: gateway throughput and latency of the COM stack over virtual buses
+ * @version 1.0.0
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026 ASIL-D VCU Project
+ *
+ * @details
+ * Runs the communication stack of the VCU as built for the target (Com,
+ * PduR with the PduPool, CanTp, SOME/IP and their generated
+ * configurations) on the host against the simulated ECUs of vbus_cfg.c,
+ * connected over the in-process buses of vbus.c (CAN-FD PT / CH / BD and
+ * Ethernet). Nothing but the bus interface modules is replaced:
+ *
+ * | Traffic     | Source                                  | Measured                          |
+ * |-------------|-----------------------------------------|-----------------------------------|
+ * | Gateway     | Every non-TP RX PDU of the VCU, sent by | Source queued -> destination      |
+ * |             | its ECU every period_ms of the scenario | delivered, per direction          |
+ * | UDS         | One tester per CAN bus: ReadDataById    | Request queued -> last CF         |
+ * |             | SF, BENCH_UDS_RESPONSE byte response    | delivered (FF / FC / CFs)         |
+ * | SOME/IP     | VCU events and zone events (TP included)| Send -> complete at the zone peer |
+ * | Com         | Cyclic Com PDUs of the VCU              | Bus load only                     |
+ *
+ * Every ECU PDU carries a sequence number in bytes 0..3 and a pattern
+ * derived from it in the rest; each gateway destination that delivers it
+ * is checked against the pattern and counted, so lost, duplicated and
+ * corrupted PDUs are found as well as late ones.
+ *
+ * Scenarios vary the background load and the jitter of the bus models.
+ * All latencies are virtual time of the bus models: they do not depend on
+ * the host and a run is reproducible to the nanosecond, so the budgets of
+ * Bench_Scenario[] (p99 per direction, losses, UDS round trip) serve as
+ * regression gates of the gateway on every commit. The host time per
+ * routed PDU is reported and gated only if BENCH_MAX_HOST_NS_PER_PDU is
+ * set (it depends on the machine).
+ *
+ * Build (host toolchain profile):
+ * @code
+ * gcc -O2 -std=c99 -DOS_PORT_POSIX -DCOM_DEV_ERROR_DETECT=STD_OFF -DPDUR_DEV_ERROR_DETECT=STD_OFF \
+ *     -DCANTP_DEV_ERROR_DETECT=STD_OFF -DSOM_DEV_ERROR_DETECT=STD_OFF -DPDUPOOL_DEV_ERROR_DETECT=STD_OFF \
+ *     -DTIMERMGR_DEV_ERROR_DETECT=STD_OFF -DTIMERMGR_CRITICAL_SECTION_ENABLED=STD_OFF \
+ *     -DSOM_PEER_CODECS=STD_ON \
+ *     -Iplatform/abstraction -Isrc/mcal/common -Isrc/bsw/os -Isrc/bsw/com -Isimulation/sil \
+ *     -Iplatform/baremetal_core/timing \
+ *     test/benchmark/bench_vbus_gateway.c simulation/sil/vbus.c simulation/sil/vbus_cfg.c \
+ *     src/bsw/com/com_stack.c src/bsw/com/com_cfg.c src/bsw/com/pdu_router.c src/bsw/com/pdur_cfg.c \
+ *     src/bsw/com/pdu_pool.c src/bsw/com/can_tp.c src/bsw/com/can_tp_cfg.c \
+ *     src/bsw/com/som_stack.c src/bsw/com/som_cfg.c \
+ *     platform/baremetal_core/timing/timer_manager.c -o bench_vbus_gateway
+ * @endcode
+ *
+ * @see vbus.h
+ * @see pdu_router.h
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 200112L         /* clock_gettime() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "vbus.h"
+#include "com_stack.h"
+#include "pdu_router.h"
+#include "pdu_pool.h"
+#include "can_tp.h"
+#include "som_stack.h"
+#include "som_pack.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+
+#define BENCH_STEP_NS                           1000000ULL      /* 1 ms main loop step */
+#define BENCH_DURATION_MS                       2000U           /* Traffic per scenario */
+#define BENCH_DRAIN_MS                          100U            /* Bus drain after the traffic */
+#define BENCH_SD_MS_MAX                         2000U           /* Service discovery before the traffic */
+#define BENCH_COM_PERIOD_MS                     5U              /* Com_MainFunctionRx/Tx, Som_MainFunction */
+#define BENCH_UDS_PERIOD_MS                     100U
+#define BENCH_UDS_TIMEOUT_MS                    1000U
+#define BENCH_UDS_RESPONSE                      254U            /* FF + 4 CFs on CAN-FD */
+#define BENCH_DCM_BUFFER                        4095U
+
+#define BENCH_SEQ_MAX                           65536U
+#define BENCH_HIST_US                           50000U          /* Histogram range, 1 us buckets */
+#define BENCH_DCM_PDUS                          16U
+#define BENCH_PAYLOAD_MAX                       8192U
+#define BENCH_DATAGRAM_MAX                      VBUS_MAX_PAYLOAD
+
+/** @brief Node ID of the SOME/IP zone peer on the Ethernet bus (not a PDU sender of Vbus_Ecu) */
+#define BENCH_NODE_ZONE                         VBUS_ECU_COUNT
+#define BENCH_PEER_ADDRESS                      0xC0A80A02UL
+
+/* Latency classes */
+#define BENCH_CAN_CAN                           0U
+#define BENCH_CAN_ETH                           1U
+#define BENCH_ETH_CAN                           2U
+#define BENCH_ETH_ETH                           3U
+#define BENCH_UDS                               4U
+#define BENCH_SOMEIP                            5U
+#define BENCH_CLASS_COUNT                       6U
+#define BENCH_GATEWAY_CLASSES                   4U
+
+/**
+ * @def BENCH_MAX_HOST_NS_PER_PDU
+ * @brief Host time budget per routed PDU, 0 = reported only
+ */
+#ifndef BENCH_MAX_HOST_NS_PER_PDU
+    #define BENCH_MAX_HOST_NS_PER_PDU           0U
+#endif
+
+#define BENCH_NO_BUS                            0xFFU
+
+#if (SOM_PEER_CODECS != STD_ON)
+    #error "bench_vbus_gateway.c needs -DSOM_PEER_CODECS=STD_ON"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+typedef struct
+{
+    const char *name;
+    uint8 can_load;                     /**< Background load of the CAN buses [%] */
+    uint8 eth_load;                     /**< Background load of the Ethernet bus [%] */
+    uint32 can_jitter_ns;
+    uint32 eth_jitter_ns;
+    uint32 period_ms;                   /**< Send period of every ECU PDU */
+    /* Budgets (virtual time, deterministic) */
+    uint32 gateway_p99_us;              /**< p99 of every gateway direction */
+    uint32 uds_max_us;                  /**< Slowest UDS round trip */
+    uint32 someip_max_us;               /**< Slowest SOME/IP event */
+    uint32 max_lost;                    /**< Gateway PDUs not delivered */
+} BenchScenarioType;
+
+typedef struct
+{
+    uint32 count;
+    uint64 sum_ns;
+    uint64 max_ns;
+    uint32 bucket[BENCH_HIST_US + 1U];  /**< Last bucket: BENCH_HIST_US and above */
+} BenchHistogramType;
+
+typedef struct
+{
+    uint16 request;                     /**< CanIfRxPduId of the physical request / FC */
+    uint16 response;                    /**< CanIfTxPduId of the response SF / FF / CF */
+    boolean busy;
+    uint64 sent_ns;
+    uint32 expected;                    /**< Response length from the FF */
+    uint32 received;
+    uint32 completed;
+    uint32 timeouts;
+    uint32 skipped;                     /**< Request due while the previous one was open */
+} BenchTesterType;
+
+typedef struct
+{
+    PduIdType path;                     /**< PduR source handle of PduR_DcmTransmit() */
+    boolean pending;                    /**< Request received, response not yet started */
+    uint32 rx_length;
+    uint32 tx_offset;
+} BenchDcmType;
+
+typedef struct
+{
+    uint8 payload[BENCH_PAYLOAD_MAX];
+    uint32 next;                        /**< TP: offset of the next segment */
+    uint32 received;                    /**< Complete events */
+    uint64 sent_ns;                     /**< Som_SendEvent() of the last event */
+} BenchPeerEventType;
+
+typedef struct
+{
+    uint32 sent;                        /**< ECU PDUs sent */
+    uint32 expected;                    /**< Gateway deliveries expected */
+    uint32 delivered;
+    uint32 duplicated;
+    uint32 corrupted;
+    uint32 refused;                     /**< Vbus_EcuTransmit() failed: ECU bus queue full */
+    uint32 vcu_frames;                  /**< Frames of the VCU, gateway, Com and TP */
+    uint32 someip_sent;
+    uint32 someip_lost;
+    uint32 zone_sent;
+} BenchCountersType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+static const BenchScenarioType Bench_Scenario[] = {
+    /* name       CAN% ETH% CAN jitter ETH jitter period  p99 us  UDS us SOME/IP us lost */
+    { "idle",        0U,  0U,       0U,        0U,  100U,   1500U,  6000U,   1000U,    0U },
+    { "nominal",    30U, 10U,    2000U,     5000U,  100U,   2500U, 12000U,   1000U,    0U },
+    { "loaded",     60U, 40U,    2000U,     5000U,  100U,   5000U, 50000U,   1000U,    0U },
+    { "stress",     40U, 40U,    2000U,     5000U,   50U,   5000U, 60000U,   1000U,    0U },
+};
+
+#define BENCH_SCENARIO_COUNT                    (sizeof(Bench_Scenario) / sizeof(Bench_Scenario[0]))
+
+static const char *const Bench_ClassName[BENCH_CLASS_COUNT] = {
+    "CAN -> CAN", "CAN -> ETH", "ETH -> CAN", "ETH -> ETH", "UDS round trip", "SOME/IP event"
+};
+
+static const Som_EndpointType Bench_PeerSdEndpoint = { BENCH_PEER_ADDRESS, SOM_SD_PORT };
+static const Som_EndpointType Bench_PeerEventEndpoint = { BENCH_PEER_ADDRESS, SOM_LOCAL_PORT };
+
+static BenchHistogramType Bench_Histogram[BENCH_CLASS_COUNT];
+static BenchCountersType Bench_Count;
+
+/* Per sequence number: send time, expected and delivered gateway destinations */
+static uint64 Bench_SeqSentNs[BENCH_SEQ_MAX];
+static uint8 Bench_SeqExpected[BENCH_SEQ_MAX];
+static uint8 Bench_SeqDelivered[BENCH_SEQ_MAX];
+static uint32 Bench_Seq;
+
+/* Gateway destinations (CanIf, SoAd, EthComm) per PduR source handle */
+static uint8 Bench_GatewayDests[PDUR_ROUTING_PATH_COUNT];
+
+static BenchTesterType Bench_Tester[VBUS_BUS_COUNT];
+static BenchDcmType Bench_Dcm[VBUS_BUS_COUNT];
+static uint8 Bench_DcmRxBus[BENCH_DCM_PDUS];    /* Dcm RX handle -> bus */
+static uint8 Bench_DcmTxBus[BENCH_DCM_PDUS];    /* Dcm TX handle -> bus */
+static uint8 Bench_DcmRequest[BENCH_DCM_BUFFER];
+static uint8 Bench_DcmResponse[BENCH_UDS_RESPONSE];
+
+static BenchPeerEventType Bench_PeerEvent[SOM_TX_EVENT_COUNT];
+static uint16 Bench_PeerSession = 1U;
+static uint16 Bench_ZoneSession[SOM_RX_EVENT_COUNT];
+static uint8 Bench_ZonePayload[SOM_RX_EVENT_COUNT][BENCH_PAYLOAD_MAX];
+static uint32 Bench_ZoneLength[SOM_RX_EVENT_COUNT];
+static uint8 Bench_Datagram[BENCH_DATAGRAM_MAX];
+static uint8 Bench_Frame[VBUS_MAX_PAYLOAD];
+
+/** @brief Application values: largest variants of every data type */
+static union
+{
+    Som_VehicleMotionType vehicle_motion;
+    Som_PowertrainStateType powertrain_state;
+    Som_BatteryStatusType battery_status;
+    Som_DiagSnapshotType diag_snapshot;
+    Som_PedalInputsType pedal_inputs;
+    Som_SteeringInputType steering_input;
+    Som_RearSensorsType rear_sensors;
+    Som_RearDiagnosticsType rear_diagnostics;
+} Bench_Value, Bench_Decoded;
+
+/** @brief Send period of the VCU events (SomConf_SomTxEvent_*) and zone events (SomConf_SomRxEvent_*) */
+static const uint32 Bench_TxEventPeriodMs[SOM_TX_EVENT_COUNT] = { 10U, 10U, 100U, 1000U };
+static const uint32 Bench_RxEventPeriodMs[SOM_RX_EVENT_COUNT] = { 10U, 10U, 20U, 1000U };
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+static uint32 Bench_Random(uint32 *state)
+{
+    uint32 x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return x;
+}
+
+static double Bench_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static void Bench_Record(uint8 cls, uint64 latency_ns)
+{
+    BenchHistogramType *h = &Bench_Histogram[cls];
+    uint64 us = latency_ns / 1000U;
+
+    h->bucket[(us < BENCH_HIST_US) ? us : BENCH_HIST_US]++;
+    h->count++;
+    h->sum_ns += latency_ns;
+    if (latency_ns > h->max_ns)
+    {
+        h->max_ns = latency_ns;
+    }
+}
+
+/** @brief Percentile of a histogram in us (bucket resolution) */
+static uint32 Bench_Percentile(const BenchHistogramType *h, uint32 permille)
+{
+    uint64 rank = (((uint64)h->count * permille) + 999U) / 1000U;
+    uint64 seen = 0U;
+    uint32 us;
+
+    for (us = 0U; us <= BENCH_HIST_US; us++)
+    {
+        seen += h->bucket[us];
+        if ((seen >= rank) && (seen != 0U))
+        {
+            return us;
+        }
+    }
+    return 0U;
+}
+
+static uint8 Bench_IsGatewayModule(uint8 module)
+{
+    return ((module == PduRConf_PduRBswModule_CanIf) || (module == PduRConf_PduRBswModule_SoAd) ||
+            (module == PduRConf_PduRBswModule_EthComm)) ? TRUE : FALSE;
+}
+
+/** @brief Pattern byte k of sequence number seq (bytes 0..3 carry seq itself) */
+static uint8 Bench_Pattern(uint32 seq, uint32 k)
+{
+    return (uint8)((seq * 7U) + k);
+}
+
+/* ------------------------------------------- topology ----------------------------------------- */
+
+/** @brief Gateway fan-out per source, Dcm handles per bus and the UDS tester PDUs per bus */
+static void Bench_Topology(void)
+{
+    uint32 i;
+
+    (void)memset(Bench_GatewayDests, 0, sizeof(Bench_GatewayDests));
+    (void)memset(Bench_Tester, 0, sizeof(Bench_Tester));
+    (void)memset(Bench_Dcm, 0, sizeof(Bench_Dcm));
+    (void)memset(Bench_DcmRxBus, BENCH_NO_BUS, sizeof(Bench_DcmRxBus));
+    (void)memset(Bench_DcmTxBus, BENCH_NO_BUS, sizeof(Bench_DcmTxBus));
+
+    for (i = 0U; i < PDUR_DEST_PDU_COUNT; i++)
+    {
+        const PduR_DestType *dest = &PduR_DestPdu[i];
+
+        if (Bench_IsGatewayModule(dest->module) == TRUE)
+        {
+            Bench_GatewayDests[dest->path]++;
+        }
+        else if ((dest->module == PduRConf_PduRBswModule_Dcm) && (dest->module_pdu < BENCH_DCM_PDUS))
+        {
+            /* CanTp RX N-SDU -> its FC PDU -> bus; functional requests have no FC and no bus */
+            PduIdType fc = CanTp_RxNSdu[PduR_RoutingPath[dest->path].src_pdu].fc_pdu;
+
+            if (fc != CANTP_NO_PDU)
+            {
+                Bench_DcmRxBus[dest->module_pdu] = Vbus_CanIfTxPdu[fc].bus;
+            }
+        }
+        else
+        {
+            /* Com, Dcm above range */
+        }
+    }
+
+    for (i = 0U; i < VBUS_BUS_COUNT; i++)
+    {
+        Bench_Tester[i].request = 0xFFFFU;
+        Bench_Tester[i].response = 0xFFFFU;
+        Bench_Dcm[i].path = 0xFFFFU;
+    }
+    for (i = 0U; i < PDUR_ROUTING_PATH_COUNT; i++)
+    {
+        const PduR_RoutingPathType *path = &PduR_RoutingPath[i];
+
+        if ((path->src_module == PduRConf_PduRBswModule_Dcm) && (path->src_pdu < BENCH_DCM_PDUS))
+        {
+            const PduR_DestType *dest = &PduR_DestPdu[path->dest_first];
+            uint8 bus = Vbus_CanIfTxPdu[CanTp_TxNSdu[dest->module_pdu].data_pdu].bus;
+
+            Bench_DcmTxBus[path->src_pdu] = bus;
+            Bench_Dcm[bus].path = (PduIdType)i;
+        }
+    }
+
+    /* Tester: physical request (its N-PDU also receives the FC of the response), response data PDU */
+    for (i = 0U; i < VBUS_CANIF_RX_PDU_COUNT; i++)
+    {
+        const Vbus_PduConfigType *pdu = &Vbus_CanIfRxPdu[i];
+
+        if (((pdu->flags & VBUS_PDU_CANTP) != 0U) && (CanTp_RxNPdu[pdu->upper].tx_nsdu != CANTP_NO_NSDU))
+        {
+            Bench_Tester[pdu->bus].request = (uint16)i;
+        }
+    }
+    for (i = 0U; i < VBUS_CANIF_TX_PDU_COUNT; i++)
+    {
+        const Vbus_PduConfigType *pdu = &Vbus_CanIfTxPdu[i];
+
+        if (((pdu->flags & VBUS_PDU_CANTP) != 0U) && (CanTp_TxNPdu[pdu->upper].flow_control == FALSE))
+        {
+            Bench_Tester[pdu->bus].response = (uint16)i;
+        }
+    }
+}
+
+/* ------------------------------------------ ECU traffic --------------------------------------- */
+
+static void Bench_EcuSend(uint8 kind, uint16 index, const Vbus_PduConfigType *pdu)
+{
+    uint32 seq = Bench_Seq;
+    uint32 k;
+
+    if (seq >= BENCH_SEQ_MAX)
+    {
+        return;
+    }
+    Bench_Frame[0] = (uint8)seq;
+    Bench_Frame[1] = (uint8)(seq >> 8U);
+    Bench_Frame[2] = (uint8)(seq >> 16U);
+    Bench_Frame[3] = (uint8)(seq >> 24U);
+    for (k = 4U; k < pdu->length; k++)
+    {
+        Bench_Frame[k] = Bench_Pattern(seq, k);
+    }
+    if (Vbus_EcuTransmit(kind, index, Bench_Frame, pdu->length) != E_OK)
+    {
+        Bench_Count.refused++;
+        return;
+    }
+    Bench_Seq++;
+    Bench_Count.sent++;
+    Bench_SeqSentNs[seq] = Vbus_GetTimeNs();
+    Bench_SeqDelivered[seq] = 0U;
+    Bench_SeqExpected[seq] = (pdu->length >= 4U) ? Bench_GatewayDests[pdu->upper] : 0U;
+    Bench_Count.expected += Bench_SeqExpected[seq];
+}
+
+/** @brief Send the ECU PDUs due in this millisecond, phases spread over the period */
+static void Bench_EcuStep(uint32 ms, uint32 period_ms)
+{
+    uint16 i;
+
+    for (i = 0U; i < VBUS_CANIF_RX_PDU_COUNT; i++)
+    {
+        if (((Vbus_CanIfRxPdu[i].flags & VBUS_PDU_CANTP) == 0U) && ((ms % period_ms) == ((i * 13U) % period_ms)))
+        {
+            Bench_EcuSend(VBUS_FRAME_CANIF, i, &Vbus_CanIfRxPdu[i]);
+        }
+    }
+    for (i = 0U; i < VBUS_SOAD_RX_PDU_COUNT; i++)
+    {
+        if ((ms % period_ms) == (((i * 17U) + 3U) % period_ms))
+        {
+            Bench_EcuSend(VBUS_FRAME_SOAD, i, &Vbus_SoAdRxPdu[i]);
+        }
+    }
+}
+
+/** @brief Gateway destination delivered to its ECU: latency, pattern and count */
+static void Bench_GatewayRx(const Vbus_FrameType *frame, PduIdType dest)
+{
+    const PduR_RoutingPathType *path = &PduR_RoutingPath[PduR_DestPdu[dest].path];
+    uint8 src_eth = (path->src_module == PduRConf_PduRBswModule_SoAd) ? TRUE : FALSE;
+    uint8 dst_eth = (frame->kind != VBUS_FRAME_CANIF) ? TRUE : FALSE;
+    uint32 seq;
+    uint32 k;
+
+    if ((path->src_module != PduRConf_PduRBswModule_CanIf) && (src_eth == FALSE))
+    {
+        return;                         /* Com PDU */
+    }
+    if (frame->length < 4U)
+    {
+        return;
+    }
+    seq = (uint32)frame->data[0] | ((uint32)frame->data[1] << 8U) | ((uint32)frame->data[2] << 16U) |
+          ((uint32)frame->data[3] << 24U);
+    if (seq >= Bench_Seq)
+    {
+        Bench_Count.corrupted++;
+        return;
+    }
+    for (k = 4U; k < frame->length; k++)
+    {
+        if (frame->data[k] != Bench_Pattern(seq, k))
+        {
+            Bench_Count.corrupted++;
+            return;
+        }
+    }
+    if (Bench_SeqDelivered[seq] >= Bench_SeqExpected[seq])
+    {
+        Bench_Count.duplicated++;
+        return;
+    }
+    Bench_SeqDelivered[seq]++;
+    Bench_Count.delivered++;
+    Bench_Record((uint8)((src_eth == TRUE) ? ((dst_eth == TRUE) ? BENCH_ETH_ETH : BENCH_ETH_CAN)
+                                           : ((dst_eth == TRUE) ? BENCH_CAN_ETH : BENCH_CAN_CAN)),
+                 frame->delivered_ns - Bench_SeqSentNs[seq]);
+}
+
+/* ---------------------------------------------- UDS ------------------------------------------- */
+
+static void Bench_TesterStep(uint32 ms)
+{
+    static const uint8 request[8] = { 0x03U, 0x22U, 0xF1U, 0x90U, 0xCCU, 0xCCU, 0xCCU, 0xCCU };
+    uint8 bus;
+
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        BenchTesterType *tester = &Bench_Tester[bus];
+
+        if ((tester->request == 0xFFFFU) || ((ms % BENCH_UDS_PERIOD_MS) != ((bus * 7U) + 50U)))
+        {
+            continue;
+        }
+        if (tester->busy == TRUE)
+        {
+            if ((Vbus_GetTimeNs() - tester->sent_ns) < (BENCH_UDS_TIMEOUT_MS * BENCH_STEP_NS))
+            {
+                tester->skipped++;
+                continue;
+            }
+            tester->timeouts++;
+        }
+        if (Vbus_EcuTransmit(VBUS_FRAME_CANIF, tester->request, request, sizeof(request)) == E_OK)
+        {
+            tester->busy = TRUE;
+            tester->sent_ns = Vbus_GetTimeNs();
+            tester->expected = 0U;
+            tester->received = 0U;
+        }
+    }
+}
+
+/** @brief Response frame at the tester: FC after the FF, round trip after the last CF */
+static void Bench_TesterRx(BenchTesterType *tester, const Vbus_FrameType *frame)
+{
+    static const uint8 flow_control[8] = { 0x30U, 0x00U, 0x00U, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU };
+    uint8 pci = (uint8)(frame->data[0] >> 4U);
+
+    if (tester->busy == FALSE)
+    {
+        return;
+    }
+    if (pci == 0U)
+    {
+        tester->expected = 1U;          /* SF: complete */
+        tester->received = 1U;
+    }
+    else if (pci == 1U)
+    {
+        tester->expected = ((uint32)(frame->data[0] & 0x0FU) << 8U) | frame->data[1];
+        tester->received = (uint32)frame->length - 2U;
+        (void)Vbus_EcuTransmit(VBUS_FRAME_CANIF, tester->request, flow_control, sizeof(flow_control));
+    }
+    else if (pci == 2U)
+    {
+        tester->received += (uint32)frame->length - 1U;
+    }
+    else
+    {
+        return;
+    }
+    if ((tester->expected != 0U) && (tester->received >= tester->expected))
+    {
+        tester->busy = FALSE;
+        tester->completed++;
+        Bench_Record(BENCH_UDS, frame->delivered_ns - tester->sent_ns);
+    }
+}
+
+/** @brief Dcm: start the response of a received request */
+static void Bench_DcmStep(void)
+{
+    uint8 bus;
+
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        BenchDcmType *dcm = &Bench_Dcm[bus];
+        PduInfoType info;
+
+        if ((dcm->pending == FALSE) || (dcm->path == 0xFFFFU))
+        {
+            continue;
+        }
+        info.SduDataPtr = NULL_PTR;
+        info.SduLength = BENCH_UDS_RESPONSE;
+        if (PduR_DcmTransmit(dcm->path, &info) == E_OK)
+        {
+            dcm->pending = FALSE;
+            dcm->tx_offset = 0U;
+        }
+    }
+}
+
+/* -------------------------------------------- SOME/IP ----------------------------------------- */
+
+static void Bench_PeerSend(uint16 socket, const uint8 *data, uint32 length)
+{
+    (void)Vbus_RawTransmit(BENCH_NODE_ZONE, VBUS_NODE_VCU, socket, data, (uint16)length);
+}
+
+/** @brief Append an SD entry referring to the peer's endpoint option (index 0) */
+static uint32 Bench_PeerEntry(uint8 *entry, uint8 type, const Som_ServiceConfigType *service, uint32 ttl,
+    uint32 last_word)
+{
+    entry[0] = type;
+    entry[1] = 0U;
+    entry[2] = 0U;
+    entry[3] = 0x10U;
+    Som_StoreBe16(&entry[4], service->service_id);
+    Som_StoreBe16(&entry[6], service->instance_id);
+    Som_StoreBe32(&entry[8], ((uint32)service->major_version << 24U) | ttl);
+    Som_StoreBe32(&entry[12], last_word);
+    return 16U;
+}
+
+/** @brief Send an SD message with the entries at Bench_Datagram[24] and the peer's event endpoint */
+static void Bench_PeerSdSend(uint32 entries)
+{
+    uint8 *option = &Bench_Datagram[24U + entries];
+    uint32 length = 24U + entries + 4U + 12U;
+
+    Som_StoreBe32(&Bench_Datagram[0], 0xFFFF8100UL);
+    Som_StoreBe32(&Bench_Datagram[4], length - 8U);
+    Som_StoreBe32(&Bench_Datagram[8], Bench_PeerSession);
+    Bench_Datagram[12] = 0x01U;
+    Bench_Datagram[13] = 0x01U;
+    Bench_Datagram[14] = 0x02U;
+    Bench_Datagram[15] = 0x00U;
+    Som_StoreBe32(&Bench_Datagram[16], 0xC0000000UL);   /* Reboot, unicast */
+    Som_StoreBe32(&Bench_Datagram[20], entries);
+    Som_StoreBe32(option, 12U);
+    Som_StoreBe16(&option[4], 0x0009U);
+    option[6] = 0x04U;
+    option[7] = 0U;
+    Som_StoreBe32(&option[8], Bench_PeerEventEndpoint.address);
+    option[12] = 0U;
+    option[13] = 0x11U;
+    Som_StoreBe16(&option[14], Bench_PeerEventEndpoint.port);
+    Bench_PeerSession++;
+
+    Bench_PeerSend(SOM_SOCKET_SD, Bench_Datagram, length);
+}
+
+/** @brief Zone controller SD: offer on Find, subscribe on Offer, acknowledge Subscribe */
+static void Bench_PeerSd(const uint8 *msg, uint32 length)
+{
+    uint32 entries = Som_LoadBe32(&msg[20]);
+    uint32 out = 0U;
+    uint32 pos;
+    uint32 s;
+    uint32 g;
+
+    for (pos = 24U; (pos + 16U) <= (24U + entries) && (pos + 16U) <= length; pos += 16U)
+    {
+        const uint8 *entry = &msg[pos];
+        uint16 service_id = Som_LoadBe16(&entry[4]);
+        uint32 ttl = Som_LoadBe32(&entry[8]) & 0x00FFFFFFUL;
+
+        if ((entry[0] == 0x00U) || (entry[0] == 0x01U))
+        {
+            const Som_ServiceConfigType *list = (entry[0] == 0x00U) ? Som_ConsumedService : Som_ProvidedService;
+            uint32 count = (entry[0] == 0x00U) ? SOM_CONSUMED_SERVICE_COUNT : SOM_PROVIDED_SERVICE_COUNT;
+
+            for (s = 0U; s < count; s++)
+            {
+                if ((list[s].service_id != service_id) || (ttl == 0U))
+                {
+                    continue;
+                }
+                if (entry[0] == 0x00U)
+                {
+                    out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x01U, &list[s], SOM_SD_OFFER_TTL,
+                                           list[s].minor_version);
+                }
+                else
+                {
+                    for (g = 0U; g < list[s].eventgroup_count; g++)
+                    {
+                        out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x06U, &list[s], SOM_SD_SUBSCRIBE_TTL,
+                                               Som_ProvidedEventGroup[list[s].eventgroup_first + g].eventgroup_id);
+                    }
+                }
+            }
+        }
+        else if (entry[0] == 0x06U)
+        {
+            for (s = 0U; s < SOM_CONSUMED_SERVICE_COUNT; s++)
+            {
+                if (Som_ConsumedService[s].service_id == service_id)
+                {
+                    out += Bench_PeerEntry(&Bench_Datagram[24U + out], 0x07U, &Som_ConsumedService[s], ttl,
+                                           Som_LoadBe32(&entry[12]));
+                }
+            }
+        }
+        else
+        {
+            /* Acknowledge, Nack or unused entry */
+        }
+    }
+    if (out != 0U)
+    {
+        Bench_PeerSdSend(out);
+    }
+}
+
+/** @brief Zone controller event reception: reassemble, latency of complete events */
+static void Bench_PeerEventRx(const uint8 *msg, uint32 length, uint64 now_ns)
+{
+    uint16 event_id = Som_LoadBe16(&msg[2]);
+    uint32 e;
+
+    for (e = 0U; e < SOM_TX_EVENT_COUNT; e++)
+    {
+        BenchPeerEventType *peer = &Bench_PeerEvent[e];
+        boolean complete = FALSE;
+
+        if (Som_TxEvent[e].event_id != event_id)
+        {
+            continue;
+        }
+        if ((msg[14] & 0x20U) == 0U)
+        {
+            complete = TRUE;
+        }
+        else
+        {
+            uint32 word = Som_LoadBe32(&msg[16]);
+            uint32 offset = word & 0xFFFFFFF0UL;
+            uint32 segment = length - 20U;
+
+            if ((offset != ((offset == 0U) ? 0U : peer->next)) || ((offset + segment) > BENCH_PAYLOAD_MAX))
+            {
+                peer->next = 0U;
+                return;
+            }
+            (void)memcpy(&peer->payload[offset], &msg[20], segment);
+            peer->next = offset + segment;
+            complete = ((word & 1UL) == 0U) ? TRUE : FALSE;
+        }
+        if (complete == TRUE)
+        {
+            peer->received++;
+            Bench_Record(BENCH_SOMEIP, now_ns - peer->sent_ns);
+        }
+    }
+}
+
+/** @brief Send one zone event from the peer, segmented like the VCU does */
+static void Bench_PeerSendEvent(Som_EventIdType event)
+{
+    const Som_RxEventConfigType *cfg = &Som_RxEvent[Som_RxEventIndex[event]];
+    const uint8 *payload = Bench_ZonePayload[event];
+    uint32 length = Bench_ZoneLength[event];
+    uint16 session = ++Bench_ZoneSession[event];
+    uint32 offset = 0U;
+
+    do
+    {
+        boolean tp = (cfg->tp_buffer != NULL_PTR) ? TRUE : FALSE;
+        uint32 header = (tp == TRUE) ? 20U : 16U;
+        uint32 segment = length - offset;
+        uint32 more = 0U;
+
+        if ((tp == TRUE) && (segment > SOM_TP_SEGMENT_LENGTH))
+        {
+            segment = SOM_TP_SEGMENT_LENGTH;
+            more = 1U;
+        }
+        Som_StoreBe16(&Bench_Datagram[0], cfg->service_id);
+        Som_StoreBe16(&Bench_Datagram[2], cfg->event_id);
+        Som_StoreBe32(&Bench_Datagram[4], header - 8U + segment);
+        Som_StoreBe32(&Bench_Datagram[8], session);
+        Bench_Datagram[12] = 0x01U;
+        Bench_Datagram[13] = 0x01U;
+        Bench_Datagram[14] = (tp == TRUE) ? 0x22U : 0x02U;
+        Bench_Datagram[15] = 0x00U;
+        if (tp == TRUE)
+        {
+            Som_StoreBe32(&Bench_Datagram[16], offset | more);
+        }
+        (void)memcpy(&Bench_Datagram[header], &payload[offset], segment);
+        Bench_PeerSend(SOM_SOCKET_EVENT, Bench_Datagram, header + segment);
+        offset += segment;
+    } while (offset < length);
+    Bench_Count.zone_sent++;
+}
+
+static boolean Bench_Connected(void)
+{
+    uint32 g;
+
+    for (g = 0U; g < SOM_CONSUMED_EVENTGROUP_COUNT; g++)
+    {
+        if (Som_GetEventGroupState(g) != SOM_EVENTGROUP_SUBSCRIBED)
+        {
+            return FALSE;
+        }
+    }
+    for (g = 0U; g < SOM_PROVIDED_EVENTGROUP_COUNT; g++)
+    {
+        if (Som_GetSubscriberCount(g) == 0U)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/** @brief Largest values of every data type; zone payloads in canonical encoding */
+static void Bench_SomValues(void)
+{
+    uint8 *bytes = (uint8 *)&Bench_Value;
+    uint32 seed = 0x9E3779B9UL;
+    Som_EventIdType event;
+    uint32 i;
+
+    for (i = 0U; i < sizeof(Bench_Value); i++)
+    {
+        bytes[i] = (uint8)Bench_Random(&seed);
+    }
+    Bench_Value.battery_status.CellVoltagesLength = 192U;
+    Bench_Value.battery_status.CellTempsLength = 96U;
+    Bench_Value.rear_diagnostics.BlocksLength = 6000U;
+
+    for (event = 0U; event < SOM_RX_EVENT_COUNT; event++)
+    {
+        const Som_RxEventConfigType *cfg = &Som_RxEvent[Som_RxEventIndex[event]];
+        uint32 length = Som_RxEventSerialize[event](&Bench_Value, Bench_ZonePayload[event]);
+
+        /* The deserializer maps any non-zero boolean to TRUE */
+        if (cfg->check(Bench_ZonePayload[event], length) != SOM_SER_ERROR)
+        {
+            cfg->deserialize(Bench_ZonePayload[event], &Bench_Decoded);
+        }
+        Bench_ZoneLength[event] = Som_RxEventSerialize[event](&Bench_Decoded, Bench_ZonePayload[event]);
+    }
+}
+
+static void Bench_SomStep(uint32 ms)
+{
+    Som_EventIdType event;
+
+    for (event = 0U; event < SOM_TX_EVENT_COUNT; event++)
+    {
+        if ((ms % Bench_TxEventPeriodMs[event]) == (event % Bench_TxEventPeriodMs[event]))
+        {
+            Bench_PeerEvent[event].sent_ns = Vbus_GetTimeNs();
+            if (Som_SendEvent(event, &Bench_Value) == E_OK)
+            {
+                Bench_Count.someip_sent++;
+            }
+        }
+    }
+    for (event = 0U; event < SOM_RX_EVENT_COUNT; event++)
+    {
+        if ((ms % Bench_RxEventPeriodMs[event]) == ((event + 5U) % Bench_RxEventPeriodMs[event]))
+        {
+            Bench_PeerSendEvent(event);
+        }
+        (void)Som_ReceiveEvent(event, &Bench_Decoded);
+    }
+}
+
+/* -------------------------------------------- scenario ---------------------------------------- */
+
+static void Bench_Models(const BenchScenarioType *scenario)
+{
+    uint8 bus;
+
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        Vbus_ModelType model = *Vbus_GetModel(bus);
+
+        if (Vbus_Bus[bus].format == VBUS_ETHERNET)
+        {
+            model.load_percent = scenario->eth_load;
+            model.jitter_ns = scenario->eth_jitter_ns;
+        }
+        else
+        {
+            model.load_percent = scenario->can_load;
+            model.jitter_ns = scenario->can_jitter_ns;
+        }
+        (void)Vbus_SetModel(bus, &model);
+    }
+}
+
+/** @brief One 1 ms step of the VCU: main functions, then the buses up to the next step */
+static void Bench_Step(uint32 ms)
+{
+    Bench_DcmStep();
+    CanTp_MainFunction();
+    if ((ms % BENCH_COM_PERIOD_MS) == 0U)
+    {
+        Com_MainFunctionRx();
+        Com_MainFunctionTx();
+        Som_MainFunction();
+    }
+    Vbus_Run(((uint64)ms + 1U) * BENCH_STEP_NS);
+}
+
+static boolean Bench_Check(boolean ok, const char *what, uint32 value, uint32 budget)
+{
+    if (ok == FALSE)
+    {
+        (void)printf("  REGRESSION: %s %u exceeds budget %u\n", what, (unsigned)value, (unsigned)budget);
+    }
+    return ok;
+}
+
+static boolean Bench_RunScenario(const BenchScenarioType *scenario)
+{
+    Vbus_StatisticsType before[VBUS_BUS_COUNT];
+    Vbus_StatisticsType after;
+    PduPool_StatisticsType pool;
+    Som_StatisticsType som;
+    boolean ok = TRUE;
+    uint32 start_ms;
+    uint32 ms;
+    uint32 cls;
+    uint32 uds_timeouts = 0U;
+    uint32 uds_skipped = 0U;
+    uint32 pool_failures = 0U;
+    uint32 lost;
+    uint8 bus;
+    double t0;
+    double host_ns;
+
+    (void)memset(Bench_Histogram, 0, sizeof(Bench_Histogram));
+    (void)memset(&Bench_Count, 0, sizeof(Bench_Count));
+    (void)memset(Bench_PeerEvent, 0, sizeof(Bench_PeerEvent));
+    Bench_Seq = 0U;
+
+    Vbus_Init();
+    Bench_Models(scenario);
+    PduPool_Init();
+    PduR_Init();
+    Com_Init();
+    CanTp_Init();
+    Som_Init();
+    Bench_Topology();
+    (void)Som_OfferService(SomConf_SomProvidedService_VehicleState);
+    (void)Som_OfferService(SomConf_SomProvidedService_VehicleDiagnostics);
+
+    /* Service discovery with the zone peer and the cyclic Com traffic running */
+    for (ms = 0U; (ms < BENCH_SD_MS_MAX) && (Bench_Connected() == FALSE); ms++)
+    {
+        Bench_Step(ms);
+    }
+    if (Bench_Connected() == FALSE)
+    {
+        (void)printf("%s: ERROR: service discovery did not complete in %u ms\n", scenario->name,
+                     (unsigned)BENCH_SD_MS_MAX);
+        return FALSE;
+    }
+    start_ms = ms;
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        (void)Vbus_GetStatistics(bus, &before[bus]);
+    }
+    Som_GetStatistics(&som);
+    Bench_Count.someip_lost = som.rx_dropped;
+
+    t0 = Bench_NowNs();
+    for (ms = start_ms; ms < (start_ms + BENCH_DURATION_MS + BENCH_DRAIN_MS); ms++)
+    {
+        if (ms < (start_ms + BENCH_DURATION_MS))
+        {
+            Bench_EcuStep(ms - start_ms, scenario->period_ms);
+            Bench_TesterStep(ms - start_ms);
+            Bench_SomStep(ms - start_ms);
+        }
+        Bench_Step(ms);
+    }
+    host_ns = Bench_NowNs() - t0;
+
+    /* ---- report ---- */
+    (void)printf("%s: CAN load %u %%, ETH load %u %%, jitter %u / %u us, ECU period %u ms, SD %u ms\n",
+                 scenario->name, (unsigned)scenario->can_load, (unsigned)scenario->eth_load,
+                 (unsigned)(scenario->can_jitter_ns / 1000U), (unsigned)(scenario->eth_jitter_ns / 1000U),
+                 (unsigned)scenario->period_ms, (unsigned)start_ms);
+    (void)printf("  %-8s %10s %10s %10s %10s %10s %10s\n",
+                 "bus", "util[%]", "frames", "vcu", "backgr.", "rejected", "max queue");
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        uint64 window = (uint64)(BENCH_DURATION_MS + BENCH_DRAIN_MS) * BENCH_STEP_NS;
+
+        (void)Vbus_GetStatistics(bus, &after);
+        (void)printf("  %-8s %10.1f %10u %10u %10u %10u %10u\n", Vbus_Bus[bus].name,
+                     100.0 * (double)(after.busy_ns - before[bus].busy_ns) / (double)window,
+                     (unsigned)(after.frames - before[bus].frames),
+                     (unsigned)(after.vcu_frames - before[bus].vcu_frames),
+                     (unsigned)(after.background_frames - before[bus].background_frames),
+                     (unsigned)(after.rejected - before[bus].rejected), (unsigned)after.max_queued);
+        Bench_Count.vcu_frames += after.vcu_frames - before[bus].vcu_frames;
+    }
+
+    (void)printf("  %-16s %8s %10s %10s %10s %10s\n", "latency", "samples", "mean[us]", "p50[us]", "p99[us]",
+                 "max[us]");
+    for (cls = 0U; cls < BENCH_CLASS_COUNT; cls++)
+    {
+        const BenchHistogramType *h = &Bench_Histogram[cls];
+        uint32 p99 = Bench_Percentile(h, 990U);
+
+        if (h->count == 0U)
+        {
+            continue;
+        }
+        (void)printf("  %-16s %8u %10.1f %10u %10u %10.1f\n", Bench_ClassName[cls], (unsigned)h->count,
+                     (double)h->sum_ns / (double)h->count / 1000.0, (unsigned)Bench_Percentile(h, 500U),
+                     (unsigned)p99, (double)h->max_ns / 1000.0);
+        if (cls < BENCH_GATEWAY_CLASSES)
+        {
+            ok &= Bench_Check((p99 <= scenario->gateway_p99_us) ? TRUE : FALSE, Bench_ClassName[cls], p99,
+                              scenario->gateway_p99_us);
+        }
+    }
+
+    for (bus = 0U; bus < VBUS_BUS_COUNT; bus++)
+    {
+        uds_timeouts += Bench_Tester[bus].timeouts + (Bench_Tester[bus].busy == TRUE ? 1U : 0U);
+        uds_skipped += Bench_Tester[bus].skipped;
+    }
+    for (cls = 0U; cls < PDUPOOL_CLASS_COUNT; cls++)
+    {
+        if (PduPool_GetStatistics((uint8)cls, &pool) == E_OK)
+        {
+            pool_failures += pool.failures;
+        }
+    }
+    Som_GetStatistics(&som);
+    Bench_Count.someip_lost = som.rx_dropped - Bench_Count.someip_lost;
+    lost = Bench_Count.expected - Bench_Count.delivered;
+
+    (void)printf("  gateway: %u ECU PDUs (%u refused), %u expected, %u delivered, %u lost, %u duplicated, "
+                 "%u corrupted\n", (unsigned)Bench_Count.sent, (unsigned)Bench_Count.refused,
+                 (unsigned)Bench_Count.expected, (unsigned)Bench_Count.delivered, (unsigned)lost,
+                 (unsigned)Bench_Count.duplicated, (unsigned)Bench_Count.corrupted);
+    (void)printf("  UDS: %u round trips, %u timeouts, %u skipped; SOME/IP: %u VCU events, %u at the peer, "
+                 "%u zone events, %u dropped; PduPool failures %u\n",
+                 (unsigned)Bench_Histogram[BENCH_UDS].count, (unsigned)uds_timeouts, (unsigned)uds_skipped,
+                 (unsigned)Bench_Count.someip_sent, (unsigned)Bench_Histogram[BENCH_SOMEIP].count,
+                 (unsigned)Bench_Count.zone_sent, (unsigned)Bench_Count.someip_lost, (unsigned)pool_failures);
+    (void)printf("  host: %.0f ns per routed frame, %.2f ms per simulated second\n",
+                 host_ns / (double)(Bench_Count.sent + Bench_Count.vcu_frames),
+                 host_ns / 1.0e6 / ((double)(BENCH_DURATION_MS + BENCH_DRAIN_MS) / 1000.0));
+
+    ok &= Bench_Check((lost <= scenario->max_lost) ? TRUE : FALSE, "lost gateway PDUs", lost, scenario->max_lost);
+    ok &= Bench_Check((Bench_Count.duplicated == 0U) ? TRUE : FALSE, "duplicated gateway PDUs",
+                      Bench_Count.duplicated, 0U);
+    ok &= Bench_Check((Bench_Count.corrupted == 0U) ? TRUE : FALSE, "corrupted gateway PDUs",
+                      Bench_Count.corrupted, 0U);
+    ok &= Bench_Check((uds_timeouts == 0U) ? TRUE : FALSE, "UDS timeouts", uds_timeouts, 0U);
+    ok &= Bench_Check((Bench_Histogram[BENCH_UDS].max_ns <= ((uint64)scenario->uds_max_us * 1000U)) ? TRUE : FALSE,
+                      "UDS round trip [us]", (uint32)(Bench_Histogram[BENCH_UDS].max_ns / 1000U),
+                      scenario->uds_max_us);
+    ok &= Bench_Check((Bench_Histogram[BENCH_SOMEIP].count == Bench_Count.someip_sent) ? TRUE : FALSE,
+                      "SOME/IP events lost", Bench_Count.someip_sent - Bench_Histogram[BENCH_SOMEIP].count, 0U);
+    ok &= Bench_Check((Bench_Count.someip_lost == 0U) ? TRUE : FALSE, "SOME/IP messages dropped",
+                      Bench_Count.someip_lost, 0U);
+    ok &= Bench_Check((Bench_Histogram[BENCH_SOMEIP].max_ns <= ((uint64)scenario->someip_max_us * 1000U)) ?
+                      TRUE : FALSE, "SOME/IP event [us]", (uint32)(Bench_Histogram[BENCH_SOMEIP].max_ns / 1000U),
+                      scenario->someip_max_us);
+    ok &= Bench_Check((pool_failures == 0U) ? TRUE : FALSE, "PduPool failures", pool_failures, 0U);
+#if (BENCH_MAX_HOST_NS_PER_PDU != 0U)
+    {
+        uint32 per_pdu = (uint32)(host_ns / (double)(Bench_Count.sent + Bench_Count.vcu_frames));
+
+        ok &= Bench_Check((per_pdu <= BENCH_MAX_HOST_NS_PER_PDU) ? TRUE : FALSE, "host ns per frame", per_pdu,
+                          BENCH_MAX_HOST_NS_PER_PDU);
+    }
+#endif
+    (void)printf("\n");
+
+    return ok;
+}
+
+/*==================================================================================================
+*                                 CALLOUTS OF THE VIRTUAL BUS
+==================================================================================================*/
+
+/** @brief Virtual cycle counter: CanTp timestamps follow the bus time */
+uint32 Sil_GetCycleCount(void)
+{
+    return (uint32)((Vbus_GetTimeNs() * CANTP_TICKS_PER_US) / 1000U);
+}
+
+void Vbus_EcuRxIndication(const Vbus_FrameType *Frame)
+{
+    if (Frame->kind == VBUS_FRAME_RAW)
+    {
+        if (Frame->pdu == SOM_SOCKET_SD)
+        {
+            Bench_PeerSd(Frame->data, Frame->length);
+        }
+        else
+        {
+            Bench_PeerEventRx(Frame->data, Frame->length, Frame->delivered_ns);
+        }
+    }
+    else if (Frame->kind == VBUS_FRAME_CANIF)
+    {
+        const Vbus_PduConfigType *pdu = &Vbus_CanIfTxPdu[Frame->pdu];
+
+        if ((pdu->flags & VBUS_PDU_CANTP) == 0U)
+        {
+            Bench_GatewayRx(Frame, pdu->upper);
+        }
+        else if (Frame->pdu == Bench_Tester[Frame->bus].response)
+        {
+            Bench_TesterRx(&Bench_Tester[Frame->bus], Frame);
+        }
+        else
+        {
+            /* FC of the VCU: the tester sends single frames only */
+        }
+    }
+    else if (Frame->kind == VBUS_FRAME_SOAD)
+    {
+        Bench_GatewayRx(Frame, Vbus_SoAdTxPdu[Frame->pdu].upper);
+    }
+    else
+    {
+        Bench_GatewayRx(Frame, Vbus_EthCommTxPdu[Frame->pdu].upper);
+    }
+}
+
+void Vbus_RawRxIndication(const Vbus_FrameType *Frame)
+{
+    Som_RxIndication((uint8)Frame->pdu, (Frame->pdu == SOM_SOCKET_SD) ? &Bench_PeerSdEndpoint :
+                     &Bench_PeerEventEndpoint, Frame->data, Frame->length);
+}
+
+/** @brief Lower layer of the VCU SOME/IP stack: every destination is the zone peer */
+Std_ReturnType Som_UdpTransmit(uint8 Socket, P2CONST(Som_EndpointType, AUTOMATIC, SOM_APPL_DATA) Remote,
+    P2CONST(uint8, AUTOMATIC, SOM_APPL_DATA) Data, uint16 Length)
+{
+    (void)Remote;
+    return Vbus_RawTransmit(VBUS_NODE_VCU, BENCH_NODE_ZONE, Socket, Data, Length);
+}
+
+/*==================================================================================================
+*                                     DCM OF THE BENCHMARK
+==================================================================================================*/
+
+BufReq_ReturnType Dcm_StartOfReception(PduIdType id, const PduInfoType *info, PduLengthType TpSduLength,
+    PduLengthType *bufferSizePtr)
+{
+    (void)info;
+    if ((id >= BENCH_DCM_PDUS) || (TpSduLength > BENCH_DCM_BUFFER))
+    {
+        return BUFREQ_E_OVFL;
+    }
+    if (Bench_DcmRxBus[id] != BENCH_NO_BUS)
+    {
+        Bench_Dcm[Bench_DcmRxBus[id]].rx_length = 0U;
+    }
+    *bufferSizePtr = BENCH_DCM_BUFFER;
+    return BUFREQ_OK;
+}
+
+BufReq_ReturnType Dcm_CopyRxData(PduIdType id, const PduInfoType *info, PduLengthType *bufferSizePtr)
+{
+    uint32 offset = 0U;
+
+    if ((id < BENCH_DCM_PDUS) && (Bench_DcmRxBus[id] != BENCH_NO_BUS))
+    {
+        offset = Bench_Dcm[Bench_DcmRxBus[id]].rx_length;
+    }
+    if ((offset + info->SduLength) > BENCH_DCM_BUFFER)
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    if (info->SduLength != 0U)
+    {
+        (void)memcpy(&Bench_DcmRequest[offset], info->SduDataPtr, info->SduLength);
+    }
+    if ((id < BENCH_DCM_PDUS) && (Bench_DcmRxBus[id] != BENCH_NO_BUS))
+    {
+        Bench_Dcm[Bench_DcmRxBus[id]].rx_length = offset + info->SduLength;
+    }
+    *bufferSizePtr = (PduLengthType)(BENCH_DCM_BUFFER - offset - info->SduLength);
+    return BUFREQ_OK;
+}
+
+void Dcm_TpRxIndication(PduIdType id, Std_ReturnType result)
+{
+    /* Functional requests have no bus of their own and are not answered */
+    if ((result == E_OK) && (id < BENCH_DCM_PDUS) && (Bench_DcmRxBus[id] != BENCH_NO_BUS))
+    {
+        Bench_Dcm[Bench_DcmRxBus[id]].pending = TRUE;
+    }
+}
+
+BufReq_ReturnType Dcm_CopyTxData(PduIdType id, const PduInfoType *info, const RetryInfoType *retry,
+    PduLengthType *availableDataPtr)
+{
+    BenchDcmType *dcm;
+
+    (void)retry;
+    if ((id >= BENCH_DCM_PDUS) || (Bench_DcmTxBus[id] == BENCH_NO_BUS))
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    dcm = &Bench_Dcm[Bench_DcmTxBus[id]];
+    if ((dcm->tx_offset + info->SduLength) > BENCH_UDS_RESPONSE)
+    {
+        return BUFREQ_E_NOT_OK;
+    }
+    if (info->SduLength != 0U)
+    {
+        (void)memcpy(info->SduDataPtr, &Bench_DcmResponse[dcm->tx_offset], info->SduLength);
+        dcm->tx_offset += info->SduLength;
+    }
+    *availableDataPtr = (PduLengthType)(BENCH_UDS_RESPONSE - dcm->tx_offset);
+    return BUFREQ_OK;
+}
+
+void Dcm_TpTxConfirmation(PduIdType id, Std_ReturnType result)
+{
+    (void)id;
+    (void)result;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    boolean ok = TRUE;
+    uint32 i;
+
+    Bench_DcmResponse[0] = 0x62U;
+    Bench_DcmResponse[1] = 0xF1U;
+    Bench_DcmResponse[2] = 0x90U;
+    for (i = 3U; i < BENCH_UDS_RESPONSE; i++)
+    {
+        Bench_DcmResponse[i] = (uint8)i;
+    }
+    Bench_SomValues();
+
+    (void)printf("Virtual buses: %u, simulated ECUs: %u, gateway sources: %u CanIf + %u SoAd, "
+                 "%u s traffic per scenario\n\n", (unsigned)VBUS_BUS_COUNT, (unsigned)VBUS_ECU_COUNT,
+                 (unsigned)VBUS_CANIF_RX_PDU_COUNT, (unsigned)VBUS_SOAD_RX_PDU_COUNT,
+                 (unsigned)(BENCH_DURATION_MS / 1000U));
+
+    for (i = 0U; i < BENCH_SCENARIO_COUNT; i++)
+    {
+        if (Bench_RunScenario(&Bench_Scenario[i]) == FALSE)
+        {
+            ok = FALSE;
+        }
+    }
+    if (ok == FALSE)
+    {
+        (void)printf("ERROR: gateway budgets exceeded\n");
+    }
+
+    return (ok == TRUE) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*==================================================================================================
+*                                       END OF FILE
+==================================================================================================*/
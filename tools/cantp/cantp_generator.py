@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+"""
+CanTp generator - ARXML transport protocol configuration to the CanTp configuration (can_tp_cfg.h / .c)
+
+Reads the ISO 15765-2 connections of the VCU (CanTp CanTpGeneral,
+CanTpRxNSdu, CanTpTxNSdu with their N-PDUs), the CanIf PDUs carrying the
+N-PDUs (CanIfRxPduCfg / CanIfTxPduCfg with user CAN_TP), the PduR routing
+paths of the N-SDUs and the PDUs they refer to (EcuC EcucPduCollection)
+from one or more ARXML files and emits the static configuration consumed
+by src/bsw/com/can_tp.c:
+
+- RX N-SDU table: one entry per CanTpRxNSdu, indexed by its CanTpRxNSduId,
+  with the PduR source handle, the CanIf PDU of its flow control frames,
+  BS, STmin, WFTmax and the N_Ar / N_Br / N_Cr timeouts
+- TX N-SDU table: one entry per CanTpTxNSdu, indexed by its CanTpTxNSduId
+  (the handle the PduR transmits with), with the PduR destination handle,
+  the CanIf PDU and frame length (TX_DL) of its N-PDU and the N_As / N_Bs
+  / N_Cs timeouts
+- RX N-PDU table, indexed by CanTpRxNPduId / CanTpRxFcNPduId (the handle
+  CanIf indicates with): the RX N-SDU of the data frames and the TX N-SDU
+  of the flow control frames received with the CAN identifier. A physical
+  request and the flow control for the response share one CAN identifier,
+  so the two N-PDUs refer to one EcuC PDU and have the same handle
+- TX N-PDU table, indexed by CanTpTxNPduConfirmationPduId /
+  CanTpTxFcNPduConfirmationPduId (the handle CanIf confirms with): the
+  N-SDU that sent the frame
+
+Checks: dense handles, one CanTpGeneral, every N-SDU routed by exactly one
+PduR routing path, every N-PDU carried by a CanIf PDU of user CAN_TP,
+TX_DL of 8, 12, 16, 20, 24, 32, 48 or 64 bytes, STmin encodable in the
+flow control frame (0..127 ms, 100..900 us), no flow control for
+functional N-SDUs, BS and WFTmax of at most 255.
+
+Usage:
+    python3 tools/cantp/cantp_generator.py config/autosar/communication/pdu_router.arxml -o src/bsw/com
+    python3 tools/cantp/cantp_generator.py ... -o src/bsw/com --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, last_name,
+    one_ref, parameters, sub_containers)
+
+GENERATOR_VERSION = "1.0.0"
+
+#: CAN-FD frame lengths (DLC 8..15 above 8 bytes)
+CAN_DL = (8, 12, 16, 20, 24, 32, 48, 64)
+#: Timeouts above this do not fit uint32 timestamp ticks at 240 MHz (OS_PORT_CORE_CLOCK_HZ)
+MAX_TIMEOUT = 17.0
+MAX_HANDLE = 0xFFFE
+
+
+# ------------------------------------------------------------------------------------------------
+# ARXML access
+# ------------------------------------------------------------------------------------------------
+
+def _one_sub(container, definition, what, optional=False):
+    subs = sub_containers(container, definition)
+    if len(subs) > 1 or (not subs and not optional):
+        raise GeneratorError("%s: %s one %s required" % (what, "at most" if optional else "exactly", definition))
+    return subs[0] if subs else None
+
+
+def _timeout_us(params, name, what):
+    value = float(params[name])
+    if not 0.0 < value <= MAX_TIMEOUT:
+        raise GeneratorError("%s: %s must be above 0 and at most %g s" % (what, name, MAX_TIMEOUT))
+    return int(round(value * 1e6))
+
+
+def _stmin(value, what):
+    """STmin in seconds to its flow control encoding (ISO 15765-2 table 20)"""
+    us = int(round(float(value) * 1e6))
+    if us % 1000 == 0 and 0 <= us <= 127000:
+        return us // 1000
+    if us % 100 == 0 and 100 <= us <= 900:
+        return 0xF0 + us // 100
+    raise GeneratorError("%s: CanTpSTmin %s s is not encodable (0..127 ms, 100..900 us)" % (what, value))
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class RxNSdu:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.functional = False
+        self.padding = False
+        self.timeouts_us = (0, 0, 0)
+        self.bs = 0
+        self.stmin = 0
+        self.wft_max = 0
+        self.pdur = None
+        self.npdu = None
+        self.fc_canif = None
+
+
+class TxNSdu:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.padding = False
+        self.timeouts_us = (0, 0, 0)
+        self.pdur = None
+        self.npdu = None
+        self.canif = None
+        self.tx_dl = 0
+        self.fc_npdu = None
+
+
+class RxNPdu:
+    def __init__(self, name, handle, pdu):
+        self.name = name
+        self.handle = handle
+        self.pdu = pdu
+        self.rx_nsdu = None
+        self.tx_nsdu = None
+
+
+class TxNPdu:
+    def __init__(self, name, handle, pdu, nsdu, flow_control):
+        self.name = name
+        self.handle = handle
+        self.pdu = pdu
+        self.nsdu = nsdu
+        self.flow_control = flow_control
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.padding_byte = 0
+        self.rx = []
+        self.tx = []
+        self.rx_npdus = []
+        self.tx_npdus = []
+
+    def build(self):
+        general = list(self.x.containers("CanTpGeneral"))
+        if len(general) != 1:
+            raise GeneratorError("exactly one CanTpGeneral required")
+        self.padding_byte = int(parameters(general[0]).get("CanTpPaddingByte", "0"), 0)
+        if not 0 <= self.padding_byte <= 0xFF:
+            raise GeneratorError("CanTpPaddingByte must be 0..255")
+
+        self.pdur_src, self.pdur_dest = {}, {}
+        for elem in self.x.containers("PduRSrcPdu"):
+            self.pdur_src.setdefault(one_ref(elem, "PduRSrcPduRef", child_text(elem, "SHORT-NAME")), []).append(
+                child_text(elem, "SHORT-NAME"))
+        for elem in self.x.containers("PduRDestPdu"):
+            self.pdur_dest.setdefault(one_ref(elem, "PduRDestPduRef", child_text(elem, "SHORT-NAME")), []).append(
+                child_text(elem, "SHORT-NAME"))
+        self.canif_rx, self.canif_tx = {}, {}
+        for definition, ref_name, handle, user, table in (
+                ("CanIfRxPduCfg", "CanIfRxPduRef", "CanIfRxPduId", "CanIfRxPduUserRxIndicationUL", self.canif_rx),
+                ("CanIfTxPduCfg", "CanIfTxPduRef", "CanIfTxPduId", "CanIfTxPduUserTxConfirmationUL", self.canif_tx)):
+            for elem in self.x.containers(definition):
+                p = parameters(elem)
+                if p.get(user) == "CAN_TP":
+                    table[one_ref(elem, ref_name, child_text(elem, "SHORT-NAME"))] = int(p[handle], 0)
+
+        rx_npdus, tx_npdus = {}, []
+        rx = [self.rx_nsdu(elem, rx_npdus, tx_npdus) for elem in self.x.containers("CanTpRxNSdu")]
+        tx = [self.tx_nsdu(elem, rx_npdus, tx_npdus) for elem in self.x.containers("CanTpTxNSdu")]
+        self.rx = dense(rx, "CanTpRxNSduId", MAX_HANDLE)
+        self.tx = dense(tx, "CanTpTxNSduId", MAX_HANDLE)
+        self.rx_npdus = dense(list(rx_npdus.values()), "CanTpRxNPduId / CanTpRxFcNPduId", MAX_HANDLE)
+        self.tx_npdus = dense(tx_npdus, "CanTpTxNPduConfirmationPduId / CanTpTxFcNPduConfirmationPduId",
+                              MAX_HANDLE)
+        if len(set(n.pdu for n in self.rx_npdus)) != len(self.rx_npdus):
+            raise GeneratorError("an EcuC PDU is received with several CanTp N-PDU handles")
+        if len(set(n.pdu for n in self.tx_npdus)) != len(self.tx_npdus):
+            raise GeneratorError("an EcuC PDU is transmitted by several CanTp N-PDUs")
+
+    def pdur_handle(self, table, pdu, what, kind):
+        names = table.get(pdu, [])
+        if len(names) != 1:
+            raise GeneratorError("%s: N-SDU %s must be the %s of exactly one PduR routing path" % (what, pdu, kind))
+        return names[0]
+
+    def canif(self, table, pdu, what):
+        if pdu not in table:
+            raise GeneratorError("%s: N-PDU %s is not a CanIf PDU of user CAN_TP" % (what, pdu))
+        return table[pdu]
+
+    def rx_npdu(self, table, container, handle_name, ref_name, what):
+        handle = int(parameters(container)[handle_name], 0)
+        pdu = one_ref(container, ref_name, what)
+        self.canif(self.canif_rx, pdu, what)
+        npdu = table.setdefault(handle, RxNPdu(last_name(pdu), handle, pdu))
+        if npdu.pdu != pdu:
+            raise GeneratorError("%s: N-PDU handle %d refers to %s and %s" % (what, handle, npdu.pdu, pdu))
+        return npdu
+
+    def rx_nsdu(self, elem, rx_npdus, tx_npdus):
+        name = child_text(elem, "SHORT-NAME")
+        p = parameters(elem)
+        nsdu = RxNSdu(name, int(p["CanTpRxNSduId"], 0))
+        if p.get("CanTpRxAddressingFormat", "CANTP_STANDARD") != "CANTP_STANDARD":
+            raise GeneratorError("%s: only CANTP_STANDARD addressing is supported" % name)
+        nsdu.functional = p.get("CanTpRxTaType", "CANTP_PHYSICAL") == "CANTP_FUNCTIONAL"
+        nsdu.padding = p.get("CanTpRxPaddingActivation", "CANTP_OFF") == "CANTP_ON"
+        nsdu.timeouts_us = tuple(_timeout_us(p, t, name) for t in ("CanTpNar", "CanTpNbr", "CanTpNcr"))
+        nsdu.pdur = self.pdur_handle(self.pdur_src, one_ref(elem, "CanTpRxNSduRef", name), name, "source")
+
+        nsdu.npdu = self.rx_npdu(rx_npdus, _one_sub(elem, "CanTpRxNPdu", name), "CanTpRxNPduId", "CanTpRxNPduRef",
+                                 name)
+        if nsdu.npdu.rx_nsdu is not None:
+            raise GeneratorError("%s: N-PDU %s already carries %s" % (name, nsdu.npdu.name, nsdu.npdu.rx_nsdu.name))
+        nsdu.npdu.rx_nsdu = nsdu
+
+        fc = _one_sub(elem, "CanTpTxFcNPdu", name, optional=True)
+        if nsdu.functional:
+            if fc is not None:
+                raise GeneratorError("%s: a functional N-SDU has no flow control N-PDU" % name)
+            return nsdu
+        if fc is None:
+            raise GeneratorError("%s: a physical N-SDU needs a CanTpTxFcNPdu" % name)
+        nsdu.bs = int(p.get("CanTpBs", "0"), 0)
+        nsdu.wft_max = int(p.get("CanTpRxWftMax", "0"), 0)
+        if not 0 <= nsdu.bs <= 0xFF or not 0 <= nsdu.wft_max <= 0xFF:
+            raise GeneratorError("%s: CanTpBs and CanTpRxWftMax must be 0..255" % name)
+        nsdu.stmin = _stmin(p.get("CanTpSTmin", "0"), name)
+        pdu = one_ref(fc, "CanTpTxFcNPduRef", name)
+        nsdu.fc_canif = self.canif(self.canif_tx, pdu, name)
+        tx_npdus.append(TxNPdu(last_name(pdu), int(parameters(fc)["CanTpTxFcNPduConfirmationPduId"], 0),
+                               pdu, nsdu, True))
+        return nsdu
+
+    def tx_nsdu(self, elem, rx_npdus, tx_npdus):
+        name = child_text(elem, "SHORT-NAME")
+        p = parameters(elem)
+        nsdu = TxNSdu(name, int(p["CanTpTxNSduId"], 0))
+        if p.get("CanTpTxAddressingFormat", "CANTP_STANDARD") != "CANTP_STANDARD":
+            raise GeneratorError("%s: only CANTP_STANDARD addressing is supported" % name)
+        if p.get("CanTpTxTaType", "CANTP_PHYSICAL") != "CANTP_PHYSICAL":
+            raise GeneratorError("%s: only CANTP_PHYSICAL transmission is supported" % name)
+        nsdu.padding = p.get("CanTpTxPaddingActivation", "CANTP_OFF") == "CANTP_ON"
+        nsdu.timeouts_us = tuple(_timeout_us(p, t, name) for t in ("CanTpNas", "CanTpNbs", "CanTpNcs"))
+        nsdu.pdur = self.pdur_handle(self.pdur_dest, one_ref(elem, "CanTpTxNSduRef", name), name, "destination")
+
+        npdu = _one_sub(elem, "CanTpTxNPdu", name)
+        pdu = one_ref(npdu, "CanTpTxNPduRef", name)
+        nsdu.canif = self.canif(self.canif_tx, pdu, name)
+        nsdu.tx_dl = int(parameters(self.x.resolve(pdu))["PduLength"])
+        if nsdu.tx_dl not in CAN_DL:
+            raise GeneratorError("%s: PduLength %d of %s is not a CAN-FD frame length %s" %
+                                 (name, nsdu.tx_dl, last_name(pdu), "/".join(str(n) for n in CAN_DL)))
+        nsdu.npdu = TxNPdu(last_name(pdu), int(parameters(npdu)["CanTpTxNPduConfirmationPduId"], 0), pdu, nsdu, False)
+        tx_npdus.append(nsdu.npdu)
+
+        nsdu.fc_npdu = self.rx_npdu(rx_npdus, _one_sub(elem, "CanTpRxFcNPdu", name), "CanTpRxFcNPduId",
+                                    "CanTpRxFcNPduRef", name)
+        if nsdu.fc_npdu.tx_nsdu is not None:
+            raise GeneratorError("%s: N-PDU %s already carries the flow control of %s" %
+                                 (name, nsdu.fc_npdu.name, nsdu.fc_npdu.tx_nsdu.name))
+        nsdu.fc_npdu.tx_nsdu = nsdu
+        return nsdu
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+def stmin_text(stmin):
+    return "%d ms" % stmin if stmin <= 0x7F else "%d us" % ((stmin - 0xF0) * 100)
+
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_connections(self):
+        rows = ["| N-SDU                | TA         | N-PDU            | Flow control     | TX_DL | BS | STmin  |",
+                "|----------------------|------------|------------------|------------------|-------|----|--------|"]
+        for n in self.m.rx:
+            rows.append("| %-20s | %-10s | %-16s | %-16s | %-5s | %-2s | %-6s |" %
+                        (n.name, "functional" if n.functional else "physical", n.npdu.name,
+                         "-" if n.functional else [t.name for t in self.m.tx_npdus if t.nsdu is n][0],
+                         "-", "-" if n.functional else str(n.bs), "-" if n.functional else stmin_text(n.stmin)))
+        for n in self.m.tx:
+            rows.append("| %-20s | %-10s | %-16s | %-16s | %-5d | %-2s | %-6s |" %
+                        (n.name, "physical", n.npdu.name, n.fc_npdu.name, n.tx_dl, "-", "-"))
+        return rows
+
+    # -- can_tp_cfg.h ----------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Handles of the ISO 15765-2 connections of the VCU (padding byte 0x%02X):" % m.padding_byte, ""]
+        details += self.doc_connections()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "can_tp_cfg.h",
+                              "CanTp Configuration - N-SDU and N-PDU Handles", details),
+               "#ifndef CAN_TP_CFG_H",
+               "#define CAN_TP_CFG_H",
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("CANTP_RX_NSDU_COUNT", "%dU" % len(m.rx)),
+               define("CANTP_TX_NSDU_COUNT", "%dU" % len(m.tx)),
+               define("CANTP_RX_NPDU_COUNT", "%dU" % len(m.rx_npdus)),
+               define("CANTP_TX_NPDU_COUNT", "%dU" % len(m.tx_npdus)),
+               "",
+               define("CANTP_PADDING_BYTE", "0x%02XU" % m.padding_byte),
+               "",
+               banner("h", "RX N-SDU HANDLES")]
+        for n in m.rx:
+            out.append(define("CanTpConf_CanTpRxNSdu_%s" % n.name, "%dU" % n.handle))
+        out += ["", banner("h", "TX N-SDU HANDLES (CanTp_Transmit)")]
+        for n in m.tx:
+            out.append(define("CanTpConf_CanTpTxNSdu_%s" % n.name, "%dU" % n.handle))
+        out += ["", banner("h", "RX N-PDU HANDLES (CanTp_RxIndication)")]
+        for n in m.rx_npdus:
+            out.append(define("CanTpConf_CanTpRxNPdu_%s" % n.name, "%dU" % n.handle))
+        out += ["", banner("h", "TX N-PDU HANDLES (CanTp_TxConfirmation)")]
+        for n in m.tx_npdus:
+            out.append(define("CanTpConf_CanTpTxNPdu_%s" % n.name, "%dU" % n.handle))
+        out += ["",
+                "#endif /* CAN_TP_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- can_tp_cfg.c ----------------------------------------------------------------------------
+
+    @staticmethod
+    def ticks(timeouts_us):
+        return ", ".join("CANTP_US_TO_TICKS(%dUL)" % us for us in timeouts_us)
+
+    @staticmethod
+    def rows(items, fields):
+        out = []
+        for item in items:
+            out += ["    {   /* %s */" % item.name,
+                    "        %s," % Emitter.ticks(item.timeouts_us),
+                    "        %s" % ", ".join(fields(item)),
+                    "    }" if item is items[-1] else "    },"]
+        return out
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "can_tp_cfg.c",
+                              "CanTp Configuration - N-SDU and N-PDU Tables",
+                              ["Static CanTp configuration of the VCU: RX and TX N-SDUs and the N-PDUs",
+                               "CanIf indicates and confirms them with."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "can_tp.h"',
+               '#include "pdu_router.h"',
+               "",
+               banner("c", "GLOBAL CONSTANTS"),
+               "const CanTp_RxNSduConfigType CanTp_RxNSdu[CANTP_RX_NSDU_COUNT] =",
+               "{"]
+        out += self.rows(m.rx, lambda n: [
+            "PduRConf_PduRSrcPdu_%s" % n.pdur,
+            "CANTP_NO_PDU" if n.functional else "%dU" % n.fc_canif,
+            "%dU" % n.bs, "0x%02XU" % n.stmin, "%dU" % n.wft_max,
+            "TRUE" if n.padding else "FALSE", "TRUE" if n.functional else "FALSE"])
+        out += ["};", "",
+                "const CanTp_TxNSduConfigType CanTp_TxNSdu[CANTP_TX_NSDU_COUNT] =",
+                "{"]
+        out += self.rows(m.tx, lambda n: [
+            "PduRConf_PduRDestPdu_%s" % n.pdur, "%dU" % n.canif, "%dU" % n.tx_dl,
+            "TRUE" if n.padding else "FALSE"])
+        out += ["};", ""]
+
+        nsdu_width = len("CanTpConf_CanTpRxNSdu_,") + max(len(n.name) for n in m.rx + m.tx)
+        out += ["const CanTp_RxNPduConfigType CanTp_RxNPdu[CANTP_RX_NPDU_COUNT] =", "{"]
+        rows = []
+        for n in m.rx_npdus:
+            rows.append("    { %s %s }   /* %s */" %
+                        (("CanTpConf_CanTpRxNSdu_%s," % n.rx_nsdu.name if n.rx_nsdu else "CANTP_NO_NSDU,").ljust(
+                            nsdu_width),
+                         ("CanTpConf_CanTpTxNSdu_%s" % n.tx_nsdu.name if n.tx_nsdu else "CANTP_NO_NSDU").ljust(
+                            nsdu_width - 1), n.name))
+        out += [join_rows(rows), "};", ""]
+
+        out += ["const CanTp_TxNPduConfigType CanTp_TxNPdu[CANTP_TX_NPDU_COUNT] =", "{"]
+        rows = []
+        for n in m.tx_npdus:
+            rows.append("    { %s %s }   /* %s */" %
+                        (("CanTpConf_CanTp%sNSdu_%s," % ("Rx" if n.flow_control else "Tx", n.nsdu.name)).ljust(
+                            nsdu_width), "TRUE " if n.flow_control else "FALSE", n.name))
+        out += [join_rows(rows), "};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/bsw/com", help="output directory of can_tp_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"can_tp_cfg.h": emitter.emit_header(), "can_tp_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("cantp_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("cantp_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
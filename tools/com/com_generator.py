@@ -0,0 +1,748 @@
+#!/usr/bin/env python3
+"""
+COM generator - ARXML COM configuration to the COM configuration (com_cfg.h / com_cfg.c)
+
+Reads the I-PDUs (EcuC EcucPduCollection, Com ComIPdu) and signals (Com
+ComSignal) from one or more ARXML files and emits the static configuration
+consumed by src/bsw/com/com_stack.c:
+
+- Handles: ComConf_ComIPdu_<name> and ComConf_ComSignal_<name> in the order
+  of ComIPduHandleId / ComHandleId, which must be dense from 0
+- Shadows: one structure per I-PDU holding its signals as the C type of
+  ComSignalType (members ordered by decreasing alignment), the init values
+  of ComSignalInitValue, and the PDU buffer padded to a multiple of 8 bytes
+- Kernels: one pack function per SEND I-PDU and one unpack function per
+  RECEIVE I-PDU, working on the aligned 32-bit words of the PDU buffer. A
+  word is loaded once (com_pack.h: LDR, plus REV for BIG_ENDIAN), every
+  signal part in it is moved with a constant shift and mask, and the word
+  is stored once. A signal crossing a word boundary is split into one part
+  per word. A pack kernel does not load a word whose bits are all covered
+  by its signals
+- Layout table (COM_SIGNAL_LAYOUT_TABLE): ComBitPosition / ComBitSize /
+  byte order of every signal, for tools and benchmarks only
+- Deadline monitoring: ComTimeout / ComFirstTimeout of the RECEIVE I-PDUs
+  (sub-container ComRxIPdu) in Com_MainFunctionRx() cycles of
+  ComMainFunctionRx/ComMainFunctionPeriod, rounded up, and the
+  ComRxDataTimeoutAction of the I-PDU
+- Transmission modes: ComTxModeTrue/ComTxMode of the SEND I-PDUs (PERIODIC,
+  DIRECT or MIXED), ComTxModeTimePeriod / ComTxModeTimeOffset and
+  ComMinimumDelayTime in Com_MainFunctionTx() cycles of
+  ComMainFunctionTx/ComMainFunctionPeriod, the ComTransferProperty of every
+  signal, and the PduR source handle of the I-PDU (the PduRSrcPdu
+  referencing its EcuC PDU, so the PduR ARXML is an input too). A periodic
+  I-PDU without ComTxModeTimeOffset gets the offset that keeps the peak
+  periodic load of a cycle lowest: I-PDUs are placed by increasing period
+  and decreasing length, each on the offset minimizing the largest byte
+  count of the cycles it lands in over the hyperperiod
+
+Bit numbering is the AUTOSAR one for both byte orders: bit i of byte b is
+8 * b + i, and ComBitPosition is the least significant bit of the signal.
+A BIG_ENDIAN signal continues from bit 7 of byte b at bit 0 of byte b - 1.
+
+Checks: signals inside their PDU, no two signals of a PDU sharing a bit,
+ComBitSize within the width of ComSignalType, each signal in one I-PDU,
+deadlines only on RECEIVE I-PDUs and within MAX_TIMEOUT_CYCLES, transmission
+modes only on SEND I-PDUs, periods multiple of the Com_MainFunctionTx()
+period, offsets below the period, no ComTxModeNumberOfRepetitions (not
+supported) and no ComTxModeFalse (no transmission mode selector).
+
+Usage:
+    python3 tools/com/com_generator.py config/autosar/communication/com.arxml \\
+        config/autosar/communication/pdu_router.arxml -o src/bsw/com
+    python3 tools/com/com_generator.py config/autosar/communication/com.arxml \\
+        config/autosar/communication/pdu_router.arxml -o src/bsw/com --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+from math import gcd
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, parameters,
+    references, sub_containers)
+
+GENERATOR_VERSION = "1.3.0"
+
+#: ComSignalType -> (C type, size in bytes, signed)
+SIGNAL_TYPES = {
+    "BOOLEAN": ("boolean", 1, False),
+    "UINT8": ("uint8", 1, False),
+    "UINT16": ("uint16", 2, False),
+    "UINT32": ("uint32", 4, False),
+    "UINT64": ("uint64", 8, False),
+    "SINT8": ("sint8", 1, True),
+    "SINT16": ("sint16", 2, True),
+    "SINT32": ("sint32", 4, True),
+    "SINT64": ("sint64", 8, True),
+}
+
+#: PDU buffers are padded to and aligned on a multiple of this size
+PDU_ALIGN = 8
+
+#: Kernel word size in bytes
+WORD_BYTES = 4
+
+#: Largest deadline in Com_MainFunctionRx() cycles (Com_IPduConfigType::timeout is uint16)
+MAX_TIMEOUT_CYCLES = 0xFFFF
+
+#: ComRxDataTimeoutAction -> Com_RxDataTimeoutActionType
+TIMEOUT_ACTIONS = {"NONE": "COM_TIMEOUT_NONE", "REPLACE": "COM_TIMEOUT_REPLACE"}
+
+#: ComTxModeMode -> Com_TxModeType
+TX_MODES = {"NONE": "COM_TX_NONE", "PERIODIC": "COM_TX_PERIODIC", "DIRECT": "COM_TX_DIRECT",
+            "MIXED": "COM_TX_MIXED"}
+
+#: ComTransferProperty -> Com_TransferPropertyType (repetitions are not supported, so the
+#: *_WITHOUT_REPETITION variants are the same)
+TRANSFER_PROPERTIES = {"PENDING": "COM_PENDING", "TRIGGERED": "COM_TRIGGERED",
+                       "TRIGGERED_WITHOUT_REPETITION": "COM_TRIGGERED",
+                       "TRIGGERED_ON_CHANGE": "COM_TRIGGERED_ON_CHANGE",
+                       "TRIGGERED_ON_CHANGE_WITHOUT_REPETITION": "COM_TRIGGERED_ON_CHANGE"}
+
+#: Largest hyperperiod of the periodic I-PDUs, in Com_MainFunctionTx() cycles, for which
+#: offsets are spread automatically
+MAX_HYPERPERIOD = 0x10000
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class Signal:
+    def __init__(self, name, handle, position, size, big_endian, sig_type, init, transfer):
+        self.name = name
+        self.handle = handle
+        self.position = position
+        self.size = size
+        self.big_endian = big_endian
+        self.ctype, self.bytes, self.signed = SIGNAL_TYPES[sig_type]
+        self.init = init
+        self.transfer = transfer
+        self.ipdu = None
+        if size < 1 or size > 8 * self.bytes or (sig_type == "BOOLEAN" and size != 1):
+            raise GeneratorError("signal %s: ComBitSize %d does not fit %s" % (name, size, sig_type))
+
+    def bits(self):
+        """Absolute PDU bit numbers (8 * byte + bit), least significant first"""
+        if not self.big_endian:
+            return [self.position + k for k in range(self.size)]
+        byte, bit = divmod(self.position, 8)
+        return [8 * (byte - (bit + k) // 8) + (bit + k) % 8 for k in range(self.size)]
+
+    def pieces(self):
+        """Parts of the signal per aligned 32-bit PDU word: [(word, word shift, value shift, bits)]
+
+        In a word loaded in the byte order of the signal, the bits of the
+        signal are contiguous until they reach the next word; Intel signals
+        continue at bit 0 of the word after, Motorola ones at bit 0 of the
+        word before.
+        """
+        result = []
+        for k, bit in enumerate(self.bits()):
+            byte, i = divmod(bit, 8)
+            word, lane = divmod(byte, WORD_BYTES)
+            shift = 8 * ((WORD_BYTES - 1 - lane) if self.big_endian else lane) + i
+            if result and result[-1][0] == word and result[-1][1] + result[-1][3] == shift:
+                result[-1] = (word, result[-1][1], result[-1][2], result[-1][3] + 1)
+            else:
+                result.append((word, shift, k, 1))
+        return result
+
+
+class Word:
+    """Aligned 32-bit word of a PDU in one byte order, with the signal parts it holds"""
+
+    def __init__(self, index, big_endian):
+        self.index = index
+        self.big_endian = big_endian
+        self.parts = []                 # (signal, word shift, value shift, bits)
+
+    def used_mask(self):
+        mask = 0
+        for _, shift, _, bits in self.parts:
+            mask |= ((1 << bits) - 1) << shift
+        return mask
+
+    @property
+    def offset(self):
+        return WORD_BYTES * self.index
+
+    @property
+    def access(self):
+        return "Be32" if self.big_endian else "Le32"
+
+    @property
+    def var(self):
+        return "%s%d" % ("be" if self.big_endian else "le", self.index)
+
+
+class IPdu:
+    def __init__(self, name, handle, length, send, deferred, unused):
+        self.name = name
+        self.handle = handle
+        self.length = length
+        self.send = send
+        self.deferred = deferred
+        self.unused = unused
+        self.signals = []
+        self.words = []
+        self.timeout = 0                # Com_MainFunctionRx() cycles, 0 = not monitored
+        self.first_timeout = 0
+        self.timeout_action = "NONE"
+        self.tx_mode = "NONE"
+        self.tx_period = 0              # Com_MainFunctionTx() cycles, 0 = not periodic
+        self.tx_offset = None           # None = spread by the generator
+        self.tx_mdt = 0
+        self.pdur_pdu = None            # PduRSourcePduHandleId, for a transmission mode only
+
+    @property
+    def buffer_size(self):
+        return max(PDU_ALIGN, (self.length + PDU_ALIGN - 1) // PDU_ALIGN * PDU_ALIGN)
+
+    def shadow_members(self):
+        """Signals in shadow order: decreasing alignment, then handle"""
+        return sorted(self.signals, key=lambda s: (-s.bytes, s.handle))
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.ipdus = []
+        self.signals = []
+        self.rx_period_us = 0
+        self.tx_period_us = 0
+        self.peak_load = (0, 0)         # Bytes of the busiest cycle: (spread offsets, all offsets 0)
+
+    @staticmethod
+    def cycles(value, what, period_us, main="Com_MainFunctionRx", zero=False, exact=False):
+        """Time in seconds to main function cycles, rounded up"""
+        us = int(round(float(value) * 1e6))
+        if us < 0 or (us == 0 and not zero):
+            raise GeneratorError("%s must be above 0" % what)
+        if exact and us % period_us:
+            raise GeneratorError("%s must be a multiple of the %s() period" % (what, main))
+        cycles = (us + period_us - 1) // period_us
+        if cycles > MAX_TIMEOUT_CYCLES:
+            raise GeneratorError("%s exceeds %d %s() cycles" % (what, MAX_TIMEOUT_CYCLES, main))
+        return cycles
+
+    def main_period(self, name):
+        """ComMainFunctionPeriod of the ComMainFunctionRx / ComMainFunctionTx container in us, 0 if none"""
+        mains = list(self.x.containers(name))
+        if len(mains) > 1:
+            raise GeneratorError("at most one %s supported" % name)
+        if not mains:
+            return 0
+        period_us = int(round(float(parameters(mains[0])["ComMainFunctionPeriod"]) * 1e6))
+        if period_us <= 0:
+            raise GeneratorError("%s: ComMainFunctionPeriod must be above 0" % name)
+        return period_us
+
+    def build(self):
+        self.rx_period_us = self.main_period("ComMainFunctionRx")
+        self.tx_period_us = self.main_period("ComMainFunctionTx")
+
+        signals = {}
+        for elem in self.x.containers("ComSignal"):
+            p = parameters(elem)
+            endianness = p.get("ComSignalEndianness", "LITTLE_ENDIAN")
+            if endianness not in ("BIG_ENDIAN", "LITTLE_ENDIAN"):
+                raise GeneratorError("signal %s: unsupported ComSignalEndianness %s" %
+                                     (child_text(elem, "SHORT-NAME"), endianness))
+            sig_type = p.get("ComSignalType", "")
+            if sig_type not in SIGNAL_TYPES:
+                raise GeneratorError("signal %s: unsupported ComSignalType %s" %
+                                     (child_text(elem, "SHORT-NAME"), sig_type))
+            transfer = p.get("ComTransferProperty", "PENDING")
+            if transfer not in TRANSFER_PROPERTIES:
+                raise GeneratorError("signal %s: unsupported ComTransferProperty %s" %
+                                     (child_text(elem, "SHORT-NAME"), transfer))
+            sig = Signal(child_text(elem, "SHORT-NAME"), int(p["ComHandleId"]), int(p["ComBitPosition"]),
+                         int(p["ComBitSize"]), endianness == "BIG_ENDIAN", sig_type,
+                         int(p.get("ComSignalInitValue", "0"), 0), TRANSFER_PROPERTIES[transfer])
+            signals[self.x.path_of[elem]] = sig
+        self.signals = dense(signals.values(), "ComSignal")
+
+        ipdus = []
+        for elem in self.x.containers("ComIPdu"):
+            p = parameters(elem)
+            name = child_text(elem, "SHORT-NAME")
+            pdu_refs = references(elem, "ComPduIdRef")
+            if len(pdu_refs) != 1:
+                raise GeneratorError("I-PDU %s: exactly one ComPduIdRef required" % name)
+            length = int(parameters(self.x.resolve(pdu_refs[0]))["PduLength"])
+            send = p.get("ComIPduDirection") == "SEND"
+            unused = 0
+            for tx in sub_containers(elem, "ComTxIPdu"):
+                unused = int(parameters(tx).get("ComTxIPduUnusedAreasDefault", "0"))
+            ipdu = IPdu(name, int(p["ComIPduHandleId"]), length, send,
+                        p.get("ComIPduSignalProcessing", "IMMEDIATE") == "DEFERRED", unused)
+            for tx in sub_containers(elem, "ComTxIPdu"):
+                self.tx_mode(ipdu, tx, pdu_refs[0])
+            for rx in sub_containers(elem, "ComRxIPdu"):
+                self.rx_deadline(ipdu, parameters(rx))
+            for ref in references(elem, "ComIPduSignalRef"):
+                if ref not in signals:
+                    raise GeneratorError("I-PDU %s: %s is not a ComSignal" % (name, ref))
+                sig = signals[ref]
+                if sig.ipdu is not None:
+                    raise GeneratorError("signal %s is mapped to %s and %s" % (sig.name, sig.ipdu.name, name))
+                sig.ipdu = ipdu
+                ipdu.signals.append(sig)
+            ipdus.append(ipdu)
+        self.ipdus = dense(ipdus, "ComIPdu")
+
+        for sig in self.signals:
+            if sig.ipdu is None:
+                raise GeneratorError("signal %s is not mapped to an I-PDU" % sig.name)
+        for ipdu in self.ipdus:
+            self.check_layout(ipdu)
+            ipdu.words = self.words(ipdu)
+        self.spread_offsets()
+
+    def rx_deadline(self, ipdu, p):
+        if ipdu.send:
+            raise GeneratorError("I-PDU %s: ComRxIPdu on a SEND I-PDU" % ipdu.name)
+        if "ComTimeout" not in p:
+            return
+        if not self.rx_period_us:
+            raise GeneratorError("I-PDU %s: ComTimeout requires ComMainFunctionRx/ComMainFunctionPeriod" % ipdu.name)
+        action = p.get("ComRxDataTimeoutAction", "NONE")
+        if action not in TIMEOUT_ACTIONS:
+            raise GeneratorError("I-PDU %s: unsupported ComRxDataTimeoutAction %s" % (ipdu.name, action))
+        ipdu.timeout = self.cycles(p["ComTimeout"], "I-PDU %s: ComTimeout" % ipdu.name, self.rx_period_us)
+        ipdu.first_timeout = self.cycles(p.get("ComFirstTimeout", p["ComTimeout"]),
+                                         "I-PDU %s: ComFirstTimeout" % ipdu.name, self.rx_period_us)
+        ipdu.timeout_action = action
+
+    def tx_mode(self, ipdu, tx, pdu_ref):
+        if not ipdu.send:
+            raise GeneratorError("I-PDU %s: ComTxIPdu on a RECEIVE I-PDU" % ipdu.name)
+        if sub_containers(tx, "ComTxModeFalse"):
+            raise GeneratorError("I-PDU %s: ComTxModeFalse not supported (no transmission mode selector)" %
+                                 ipdu.name)
+        modes = [m for true in sub_containers(tx, "ComTxModeTrue") for m in sub_containers(true, "ComTxMode")]
+        if not modes:
+            return
+        if len(modes) > 1:
+            raise GeneratorError("I-PDU %s: at most one ComTxModeTrue/ComTxMode supported" % ipdu.name)
+        p = parameters(modes[0])
+        mode = p.get("ComTxModeMode", "NONE")
+        if mode not in TX_MODES:
+            raise GeneratorError("I-PDU %s: unsupported ComTxModeMode %s" % (ipdu.name, mode))
+        if int(p.get("ComTxModeNumberOfRepetitions", "0")) != 0:
+            raise GeneratorError("I-PDU %s: ComTxModeNumberOfRepetitions not supported" % ipdu.name)
+        ipdu.tx_mode = mode
+        if mode == "NONE":
+            return
+        if not self.tx_period_us:
+            raise GeneratorError("I-PDU %s: ComTxModeMode %s requires ComMainFunctionTx/ComMainFunctionPeriod" %
+                                 (ipdu.name, mode))
+        what = "I-PDU %s: " % ipdu.name
+        if mode in ("PERIODIC", "MIXED"):
+            if "ComTxModeTimePeriod" not in p:
+                raise GeneratorError(what + "ComTxModeMode %s requires ComTxModeTimePeriod" % mode)
+            ipdu.tx_period = self.cycles(p["ComTxModeTimePeriod"], what + "ComTxModeTimePeriod",
+                                         self.tx_period_us, "Com_MainFunctionTx", exact=True)
+            if "ComTxModeTimeOffset" in p:
+                ipdu.tx_offset = self.cycles(p["ComTxModeTimeOffset"], what + "ComTxModeTimeOffset",
+                                             self.tx_period_us, "Com_MainFunctionTx", zero=True, exact=True)
+                if ipdu.tx_offset >= ipdu.tx_period:
+                    raise GeneratorError(what + "ComTxModeTimeOffset must be below ComTxModeTimePeriod")
+        ipdu.tx_mdt = self.cycles(parameters(tx).get("ComMinimumDelayTime", "0"), what + "ComMinimumDelayTime",
+                                  self.tx_period_us, "Com_MainFunctionTx", zero=True)
+        sources = [int(parameters(src)["PduRSourcePduHandleId"]) for src in self.x.containers("PduRSrcPdu")
+                   if references(src, "PduRSrcPduRef") == [pdu_ref]]
+        if len(sources) != 1:
+            raise GeneratorError(what + "transmission mode requires exactly one PduRSrcPdu referencing %s "
+                                 "(pass the PduR ARXML)" % pdu_ref)
+        ipdu.pdur_pdu = sources[0]
+
+    def spread_offsets(self):
+        """Offsets of the periodic I-PDUs without ComTxModeTimeOffset, and the peak load"""
+        periodic = [i for i in self.ipdus if i.tx_period]
+        if not periodic:
+            return
+        hyper = 1
+        for ipdu in periodic:
+            hyper = hyper * ipdu.tx_period // gcd(hyper, ipdu.tx_period)
+        if hyper > MAX_HYPERPERIOD:
+            raise GeneratorError("hyperperiod of the periodic I-PDUs exceeds %d Com_MainFunctionTx() cycles, "
+                                 "set ComTxModeTimeOffset explicitly" % MAX_HYPERPERIOD)
+        load = [0] * hyper
+        unspread = [0] * hyper
+        for ipdu in sorted(periodic, key=lambda i: (i.tx_offset is None, i.tx_period, -i.length, i.handle)):
+            if ipdu.tx_offset is None:
+                ipdu.tx_offset = min(range(ipdu.tx_period),
+                                     key=lambda o: (max(load[c] for c in range(o, hyper, ipdu.tx_period)), o))
+            for c in range(ipdu.tx_offset, hyper, ipdu.tx_period):
+                load[c] += ipdu.length
+            for c in range(0, hyper, ipdu.tx_period):
+                unspread[c] += ipdu.length
+        self.peak_load = (max(load), max(unspread))
+
+    @staticmethod
+    def check_layout(ipdu):
+        owner = {}
+        for sig in ipdu.signals:
+            for bit in sig.bits():
+                if bit < 0 or bit >= 8 * ipdu.length:
+                    raise GeneratorError("signal %s exceeds I-PDU %s (%d bytes)" % (sig.name, ipdu.name, ipdu.length))
+                if bit in owner:
+                    raise GeneratorError("signals %s and %s of %s overlap at bit %d" %
+                                         (owner[bit].name, sig.name, ipdu.name, bit))
+                owner[bit] = sig
+
+    @staticmethod
+    def words(ipdu):
+        """Words of the PDU holding signal bits, by offset and byte order"""
+        words = {}
+        for sig in ipdu.signals:
+            for word, shift, value_shift, bits in sig.pieces():
+                key = (word, not sig.big_endian)
+                if key not in words:
+                    words[key] = Word(word, sig.big_endian)
+                words[key].parts.append((sig, shift, value_shift, bits))
+        return [words[key] for key in sorted(words)]
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+def c_int(value, ctype):
+    if ctype == "boolean":
+        return "TRUE" if value else "FALSE"
+    suffix = {"uint8": "U", "uint16": "U", "uint32": "UL", "uint64": "ULL",
+              "sint8": "", "sint16": "", "sint32": "L", "sint64": "LL"}[ctype]
+    return "%d%s" % (value, suffix)
+
+
+def part_name(sig, value_shift, bits):
+    if bits == sig.size:
+        return sig.name
+    return "%s[%d..%d]" % (sig.name, value_shift, value_shift + bits - 1)
+
+
+def wrap(prefix, items, suffix, indent):
+    """prefix item1, item2 ... suffix, continued on lines starting with indent, at 100 columns"""
+    lines, line = [], prefix
+    for i, item in enumerate(items):
+        text = " " + item + ("," if i < len(items) - 1 else "")
+        if len(line) + len(text) > 100 - len(suffix):
+            lines.append(line)
+            line = indent
+        line += text
+    lines.append(line + suffix)
+    return lines
+
+
+def hex_const(value, bits):
+    return "0x%0*X%s" % (bits // 4, value, "UL" if bits == 32 else "ULL")
+
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def deadline(self, ipdu):
+        if not ipdu.timeout:
+            return "-"
+        return "%g ms %s" % (ipdu.timeout * self.m.rx_period_us / 1000.0, ipdu.timeout_action)
+
+    def doc_ipdus(self):
+        rows = ["| I-PDU                  | Dir  | Length | Signals | Kernel words (32 bit)   | Split signals | Deadline        |",
+                "|------------------------|------|--------|---------|-------------------------|---------------|-----------------|"]
+        for ipdu in self.m.ipdus:
+            counts = []
+            for big_endian, access in ((False, "Le32"), (True, "Be32")):
+                count = len([w for w in ipdu.words if w.big_endian == big_endian])
+                if count:
+                    counts.append("%d x %s" % (count, access))
+            split = len([sig for sig in ipdu.signals if len(sig.pieces()) > 1])
+            rows.append("| %-22s | %-4s | %-6d | %-7d | %-23s | %-13d | %-15s |" %
+                        (ipdu.name, "TX" if ipdu.send else ("RX-D" if ipdu.deferred else "RX"),
+                         ipdu.length, len(ipdu.signals), ", ".join(counts), split, self.deadline(ipdu)))
+        return rows
+
+    def ms(self, cycles):
+        return "%g ms" % (cycles * self.m.tx_period_us / 1000.0)
+
+    def doc_tx_modes(self):
+        rows = ["| I-PDU                  | Mode     | Period   | Offset  | MDT     | Triggering signals |",
+                "|------------------------|----------|----------|---------|---------|--------------------|"]
+        for ipdu in self.m.ipdus:
+            if ipdu.tx_mode == "NONE":
+                continue
+            triggering = len([sig for sig in ipdu.signals if sig.transfer != "COM_PENDING"])
+            rows.append("| %-22s | %-8s | %-8s | %-7s | %-7s | %-18d |" %
+                        (ipdu.name, ipdu.tx_mode, self.ms(ipdu.tx_period) if ipdu.tx_period else "-",
+                         self.ms(ipdu.tx_offset) if ipdu.tx_period else "-",
+                         self.ms(ipdu.tx_mdt) if ipdu.tx_mdt else "-", triggering))
+        return rows
+
+    # -- com_cfg.h -------------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Handles of the I-PDUs and signals of the VCU COM configuration.",
+                   "",
+                   "Generated kernels (TX = pack in Com_TriggerTransmit(), RX = unpack in",
+                   "Com_RxIndication(), RX-D = unpack in Com_MainFunctionRx()) and reception",
+                   "deadlines (ComTimeout, ComRxDataTimeoutAction):"]
+        details += self.doc_ipdus()
+        if len(self.doc_tx_modes()) > 2:
+            details += ["",
+                        "Transmission modes (Com_MainFunctionTx()); the periodic I-PDUs put at",
+                        "most %d bytes in one cycle (%d with all offsets 0):" % m.peak_load]
+            details += self.doc_tx_modes()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "com_cfg.h",
+                              "COM Configuration - I-PDU and Signal Handles", details),
+               "#ifndef COM_CFG_H",
+               "#define COM_CFG_H",
+               "",
+               banner("h", "INCLUDE FILES"),
+               '#include "comstack_types.h"',
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               "#define COM_IPDU_COUNT                          %dU" % len(m.ipdus),
+               "#define COM_SIGNAL_COUNT                        %dU" % len(m.signals),
+               "#define COM_RX_DEADLINE_COUNT                   %dU" % len([i for i in m.ipdus if i.timeout]),
+               "/** @brief Bytes of all SEND I-PDUs, the payload snapshot of one Com_MainFunctionTx() */",
+               "#define COM_TX_BATCH_DATA_SIZE                  %dU" % max(1, sum(i.length for i in m.ipdus if i.send)),
+               "",
+               banner("h", "MAIN FUNCTION PERIODS"),
+               "/** @brief ComMainFunctionRx/ComMainFunctionPeriod in microseconds, the deadline time base */",
+               "#define COM_MAIN_FUNCTION_RX_PERIOD_US          %dUL" % m.rx_period_us,
+               "/** @brief ComMainFunctionTx/ComMainFunctionPeriod in microseconds, the transmission time base */",
+               "#define COM_MAIN_FUNCTION_TX_PERIOD_US          %dUL" % m.tx_period_us,
+               "",
+               banner("h", "I-PDU HANDLES")]
+        for ipdu in m.ipdus:
+            out.append(define("ComConf_ComIPdu_%s" % ipdu.name, "%dU" % ipdu.handle))
+        out += ["", banner("h", "SIGNAL HANDLES")]
+        for sig in m.signals:
+            out.append(define("ComConf_ComSignal_%s" % sig.name, "%dU" % sig.handle))
+        out += ["",
+                "#endif /* COM_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- com_cfg.c -------------------------------------------------------------------------------
+
+    @staticmethod
+    def pack_lines(word):
+        full = 0xFFFFFFFF
+        used = word.used_mask()
+        lines = wrap("    /* %s @ %d:" % (word.access, word.offset),
+                     [part_name(sig, vshift, bits) for sig, _, vshift, bits in word.parts], " */", "     *")
+        terms = []
+        for sig, shift, vshift, bits in word.parts:
+            if vshift == 0:
+                value = "(uint32)s->%s" % sig.name
+            elif sig.bytes == 8:
+                value = "(uint32)(s->%s >> %d)" % (sig.name, vshift)
+            else:
+                value = "((uint32)s->%s >> %d)" % (sig.name, vshift)
+            if shift + bits < 32:
+                value = "(%s & %s)" % (value, hex_const((1 << bits) - 1, 32))
+            terms.append(value if shift == 0 else "%s << %d" % (value, shift))
+        if used == full:
+            lines.append("    w = %s;" % terms[0])
+        else:
+            lines.append("    w = Com_Load%s(&pdu[%d]) & %s;" % (word.access, word.offset, hex_const(full & ~used, 32)))
+            lines.append("    w |= %s;" % terms[0])
+        for term in terms[1:]:
+            lines.append("    w |= %s;" % term)
+        lines.append("    Com_Store%s(&pdu[%d], w);" % (word.access, word.offset))
+        return lines
+
+    @staticmethod
+    def unpack_lines(ipdu):
+        words = dict(((w.index, w.big_endian), w) for w in ipdu.words)
+        loaded = set()
+        lines = []
+        for sig in sorted(ipdu.signals, key=lambda s: (min(p[0] for p in s.pieces()), s.handle)):
+            wide = sig.size > 32
+            fields = []
+            for index, shift, vshift, bits in sig.pieces():
+                word = words[(index, sig.big_endian)]
+                if word.var not in loaded:
+                    loaded.add(word.var)
+                    lines.append("    %s = Com_Load%s(&pdu[%d]);" % (word.var, word.access, word.offset))
+                field = word.var if shift == 0 else "(%s >> %d)" % (word.var, shift)
+                if shift + bits < 32:
+                    field = "(%s & %s)" % (field, hex_const((1 << bits) - 1, 32))
+                if wide:
+                    field = "((uint64)%s << %d)" % (field, vshift) if vshift else "(uint64)%s" % field
+                elif vshift:
+                    field = "(%s << %d)" % (field, vshift)
+                fields.append(field)
+            value = fields[0] if len(fields) == 1 else "(%s)" % " | ".join(fields)
+            if sig.signed and sig.size < 8 * sig.bytes:
+                sign = hex_const(1 << (sig.size - 1), 64 if wide else 32)
+                value = "((sint%d)(%s ^ %s) - %s)" % (64 if wide else 32, value, sign, sign.replace("U", ""))
+            line = "    s->%s = (%s)%s;" % (sig.name, sig.ctype, value)
+            if len(line) > 120:
+                head, rest = line.split(" | ", 1)
+                line = head + "\n        | " + rest.replace(" | ", "\n        | ")
+            lines.append(line)
+        return lines
+
+    def kernel(self, ipdu):
+        pack = ipdu.send
+        name = "Com_%s_%s" % ("Pack" if pack else "Unpack", ipdu.name)
+        out = ["/**",
+               " * @brief %s I-PDU %s (%d bytes, %d signals)" %
+               ("Pack the shadow into" if pack else "Unpack the shadow from", ipdu.name, ipdu.length,
+                len(ipdu.signals)),
+               " */",
+               "STATIC void %s(void)" % name,
+               "{",
+               "    %s(uint8, AUTOMATIC, COM_VAR) pdu = Com_Pdu_%s;" % ("P2VAR" if pack else "P2CONST", ipdu.name),
+               "    %s(Com_Shadow_%sType, AUTOMATIC, COM_VAR) s = &Com_Shadow_%s;" %
+               ("P2CONST" if pack else "P2VAR", ipdu.name, ipdu.name)]
+        if not ipdu.words:
+            out += ["", "    (void)pdu;", "    (void)s;"]
+        elif pack:
+            out.append("    uint32 w;")
+            for word in ipdu.words:
+                out.append("")
+                out += self.pack_lines(word)
+        else:
+            out += wrap("    uint32", [w.var for w in ipdu.words], ";", "          ")
+            out.append("")
+            out += self.unpack_lines(ipdu)
+        out += ["}", ""]
+        return out
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "com_cfg.c",
+                              "COM Configuration - Shadows, Kernels and Tables",
+                              ["Static COM configuration of the VCU: shadows, PDU buffers, the pack and",
+                               "unpack kernels of the I-PDUs and the I-PDU and signal tables."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "com_stack.h"',
+               '#include "com_pack.h"',
+               "",
+               banner("c", "SHADOW TYPES")]
+        for ipdu in m.ipdus:
+            out += ["/** @brief Signals of %s */" % ipdu.name, "typedef struct", "{"]
+            for sig in ipdu.shadow_members():
+                out.append("    %s %s" % (sig.ctype.ljust(7), (sig.name + ";").ljust(36)) +
+                           "/**< %s %d@%d */" % ("BE" if sig.big_endian else "LE", sig.size, sig.position))
+            out += ["} Com_Shadow_%sType;" % ipdu.name, ""]
+
+        out.append(banner("c", "LOCAL VARIABLES"))
+        for ipdu in m.ipdus:
+            out.append("STATIC uint8 Com_Pdu_%s[%dU] ALIGNED(%d);" % (ipdu.name, ipdu.buffer_size, PDU_ALIGN))
+        out.append("")
+        for ipdu in m.ipdus:
+            out.append("STATIC Com_Shadow_%sType Com_Shadow_%s;" % (ipdu.name, ipdu.name))
+        out += ["", banner("c", "LOCAL CONSTANTS")]
+        for ipdu in m.ipdus:
+            out.append("static const Com_Shadow_%sType Com_ShadowInit_%s =" % (ipdu.name, ipdu.name))
+            values = [c_int(sig.init, sig.ctype) for sig in ipdu.shadow_members()]
+            rows, row = [], ""
+            for value in values:
+                item = value + ","
+                if row and len(row) + len(item) + 1 > 92:
+                    rows.append(row)
+                    row = ""
+                row = (row + " " + item).strip()
+            rows.append(row)
+            rows[-1] = rows[-1].rstrip(",")
+            out.append("{")
+            out += ["    " + r for r in rows]
+            out += ["};", ""]
+
+        out.append(banner("c", "LOCAL FUNCTIONS"))
+        for ipdu in m.ipdus:
+            out += self.kernel(ipdu)
+
+        out.append(banner("c", "GLOBAL CONSTANTS"))
+        out.append("const Com_IPduConfigType Com_IPdu[COM_IPDU_COUNT] =")
+        out.append("{")
+        rows = []
+        for ipdu in m.ipdus:
+            rows.append("    { Com_Pdu_%s, &Com_Shadow_%s, &Com_ShadowInit_%s,\n"
+                        "      %s, %s,\n"
+                        "      (uint16)sizeof(Com_Shadow_%sType), %dU, (uint8)%s, (uint8)%s, 0x%02XU,\n"
+                        "      (uint8)%s, %dU, %dU,\n"
+                        "      (uint8)%s, %dU, %dU, %dU, %s }" %
+                        (ipdu.name, ipdu.name, ipdu.name,
+                         ("Com_Pack_%s" % ipdu.name) if ipdu.send else "NULL_PTR",
+                         "NULL_PTR" if ipdu.send else ("Com_Unpack_%s" % ipdu.name),
+                         ipdu.name, ipdu.length, "COM_SEND" if ipdu.send else "COM_RECEIVE",
+                         "COM_DEFERRED" if ipdu.deferred else "COM_IMMEDIATE", ipdu.unused,
+                         TIMEOUT_ACTIONS[ipdu.timeout_action], ipdu.timeout, ipdu.first_timeout,
+                         TX_MODES[ipdu.tx_mode], ipdu.tx_period, ipdu.tx_offset or 0, ipdu.tx_mdt,
+                         "COM_NO_PDUR_PDU" if ipdu.pdur_pdu is None else "%dU" % ipdu.pdur_pdu))
+        out.append(",\n".join(rows))
+        out += ["};", ""]
+
+        out.append("const Com_SignalConfigType Com_Signal[COM_SIGNAL_COUNT] =")
+        out.append("{")
+        rows = ["    { &Com_Shadow_%s.%s, ComConf_ComIPdu_%s, %dU, (uint8)%s }" %
+                (sig.ipdu.name, sig.name, sig.ipdu.name, sig.bytes, sig.transfer) for sig in m.signals]
+        out.append(",\n".join(rows))
+        out += ["};", ""]
+
+        out += ["#if (COM_SIGNAL_LAYOUT_TABLE == STD_ON)",
+                "const Com_SignalLayoutType Com_SignalLayout[COM_SIGNAL_COUNT] =",
+                "{"]
+        rows = ["    { %s %s %s %s }   /* %s */" %
+                (("%dU," % sig.position).ljust(5), ("%dU," % sig.size).ljust(4),
+                 ("TRUE," if sig.big_endian else "FALSE,").ljust(6), "TRUE " if sig.signed else "FALSE", sig.name)
+                for sig in m.signals]
+        out.append(join_rows(rows))
+        out += ["};", "#endif", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/bsw/com", help="output directory of com_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"com_cfg.h": emitter.emit_header(), "com_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("com_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("com_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+"""
+EthComm generator - ARXML gateway configuration to the EthComm configuration (EthernetComm_Cfg.h / .c)
+
+Reads the ACF-CAN streams and the aggregated CAN-FD frames of the CAN-FD to
+Ethernet gateway (EthComm EthCommGeneral, EthCommAcfStream,
+EthCommAcfCanPdu) and the PDUs they refer to (EcuC EcucPduCollection) from
+one or more ARXML files and emits the static configuration consumed by
+src/swc/EthernetComm/EthernetComm.c:
+
+- Stream table: one entry per EthCommAcfStream, indexed by its
+  EthCommStreamHandleId, with the IEEE 1722 stream ID, destination MAC
+  address, VLAN tag, maximum frame length and flush timeout
+- CAN-FD frame table: one entry per EthCommAcfCanPdu, indexed by its
+  EthCommAcfCanPduId (the handle the PduR routes to, see
+  tools/pdur/pdur_generator.py), with the CAN identifier, ACF flags, bus
+  ID and stream
+- Source MAC address (EthCommSourceMacAddress)
+
+Checks: dense handles, one EthCommGeneral, MAC addresses, VLAN ID and
+priority, CAN identifier within 11 or 29 bits, PduLength of at most 64
+bytes, maximum frame length of the stream taking at least the largest of
+its messages and at most a VLAN-tagged Ethernet frame, one CAN identifier
+per bus and stream.
+
+Usage:
+    python3 tools/ethcomm/ethcomm_generator.py config/autosar/communication/pdu_router.arxml \\
+        -o src/swc/EthernetComm
+    python3 tools/ethcomm/ethcomm_generator.py ... -o src/swc/EthernetComm --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, mac_init,
+    mac_text, one_ref, parameters, parse_bool, parse_mac)
+
+GENERATOR_VERSION = "1.0.0"
+
+#: Ethernet header with VLAN tag (18 bytes) and NTSCF header (12 bytes)
+HEADER_LENGTH = 30
+#: ACF CAN_BRIEF message header
+ACF_HEADER_LENGTH = 8
+#: VLAN-tagged Ethernet frame without FCS
+MAX_FRAME_LENGTH = 1518
+#: Ethernet minimum frame without FCS
+MIN_FRAME_LENGTH = 60
+CAN_FD_MAX_LENGTH = 64
+MAX_STREAMS = 0xFF
+MAX_HANDLE = 0xFFFE
+
+#: EthCommAcfCanIdType -> (identifier bits, ACF flags)
+CAN_ID_TYPES = {
+    "STANDARD_CAN": (11, []),
+    "STANDARD_FD_CAN": (11, ["ETHCOMM_ACF_FDF"]),
+    "EXTENDED_CAN": (29, ["ETHCOMM_ACF_EFF"]),
+    "EXTENDED_FD_CAN": (29, ["ETHCOMM_ACF_EFF", "ETHCOMM_ACF_FDF"]),
+}
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class Stream:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.stream_id = 0
+        self.dest_mac = []
+        self.vlan_id = 0
+        self.priority = 0
+        self.max_length = 0
+        self.timeout_us = 0
+        self.pdus = []
+
+
+class AcfCanPdu:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.can_id = 0
+        self.flags = []
+        self.bus_id = 0
+        self.length = 0
+        self.stream = None
+
+    def message_length(self):
+        return ACF_HEADER_LENGTH + (self.length + 3) // 4 * 4
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.source_mac = []
+        self.streams = []
+        self.pdus = []
+
+    def build(self):
+        general = list(self.x.containers("EthCommGeneral"))
+        if len(general) != 1:
+            raise GeneratorError("exactly one EthCommGeneral required")
+        self.source_mac = parse_mac(parameters(general[0])["EthCommSourceMacAddress"], "EthCommSourceMacAddress")
+
+        streams = {}
+        for elem in self.x.containers("EthCommAcfStream"):
+            streams[self.x.path_of[elem]] = self.stream(elem)
+        self.streams = dense(list(streams.values()), "EthCommStreamHandleId", MAX_HANDLE)
+        if len(self.streams) > MAX_STREAMS:
+            raise GeneratorError("more than %d EthCommAcfStream" % MAX_STREAMS)
+
+        pdus, used = [], set()
+        for elem in self.x.containers("EthCommAcfCanPdu"):
+            pdu = self.pdu(elem)
+            ref = one_ref(elem, "EthCommAcfStreamRef", pdu.name)
+            if ref not in streams:
+                raise GeneratorError("%s: %s is not an EthCommAcfStream" % (pdu.name, ref))
+            pdu.stream = streams[ref]
+            key = (pdu.stream.name, pdu.bus_id, pdu.can_id)
+            if key in used:
+                raise GeneratorError("%s: CAN ID 0x%X of bus %d is aggregated twice into %s" %
+                                     (pdu.name, pdu.can_id, pdu.bus_id, pdu.stream.name))
+            used.add(key)
+            pdu.stream.pdus.append(pdu)
+            pdus.append(pdu)
+        self.pdus = dense(pdus, "EthCommAcfCanPduId", MAX_HANDLE)
+
+        for stream in self.streams:
+            if not stream.pdus:
+                raise GeneratorError("EthCommAcfStream %s has no EthCommAcfCanPdu" % stream.name)
+            largest = max(p.message_length() for p in stream.pdus)
+            if stream.max_length < HEADER_LENGTH + largest:
+                raise GeneratorError("EthCommAcfStream %s: EthCommMaxFrameLength %d below the %d bytes "
+                                     "of its largest message" % (stream.name, stream.max_length,
+                                                                 HEADER_LENGTH + largest))
+
+    def stream(self, elem):
+        name = child_text(elem, "SHORT-NAME")
+        p = parameters(elem)
+        stream = Stream(name, int(p["EthCommStreamHandleId"], 0))
+        stream.stream_id = int(p["EthCommStreamId"], 0)
+        if not 0 <= stream.stream_id < (1 << 64):
+            raise GeneratorError("EthCommAcfStream %s: EthCommStreamId exceeds 64 bits" % name)
+        stream.dest_mac = parse_mac(p["EthCommDestMacAddress"], "EthCommAcfStream %s" % name)
+        stream.vlan_id = int(p["EthCommVlanId"], 0)
+        stream.priority = int(p["EthCommVlanPriority"], 0)
+        if not 1 <= stream.vlan_id <= 4094 or not 0 <= stream.priority <= 7:
+            raise GeneratorError("EthCommAcfStream %s: EthCommVlanId 1..4094 and EthCommVlanPriority 0..7 "
+                                 "required" % name)
+        stream.max_length = int(p["EthCommMaxFrameLength"], 0)
+        if not MIN_FRAME_LENGTH <= stream.max_length <= MAX_FRAME_LENGTH:
+            raise GeneratorError("EthCommAcfStream %s: EthCommMaxFrameLength must be %d..%d" %
+                                 (name, MIN_FRAME_LENGTH, MAX_FRAME_LENGTH))
+        timeout = float(p["EthCommFlushTimeout"])
+        if not 0.0 <= timeout <= 1.0:
+            raise GeneratorError("EthCommAcfStream %s: EthCommFlushTimeout must be 0..1 s" % name)
+        stream.timeout_us = int(round(timeout * 1e6))
+        return stream
+
+    def pdu(self, elem):
+        name = child_text(elem, "SHORT-NAME")
+        p = parameters(elem)
+        pdu = AcfCanPdu(name, int(p["EthCommAcfCanPduId"], 0))
+        id_type = p.get("EthCommAcfCanIdType", "STANDARD_CAN")
+        if id_type not in CAN_ID_TYPES:
+            raise GeneratorError("%s: unsupported EthCommAcfCanIdType %s" % (name, id_type))
+        bits, flags = CAN_ID_TYPES[id_type]
+        pdu.can_id = int(p["EthCommAcfCanId"], 0)
+        if not 0 <= pdu.can_id < (1 << bits):
+            raise GeneratorError("%s: EthCommAcfCanId 0x%X exceeds %d bits" % (name, pdu.can_id, bits))
+        pdu.flags = list(flags)
+        if parse_bool(p.get("EthCommAcfCanBrs", "false")):
+            if "ETHCOMM_ACF_FDF" not in flags:
+                raise GeneratorError("%s: EthCommAcfCanBrs requires a CAN-FD EthCommAcfCanIdType" % name)
+            pdu.flags.append("ETHCOMM_ACF_BRS")
+        pdu.bus_id = int(p["EthCommAcfCanBusId"], 0)
+        if not 0 <= pdu.bus_id <= 31:
+            raise GeneratorError("%s: EthCommAcfCanBusId must be 0..31" % name)
+        ref = one_ref(elem, "EthCommAcfCanPduRef", name)
+        pdu.length = int(parameters(self.x.resolve(ref))["PduLength"])
+        if pdu.length > CAN_FD_MAX_LENGTH:
+            raise GeneratorError("%s: PduLength %d exceeds a CAN-FD frame" % (name, pdu.length))
+        return pdu
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_streams(self):
+        rows = ["| Stream | Stream ID          | Destination MAC   | VID  | PCP | Max frame | Flush timeout | Frames |",
+                "|--------|--------------------|-------------------|------|-----|-----------|---------------|--------|"]
+        for s in self.m.streams:
+            rows.append("| %-6s | 0x%016X | %s | %-4d | %-3d | %-9d | %-13s | %-6d |" %
+                        (s.name, s.stream_id, mac_text(s.dest_mac), s.vlan_id, s.priority, s.max_length,
+                         "%d us" % s.timeout_us, len(s.pdus)))
+        return rows
+
+    # -- EthernetComm_Cfg.h ----------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Handles of the ACF-CAN streams and aggregated CAN-FD frames of the VCU",
+                   "CAN-FD to Ethernet gateway (source MAC %s):" % mac_text(m.source_mac),
+                   ""]
+        details += self.doc_streams()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "EthernetComm_Cfg.h",
+                              "EthComm Configuration - Stream and CAN-FD Frame Handles", details),
+               "#ifndef ETHERNETCOMM_CFG_H",
+               "#define ETHERNETCOMM_CFG_H",
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("ETHCOMM_STREAM_COUNT", "%dU" % len(m.streams)),
+               define("ETHCOMM_ACF_CAN_PDU_COUNT", "%dU" % len(m.pdus)),
+               "",
+               banner("h", "STREAM HANDLES")]
+        for stream in m.streams:
+            out.append(define("EthCommConf_EthCommAcfStream_%s" % stream.name, "%dU" % stream.handle))
+        out += ["", banner("h", "CAN-FD FRAME HANDLES (EthComm_Transmit)")]
+        for pdu in m.pdus:
+            out.append(define("EthCommConf_EthCommAcfCanPdu_%s" % pdu.name, "%dU" % pdu.handle))
+        out += ["",
+                "#endif /* ETHERNETCOMM_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- EthernetComm_Cfg.c ----------------------------------------------------------------------
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "EthernetComm_Cfg.c",
+                              "EthComm Configuration - Stream and CAN-FD Frame Tables",
+                              ["Static EthComm configuration of the VCU: source MAC address, ACF-CAN",
+                               "streams and the CAN-FD frames aggregated into them."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "EthernetComm.h"',
+               "",
+               banner("c", "GLOBAL CONSTANTS"),
+               "const uint8 EthComm_SourceMac[6] = %s;" % mac_init(m.source_mac),
+               "",
+               "const EthComm_StreamConfigType EthComm_Stream[ETHCOMM_STREAM_COUNT] =",
+               "{"]
+        rows = []
+        for s in m.streams:
+            rows.append("    { 0x%016XULL, ETHCOMM_US_TO_TICKS(%dU), 0x%04XU, %dU, %s }   /* %s */" %
+                        (s.stream_id, s.timeout_us, (s.priority << 13) | s.vlan_id, s.max_length,
+                         mac_init(s.dest_mac), s.name))
+        out += [join_rows(rows), "};", ""]
+
+        out += ["const EthComm_AcfCanPduConfigType EthComm_AcfCanPdu[ETHCOMM_ACF_CAN_PDU_COUNT] =", "{"]
+        flags_width = max(len(" | ".join(p.flags) or "0U") for p in m.pdus) + 1
+        rows = []
+        for pdu in m.pdus:
+            rows.append("    { %s %s %s %s }   /* %s */" %
+                        (("0x%03XUL," % pdu.can_id).ljust(13),
+                         ("EthCommConf_EthCommAcfStream_%s," % pdu.stream.name).ljust(
+                             len("EthCommConf_EthCommAcfStream_,") + max(len(s.name) for s in m.streams)),
+                         ("(uint8)(%s)," % (" | ".join(pdu.flags) or "0U")).ljust(flags_width + 9),
+                         "%dU" % pdu.bus_id, pdu.name))
+        out += [join_rows(rows), "};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/swc/EthernetComm",
+                        help="output directory of EthernetComm_Cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"EthernetComm_Cfg.h": emitter.emit_header(), "EthernetComm_Cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("ethcomm_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("ethcomm_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
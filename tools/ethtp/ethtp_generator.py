@@ -0,0 +1,421 @@
+#!/usr/bin/env python3
+"""
+EthTp generator - ARXML socket configuration to the EthTp configuration (eth_tp_cfg.h / .c)
+
+Reads the UDP socket connections (EthTp EthTpGeneral, EthTpSocketConnection),
+the SoAd PDU routes that use them (SoAd SoAdPduRoute, SoAdSocketRoute), the
+PDUs they refer to (EcuC EcucPduCollection) and the PduR routing paths of
+these PDUs from one or more ARXML files and emits the static configuration
+consumed by src/bsw/com/eth_tp.c:
+
+- General parameters: local IPv4 address, source MAC address, VLAN tag,
+  time to live and maximum datagram length
+- Socket connection table: one entry per EthTpSocketConnection, indexed by
+  its EthTpSoConId, with local port, remote endpoint, remote MAC address
+  (derived for multicast addresses), UDP checksum and its range of the
+  receive route table
+- Transmit PDU table: one entry per SoAdPduRoute, indexed by its
+  SoAdTxPduId (the handle the PduR transmits with), with the PDU header ID,
+  PDU length, socket connection and the PduR destination handle for
+  PduR_SoAdIfTriggerTransmit()
+- Receive route table: one entry per SoAdSocketRoute, grouped by socket
+  connection and sorted by SoAdRxPduHeaderId, with the PduR source handle
+  for PduR_SoAdIfRxIndication()
+
+Checks: dense handles, IPv4 and MAC addresses, ports, VLAN ID and priority,
+one socket connection per local port and remote endpoint, a remote MAC
+address for every unicast remote, exactly one SoAdPduRouteDest per
+SoAdPduRoute, header IDs unique per socket connection and direction, every
+PDU fitting into a datagram with its 8-byte PDU header, every SoAd PDU
+routed by the PduR.
+
+Usage:
+    python3 tools/ethtp/ethtp_generator.py config/autosar/communication/pdu_router.arxml \\
+        -o src/bsw/com
+    python3 tools/ethtp/ethtp_generator.py ... -o src/bsw/com --check
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, last_name,
+    mac_init, mac_text, one_ref, parameters, parse_bool, parse_mac, references, sub_containers)
+
+GENERATOR_VERSION = "1.0.0"
+
+#: SoAd PDU header: 32-bit header ID and 32-bit length
+PDU_HEADER_LENGTH = 8
+#: UDP payload of an untagged 1500-byte MTU
+MAX_DATAGRAM_LENGTH = 1472
+MIN_DATAGRAM_LENGTH = 64
+MAX_SOCONS = 0xFF
+MAX_HANDLE = 0xFFFE
+MAX_HEADER_ID = 0xFFFFFFFF
+
+IP_PATTERN = re.compile(r"^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$")
+
+
+# ------------------------------------------------------------------------------------------------
+# ARXML access
+# ------------------------------------------------------------------------------------------------
+
+def _ip(value, what):
+    match = IP_PATTERN.match(value)
+    if not match or any(int(part) > 255 for part in match.groups()):
+        raise GeneratorError("%s: %s is not an IPv4 address" % (what, value))
+    result = 0
+    for part in match.groups():
+        result = (result << 8) | int(part)
+    return result
+
+
+def _port(value, what):
+    port = int(value, 0)
+    if not 1 <= port <= 0xFFFF:
+        raise GeneratorError("%s: UDP port %d out of range 1..65535" % (what, port))
+    return port
+
+
+def ip_text(ip):
+    return ".".join(str((ip >> shift) & 0xFF) for shift in (24, 16, 8, 0))
+
+
+def is_multicast(ip):
+    return (ip >> 28) == 0xE
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class SoCon:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.local_port = 0
+        self.remote_ip = 0
+        self.remote_port = 0
+        self.remote_mac = []
+        self.udp_checksum = False
+        self.tx = []
+        self.rx = []
+        self.rx_first = 0
+
+
+class TxPdu:
+    def __init__(self, name, handle):
+        self.name = name
+        self.handle = handle
+        self.header_id = 0
+        self.length = 0
+        self.socon = None
+        self.pdur_dest = None
+
+
+class RxRoute:
+    def __init__(self, name):
+        self.name = name
+        self.header_id = 0
+        self.socon = None
+        self.pdur_src = None
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.local_ip = 0
+        self.source_mac = []
+        self.vlan_id = 0
+        self.priority = 0
+        self.ttl = 0
+        self.max_datagram = 0
+        self.socons = []
+        self.tx_pdus = []
+        self.rx_routes = []
+
+    def build(self):
+        general = list(self.x.containers("EthTpGeneral"))
+        if len(general) != 1:
+            raise GeneratorError("exactly one EthTpGeneral required")
+        p = parameters(general[0])
+        self.local_ip = _ip(p["EthTpLocalIpAddress"], "EthTpLocalIpAddress")
+        self.source_mac = parse_mac(p["EthTpSourceMacAddress"], "EthTpSourceMacAddress")
+        self.vlan_id = int(p["EthTpVlanId"], 0)
+        self.priority = int(p["EthTpVlanPriority"], 0)
+        if not 1 <= self.vlan_id <= 4094 or not 0 <= self.priority <= 7:
+            raise GeneratorError("EthTpGeneral: EthTpVlanId 1..4094 and EthTpVlanPriority 0..7 required")
+        self.ttl = int(p.get("EthTpTimeToLive", "64"), 0)
+        if not 1 <= self.ttl <= 255:
+            raise GeneratorError("EthTpGeneral: EthTpTimeToLive must be 1..255")
+        self.max_datagram = int(p["EthTpMaxDatagramLength"], 0)
+        if not MIN_DATAGRAM_LENGTH <= self.max_datagram <= MAX_DATAGRAM_LENGTH:
+            raise GeneratorError("EthTpGeneral: EthTpMaxDatagramLength must be %d..%d" %
+                                 (MIN_DATAGRAM_LENGTH, MAX_DATAGRAM_LENGTH))
+
+        socons, endpoints = {}, set()
+        for elem in self.x.containers("EthTpSocketConnection"):
+            socon = self.socon(elem)
+            key = (socon.local_port, socon.remote_ip, socon.remote_port)
+            if key in endpoints:
+                raise GeneratorError("EthTpSocketConnection %s: local port %d and remote %s:%d used twice" %
+                                     (socon.name, socon.local_port, ip_text(socon.remote_ip), socon.remote_port))
+            endpoints.add(key)
+            socons[self.x.path_of[elem]] = socon
+        self.socons = dense(list(socons.values()), "EthTpSoConId", MAX_HANDLE)
+        if len(self.socons) > MAX_SOCONS:
+            raise GeneratorError("more than %d EthTpSocketConnection" % MAX_SOCONS)
+
+        dest_of, src_of = self.pdur_handles()
+
+        pdus = []
+        for elem in self.x.containers("SoAdPduRoute"):
+            name = child_text(elem, "SHORT-NAME")
+            p = parameters(elem)
+            ref = one_ref(elem, "SoAdTxPduRef", name)
+            pdu = TxPdu(last_name(ref), int(p["SoAdTxPduId"], 0))
+            pdu.length = int(parameters(self.x.resolve(ref))["PduLength"])
+            dests = sub_containers(elem, "SoAdPduRouteDest")
+            if len(dests) != 1:
+                raise GeneratorError("SoAdPduRoute %s: exactly one SoAdPduRouteDest required" % name)
+            pdu.header_id = self.header_id(parameters(dests[0]), "SoAdTxPduHeaderId", name)
+            pdu.socon = self.socon_of(dests[0], "SoAdTxSocketConnOrSocketConnBundleRef", socons, name)
+            if PDU_HEADER_LENGTH + pdu.length > self.max_datagram:
+                raise GeneratorError("SoAdPduRoute %s: PduLength %d does not fit into a datagram of %d bytes" %
+                                     (name, pdu.length, self.max_datagram))
+            if ref not in dest_of:
+                raise GeneratorError("SoAdPduRoute %s: %s is not a PduR destination" % (name, pdu.name))
+            pdu.pdur_dest = dest_of[ref]
+            pdu.socon.tx.append(pdu)
+            pdus.append(pdu)
+        self.tx_pdus = dense(pdus, "SoAdTxPduId", MAX_HANDLE)
+
+        for elem in self.x.containers("SoAdSocketRoute"):
+            name = child_text(elem, "SHORT-NAME")
+            dests = sub_containers(elem, "SoAdSocketRouteDest")
+            if len(dests) != 1:
+                raise GeneratorError("SoAdSocketRoute %s: exactly one SoAdSocketRouteDest required" % name)
+            ref = one_ref(dests[0], "SoAdRxPduRef", name)
+            route = RxRoute(last_name(ref))
+            route.header_id = self.header_id(parameters(elem), "SoAdRxPduHeaderId", name)
+            route.socon = self.socon_of(elem, "SoAdRxSocketConnOrSocketConnBundleRef", socons, name)
+            if is_multicast(route.socon.remote_ip):
+                raise GeneratorError("SoAdSocketRoute %s: %s has a multicast remote address, nothing is "
+                                     "received from it" % (name, route.socon.name))
+            if ref not in src_of:
+                raise GeneratorError("SoAdSocketRoute %s: %s is not a PduR source" % (name, route.name))
+            route.pdur_src = src_of[ref]
+            route.socon.rx.append(route)
+
+        for socon in self.socons:
+            for direction, items in (("transmit", socon.tx), ("receive", socon.rx)):
+                ids = [item.header_id for item in items]
+                if len(set(ids)) != len(ids):
+                    raise GeneratorError("EthTpSocketConnection %s: %s PDU header IDs are not unique" %
+                                         (socon.name, direction))
+            socon.rx.sort(key=lambda route: route.header_id)
+            socon.rx_first = len(self.rx_routes)
+            self.rx_routes += socon.rx
+            if not socon.tx and not socon.rx:
+                raise GeneratorError("EthTpSocketConnection %s is not used by a SoAd route" % socon.name)
+        if len(self.rx_routes) > MAX_HANDLE:
+            raise GeneratorError("more than %d SoAdSocketRoute" % MAX_HANDLE)
+
+    def socon(self, elem):
+        name = child_text(elem, "SHORT-NAME")
+        p = parameters(elem)
+        what = "EthTpSocketConnection %s" % name
+        socon = SoCon(name, int(p["EthTpSoConId"], 0))
+        socon.local_port = _port(p["EthTpLocalPort"], what)
+        socon.remote_ip = _ip(p["EthTpRemoteIpAddress"], what)
+        socon.remote_port = _port(p["EthTpRemotePort"], what)
+        if is_multicast(socon.remote_ip):
+            if "EthTpRemoteMacAddress" in p:
+                raise GeneratorError("%s: the MAC address of a multicast remote is derived, "
+                                     "EthTpRemoteMacAddress not allowed" % what)
+            socon.remote_mac = [0x01, 0x00, 0x5E, (socon.remote_ip >> 16) & 0x7F,
+                                (socon.remote_ip >> 8) & 0xFF, socon.remote_ip & 0xFF]
+        elif socon.remote_ip in (0, 0xFFFFFFFF):
+            raise GeneratorError("%s: unspecified or broadcast remote address" % what)
+        else:
+            if "EthTpRemoteMacAddress" not in p:
+                raise GeneratorError("%s: EthTpRemoteMacAddress required for a unicast remote" % what)
+            socon.remote_mac = parse_mac(p["EthTpRemoteMacAddress"], what)
+        socon.udp_checksum = parse_bool(p.get("EthTpUdpChecksum", "true"))
+        return socon
+
+    def socon_of(self, container, name, socons, what):
+        ref = one_ref(container, name, what)
+        if ref not in socons:
+            raise GeneratorError("%s: %s is not an EthTpSocketConnection" % (what, ref))
+        return socons[ref]
+
+    @staticmethod
+    def header_id(params, name, what):
+        value = int(params[name], 0)
+        if not 0 <= value <= MAX_HEADER_ID:
+            raise GeneratorError("%s: %s exceeds 32 bits" % (what, name))
+        return value
+
+    def pdur_handles(self):
+        """PduR destination and source names of the PDUs: {PDU reference: short name}"""
+        dest_of, src_of = {}, {}
+        for path in self.x.containers("PduRRoutingPath"):
+            for src in sub_containers(path, "PduRSrcPdu"):
+                for ref in references(src, "PduRSrcPduRef"):
+                    src_of[ref] = child_text(src, "SHORT-NAME")
+            for dest in sub_containers(path, "PduRDestPdu"):
+                for ref in references(dest, "PduRDestPduRef"):
+                    dest_of[ref] = child_text(dest, "SHORT-NAME")
+        return dest_of, src_of
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_socons(self):
+        rows = ["| Socket connection | Local port | Remote                | Remote MAC        | Checksum | TX PDUs | RX PDUs |",
+                "|-------------------|------------|-----------------------|-------------------|----------|---------|---------|"]
+        for s in self.m.socons:
+            rows.append("| %-17s | %-10d | %-21s | %s | %-8s | %-7d | %-7d |" %
+                        (s.name, s.local_port, "%s:%d" % (ip_text(s.remote_ip), s.remote_port),
+                         mac_text(s.remote_mac), "UDP" if s.udp_checksum else "none", len(s.tx), len(s.rx)))
+        return rows
+
+    # -- eth_tp_cfg.h ----------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Socket connections and SoAd PDU handles of the VCU UDP/IPv4 socket adapter",
+                   "(local address %s, source MAC %s, VLAN %d, PCP %d):" %
+                   (ip_text(m.local_ip), mac_text(m.source_mac), m.vlan_id, m.priority),
+                   ""]
+        details += self.doc_socons()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "eth_tp_cfg.h",
+                              "EthTp Configuration - Socket Connection and PDU Handles", details),
+               "#ifndef ETH_TP_CFG_H",
+               "#define ETH_TP_CFG_H",
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("ETHTP_SOCON_COUNT", "%dU" % len(m.socons)),
+               define("ETHTP_TX_PDU_COUNT", "%dU" % len(m.tx_pdus)),
+               define("ETHTP_RX_ROUTE_COUNT", "%dU" % len(m.rx_routes)),
+               "",
+               banner("h", "GENERAL PARAMETERS"),
+               define("ETHTP_LOCAL_IP_ADDRESS", "%s/* %s */" % (("0x%08XUL" % m.local_ip).ljust(16),
+                                                                ip_text(m.local_ip))),
+               define("ETHTP_VLAN_TCI", "%s/* PCP %d, VID %d */" % (("0x%04XU" % ((m.priority << 13) | m.vlan_id)).ljust(16),
+                                                                 m.priority, m.vlan_id)),
+               define("ETHTP_TIME_TO_LIVE", "%dU" % m.ttl),
+               define("ETHTP_MAX_DATAGRAM_LENGTH", "%dU" % m.max_datagram),
+               "",
+               banner("h", "SOCKET CONNECTION HANDLES")]
+        for socon in m.socons:
+            out.append(define("EthTpConf_EthTpSocketConnection_%s" % socon.name, "%dU" % socon.handle))
+        out += ["", banner("h", "TRANSMIT PDU HANDLES (EthTp_IfTransmit / SoAd_IfTransmit)")]
+        for pdu in m.tx_pdus:
+            out.append(define("EthTpConf_SoAdTxPdu_%s" % pdu.name, "%dU" % pdu.handle))
+        out += ["",
+                "#endif /* ETH_TP_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- eth_tp_cfg.c ----------------------------------------------------------------------------
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "eth_tp_cfg.c",
+                              "EthTp Configuration - Socket Connection and Route Tables",
+                              ["Static EthTp configuration of the VCU: source MAC address, UDP socket",
+                               "connections, SoAd transmit PDUs and receive routes. The receive routes",
+                               "of a socket connection are sorted by PDU header ID."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "eth_tp.h"',
+               '#include "pdu_router.h"',
+               "",
+               banner("c", "GLOBAL CONSTANTS"),
+               "const uint8 EthTp_SourceMac[6] = %s;" % mac_init(m.source_mac),
+               "",
+               "const EthTp_SoConConfigType EthTp_SoCon[ETHTP_SOCON_COUNT] =",
+               "{"]
+        rows = []
+        for s in m.socons:
+            rows.append("    { 0x%08XUL, %5dU, %5dU, %3dU, %3dU, %s, %-5s }   /* %s */" %
+                        (s.remote_ip, s.local_port, s.remote_port, s.rx_first, len(s.rx),
+                         mac_init(s.remote_mac), "TRUE" if s.udp_checksum else "FALSE", s.name))
+        out += [join_rows(rows), "};", ""]
+
+        out += ["const EthTp_TxPduConfigType EthTp_TxPdu[ETHTP_TX_PDU_COUNT] =", "{"]
+        dest_width = max(len(p.pdur_dest) for p in m.tx_pdus) + len("PduRConf_PduRDestPdu_,")
+        socon_width = max(len(s.name) for s in m.socons) + len("EthTpConf_EthTpSocketConnection_")
+        rows = []
+        for pdu in m.tx_pdus:
+            rows.append("    { 0x%08XUL, %s %s %s }   /* %s */" %
+                        (pdu.header_id, ("PduRConf_PduRDestPdu_%s," % pdu.pdur_dest).ljust(dest_width),
+                         ("%dU," % pdu.length).ljust(5),
+                         ("EthTpConf_EthTpSocketConnection_%s" % pdu.socon.name).ljust(socon_width), pdu.name))
+        out += [join_rows(rows), "};", ""]
+
+        out += ["const EthTp_RxRouteConfigType EthTp_RxRoute[ETHTP_RX_ROUTE_COUNT] =", "{"]
+        rows = []
+        for route in m.rx_routes:
+            rows.append("    { 0x%08XUL, %s }   /* %s */" %
+                        (route.header_id, ("PduRConf_PduRSrcPdu_%s" % route.pdur_src).ljust(
+                            max(len(r.pdur_src) for r in m.rx_routes) + len("PduRConf_PduRSrcPdu_")),
+                         route.socon.name))
+        out += [join_rows(rows), "};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/bsw/com",
+                        help="output directory of eth_tp_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"eth_tp_cfg.h": emitter.emit_header(), "eth_tp_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("ethtp_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("ethtp_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+Generator common - ARXML access and C emission helpers of the configuration generators
+
+Shared by the generators under tools/ (tools/<module>/<module>_generator.py),
+which import it with:
+
+    sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+    from generator_common import Arxml, GeneratorError, ...  # noqa: E402
+
+- ARXML: Arxml merges several files into one view indexed by absolute
+  SHORT-NAME path (namespaces stripped); parameters(), references() and
+  sub_containers() read ECUC container values
+- Model: dense() checks that handles run from 0 without gaps; parse_mac()
+  reads a MAC address, mac_text() and mac_init() write it back
+- Output: header_comment() emits the Doxygen file header of a generated
+  file, banner() the section banners of the .h (BANNER_H) and .c (BANNER_C)
+  file templates, define() an object-like macro with its value aligned to
+  column 56, always separated from the name by at least one blank, and
+  join_rows() the rows of a table initializer
+
+Errors in the input raise GeneratorError; every generator reports it as
+"<generator>: error: <message>" and exits with status 1.
+"""
+
+import os
+import re
+import xml.etree.ElementTree as ET
+
+
+class GeneratorError(Exception):
+    """Inconsistent or unsupported configuration"""
+
+
+# ------------------------------------------------------------------------------------------------
+# ARXML access
+# ------------------------------------------------------------------------------------------------
+
+def local_name(tag):
+    return tag.split("}", 1)[1] if "}" in tag else tag
+
+
+def strip_namespaces(root):
+    for elem in root.iter():
+        elem.tag = local_name(elem.tag)
+    return root
+
+
+def child_text(elem, path, default=None):
+    node = elem.find(path)
+    if node is None or node.text is None:
+        if default is not None:
+            return default
+        raise GeneratorError("missing <%s> in <%s>" % (path, elem.tag))
+    return node.text.strip()
+
+
+def last_name(ref):
+    return ref.rstrip("/").split("/")[-1]
+
+
+class Arxml:
+    """Merged view of several ARXML files, indexed by absolute SHORT-NAME path"""
+
+    def __init__(self, paths):
+        self.roots = []
+        self.by_path = {}
+        self.path_of = {}
+        for path in paths:
+            root = strip_namespaces(ET.parse(path).getroot())
+            self.roots.append(root)
+            self._index(root, "")
+
+    def _index(self, elem, prefix):
+        name = elem.find("SHORT-NAME")
+        if name is not None and name.text:
+            prefix = prefix + "/" + name.text.strip()
+            if prefix in self.by_path:
+                raise GeneratorError("duplicate ARXML element %s" % prefix)
+            self.by_path[prefix] = elem
+            self.path_of[elem] = prefix
+        for child in elem:
+            self._index(child, prefix)
+
+    def iter(self, tag):
+        for root in self.roots:
+            for elem in root.iter(tag):
+                yield elem
+
+    def containers(self, definition):
+        """ECUC container values whose definition ends with /<definition>"""
+        for elem in self.iter("ECUC-CONTAINER-VALUE"):
+            if last_name(child_text(elem, "DEFINITION-REF")) == definition:
+                yield elem
+
+    def resolve(self, ref):
+        if ref not in self.by_path:
+            raise GeneratorError("unresolved reference %s" % ref)
+        return self.by_path[ref]
+
+
+def parameters(container):
+    """Parameter values of an ECUC container: {parameter name: text}"""
+    values = {}
+    group = container.find("PARAMETER-VALUES")
+    for param in (group if group is not None else []):
+        values[last_name(child_text(param, "DEFINITION-REF"))] = child_text(param, "VALUE")
+    return values
+
+
+def references(container, name):
+    group = container.find("REFERENCE-VALUES")
+    return [child_text(ref, "VALUE-REF") for ref in (group if group is not None else [])
+            if last_name(child_text(ref, "DEFINITION-REF")) == name]
+
+
+def sub_containers(container, definition):
+    group = container.find("SUB-CONTAINERS")
+    return [c for c in (group if group is not None else [])
+            if last_name(child_text(c, "DEFINITION-REF")) == definition]
+
+
+def one_ref(container, name, what):
+    refs = references(container, name)
+    if len(refs) != 1:
+        raise GeneratorError("%s: exactly one %s required" % (what, name))
+    return refs[0]
+
+
+def parse_bool(value):
+    return value.strip().lower() in ("true", "1")
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+MAC_PATTERN = re.compile(r"^[0-9A-Fa-f]{2}(:[0-9A-Fa-f]{2}){5}$")
+
+
+def dense(items, what, limit=None, key=lambda item: item.handle):
+    """Items sorted by handle; the handles must be 0..n-1 and n at most limit"""
+    items = sorted(items, key=key)
+    for index, item in enumerate(items):
+        if key(item) != index:
+            raise GeneratorError("%s must be dense from 0: %s has %d" % (what, item.name, key(item)))
+    if limit is not None and len(items) > limit:
+        raise GeneratorError("more than %d %s" % (limit, what))
+    return items
+
+
+def parse_mac(value, what):
+    if not MAC_PATTERN.match(value):
+        raise GeneratorError("%s: %s is not a MAC address (xx:xx:xx:xx:xx:xx)" % (what, value))
+    return [int(byte, 16) for byte in value.split(":")]
+
+
+def mac_text(mac):
+    return ":".join("%02X" % byte for byte in mac)
+
+
+def mac_init(mac):
+    return "{ %s }" % ", ".join("0x%02XU" % byte for byte in mac)
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+BANNER_H = """/* ===============================================================================================
+ *{title}
+ * =============================================================================================== */
+"""
+
+BANNER_C = """/*==================================================================================================
+*{title}
+==================================================================================================*/
+"""
+
+
+def banner(style, title):
+    return (BANNER_H if style == "h" else BANNER_C).format(title=title.center(96 if style == "h" else 98).rstrip())
+
+
+def header_comment(generator, version, inputs, filename, brief, details):
+    """File header of a generated file; generator is the __file__ of tools/<module>/<module>_generator.py"""
+    generator = "tools/%s/%s" % (os.path.basename(os.path.dirname(os.path.abspath(generator))),
+                                 os.path.basename(generator))
+    lines = ["/**",
+             " * @file    %s" % filename,
+             " * @brief   %s" % brief,
+             " * @version %s" % version,
+             " *",
+             " * @copyright Copyright (c) 2026 ASIL-D VCU Project",
+             " *",
+             " * @details"]
+    lines += [(" * " + d).rstrip() for d in details]
+    lines += [" *",
+              " * @note Generated by %s from %s - do not edit." % (generator, ", ".join(inputs)),
+              " */"]
+    return "\n".join(lines) + "\n"
+
+
+def define(name, value):
+    return "#define %s %s" % (name.ljust(47), value)
+
+
+def join_rows(rows):
+    # Comma before the trailing comment of every row but the last
+    result = []
+    for i, row in enumerate(rows):
+        if i < len(rows) - 1:
+            body, comment = row.split("   /*", 1)
+            row = "%s,  /*%s" % (body, comment)
+        result.append(row)
+    return "\n".join(result)
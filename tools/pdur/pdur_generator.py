@@ -0,0 +1,631 @@
+#!/usr/bin/env python3
+"""
+PduR generator - ARXML routing configuration to the PduR configuration (pdur_cfg.h / pdur_cfg.c)
+
+Reads the PduR routing paths (PduR PduRRoutingPath, PduRTxBuffer,
+PduRBswModules) and the PDUs of the modules at both ends of them (EcuC
+EcucPduCollection, Com ComIPdu, CanIf CanIfRxPduCfg / CanIfTxPduCfg, SoAd
+SoAdSocketRoute / SoAdPduRoute, EthComm EthCommAcfCanPdu, Dcm
+DcmDslProtocolRx / DcmDslProtocolTx, CanTp CanTpRxNSdu / CanTpTxNSdu) from
+one or more ARXML files and emits the
+static configuration consumed by src/bsw/com/pdu_router.c:
+
+- Routing table: one entry per routing path, indexed directly by its
+  PduRSourcePduHandleId, with the first destination and the number of
+  destinations. Source handles are dense from 0, so routing a PDU is one
+  table access whatever the number of paths; there is no search and no hash
+- Destination table: one entry per PduRDestPdu, indexed by
+  PduRDestPduHandleId (the handle the lower layers use in TriggerTransmit
+  and TxConfirmation). The destinations of a path have consecutive handles
+- Module table: the interface functions of the modules in PduRBswModules
+  (<Up>_RxIndication / _TriggerTransmit / _TxConfirmation of upper
+  interface modules, <Up>_StartOfReception / _CopyRxData / _TpRxIndication
+  / _CopyTxData / _TpTxConfirmation of upper transport protocol modules,
+  <Lo>_Transmit of lower modules)
+- Transmit buffers: one PduRTxBuffer per gateway path with
+  PDUR_TRIGGERTRANSMIT destinations, shared by all of them. Only their
+  lengths are generated; the PduR holds the PDU in a block of the PDU
+  buffer pool (src/bsw/com/pdu_pool.h)
+- Transmit controllers: the bus controllers of the lower interface
+  destinations, by which PduR_ComTransmitBatch() groups the PDUs of one
+  Com_MainFunctionTx() into one <Lo>_TransmitBatch() call each. A CanIf
+  destination is sent by the CanIfCtrlCfg its CanIfTxPduCfg reaches through
+  CanIfTxPduBufferRef, CanIfBufferHthRef and CanIfHthCanCtrlIdRef; the
+  other lower modules drive one controller each
+
+Module PDU handles are taken from the module owning the EcuC PDU in the
+role the routing path uses it in:
+
+| Role        | Com                     | CanIf                      | SoAd                          | EthComm          |
+|-------------|-------------------------|----------------------------|-------------------------------|------------------|
+| Source      | ComIPdu SEND            | CanIfRxPduCfg              | SoAdSocketRouteDest           | -                |
+| Destination | ComIPdu RECEIVE         | CanIfTxPduCfg              | SoAdPduRoute                  | EthCommAcfCanPdu |
+
+| Role        | Dcm                     | CanTp                      |
+|-------------|-------------------------|----------------------------|
+| Source      | DcmDslProtocolTx        | CanTpRxNSdu                |
+| Destination | DcmDslProtocolRx        | CanTpTxNSdu                |
+
+EthComm (src/swc/EthernetComm) is the gateway towards the Ethernet
+backbone that aggregates CAN-FD frames into IEEE 1722 ACF-CAN frames; its
+own tables are generated by tools/ethcomm/ethcomm_generator.py.
+
+Transport protocol modules (PduRTransportProtocol) are routed 1:1: a TP
+routing path connects one upper and one lower TP module with a single
+PDUR_DIRECT destination and no buffer. The CanTp tables are generated by
+tools/cantp/cantp_generator.py.
+
+Checks: dense handles, every source and destination PDU owned by exactly
+one module in PduRBswModules, one routing path per source and destination
+PDU, PDUR_TRIGGERTRANSMIT only towards lower modules with
+PduRTriggertransmit, one buffer of at least PduLength bytes for the
+PDUR_TRIGGERTRANSMIT destinations of a gateway path, none for paths from
+an upper module, TP paths 1:1 between an upper and a lower TP module.
+
+Usage:
+    python3 tools/pdur/pdur_generator.py config/autosar/communication/com.arxml \\
+        config/autosar/communication/pdu_router.arxml -o src/bsw/com
+    python3 tools/pdur/pdur_generator.py ... -o src/bsw/com --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, last_name,
+    parameters, parse_bool, references, sub_containers)
+
+GENERATOR_VERSION = "1.4.0"
+
+#: Transmit function of a lower module, if not <Module>_Transmit
+LOWER_TRANSMIT = {
+    "SoAd": "SoAd_IfTransmit",
+}
+
+#: Batched transmit function of a lower module (one call per controller); the other modules get one
+#: <Lo>_Transmit() call per PDU
+LOWER_TRANSMIT_BATCH = {
+    "CanIf": "CanIf_TransmitBatch",
+    "SoAd": "SoAd_IfTransmitBatch",
+}
+
+#: Header declaring the interface of a module; the other modules are declared in pdur_cfg.c
+MODULE_HEADERS = {
+    "Com": "com_stack.h",
+    "CanTp": "can_tp.h",
+}
+
+#: (module, container, PDU reference, handle parameter, direction / user filter) per role
+SOURCE_ROLES = [
+    ("Com", "ComIPdu", "ComPduIdRef", "ComIPduHandleId", ("ComIPduDirection", "SEND")),
+    ("CanIf", "CanIfRxPduCfg", "CanIfRxPduRef", "CanIfRxPduId", ("CanIfRxPduUserRxIndicationUL", "PDUR")),
+    ("SoAd", "SoAdSocketRouteDest", "SoAdRxPduRef", "SoAdRxPduId", None),
+    ("Dcm", "DcmDslProtocolTx", "DcmDslProtocolTxPduRef", "DcmDslTxConfirmationPduId", None),
+    ("CanTp", "CanTpRxNSdu", "CanTpRxNSduRef", "CanTpRxNSduId", None),
+]
+DEST_ROLES = [
+    ("Com", "ComIPdu", "ComPduIdRef", "ComIPduHandleId", ("ComIPduDirection", "RECEIVE")),
+    ("CanIf", "CanIfTxPduCfg", "CanIfTxPduRef", "CanIfTxPduId", ("CanIfTxPduUserTxConfirmationUL", "PDUR")),
+    ("SoAd", "SoAdPduRoute", "SoAdTxPduRef", "SoAdTxPduId", None),
+    ("EthComm", "EthCommAcfCanPdu", "EthCommAcfCanPduRef", "EthCommAcfCanPduId", None),
+    ("Dcm", "DcmDslProtocolRx", "DcmDslProtocolRxPduRef", "DcmDslProtocolRxPduId", None),
+    ("CanTp", "CanTpTxNSdu", "CanTpTxNSduRef", "CanTpTxNSduId", None),
+]
+
+#: Limits of the generated tables (PduR_RoutingPathType / PduR_DestType)
+MAX_HANDLE = 0xFFFE
+MAX_FAN_OUT = 0xFF
+MAX_TX_CONTROLLERS = 0xFE               # 0xFF is PDUR_NO_TX_CONTROLLER
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class BswModule:
+    def __init__(self, name, index, upper, tp, trigger_transmit, tx_confirmation):
+        self.name = name
+        self.index = index
+        self.upper = upper
+        self.tp = tp
+        self.trigger_transmit = trigger_transmit
+        self.tx_confirmation = tx_confirmation
+
+    def functions(self):
+        """Members of PduR_BswModuleType in declaration order, None if not used"""
+        if not self.upper:
+            return ((LOWER_TRANSMIT.get(self.name, "%s_Transmit" % self.name),
+                     None if self.tp else LOWER_TRANSMIT_BATCH.get(self.name)) + (None,) * 8)
+        if self.tp:
+            return (None,) * 5 + tuple("%s_%s" % (self.name, service) for service in
+                                       ("StartOfReception", "CopyRxData", "TpRxIndication",
+                                        "CopyTxData", "TpTxConfirmation"))
+        return (None, None, "%s_RxIndication" % self.name,
+                "%s_TriggerTransmit" % self.name if self.trigger_transmit else None,
+                "%s_TxConfirmation" % self.name if self.tx_confirmation else None) + (None,) * 5
+
+
+class TxBuffer:
+    def __init__(self, name, max_length):
+        self.name = name
+        self.max_length = max_length
+        self.index = None
+        self.path = None
+
+
+class TxController:
+    def __init__(self, name, module, controller_id):
+        self.name = name
+        self.module = module
+        self.controller_id = controller_id
+        self.index = None
+        self.dests = 0
+
+
+class Dest:
+    def __init__(self, name, handle, pdu, trigger_transmit):
+        self.name = name
+        self.handle = handle
+        self.pdu = pdu
+        self.trigger_transmit = trigger_transmit
+        self.module = None
+        self.module_pdu = None
+        self.path = None
+        self.buffer = None
+        self.controller = None
+
+
+class RoutingPath:
+    def __init__(self, name, handle, pdu, length):
+        self.name = name
+        self.handle = handle
+        self.pdu = pdu
+        self.length = length
+        self.module = None
+        self.module_pdu = None
+        self.dests = []
+        self.buffer = None
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.modules = []
+        self.paths = []
+        self.dests = []
+        self.buffers = []
+        self.controllers = []
+
+    def build(self):
+        self.modules = self.bsw_modules()
+        by_name = dict((m.name, m) for m in self.modules)
+        sources = self.owners(SOURCE_ROLES, by_name)
+        targets = self.owners(DEST_ROLES, by_name)
+
+        buffers = {}
+        for elem in self.x.containers("PduRTxBuffer"):
+            p = parameters(elem)
+            if int(p.get("PduRTxBufferDepth", "1")) != 1:
+                raise GeneratorError("PduRTxBuffer %s: only PduRTxBufferDepth 1 is supported" %
+                                     child_text(elem, "SHORT-NAME"))
+            buffers[self.x.path_of[elem]] = TxBuffer(child_text(elem, "SHORT-NAME"), int(p["PduRPduMaxLength"]))
+
+        paths, dests, used = [], [], set()
+        for elem in self.x.containers("PduRRoutingPath"):
+            name = child_text(elem, "SHORT-NAME")
+            srcs = sub_containers(elem, "PduRSrcPdu")
+            if len(srcs) != 1:
+                raise GeneratorError("routing path %s: exactly one PduRSrcPdu required" % name)
+            src = srcs[0]
+            pdu = self.pdu_ref(src, "PduRSrcPduRef", name)
+            if pdu not in sources:
+                raise GeneratorError("routing path %s: source PDU %s has no source module" % (name, pdu))
+            if ("src", pdu) in used:
+                raise GeneratorError("routing path %s: source PDU %s is routed twice" % (name, pdu))
+            used.add(("src", pdu))
+            path = RoutingPath(child_text(src, "SHORT-NAME"), int(parameters(src)["PduRSourcePduHandleId"]),
+                               pdu, self.pdu_length(pdu))
+            path.module, path.module_pdu = sources[pdu]
+            for d in sub_containers(elem, "PduRDestPdu"):
+                p = parameters(d)
+                dpdu = self.pdu_ref(d, "PduRDestPduRef", name)
+                if dpdu not in targets:
+                    raise GeneratorError("routing path %s: destination PDU %s has no destination module" %
+                                         (name, dpdu))
+                if ("dest", dpdu) in used:
+                    raise GeneratorError("routing path %s: destination PDU %s is routed twice" % (name, dpdu))
+                used.add(("dest", dpdu))
+                provision = p.get("PduRDestPduDataProvision", "PDUR_DIRECT")
+                if provision not in ("PDUR_DIRECT", "PDUR_TRIGGERTRANSMIT"):
+                    raise GeneratorError("destination %s: unsupported PduRDestPduDataProvision %s" %
+                                         (child_text(d, "SHORT-NAME"), provision))
+                dest = Dest(child_text(d, "SHORT-NAME"), int(p["PduRDestPduHandleId"]), dpdu,
+                            provision == "PDUR_TRIGGERTRANSMIT")
+                dest.module, dest.module_pdu = targets[dpdu]
+                dest.path = path
+                if dest.trigger_transmit and dest.module.upper:
+                    raise GeneratorError("destination %s: PDUR_TRIGGERTRANSMIT towards upper module %s" %
+                                         (dest.name, dest.module.name))
+                if dest.trigger_transmit and not dest.module.trigger_transmit:
+                    raise GeneratorError("destination %s: PDUR_TRIGGERTRANSMIT towards %s without "
+                                         "PduRTriggertransmit" % (dest.name, dest.module.name))
+                for ref in references(d, "PduRDestTxBufferRef"):
+                    buffer = buffers.get(ref)
+                    if buffer is None:
+                        raise GeneratorError("destination %s: %s is not a PduRTxBuffer" % (dest.name, ref))
+                    if not dest.trigger_transmit or path.module.upper:
+                        raise GeneratorError("destination %s: a PduRTxBuffer is only used by the "
+                                             "PDUR_TRIGGERTRANSMIT destinations of a gateway path" % dest.name)
+                    if path.buffer not in (None, buffer):
+                        raise GeneratorError("routing path %s: its destinations must share one PduRTxBuffer" % name)
+                    path.buffer = dest.buffer = buffer
+                path.dests.append(dest)
+                dests.append(dest)
+            if not path.dests:
+                raise GeneratorError("routing path %s has no PduRDestPdu" % name)
+            self.check_tp(path)
+            if len(path.dests) > MAX_FAN_OUT:
+                raise GeneratorError("routing path %s: more than %d destinations" % (name, MAX_FAN_OUT))
+            self.check_buffer(path)
+            paths.append(path)
+
+        self.paths = dense(paths, "PduRSourcePduHandleId", MAX_HANDLE)
+        self.dests = dense(dests, "PduRDestPduHandleId", MAX_HANDLE)
+        for path in self.paths:
+            handles = sorted(d.handle for d in path.dests)
+            if handles != list(range(handles[0], handles[0] + len(handles))):
+                raise GeneratorError("routing path %s: destination handles must be consecutive" % path.name)
+            path.dests.sort(key=lambda d: d.handle)
+        for buffer in buffers.values():
+            if buffer not in [p.buffer for p in self.paths]:
+                raise GeneratorError("PduRTxBuffer %s is not used by a routing path" % buffer.name)
+        self.buffers = [p.buffer for p in self.paths if p.buffer is not None]
+        if len(set(self.buffers)) != len(self.buffers):
+            raise GeneratorError("a PduRTxBuffer is shared by several routing paths")
+        for index, buffer in enumerate(self.buffers):
+            buffer.index = index
+        for path in self.paths:
+            if path.buffer is not None:
+                path.buffer.path = path
+        self.controllers = self.tx_controllers()
+
+    def bsw_modules(self):
+        modules = []
+        for elem in self.x.containers("PduRBswModules"):
+            p = parameters(elem)
+            refs = references(elem, "PduRBswModuleRef")
+            if len(refs) != 1:
+                raise GeneratorError("PduRBswModules %s: exactly one PduRBswModuleRef required" %
+                                     child_text(elem, "SHORT-NAME"))
+            name = last_name(refs[0])
+            tp = parse_bool(p.get("PduRTransportProtocol", "false"))
+            if parse_bool(p.get("PduRCommunicationInterface", "false")) == tp:
+                raise GeneratorError("PduRBswModules %s: exactly one of PduRCommunicationInterface / "
+                                     "PduRTransportProtocol" % name)
+            if parse_bool(p.get("PduRUpperModule", "false")) == parse_bool(p.get("PduRLowerModule", "false")):
+                raise GeneratorError("PduRBswModules %s: exactly one of PduRUpperModule / PduRLowerModule" % name)
+            modules.append(BswModule(name, len(modules), parse_bool(p["PduRUpperModule"]), tp,
+                                     parse_bool(p.get("PduRTriggertransmit", "false")),
+                                     parse_bool(p.get("PduRTxConfirmation", "false"))))
+        if not modules:
+            raise GeneratorError("no PduRBswModules")
+        return modules
+
+    def tx_controllers(self):
+        """Controllers of the lower interface destinations, ordered by module and controller ID"""
+        controllers = {}
+        for dest in self.dests:
+            if dest.module.upper or dest.module.tp:
+                continue
+            if dest.module.name == "CanIf":
+                name, controller_id = self.canif_controller(dest)
+            else:
+                name, controller_id = dest.module.name, 0
+            key = (dest.module.index, controller_id)
+            if key not in controllers:
+                controllers[key] = TxController(name, dest.module, controller_id)
+            dest.controller = controllers[key]
+            dest.controller.dests += 1
+        result = [controllers[key] for key in sorted(controllers)]
+        if len(result) > MAX_TX_CONTROLLERS:
+            raise GeneratorError("more than %d transmit controllers" % MAX_TX_CONTROLLERS)
+        for index, controller in enumerate(result):
+            controller.index = index
+        return result
+
+    def canif_controller(self, dest):
+        """(CanIfCtrlCfg name, CanIfCtrlId) sending a CanIf destination"""
+        for elem in self.x.containers("CanIfTxPduCfg"):
+            if dest.pdu in references(elem, "CanIfTxPduRef"):
+                buffer = self.follow(elem, "CanIfTxPduBufferRef", dest.name)
+                hth = self.follow(buffer, "CanIfBufferHthRef", dest.name)
+                ctrl = self.follow(hth, "CanIfHthCanCtrlIdRef", dest.name)
+                return child_text(ctrl, "SHORT-NAME"), int(parameters(ctrl)["CanIfCtrlId"])
+        raise GeneratorError("destination %s: no CanIfTxPduCfg" % dest.name)
+
+    def follow(self, container, name, what):
+        refs = references(container, name)
+        if len(refs) != 1:
+            raise GeneratorError("destination %s: exactly one %s required in %s" %
+                                 (what, name, child_text(container, "SHORT-NAME")))
+        return self.x.resolve(refs[0])
+
+    def owners(self, roles, modules):
+        """{EcuC PDU path: (module, handle of the PDU in the module)} for the modules of PduRBswModules"""
+        owners = {}
+        for module, container, ref_name, handle, direction in roles:
+            if module not in modules:
+                continue
+            for elem in self.x.containers(container):
+                p = parameters(elem)
+                if direction is not None and p.get(direction[0]) != direction[1]:
+                    continue
+                for ref in references(elem, ref_name):
+                    self.x.resolve(ref)
+                    if ref in owners:
+                        raise GeneratorError("PDU %s is used by %s and %s in the same direction" %
+                                             (ref, owners[ref][0].name, module))
+                    owners[ref] = (modules[module], int(p[handle]))
+        return owners
+
+    def pdu_ref(self, container, name, path):
+        refs = references(container, name)
+        if len(refs) != 1:
+            raise GeneratorError("routing path %s: exactly one %s required" % (path, name))
+        self.x.resolve(refs[0])
+        return refs[0]
+
+    def pdu_length(self, pdu):
+        return int(parameters(self.x.resolve(pdu))["PduLength"])
+
+    @staticmethod
+    def check_tp(path):
+        if [d for d in path.dests if d.module.tp != path.module.tp]:
+            raise GeneratorError("routing path %s: mixes interface and transport protocol modules" % path.name)
+        if not path.module.tp:
+            return
+        dest = path.dests[0]
+        if len(path.dests) != 1 or dest.trigger_transmit or dest.buffer is not None:
+            raise GeneratorError("routing path %s: a TP path has one PDUR_DIRECT destination without "
+                                 "PduRTxBuffer" % path.name)
+        if dest.module.upper == path.module.upper:
+            raise GeneratorError("routing path %s: a TP path connects an upper and a lower module" % path.name)
+
+    @staticmethod
+    def check_buffer(path):
+        gateway_tt = [d for d in path.dests if d.trigger_transmit] and not path.module.upper
+        if gateway_tt and path.buffer is None:
+            raise GeneratorError("routing path %s: PDUR_TRIGGERTRANSMIT destinations of a gateway path "
+                                 "need a PduRTxBuffer" % path.name)
+        if path.buffer is not None:
+            if [d for d in path.dests if d.trigger_transmit and d.buffer is None]:
+                raise GeneratorError("routing path %s: every PDUR_TRIGGERTRANSMIT destination must use "
+                                     "the PduRTxBuffer" % path.name)
+            if path.buffer.max_length < path.length:
+                raise GeneratorError("PduRTxBuffer %s: PduRPduMaxLength %d below the PduLength %d of %s" %
+                                     (path.buffer.name, path.buffer.max_length, path.length, path.name))
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_routes(self):
+        counts = {}
+        for dest in self.m.dests:
+            key = (dest.path.module.name, dest.module.name, dest.trigger_transmit)
+            counts[key] = counts.get(key, 0) + 1
+        rows = ["| Source | Destination | Data provision       | Destinations |",
+                "|--------|-------------|----------------------|--------------|"]
+        for (src, dst, tt), count in sorted(counts.items()):
+            rows.append("| %-6s | %-11s | %-20s | %-12d |" %
+                        (src, dst, "PDUR_TRIGGERTRANSMIT" if tt else "PDUR_DIRECT", count))
+        fan_out = {}
+        for path in self.m.paths:
+            fan_out[len(path.dests)] = fan_out.get(len(path.dests), 0) + 1
+        rows += ["",
+                 "Routing paths by number of destinations: %s." %
+                 ", ".join("%d x %d" % (fan_out[n], n) for n in sorted(fan_out)),
+                 "",
+                 "Transmit controllers (PduR_ComTransmitBatch() groups):",
+                 "",
+                 "| Controller | Module  | Destinations |",
+                 "|------------|---------|--------------|"]
+        rows += ["| %-10s | %-7s | %-12d |" % (c.name, c.module.name, c.dests) for c in self.m.controllers]
+        return rows
+
+    # -- pdur_cfg.h ------------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Handles of the routing paths and destination PDUs of the VCU PduR",
+                   "configuration (%d routing paths, %d destinations, %d transmit buffers):" %
+                   (len(m.paths), len(m.dests), len(m.buffers)),
+                   ""]
+        details += self.doc_routes()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "pdur_cfg.h",
+                              "PduR Configuration - Routing Path and Destination Handles", details),
+               "#ifndef PDUR_CFG_H",
+               "#define PDUR_CFG_H",
+               "",
+               banner("h", "INCLUDE FILES"),
+               '#include "comstack_types.h"',
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("PDUR_BSW_MODULE_COUNT", "%dU" % len(m.modules)),
+               define("PDUR_ROUTING_PATH_COUNT", "%dU" % len(m.paths)),
+               define("PDUR_DEST_PDU_COUNT", "%dU" % len(m.dests)),
+               define("PDUR_TX_BUFFER_COUNT", "%dU" % len(m.buffers)),
+               define("PDUR_TX_CONTROLLER_COUNT", "%dU" % len(m.controllers)),
+               define("PDUR_MAX_FAN_OUT", "%dU" % max(len(p.dests) for p in m.paths)),
+               define("PDUR_MAX_TX_BUFFER_LENGTH", "%dU" % max([b.max_length for b in m.buffers] + [0])),
+               "",
+               banner("h", "BSW MODULES")]
+        for module in m.modules:
+            out.append(define("PduRConf_PduRBswModule_%s" % module.name, "%dU" % module.index))
+        out += ["", banner("h", "TRANSMIT CONTROLLERS")]
+        for controller in m.controllers:
+            out.append(define("PduRConf_PduRTxController_%s" % controller.name, "%dU" % controller.index))
+        out += ["", banner("h", "SOURCE PDU HANDLES (PduR_<Module>RxIndication / PduR_<Module>Transmit)")]
+        for path in m.paths:
+            out.append(define("PduRConf_PduRSrcPdu_%s" % path.name, "%dU" % path.handle))
+        out += ["", banner("h", "DESTINATION PDU HANDLES (PduR_<Module>TriggerTransmit / TxConfirmation)")]
+        for dest in m.dests:
+            out.append(define("PduRConf_PduRDestPdu_%s" % dest.name, "%dU" % dest.handle))
+        out += ["",
+                "#endif /* PDUR_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- pdur_cfg.c ------------------------------------------------------------------------------
+
+    def declarations(self):
+        out = []
+        for module in self.m.modules:
+            if module.name in MODULE_HEADERS:
+                continue
+            (transmit, transmit_batch, rx_indication, trigger_transmit, tx_confirmation, start_of_reception,
+             copy_rx_data, tp_rx_indication, copy_tx_data, tp_tx_confirmation) = module.functions()
+            if transmit:
+                out += ["extern Std_ReturnType %s(PduIdType TxPduId," % transmit,
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);"]
+            if transmit_batch:
+                out += ["extern Std_ReturnType %s(uint8 Controller," % transmit_batch,
+                        "    P2CONST(PduIdType, AUTOMATIC, PDUR_APPL_DATA) TxPduIds,",
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfos, uint16 Count);"]
+            if rx_indication:
+                out += ["extern void %s(PduIdType RxPduId," % rx_indication,
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);"]
+            if trigger_transmit:
+                out += ["extern Std_ReturnType %s(PduIdType TxPduId," % trigger_transmit,
+                        "    P2VAR(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) PduInfoPtr);"]
+            if tx_confirmation:
+                out.append("extern void %s(PduIdType TxPduId, Std_ReturnType result);" % tx_confirmation)
+            if start_of_reception:
+                out += ["extern BufReq_ReturnType %s(PduIdType id," % start_of_reception,
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info, PduLengthType TpSduLength,",
+                        "    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);",
+                        "extern BufReq_ReturnType %s(PduIdType id," % copy_rx_data,
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,",
+                        "    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) bufferSizePtr);",
+                        "extern void %s(PduIdType id, Std_ReturnType result);" % tp_rx_indication,
+                        "extern BufReq_ReturnType %s(PduIdType id," % copy_tx_data,
+                        "    P2CONST(PduInfoType, AUTOMATIC, PDUR_APPL_DATA) info,",
+                        "    P2CONST(RetryInfoType, AUTOMATIC, PDUR_APPL_DATA) retry,",
+                        "    P2VAR(PduLengthType, AUTOMATIC, PDUR_APPL_DATA) availableDataPtr);",
+                        "extern void %s(PduIdType id, Std_ReturnType result);" % tp_tx_confirmation]
+        return out
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "pdur_cfg.c",
+                              "PduR Configuration - Routing Tables",
+                              ["Static PduR configuration of the VCU: module interfaces, transmit",
+                               "buffer lengths of the gateway paths, routing table and destination table."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "pdu_router.h"']
+        out += ['#include "%s"' % MODULE_HEADERS[mod.name] for mod in m.modules if mod.name in MODULE_HEADERS]
+        out.append("")
+        declarations = self.declarations()
+        if declarations:
+            out += [banner("c", "MODULE INTERFACES")] + declarations + [""]
+        out += [banner("c", "GLOBAL CONSTANTS"),
+                "const PduR_BswModuleType PduR_BswModule[PDUR_BSW_MODULE_COUNT] =",
+                "{"]
+        for module in m.modules:
+            functions = [f if f else "NULL_PTR" for f in module.functions()]
+            out += ["    {   /* %s */" % module.name,
+                    "        %s," % ", ".join(functions[:5]),
+                    "        %s" % ", ".join(functions[5:]),
+                    "    }" if module is m.modules[-1] else "    },"]
+        out += ["};", ""]
+
+        if m.buffers:
+            out += ["const PduR_TxBufferType PduR_TxBuffer[PDUR_TX_BUFFER_COUNT] =", "{"]
+            rows = ["    { %dU }   /* %s */" % (b.max_length, b.name)
+                    for b in m.buffers]
+            out += [join_rows(rows), "};", ""]
+
+        module_width = len("PduRConf_PduRBswModule_,") + max(len(mod.name) for mod in m.modules)
+        out += ["const PduR_RoutingPathType PduR_RoutingPath[PDUR_ROUTING_PATH_COUNT] =", "{"]
+        rows = []
+        for path in m.paths:
+            rows.append("    { %s %s %s %s %s }   /* %s */" %
+                        (("%dU," % path.dests[0].handle).ljust(6), ("%dU," % path.module_pdu).ljust(6),
+                         ("PduRConf_PduRBswModule_%s," % path.module.name).ljust(module_width),
+                         ("%dU," % len(path.dests)).ljust(4),
+                         "PDUR_NO_TX_BUFFER" if path.buffer is None else "%dU" % path.buffer.index, path.name))
+        out += [join_rows(rows), "};", ""]
+
+        if m.controllers:
+            out += ["const PduR_TxControllerType PduR_TxController[PDUR_TX_CONTROLLER_COUNT] =", "{"]
+            rows = ["    { %s %dU }   /* %s */" %
+                    (("PduRConf_PduRBswModule_%s," % c.module.name).ljust(module_width), c.controller_id, c.name)
+                    for c in m.controllers]
+            out += [join_rows(rows), "};", ""]
+
+        controller_width = max([len("PDUR_NO_TX_CONTROLLER")] +
+                               [len("PduRConf_PduRTxController_") + len(c.name) for c in m.controllers])
+        out += ["const PduR_DestType PduR_DestPdu[PDUR_DEST_PDU_COUNT] =", "{"]
+        rows = []
+        for dest in m.dests:
+            rows.append("    { %s %s %s %s %s }   /* %s */" %
+                        (("%dU," % dest.module_pdu).ljust(6), ("%dU," % dest.path.handle).ljust(6),
+                         ("PduRConf_PduRBswModule_%s," % dest.module.name).ljust(module_width),
+                         ("(uint8)PDUR_TRIGGERTRANSMIT," if dest.trigger_transmit else "(uint8)PDUR_DIRECT,").ljust(28),
+                         ("PDUR_NO_TX_CONTROLLER" if dest.controller is None else
+                          "PduRConf_PduRTxController_%s" % dest.controller.name).ljust(controller_width),
+                         dest.name))
+        out += [join_rows(rows), "};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/bsw/com", help="output directory of pdur_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"pdur_cfg.h": emitter.emit_header(), "pdur_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("pdur_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("pdur_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,1664 @@
+#!/usr/bin/env python3
+"""
+RTE generator - ARXML system description to RTE configuration (rte_cfg.h / rte_cfg.c)
+
+Reads the software components, sender/receiver interfaces, the composition
+(assembly connectors) and the Os/Rte ECUC values from one or more ARXML
+files and emits the static RTE configuration consumed by src/rte/rte.c:
+
+- Implicit communication (DATA-READ-ACCESS / DATA-WRITE-ACCESS): one signal
+  group per provided port, global and task-local buffers, the per-task copy
+  plan with lock flags from the task priorities, Rte_IRead/Rte_IWrite macros
+- Explicit communication (DATA-SEND-POINT / DATA-RECEIVE-POINT-BY-ARGUMENT):
+  * scalars (<= 32 bit) whose sender and receivers share a core: Rte_Write /
+    Rte_Read macros that compile to a plain store / load of the signal
+    variable (aligned 32-bit accesses are single-copy atomic on Cortex-M)
+  * scalars with receivers on another core: static connection table entry,
+    accessed through Rte_Connection_Write()/Rte_Connection_Read() with
+    memory barriers, signal placed in RTE_SHARED_SECTION
+  * structures and arrays: sequence-lock port (Rte_Seqlock_Write/Read)
+  * signals of the ports listed in ECUC RteReplication: the readers on the
+    other core read a local replica (Rte_Lockstep_Read), filled once per
+    cycle from one CRC-protected batch per pair of cores (rte_lockstep.c);
+    the writer's Rte_Write marks the signal dirty. The writer side stays a
+    direct variable or a sequence-lock port outside the shared memory
+- Queued communication (SW-IMPL-POLICY QUEUED, QUEUED-RECEIVER-COM-SPEC):
+  one ring buffer per receiver port with the configured QUEUE-LENGTH,
+  Rte_Send / Rte_Receive / Rte_ReceiveN macros. Queues whose senders run in
+  more than one task are generated as multi-producer queues
+- Event-triggered runnables (DATA-RECEIVED-EVENT / DATA-RECEIVE-ERROR-EVENT
+  on queued data elements): event and runnable tables for rte_scheduler.c,
+  the events raised by each queue, Rte_Events_* take macros and the
+  RTE_MASK_* pending-event bits. Their tasks are activated by the RTE and
+  must not run time-triggered runnables
+- Recorder (ECUC RteRecorder): channel table of the recorded implicit
+  signal groups for rte_recorder.c; the recording task counts as a reader
+  of every recorded group for the lock flags of the copy plan
+- Error routing (ECUC RteErrorRoute): DET and DEM event of every RTE
+  runtime error, as a table indexed by the error code for rte_error.c.
+  Errors without a route are reported to the DET only
+- Timing chains (ECUC RteTimingChain): cause-effect chains of implicit
+  signal groups in data-flow order, traced by rte_trace.c. Every group
+  after the first must be written by a task that reads the previous one
+- Layout: structure members and signal group elements are ordered by
+  decreasing alignment, so they carry no inner padding. Group elements are
+  first ordered by the priorities of the tasks reading them, so the fill
+  range of each reader is short and the highest-priority reader's starts
+  at offset 0. Global and task-local buffers are one cache-line aligned
+  block each (Rte_Global, Rte_<task>), the global one with the groups of
+  the highest-priority copying task first. Element names do not change
+- Compile-time checks: STATIC_ASSERT on every generated type size and
+  member offset, and on the hot groups fitting one cache line, so a
+  hand-edited type or a compiler with a different layout breaks the build
+  instead of the copy plan
+
+"Same core" is decided per OS application (OsApplicationCoreRef): tasks of
+different applications are treated as running on different cores, which
+keeps the output valid for lockstep parts (one core) and split-lock parts.
+
+Usage:
+    python3 tools/rte/rte_generator.py config/autosar/system/rte.arxml -o src/rte
+    python3 tools/rte/rte_generator.py config/autosar/system/rte.arxml -o src/rte --check
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+import zlib
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, header_comment, join_rows, last_name)
+
+GENERATOR_VERSION = "1.7.0"
+
+#: Platform types: name -> (size, alignment)
+BASE_TYPES = {
+    "boolean": (1, 1),
+    "uint8": (1, 1),
+    "sint8": (1, 1),
+    "uint16": (2, 2),
+    "sint16": (2, 2),
+    "uint32": (4, 4),
+    "sint32": (4, 4),
+    "float32": (4, 4),
+}
+
+#: Largest explicit signal accessed without a sequence lock (bytes)
+ATOMIC_MAX_SIZE = 4
+
+#: Supported RTE events: tag -> kind ("timing", "received", "error")
+EVENT_KINDS = {
+    "TIMING-EVENT": "timing",
+    "DATA-RECEIVED-EVENT": "received",
+    "DATA-RECEIVE-ERROR-EVENT": "error",
+}
+
+#: Events per event-triggered runnable (bits of the pending set)
+MAX_RUNNABLE_EVENTS = 32
+
+#: Replicated signals per replication channel (bits of the dirty set)
+MAX_CHANNEL_REPLICAS = 32
+
+#: Header of a replication batch in bytes (sequence, mask, CRC)
+REPLICATION_HEADER_SIZE = 12
+
+#: Smallest D-cache line of the supported cores in bytes; hot groups up to
+#: this size are checked against RTE_CACHE_LINE_SIZE to share one line
+HOT_LINE_SIZE = 32
+
+
+# Limit of the hop mask per task in rte_trace.c
+MAX_TRACE_HOPS = 32
+
+# RTE runtime errors of rte.h, in code order from RTE_E_DET_RUNTIME_FIRST; the
+# routing table is indexed by code - first
+RUNTIME_ERROR_FIRST = 0x10
+RUNTIME_ERRORS = ["RTE_E_DET_SEQLOCK_RETRY", "RTE_E_DET_RECORDER_BUDGET", "RTE_E_DET_EVENT_ACTIVATION",
+                  "RTE_E_DET_REPLICA_CRC", "RTE_E_DET_QUEUE_OVERFLOW"]
+
+
+# ------------------------------------------------------------------------------------------------
+# ARXML access
+# ------------------------------------------------------------------------------------------------
+
+def _snake_upper(name):
+    name = re.sub(r"([a-z0-9])([A-Z])", r"\1_\2", name)
+    return name.upper()
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class DataType:
+    """Implementation data type with its C layout"""
+
+    def __init__(self, name, kind, size, align, base=None, length=None, members=None):
+        self.name = name
+        self.kind = kind                # "value", "array", "struct"
+        self.size = size
+        self.align = align
+        self.base = base                # array element type
+        self.length = length            # array length
+        self.members = members or []    # struct: [(name, DataType, offset)]
+        self.declared_size = size       # struct: size in declaration order
+
+    @property
+    def ctype(self):
+        if self.kind == "value":
+            return self.name
+        if self.kind == "array":
+            return self.base.ctype
+        return "Rte_%s" % self.name
+
+    def declarator(self, name):
+        if self.kind == "array":
+            return "%s[%d]" % (name, self.length)
+        return name
+
+
+def layout(members):
+    """Natural C layout: [(name, DataType)] -> ([(name, DataType, offset)], size, align)"""
+    offset = 0
+    align = 1
+    placed = []
+    for name, dtype in members:
+        offset = (offset + dtype.align - 1) // dtype.align * dtype.align
+        placed.append((name, dtype, offset))
+        offset += dtype.size
+        align = max(align, dtype.align)
+    size = (offset + align - 1) // align * align
+    return placed, size, align
+
+
+def packed_layout(members, rank=lambda name: 0):
+    """Optimised layout: members by rank (hot first), then by decreasing alignment.
+
+    Power-of-two alignments in decreasing order leave no padding inside a
+    rank; members of equal rank and alignment keep their declaration order.
+    """
+    return layout(sorted(members, key=lambda member: (rank(member[0]), -member[1].align)))
+
+
+class Task:
+    def __init__(self, name, index, priority):
+        self.name = name
+        self.index = index
+        self.priority = priority
+        self.core = None
+        self.runnables = []             # [(position, Runnable)]
+
+    @property
+    def cname(self):
+        return self.name.replace("_", "")
+
+    @property
+    def macro(self):
+        return "OS_TASK_" + _snake_upper(self.name[len("Task_"):] if self.name.startswith("Task_") else self.name)
+
+
+class Runnable:
+    def __init__(self, swc, name, symbol):
+        self.swc = swc
+        self.name = name
+        self.symbol = symbol
+        self.accesses = {"IRead": [], "IWrite": [], "Send": [], "Receive": []}
+        self.task = None
+        self.timed = False              # started by a TIMING-EVENT
+        self.data_events = []           # [DataEvent], bit i of the pending set = data_events[i]
+
+
+class DataEvent:
+    """DATA-RECEIVED-EVENT or DATA-RECEIVE-ERROR-EVENT of a receiver port"""
+
+    def __init__(self, swc, name, kind, port, element, runnable):
+        self.swc = swc
+        self.name = name
+        self.kind = kind                # "received", "error"
+        self.port = port
+        self.element = element
+        self.runnable = runnable
+        self.index = None
+
+
+class Group:
+    """Data elements of one provided port"""
+
+    def __init__(self, swc, port, interface):
+        self.swc = swc
+        self.port = port
+        self.interface = interface      # [(element, DataType)]
+        self.name = port
+        self.implicit = []              # element names written implicitly
+        self.explicit = []              # element names sent explicitly
+        self.writer_task = None
+        self.readers = {}               # element -> set of (Runnable, access kind)
+        self.placed = []
+        self.size = 0
+        self.align = 1
+        self.declared_size = 0          # size in declaration order
+
+    def element_type(self, element):
+        for name, dtype in self.interface:
+            if name == element:
+                return dtype
+        raise GeneratorError("%s.%s: no data element %s" % (self.swc, self.port, element))
+
+
+class Queue:
+    """Receive queue of one queued data element of a receiver port"""
+
+    def __init__(self, swc, port, element, dtype, length):
+        self.swc = swc
+        self.port = port
+        self.element = element
+        self.dtype = dtype
+        self.length = length
+        self.name = "%s_%s_%s" % (swc, port, element)
+        self.consumer_task = None
+        self.senders = []               # groups of the connected provided ports
+        self.events = {}                # kind -> DataEvent raised by the queue
+
+    @property
+    def producer_tasks(self):
+        return sorted(set(g.writer_task for g in self.senders), key=lambda task: task.index)
+
+    @property
+    def multi_producer(self):
+        return len(self.producer_tasks) > 1
+
+    @property
+    def shared(self):
+        return any(task.core != self.consumer_task.core for task in self.producer_tasks)
+
+
+class Replica:
+    """Explicit signal copied to the core of its remote readers"""
+
+    def __init__(self, group, element, dtype, channel):
+        self.group = group
+        self.element = element
+        self.dtype = dtype
+        self.channel = channel
+        self.index = None
+
+    @property
+    def words(self):
+        return (self.dtype.size + 3) // 4
+
+
+class Channel:
+    """Replication channel from the writer core to the reader core"""
+
+    def __init__(self, source, target):
+        self.source = source            # core macro, e.g. OS_CORE_SAFETY
+        self.target = target
+        self.replicas = []              # [Replica], bit i of the dirty set = replicas[i]
+
+    @property
+    def name(self):
+        return "".join(part.capitalize() for core in (self.source, self.target)
+                       for part in core[len("OS_CORE_"):].split("_"))
+
+    @property
+    def batch_words(self):
+        return REPLICATION_HEADER_SIZE // 4 + sum(r.words for r in self.replicas)
+
+
+class TraceChain:
+    """Cause-effect chain of implicit signal groups"""
+
+    def __init__(self, name, budget_us):
+        self.name = name
+        self.budget_us = budget_us
+        self.hops = []                  # [TraceHop] in data-flow order
+
+
+class TraceHop:
+    """Signal group of a timing chain"""
+
+    def __init__(self, chain, group, index, input_hop):
+        self.chain = chain
+        self.group = group
+        self.index = index
+        self.input = input_hop          # TraceHop read by the writer, None for the first hop
+
+
+class Model:
+    def __init__(self, arxml):
+        self.arxml = arxml
+        self.types = {}
+        self.interfaces = {}
+        self.queued = set()             # (interface, element) with SW-IMPL-POLICY QUEUED
+        self.queue_lengths = {}         # (swc, port, element) -> QUEUE-LENGTH
+        self.swc_ports = {}             # (swc type, port) -> (direction, interface name)
+        self.runnables = {}             # (swc, runnable) -> Runnable
+        self.events = {}                # event path -> Runnable
+        self.data_events = []           # [DataEvent] in event ID order
+        self.event_runnables = []       # [Runnable] with data events, in runnable ID order
+        self.connections = {}           # (req swc, req port) -> [(prov swc, prov port)]
+        self.tasks = []
+        self.tasks_by_name = {}
+        self.groups = {}                # (swc, port) -> Group
+        self.queues = {}                # (swc, port, element) -> Queue
+        self.recorder_task = None
+        self.recorder_refs = []         # [((swc, port), replayed input)]
+        self.recorded = []              # [(Group, replayed input)] in channel order
+        self.replication_refs = []      # [(swc, port)]
+        self.replicas = {}              # (swc, port, element) -> Replica
+        self.channels = []              # [Channel] in channel ID order
+        self.dem_events = {}            # DemEventParameter name -> DemEventId
+        self.error_routes = {}          # RTE_E_DET_* -> (DET report, DEM event name or None)
+        self.timing_refs = []           # [(chain name, budget us, [(swc, port)])]
+        self.chains = []                # [TraceChain] in chain ID order
+        self.hops = []                  # [TraceHop] in hop ID order
+        self._load()
+
+    # -- loading ---------------------------------------------------------------------------------
+
+    def _load(self):
+        self._load_types()
+        for itf in self.arxml.iter("SENDER-RECEIVER-INTERFACE"):
+            elements = []
+            for proto in itf.iter("VARIABLE-DATA-PROTOTYPE"):
+                elements.append((child_text(proto, "SHORT-NAME"), self._type(child_text(proto, "TYPE-TREF"))))
+                if child_text(proto, ".//SW-IMPL-POLICY", "STANDARD") == "QUEUED":
+                    self.queued.add((child_text(itf, "SHORT-NAME"), child_text(proto, "SHORT-NAME")))
+            self.interfaces[child_text(itf, "SHORT-NAME")] = elements
+        self._load_components()
+        self._load_os()
+        self._load_dem()
+        self._load_rte()
+
+    def _type(self, ref):
+        name = last_name(ref)
+        if name not in self.types:
+            raise GeneratorError("unknown data type %s" % ref)
+        return self.types[name]
+
+    def _load_types(self):
+        pending = list(self.arxml.iter("IMPLEMENTATION-DATA-TYPE"))
+        while pending:
+            progress = False
+            for idt in list(pending):
+                name = child_text(idt, "SHORT-NAME")
+                category = child_text(idt, "CATEGORY")
+                subs = idt.findall("SUB-ELEMENTS/IMPLEMENTATION-DATA-TYPE-ELEMENT")
+                refs = [last_name(child_text(s, ".//IMPLEMENTATION-DATA-TYPE-REF")) for s in subs]
+                if any(r not in self.types for r in refs):
+                    continue
+                if category == "VALUE":
+                    if name not in BASE_TYPES:
+                        raise GeneratorError("VALUE type %s is not a platform type" % name)
+                    size, align = BASE_TYPES[name]
+                    self.types[name] = DataType(name, "value", size, align)
+                elif category == "ARRAY":
+                    if len(subs) != 1:
+                        raise GeneratorError("ARRAY type %s needs exactly one sub-element" % name)
+                    base = self.types[refs[0]]
+                    length = int(child_text(subs[0], "ARRAY-SIZE"))
+                    self.types[name] = DataType(name, "array", base.size * length, base.align,
+                                                base=base, length=length)
+                elif category == "STRUCTURE":
+                    members = [(child_text(s, "SHORT-NAME"), self.types[r]) for s, r in zip(subs, refs)]
+                    placed, size, align = packed_layout(members)
+                    dtype = DataType(name, "struct", size, align, members=placed)
+                    dtype.declared_size = layout(members)[1]
+                    self.types[name] = dtype
+                else:
+                    raise GeneratorError("unsupported category %s of %s" % (category, name))
+                pending.remove(idt)
+                progress = True
+            if not progress:
+                raise GeneratorError("unresolvable data types: %s" %
+                                     ", ".join(child_text(i, "SHORT-NAME") for i in pending))
+
+    def _load_components(self):
+        for swc in self.arxml.iter("APPLICATION-SW-COMPONENT-TYPE"):
+            swc_name = child_text(swc, "SHORT-NAME")
+            for port in swc.findall("PORTS/P-PORT-PROTOTYPE"):
+                self.swc_ports[(swc_name, child_text(port, "SHORT-NAME"))] = \
+                    ("P", last_name(child_text(port, "PROVIDED-INTERFACE-TREF")))
+            for port in swc.findall("PORTS/R-PORT-PROTOTYPE"):
+                self.swc_ports[(swc_name, child_text(port, "SHORT-NAME"))] = \
+                    ("R", last_name(child_text(port, "REQUIRED-INTERFACE-TREF")))
+                for spec in port.findall("REQUIRED-COM-SPECS/QUEUED-RECEIVER-COM-SPEC"):
+                    key = (swc_name, child_text(port, "SHORT-NAME"), last_name(child_text(spec, "DATA-ELEMENT-REF")))
+                    self.queue_lengths[key] = int(child_text(spec, "QUEUE-LENGTH"))
+            for behavior in swc.iter("SWC-INTERNAL-BEHAVIOR"):
+                behavior_name = child_text(behavior, "SHORT-NAME")
+                for entity in behavior.iter("RUNNABLE-ENTITY"):
+                    name = child_text(entity, "SHORT-NAME")
+                    run = Runnable(swc_name, name, child_text(entity, "SYMBOL", "%s_%s" % (swc_name, name)))
+                    for tag, kind in (("DATA-READ-ACCESSS", "IRead"), ("DATA-WRITE-ACCESSS", "IWrite"),
+                                      ("DATA-SEND-POINTS", "Send"),
+                                      ("DATA-RECEIVE-POINT-BY-ARGUMENTS", "Receive")):
+                        for access in entity.findall("%s/VARIABLE-ACCESS" % tag):
+                            port = last_name(child_text(access, ".//PORT-PROTOTYPE-REF"))
+                            element = last_name(child_text(access, ".//TARGET-DATA-PROTOTYPE-REF"))
+                            if (swc_name, port) not in self.swc_ports:
+                                raise GeneratorError("%s.%s: unknown port %s" % (swc_name, name, port))
+                            run.accesses[kind].append((port, element))
+                    self.runnables[(swc_name, name)] = run
+                for event in behavior.findall("EVENTS/*"):
+                    event_name = child_text(event, "SHORT-NAME")
+                    target = last_name(child_text(event, "START-ON-EVENT-REF"))
+                    if (swc_name, target) not in self.runnables:
+                        raise GeneratorError("%s: event %s starts unknown runnable %s" %
+                                             (behavior_name, event_name, target))
+                    if event.tag not in EVENT_KINDS:
+                        raise GeneratorError("%s: event %s: unsupported %s" % (behavior_name, event_name, event.tag))
+                    run = self.runnables[(swc_name, target)]
+                    kind = EVENT_KINDS[event.tag]
+                    if kind == "timing":
+                        run.timed = True
+                    else:
+                        port = last_name(child_text(event, "DATA-IREF/CONTEXT-R-PORT-REF"))
+                        if self.swc_ports.get((swc_name, port), ("P",))[0] != "R":
+                            raise GeneratorError("%s: event %s: %s is not a receiver port" %
+                                                 (behavior_name, event_name, port))
+                        element = last_name(child_text(event, "DATA-IREF/TARGET-DATA-ELEMENT-REF"))
+                        run.data_events.append(DataEvent(swc_name, event_name, kind, port, element, run))
+                    self.events[(swc_name, event_name)] = run
+
+        prototypes = {}
+        for proto in self.arxml.iter("SW-COMPONENT-PROTOTYPE"):
+            swc_type = last_name(child_text(proto, "TYPE-TREF"))
+            if child_text(proto, "SHORT-NAME") != swc_type:
+                raise GeneratorError("component prototype %s: multiple instantiation is not supported"
+                                     % child_text(proto, "SHORT-NAME"))
+            prototypes[swc_type] = swc_type
+        for conn in self.arxml.iter("ASSEMBLY-SW-CONNECTOR"):
+            provider = (last_name(child_text(conn, "PROVIDER-IREF/CONTEXT-COMPONENT-REF")),
+                        last_name(child_text(conn, "PROVIDER-IREF/TARGET-P-PORT-REF")))
+            requester = (last_name(child_text(conn, "REQUESTER-IREF/CONTEXT-COMPONENT-REF")),
+                         last_name(child_text(conn, "REQUESTER-IREF/TARGET-R-PORT-REF")))
+            for swc, port in (provider, requester):
+                if swc not in prototypes or (swc, port) not in self.swc_ports:
+                    raise GeneratorError("connector %s: unknown port %s.%s" %
+                                         (child_text(conn, "SHORT-NAME"), swc, port))
+            if self.swc_ports[provider][1] != self.swc_ports[requester][1]:
+                raise GeneratorError("connector %s: interface mismatch" % child_text(conn, "SHORT-NAME"))
+            self.connections.setdefault(requester, []).append(provider)
+
+    def _containers(self, module, definition):
+        for mod in self.arxml.iter("ECUC-MODULE-CONFIGURATION-VALUES"):
+            if child_text(mod, "SHORT-NAME") != module:
+                continue
+            for cont in mod.iter("ECUC-CONTAINER-VALUE"):
+                if last_name(child_text(cont, "DEFINITION-REF")) == definition:
+                    yield cont
+
+    @staticmethod
+    def _param(cont, name, default=None):
+        for value in cont.findall("PARAMETER-VALUES/*"):
+            if last_name(child_text(value, "DEFINITION-REF")) == name:
+                return child_text(value, "VALUE")
+        if default is None:
+            raise GeneratorError("%s: missing parameter %s" % (child_text(cont, "SHORT-NAME"), name))
+        return default
+
+    @staticmethod
+    def _refs(cont, name):
+        return [child_text(value, "VALUE-REF") for value in cont.findall("REFERENCE-VALUES/ECUC-REFERENCE-VALUE")
+                if last_name(child_text(value, "DEFINITION-REF")) == name]
+
+    def _load_os(self):
+        for index, cont in enumerate(self._containers("Os", "OsTask")):
+            task = Task(child_text(cont, "SHORT-NAME"), index, int(self._param(cont, "OsTaskPriority")))
+            self.tasks.append(task)
+            self.tasks_by_name[task.name] = task
+        if not self.tasks:
+            raise GeneratorError("no OsTask configured")
+        for cont in self._containers("Os", "OsApplication"):
+            cores = self._refs(cont, "OsApplicationCoreRef")
+            if len(cores) != 1:
+                raise GeneratorError("%s: exactly one OsApplicationCoreRef required" % child_text(cont, "SHORT-NAME"))
+            for ref in self._refs(cont, "OsAppTaskRef"):
+                self.tasks_by_name[last_name(ref)].core = last_name(cores[0])
+        for task in self.tasks:
+            if task.core is None:
+                raise GeneratorError("%s is not assigned to an OsApplication" % task.name)
+
+    def _load_dem(self):
+        for cont in self._containers("Dem", "DemEventParameter"):
+            event_id = int(self._param(cont, "DemEventId"))
+            if not 0 < event_id <= 0xFFFF:
+                raise GeneratorError("%s: DemEventId out of range" % child_text(cont, "SHORT-NAME"))
+            self.dem_events[child_text(cont, "SHORT-NAME")] = event_id
+
+    def _load_rte(self):
+        for inst in self._containers("Rte", "RteSwComponentInstance"):
+            swc = child_text(inst, "SHORT-NAME")
+            for mapping in inst.findall(".//ECUC-CONTAINER-VALUE"):
+                if last_name(child_text(mapping, "DEFINITION-REF")) != "RteEventToTaskMapping":
+                    continue
+                event = last_name(self._refs(mapping, "RteEventRef")[0])
+                task = self.tasks_by_name[last_name(self._refs(mapping, "RteMappedToTaskRef")[0])]
+                run = self.events.get((swc, event))
+                if run is None:
+                    raise GeneratorError("%s: unknown event %s" % (swc, event))
+                if run.task is not None and run.task is not task:
+                    raise GeneratorError("%s_%s mapped to more than one task" % (swc, run.name))
+                if run.task is None:
+                    # Runnables with several events have one mapping per event
+                    run.task = task
+                    task.runnables.append((int(self._param(mapping, "RtePositionInTask", "0")), run))
+        for run in self.runnables.values():
+            if run.task is None:
+                raise GeneratorError("runnable %s is not mapped to a task" % run.symbol)
+        for task in self.tasks:
+            task.runnables.sort(key=lambda entry: entry[0])
+        for cont in self._containers("Rte", "RteRecorder"):
+            if self.recorder_task is not None:
+                raise GeneratorError("more than one RteRecorder configured")
+            tasks = self._refs(cont, "RteRecorderTaskRef")
+            if len(tasks) != 1 or last_name(tasks[0]) not in self.tasks_by_name:
+                raise GeneratorError("RteRecorder: exactly one valid RteRecorderTaskRef required")
+            self.recorder_task = self.tasks_by_name[last_name(tasks[0])]
+            for name, replayed in (("RteRecorderInputPortRef", True), ("RteRecorderPortRef", False)):
+                for ref in self._refs(cont, name):
+                    parts = ref.strip("/").split("/")
+                    self.recorder_refs.append(((parts[-2], parts[-1]), replayed))
+        for cont in self._containers("Rte", "RteReplication"):
+            for ref in self._refs(cont, "RteReplicatedPortRef"):
+                parts = ref.strip("/").split("/")
+                self.replication_refs.append((parts[-2], parts[-1]))
+        for cont in self._containers("Rte", "RteTimingChain"):
+            hops = [tuple(ref.strip("/").split("/")[-2:]) for ref in self._refs(cont, "RteTimingChainHopRef")]
+            self.timing_refs.append((child_text(cont, "SHORT-NAME"), int(self._param(cont, "RteTimingChainBudget")),
+                                     hops))
+        for cont in self._containers("Rte", "RteErrorRoute"):
+            name = child_text(cont, "SHORT-NAME")
+            code = self._param(cont, "RteErrorCode")
+            if code not in RUNTIME_ERRORS:
+                raise GeneratorError("%s: %s is not an RTE runtime error" % (name, code))
+            if code in self.error_routes:
+                raise GeneratorError("%s: more than one RteErrorRoute" % code)
+            events = self._refs(cont, "RteErrorDemEventRef")
+            if len(events) > 1 or (events and last_name(events[0]) not in self.dem_events):
+                raise GeneratorError("%s: at most one valid RteErrorDemEventRef allowed" % name)
+            self.error_routes[code] = (self._param(cont, "RteErrorDetReport", "true") in ("true", "1"),
+                                       last_name(events[0]) if events else None)
+
+    # -- resolution ------------------------------------------------------------------------------
+
+    def providers_of(self, swc, port):
+        direction, _ = self.swc_ports[(swc, port)]
+        if direction == "P":
+            return [(swc, port)]
+        if (swc, port) not in self.connections:
+            raise GeneratorError("%s.%s is not connected" % (swc, port))
+        return self.connections[(swc, port)]
+
+    def provider_of(self, swc, port):
+        providers = self.providers_of(swc, port)
+        if len(providers) != 1:
+            raise GeneratorError("%s.%s has more than one provider" % (swc, port))
+        return providers[0]
+
+    def is_queued(self, swc, port, element):
+        return (self.swc_ports[(swc, port)][1], element) in self.queued
+
+    def build(self):
+        for (swc, port), (direction, itf) in sorted(self.swc_ports.items()):
+            if direction == "P":
+                self.groups[(swc, port)] = Group(swc, port, self.interfaces[itf])
+        names = [g.port for g in self.groups.values()]
+        for group in self.groups.values():
+            if names.count(group.port) > 1:
+                group.name = group.swc + group.port
+
+        for run in self.runnables.values():
+            for kind in ("IWrite", "Send"):
+                for port, element in run.accesses[kind]:
+                    group = self.groups[self.provider_of(run.swc, port)]
+                    group.element_type(element)
+                    if group.writer_task is not None and group.writer_task is not run.task:
+                        raise GeneratorError("%s.%s is written by more than one task" % (group.swc, group.port))
+                    group.writer_task = run.task
+                    if self.is_queued(run.swc, port, element):
+                        if kind != "Send":
+                            raise GeneratorError("%s: queued %s.%s needs a DATA-SEND-POINT" %
+                                                 (run.symbol, port, element))
+                        continue
+                    target = group.implicit if kind == "IWrite" else group.explicit
+                    if element not in target:
+                        target.append(element)
+        for group in self.groups.values():
+            both = set(group.implicit) & set(group.explicit)
+            if both:
+                raise GeneratorError("%s.%s: %s both implicit and explicit" %
+                                     (group.swc, group.port, ", ".join(sorted(both))))
+
+        for run in self.runnables.values():
+            for kind in ("IRead", "Receive"):
+                for port, element in run.accesses[kind]:
+                    if self.is_queued(run.swc, port, element):
+                        if kind != "Receive":
+                            raise GeneratorError("%s: queued %s.%s needs a DATA-RECEIVE-POINT" %
+                                                 (run.symbol, port, element))
+                        self._add_queue_receiver(run, port, element)
+                        continue
+                    group = self.groups[self.provider_of(run.swc, port)]
+                    group.element_type(element)
+                    expected = group.implicit if kind == "IRead" else group.explicit
+                    if element not in expected:
+                        raise GeneratorError("%s: %s of %s.%s does not match the sender's access mode" %
+                                             (run.symbol, kind, port, element))
+                    group.readers.setdefault(element, set()).add((run, kind))
+
+        for group in self.groups.values():
+            members = [(e, t) for e, t in group.interface if e in group.implicit]
+            group.placed, group.size, group.align = packed_layout(members, self._element_rank(group))
+            group.declared_size = layout(members)[1]
+            for element in group.implicit:
+                for run, _ in group.readers.get(element, ()):
+                    if run.task.core != group.writer_task.core:
+                        raise GeneratorError("%s reads %s.%s implicitly from another core; use explicit "
+                                             "communication" % (run.symbol, group.port, element))
+
+        senders = {}
+        for queue in self.queues.values():
+            for group in queue.senders:
+                if group.writer_task is None:
+                    raise GeneratorError("%s.%s.%s has no sender" % (group.swc, group.port, queue.element))
+                senders.setdefault((group.swc, group.port, queue.element), []).append(queue)
+        for (swc, port, element), queues in senders.items():
+            if len(queues) > 1:
+                raise GeneratorError("queued %s.%s.%s is received by more than one port; fan-out to several "
+                                     "queues is not supported" % (swc, port, element))
+
+        self._build_events()
+        self._build_replication()
+        self._build_timing()
+
+        for (swc, port), replayed in self.recorder_refs:
+            group = self.groups.get((swc, port))
+            if group is None:
+                raise GeneratorError("RteRecorder: %s.%s is not a provided port" % (swc, port))
+            if not group.placed:
+                raise GeneratorError("RteRecorder: %s.%s has no implicitly written elements" % (swc, port))
+            if group.writer_task.core != self.recorder_task.core:
+                raise GeneratorError("RteRecorder: %s.%s is written on another core than %s" %
+                                     (swc, port, self.recorder_task.name))
+            if any(g is group for g, _ in self.recorded):
+                raise GeneratorError("RteRecorder: %s.%s referenced twice" % (swc, port))
+            self.recorded.append((group, replayed))
+
+    def _build_events(self):
+        for task in self.tasks:
+            runs = [run for _, run in task.runnables]
+            event_runs = [run for run in runs if run.data_events]
+            if not event_runs:
+                continue
+            for run in runs:
+                if run.timed or not run.data_events:
+                    raise GeneratorError("%s runs event-triggered runnables and can not also run %s" %
+                                         (task.name, run.symbol))
+            for run in event_runs:
+                if len(run.data_events) > MAX_RUNNABLE_EVENTS:
+                    raise GeneratorError("%s: more than %d events" % (run.symbol, MAX_RUNNABLE_EVENTS))
+                for event in run.data_events:
+                    key = (run.swc, event.port, event.element)
+                    if not self.is_queued(*key):
+                        raise GeneratorError("%s: event %s: only queued data elements raise events" %
+                                             (run.symbol, event.name))
+                    queue = self.queues.get(key)
+                    if queue is None or queue.consumer_task is not task:
+                        raise GeneratorError("%s: event %s: %s.%s is not received in %s" %
+                                             (run.symbol, event.name, event.port, event.element, task.name))
+                    if event.kind in queue.events:
+                        raise GeneratorError("%s.%s.%s: more than one %s event" % (key + (event.kind,)))
+                    queue.events[event.kind] = event
+                    event.index = len(self.data_events)
+                    self.data_events.append(event)
+                self.event_runnables.append(run)
+
+    def _build_replication(self):
+        channels = {}
+        for swc, port in self.replication_refs:
+            group = self.groups.get((swc, port))
+            if group is None:
+                raise GeneratorError("RteReplication: %s.%s is not a provided port" % (swc, port))
+            found = False
+            for element in group.explicit:
+                targets = set(run.task.core for run, _ in group.readers.get(element, ())
+                              if run.task.core != group.writer_task.core)
+                if not targets:
+                    continue
+                if len(targets) > 1:
+                    raise GeneratorError("RteReplication: %s.%s.%s is read on more than one other core" %
+                                         (swc, port, element))
+                key = (group.writer_task.core, targets.pop())
+                if key not in channels:
+                    channels[key] = Channel(*key)
+                    self.channels.append(channels[key])
+                channel = channels[key]
+                if len(channel.replicas) == MAX_CHANNEL_REPLICAS:
+                    raise GeneratorError("RteReplication: more than %d signals from %s to %s" %
+                                         ((MAX_CHANNEL_REPLICAS,) + key))
+                replica = Replica(group, element, group.element_type(element), channel)
+                channel.replicas.append(replica)
+                self.replicas[(swc, port, element)] = replica
+                found = True
+            if not found:
+                raise GeneratorError("RteReplication: %s.%s has no explicit elements read on another core" %
+                                     (swc, port))
+        for index, replica in enumerate(self.replica_list()):
+            replica.index = index
+
+    def _build_timing(self):
+        for name, budget, refs in self.timing_refs:
+            chain = TraceChain(name, budget)
+            if len(refs) < 2:
+                raise GeneratorError("RteTimingChain %s: at least two RteTimingChainHopRef required" % name)
+            for swc, port in refs:
+                group = self.groups.get((swc, port))
+                if group is None or not group.placed:
+                    raise GeneratorError("RteTimingChain %s: %s.%s is not an implicitly written port" %
+                                         (name, swc, port))
+                previous = chain.hops[-1] if chain.hops else None
+                if previous is not None and not any(run.task is group.writer_task
+                                                    for element in previous.group.implicit
+                                                    for run, _ in previous.group.readers.get(element, ())):
+                    raise GeneratorError("RteTimingChain %s: %s does not read %s in %s" %
+                                         (name, group.writer_task.name, previous.group.name, group.name))
+                hop = TraceHop(chain, group, len(self.hops), previous)
+                chain.hops.append(hop)
+                self.hops.append(hop)
+            self.chains.append(chain)
+        if len(self.hops) > MAX_TRACE_HOPS:
+            raise GeneratorError("RteTimingChain: more than %d hops" % MAX_TRACE_HOPS)
+
+    @staticmethod
+    def _element_rank(group):
+        """Sort key of the implicit elements: by the priorities of the other tasks reading them.
+
+        Elements of the highest-priority reader come first, those it shares
+        with lower-priority readers next, so the fill range of every reader
+        stays short. Elements only the writer copies go last.
+        """
+        def rank(element):
+            priorities = sorted(set(run.task.priority for run, _ in group.readers.get(element, ())
+                                    if run.task is not group.writer_task), reverse=True)
+            return tuple(-p for p in priorities) if priorities else (1,)
+        return rank
+
+    def _add_queue_receiver(self, run, port, element):
+        key = (run.swc, port, element)
+        queue = self.queues.get(key)
+        if queue is None:
+            if key not in self.queue_lengths:
+                raise GeneratorError("%s.%s: queued element %s has no QUEUED-RECEIVER-COM-SPEC" % key)
+            length = self.queue_lengths[key]
+            if length < 2 or (length & (length - 1)) != 0:
+                raise GeneratorError("%s.%s.%s: QUEUE-LENGTH %d is not a power of two >= 2" % (key + (length,)))
+            providers = self.providers_of(run.swc, port)
+            queue = Queue(run.swc, port, element, self.groups[providers[0]].element_type(element), length)
+            queue.senders = [self.groups[p] for p in providers]
+            self.queues[key] = queue
+        if queue.consumer_task is not None and queue.consumer_task is not run.task:
+            raise GeneratorError("%s.%s.%s is received in more than one task" % key)
+        queue.consumer_task = run.task
+
+    # -- queries for the emitter -----------------------------------------------------------------
+
+    def implicit_groups(self):
+        return [g for g in self.groups.values() if g.placed]
+
+    def copy_tasks(self, group):
+        """Tasks copying a group: the writer and the other readers"""
+        return set([group.writer_task]) | set(self.reader_tasks(group))
+
+    def hot_task(self):
+        """Highest-priority task with copy blocks (the most frequent one), or None"""
+        tasks = set()
+        for group in self.implicit_groups():
+            tasks |= self.copy_tasks(group)
+        return max(tasks, key=lambda task: task.priority) if tasks else None
+
+    def global_groups(self):
+        """Implicit groups in the order of the global buffer block: by the highest
+        priority copying them, then by decreasing alignment. The groups of the hot
+        task come first and share the first cache line(s)"""
+        return sorted(self.implicit_groups(),
+                      key=lambda g: (-max(t.priority for t in self.copy_tasks(g)), -g.align))
+
+    def hot_groups(self):
+        hot = self.hot_task()
+        return [g for g in self.global_groups() if hot in self.copy_tasks(g)]
+
+    def reader_tasks(self, group):
+        """Tasks other than the writer reading implicit elements: task -> (first, end) byte range"""
+        ranges = {}
+        for name, dtype, offset in group.placed:
+            for run, _ in group.readers.get(name, ()):
+                if run.task is group.writer_task:
+                    continue
+                first, end = ranges.get(run.task, (offset, offset + dtype.size))
+                ranges[run.task] = (min(first, offset), max(end, offset + dtype.size))
+        return ranges
+
+    def recorder_layout_id(self):
+        """CRC-32 of the recorded image layout, stored in every recording"""
+        text = ";".join("%s%s:%s" % (g.name, "<" if replayed else "",
+                                     ",".join("%s@%d:%s" % (n, o, t.name) for n, t, o in g.placed))
+                        for g, replayed in self.recorded)
+        return zlib.crc32(text.encode("ascii")) & 0xFFFFFFFF
+
+    def event_tasks(self):
+        return sorted(set(run.task for run in self.event_runnables), key=lambda task: task.index)
+
+    def error_route_list(self):
+        # (code, DET report, DEM event name or None) in table order
+        return [(code,) + self.error_routes.get(code, (True, None)) for code in RUNTIME_ERRORS]
+
+    def replica_list(self):
+        """Replicas in ID order: grouped by channel, so each channel owns a contiguous range"""
+        return [replica for channel in self.channels for replica in channel.replicas]
+
+    def replica_of(self, group, element):
+        return self.replicas.get((group.swc, group.port, element))
+
+    def queue_list(self):
+        return [self.queues[key] for key in sorted(self.queues)]
+
+    def queue_of_sender(self, swc, port, element):
+        for queue in self.queue_list():
+            if queue.element == element and any((g.swc, g.port) == (swc, port) for g in queue.senders):
+                return queue
+        raise GeneratorError("%s.%s.%s is not connected to a receiver" % (swc, port, element))
+
+    def explicit_signals(self):
+        """[(group, element, DataType, kind)], kind in 'direct', 'connection', 'seqlock'
+
+        Replicated signals are 'direct' or 'seqlock' on the writer's core only.
+        """
+        result = []
+        for group in self.groups.values():
+            for element in group.explicit:
+                dtype = group.element_type(element)
+                remote = (self.replica_of(group, element) is None and
+                          any(run.task.core != group.writer_task.core for run, _ in group.readers.get(element, ())))
+                if dtype.kind != "value" or dtype.size > ATOMIC_MAX_SIZE:
+                    kind = "seqlock"
+                elif remote:
+                    kind = "connection"
+                else:
+                    kind = "direct"
+                result.append((group, element, dtype, kind))
+        return result
+
+
+# ------------------------------------------------------------------------------------------------
+# Emitter
+# ------------------------------------------------------------------------------------------------
+
+def member_lines(members, indent="    "):
+    lines = []
+    for name, dtype, offset in members:
+        decl = "%s%s %s;" % (indent, dtype.ctype.ljust(6), dtype.declarator(name))
+        lines.append("%s/**< +%d */" % (decl.ljust(40), offset))
+    return lines
+
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def local_buffer(self, task, group):
+        return "Rte_%s.%s" % (task.cname, group.name)
+
+    @staticmethod
+    def global_buffer(group):
+        return "Rte_Global.%s" % group.name
+
+    @staticmethod
+    def buffer_block(groups):
+        """Layout of a block of group buffers: ([(name, Group, offset)], size)"""
+        placed, size, _ = layout([(g.name, g) for g in groups])
+        return placed, size
+
+    @staticmethod
+    def buffer_lines(placed):
+        return ["%s/**< +%d */" % (("    %s %s;" % (("Rte_Grp%sType" % g.name).ljust(24), name)).ljust(48), offset)
+                for name, g, offset in placed]
+
+    # -- tables for the documentation ------------------------------------------------------------
+
+    def plan(self):
+        """task -> (fill blocks, flush blocks); block = (group, first, end, locked)"""
+        plan = dict((task, ([], [])) for task in self.m.tasks)
+        for group in self.m.implicit_groups():
+            readers = self.m.reader_tasks(group)
+            writer = group.writer_task
+            for task, (first, end) in sorted(readers.items(), key=lambda item: item[0].index):
+                plan[task][0].append((group, first, end, writer.priority > task.priority))
+            locked = any(task.priority > writer.priority for task in readers)
+            if any(g is group for g, _ in self.m.recorded):
+                locked = locked or self.m.recorder_task.priority > writer.priority
+            plan[writer][1].append((group, 0, group.size, locked))
+        return plan
+
+    def doc_plan(self, plan):
+        rows = ["| Task              | Prio | Fill (global -> local)          | Flush (local -> global)         |",
+                "|-------------------|------|---------------------------------|---------------------------------|"]
+
+        def cell(blocks):
+            return ["%s[%d..%d)%s" % (g.name, a, b, " L" if lk else "") for g, a, b, lk in blocks] or ["-"]
+
+        for task in self.m.tasks:
+            fill, flush = (cell(x) for x in plan[task])
+            for i in range(max(len(fill), len(flush))):
+                rows.append("| %-17s | %-4s | %-31s | %-31s |" %
+                            (task.name if i == 0 else "", str(task.priority) if i == 0 else "",
+                             fill[i] if i < len(fill) else "", flush[i] if i < len(flush) else ""))
+        return rows
+
+    def doc_layout(self):
+        hot = self.m.hot_task()
+        rows = ["",
+                "Layout (bytes; declared = element order of the ARXML, H = copied by %s," % (hot.name if hot else "-"),
+                "placed in the first cache line of Rte_Global):",
+                "| Type                          | Declared | Packed | H |",
+                "|-------------------------------|----------|--------|---|"]
+        for dtype in [t for t in self.m.types.values() if t.kind == "struct"]:
+            rows.append("| %-29s | %-8d | %-6d |   |" % (dtype.ctype, dtype.declared_size, dtype.size))
+        hot_groups = self.m.hot_groups()
+        for group in self.m.global_groups():
+            rows.append("| %-29s | %-8d | %-6d | %s |" % ("Rte_Grp%sType" % group.name, group.declared_size,
+                                                        group.size, "H" if group in hot_groups else " "))
+        return rows
+
+    # -- rte_cfg.h -------------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        plan = self.plan()
+        explicit = m.explicit_signals()
+        details = ["Static RTE configuration of the VCU software components.",
+                   "",
+                   "Implicit communication copy plan (byte ranges of the signal groups,",
+                   "L = copied with interrupts disabled):"]
+        details += self.doc_plan(plan)
+        details += self.doc_layout()
+        details += ["",
+                    "Explicit communication:",
+                    "| Signal                          | Writer task       | Access                  |",
+                    "|---------------------------------|-------------------|-------------------------|"]
+        for group, element, dtype, kind in explicit:
+            if m.replica_of(group, element) is not None:
+                access = {"direct": "direct + replica", "seqlock": "sequence lock + replica"}[kind]
+            else:
+                access = {"direct": "direct variable", "connection": "connection table", "seqlock": "sequence lock"}[kind]
+            details.append("| %-31s | %-17s | %-23s |" % ("%s.%s" % (group.name, element), group.writer_task.name,
+                                                         access))
+        if m.channels:
+            details += ["",
+                        "Replication channels (one batch, one CRC-32 per cycle; bytes = largest batch):",
+                        "| Channel           | Source core       | Target core       | Signals                   | Bytes |",
+                        "|-------------------|-------------------|-------------------|---------------------------|-------|"]
+            for channel in m.channels:
+                for i, replica in enumerate(channel.replicas):
+                    first = i == 0
+                    details.append("| %-17s | %-17s | %-17s | %-25s | %-5s |" %
+                                   (channel.name if first else "", channel.source if first else "",
+                                    channel.target if first else "",
+                                    "%s.%s" % (replica.group.name, replica.element),
+                                    channel.batch_words * 4 if first else ""))
+        queues = m.queue_list()
+        if queues:
+            width = max(len("%s.%s.%s" % (q.swc, q.port, q.element)) for q in queues)
+            details += ["",
+                        "Queues (SP = single producer, MP = multi producer):",
+                        "| %s | Length | Senders                        | Type |" % "Receiver".ljust(width),
+                        "|-%s-|--------|--------------------------------|------|" % ("-" * width)]
+            for queue in queues:
+                details.append("| %s | %-6d | %-30s | %-4s |" %
+                               (("%s.%s.%s" % (queue.swc, queue.port, queue.element)).ljust(width), queue.length,
+                                ", ".join(t.name for t in queue.producer_tasks),
+                                ("MP" if queue.multi_producer else "SP") + (" X" if queue.shared else "")))
+            details.append("(X = senders on another core, storage in RTE_SHARED_SECTION)")
+        if m.data_events:
+            width = max(len(e.runnable.symbol) for e in m.data_events)
+            details += ["",
+                        "Event-triggered runnables (pending-event bits):",
+                        "| %s | Task              | Event                | Kind     | Bit |" % "Runnable".ljust(width),
+                        "|-%s-|-------------------|----------------------|----------|-----|" % ("-" * width)]
+            for run in m.event_runnables:
+                for bit, event in enumerate(run.data_events):
+                    details.append("| %s | %-17s | %-20s | %-8s | %-3d |" %
+                                   ((run.symbol if bit == 0 else "").ljust(width),
+                                    run.task.name if bit == 0 else "", event.name, event.kind, bit))
+        if m.recorded:
+            details += ["",
+                        "Recorder channels (task %s, I = replayed input):" % m.recorder_task.name,
+                        "| Channel           | Writer task       | Size | I |",
+                        "|-------------------|-------------------|------|---|"]
+            for group, replayed in m.recorded:
+                details.append("| %-17s | %-17s | %-4d | %s |" % (group.name, group.writer_task.name, group.size,
+                                                                "I" if replayed else " "))
+        if m.chains:
+            details += ["",
+                        "Timing chains (hops in data-flow order):",
+                        "| Chain                 | Budget us | Hop               | Writer task       |",
+                        "|-----------------------|-----------|-------------------|-------------------|"]
+            for chain in m.chains:
+                for i, hop in enumerate(chain.hops):
+                    details.append("| %-21s | %-9s | %-17s | %-17s |" %
+                                   (chain.name if i == 0 else "", chain.budget_us if i == 0 else "",
+                                    hop.group.name, hop.group.writer_task.name))
+        details += ["",
+                    "Error routing (runtime errors, reported once per error and task activation):",
+                    "| Error                          | DET | DEM event (id)                     |",
+                    "|--------------------------------|-----|------------------------------------|"]
+        for code, det, dem in m.error_route_list():
+            details.append("| %-30s | %-3s | %-34s |" % (code, "x" if det else "",
+                                                       "%s (%d)" % (dem, m.dem_events[dem]) if dem else "-"))
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "rte_cfg.h",
+                              "RTE Configuration - Types, Buffers, Ports and Access Macros", details),
+               "#ifndef RTE_CFG_H", "#define RTE_CFG_H", "",
+               banner("h", "INCLUDE FILES"),
+               '#include "rte_types.h"', '#include "task_config.h"', ""]
+
+        structs = [t for t in m.types.values() if t.kind == "struct"]
+        if structs:
+            out.append(banner("h", "DATA TYPES"))
+            for dtype in structs:
+                out += ["/** @brief %s (%d bytes) */" % (dtype.name, dtype.size), "typedef struct", "{"]
+                out += member_lines(dtype.members)
+                out += ["} %s;" % dtype.ctype, ""]
+
+        out.append(banner("h", "SIGNAL GROUPS"))
+        for group in m.implicit_groups():
+            out += ["/** @brief %s.%s (writer: %s, %d bytes) */" %
+                    (group.swc, group.port, group.writer_task.name, group.size),
+                    "typedef struct", "{"]
+            out += member_lines(group.placed)
+            out += ["} Rte_Grp%sType;" % group.name, ""]
+
+        out.append(banner("h", "GLOBAL BUFFERS"))
+        placed, size = self.buffer_block(m.global_groups())
+        hot = m.hot_task()
+        out += ["/** @brief Global buffers, groups of %s first (%d bytes, cache-line aligned) */" %
+                (hot.name if hot else "-", size), "typedef struct", "{"]
+        out += self.buffer_lines(placed)
+        out += ["} Rte_GlobalBuffersType;", "", "extern Rte_GlobalBuffersType Rte_Global;", ""]
+        out.append(banner("h", "TASK-LOCAL BUFFERS"))
+        for task in m.tasks:
+            buffers = self.task_buffers(task)
+            if buffers:
+                placed, size = self.buffer_block(buffers)
+                out += ["/** @brief Buffers of %s (%d bytes, cache-line aligned) */" % (task.name, size),
+                        "typedef struct", "{"]
+                out += self.buffer_lines(placed)
+                out += ["} Rte_%sBuffersType;" % task.cname, "",
+                        "extern Rte_%sBuffersType Rte_%s;" % (task.cname, task.cname), ""]
+        out += ["/** @brief Copy plan indexed by TaskType */",
+                "extern const Rte_TaskCopyPlanType Rte_CopyPlan[OS_TASK_COUNT];", ""]
+
+        seqlocks = [s for s in explicit if s[3] == "seqlock"]
+        connections = [s for s in explicit if s[3] == "connection"]
+        directs = [s for s in explicit if s[3] != "seqlock"]
+        out.append(banner("h", "SEQUENCE-LOCK PORTS"))
+        out.append("/** @name Port identifiers @{ */")
+        for i, (group, element, _, _) in enumerate(seqlocks):
+            out.append("#define %s((Rte_SeqlockPortIdType)%dU)" % (self.seqlock_id(group, element).ljust(40), i))
+        out.append("#define %s%dU" % ("RTE_SEQLOCK_PORT_COUNT".ljust(40), len(seqlocks)))
+        out += ["/** @} */", "",
+                "/** @brief Port configuration indexed by Rte_SeqlockPortIdType */",
+                "extern const Rte_SeqlockPortType Rte_SeqlockPort[RTE_SEQLOCK_PORT_COUNT];", ""]
+
+        out.append(banner("h", "CONNECTIONS"))
+        out.append("/** @name Connection identifiers @{ */")
+        for i, (group, element, _, _) in enumerate(connections):
+            out.append("#define %s((Rte_ConnectionIdType)%dU)" % (self.connection_id(group, element).ljust(40), i))
+        out.append("#define %s%dU" % ("RTE_CONNECTION_COUNT".ljust(40), len(connections)))
+        out += ["/** @} */", "",
+                "/** @brief Connection table indexed by Rte_ConnectionIdType */",
+                "extern const Rte_ConnectionType Rte_Connection[RTE_CONNECTION_COUNT];", ""]
+        for group, element, dtype, _ in directs:
+            out.append("extern %s %s;" % ("volatile " + dtype.ctype, self.signal_var(group, element)))
+        if directs:
+            out.append("")
+
+        out.append(banner("h", "REPLICATION"))
+        out.append("/** @name Replica identifiers @{ */")
+        replicas = m.replica_list()
+        for replica in replicas:
+            out.append("#define %s((Rte_ReplicaIdType)%dU)" % (self.replica_id(replica).ljust(40), replica.index))
+        out.append("#define %s%dU" % ("RTE_REPLICA_COUNT".ljust(40), len(replicas)))
+        out += ["/** @} */", "", "/** @name Replication channel identifiers @{ */"]
+        for i, channel in enumerate(m.channels):
+            out.append("#define %s((Rte_LockstepChannelIdType)%dU)" % (self.channel_id(channel).ljust(40), i))
+        out.append("#define %s%dU" % ("RTE_LOCKSTEP_CHANNEL_COUNT".ljust(40), len(m.channels)))
+        out += ["/** @} */", "",
+                "/** @brief Replicated signals indexed by Rte_ReplicaIdType */",
+                "extern const Rte_ReplicaType Rte_Replica[RTE_REPLICA_COUNT];",
+                "",
+                "/** @brief Replication channels indexed by Rte_LockstepChannelIdType */",
+                "extern const Rte_LockstepChannelType Rte_LockstepChannel[RTE_LOCKSTEP_CHANNEL_COUNT];", ""]
+
+        out.append(banner("h", "QUEUES"))
+        out.append("/** @name Queue identifiers @{ */")
+        width = max([40] + [len(self.queue_id(q)) + 1 for q in queues])
+        for i, queue in enumerate(queues):
+            out.append("#define %s((Rte_QueueIdType)%dU)" % (self.queue_id(queue).ljust(width), i))
+        out.append("#define %s%dU" % ("RTE_QUEUE_COUNT".ljust(width), len(queues)))
+        out += ["/** @} */", "",
+                "/** @brief Queue configuration indexed by Rte_QueueIdType */",
+                "extern const Rte_QueueType Rte_Queue[RTE_QUEUE_COUNT];", ""]
+
+        out.append(banner("h", "EVENTS"))
+        out.append("/** @name Event identifiers @{ */")
+        width = max([40] + [len(self.event_id(e)) + 1 for e in m.data_events])
+        for event in m.data_events:
+            out.append("#define %s((Rte_EventIdType)%dU)" % (self.event_id(event).ljust(width), event.index))
+        out.append("#define %s%dU" % ("RTE_EVENT_COUNT".ljust(width), len(m.data_events)))
+        out += ["/** @} */", "", "/** @name Event-triggered runnable identifiers @{ */"]
+        width = max([40] + [len(self.runnable_id(r)) + 1 for r in m.event_runnables])
+        for i, run in enumerate(m.event_runnables):
+            out.append("#define %s((Rte_RunnableIdType)%dU)" % (self.runnable_id(run).ljust(width), i))
+        out.append("#define %s%dU" % ("RTE_RUNNABLE_COUNT".ljust(width), len(m.event_runnables)))
+        out += ["/** @} */", "",
+                "/** @brief Tasks activated by events (bit = TaskType) */",
+                "#define %s%s" % ("RTE_EVENT_TASK_MASK".ljust(40), self.event_task_mask()),
+                "",
+                "/** @brief Event configuration indexed by Rte_EventIdType */",
+                "extern const Rte_EventType Rte_Event[RTE_EVENT_COUNT];",
+                "",
+                "/** @brief Event-triggered runnables indexed by Rte_RunnableIdType */",
+                "extern const Rte_EventRunnableType Rte_EventRunnable[RTE_RUNNABLE_COUNT];", ""]
+
+        out.append(banner("h", "RECORDER"))
+        out += ["#define %s%s" % ("RTE_RECORDER_TASK".ljust(40), m.recorder_task.macro if m.recorder_task
+                                  else "OS_TASK_COUNT"),
+                "#define %s%dU" % ("RTE_RECORDER_CHANNEL_COUNT".ljust(40), len(m.recorded)),
+                "#define %s%s/**< Sum of the channel sizes */" %
+                ("RTE_RECORDER_IMAGE_SIZE".ljust(40), ("%dU" % sum(g.size for g, _ in m.recorded)).ljust(16)),
+                "#define %s%s/**< CRC-32 of the channel layout */" %
+                ("RTE_RECORDER_LAYOUT_ID".ljust(40), ("0x%08XUL" % m.recorder_layout_id()).ljust(16)),
+                "",
+                "/** @brief Recorded signal groups, in image order */",
+                "extern const Rte_RecorderChannelType Rte_RecorderChannel[RTE_RECORDER_CHANNEL_COUNT];", ""]
+
+        out.append(banner("h", "TIMING CHAINS"))
+        out.append("/** @name Traced hop identifiers @{ */")
+        width = max([40] + [len(self.hop_id(h)) + 1 for h in m.hops])
+        for hop in m.hops:
+            out.append("#define %s((Rte_TraceHopIdType)%dU)" % (self.hop_id(hop).ljust(width), hop.index))
+        out.append("#define %s%dU" % ("RTE_TRACE_HOP_COUNT".ljust(width), len(m.hops)))
+        out += ["/** @} */", "", "/** @name Timing chain identifiers @{ */"]
+        for i, chain in enumerate(m.chains):
+            out.append("#define %s((Rte_TraceChainIdType)%dU)" % (self.chain_id(chain).ljust(40), i))
+        out.append("#define %s%dU" % ("RTE_TRACE_CHAIN_COUNT".ljust(40), len(m.chains)))
+        out += ["/** @} */", "",
+                "/** @brief Traced hops indexed by Rte_TraceHopIdType */",
+                "extern const Rte_TraceHopType Rte_TraceHop[RTE_TRACE_HOP_COUNT];",
+                "",
+                "/** @brief Timing chains indexed by Rte_TraceChainIdType */",
+                "extern const Rte_TraceChainType Rte_TraceChain[RTE_TRACE_CHAIN_COUNT];",
+                "",
+                "/** @brief Hops published by each task (bit = Rte_TraceHopIdType), indexed by TaskType */",
+                "extern const uint32 Rte_TraceTaskHops[OS_TASK_COUNT];", ""]
+
+        out.append(banner("h", "ERROR ROUTING"))
+        out += ["#define %s%dU" % ("RTE_ERROR_ROUTE_COUNT".ljust(40), len(RUNTIME_ERRORS)),
+                "",
+                "/** @brief Reports per runtime error, indexed by error code - RTE_E_DET_RUNTIME_FIRST */",
+                "extern const Rte_ErrorRouteType Rte_ErrorRoute[RTE_ERROR_ROUTE_COUNT];", ""]
+
+        out.append(banner("h", "IMPLICIT ACCESS MACROS"))
+        out += self.implicit_macros()
+        out.append(banner("h", "EXPLICIT ACCESS MACROS"))
+        out += self.explicit_macros(explicit)
+        out.append(banner("h", "EVENT MACROS"))
+        out += self.event_macros()
+        out += ["#endif /* RTE_CFG_H */", "", banner("h", "END OF FILE")]
+        return "\n".join(out)
+
+    @staticmethod
+    def layout_asserts(ctype, name, placed, size):
+        out = ['STATIC_ASSERT(sizeof(%s) == %dU, "%s layout");' % (ctype, size, name)]
+        for member, _, offset in placed:
+            out.append('STATIC_ASSERT(OFFSETOF(%s, %s) == %dU, "%s layout");' % (ctype, member, offset, name))
+        return out
+
+    def task_buffers(self, task):
+        buffers = []
+        for group in self.m.implicit_groups():
+            if group.writer_task is task or task in self.m.reader_tasks(group):
+                buffers.append(group)
+        return sorted(buffers, key=lambda g: -g.align)
+
+    @staticmethod
+    def seqlock_id(group, element):
+        return "RTE_SEQLOCK_%s_%s" % (_snake_upper(group.name), _snake_upper(element))
+
+    @staticmethod
+    def connection_id(group, element):
+        return "RTE_CONNECTION_%s_%s" % (_snake_upper(group.name), _snake_upper(element))
+
+    @staticmethod
+    def replica_id(replica):
+        return "RTE_REPLICA_%s_%s" % (_snake_upper(replica.group.name), _snake_upper(replica.element))
+
+    @staticmethod
+    def channel_id(channel):
+        return "RTE_LOCKSTEP_CHANNEL_%s" % _snake_upper(channel.name)
+
+    @staticmethod
+    def hop_id(hop):
+        return "RTE_TRACE_HOP_%s_%s" % (_snake_upper(hop.chain.name), _snake_upper(hop.group.name))
+
+    @staticmethod
+    def chain_id(chain):
+        return "RTE_TRACE_CHAIN_%s" % _snake_upper(chain.name)
+
+    @staticmethod
+    def queue_id(queue):
+        return "RTE_QUEUE_%s_%s_%s" % (_snake_upper(queue.swc), _snake_upper(queue.port), _snake_upper(queue.element))
+
+    def event_task_mask(self):
+        bits = ["(1UL << %s)" % task.macro for task in self.m.event_tasks()]
+        if not bits:
+            return "0UL"
+        return bits[0] if len(bits) == 1 else "(%s)" % " | ".join(bits)
+
+    @staticmethod
+    def event_id(event):
+        return "RTE_EVENT_%s_%s" % (_snake_upper(event.swc), _snake_upper(event.name))
+
+    @staticmethod
+    def runnable_id(run):
+        return "RTE_RUNNABLE_%s_%s" % (_snake_upper(run.swc), _snake_upper(run.name))
+
+    @staticmethod
+    def event_mask(event):
+        return "RTE_MASK_%s_%s" % (_snake_upper(event.swc), _snake_upper(event.name))
+
+    @staticmethod
+    def replica_var(replica):
+        return "Rte_Replica_%s_%s" % (replica.group.name, replica.element)
+
+    @staticmethod
+    def signal_var(group, element):
+        return "Rte_Signal_%s_%s" % (group.name, element)
+
+    def implicit_macros(self):
+        out = []
+        for task in self.m.tasks:
+            for _, run in task.runnables:
+                lines = []
+                for kind in ("IRead", "IWrite"):
+                    for port, element in run.accesses[kind]:
+                        group = self.m.groups[self.m.provider_of(run.swc, port)]
+                        dtype = group.element_type(element)
+                        owner = group.writer_task if run.task is group.writer_task else run.task
+                        ref = "%s.%s" % (self.local_buffer(owner, group), element)
+                        name = "Rte_%s_%s_%s_%s_%s" % (kind, run.swc, run.name, port, element)
+                        if dtype.kind == "array" and kind == "IRead":
+                            lines.append(("%s()" % name, "(&%s[0])" % ref))
+                        elif dtype.kind == "array":
+                            lines.append(("Rte_IWriteRef_%s_%s_%s_%s()" % (run.swc, run.name, port, element),
+                                          "(&%s[0])" % ref))
+                        elif kind == "IRead":
+                            lines.append(("%s()" % name, "(%s)" % ref))
+                        else:
+                            lines.append(("%s(data)" % name, "(%s = (data))" % ref))
+                if lines:
+                    out.append("/** @name %s (%s) @{ */" % (run.symbol, task.name))
+                    out += self.define_lines(lines)
+                    out += ["/** @} */", ""]
+        return out
+
+    def explicit_macros(self, explicit):
+        kinds = dict(((g.swc, g.port, e), (g, t, k)) for g, e, t, k in explicit)
+        out = []
+        for task in self.m.tasks:
+            for _, run in task.runnables:
+                lines = []
+                for kind in ("Send", "Receive"):
+                    for port, element in run.accesses[kind]:
+                        if self.m.is_queued(run.swc, port, element):
+                            lines += self.queue_macros(run, kind, port, element)
+                            continue
+                        prov = self.m.provider_of(run.swc, port)
+                        group, dtype, access = kinds[(prov[0], prov[1], element)]
+                        api = "Write" if kind == "Send" else "Read"
+                        name = "Rte_%s_%s_%s_%s(data)" % (api, run.swc, port, element)
+                        local = run.task.core == group.writer_task.core
+                        replica = self.m.replica_of(group, element)
+                        if replica is not None and not local:
+                            body = "Rte_Lockstep_Read(%s, (data))" % self.replica_id(replica)
+                        elif replica is not None and api == "Write" and access == "seqlock":
+                            body = "Rte_Lockstep_Update(%s, Rte_Seqlock_Write(%s, (data)))" % (
+                                self.replica_id(replica), self.seqlock_id(group, element))
+                        elif replica is not None and api == "Write":
+                            body = "(%s = (data), Rte_Lockstep_Update(%s, RTE_E_OK))" % (
+                                self.signal_var(group, element), self.replica_id(replica))
+                        elif access == "seqlock":
+                            body = "Rte_Seqlock_%s(%s, (data))" % (api, self.seqlock_id(group, element))
+                        elif access == "direct" or (access == "connection" and local and api == "Read"):
+                            var = self.signal_var(group, element)
+                            body = ("(%s = (data), RTE_E_OK)" % var if api == "Write"
+                                    else "(*(data) = %s, RTE_E_OK)" % var)
+                        elif api == "Write":
+                            body = "Rte_Connection_Write(%s, (uint32)(data))" % self.connection_id(group, element)
+                        else:
+                            body = "Rte_Connection_Read(%s, (data))" % self.connection_id(group, element)
+                        lines.append((name, body))
+                if lines:
+                    out.append("/** @name %s (%s) @{ */" % (run.symbol, task.name))
+                    out += self.define_lines(lines)
+                    out += ["/** @} */", ""]
+        return out
+
+    def event_macros(self):
+        out = []
+        for run in self.m.event_runnables:
+            lines = [("Rte_Events_%s_%s()" % (run.swc, run.name), "Rte_Event_Take(%s)" % self.runnable_id(run))]
+            lines += [(self.event_mask(e), "0x%08XUL" % (1 << bit)) for bit, e in enumerate(run.data_events)]
+            out.append("/** @name %s (%s) @{ */" % (run.symbol, run.task.name))
+            out += self.define_lines(lines)
+            out += ["/** @} */", ""]
+        return out
+
+    def queue_macros(self, run, kind, port, element):
+        suffix = "%s_%s_%s" % (run.swc, port, element)
+        if kind == "Send":
+            queue_id = self.queue_id(self.m.queue_of_sender(run.swc, port, element))
+            return [("Rte_Send_%s(data)" % suffix, "Rte_Queue_Send(%s, (data))" % queue_id)]
+        queue_id = self.queue_id(self.m.queues[(run.swc, port, element)])
+        return [("Rte_Receive_%s(data)" % suffix, "Rte_Queue_Receive(%s, (data))" % queue_id),
+                ("Rte_ReceiveN_%s(data, max, count)" % suffix,
+                 "Rte_Queue_ReceiveN(%s, (data), (max), (count))" % queue_id)]
+
+    @staticmethod
+    def define_lines(pairs):
+        lines = []
+        for name, body in pairs:
+            line = "#define %s %s" % (name.ljust(60), body)
+            if len(line) > 120:
+                line = "#define %s \\\n    %s" % (name, body)
+            lines.append(line)
+        return lines
+
+    # -- rte_cfg.c -------------------------------------------------------------------------------
+
+    def emit_source(self):
+        m = self.m
+        plan = self.plan()
+        explicit = m.explicit_signals()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "rte_cfg.c",
+                              "RTE Configuration - Buffers, Copy Plan, Ports and Connections",
+                              ["Buffers and tables declared in rte_cfg.h. The STATIC_ASSERTs pin the",
+                               "type layouts the copy plan and the port sizes were computed from."]),
+               banner("c", "INCLUDE FILES"), '#include "rte.h"', "",
+               banner("c", "LAYOUT CHECKS")]
+        for dtype in [t for t in m.types.values() if t.kind == "struct"]:
+            out += self.layout_asserts(dtype.ctype, dtype.name, dtype.members, dtype.size)
+        for group in m.implicit_groups():
+            out += self.layout_asserts("Rte_Grp%sType" % group.name, group.name, group.placed, group.size)
+        placed, size = self.buffer_block(m.global_groups())
+        out += self.layout_asserts("Rte_GlobalBuffersType", "Rte_Global", placed, size)
+        hot = [(name, g, offset) for name, g, offset in placed if g in m.hot_groups()]
+        if hot and hot[-1][2] + hot[-1][1].size <= HOT_LINE_SIZE:
+            last, group, _ = hot[-1]
+            out.append('STATIC_ASSERT((OFFSETOF(Rte_GlobalBuffersType, %s) + %dU) <= RTE_CACHE_LINE_SIZE,\n'
+                       '              "%s groups span cache lines");' % (last, group.size, m.hot_task().name))
+        for task in m.tasks:
+            buffers = self.task_buffers(task)
+            if buffers:
+                placed, size = self.buffer_block(buffers)
+                out.append('STATIC_ASSERT(sizeof(Rte_%sBuffersType) == %dU, "Rte_%s layout");' %
+                           (task.cname, size, task.cname))
+                if task is m.hot_task() and size <= HOT_LINE_SIZE:
+                    out.append('STATIC_ASSERT(sizeof(Rte_%sBuffersType) <= RTE_CACHE_LINE_SIZE, '
+                               '"%s buffers span cache lines");' % (task.cname, task.name))
+        for group, element, dtype, kind in explicit:
+            if kind != "seqlock":
+                out.append('STATIC_ASSERT(sizeof(%s) <= %dU, "%s.%s not single-copy atomic");' %
+                           (self.signal_var(group, element), ATOMIC_MAX_SIZE, group.name, element))
+        for index, code in enumerate(RUNTIME_ERRORS):
+            out.append('STATIC_ASSERT(%s == 0x%02XU, "Rte_ErrorRoute index");' % (code, RUNTIME_ERROR_FIRST + index))
+        queues = m.queue_list()
+        out.append("")
+
+        out.append(banner("c", "LOCAL MACROS"))
+        out += ["/** @brief Byte range [first, end) of a group */",
+                "#define RTE_BLOCK(dst, src, first, end, flags) \\",
+                "    { (uint8 *)&(dst) + (first), (const uint8 *)&(src) + (first), (uint16)((end) - (first)), (flags) }",
+                ""]
+
+        out.append(banner("c", "GLOBAL VARIABLES"))
+        out.append("Rte_GlobalBuffersType Rte_Global ALIGNED(RTE_CACHE_LINE_SIZE);")
+        for task in m.tasks:
+            if self.task_buffers(task):
+                out.append("Rte_%sBuffersType Rte_%s ALIGNED(RTE_CACHE_LINE_SIZE);" % (task.cname, task.cname))
+        out.append("")
+        for group, element, dtype, kind in explicit:
+            if kind == "direct":
+                out.append("volatile %s %s;" % (dtype.ctype, self.signal_var(group, element)))
+            elif kind == "connection":
+                out.append("VAR_SECTION(RTE_SHARED_SECTION) volatile %s %s;" %
+                           (dtype.ctype, self.signal_var(group, element)))
+        out.append("")
+
+        seqlocks = [s for s in explicit if s[3] == "seqlock"]
+        if seqlocks or queues or m.event_runnables or m.channels:
+            out.append(banner("c", "LOCAL VARIABLES"))
+        if seqlocks:
+            for group, element, dtype, _ in seqlocks:
+                # Replicated ports are read on the writer's core only
+                section = "" if m.replica_of(group, element) else "VAR_SECTION(RTE_SHARED_SECTION) "
+                out.append("STATIC %sRte_SeqlockStateType Rte_Seqlock_%s_%s;" % (section, group.name, element))
+                out.append("STATIC %s%s Rte_SeqlockData_%s_%s[2];" % (section, dtype.ctype, group.name, element))
+            out.append("")
+        for channel in m.channels:
+            words = channel.batch_words
+            out += ["/* %s: handshake and batch buffer shared, staging on %s, receive on %s */" %
+                    (channel.name, channel.source, channel.target),
+                    "STATIC VAR_SECTION(RTE_SHARED_SECTION) Rte_LockstepLinkType Rte_LockstepLink_%s;" % channel.name,
+                    "STATIC VAR_SECTION(RTE_SHARED_SECTION) uint32 Rte_LockstepShared_%s[%d];" % (channel.name, words),
+                    "STATIC Rte_LockstepTxStateType Rte_LockstepTx_%s;" % channel.name,
+                    "STATIC uint32 Rte_LockstepStaging_%s[%d] ALIGNED(RTE_CACHE_LINE_SIZE);" % (channel.name, words),
+                    "STATIC Rte_LockstepRxStateType Rte_LockstepRx_%s;" % channel.name,
+                    "STATIC uint32 Rte_LockstepReceive_%s[%d];" % (channel.name, words)]
+            for replica in channel.replicas:
+                out.append("STATIC %s %s;" % (replica.dtype.ctype, replica.dtype.declarator(self.replica_var(replica))))
+            out.append("")
+        for queue in queues:
+            section = "VAR_SECTION(RTE_SHARED_SECTION) " if queue.shared else ""
+            out.append("STATIC %sRte_QueueStateType Rte_QueueState_%s;" % (section, queue.name))
+            out.append("STATIC %s%s %s ALIGNED(RTE_CACHE_LINE_SIZE);" %
+                       (section, queue.dtype.ctype,
+                        queue.dtype.declarator("Rte_QueueBuffer_%s[%d]" % (queue.name, queue.length))))
+            if queue.multi_producer:
+                out.append("STATIC %svolatile uint32 Rte_QueueSequence_%s[%d];" % (section, queue.name, queue.length))
+            out.append("")
+        for run in m.event_runnables:
+            # Raised from any core and from interrupt level
+            out.append("STATIC VAR_SECTION(RTE_SHARED_SECTION) volatile uint32 Rte_EventPending_%s;" % run.symbol)
+        if m.event_runnables:
+            out.append("")
+
+        out.append(banner("c", "LOCAL CONSTANTS"))
+        for task in m.tasks:
+            for direction, blocks in (("Fill", plan[task][0]), ("Flush", plan[task][1])):
+                if not blocks:
+                    continue
+                out.append("static const Rte_CopyBlockType Rte_%s_%s[%d] =" % (direction, task.cname, len(blocks)))
+                out.append("{")
+                rows = []
+                for group, first, end, locked in blocks:
+                    local = self.local_buffer(task, group)
+                    glob = self.global_buffer(group)
+                    dst, src = (local, glob) if direction == "Fill" else (glob, local)
+                    rows.append("    RTE_BLOCK(%s, %s, %dU, %dU, %s)" %
+                                (dst, src, first, end, "RTE_COPY_LOCKED" if locked else "0U"))
+                out.append(",\n".join(rows))
+                out += ["};", ""]
+
+        out.append(banner("c", "GLOBAL CONSTANTS"))
+        out += ["const Rte_TaskCopyPlanType Rte_CopyPlan[OS_TASK_COUNT] =", "{"]
+        cells = []
+        for task in m.tasks:
+            fill, flush = plan[task]
+            cells.append(("Rte_Fill_%s," % task.cname if fill else "NULL_PTR,",
+                          "Rte_Flush_%s," % task.cname if flush else "NULL_PTR,",
+                          "%dU," % len(fill), "%dU" % len(flush), task.name))
+        widths = [max(len(c[i]) for c in cells) for i in range(4)]
+        out.append("    /* %s %s %s %s */" % ("fill,".ljust(widths[0]), "flush,".ljust(widths[1]),
+                                              "fill_count,".ljust(widths[2]), "flush_count"))
+        rows = ["    { %s %s %s %s }   /* %s */" % (c[0].ljust(widths[0]), c[1].ljust(widths[1]),
+                                                    c[2].ljust(widths[2]), c[3], c[4]) for c in cells]
+        out.append(join_rows(rows))
+        out += ["};", ""]
+
+        out += ["const Rte_SeqlockPortType Rte_SeqlockPort[RTE_SEQLOCK_PORT_COUNT] =", "{"]
+        rows = []
+        for group, element, dtype, _ in seqlocks:
+            rows.append("    { &Rte_Seqlock_%s_%s,\n      { &Rte_SeqlockData_%s_%s[0], &Rte_SeqlockData_%s_%s[1] },\n"
+                        "      (uint16)sizeof(%s) }" % (group.name, element, group.name, element, group.name, element,
+                                                       dtype.ctype))
+        out.append(",\n".join(rows) if rows else "    { NULL_PTR, { NULL_PTR, NULL_PTR }, 0U }")
+        out += ["};", ""]
+
+        connections = [s for s in explicit if s[3] == "connection"]
+        out += ["const Rte_ConnectionType Rte_Connection[RTE_CONNECTION_COUNT] =", "{"]
+        rows = ["    { &%s, (uint8)sizeof(%s) }" % (self.signal_var(g, e), self.signal_var(g, e))
+                for g, e, _, _ in connections]
+        out.append(",\n".join(rows) if rows else "    { NULL_PTR, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_ReplicaType Rte_Replica[RTE_REPLICA_COUNT] =", "{"]
+        rows = []
+        for replica in m.replica_list():
+            group, element = replica.group, replica.element
+            if replica.dtype.kind == "value" and replica.dtype.size <= ATOMIC_MAX_SIZE:
+                source, port = "&%s" % self.signal_var(group, element), "0U"
+            else:
+                source, port = "NULL_PTR", self.seqlock_id(group, element)
+            rows.append("    { %s, &%s,\n      (uint16)sizeof(%s), %s, %s }" %
+                        (source, self.replica_var(replica), self.replica_var(replica), port,
+                         self.channel_id(replica.channel)))
+        out.append(",\n".join(rows) if rows else "    { NULL_PTR, NULL_PTR, 0U, 0U, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_LockstepChannelType Rte_LockstepChannel[RTE_LOCKSTEP_CHANNEL_COUNT] =", "{"]
+        rows = ["    { &Rte_LockstepLink_%s, Rte_LockstepShared_%s,\n"
+                "      &Rte_LockstepTx_%s, Rte_LockstepStaging_%s,\n"
+                "      &Rte_LockstepRx_%s, Rte_LockstepReceive_%s,\n"
+                "      %dU, %dU, %s, %s }" %
+                ((c.name,) * 6 + (c.replicas[0].index, len(c.replicas), c.source, c.target)) for c in m.channels]
+        out.append(",\n".join(rows) if rows else
+                   "    { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, 0U, 0U, 0U, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_QueueType Rte_Queue[RTE_QUEUE_COUNT] =", "{"]
+        rows = ["    { &Rte_QueueState_%s,\n      Rte_QueueBuffer_%s,\n      %s,\n"
+                "      (uint16)sizeof(Rte_QueueBuffer_%s[0]), %dU,\n      %s, %s }" %
+                (q.name, q.name, "Rte_QueueSequence_%s" % q.name if q.multi_producer else "NULL_PTR", q.name, q.length,
+                 self.event_id(q.events["received"]) if "received" in q.events else "RTE_NO_EVENT",
+                 self.event_id(q.events["error"]) if "error" in q.events else "RTE_NO_EVENT")
+                for q in queues]
+        out.append(",\n".join(rows) if rows else
+                   "    { NULL_PTR, NULL_PTR, NULL_PTR, 0U, 0U, RTE_NO_EVENT, RTE_NO_EVENT }")
+        out += ["};", ""]
+
+        out += ["const Rte_EventType Rte_Event[RTE_EVENT_COUNT] =", "{"]
+        rows = ["    { %s, %s }" % (self.runnable_id(e.runnable), self.event_mask(e)) for e in m.data_events]
+        out.append(",\n".join(rows) if rows else "    { 0U, 0UL }")
+        out += ["};", ""]
+
+        out += ["const Rte_EventRunnableType Rte_EventRunnable[RTE_RUNNABLE_COUNT] =", "{"]
+        rows = ["    { &Rte_EventPending_%s, %s }" % (r.symbol, r.task.macro) for r in m.event_runnables]
+        out.append(",\n".join(rows) if rows else "    { NULL_PTR, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_RecorderChannelType Rte_RecorderChannel[RTE_RECORDER_CHANNEL_COUNT] =", "{"]
+        rows = ["    { &%s, (uint16)sizeof(%s), %s }" %
+                (self.global_buffer(g), self.global_buffer(g), "RTE_RECORDER_INPUT" if replayed else "0U")
+                for g, replayed in m.recorded]
+        out.append(",\n".join(rows) if rows else "    { NULL_PTR, 0U, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_TraceHopType Rte_TraceHop[RTE_TRACE_HOP_COUNT] =", "{"]
+        rows = ["    { %s,\n      %s, %s }" %
+                (self.hop_id(h.input) if h.input else "RTE_NO_TRACE_HOP", self.chain_id(h.chain),
+                 h.group.writer_task.macro) for h in m.hops]
+        out.append(",\n".join(rows) if rows else "    { RTE_NO_TRACE_HOP, 0U, 0U }")
+        out += ["};", ""]
+
+        out += ["const Rte_TraceChainType Rte_TraceChain[RTE_TRACE_CHAIN_COUNT] =", "{"]
+        rows = ["    { %s,\n      %s, %dUL }" % (self.hop_id(c.hops[0]), self.hop_id(c.hops[-1]), c.budget_us)
+                for c in m.chains]
+        out.append(",\n".join(rows) if rows else "    { RTE_NO_TRACE_HOP, RTE_NO_TRACE_HOP, 0UL }")
+        out += ["};", ""]
+
+        out += ["const uint32 Rte_TraceTaskHops[OS_TASK_COUNT] =", "{"]
+        rows = []
+        for task in m.tasks:
+            bits = ["(1UL << %s)" % self.hop_id(h) for h in m.hops if h.group.writer_task is task]
+            rows.append("    %s   /* %s */" % (" |\n    ".join(bits) if bits else "0UL", task.name))
+        out.append(join_rows(rows))
+        out += ["};", ""]
+
+        out += ["const Rte_ErrorRouteType Rte_ErrorRoute[RTE_ERROR_ROUTE_COUNT] =", "{"]
+        cells = []
+        for code, det, dem in m.error_route_list():
+            flags = [f for f, on in (("RTE_ERROR_ROUTE_DET", det), ("RTE_ERROR_ROUTE_DEM", dem)) if on]
+            cells.append(("%dU," % (m.dem_events[dem] if dem else 0), " | ".join(flags) or "0U",
+                          "%s -> %s" % (code, dem or ("DET only" if det else "counted only"))))
+        widths = [max(len(c[i]) for c in cells) for i in range(2)]
+        rows = ["    { %s %s }   /* %s */" % (c[0].ljust(widths[0]), c[1].ljust(widths[1]), c[2]) for c in cells]
+        out.append(join_rows(rows))
+        out += ["};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/rte", help="output directory of rte_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"rte_cfg.h": emitter.emit_header(), "rte_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError) as exc:
+        sys.stderr.write("rte_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("rte_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""
+RTE recorder tool - decode and check export images of src/rte/rte_recorder.c
+
+An export image (Rte_Recorder_Export(), or record_file of the SIL runner) is
+a 28-byte header followed by the encoded frames:
+
+    0xFF  frame number (u32 LE), full image     key frame
+    0xFE  n                                     n frames identical to the previous
+    0xFD  tokens covering the image             delta; token t < 0x80 skips t + 1
+                                                bytes, t >= 0x80 is followed by
+                                                (t & 0x7F) + 1 new bytes
+
+The channel layout (signal groups, element offsets and types) is taken from
+the same ARXML the RTE configuration is generated from, and checked against
+the layout ID stored in the recording.
+
+Commands:
+    info    header, frame range and encoding statistics
+    csv     one row per frame (or per change with --changes), one column
+            per data element of the recorded groups
+
+Replaying the recorded inputs into the software is done by the SIL runner
+(simulation/sil, key replay_file), which reports the frames whose outputs
+differ from the recording.
+
+Usage:
+    python3 tools/rte/rte_recorder.py config/autosar/system/rte.arxml info recording.bin
+    python3 tools/rte/rte_recorder.py config/autosar/system/rte.arxml csv recording.bin -o recording.csv
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from rte_generator import Arxml, GeneratorError, Model  # noqa: E402
+
+MAGIC = 0x52455452
+FORMAT_VERSION = 1
+HEADER = struct.Struct("<IBBHIIIIHH")
+
+TAG_KEYFRAME = 0xFF
+TAG_REPEAT = 0xFE
+TAG_DELTA = 0xFD
+
+#: Platform types: name -> struct format
+FORMATS = {
+    "boolean": "B",
+    "uint8": "B",
+    "sint8": "b",
+    "uint16": "H",
+    "sint16": "h",
+    "uint32": "I",
+    "sint32": "i",
+    "float32": "f",
+}
+
+
+class RecordingError(Exception):
+    """Malformed recording or layout mismatch"""
+
+
+def columns(model):
+    """[(column name, image offset, struct format)] of the recorded groups"""
+    result = []
+
+    def add(name, dtype, offset):
+        if dtype.kind == "value":
+            result.append((name, offset, "<" + FORMATS[dtype.name]))
+        elif dtype.kind == "array":
+            for i in range(dtype.length):
+                add("%s[%d]" % (name, i), dtype.base, offset + i * dtype.base.size)
+        else:
+            for member, mtype, moffset in dtype.members:
+                add("%s.%s" % (name, member), mtype, offset + moffset)
+
+    base = 0
+    for group, _ in model.recorded:
+        for element, dtype, offset in group.placed:
+            add("%s.%s" % (group.name, element), dtype, base + offset)
+        base += group.size
+    return result
+
+
+def read_header(data, model):
+    if len(data) <= HEADER.size:
+        raise RecordingError("file too short")
+    (magic, version, channels, image_size, layout_id, first, trigger, frames, fault_id, _) = \
+        HEADER.unpack_from(data)
+    if magic != MAGIC or version != FORMAT_VERSION:
+        raise RecordingError("not an RTE recorder export image (format %d)" % FORMAT_VERSION)
+    if (channels, image_size, layout_id) != (len(model.recorded), sum(g.size for g, _ in model.recorded),
+                                             model.recorder_layout_id()):
+        raise RecordingError("recording does not match the channel layout of the ARXML "
+                             "(layout 0x%08X, ARXML 0x%08X)" % (layout_id, model.recorder_layout_id()))
+    return {"image_size": image_size, "layout_id": layout_id, "first_frame": first,
+            "trigger_frame": trigger, "frames": frames, "fault_id": fault_id}
+
+
+def frames(data, image_size):
+    """Yield (frame number, tag, image bytes) for every recorded frame"""
+    pos = HEADER.size
+    image = None
+    number = None
+    while pos < len(data):
+        tag = data[pos]
+        pos += 1
+        if tag == TAG_KEYFRAME:
+            number = struct.unpack_from("<I", data, pos)[0]
+            image = bytearray(data[pos + 4:pos + 4 + image_size])
+            if len(image) != image_size:
+                raise RecordingError("truncated key frame at offset %d" % (pos - 1))
+            pos += 4 + image_size
+            yield number, tag, bytes(image)
+            number += 1
+        elif image is None:
+            raise RecordingError("recording does not start with a key frame")
+        elif tag == TAG_REPEAT:
+            count = data[pos] if pos < len(data) else 0
+            if count == 0:
+                raise RecordingError("invalid repeat count at offset %d" % pos)
+            pos += 1
+            for _ in range(count):
+                yield number, tag, bytes(image)
+                number += 1
+        elif tag == TAG_DELTA:
+            i = 0
+            while i < image_size:
+                if pos >= len(data):
+                    raise RecordingError("truncated delta frame")
+                token = data[pos]
+                pos += 1
+                run = (token & 0x7F) + 1
+                if i + run > image_size:
+                    raise RecordingError("delta overruns the image at offset %d" % (pos - 1))
+                if token & 0x80:
+                    image[i:i + run] = data[pos:pos + run]
+                    pos += run
+                i += run
+            yield number, tag, bytes(image)
+            number += 1
+        else:
+            raise RecordingError("unknown tag 0x%02X at offset %d" % (tag, pos - 1))
+
+
+def cmd_info(model, data, header, _args):
+    counts = {TAG_KEYFRAME: 0, TAG_REPEAT: 0, TAG_DELTA: 0}
+    last = None
+    for number, tag, _ in frames(data, header["image_size"]):
+        counts[tag] += 1
+        last = number
+    total = sum(counts.values())
+    print("layout       0x%08X, %d channels, %d bytes per image" %
+          (header["layout_id"], len(model.recorded), header["image_size"]))
+    print("channels     %s" % ", ".join("%s%s" % (g.name, " (input)" if replayed else "")
+                                        for g, replayed in model.recorded))
+    print("frames       %d .. %s (%d frames)" % (header["first_frame"], last, total))
+    print("trigger      frame %d, fault 0x%04X" % (header["trigger_frame"], header["fault_id"]))
+    print("encoding     %d key, %d delta, %d repeated; %.2f bytes per frame (raw %d)" %
+          (counts[TAG_KEYFRAME], counts[TAG_DELTA], counts[TAG_REPEAT],
+           (len(data) - HEADER.size) / float(max(total, 1)), header["image_size"]))
+    if header["frames"] != total:
+        raise RecordingError("header announces %d frames, stream holds %d" % (header["frames"], total))
+
+
+def cmd_csv(model, data, header, args):
+    cols = columns(model)
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    try:
+        writer = csv.writer(out)
+        writer.writerow(["frame"] + [name for name, _, _ in cols])
+        previous = None
+        for number, _, image in frames(data, header["image_size"]):
+            if args.changes and image == previous:
+                continue
+            previous = image
+            writer.writerow([number] + [struct.unpack_from(fmt, image, offset)[0] for _, offset, fmt in cols])
+    finally:
+        if out is not sys.stdout:
+            out.close()
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files of the recording software")
+    parser.add_argument("command", choices=("info", "csv"))
+    parser.add_argument("recording", help="export image")
+    parser.add_argument("-o", "--output", help="csv: output file (default: stdout)")
+    parser.add_argument("--changes", action="store_true", help="csv: only frames that differ from the previous")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        if not model.recorded:
+            raise RecordingError("no RteRecorder configured in the ARXML")
+        with open(args.recording, "rb") as handle:
+            data = handle.read()
+        header = read_header(data, model)
+        {"info": cmd_info, "csv": cmd_csv}[args.command](model, data, header, args)
+    except (GeneratorError, RecordingError, OSError) as exc:
+        sys.stderr.write("rte_recorder: error: %s\n" % exc)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,830 @@
+#!/usr/bin/env python3
+"""
+SOME/IP generator - ARXML service interfaces to the SOME/IP configuration (som_cfg.h / .c)
+
+Reads the SOME/IP configuration of the VCU (Som SomGeneral, SomDataTypes,
+SomProvidedServiceInstance and SomConsumedServiceInstance with their event
+groups and events) from one or more ARXML files and emits the static
+configuration consumed by src/bsw/com/som_stack.c:
+
+- som_cfg.h: the general parameters (endpoints, datagram and TP segment
+  length, SD timing), the C type Som_<Type>Type of every SomDataType and the
+  handles of the services, event groups and events. A dynamic array X has an
+  element count XLength next to it. The members of a C type are ordered by
+  alignment, so a type has no padding between members; the wire order is
+  SomElementPosition
+- som_cfg.c: per data type a serializer, a length check and a deserializer.
+  Every element is stored or loaded at a constant offset of the payload (a
+  running position after a dynamic array) in network byte order without
+  padding; a dynamic array has a 32-bit length field with its length in
+  bytes. Arrays of bytes are copied with memcpy(), other arrays in a loop,
+  nested structs by calling the functions of their type. The length check
+  walks only the length fields, so the deserializer needs no checks and
+  writes the shadow only for a valid payload
+- Tables: service instances, event groups, provided events (with their
+  serializer) and consumed events (with the length check, deserializer,
+  shadow and TP reassembly buffer) sorted by SomServiceId / SomEventId for
+  the binary search of Som_RxIndication()
+- SOM_PEER_CODECS: the codecs of the opposite direction, for test peers
+
+Checks: one SomGeneral, dense handles, unique event names per direction,
+unique SomServiceId / SomInstanceId per direction, unique SomEventGroupId
+per service and SomEventId per service, structs of fixed size only as
+elements, no recursive types, every non-TP event fits one datagram, a TP
+segment length that is a multiple of 16 and fits a datagram with the
+SOME/IP and TP headers.
+
+Usage:
+    python3 tools/som/som_generator.py config/autosar/communication/som.arxml -o src/bsw/com
+    python3 tools/som/som_generator.py ... -o src/bsw/com --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, one_ref,
+    parameters, parse_bool, sub_containers)
+
+GENERATOR_VERSION = "1.0.0"
+
+#: SOME/IP header (message ID, length, request ID, versions, type, return code)
+HEADER_LENGTH = 16
+#: SOME/IP-TP header (offset and more segments flag)
+TP_HEADER_LENGTH = 4
+#: SOME/IP-SD header and entries / options array lengths, one IPv4 endpoint option
+SD_FIXED_LENGTH = HEADER_LENGTH + 4 + 4 + 4 + 12
+SD_ENTRY_LENGTH = 16
+#: IPv4 + UDP header
+MAX_DATAGRAM = 65507
+MAX_HANDLE = 0xFFFE
+
+#: SomElementType -> (C type, wire size, alignment, store function, load function)
+PRIMITIVES = {
+    "UINT8": ("uint8", 1, 1, None, None),
+    "SINT8": ("sint8", 1, 1, None, None),
+    "BOOLEAN": ("boolean", 1, 1, None, None),
+    "UINT16": ("uint16", 2, 2, "Som_StoreBe16", "Som_LoadBe16"),
+    "SINT16": ("sint16", 2, 2, "Som_StoreBe16", "Som_LoadBe16"),
+    "UINT32": ("uint32", 4, 4, "Som_StoreBe32", "Som_LoadBe32"),
+    "SINT32": ("sint32", 4, 4, "Som_StoreBe32", "Som_LoadBe32"),
+    "UINT64": ("uint64", 8, 8, "Som_StoreBe64", "Som_LoadBe64"),
+    "SINT64": ("sint64", 8, 8, "Som_StoreBe64", "Som_LoadBe64"),
+    "FLOAT32": ("float32", 4, 4, "Som_StoreF32", "Som_LoadF32"),
+    "FLOAT64": ("float64", 8, 8, "Som_StoreF64", "Som_LoadF64"),
+}
+UNSIGNED_OF = {"sint8": "uint8", "sint16": "uint16", "sint32": "uint32", "sint64": "uint64"}
+
+
+# ------------------------------------------------------------------------------------------------
+# ARXML access
+# ------------------------------------------------------------------------------------------------
+
+def _int(params, name, what, low, high):
+    if name not in params:
+        raise GeneratorError("%s: missing %s" % (what, name))
+    value = int(params[name], 0)
+    if not low <= value <= high:
+        raise GeneratorError("%s: %s must be %d..%d" % (what, name, low, high))
+    return value
+
+
+def _ms(params, name, what):
+    """Duration in seconds to milliseconds"""
+    ms = int(round(float(params[name]) * 1000))
+    if not 0 <= ms <= 3600000:
+        raise GeneratorError("%s: %s must be 0..3600 s" % (what, name))
+    return ms
+
+
+def _ipv4(text, what):
+    parts = text.split(".")
+    if len(parts) != 4 or not all(p.isdigit() and 0 <= int(p) <= 255 for p in parts):
+        raise GeneratorError("%s: %s is not an IPv4 address" % (what, text))
+    return sum(int(p) << (24 - 8 * i) for i, p in enumerate(parts))
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class Element:
+    def __init__(self, name, position, kind, array, dynamic):
+        self.name = name
+        self.position = position
+        self.kind = kind
+        self.struct = None
+        self.array = array
+        self.dynamic = dynamic
+
+    @property
+    def ctype(self):
+        return PRIMITIVES[self.kind][0] if self.struct is None else "Som_%sType" % self.struct.name
+
+    @property
+    def item_size(self):
+        return PRIMITIVES[self.kind][1] if self.struct is None else self.struct.size
+
+    @property
+    def align(self):
+        return PRIMITIVES[self.kind][2] if self.struct is None else self.struct.align
+
+    @property
+    def max_size(self):
+        return (4 if self.dynamic else 0) + self.item_size * max(self.array, 1)
+
+    @property
+    def length_ctype(self):
+        return "uint16" if self.array <= 0xFFFF else "uint32"
+
+
+class DataType:
+    def __init__(self, name):
+        self.name = name
+        self.elements = []
+        self.align = 1
+        self.max_size = 0
+        self.dynamic = False
+        self.done = False
+
+    @property
+    def size(self):
+        return self.max_size
+
+    def members(self):
+        """C members ordered by alignment: (C type, name, array, comment)"""
+        members = []
+        for e in self.elements:
+            members.append((e.align, e.position, 0, e.ctype, e.name, e.array, e))
+            if e.dynamic:
+                members.append((2 if e.length_ctype == "uint16" else 4, e.position, 1,
+                                e.length_ctype, e.name + "Length", 0, None))
+        return [m[3:] for m in sorted(members, key=lambda m: (-m[0], m[1], m[2]))]
+
+
+class EventGroup:
+    def __init__(self, name, group_id, service):
+        self.name = name
+        self.group_id = group_id
+        self.service = service
+        self.handle = 0
+        self.events = []
+
+
+class Event:
+    def __init__(self, name, event_id, handle, dtype, tp, group):
+        self.name = name
+        self.event_id = event_id
+        self.handle = handle
+        self.dtype = dtype
+        self.tp = tp
+        self.group = group
+
+
+class Service:
+    def __init__(self, name, params):
+        self.name = name
+        self.service_id = _int(params, "SomServiceId", name, 0, 0xFFFE)
+        self.instance_id = _int(params, "SomInstanceId", name, 0, 0xFFFE)
+        self.major = _int(params, "SomMajorVersion", name, 0, 0xFE)
+        self.minor = _int(params, "SomMinorVersion", name, 0, 0xFFFFFFFE)
+        self.handle = 0
+        self.groups = []
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.general = {}
+        self.types = []
+        self.provided = []
+        self.consumed = []
+        self.tx_events = []
+        self.rx_events = []
+
+    def build(self):
+        general = list(self.x.containers("SomGeneral"))
+        if len(general) != 1:
+            raise GeneratorError("exactly one SomGeneral required")
+        p = parameters(general[0])
+        g = self.general
+        g["local_address"] = _ipv4(p["SomLocalIpAddress"], "SomGeneral")
+        g["local_port"] = _int(p, "SomLocalPort", "SomGeneral", 1, 0xFFFF)
+        g["sd_address"] = _ipv4(p["SomSdMulticastAddress"], "SomGeneral")
+        g["sd_port"] = _int(p, "SomSdPort", "SomGeneral", 1, 0xFFFF)
+        g["datagram"] = _int(p, "SomMaxDatagramLength", "SomGeneral", 64, MAX_DATAGRAM)
+        g["segment"] = _int(p, "SomTpSegmentLength", "SomGeneral", 16, MAX_DATAGRAM)
+        g["period"] = _ms(p, "SomMainFunctionPeriod", "SomGeneral")
+        for name, key in (("SomSdInitialDelay", "initial"), ("SomSdRepetitionBaseDelay", "repetition"),
+                          ("SomSdCyclicOfferDelay", "cyclic")):
+            g[key] = _ms(p, name, "SomGeneral")
+        g["repetitions"] = _int(p, "SomSdRepetitionsMax", "SomGeneral", 0, 10)
+        g["offer_ttl"] = _int(p, "SomSdOfferTtl", "SomGeneral", 1, 0xFFFFFE)
+        g["subscribe_ttl"] = _int(p, "SomSdSubscribeTtl", "SomGeneral", 1, 0xFFFFFE)
+        g["subscribers"] = _int(p, "SomMaxSubscribers", "SomGeneral", 1, 255)
+        if g["period"] == 0:
+            raise GeneratorError("SomGeneral: SomMainFunctionPeriod must be at least 1 ms")
+        if g["segment"] % 16 != 0:
+            raise GeneratorError("SomGeneral: SomTpSegmentLength must be a multiple of 16")
+        if g["segment"] + HEADER_LENGTH + TP_HEADER_LENGTH > g["datagram"]:
+            raise GeneratorError("SomGeneral: SomTpSegmentLength %d with the SOME/IP and TP headers exceeds "
+                                 "SomMaxDatagramLength %d" % (g["segment"], g["datagram"]))
+
+        self.build_types()
+        self.provided = self.services("Provided")
+        self.consumed = self.services("Consumed")
+        if not self.provided or not self.consumed:
+            raise GeneratorError("at least one provided and one consumed service instance required")
+        self.tx_events = dense([e for s in self.provided for grp in s.groups for e in grp.events],
+                               "SomEventHandleId of provided events", MAX_HANDLE)
+        self.rx_events = dense([e for s in self.consumed for grp in s.groups for e in grp.events],
+                               "SomEventHandleId of consumed events", MAX_HANDLE)
+        for events, what in ((self.tx_events, "provided"), (self.rx_events, "consumed")):
+            if len(set(e.name for e in events)) != len(events):
+                raise GeneratorError("%s event names must be unique" % what)
+            for e in events:
+                if not e.tp and e.dtype.max_size + HEADER_LENGTH > g["datagram"]:
+                    raise GeneratorError("%s: %d bytes do not fit SomMaxDatagramLength %d; enable "
+                                         "SomEventSegmentation" % (e.name, e.dtype.max_size, g["datagram"]))
+        self.sd_entries = (len(self.provided) + len(self.consumed) +
+                           len(self.provided_groups()) + len(self.consumed_groups()))
+        if SD_FIXED_LENGTH + SD_ENTRY_LENGTH * self.sd_entries > g["datagram"]:
+            raise GeneratorError("SomGeneral: SomMaxDatagramLength too short for an SD message with %d entries"
+                                 % self.sd_entries)
+
+    def build_types(self):
+        containers = list(self.x.containers("SomDataType"))
+        by_path = {}
+        for elem in containers:
+            t = DataType(child_text(elem, "SHORT-NAME"))
+            by_path[self.x.path_of[elem]] = (t, elem)
+        if len(set(t.name for t, _ in by_path.values())) != len(by_path):
+            raise GeneratorError("SomDataType names must be unique")
+        self.type_by_path = {path: t for path, (t, _) in by_path.items()}
+        for path, (t, elem) in by_path.items():
+            for sub in sub_containers(elem, "SomDataTypeElement"):
+                name = child_text(sub, "SHORT-NAME")
+                what = "%s.%s" % (t.name, name)
+                p = parameters(sub)
+                kind = p.get("SomElementType", "")
+                if kind not in PRIMITIVES and kind != "STRUCT":
+                    raise GeneratorError("%s: unsupported SomElementType %s" % (what, kind))
+                e = Element(name, _int(p, "SomElementPosition", what, 0, 0xFFFF), kind,
+                            _int(p, "SomElementArraySize", what, 1, 0xFFFFFF) if "SomElementArraySize" in p else 0,
+                            parse_bool(p.get("SomElementDynamicLength", "false")))
+                if e.dynamic and e.array == 0:
+                    raise GeneratorError("%s: SomElementDynamicLength requires SomElementArraySize" % what)
+                if kind == "STRUCT":
+                    ref = one_ref(sub, "SomElementDataTypeRef", what)
+                    if ref not in self.type_by_path:
+                        raise GeneratorError("%s: %s is not a SomDataType" % (what, ref))
+                    e.struct = self.type_by_path[ref]
+                t.elements.append(e)
+            t.elements.sort(key=lambda e: e.position)
+            if not t.elements or [e.position for e in t.elements] != list(range(len(t.elements))):
+                raise GeneratorError("%s: SomElementPosition must be dense from 0" % t.name)
+        for t in self.type_by_path.values():
+            self.resolve_type(t, [])
+
+    def resolve_type(self, t, stack):
+        """Size and alignment of a type after its struct elements, in dependency order"""
+        if t.done:
+            return
+        if t in stack:
+            raise GeneratorError("recursive SomDataType %s" % " -> ".join(s.name for s in stack + [t]))
+        for e in t.elements:
+            if e.struct is not None:
+                self.resolve_type(e.struct, stack + [t])
+                if e.struct.dynamic:
+                    raise GeneratorError("%s.%s: struct %s has a dynamic array; only structs of fixed size "
+                                         "can be elements" % (t.name, e.name, e.struct.name))
+        t.align = max(max(e.align for e in t.elements), 2 if any(e.dynamic for e in t.elements) else 1)
+        t.max_size = sum(e.max_size for e in t.elements)
+        t.dynamic = any(e.dynamic for e in t.elements)
+        t.done = True
+        self.types.append(t)
+
+    def services(self, kind):
+        services = []
+        for elem in self.x.containers("Som%sServiceInstance" % kind):
+            s = Service(child_text(elem, "SHORT-NAME"), parameters(elem))
+            for sub in sub_containers(elem, "Som%sEventGroup" % kind):
+                name = child_text(sub, "SHORT-NAME")
+                grp = EventGroup(name, _int(parameters(sub), "SomEventGroupId", name, 0, 0xFFFE), s)
+                for ev in sub_containers(sub, "Som%sEvent" % kind):
+                    ename = child_text(ev, "SHORT-NAME")
+                    p = parameters(ev)
+                    ref = one_ref(ev, "SomEventDataTypeRef", ename)
+                    if ref not in self.type_by_path:
+                        raise GeneratorError("%s: %s is not a SomDataType" % (ename, ref))
+                    grp.events.append(Event(ename, _int(p, "SomEventId", ename, 0x8000, 0xFFFE),
+                                            _int(p, "SomEventHandleId", ename, 0, MAX_HANDLE),
+                                            self.type_by_path[ref],
+                                            parse_bool(p.get("SomEventSegmentation", "false")), grp))
+                if not grp.events:
+                    raise GeneratorError("%s: event group without events" % name)
+                s.groups.append(grp)
+            if not s.groups:
+                raise GeneratorError("%s: service instance without event groups" % s.name)
+            if len(set(grp.group_id for grp in s.groups)) != len(s.groups):
+                raise GeneratorError("%s: SomEventGroupId must be unique" % s.name)
+            event_ids = [e.event_id for grp in s.groups for e in grp.events]
+            if len(set(event_ids)) != len(event_ids):
+                raise GeneratorError("%s: SomEventId must be unique" % s.name)
+            services.append(s)
+        keys = [(s.service_id, s.instance_id) for s in services]
+        if len(set(keys)) != len(keys):
+            raise GeneratorError("%s service instances must have unique SomServiceId / SomInstanceId" % kind)
+        if kind == "Consumed" and len(set(k[0] for k in keys)) != len(keys):
+            raise GeneratorError("consumed services must have unique SomServiceId (events carry no instance)")
+        if len(services) > MAX_HANDLE:
+            raise GeneratorError("more than %d %s service instances" % (MAX_HANDLE, kind))
+        for index, s in enumerate(services):
+            s.handle = index
+        handle = 0
+        for s in services:
+            for grp in s.groups:
+                grp.handle = handle
+                handle += 1
+        return services
+
+    def provided_groups(self):
+        return [grp for s in self.provided for grp in s.groups]
+
+    def consumed_groups(self):
+        return [grp for s in self.consumed for grp in s.groups]
+
+    def tx_buffer_length(self):
+        length = 0
+        for e in self.tx_events:
+            header = HEADER_LENGTH + (TP_HEADER_LENGTH if e.tp else 0)
+            length = max(length, header + e.dtype.max_size)
+        return (length + 7) // 8 * 8
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+def ipv4_text(address):
+    return ".".join(str((address >> shift) & 0xFF) for shift in (24, 16, 8, 0))
+
+
+class Offset:
+    """Payload offset: a constant, or the running position pos plus a constant"""
+
+    def __init__(self, dynamic=False, const=0):
+        self.dynamic = dynamic
+        self.const = const
+
+    def plus(self, n):
+        return Offset(self.dynamic, self.const + n)
+
+    def index(self, scale=0):
+        """Buffer index expression, scale > 0 adds the loop term scale * i"""
+        loop = "" if scale == 0 else ("i" if scale == 1 else "(%dU * i)" % scale)
+        if not self.dynamic:
+            if not loop:
+                return "%d" % self.const
+            if self.const == 0:
+                return "i" if scale == 1 else "%dU * i" % scale
+            return "%dU + %s" % (self.const, loop)
+        parts = ["pos"] + (["%dU" % self.const] if self.const else []) + ([loop] if loop else [])
+        return " + ".join(parts)
+
+
+class Codec:
+    """Serializer, length check and deserializer of one data type"""
+
+    def __init__(self, dtype):
+        self.t = dtype
+
+    @staticmethod
+    def store(kind, dst, value):
+        ctype, size, _, store, _ = PRIMITIVES[kind]
+        if size == 1:
+            return "Buffer[%s] = %s;" % (dst, value if ctype != "sint8" else "(uint8)%s" % value)
+        if ctype in UNSIGNED_OF:
+            value = "(%s)%s" % (UNSIGNED_OF[ctype], value)
+        return "%s(&Buffer[%s], %s);" % (store, dst, value)
+
+    @staticmethod
+    def load(kind, src, target):
+        ctype, size, _, _, load = PRIMITIVES[kind]
+        if ctype == "boolean":
+            return "%s = (Buffer[%s] != 0U) ? TRUE : FALSE;" % (target, src)
+        if size == 1:
+            return "%s = %sBuffer[%s];" % (target, "(sint8)" if ctype == "sint8" else "", src)
+        cast = "(%s)" % ctype if ctype in UNSIGNED_OF else ""
+        return "%s = %s%s(&Buffer[%s]);" % (target, cast, load, src)
+
+    def element(self, e, at, serialize, count):
+        """Statements of one element at Offset at; count: element count expression of an array"""
+        lines = []
+        if e.array == 0:
+            if e.struct is not None:
+                if serialize:
+                    lines.append("(void)Som_Serialize_%s(&d->%s, &Buffer[%s]);" % (e.struct.name, e.name, at.index()))
+                else:
+                    lines.append("Som_Deserialize_%s(&Buffer[%s], &d->%s);" % (e.struct.name, at.index(), e.name))
+            elif serialize:
+                lines.append(self.store(e.kind, at.index(), "d->%s" % e.name))
+            else:
+                lines.append(self.load(e.kind, at.index(), "d->%s" % e.name))
+            return lines
+        if e.kind in ("UINT8", "SINT8"):
+            size = count if count[0].isdigit() else "(uint32)%s" % count
+            if serialize:
+                return ["(void)memcpy(&Buffer[%s], d->%s, %s);" % (at.index(), e.name, size)]
+            return ["(void)memcpy(d->%s, &Buffer[%s], %s);" % (e.name, at.index(), size)]
+        item = at.index(e.item_size)
+        if e.struct is not None:
+            body = ("(void)Som_Serialize_%s(&d->%s[i], &Buffer[%s]);" % (e.struct.name, e.name, item) if serialize
+                    else "Som_Deserialize_%s(&Buffer[%s], &d->%s[i]);" % (e.struct.name, item, e.name))
+        elif serialize:
+            body = self.store(e.kind, item, "d->%s[i]" % e.name)
+        else:
+            body = self.load(e.kind, item, "d->%s[i]" % e.name)
+        return ["for (i = 0U; i < %s; i++)" % count, "{", "    " + body, "}"]
+
+    def walk(self, serialize):
+        """Statements of all elements in wire order"""
+        lines = []
+        at = Offset()
+        for e in self.t.elements:
+            if not e.dynamic:
+                lines += self.element(e, at, serialize, "%dU" % e.array)
+                at = at.plus(e.max_size)
+                continue
+            count = "d->%sLength" % e.name
+            if serialize:
+                lines.append("Som_StoreBe32(&Buffer[%s], (uint32)%s%s);" %
+                             (at.index(), count, "" if e.item_size == 1 else " * %dU" % e.item_size))
+            elif e.item_size == 1:
+                lines.append("%s = (%s)Som_LoadBe32(&Buffer[%s]);" % (count, e.length_ctype, at.index()))
+            else:
+                lines.append("%s = (%s)(Som_LoadBe32(&Buffer[%s]) / %dU);" %
+                             (count, e.length_ctype, at.index(), e.item_size))
+            lines += self.element(e, at.plus(4), serialize, count)
+            grow = "(uint32)%s" % count if e.item_size == 1 else "(%dU * (uint32)%s)" % (e.item_size, count)
+            if at.dynamic:
+                lines.append("pos += %dU + %s;" % (at.const + 4, grow))
+            else:
+                lines.append("pos = %dU + %s;" % (at.const + 4, grow))
+            at = Offset(True, 0)
+        return lines, at
+
+    def locals(self, pointer, lines):
+        out = ["    %s d =" % pointer,
+               "        (%s)Data;" % pointer]
+        if any("[i]" in line for line in lines):
+            out.append("    uint32 i;")
+        if any("pos" in line for line in lines):
+            out.append("    uint32 pos;")
+        return out + [""]
+
+    def serializer(self):
+        t = self.t
+        pointer = "P2CONST(Som_%sType, AUTOMATIC, SOM_APPL_DATA)" % t.name
+        out = ["/**",
+               " * @brief Serialize %s (%s)" % (t.name, ("at most %d bytes" % t.max_size) if t.dynamic
+                                                 else "%d bytes" % t.max_size),
+               " */",
+               "STATIC uint32 Som_Serialize_%s(P2CONST(void, AUTOMATIC, SOM_APPL_DATA) Data," % t.name,
+               "    P2VAR(uint8, AUTOMATIC, SOM_VAR) Buffer)",
+               "{"]
+        lines, end = self.walk(True)
+        lines.append("return %s;" % ("%dU" % end.const if not end.dynamic else end.index()))
+        out += self.locals(pointer, lines)
+        dynamic = [e for e in t.elements if e.dynamic]
+        if dynamic:
+            cond = " ||\n        ".join("(d->%sLength > %dU)" % (e.name, e.array) for e in dynamic)
+            out += ["    if %s" % (cond if len(dynamic) == 1 else "(%s)" % cond), "    {", "        return SOM_SER_ERROR;", "    }"]
+        out += ["    " + line for line in lines[:-1]] + ["", "    " + lines[-1], "}", ""]
+        return out
+
+    def check(self):
+        t = self.t
+        out = ["/**",
+               " * @brief Serialized length of a %s payload, SOM_SER_ERROR if malformed" % t.name,
+               " */",
+               "STATIC uint32 Som_Check_%s(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer, uint32 Length)" % t.name,
+               "{"]
+        if not t.dynamic:
+            out += ["    (void)Buffer;",
+                    "    return (Length >= %dUL) ? %dUL : SOM_SER_ERROR;" % (t.max_size, t.max_size),
+                    "}", ""]
+            return out
+        out += ["    uint32 pos;", "    uint32 bytes;", ""]
+        gap = 0
+        first = True
+        for e in t.elements:
+            if not e.dynamic:
+                gap += e.max_size
+                continue
+            if first:
+                out.append("    pos = %dUL;" % gap)
+            else:
+                out.append("    pos += 4UL + bytes%s;" % (" + %dUL" % gap if gap else ""))
+            first = False
+            cond = ["(bytes > %dUL)" % (e.array * e.item_size)]
+            if e.item_size > 1:
+                cond.append("((bytes %% %dUL) != 0UL)" % e.item_size)
+            cond.append("(bytes > (Length - pos - 4UL))")
+            out += ["    if (Length < (pos + 4UL))",
+                    "    {",
+                    "        return SOM_SER_ERROR;",
+                    "    }",
+                    "    bytes = Som_LoadBe32(&Buffer[pos]);",
+                    "    if (%s)" % " || ".join(cond),
+                    "    {",
+                    "        return SOM_SER_ERROR;",
+                    "    }"]
+            gap = 0
+        out.append("    pos += 4UL + bytes%s;" % (" + %dUL" % gap if gap else ""))
+        out += ["", "    return (pos <= Length) ? pos : SOM_SER_ERROR;", "}", ""]
+        return out
+
+    def deserializer(self):
+        t = self.t
+        pointer = "P2VAR(Som_%sType, AUTOMATIC, SOM_APPL_DATA)" % t.name
+        out = ["/**",
+               " * @brief Deserialize a %s payload of valid length" % t.name,
+               " */",
+               "STATIC void Som_Deserialize_%s(P2CONST(uint8, AUTOMATIC, SOM_VAR) Buffer," % t.name,
+               "    P2VAR(void, AUTOMATIC, SOM_APPL_DATA) Data)",
+               "{"]
+        lines, _ = self.walk(False)
+        if lines[-1].startswith("pos "):
+            lines = lines[:-1]           # Nothing behind the last dynamic array
+        out += self.locals(pointer, lines)
+        out += ["    " + line for line in lines]
+        out += ["}", ""]
+        return out
+
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_events(self):
+        rows = ["| Event                | Dir | Service                   | Group | Event ID | Type            | Bytes  | TP  |",
+                "|----------------------|-----|---------------------------|-------|----------|-----------------|--------|-----|"]
+        for direction, events in (("TX", self.m.tx_events), ("RX", self.m.rx_events)):
+            for e in events:
+                s = e.group.service
+                rows.append("| %-20s | %-3s | %-25s | %-5d | 0x%04X   | %-15s | %-6s | %-3s |" %
+                            (e.name, direction, "%s 0x%04X" % (s.name, s.service_id), e.group.group_id,
+                             e.event_id, e.dtype.name,
+                             ("<=%d" if e.dtype.dynamic else "%d") % e.dtype.max_size, "yes" if e.tp else "-"))
+        return rows
+
+    # -- som_cfg.h -------------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        g = m.general
+        details = ["General parameters, data types and handles of the SOME/IP configuration of",
+                   "the VCU (local endpoint %s:%d, SD %s:%d):" % (ipv4_text(g["local_address"]), g["local_port"],
+                                                                   ipv4_text(g["sd_address"]), g["sd_port"]),
+                   ""]
+        details += self.doc_events()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "som_cfg.h",
+                              "SOME/IP Configuration - Data Types and Handles", details),
+               "#ifndef SOM_CFG_H",
+               "#define SOM_CFG_H",
+               "",
+               banner("h", "GENERAL PARAMETERS"),
+               define("SOM_LOCAL_ADDRESS", "0x%08XUL   /* %s */" % (g["local_address"],
+                                                                    ipv4_text(g["local_address"]))),
+               define("SOM_LOCAL_PORT", "%dU" % g["local_port"]),
+               define("SOM_SD_MULTICAST_ADDRESS", "0x%08XUL   /* %s */" % (g["sd_address"],
+                                                                           ipv4_text(g["sd_address"]))),
+               define("SOM_SD_PORT", "%dU" % g["sd_port"]),
+               "",
+               define("SOM_MAX_DATAGRAM_LENGTH", "%dU" % g["datagram"]),
+               define("SOM_TP_SEGMENT_LENGTH", "%dU" % g["segment"]),
+               define("SOM_TX_BUFFER_LENGTH", "%dU" % m.tx_buffer_length()),
+               define("SOM_SD_MAX_ENTRIES", "%dU" % m.sd_entries),
+               "",
+               define("SOM_MAIN_FUNCTION_PERIOD_MS", "%dUL" % g["period"]),
+               define("SOM_SD_INITIAL_DELAY_MS", "%dUL" % g["initial"]),
+               define("SOM_SD_REPETITION_BASE_DELAY_MS", "%dUL" % g["repetition"]),
+               define("SOM_SD_REPETITIONS_MAX", "%dU" % g["repetitions"]),
+               define("SOM_SD_CYCLIC_OFFER_DELAY_MS", "%dUL" % g["cyclic"]),
+               define("SOM_SD_OFFER_TTL", "%dUL" % g["offer_ttl"]),
+               define("SOM_SD_SUBSCRIBE_TTL", "%dUL" % g["subscribe_ttl"]),
+               define("SOM_MAX_SUBSCRIBERS", "%dU" % g["subscribers"]),
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("SOM_PROVIDED_SERVICE_COUNT", "%dU" % len(m.provided)),
+               define("SOM_CONSUMED_SERVICE_COUNT", "%dU" % len(m.consumed)),
+               define("SOM_PROVIDED_EVENTGROUP_COUNT", "%dU" % len(m.provided_groups())),
+               define("SOM_CONSUMED_EVENTGROUP_COUNT", "%dU" % len(m.consumed_groups())),
+               define("SOM_TX_EVENT_COUNT", "%dU" % len(m.tx_events)),
+               define("SOM_RX_EVENT_COUNT", "%dU" % len(m.rx_events)),
+               "",
+               banner("h", "DATA TYPES")]
+        for t in m.types:
+            out += ["/** @brief SomDataType %s, %s bytes serialized */" %
+                    (t.name, ("at most %d" if t.dynamic else "%d") % t.max_size),
+                    "typedef struct",
+                    "{"]
+            members = t.members()
+            width = max(7, max(len(m[0]) for m in members))
+            for ctype, name, array, e in members:
+                decl = "%s%s;" % (name, "[%dU]" % array if array else "")
+                if e is None:
+                    comment = "Elements in %s" % name[:-len("Length")]
+                else:
+                    comment = "Wire position %d%s" % (e.position, ", dynamic" if e.dynamic else "")
+                out.append("    %s %s/**< %s */" % (ctype.ljust(width), decl.ljust(44 - width), comment))
+            out += ["} Som_%sType;" % t.name, ""]
+
+        out.append(banner("h", "SERVICE INSTANCE HANDLES"))
+        for kind, services in (("Provided", m.provided), ("Consumed", m.consumed)):
+            for s in services:
+                out.append(define("SomConf_Som%sService_%s" % (kind, s.name), "%dU" % s.handle))
+        out += ["", banner("h", "EVENT GROUP HANDLES")]
+        for kind, groups in (("Provided", m.provided_groups()), ("Consumed", m.consumed_groups())):
+            for grp in groups:
+                out.append(define("SomConf_Som%sEventGroup_%s" % (kind, grp.name), "%dU" % grp.handle))
+        out += ["", banner("h", "EVENT HANDLES (Som_SendEvent / Som_ReceiveEvent)")]
+        for kind, events in (("Tx", m.tx_events), ("Rx", m.rx_events)):
+            for e in events:
+                out.append(define("SomConf_Som%sEvent_%s" % (kind, e.name), "%dU" % e.handle))
+        out += ["",
+                "#endif /* SOM_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- som_cfg.c -------------------------------------------------------------------------------
+
+    @staticmethod
+    def aligned(rows):
+        """Table rows from (fields, comment), fields left aligned in columns"""
+        widths = [max(len(fields[i]) + 1 for fields, _ in rows) for i in range(len(rows[0][0]) - 1)]
+        return ["    { %s %s }   /* %s */" % (" ".join((f + ",").ljust(w) for f, w in zip(fields, widths)),
+                                              fields[-1], comment) for fields, comment in rows]
+
+    @staticmethod
+    def list_rows(items):
+        """Initializer rows from (value, comment) with aligned comments"""
+        width = max(len(value) for value, _ in items) + 1
+        return "\n".join("    %s   /* %s */" % ((value + ("," if i < len(items) - 1 else "")).ljust(width), comment)
+                         for i, (value, comment) in enumerate(items))
+
+    def service_rows(self, services):
+        return self.aligned([(["%dUL" % s.minor, "0x%04XU" % s.service_id, "0x%04XU" % s.instance_id,
+                               "%dU" % s.groups[0].handle, "%dU" % len(s.groups), "%dU" % s.major], s.name)
+                             for s in services])
+
+    def group_rows(self, kind, groups):
+        return self.aligned([(["SomConf_Som%sService_%s" % (kind, grp.service.name), "%dU" % grp.group_id],
+                              grp.name) for grp in groups])
+
+    def emit_source(self):
+        m = self.m
+        tx_types = set(e.dtype for e in m.tx_events)
+        rx_types = set(e.dtype for e in m.rx_events)
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "som_cfg.c",
+                              "SOME/IP Configuration - Serializers and Tables",
+                              ["Static SOME/IP configuration of the VCU: serializers, length checks and",
+                               "deserializers of the data types, the shadows and TP buffers of the consumed",
+                               "events and the service, event group and event tables."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "som_stack.h"',
+               '#include "som_pack.h"',
+               "",
+               banner("c", "LOCAL VARIABLES")]
+        for e in m.rx_events:
+            out.append("STATIC Som_%sType Som_Shadow_%s;" % (e.dtype.name, e.name))
+        tp = [e for e in m.rx_events if e.tp]
+        if tp:
+            out.append("")
+        for e in tp:
+            out.append("STATIC uint8 Som_TpBuffer_%s[%dU] ALIGNED(8);" % (e.name, e.dtype.max_size))
+        out += ["", banner("c", "LOCAL FUNCTIONS")]
+
+        # Serializers of TX types and nested types, checks and deserializers of RX types and nested
+        # types; the peer codecs add the opposite direction
+        def nested(types):
+            """The types and all struct types they contain"""
+            result = set(types)
+            for t in reversed(m.types):          # Dependencies come first in m.types
+                if t in result:
+                    result |= set(e.struct for e in t.elements if e.struct is not None)
+            return result
+
+        own_ser, own_deser = nested(tx_types), nested(rx_types)
+        peer_ser, peer_deser = nested(rx_types) - own_ser, nested(tx_types) - own_deser
+        for t in m.types:
+            codec = Codec(t)
+            for wanted, peer, lines in ((t in own_ser, t in peer_ser, codec.serializer),
+                                        (t in own_deser and t in rx_types, t in peer_deser and t in tx_types,
+                                         codec.check),
+                                        (t in own_deser, t in peer_deser, codec.deserializer)):
+                if wanted:
+                    out += lines()
+                elif peer:
+                    out += ["#if (SOM_PEER_CODECS == STD_ON)"] + lines()[:-1] + ["#endif", ""]
+
+        out = "\n".join(out).replace("#endif\n\n#if (SOM_PEER_CODECS == STD_ON)\n", "\n").split("\n")
+        out.append(banner("c", "GLOBAL CONSTANTS"))
+        out += ["const Som_ServiceConfigType Som_ProvidedService[SOM_PROVIDED_SERVICE_COUNT] =", "{",
+                join_rows(self.service_rows(m.provided)), "};", "",
+                "const Som_ServiceConfigType Som_ConsumedService[SOM_CONSUMED_SERVICE_COUNT] =", "{",
+                join_rows(self.service_rows(m.consumed)), "};", "",
+                "const Som_EventGroupConfigType Som_ProvidedEventGroup[SOM_PROVIDED_EVENTGROUP_COUNT] =", "{",
+                join_rows(self.group_rows("Provided", m.provided_groups())), "};", "",
+                "const Som_EventGroupConfigType Som_ConsumedEventGroup[SOM_CONSUMED_EVENTGROUP_COUNT] =", "{",
+                join_rows(self.group_rows("Consumed", m.consumed_groups())), "};", ""]
+
+        out += ["const Som_TxEventConfigType Som_TxEvent[SOM_TX_EVENT_COUNT] =", "{"]
+        rows = []
+        for e in m.tx_events:
+            rows.append("    {   /* %s */\n"
+                        "        Som_Serialize_%s, %dUL,\n"
+                        "        SomConf_SomProvidedEventGroup_%s, 0x%04XU, %s\n"
+                        "    }" % (e.name, e.dtype.name, e.dtype.max_size, e.group.name, e.event_id,
+                                   "TRUE" if e.tp else "FALSE"))
+        out += [",\n".join(rows), "};", ""]
+
+        ordered = sorted(m.rx_events, key=lambda e: (e.group.service.service_id, e.event_id))
+        out += ["const Som_RxEventConfigType Som_RxEvent[SOM_RX_EVENT_COUNT] =", "{"]
+        rows = []
+        for e in ordered:
+            rows.append("    {   /* %s */\n"
+                        "        Som_Check_%s, Som_Deserialize_%s,\n"
+                        "        &Som_Shadow_%s, %s,\n"
+                        "        %dUL, (uint32)sizeof(Som_%sType),\n"
+                        "        SomConf_SomConsumedEventGroup_%s, 0x%04XU, 0x%04XU\n"
+                        "    }" %
+                        (e.name, e.dtype.name, e.dtype.name, e.name,
+                         ("Som_TpBuffer_%s" % e.name) if e.tp else "NULL_PTR",
+                         e.dtype.max_size, e.dtype.name, e.group.name, e.group.service.service_id, e.event_id))
+        out += [",\n".join(rows), "};", ""]
+
+        out += ["const uint16 Som_RxEventIndex[SOM_RX_EVENT_COUNT] =", "{"]
+        out += [self.list_rows([("%dU" % ordered.index(e), e.name) for e in m.rx_events]), "};", ""]
+
+        out += ["#if (SOM_PEER_CODECS == STD_ON)",
+                "const Som_SerializeFctType Som_RxEventSerialize[SOM_RX_EVENT_COUNT] =", "{",
+                self.list_rows([("Som_Serialize_" + e.dtype.name, e.name) for e in m.rx_events]),
+                "};", "",
+                "const Som_CheckFctType Som_TxEventCheck[SOM_TX_EVENT_COUNT] =", "{",
+                self.list_rows([("Som_Check_" + e.dtype.name, e.name) for e in m.tx_events]),
+                "};", "",
+                "const Som_DeserializeFctType Som_TxEventDeserialize[SOM_TX_EVENT_COUNT] =", "{",
+                self.list_rows([("Som_Deserialize_" + e.dtype.name, e.name) for e in m.tx_events]),
+                "};",
+                "#endif",
+                ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="src/bsw/com", help="output directory of som_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"som_cfg.h": emitter.emit_header(), "som_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("som_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("som_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
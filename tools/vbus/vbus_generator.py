@@ -0,0 +1,429 @@
+#!/usr/bin/env python3
+"""
+Vbus generator - ARXML bus interface configuration to the virtual bus configuration (vbus_cfg.h / vbus_cfg.c)
+
+Reads the bus interface PDUs of the VCU (CanIf CanIfCtrlCfg /
+CanIfBufferCfg / CanIfRxPduCfg / CanIfTxPduCfg, SoAd SoAdSocketRoute /
+SoAdPduRoute, EthComm EthCommAcfCanPdu), the EcuC PDUs and the PduR and
+CanTp handles they are indicated and confirmed with from one or more ARXML
+files and emits the static configuration consumed by the virtual bus of
+the host benchmarks (simulation/sil/vbus.c):
+
+- Bus table: one CAN / CAN-FD bus per CanIfCtrlCfg, indexed by its
+  CanIfCtrlId (the controller of CanIf_TransmitBatch()), with the transmit
+  buffers of the VCU on it (sum of the CanIfBufferSize of its HTHs), and
+  one Ethernet bus for the SoAd and EthComm PDUs
+- ECU table: the simulated ECUs sending the PDUs the VCU receives. A CAN
+  ECU is named after the sender prefix of its EcuC PDUs (the SHORT-NAME up
+  to the first underscore), suffixed with the bus if the prefix sends on
+  several buses (the UDS testers); an Ethernet ECU is the socket connection
+  of its SoAd socket routes
+- RX PDU tables (CanIf, SoAd): indexed by CanIfRxPduId / SoAdRxPduId, with
+  the CAN identifier or SoAd PDU header ID, the length, the sending ECU and
+  the handle the virtual bus indicates the PDU to the VCU with: the PduR
+  source PDU (PduR_CanIfRxIndication() / PduR_SoAdIfRxIndication()) or the
+  CanTp RX N-PDU (CanTp_RxIndication())
+- TX PDU tables (CanIf, SoAd, EthComm): indexed by CanIfTxPduId /
+  SoAdTxPduId / EthCommAcfCanPduId (the handle <Lo>_Transmit() is called
+  with), with the handle the virtual bus confirms the PDU with and fetches
+  its data with for a TriggerTransmit announcement: the PduR destination
+  PDU or the CanTp TX N-PDU
+
+Checks: dense handles, one controller per HRH / transmit buffer, every PDU
+indicated or confirmed to a PduR routing path or CanTp N-PDU, lengths that
+fit the frame format (CAN-FD 64, CAN 8, Ethernet VBUS_MAX_PAYLOAD).
+
+Usage:
+    python3 tools/vbus/vbus_generator.py config/autosar/communication/com.arxml \\
+        config/autosar/communication/pdu_router.arxml -o simulation/sil
+    python3 tools/vbus/vbus_generator.py ... -o simulation/sil --check
+"""
+
+import argparse
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+
+from generator_common import (  # noqa: E402
+    Arxml, GeneratorError, banner, child_text, define, dense, header_comment, join_rows, last_name,
+    one_ref, parameters, sub_containers)
+
+GENERATOR_VERSION = "1.0.0"
+
+#: Name of the Ethernet bus carrying the SoAd and EthComm PDUs
+ETHERNET_BUS = "ETH"
+
+#: Largest payload of a frame by format (VBUS_MAX_PAYLOAD is the UDP payload of one Ethernet frame)
+MAX_LENGTH = {"CAN": 8, "CANFD": 64, "ETHERNET": 1472}
+
+#: CanIf upper layers the virtual bus indicates / confirms to
+CANIF_USERS = ("PDUR", "CAN_TP")
+
+#: Limits of the generated tables (Vbus_PduConfigType)
+MAX_HANDLE = 0xFFFE
+MAX_NODES = 0xF0                        # 0xF0..0xFF are reserved node IDs (VCU, background, none)
+
+
+# ------------------------------------------------------------------------------------------------
+# Model
+# ------------------------------------------------------------------------------------------------
+
+class Bus:
+    def __init__(self, name, index, kind, tx_buffers):
+        self.name = name
+        self.index = index
+        self.kind = kind                # "CAN" / "CANFD" / "ETHERNET"
+        self.tx_buffers = tx_buffers
+        self.rx = 0
+        self.tx = 0
+
+
+class Ecu:
+    def __init__(self, name, bus):
+        self.name = name
+        self.bus = bus
+        self.index = None
+        self.pdus = 0
+
+
+class Pdu:
+    def __init__(self, name, handle, frame_id, length, bus, upper, fd):
+        self.name = name
+        self.handle = handle
+        self.frame_id = frame_id
+        self.length = length
+        self.bus = bus
+        self.upper = upper              # (macro, CanTp?) of the VCU side handle
+        self.fd = fd
+        self.ecu = None
+
+
+class Model:
+    def __init__(self, arxml):
+        self.x = arxml
+        self.buses = []
+        self.ecus = []
+        self.canif_rx = []
+        self.canif_tx = []
+        self.soad_rx = []
+        self.soad_tx = []
+        self.ethcomm_tx = []
+
+    def build(self):
+        pdur_src = self.pdur_names("PduRSrcPdu", "PduRSrcPduRef")
+        pdur_dest = self.pdur_names("PduRDestPdu", "PduRDestPduRef")
+        cantp_rx = self.cantp_npdus(("CanTpRxNPdu", "CanTpRxNPduRef"), ("CanTpRxFcNPdu", "CanTpRxFcNPduRef"))
+        cantp_tx = self.cantp_npdus(("CanTpTxNPdu", "CanTpTxNPduRef"), ("CanTpTxFcNPdu", "CanTpTxFcNPduRef"))
+
+        controllers = {}
+        for elem in self.x.containers("CanIfCtrlCfg"):
+            bus = Bus(child_text(elem, "SHORT-NAME"), int(parameters(elem)["CanIfCtrlId"]), "CAN", 0)
+            controllers[self.x.path_of[elem]] = bus
+        self.buses = dense(list(controllers.values()), "CanIfCtrlId", MAX_HANDLE, key=lambda bus: bus.index)
+        hrh_bus, buffer_bus = {}, {}
+        for elem in self.x.containers("CanIfHrhCfg"):
+            hrh_bus[self.x.path_of[elem]] = self.controller(controllers, elem, "CanIfHrhCanCtrlIdRef")
+        hth_bus = {}
+        for elem in self.x.containers("CanIfHthCfg"):
+            hth_bus[self.x.path_of[elem]] = self.controller(controllers, elem, "CanIfHthCanCtrlIdRef")
+        for elem in self.x.containers("CanIfBufferCfg"):
+            name = child_text(elem, "SHORT-NAME")
+            hth = one_ref(elem, "CanIfBufferHthRef", name)
+            if hth not in hth_bus:
+                raise GeneratorError("CanIfBufferCfg %s: %s is not a CanIfHthCfg" % (name, hth))
+            buffer_bus[self.x.path_of[elem]] = hth_bus[hth]
+            hth_bus[hth].tx_buffers += int(parameters(elem).get("CanIfBufferSize", "1"))
+
+        for elem in self.x.containers("CanIfRxPduCfg"):
+            p = parameters(elem)
+            name = child_text(elem, "SHORT-NAME")
+            pdu = one_ref(elem, "CanIfRxPduRef", name)
+            bus = self.lookup(hrh_bus, one_ref(elem, "CanIfRxPduHrhIdRef", name), name, "CanIfHrhCfg")
+            upper = self.upper(p.get("CanIfRxPduUserRxIndicationUL"), pdu, name,
+                               ("PduRConf_PduRSrcPdu_%s", pdur_src), ("CanTpConf_CanTpRxNPdu_%s", cantp_rx))
+            length = int(p.get("CanIfRxPduDataLength", self.pdu_length(pdu)))
+            self.canif_rx.append(Pdu(last_name(pdu), int(p["CanIfRxPduId"]), int(p["CanIfRxPduCanId"], 0), length,
+                                     bus, upper, self.can_fd(p["CanIfRxPduCanIdType"], name)))
+        for elem in self.x.containers("CanIfTxPduCfg"):
+            p = parameters(elem)
+            name = child_text(elem, "SHORT-NAME")
+            pdu = one_ref(elem, "CanIfTxPduRef", name)
+            bus = self.lookup(buffer_bus, one_ref(elem, "CanIfTxPduBufferRef", name), name, "CanIfBufferCfg")
+            upper = self.upper(p.get("CanIfTxPduUserTxConfirmationUL"), pdu, name,
+                               ("PduRConf_PduRDestPdu_%s", pdur_dest), ("CanTpConf_CanTpTxNPdu_%s", cantp_tx))
+            self.canif_tx.append(Pdu(last_name(pdu), int(p["CanIfTxPduId"]), int(p["CanIfTxPduCanId"], 0),
+                                     self.pdu_length(pdu), bus, upper,
+                                     self.can_fd(p["CanIfTxPduCanIdType"], name)))
+        for bus in self.buses:
+            if [pdu for pdu in self.canif_rx + self.canif_tx if pdu.bus is bus and pdu.fd]:
+                bus.kind = "CANFD"
+
+        ethernet = Bus(ETHERNET_BUS, len(self.buses), "ETHERNET", 0)
+        for elem in self.x.containers("SoAdSocketRoute"):
+            name = child_text(elem, "SHORT-NAME")
+            header_id = int(parameters(elem)["SoAdRxPduHeaderId"], 0)
+            connection = last_name(one_ref(elem, "SoAdRxSocketConnOrSocketConnBundleRef", name))
+            for dest in sub_containers(elem, "SoAdSocketRouteDest"):
+                pdu = one_ref(dest, "SoAdRxPduRef", name)
+                rx = Pdu(last_name(pdu), int(parameters(dest)["SoAdRxPduId"]), header_id, self.pdu_length(pdu),
+                         ethernet, self.upper("PDUR", pdu, name, ("PduRConf_PduRSrcPdu_%s", pdur_src)), False)
+                rx.ecu = connection
+                self.soad_rx.append(rx)
+        for elem in self.x.containers("SoAdPduRoute"):
+            name = child_text(elem, "SHORT-NAME")
+            pdu = one_ref(elem, "SoAdTxPduRef", name)
+            dests = sub_containers(elem, "SoAdPduRouteDest")
+            if len(dests) != 1:
+                raise GeneratorError("SoAdPduRoute %s: exactly one SoAdPduRouteDest required" % name)
+            self.soad_tx.append(Pdu(last_name(pdu), int(parameters(elem)["SoAdTxPduId"]),
+                                    int(parameters(dests[0])["SoAdTxPduHeaderId"], 0), self.pdu_length(pdu),
+                                    ethernet, self.upper("PDUR", pdu, name, ("PduRConf_PduRDestPdu_%s", pdur_dest)),
+                                    False))
+        for elem in self.x.containers("EthCommAcfCanPdu"):
+            p = parameters(elem)
+            name = child_text(elem, "SHORT-NAME")
+            pdu = one_ref(elem, "EthCommAcfCanPduRef", name)
+            self.ethcomm_tx.append(Pdu(last_name(pdu), int(p["EthCommAcfCanPduId"]), int(p["EthCommAcfCanId"], 0),
+                                       self.pdu_length(pdu), ethernet,
+                                       self.upper("PDUR", pdu, name, ("PduRConf_PduRDestPdu_%s", pdur_dest)),
+                                       self.can_fd(p.get("EthCommAcfCanIdType", "STANDARD_FD_CAN"), name)))
+        if self.soad_rx or self.soad_tx or self.ethcomm_tx:
+            self.buses.append(ethernet)
+
+        self.canif_rx = dense(self.canif_rx, "CanIfRxPduId", MAX_HANDLE)
+        self.canif_tx = dense(self.canif_tx, "CanIfTxPduId", MAX_HANDLE)
+        self.soad_rx = dense(self.soad_rx, "SoAdRxPduId", MAX_HANDLE)
+        self.soad_tx = dense(self.soad_tx, "SoAdTxPduId", MAX_HANDLE)
+        self.ethcomm_tx = dense(self.ethcomm_tx, "EthCommAcfCanPduId", MAX_HANDLE)
+        for pdu in self.canif_rx + self.canif_tx + self.soad_rx + self.soad_tx + self.ethcomm_tx:
+            limit = MAX_LENGTH["CANFD" if pdu.fd and pdu.bus.kind != "ETHERNET" else pdu.bus.kind]
+            if not 0 < pdu.length <= limit:
+                raise GeneratorError("PDU %s: length %d does not fit a %s frame (1..%d)" %
+                                     (pdu.name, pdu.length, pdu.bus.name, limit))
+        for pdu in self.canif_rx + self.soad_rx:
+            pdu.bus.rx += 1
+        for pdu in self.canif_tx + self.soad_tx + self.ethcomm_tx:
+            pdu.bus.tx += 1
+        self.ecus = self.senders()
+
+    def senders(self):
+        """ECUs sending the RX PDUs, in bus and first-PDU order"""
+        prefixes = {}
+        for pdu in self.canif_rx:
+            prefixes.setdefault(pdu.name.split("_")[0], set()).add(pdu.bus)
+        ecus = {}
+        for pdu in sorted(self.canif_rx + self.soad_rx, key=lambda p: (p.bus.index, p.handle)):
+            if pdu.bus.kind == "ETHERNET":
+                name = pdu.ecu[len("SoCon_"):] if pdu.ecu.startswith("SoCon_") else pdu.ecu
+            else:
+                name = pdu.name.split("_")[0]
+                if len(prefixes[name]) > 1:
+                    name = "%s_%s" % (name, pdu.bus.name.split("_")[-1])
+            if name not in ecus:
+                ecus[name] = Ecu(name, pdu.bus)
+                ecus[name].index = len(ecus) - 1
+            if ecus[name].bus is not pdu.bus:
+                raise GeneratorError("ECU %s sends on %s and %s" % (name, ecus[name].bus.name, pdu.bus.name))
+            pdu.ecu = ecus[name]
+            ecus[name].pdus += 1
+        if len(ecus) > MAX_NODES:
+            raise GeneratorError("more than %d ECUs" % MAX_NODES)
+        return sorted(ecus.values(), key=lambda e: e.index)
+
+    def pdur_names(self, container, ref_name):
+        """{EcuC PDU path: PduRSrcPdu / PduRDestPdu SHORT-NAME}"""
+        names = {}
+        for elem in self.x.containers(container):
+            names[one_ref(elem, ref_name, child_text(elem, "SHORT-NAME"))] = child_text(elem, "SHORT-NAME")
+        return names
+
+    def cantp_npdus(self, *containers):
+        """{EcuC PDU path: N-PDU name} of the CanTp data and flow control N-PDUs of one direction"""
+        names = {}
+        for container, ref_name in containers:
+            for elem in self.x.containers(container):
+                pdu = one_ref(elem, ref_name, child_text(elem, "SHORT-NAME"))
+                names[pdu] = last_name(pdu)
+        return names
+
+    def controller(self, controllers, elem, ref_name):
+        name = child_text(elem, "SHORT-NAME")
+        return self.lookup(controllers, one_ref(elem, ref_name, name), name, "CanIfCtrlCfg")
+
+    @staticmethod
+    def lookup(table, ref, what, definition):
+        if ref not in table:
+            raise GeneratorError("%s: %s is not a %s" % (what, ref, definition))
+        return table[ref]
+
+    @staticmethod
+    def upper(user, pdu, what, pdur, cantp=None):
+        """(handle macro, CanTp?) the virtual bus passes the PDU to the VCU with"""
+        if user not in CANIF_USERS:
+            raise GeneratorError("%s: unsupported upper layer %s" % (what, user))
+        macro, names = pdur if user == "PDUR" else cantp
+        if pdu not in names:
+            raise GeneratorError("%s: %s is not used by a %s" %
+                                 (what, pdu, "PduR routing path" if user == "PDUR" else "CanTp N-PDU"))
+        return macro % names[pdu], user == "CAN_TP"
+
+    @staticmethod
+    def can_fd(id_type, what):
+        if id_type not in ("STANDARD_CAN", "STANDARD_FD_CAN", "EXTENDED_CAN", "EXTENDED_FD_CAN"):
+            raise GeneratorError("%s: unsupported CAN ID type %s" % (what, id_type))
+        return id_type.endswith("_FD_CAN")
+
+    def pdu_length(self, pdu):
+        return int(parameters(self.x.resolve(pdu))["PduLength"])
+
+
+# ------------------------------------------------------------------------------------------------
+# Output
+# ------------------------------------------------------------------------------------------------
+
+class Emitter:
+    def __init__(self, model, inputs):
+        self.m = model
+        self.inputs = inputs
+
+    def doc_buses(self):
+        rows = ["| Bus      | Format   | VCU TX buffers | RX PDUs | TX PDUs | ECUs                                  |",
+                "|----------|----------|----------------|---------|---------|---------------------------------------|"]
+        for bus in self.m.buses:
+            ecus = ", ".join(e.name for e in self.m.ecus if e.bus is bus)
+            rows.append("| %-8s | %-8s | %-14s | %-7d | %-7d | %-37s |" %
+                        (bus.name, bus.kind, str(bus.tx_buffers) if bus.tx_buffers else "-", bus.rx, bus.tx, ecus))
+        return rows
+
+    # -- vbus_cfg.h ------------------------------------------------------------------------------
+
+    def emit_header(self):
+        m = self.m
+        details = ["Buses, simulated ECUs and bus interface PDUs of the VCU for the virtual",
+                   "bus (%d buses, %d ECUs):" % (len(m.buses), len(m.ecus)),
+                   ""]
+        details += self.doc_buses()
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "vbus_cfg.h",
+                              "Vbus Configuration - Buses, ECUs and PDU Counts", details),
+               "#ifndef VBUS_CFG_H",
+               "#define VBUS_CFG_H",
+               "",
+               banner("h", "CONFIGURATION COUNTS"),
+               define("VBUS_BUS_COUNT", "%dU" % len(m.buses)),
+               define("VBUS_CAN_BUS_COUNT", "%dU" % len([b for b in m.buses if b.kind != "ETHERNET"])),
+               define("VBUS_ECU_COUNT", "%dU" % len(m.ecus)),
+               define("VBUS_CANIF_RX_PDU_COUNT", "%dU" % len(m.canif_rx)),
+               define("VBUS_CANIF_TX_PDU_COUNT", "%dU" % len(m.canif_tx)),
+               define("VBUS_SOAD_RX_PDU_COUNT", "%dU" % len(m.soad_rx)),
+               define("VBUS_SOAD_TX_PDU_COUNT", "%dU" % len(m.soad_tx)),
+               define("VBUS_ETHCOMM_TX_PDU_COUNT", "%dU" % len(m.ethcomm_tx)),
+               "",
+               banner("h", "BUSES (CanIfCtrlId of the CAN buses)")]
+        for bus in m.buses:
+            out.append(define("VbusConf_VbusBus_%s" % bus.name, "%dU" % bus.index))
+        out += ["", banner("h", "SIMULATED ECUS")]
+        for ecu in m.ecus:
+            out.append(define("VbusConf_VbusEcu_%s" % ecu.name, "%dU" % ecu.index))
+        out += ["",
+                "#endif /* VBUS_CFG_H */",
+                "",
+                banner("h", "END OF FILE").rstrip("\n"),
+                ""]
+        return "\n".join(out)
+
+    # -- vbus_cfg.c ------------------------------------------------------------------------------
+
+    @staticmethod
+    def pdu_rows(pdus, with_ecu):
+        width = max(len(p.upper[0]) for p in pdus) + 1
+        rows = []
+        for pdu in pdus:
+            flags = ["VBUS_PDU_FD" if pdu.fd else None, "VBUS_PDU_CANTP" if pdu.upper[1] else None]
+            flags = " | ".join(f for f in flags if f) or "0U"
+            rows.append("    { 0x%08XUL, %s %3dU, %s, %s, %s }   /* %d %s */" %
+                        (pdu.frame_id, (pdu.upper[0] + ",").ljust(width), pdu.length,
+                         "VbusConf_VbusBus_%s" % pdu.bus.name,
+                         "VbusConf_VbusEcu_%s" % pdu.ecu.name if with_ecu else "VBUS_NODE_VCU",
+                         flags, pdu.handle, pdu.name))
+        return join_rows(rows)
+
+    def emit_source(self):
+        m = self.m
+        out = [header_comment(__file__, GENERATOR_VERSION, self.inputs, "vbus_cfg.c",
+                              "Vbus Configuration - Bus, ECU and PDU Tables",
+                              ["Static configuration of the virtual bus: the buses, the simulated ECUs and",
+                               "the bus interface PDUs of the VCU with the PduR and CanTp handles the",
+                               "virtual bus indicates and confirms them with."]),
+               banner("c", "INCLUDE FILES"),
+               '#include "vbus.h"',
+               '#include "pdu_router.h"',
+               '#include "can_tp.h"',
+               "",
+               banner("c", "GLOBAL CONSTANTS"),
+               "const Vbus_BusConfigType Vbus_Bus[VBUS_BUS_COUNT] =",
+               "{"]
+        width = max(len(b.name) for b in m.buses) + 3
+        rows = ["    { %s %s %dU }   /* %d */" %
+                (('"%s",' % b.name).ljust(width), ("VBUS_%s," % b.kind).ljust(len("VBUS_ETHERNET,")),
+                 b.tx_buffers, b.index) for b in m.buses]
+        out += [join_rows(rows), "};", "",
+                "const Vbus_EcuConfigType Vbus_Ecu[VBUS_ECU_COUNT] =",
+                "{"]
+        width = max(len(e.name) for e in m.ecus) + 3
+        bus_width = max(len(b.name) for b in m.buses) + len("VbusConf_VbusBus_,")
+        rows = ["    { %s %s %3dU }   /* %d */" %
+                (('"%s",' % e.name).ljust(width), ("VbusConf_VbusBus_%s," % e.bus.name).ljust(bus_width),
+                 e.pdus, e.index) for e in m.ecus]
+        out += [join_rows(rows), "};", ""]
+        for table, count, pdus, with_ecu in (
+                ("Vbus_CanIfRxPdu", "VBUS_CANIF_RX_PDU_COUNT", m.canif_rx, True),
+                ("Vbus_CanIfTxPdu", "VBUS_CANIF_TX_PDU_COUNT", m.canif_tx, False),
+                ("Vbus_SoAdRxPdu", "VBUS_SOAD_RX_PDU_COUNT", m.soad_rx, True),
+                ("Vbus_SoAdTxPdu", "VBUS_SOAD_TX_PDU_COUNT", m.soad_tx, False),
+                ("Vbus_EthCommTxPdu", "VBUS_ETHCOMM_TX_PDU_COUNT", m.ethcomm_tx, False)):
+            if not pdus:
+                continue
+            out += ["const Vbus_PduConfigType %s[%s] =" % (table, count), "{", self.pdu_rows(pdus, with_ecu), "};", ""]
+        out.append(banner("c", "END OF FILE"))
+        return "\n".join(out)
+
+
+# ------------------------------------------------------------------------------------------------
+# Command line
+# ------------------------------------------------------------------------------------------------
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("arxml", nargs="+", help="ARXML input files")
+    parser.add_argument("-o", "--output", default="simulation/sil", help="output directory of vbus_cfg.h/.c")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the files in the output directory differ from the generated ones")
+    args = parser.parse_args(argv)
+
+    try:
+        model = Model(Arxml(args.arxml))
+        model.build()
+        emitter = Emitter(model, [os.path.relpath(p).replace(os.sep, "/") for p in args.arxml])
+        files = {"vbus_cfg.h": emitter.emit_header(), "vbus_cfg.c": emitter.emit_source()}
+    except (GeneratorError, ET.ParseError, KeyError, ValueError) as exc:
+        sys.stderr.write("vbus_generator: error: %s\n" % exc)
+        return 1
+
+    status = 0
+    for name, text in files.items():
+        path = os.path.join(args.output, name)
+        if args.check:
+            current = open(path).read() if os.path.exists(path) else ""
+            if current != text:
+                sys.stderr.write("vbus_generator: %s is out of date\n" % path)
+                status = 1
+        else:
+            with open(path, "w", newline="\n") as handle:
+                handle.write(text)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())